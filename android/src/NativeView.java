@@ -336,6 +336,7 @@ class NativeView extends SurfaceView
 
   protected native void pauseNative();
   protected native void resumeNative();
+  protected native void lowMemoryNative();
 
   protected native void setBatteryPercent(int level, int plugged);
 
@@ -453,6 +454,10 @@ class NativeView extends SurfaceView
     pauseNative();
   }
 
+  public void onLowMemory() {
+    lowMemoryNative();
+  }
+
   public void exitApp() {
   }
 
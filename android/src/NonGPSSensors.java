@@ -30,6 +30,7 @@
 package org.xcsoar;
 
 import android.content.Context;
+import android.os.Build;
 import android.os.Handler;
 import android.hardware.Sensor;
 import android.hardware.SensorEvent;
@@ -107,6 +108,28 @@ public class NonGPSSensors implements SensorEventListener, Runnable {
   // Noise variance we'll use for the pressure sensor in this device.
   private float kf_sensor_noise_variance_;
 
+  /**
+   * The maximum number of pressure samples passed to the native code
+   * in one call.
+   */
+  private static final int PRESSURE_BATCH_SIZE = 16;
+
+  /**
+   * Allow the pressure sensor to keep samples in its hardware FIFO
+   * for this long [us], so the CPU can sleep in between.
+   */
+  private static final int PRESSURE_MAX_REPORT_LATENCY_US = 100000;
+
+  /**
+   * A sample younger than this [ns] is "live", i.e. the end of a
+   * FIFO burst; the batch is flushed then.
+   */
+  private static final long PRESSURE_LIVE_NS = 20000000;
+
+  private final float[] pressure_values_ = new float[PRESSURE_BATCH_SIZE];
+  private final long[] pressure_timestamps_ = new long[PRESSURE_BATCH_SIZE];
+  private int n_pressure_ = 0;
+
   private final SafeDestruct safeDestruct = new SafeDestruct();
 
   /**
@@ -245,8 +268,13 @@ public class NonGPSSensors implements SensorEventListener, Runnable {
     for (int id : SUPPORTED_SENSORS) {
       if (enabled_sensors_[id] && default_sensors_[id] != null) {
         Log.d(TAG, "Subscribing to sensor ID " + id + " (" + default_sensors_[id].getName() + ")");
-        sensor_manager_.registerListener(this, default_sensors_[id],
-                                         sensor_manager_.SENSOR_DELAY_NORMAL);
+        if (id == Sensor.TYPE_PRESSURE && Build.VERSION.SDK_INT >= 19)
+          sensor_manager_.registerListener(this, default_sensors_[id],
+                                           sensor_manager_.SENSOR_DELAY_NORMAL,
+                                           PRESSURE_MAX_REPORT_LATENCY_US);
+        else
+          sensor_manager_.registerListener(this, default_sensors_[id],
+                                           sensor_manager_.SENSOR_DELAY_NORMAL);
       }
     }
     Log.d(TAG, "Done updating non-GPS sensor subscriptions...");
@@ -273,7 +301,20 @@ public class NonGPSSensors implements SensorEventListener, Runnable {
         setMagneticField(event.values[0], event.values[1], event.values[2]);
         break;
       case Sensor.TYPE_PRESSURE:
-        setBarometricPressure(event.values[0], kf_sensor_noise_variance_);
+        pressure_values_[n_pressure_] = event.values[0];
+        pressure_timestamps_[n_pressure_] = event.timestamp;
+        ++n_pressure_;
+
+        /* samples from the hardware FIFO arrive in a burst; pass
+           them to the native code in one call when the burst is over
+           (or the batch is full) */
+        if (n_pressure_ == PRESSURE_BATCH_SIZE ||
+            Build.VERSION.SDK_INT < 17 ||
+            SystemClock.elapsedRealtimeNanos() - event.timestamp < PRESSURE_LIVE_NS) {
+          setBarometricPressures(pressure_values_, pressure_timestamps_,
+                                 n_pressure_, kf_sensor_noise_variance_);
+          n_pressure_ = 0;
+        }
         break;
       }
     } finally {
@@ -285,5 +326,7 @@ public class NonGPSSensors implements SensorEventListener, Runnable {
   private native void setAcceleration(float ddx, float ddy, float ddz);
   private native void setRotation(float dtheta_x, float dtheta_y, float dtheta_z);
   private native void setMagneticField(float h_x, float h_y, float h_z);
-  private native void setBarometricPressure(float pressure, float sensor_noise_variance);
+  private native void setBarometricPressures(float[] pressures,
+                                             long[] timestamps_ns, int n,
+                                             float sensor_noise_variance);
 }
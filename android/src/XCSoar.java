@@ -42,6 +42,7 @@ import android.content.IntentFilter;
 import android.content.BroadcastReceiver;
 import android.content.ServiceConnection;
 import android.content.ComponentName;
+import android.content.ComponentCallbacks2;
 import android.util.Log;
 import android.provider.Settings;
 import android.view.View;
@@ -199,6 +200,22 @@ public class XCSoar extends Activity {
     super.onPause();
   }
 
+  @Override public void onLowMemory() {
+    if (nativeView != null)
+      nativeView.onLowMemory();
+    super.onLowMemory();
+  }
+
+  @Override public void onTrimMemory(int level) {
+    /* flush the caches when the system starts killing background
+       processes, or when we are about to be killed ourselves */
+    if (nativeView != null &&
+        level >= ComponentCallbacks2.TRIM_MEMORY_RUNNING_LOW &&
+        level != ComponentCallbacks2.TRIM_MEMORY_UI_HIDDEN)
+      nativeView.onLowMemory();
+    super.onTrimMemory(level);
+  }
+
   private void getHapticFeedbackSettings() {
     boolean hapticFeedbackEnabled;
     try {
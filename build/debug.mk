@@ -1,6 +1,9 @@
 DEBUG ?= y
 DEBUG_GLIBCXX ?= n
 
+# count heap allocations per subsystem (see Util/AllocationStats.hpp)?
+ALLOC_STATS ?= n
+
 ifeq ($(DEBUG),y)
 OPTIMIZE := -O0
 OPTIMIZE += -funit-at-a-time
@@ -56,6 +59,10 @@ else
 FLAGS_PROFILE :=
 endif
 
+ifeq ($(ALLOC_STATS),y)
+TARGET_CPPFLAGS += -DALLOC_STATS
+endif
+
 ifeq ($(SANITIZE),y)
 SANITIZE_FLAGS := -fsanitize=address
 else
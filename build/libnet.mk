@@ -35,7 +35,8 @@ ifeq ($(HAVE_HTTP),y)
 LIBNET_SOURCES += \
 	$(SRC)/Net/HTTP/DownloadManager.cpp \
 	$(SRC)/Net/HTTP/ToFile.cpp \
-	$(SRC)/Net/HTTP/ToBuffer.cpp
+	$(SRC)/Net/HTTP/ToBuffer.cpp \
+	$(SRC)/Net/HTTP/Upload.cpp
 
 endif
 
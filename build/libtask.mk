@@ -60,6 +60,7 @@ TASK_SOURCES = \
 	$(TASK_SRC_DIR)/Solvers/TaskMacCreadyTravelled.cpp \
 	$(TASK_SRC_DIR)/Solvers/TaskMacCreadyRemaining.cpp \
 	$(TASK_SRC_DIR)/Solvers/TaskMacCreadyTotal.cpp \
+	$(TASK_SRC_DIR)/Solvers/TaskLegCache.cpp \
 	$(TASK_SRC_DIR)/Solvers/TaskBestMc.cpp \
 	$(TASK_SRC_DIR)/Solvers/TaskSolveTravelled.cpp \
 	$(TASK_SRC_DIR)/Solvers/TaskCruiseEfficiency.cpp \
@@ -25,4 +25,9 @@ UTIL_SOURCES += \
 	$(UTIL_SRC_DIR)/WStringUtil.cpp
 endif
 
+ifeq ($(ALLOC_STATS),y)
+UTIL_SOURCES += \
+	$(UTIL_SRC_DIR)/AllocationStats.cpp
+endif
+
 $(eval $(call link-library,util,UTIL))
@@ -13,6 +13,7 @@ LUA_SOURCES = \
 	$(SRC)/Lua/Ptr.cpp \
 	$(SRC)/Lua/Error.cpp \
 	$(SRC)/Lua/Catch.cpp \
+	$(SRC)/Lua/Budget.cpp \
 	$(SRC)/Lua/Persistent.cpp \
 	$(SRC)/Lua/Background.cpp \
 	$(SRC)/Lua/Associate.cpp \
@@ -33,6 +34,7 @@ LUA_SOURCES = \
         $(SRC)/Lua/Wind.cpp \
         $(SRC)/Lua/Logger.cpp \
         $(SRC)/Lua/Tracking.cpp \
+        $(SRC)/Lua/Timing.cpp \
 		$(SRC)/Lua/Replay.cpp \
 	    $(SRC)/Lua/InputEvent.cpp \
 
@@ -23,6 +23,13 @@ endif
 # compile without UI?
 HEADLESS ?= n
 
+# evaluate fastsine()/fastcosine() with polynomials instead of lookup
+# tables (see Math/PolyTrig.hpp)?
+POLY_TRIG ?= n
+ifeq ($(POLY_TRIG),y)
+TARGET_CPPFLAGS += -DPOLY_TRIG
+endif
+
 ifeq ($(TARGET_IS_KOBO),y)
 DITHER ?= y
 else
@@ -39,7 +39,9 @@
 #include "Util/Macros.hpp"
 
 #include <vector>
+#include <string>
 #include <algorithm>
+#include <iterator>
 
 static constexpr AirspaceClassStringCouple airspace_class_strings[] = {
   { "CLASSA", CLASSA },
@@ -197,80 +199,128 @@ PyObject* xcsoar_Airspaces_addPolygon(Pyxcsoar_Airspaces *self, PyObject *args)
 }
 
 PyObject* xcsoar_Airspaces_optimise(Pyxcsoar_Airspaces *self) {
+  Py_BEGIN_ALLOW_THREADS
   self->airspace_database->Optimise();
+  Py_END_ALLOW_THREADS
 
   Py_RETURN_NONE;
 }
 
-PyObject* xcsoar_Airspaces_findIntrusions(Pyxcsoar_Airspaces *self, PyObject *args) {
-  PyObject *py_flight = nullptr;
-
-  if (!PyArg_ParseTuple(args, "O", &py_flight)) {
-    PyErr_SetString(PyExc_AttributeError, "Can't parse argument.");
-    return nullptr;
-  }
+struct IntrusionFix {
+  BrokenDateTime time;
+  GeoPoint location;
+};
 
-  DebugReplay *replay = ((Pyxcsoar_Flight*)py_flight)->flight->Replay();
+typedef std::vector<IntrusionFix> IntrusionPeriod;
 
-  if (replay == nullptr) {
-    PyErr_SetString(PyExc_IOError, "Can't start replay - file not found.");
-    return nullptr;
-  }
+/**
+ * All periods spent inside airspaces sharing one name, in the order
+ * of their first intrusion.
+ */
+struct AirspaceIntrusions {
+  std::string name;
+  std::vector<IntrusionPeriod> periods;
+};
 
-  PyObject *py_result = PyDict_New();
+/**
+ * Replay the flight and collect all airspace intrusions.  This does
+ * not touch any Python object, so it may run without holding the
+ * GIL.
+ */
+static void
+FindIntrusions(const Airspaces &airspace_database, DebugReplay &replay,
+               std::vector<AirspaceIntrusions> &result) {
   Airspaces::AirspaceVector last_airspaces;
 
-  while (replay->Next()) {
-    const MoreData &basic = replay->Basic();
+  while (replay.Next()) {
+    const MoreData &basic = replay.Basic();
 
     if (!basic.time_available || !basic.location_available ||
         !basic.NavAltitudeAvailable())
       continue;
 
     const auto range =
-      self->airspace_database->QueryInside(ToAircraftState(basic,
-                                                           replay->Calculated()));
+      airspace_database.QueryInside(ToAircraftState(basic,
+                                                    replay.Calculated()));
     Airspaces::AirspaceVector airspaces(range.begin(), range.end());
     for (auto it = airspaces.begin(); it != airspaces.end(); it++) {
-      PyObject *py_name = PyString_FromString((*it).GetAirspace().GetName());
-      PyObject *py_airspace = nullptr,
-               *py_period = nullptr;
+      const char *name = (*it).GetAirspace().GetName();
 
-      if (PyDict_Contains(py_result, py_name) == 0) {
-        // this is the first fix inside this airspace
-        py_airspace = PyList_New(0);
-        PyDict_SetItem(py_result, py_name, py_airspace);
-
-        py_period = PyList_New(0);
-        PyList_Append(py_airspace, py_period);
-        Py_DECREF(py_period);
+      auto intrusions = std::find_if(result.begin(), result.end(),
+                                     [name](const AirspaceIntrusions &i){
+                                       return i.name == name;
+                                     });
 
+      if (intrusions == result.end()) {
+        // this is the first fix inside this airspace
+        result.emplace_back();
+        intrusions = std::prev(result.end());
+        intrusions->name = name;
+        intrusions->periods.emplace_back();
       } else {
         // this airspace was hit some time before...
-        py_airspace = PyDict_GetItem(py_result, py_name);
 
         // check if the last fix was already inside this airspace
         auto in_last = std::find(last_airspaces.begin(), last_airspaces.end(), *it);
 
-        if (in_last == last_airspaces.end()) {
+        if (in_last == last_airspaces.end())
           // create a new period
-          py_period = PyList_New(0);
-          PyList_Append(py_airspace, py_period);
-          Py_DECREF(py_period);
-        } else {
-          py_period = PyList_GET_ITEM(py_airspace, PyList_GET_SIZE(py_airspace) - 1);
-        }
+          intrusions->periods.emplace_back();
       }
 
-      PyList_Append(py_period, Py_BuildValue("{s:N,s:N}",
-        "time", Python::BrokenDateTimeToPy(basic.date_time_utc),
-        "location", Python::WriteLonLat(basic.location)));
+      intrusions->periods.back().push_back({basic.date_time_utc,
+                                            basic.location});
     }
 
     last_airspaces = std::move(airspaces);
   }
+}
 
+PyObject* xcsoar_Airspaces_findIntrusions(Pyxcsoar_Airspaces *self, PyObject *args) {
+  PyObject *py_flight = nullptr;
+
+  if (!PyArg_ParseTuple(args, "O", &py_flight)) {
+    PyErr_SetString(PyExc_AttributeError, "Can't parse argument.");
+    return nullptr;
+  }
+
+  DebugReplay *replay = ((Pyxcsoar_Flight*)py_flight)->flight->Replay();
+
+  if (replay == nullptr) {
+    PyErr_SetString(PyExc_IOError, "Can't start replay - file not found.");
+    return nullptr;
+  }
+
+  std::vector<AirspaceIntrusions> intrusions;
+
+  Py_BEGIN_ALLOW_THREADS
+  FindIntrusions(*self->airspace_database, *replay, intrusions);
   delete replay;
+  Py_END_ALLOW_THREADS
+
+  PyObject *py_result = PyDict_New();
+
+  for (const auto &i : intrusions) {
+    PyObject *py_airspace = PyList_New(0);
+
+    for (const auto &period : i.periods) {
+      PyObject *py_period = PyList_New(0);
+
+      for (const auto &fix : period) {
+        PyObject *py_fix = Py_BuildValue("{s:N,s:N}",
+          "time", Python::BrokenDateTimeToPy(fix.time),
+          "location", Python::WriteLonLat(fix.location));
+        PyList_Append(py_period, py_fix);
+        Py_DECREF(py_fix);
+      }
+
+      PyList_Append(py_airspace, py_period);
+      Py_DECREF(py_period);
+    }
+
+    PyDict_SetItemString(py_result, i.name.c_str(), py_airspace);
+    Py_DECREF(py_airspace);
+  }
 
   return py_result;
 }
@@ -174,6 +174,136 @@ PyObject* xcsoar_Flight_path(Pyxcsoar_Flight *self, PyObject *args) {
   return py_fixes;
 }
 
+/**
+ * The fix columns collected by xcsoar_Flight_arrays().
+ */
+struct FixColumns {
+  std::vector<int64_t> time;
+  std::vector<double> latitude, longitude;
+  std::vector<int32_t> gps_altitude, pressure_altitude, elevation, level;
+  std::vector<int16_t> enl, rpm, gsp, ias, tas, siu;
+
+  void Append(int64_t date_time_utc, const IGCFixEnhanced &fix) {
+    time.push_back(date_time_utc);
+    latitude.push_back(fix.location.latitude.Degrees());
+    longitude.push_back(fix.location.longitude.Degrees());
+    gps_altitude.push_back(fix.gps_altitude);
+    pressure_altitude.push_back(fix.pressure_altitude);
+    elevation.push_back(fix.elevation);
+    level.push_back(fix.level);
+    enl.push_back(fix.enl);
+    rpm.push_back(fix.rpm);
+    gsp.push_back(fix.gsp);
+    ias.push_back(fix.ias);
+    tas.push_back(fix.tas);
+    siu.push_back(fix.siu);
+  }
+};
+
+/**
+ * Copy a column into a new bytearray and add it to the dictionary as
+ * a (dtype, bytearray) tuple.
+ */
+template<typename T>
+static bool
+AddColumn(PyObject *py_dict, const char *name, const char *dtype,
+          const std::vector<T> &column) {
+  PyObject *py_buffer =
+    PyByteArray_FromStringAndSize((const char *)column.data(),
+                                  column.size() * sizeof(T));
+  if (py_buffer == nullptr)
+    return false;
+
+  PyObject *py_column = Py_BuildValue("(sN)", dtype, py_buffer);
+  if (py_column == nullptr)
+    return false;
+
+  const bool success = PyDict_SetItemString(py_dict, name, py_column) == 0;
+  Py_DECREF(py_column);
+  return success;
+}
+
+PyObject* xcsoar_Flight_arrays(Pyxcsoar_Flight *self, PyObject *args) {
+  PyObject *py_begin = nullptr,
+           *py_end = nullptr;
+
+  if (!PyArg_ParseTuple(args, "|OO", &py_begin, &py_end)) {
+    PyErr_SetString(PyExc_AttributeError, "Can't parse argument list.");
+    return nullptr;
+  }
+
+  int64_t begin = 0,
+          end = std::numeric_limits<int64_t>::max();
+
+  if (py_begin != nullptr && PyDateTime_Check(py_begin))
+    begin = Python::PyToBrokenDateTime(py_begin).ToUnixTimeUTC();
+
+  if (py_end != nullptr && PyDateTime_Check(py_end))
+    end = Python::PyToBrokenDateTime(py_end).ToUnixTimeUTC();
+
+  DebugReplay *replay = self->flight->Replay();
+
+  if (replay == nullptr) {
+    PyErr_SetString(PyExc_IOError, "Can't start replay - file not found.");
+    return nullptr;
+  }
+
+  FixColumns columns;
+
+  /* no Python objects are touched while walking the fixes, so other
+     Python threads may run meanwhile */
+  Py_BEGIN_ALLOW_THREADS
+  while (replay->Next()) {
+    if (replay->Level() == -1) continue;
+
+    const MoreData &basic = replay->Basic();
+    const int64_t date_time_utc = basic.date_time_utc.ToUnixTimeUTC();
+
+    if (date_time_utc < begin)
+      continue;
+    else if (date_time_utc > end)
+      break;
+
+    if (!basic.time_available || !basic.location_available ||
+        !basic.NavAltitudeAvailable())
+      continue;
+
+    IGCFixEnhanced fix;
+    fix.Clear();
+    fix.Apply(basic, replay->Calculated());
+    fix.level = replay->Level();
+
+    columns.Append(date_time_utc, fix);
+  }
+
+  delete replay;
+  Py_END_ALLOW_THREADS
+
+  PyObject *py_columns = PyDict_New();
+  if (py_columns == nullptr)
+    return nullptr;
+
+  if (!AddColumn(py_columns, "time", "i8", columns.time) ||
+      !AddColumn(py_columns, "latitude", "f8", columns.latitude) ||
+      !AddColumn(py_columns, "longitude", "f8", columns.longitude) ||
+      !AddColumn(py_columns, "gps_altitude", "i4", columns.gps_altitude) ||
+      !AddColumn(py_columns, "pressure_altitude", "i4",
+                 columns.pressure_altitude) ||
+      !AddColumn(py_columns, "elevation", "i4", columns.elevation) ||
+      !AddColumn(py_columns, "level", "i4", columns.level) ||
+      !AddColumn(py_columns, "enl", "i2", columns.enl) ||
+      !AddColumn(py_columns, "rpm", "i2", columns.rpm) ||
+      !AddColumn(py_columns, "gsp", "i2", columns.gsp) ||
+      !AddColumn(py_columns, "ias", "i2", columns.ias) ||
+      !AddColumn(py_columns, "tas", "i2", columns.tas) ||
+      !AddColumn(py_columns, "siu", "i2", columns.siu)) {
+    Py_DECREF(py_columns);
+    return nullptr;
+  }
+
+  return py_columns;
+}
+
 PyObject* xcsoar_Flight_times(Pyxcsoar_Flight *self) {
   std::vector<FlightTimeResult> results;
 
@@ -417,6 +547,7 @@ PyObject* xcsoar_Flight_encode(Pyxcsoar_Flight *self, PyObject *args) {
     return nullptr;
   }
 
+  Py_BEGIN_ALLOW_THREADS
   while (replay->Next()) {
     if (replay->Level() == -1) continue;
 
@@ -448,6 +579,7 @@ PyObject* xcsoar_Flight_encode(Pyxcsoar_Flight *self, PyObject *args) {
   }
 
   delete replay;
+  Py_END_ALLOW_THREADS
 
 
   PyObject *py_result = Py_BuildValue("{s:s,s:s,s:s,s:s,s:s}",
@@ -463,6 +595,7 @@ PyObject* xcsoar_Flight_encode(Pyxcsoar_Flight *self, PyObject *args) {
 PyMethodDef xcsoar_Flight_methods[] = {
   {"setQNH", (PyCFunction)xcsoar_Flight_setQNH, METH_VARARGS, "Set QNH for the flight (in hPa)."},
   {"path", (PyCFunction)xcsoar_Flight_path, METH_VARARGS, "Get flight as list."},
+  {"arrays", (PyCFunction)xcsoar_Flight_arrays, METH_VARARGS, "Get flight as a dict of (dtype, bytearray) columns, e.g. for numpy.frombuffer()."},
   {"times", (PyCFunction)xcsoar_Flight_times, METH_VARARGS, "Get takeoff/release/landing times from flight."},
   {"reduce", (PyCFunction)xcsoar_Flight_reduce, METH_VARARGS | METH_KEYWORDS, "Reduce flight."},
   {"analyse", (PyCFunction)xcsoar_Flight_analyse, METH_VARARGS | METH_KEYWORDS, "Analyse flight."},
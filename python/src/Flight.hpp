@@ -40,6 +40,7 @@ void xcsoar_Flight_dealloc(Pyxcsoar_Flight *self);
 
 PyObject* xcsoar_Flight_setQNH(Pyxcsoar_Flight *self, PyObject *args);
 PyObject* xcsoar_Flight_path(Pyxcsoar_Flight *self, PyObject *args);
+PyObject* xcsoar_Flight_arrays(Pyxcsoar_Flight *self, PyObject *args);
 PyObject* xcsoar_Flight_times(Pyxcsoar_Flight *self);
 PyObject* xcsoar_Flight_reduce(Pyxcsoar_Flight *self, PyObject *args, PyObject *kwargs);
 PyObject* xcsoar_Flight_analyse(Pyxcsoar_Flight *self, PyObject *args, PyObject *kwargs);
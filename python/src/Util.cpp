@@ -28,6 +28,100 @@
 #include "Tools/GoogleEncode.hpp"
 
 
+enum class Method { UNSIGNED, SIGNED, DOUBLE };
+
+static bool
+ParseMethod(PyObject *py_method, Method &method) {
+  if (py_method == nullptr)
+    method = Method::UNSIGNED;
+  else if (PyString_Check(py_method) && strcmp(PyString_AsString(py_method), "unsigned") == 0)
+    method = Method::UNSIGNED;
+  else if (PyString_Check(py_method) && strcmp(PyString_AsString(py_method), "signed") == 0)
+    method = Method::SIGNED;
+  else if (PyString_Check(py_method) && strcmp(PyString_AsString(py_method), "double") == 0)
+    method = Method::DOUBLE;
+  else {
+    PyErr_SetString(PyExc_TypeError, "Can't parse method.");
+    return false;
+  }
+
+  return true;
+}
+
+template<typename T>
+static void
+EncodeValues(GoogleEncode &encoded, Method method,
+             const T *values, Py_ssize_t n) {
+  for (Py_ssize_t i = 0; i < n; ++i) {
+    switch (method) {
+    case Method::UNSIGNED:
+      encoded.addUnsignedNumber(values[i]);
+      break;
+
+    case Method::SIGNED:
+      encoded.addSignedNumber(values[i]);
+      break;
+
+    case Method::DOUBLE:
+      encoded.addDouble(values[i]);
+      break;
+    }
+  }
+}
+
+/**
+ * Encode the contents of a one- or two-dimensional object which
+ * implements the buffer protocol (e.g. a numpy array) without
+ * creating a Python object for each value.
+ */
+static PyObject *
+EncodeBuffer(PyObject *py_buffer, Method method, bool delta, double floor_to) {
+  Py_buffer view;
+  if (PyObject_GetBuffer(py_buffer, &view,
+                         PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0)
+    return nullptr;
+
+  if (view.ndim < 1 || view.ndim > 2) {
+    PyBuffer_Release(&view);
+    PyErr_SetString(PyExc_TypeError, "Expected a one- or two-dimensional array.");
+    return nullptr;
+  }
+
+  const unsigned dimension = view.ndim == 2 ? view.shape[1] : 1;
+  const Py_ssize_t n = view.len / view.itemsize;
+  const char *format = view.format != nullptr ? view.format : "B";
+
+  /* skip the byte order character, only native order is supported */
+  if (*format == '@' || *format == '=')
+    ++format;
+
+  GoogleEncode encoded(dimension, delta, floor_to);
+
+  if (strcmp(format, "d") == 0)
+    EncodeValues(encoded, method, (const double *)view.buf, n);
+  else if (strcmp(format, "f") == 0)
+    EncodeValues(encoded, method, (const float *)view.buf, n);
+  else if (strcmp(format, "q") == 0)
+    EncodeValues(encoded, method, (const long long *)view.buf, n);
+  else if (strcmp(format, "l") == 0)
+    EncodeValues(encoded, method, (const long *)view.buf, n);
+  else if (strcmp(format, "i") == 0)
+    EncodeValues(encoded, method, (const int *)view.buf, n);
+  else if (strcmp(format, "h") == 0)
+    EncodeValues(encoded, method, (const short *)view.buf, n);
+  else if (strcmp(format, "B") == 0)
+    EncodeValues(encoded, method, (const unsigned char *)view.buf, n);
+  else {
+    PyBuffer_Release(&view);
+    PyErr_SetString(PyExc_TypeError, "Unsupported array type.");
+    return nullptr;
+  }
+
+  PyBuffer_Release(&view);
+
+  return PyString_FromString(encoded.asString()->c_str());
+}
+
 PyObject* xcsoar_encode(PyObject *self, PyObject *args, PyObject *kwargs) {
   PyObject *py_list,
            *py_method = nullptr;
@@ -42,6 +136,13 @@ PyObject* xcsoar_encode(PyObject *self, PyObject *args, PyObject *kwargs) {
     return nullptr;
   }
 
+  Method method;
+  if (!ParseMethod(py_method, method))
+    return nullptr;
+
+  if (PyObject_CheckBuffer(py_list))
+    return EncodeBuffer(py_list, method, delta, floor_to);
+
   if (!PySequence_Check(py_list)) {
     PyErr_SetString(PyExc_TypeError, "Expected a list.");
     return nullptr;
@@ -60,21 +161,6 @@ PyObject* xcsoar_encode(PyObject *self, PyObject *args, PyObject *kwargs) {
     dimension = 1;
   }
 
-  enum Method { UNSIGNED, SIGNED, DOUBLE } method;
-
-  if (py_method == nullptr)
-    method = UNSIGNED;
-  else if (PyString_Check(py_method) && strcmp(PyString_AsString(py_method), "unsigned") == 0)
-    method = UNSIGNED;
-  else if (PyString_Check(py_method) && strcmp(PyString_AsString(py_method), "signed") == 0)
-    method = SIGNED;
-  else if (PyString_Check(py_method) && strcmp(PyString_AsString(py_method), "double") == 0)
-    method = DOUBLE;
-  else {
-    PyErr_SetString(PyExc_TypeError, "Can't parse method.");
-    return nullptr;
-  }
-
   GoogleEncode encoded(dimension, delta, floor_to);
 
   for (Py_ssize_t i = 0; i < num_items; ++i) {
@@ -83,19 +169,19 @@ PyObject* xcsoar_encode(PyObject *self, PyObject *args, PyObject *kwargs) {
     if (dimension > 1) {
       for (unsigned j = 0; j < dimension; ++j) {
 
-        if (method == UNSIGNED) {
+        if (method == Method::UNSIGNED) {
           if (!PyNumber_Check(PySequence_Fast_GET_ITEM(py_item, j))) {
             PyErr_SetString(PyExc_TypeError, "Expected numeric value.");
             return nullptr;
           }
           encoded.addUnsignedNumber(PyInt_AsLong(PySequence_Fast_GET_ITEM(py_item, j)));
-        } else if (method == SIGNED) {
+        } else if (method == Method::SIGNED) {
           if (!PyNumber_Check(PySequence_Fast_GET_ITEM(py_item, j))) {
             PyErr_SetString(PyExc_TypeError, "Expected numeric value.");
             return nullptr;
           }
           encoded.addSignedNumber(PyInt_AsLong(PySequence_Fast_GET_ITEM(py_item, j)));
-        } else if (method == DOUBLE) {
+        } else if (method == Method::DOUBLE) {
           if (!PyNumber_Check(PySequence_Fast_GET_ITEM(py_item, j))) {
             PyErr_SetString(PyExc_TypeError, "Expected numeric value.");
             return nullptr;
@@ -106,19 +192,19 @@ PyObject* xcsoar_encode(PyObject *self, PyObject *args, PyObject *kwargs) {
       }
     } else {
 
-      if (method == UNSIGNED) {
+      if (method == Method::UNSIGNED) {
         if (!PyNumber_Check(py_item)) {
           PyErr_SetString(PyExc_TypeError, "Expected numeric value.");
           return nullptr;
         }
         encoded.addUnsignedNumber(PyInt_AsLong(py_item));
-      } else if (method == SIGNED) {
+      } else if (method == Method::SIGNED) {
         if (!PyNumber_Check(py_item)) {
           PyErr_SetString(PyExc_TypeError, "Expected numeric value.");
           return nullptr;
         }
         encoded.addSignedNumber(PyInt_AsLong(py_item));
-      } else if (method == DOUBLE) {
+      } else if (method == Method::DOUBLE) {
         if (!PyNumber_Check(py_item)) {
           PyErr_SetString(PyExc_TypeError, "Expected numeric value.");
           return nullptr;
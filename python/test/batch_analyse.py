@@ -0,0 +1,76 @@
+#!/usr/bin/env python
+#
+# Analyse a set of IGC files in parallel and print one line of JSON
+# per flight.  Each file is handled by one worker process from a
+# multiprocessing pool (or by one worker thread, with --threads; the
+# heavy xcsoar methods release the GIL); the lines are printed in
+# completion order.
+
+import xcsoar
+import argparse
+import fnmatch
+import json
+import multiprocessing
+import multiprocessing.pool
+import os
+import sys
+
+
+def collect_files(paths):
+  for path in paths:
+    if os.path.isdir(path):
+      for root, dirs, files in os.walk(path):
+        for name in sorted(files):
+          if fnmatch.fnmatch(name.lower(), '*.igc'):
+            yield os.path.join(root, name)
+    else:
+      yield path
+
+
+def analyse_file(file_name):
+  try:
+    flight = xcsoar.Flight(file_name, False)
+
+    flights = []
+    for dtime in flight.times():
+      takeoff = dtime['takeoff']
+      release = dtime['release']
+      landing = dtime['landing']
+
+      analysis = flight.analyse(takeoff=takeoff['time'],
+                                scoring_start=release['time'],
+                                scoring_end=landing['time'],
+                                landing=landing['time'])
+
+      flights.append({'times': dtime, 'analysis': analysis})
+
+    result = {'file': file_name, 'flights': flights}
+  except Exception as e:
+    result = {'file': file_name, 'error': str(e)}
+
+  return json.dumps(result, default=str)
+
+
+if __name__ == '__main__':
+  parser = argparse.ArgumentParser(
+      description='Analyse IGC files (or directories of IGC files) in parallel.')
+
+  parser.add_argument('paths', metavar='PATH', type=str, nargs='+')
+  parser.add_argument('--jobs', type=int, default=multiprocessing.cpu_count(),
+                      help='number of worker processes')
+  parser.add_argument('--threads', action='store_true',
+                      help='use worker threads instead of processes')
+
+  args = parser.parse_args()
+
+  if args.threads:
+    pool = multiprocessing.pool.ThreadPool(args.jobs)
+  else:
+    pool = multiprocessing.Pool(args.jobs)
+
+  for line in pool.imap_unordered(analyse_file, collect_files(args.paths)):
+    sys.stdout.write(line + '\n')
+    sys.stdout.flush()
+
+  pool.close()
+  pool.join()
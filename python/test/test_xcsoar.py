@@ -76,6 +76,11 @@ for dtime in times:
 
   pprint(flight.encode())
 
+  print "Flight columns from takeoff to landing:"
+  columns = flight.arrays(takeoff['time'], landing['time'])
+  for name, (dtype, data) in sorted(columns.items()):
+    print "{}: dtype {}, {} bytes".format(name, dtype, len(data))
+
 del flight
 
 
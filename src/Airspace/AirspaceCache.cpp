@@ -0,0 +1,224 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#include "AirspaceCache.hpp"
+#include "Engine/Airspace/Airspaces.hpp"
+#include "Engine/Airspace/AirspacePolygon.hpp"
+#include "Engine/Airspace/AirspaceCircle.hpp"
+#include "Util/StringAPI.hxx"
+
+#include <memory>
+#include <vector>
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+struct AirspaceCacheHeader {
+  static constexpr unsigned VERSION = 1;
+
+  static constexpr unsigned MAX_AIRSPACES = 1024 * 1024;
+
+  uint32_t version;
+  uint32_t n_airspaces;
+};
+
+struct AirspaceCacheItem {
+  static constexpr unsigned MAX_STRING = 4096;
+  static constexpr unsigned MAX_POINTS = 1024 * 1024;
+
+  AbstractAirspace::Shape shape;
+  AirspaceClass type;
+  AirspaceActivity days;
+
+  uint16_t name_length, radio_length;
+
+  /**
+   * The number of border points of a polygon; unused for circles.
+   */
+  uint32_t n_points;
+
+  AirspaceAltitude base, top;
+};
+
+static bool
+WriteString(FILE *file, const TCHAR *value, size_t length)
+{
+  return fwrite(value, sizeof(*value), length, file) == length;
+}
+
+static bool
+ReadString(FILE *file, tstring &value, size_t length)
+{
+  value.resize(length);
+  return length == 0 ||
+    fread(&value[0], sizeof(value[0]), length, file) == length;
+}
+
+static bool
+SaveAirspace(FILE *file, const AbstractAirspace &as)
+{
+  const TCHAR *name = as.GetName();
+  const tstring &radio = as.GetRadioText();
+
+  AirspaceCacheItem item;
+
+  /* zero-fill all implicit padding bytes (to make valgrind happy) */
+  memset((void *)&item, 0, sizeof(item));
+
+  item.shape = as.GetShape();
+  item.type = as.GetType();
+  item.days = as.GetDays();
+  item.name_length = StringLength(name);
+  item.radio_length = radio.length();
+  item.base = as.GetBase();
+  item.top = as.GetTop();
+
+  if (item.name_length != StringLength(name) ||
+      item.radio_length != radio.length())
+    return false;
+
+  if (item.shape == AbstractAirspace::Shape::POLYGON)
+    item.n_points = as.GetPoints().size();
+
+  if (fwrite(&item, sizeof(item), 1, file) != 1 ||
+      !WriteString(file, name, item.name_length) ||
+      !WriteString(file, radio.c_str(), item.radio_length))
+    return false;
+
+  if (item.shape == AbstractAirspace::Shape::CIRCLE) {
+    const AirspaceCircle &circle = (const AirspaceCircle &)as;
+    const GeoPoint center = circle.GetCenter();
+    const double radius = circle.GetRadius();
+    return fwrite(&center, sizeof(center), 1, file) == 1 &&
+      fwrite(&radius, sizeof(radius), 1, file) == 1;
+  } else {
+    for (const auto &p : as.GetPoints()) {
+      const GeoPoint location = p.GetLocation();
+      if (fwrite(&location, sizeof(location), 1, file) != 1)
+        return false;
+    }
+
+    return true;
+  }
+}
+
+bool
+SaveAirspaceCache(FILE *file, const Airspaces &airspaces, unsigned first)
+{
+  assert(first <= airspaces.GetPendingSize());
+
+  AirspaceCacheHeader header;
+  header.version = AirspaceCacheHeader::VERSION;
+  header.n_airspaces = airspaces.GetPendingSize() - first;
+  if (header.n_airspaces > AirspaceCacheHeader::MAX_AIRSPACES ||
+      fwrite(&header, sizeof(header), 1, file) != 1)
+    return false;
+
+  for (unsigned i = first, end = airspaces.GetPendingSize(); i < end; ++i)
+    if (!SaveAirspace(file, airspaces.GetPending(i)))
+      return false;
+
+  return true;
+}
+
+static AbstractAirspace *
+LoadAirspace(FILE *file, std::vector<GeoPoint> &points)
+{
+  AirspaceCacheItem item;
+  if (fread(&item, sizeof(item), 1, file) != 1 ||
+      item.type >= AIRSPACECLASSCOUNT ||
+      item.name_length > AirspaceCacheItem::MAX_STRING ||
+      item.radio_length > AirspaceCacheItem::MAX_STRING)
+    return nullptr;
+
+  tstring name, radio;
+  if (!ReadString(file, name, item.name_length) ||
+      !ReadString(file, radio, item.radio_length))
+    return nullptr;
+
+  AbstractAirspace *as;
+
+  switch (item.shape) {
+  case AbstractAirspace::Shape::CIRCLE: {
+    GeoPoint center;
+    double radius;
+    if (fread(&center, sizeof(center), 1, file) != 1 ||
+        fread(&radius, sizeof(radius), 1, file) != 1 ||
+        !center.IsValid() || !(radius > 0))
+      return nullptr;
+
+    as = new AirspaceCircle(center, radius);
+    break;
+  }
+
+  case AbstractAirspace::Shape::POLYGON:
+    if (item.n_points < 3 || item.n_points > AirspaceCacheItem::MAX_POINTS)
+      return nullptr;
+
+    points.resize(item.n_points);
+    if (fread(points.data(), sizeof(points.front()), points.size(),
+              file) != points.size())
+      return nullptr;
+
+    as = new AirspacePolygon(points);
+    break;
+
+  default:
+    return nullptr;
+  }
+
+  as->SetProperties(std::move(name), item.type, item.base, item.top);
+  as->SetRadio(radio);
+  as->SetDays(item.days);
+  return as;
+}
+
+bool
+LoadAirspaceCache(FILE *file, Airspaces &airspaces)
+{
+  AirspaceCacheHeader header;
+  if (fread(&header, sizeof(header), 1, file) != 1 ||
+      header.version != AirspaceCacheHeader::VERSION ||
+      header.n_airspaces > AirspaceCacheHeader::MAX_AIRSPACES)
+    return false;
+
+  /* load everything before adding anything, so a truncated file
+     does not leave a partial database behind */
+  std::vector<std::unique_ptr<AbstractAirspace>> loaded;
+  loaded.reserve(header.n_airspaces);
+
+  std::vector<GeoPoint> points;
+  for (unsigned i = 0; i < header.n_airspaces; ++i) {
+    AbstractAirspace *as = LoadAirspace(file, points);
+    if (as == nullptr)
+      return false;
+
+    loaded.emplace_back(as);
+  }
+
+  for (auto &as : loaded)
+    airspaces.Add(as.release());
+
+  return true;
+}
@@ -33,6 +33,8 @@ Copyright_License {
 #include "IO/ZipArchive.hpp"
 #include "IO/ZipLineReader.hpp"
 #include "IO/MapFile.hpp"
+#include "IO/FileCache.hpp"
+#include "AirspaceCache.hpp"
 #include "Profile/Profile.hpp"
 
 #include <string.h>
@@ -74,10 +76,73 @@ try {
   return false;
 }
 
+static bool
+LoadAirspaceCache(Airspaces &airspaces, FileCache &cache,
+                  const TCHAR *name, Path path)
+{
+  bool success = false;
+
+  FILE *file = cache.Load(name, path);
+  if (file != nullptr) {
+    success = LoadAirspaceCache(file, airspaces);
+    fclose(file);
+  }
+
+  return success;
+}
+
+static bool
+SaveAirspaceCache(const Airspaces &airspaces, unsigned first,
+                  FileCache &cache, const TCHAR *name, Path path)
+{
+  bool success = false;
+
+  FILE *file = cache.Save(name, path);
+  if (file != nullptr) {
+    success = SaveAirspaceCache(file, airspaces, first);
+    if (success)
+      cache.Commit(name, file);
+    else
+      cache.Cancel(name, file);
+  }
+
+  return success;
+}
+
+/**
+ * Load one airspace source, preferably from its binary cache.  After
+ * parsing the original file, the cache is rewritten.
+ *
+ * @param cache_name the name of this source's cache file
+ * @param path the file whose modification time and size validate
+ * the cache
+ * @param parse a function which parses the original file
+ */
+template<typename P>
+static bool
+LoadAirspaceSource(AirspaceParser &parser, Airspaces &airspaces,
+                   FileCache *cache, const TCHAR *cache_name, Path path,
+                   P &&parse)
+{
+  if (cache != nullptr && LoadAirspaceCache(airspaces, *cache,
+                                            cache_name, path))
+    return true;
+
+  const unsigned first = airspaces.GetPendingSize();
+  if (!parse(parser))
+    return false;
+
+  if (cache != nullptr)
+    SaveAirspaceCache(airspaces, first, *cache, cache_name, path);
+
+  return true;
+}
+
 void
 ReadAirspace(Airspaces &airspaces,
              RasterTerrain *terrain,
              const AtmosphericPressure &press,
+             FileCache *cache,
              OperationEnvironment &operation)
 {
   LogFormat("ReadAirspace");
@@ -90,16 +155,33 @@ ReadAirspace(Airspaces &airspaces,
   // Read the airspace filenames from the registry
   auto path = Profile::GetPath(ProfileKeys::AirspaceFile);
   if (!path.IsNull())
-    airspace_ok |= ParseAirspaceFile(parser, path, operation);
+    airspace_ok |= LoadAirspaceSource(parser, airspaces, cache,
+                                      _T("airspace"), path,
+                                      [&](AirspaceParser &p){
+                                        return ParseAirspaceFile(p, path,
+                                                                 operation);
+                                      });
 
   path = Profile::GetPath(ProfileKeys::AdditionalAirspaceFile);
   if (!path.IsNull())
-    airspace_ok |= ParseAirspaceFile(parser, path, operation);
-
-  auto archive = OpenMapFile();
-  if (archive)
-    airspace_ok |= ParseAirspaceFile(parser, archive->get(), "airspace.txt",
-                                     operation);
+    airspace_ok |= LoadAirspaceSource(parser, airspaces, cache,
+                                      _T("airspace_additional"), path,
+                                      [&](AirspaceParser &p){
+                                        return ParseAirspaceFile(p, path,
+                                                                 operation);
+                                      });
+
+  path = Profile::GetPath(ProfileKeys::MapFile);
+  if (!path.IsNull())
+    airspace_ok |= LoadAirspaceSource(parser, airspaces, cache,
+                                      _T("airspace_map"), path,
+                                      [&](AirspaceParser &p){
+                                        auto archive = OpenMapFile();
+                                        return archive &&
+                                          ParseAirspaceFile(p, archive->get(),
+                                                            "airspace.txt",
+                                                            operation);
+                                      });
 
   if (airspace_ok) {
     airspaces.Optimise();
@@ -26,6 +26,9 @@ Copyright_License {
 #include "Airspace/AbstractAirspace.hpp"
 #include "Airspace/AirspaceComputerSettings.hpp"
 #include "Renderer/AirspaceRendererSettings.hpp"
+#include "Engine/Navigation/Aircraft.hpp"
+
+#include <limits>
 
 bool
 IsAirspaceTypeVisible(const AbstractAirspace &airspace,
@@ -65,10 +68,64 @@ IsAirspaceAltitudeVisible(const AbstractAirspace &airspace,
   return true;
 }
 
+AirspaceVisibility::AirspaceVisibility(const AirspaceComputerSettings &computer_settings,
+                                       const AirspaceRendererSettings &renderer_settings,
+                                       const AltitudeState &_state)
+  :state(_state), visible_classes(0),
+   max_base(std::numeric_limits<double>::infinity()),
+   min_top(-std::numeric_limits<double>::infinity()),
+   terrain_base_below(false)
+{
+  static_assert(AIRSPACECLASSCOUNT <= 32, "Too many airspace classes");
+
+  for (unsigned i = 0; i < AIRSPACECLASSCOUNT; ++i)
+    if (renderer_settings.classes[i].display)
+      visible_classes |= uint32_t(1) << i;
+
+  const auto margin = computer_settings.warnings.altitude_warning_margin;
+
+  /* the same checks as IsAirspaceAltitudeVisible() */
+  switch (renderer_settings.altitude_mode) {
+  case AirspaceDisplayMode::ALLON:
+    break;
+
+  case AirspaceDisplayMode::CLIP:
+    max_base = renderer_settings.clip_altitude;
+    break;
+
+  case AirspaceDisplayMode::AUTO:
+    max_base = state.altitude + margin;
+    min_top = state.altitude - margin;
+    terrain_base_below = true;
+    break;
+
+  case AirspaceDisplayMode::ALLBELOW:
+    max_base = state.altitude + margin;
+    terrain_base_below = true;
+    break;
+
+  case AirspaceDisplayMode::INSIDE:
+    max_base = min_top = state.altitude;
+    terrain_base_below = true;
+    break;
+
+  case AirspaceDisplayMode::ALLOFF:
+    visible_classes = 0;
+    break;
+  }
+}
+
 bool
 AirspaceVisibility::operator()(const AbstractAirspace &airspace) const
 {
-  return IsAirspaceTypeVisible(airspace, renderer_settings) &&
-    IsAirspaceAltitudeVisible(airspace, state,
-                              computer_settings, renderer_settings);
+  if ((visible_classes & (uint32_t(1) << airspace.GetType())) == 0)
+    return false;
+
+  const AirspaceAltitude &base = airspace.GetBase();
+  if (!(base.GetAltitude(state) <= max_base ||
+        (terrain_base_below && base.IsTerrain())))
+    return false;
+
+  return min_top == -std::numeric_limits<double>::infinity() ||
+    airspace.GetTop().GetAltitude(state) >= min_top;
 }
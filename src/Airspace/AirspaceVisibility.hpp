@@ -3,6 +3,8 @@
 
 #include "Airspace/Predicate/AirspacePredicate.hpp"
 
+#include <stdint.h>
+
 struct AirspaceComputerSettings;
 struct AirspaceRendererSettings;
 struct AltitudeState;
@@ -26,19 +28,42 @@ IsAirspaceAltitudeVisible(const AbstractAirspace &airspace,
                           const AirspaceComputerSettings &computer_settings,
                           const AirspaceRendererSettings &renderer_settings);
 
+/**
+ * Combines IsAirspaceTypeVisible() and IsAirspaceAltitudeVisible().
+ * The settings are evaluated once by the constructor: the class
+ * filter becomes a bit mask and the altitude display mode becomes a
+ * pair of altitude limits, so each airspace is checked with one bit
+ * test and two comparisons.
+ */
 class AirspaceVisibility {
-  const AirspaceComputerSettings &computer_settings;
-  const AirspaceRendererSettings &renderer_settings;
   const AltitudeState &state;
 
+  /**
+   * A bit mask of airspace classes which are visible (indexed by
+   * #AirspaceClass).
+   */
+  uint32_t visible_classes;
+
+  /**
+   * The airspace base must not be higher than this altitude [m MSL].
+   */
+  double max_base;
+
+  /**
+   * The airspace top must not be lower than this altitude [m MSL].
+   */
+  double min_top;
+
+  /**
+   * Does a base at terrain level always pass the #max_base check?
+   * See AirspaceAltitude::IsBelow().
+   */
+  bool terrain_base_below;
+
 public:
-  constexpr
-  AirspaceVisibility(const AirspaceComputerSettings &_computer_settings,
-                     const AirspaceRendererSettings &_renderer_settings,
-                     const AltitudeState& _state)
-    :computer_settings(_computer_settings),
-     renderer_settings(_renderer_settings),
-     state(_state) {}
+  AirspaceVisibility(const AirspaceComputerSettings &computer_settings,
+                     const AirspaceRendererSettings &renderer_settings,
+                     const AltitudeState &_state);
 
   gcc_pure
   bool operator()(const AbstractAirspace &airspace) const;
@@ -314,7 +314,7 @@ Java_org_xcsoar_NonGPSSensors_setMagneticField(
 
 /**
  * Helper function for
- * Java_org_xcsoar_NonGPSSensors_setBarometricPressure: Given a
+ * Java_org_xcsoar_NonGPSSensors_setBarometricPressures: Given a
  * current measurement of the atmospheric pressure and the rate of
  * change of atmospheric pressure (in millibars and millibars per
  * second), compute the uncompensated vertical speed of the glider in
@@ -338,8 +338,9 @@ ComputeNoncompVario(const double pressure, const double d_pressure)
 
 gcc_visibility_default
 JNIEXPORT void JNICALL
-Java_org_xcsoar_NonGPSSensors_setBarometricPressure(
-    JNIEnv* env, jobject obj, jfloat pressure, jfloat sensor_noise_variance) {
+Java_org_xcsoar_NonGPSSensors_setBarometricPressures(
+    JNIEnv* env, jobject obj, jfloatArray _pressures, jlongArray _timestamps,
+    jint n, jfloat sensor_noise_variance) {
   /* We use a Kalman filter to smooth Android device pressure sensor
      noise.  The filter requires two parameters: the first is the
      variance of the distribution of second derivatives of pressure
@@ -357,13 +358,31 @@ Java_org_xcsoar_NonGPSSensors_setBarometricPressure(
   // XXX this shouldn't be a global variable
   static SelfTimingKalmanFilter1d kalman_filter(KF_MAX_DT, KF_VAR_ACCEL);
 
+  if (n <= 0)
+    return;
+
+  /* the Java code passes a batch of samples from the sensor's FIFO;
+     copy them out before locking the blackboard */
+  static constexpr jint MAX_BATCH = 64;
+  if (n > MAX_BATCH)
+    n = MAX_BATCH;
+
+  jfloat pressures[MAX_BATCH];
+  jlong timestamps_ns[MAX_BATCH];
+  env->GetFloatArrayRegion(_pressures, 0, n, pressures);
+  env->GetLongArrayRegion(_timestamps, 0, n, timestamps_ns);
+
   const unsigned int index = getDeviceIndex(env, obj);
   ScopeLock protect(device_blackboard->mutex);
 
   /* Kalman filter updates are also protected by the blackboard
      mutex. These should not take long; we won't hog the mutex
-     unduly. */
-  kalman_filter.Update(pressure, sensor_noise_variance);
+     unduly.  The sensor time stamps are used, because the samples
+     of one batch were measured over a period of time, but arrive at
+     once. */
+  for (jint i = 0; i < n; ++i)
+    kalman_filter.Update(pressures[i], sensor_noise_variance,
+                         uint64_t(timestamps_ns[i]) / 1000);
 
   NMEAInfo &basic = device_blackboard->SetRealState(index);
   basic.ProvideNoncompVario(ComputeNoncompVario(kalman_filter.GetXAbs(),
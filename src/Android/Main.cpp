@@ -307,6 +307,17 @@ Java_org_xcsoar_NativeView_resumeNative(JNIEnv *env, jobject obj)
   CommonInterface::main_window->Resume();
 }
 
+gcc_visibility_default
+JNIEXPORT void JNICALL
+Java_org_xcsoar_NativeView_lowMemoryNative(JNIEnv *env, jobject obj)
+{
+  if (event_queue == nullptr || CommonInterface::main_window == nullptr)
+    /* nothing has been cached yet */
+    return;
+
+  CommonInterface::main_window->LowMemory();
+}
+
 gcc_visibility_default
 JNIEXPORT void JNICALL
 Java_org_xcsoar_NativeView_setHapticFeedback(JNIEnv *env, jobject obj,
@@ -28,11 +28,14 @@ Copyright_License {
 #include "SLES/Init.hpp"
 #include "SLES/Engine.hpp"
 
+#include "Thread/Policy.hpp"
 #include "Util/Macros.hpp"
 #include "LogFile.hpp"
 
 #include <SLES/OpenSLES_Android.h>
 
+#include <algorithm>
+
 AndroidPCMPlayer::~AndroidPCMPlayer()
 {
   Stop();
@@ -172,13 +175,20 @@ AndroidPCMPlayer::Start(PCMSynthesiser &_source)
   }
 
   queue = SLES::AndroidSimpleBufferQueue(_queue);
+  policy_applied = false;
   result = queue.RegisterCallback([](SLAndroidSimpleBufferQueueItf caller,
                                      void *pContext) {
       /**
        * OpenSL/ES callback which gets invoked when a buffer has been
        * consumed.  It synthesises and enqueues the next buffer.
        */
-      reinterpret_cast<AndroidPCMPlayer *>(pContext)->Enqueue();
+      auto &player = *reinterpret_cast<AndroidPCMPlayer *>(pContext);
+      if (!player.policy_applied) {
+        player.policy_applied = true;
+        ApplyThreadPolicy(ThreadRole::AUDIO);
+      }
+
+      player.Enqueue();
   }, this);
   if (result != SL_RESULT_SUCCESS) {
     LogFormat("PCMPlayer: Play.RegisterCallback() result=%#x", (int)result);
@@ -201,6 +211,12 @@ AndroidPCMPlayer::Start(PCMSynthesiser &_source)
     return false;
   }
 
+  n_frames = MAX_FRAMES;
+  if (period_ms > 0)
+    n_frames = std::min(n_frames,
+                        std::max(_source.GetSampleRate() * period_ms / 1000,
+                                 1u));
+
   next = 0;
   filled = false;
   for (unsigned i = 0; i < ARRAY_SIZE(buffers) - 1; ++i)
@@ -232,10 +248,11 @@ AndroidPCMPlayer::Enqueue()
 
   if (!filled) {
     filled = true;
-    source->Synthesise(buffers[next], ARRAY_SIZE(buffers[next]));
+    source->Synthesise(buffers[next], n_frames);
   }
 
-  SLresult result = queue.Enqueue(buffers[next], sizeof(buffers[next]));
+  SLresult result = queue.Enqueue(buffers[next],
+                                  n_frames * sizeof(buffers[next][0]));
   if (result == SL_RESULT_SUCCESS) {
     next = (next + 1) % ARRAY_SIZE(buffers);
     filled = false;
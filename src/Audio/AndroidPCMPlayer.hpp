@@ -64,17 +64,45 @@ class AndroidPCMPlayer : public PCMPlayer {
    */
   bool filled;
 
+  /**
+   * Has the #ThreadRole::AUDIO policy already been applied to the
+   * OpenSL/ES callback thread?  Only accessed from that thread
+   * (and by Start() before the callback is registered).
+   */
+  bool policy_applied;
+
+  /**
+   * The requested duration of each buffer [ms], or 0 for
+   * #MAX_FRAMES.  Two buffers are queued, so this determines the
+   * output latency.
+   */
+  const unsigned period_ms;
+
+  /**
+   * The number of samples in each buffer, at most #MAX_FRAMES.
+   * Calculated by Start() from #period_ms.
+   */
+  unsigned n_frames;
+
+  static constexpr unsigned MAX_FRAMES = 4096;
+
   /**
    * An array of buffers.  It's one more than being managed by
    * OpenSL/ES, and the one not enqueued (see attribute #next) will be
    * written to.
    */
-  int16_t buffers[3][4096];
+  int16_t buffers[3][MAX_FRAMES];
 
   void Enqueue();
 
 public:
-  AndroidPCMPlayer() = default;
+  /**
+   * @param _period_ms the duration of each buffer [ms]; 0 means the
+   * largest possible buffer, which is the safest choice against
+   * underruns
+   */
+  explicit AndroidPCMPlayer(unsigned _period_ms=0)
+    :policy_applied(false), period_ms(_period_ms), n_frames(0) {}
   virtual ~AndroidPCMPlayer();
 
   /* virtual methods from class PCMPlayer */
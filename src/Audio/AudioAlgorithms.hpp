@@ -28,12 +28,19 @@ Copyright_License {
 #include "OS/ByteOrder.hpp"
 
 #include <algorithm>
+#include <limits>
 #include <type_traits>
 
 #include <assert.h>
 #include <stddef.h>
 #include <stdint.h>
 
+#ifdef __ARM_NEON__
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 /* Algorithms for processing audio data */
 
 /**
@@ -68,6 +75,42 @@ inline int16_t Clip(int32_t value) {
           static_cast<int32_t>(std::numeric_limits<int16_t>::max())));
 }
 
+/**
+ * Convert a volume percentage below 100 to a Q15 fixed-point factor
+ * for ScaleVolume().
+ */
+constexpr int16_t VolumeToQ15(unsigned vol_percent) {
+  return static_cast<int16_t>(vol_percent * 32768 / 100);
+}
+
+/**
+ * Multiply a sample with a Q15 factor (rounding towards negative
+ * infinity).  This is the scalar equivalent of the SIMD code paths
+ * below, which yield bit-identical results.
+ */
+constexpr int16_t ScaleVolume(int16_t sample, int16_t factor) {
+  return static_cast<int16_t>((static_cast<int32_t>(sample) * factor) >> 15);
+}
+
+#ifdef __ARM_NEON__
+
+static inline int16x8_t ScaleVolume(int16x8_t samples, int16_t factor) {
+  /* (2 * a * b) >> 16 */
+  return vqdmulhq_n_s16(samples, factor);
+}
+
+#elif defined(__SSE2__)
+
+static inline __m128i ScaleVolume(__m128i samples, __m128i factor) {
+  /* SSE2 has no Q15 multiplication; assemble bits 15..30 of the
+     32 bit product from its high and low halves */
+  const __m128i hi = _mm_mulhi_epi16(samples, factor);
+  const __m128i lo = _mm_mullo_epi16(samples, factor);
+  return _mm_or_si128(_mm_slli_epi16(hi, 1), _mm_srli_epi16(lo, 15));
+}
+
+#endif
+
 /**
  * Mix PCM data from a data source (which is read using the provided source
  * reader function) to a destination buffer (which already contains PCM data).
@@ -85,7 +128,8 @@ inline void MixPCM(int16_t *dest, size_t num_frames,
   }
 
   for (size_t i = 0; i < num_frames; ++i) {
-    dest[i] += Clip(src_reader(i) * static_cast<int32_t>(vol_percent) / 100);
+    dest[i] = Clip(dest[i] +
+                   src_reader(i) * static_cast<int32_t>(vol_percent) / 100);
   }
 }
 
@@ -93,11 +137,56 @@ inline void MixPCM(int16_t *dest, size_t num_frames,
  * Mix PCM data from a given data source to a destination buffer
  * (which already contains PCM data).
  *
+ * This is the mixer's inner loop; it processes 8 samples at a time
+ * with NEON or SSE2 if available, using saturating arithmetic.
+ *
  * Performs cipping, if necessary.
  */
-inline void MixPCM(int16_t *dest, const int16_t *src, size_t num_frames,
+inline void MixPCM(int16_t *gcc_restrict dest,
+                   const int16_t *gcc_restrict src, size_t num_frames,
                    unsigned vol_percent) {
-  MixPCM(dest, num_frames, vol_percent, [&src](size_t i) { return src[i]; });
+  if (0 == vol_percent) {
+    std::fill(dest, dest + num_frames, 0);
+    return;
+  }
+
+  if (vol_percent >= 100) {
+    size_t i = 0;
+#ifdef __ARM_NEON__
+    for (; i + 8 <= num_frames; i += 8)
+      vst1q_s16(dest + i, vqaddq_s16(vld1q_s16(dest + i),
+                                     vld1q_s16(src + i)));
+#elif defined(__SSE2__)
+    for (; i + 8 <= num_frames; i += 8) {
+      const __m128i d = _mm_loadu_si128((const __m128i *)(dest + i));
+      const __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+      _mm_storeu_si128((__m128i *)(dest + i), _mm_adds_epi16(d, s));
+    }
+#endif
+    for (; i < num_frames; ++i)
+      dest[i] = Clip(dest[i] + src[i]);
+    return;
+  }
+
+  const int16_t factor = VolumeToQ15(vol_percent);
+
+  size_t i = 0;
+#ifdef __ARM_NEON__
+  for (; i + 8 <= num_frames; i += 8)
+    vst1q_s16(dest + i,
+              vqaddq_s16(vld1q_s16(dest + i),
+                         ScaleVolume(vld1q_s16(src + i), factor)));
+#elif defined(__SSE2__)
+  const __m128i factor_v = _mm_set1_epi16(factor);
+  for (; i + 8 <= num_frames; i += 8) {
+    const __m128i d = _mm_loadu_si128((const __m128i *)(dest + i));
+    const __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+    _mm_storeu_si128((__m128i *)(dest + i),
+                     _mm_adds_epi16(d, ScaleVolume(s, factor_v)));
+  }
+#endif
+  for (; i < num_frames; ++i)
+    dest[i] = Clip(dest[i] + ScaleVolume(src[i], factor));
 }
 
 /**
@@ -128,11 +217,24 @@ inline void LowerVolume(int16_t *buffer, size_t num_frames,
     return;
   }
 
-  for (size_t i = 0; i < num_frames; ++i) {
-    buffer[i] =
-        static_cast<int16_t>(
-            (static_cast<int32_t>(vol_percent) * buffer[i]) / 100);
+  if (vol_percent >= 100)
+    return;
+
+  const int16_t factor = VolumeToQ15(vol_percent);
+
+  size_t i = 0;
+#ifdef __ARM_NEON__
+  for (; i + 8 <= num_frames; i += 8)
+    vst1q_s16(buffer + i, ScaleVolume(vld1q_s16(buffer + i), factor));
+#elif defined(__SSE2__)
+  const __m128i factor_v = _mm_set1_epi16(factor);
+  for (; i + 8 <= num_frames; i += 8) {
+    const __m128i b = _mm_loadu_si128((const __m128i *)(buffer + i));
+    _mm_storeu_si128((__m128i *)(buffer + i), ScaleVolume(b, factor_v));
   }
+#endif
+  for (; i < num_frames; ++i)
+    buffer[i] = ScaleVolume(buffer[i], factor);
 }
 
 /**
@@ -24,6 +24,8 @@ Copyright_License {
 #ifndef XCSOAR_AUDIO_PCM_PLAYER_FACTORY_HPP
 #define XCSOAR_AUDIO_PCM_PLAYER_FACTORY_HPP
 
+#include "Compiler.h"
+
 #ifdef ANDROID
 #include "AndroidPCMPlayer.hpp"
 #elif defined(ENABLE_ALSA)
@@ -43,12 +45,16 @@ namespace PCMPlayerFactory
 
 /**
  * Create an instance of a PCMPlayer implementation for the current platform
+ * @param period_ms the desired buffer duration [ms] for players which
+ * manage their own buffers; 0 selects the platform default.  The
+ * mixer-based players share the global mixer's buffer, which is
+ * configured via #ALSAEnv.
  * @return Pointer to the created PCMPlayer instance
  */
-inline PCMPlayer *CreateInstance()
+inline PCMPlayer *CreateInstance(gcc_unused unsigned period_ms=0)
 {
 #ifdef ANDROID
-  return new AndroidPCMPlayer();
+  return new AndroidPCMPlayer(period_ms);
 #elif defined(ENABLE_SDL) || defined(ENABLE_ALSA)
   return new MixerPCMPlayer();
 #else
@@ -24,6 +24,7 @@ Copyright_License {
 #include "SDLPCMPlayer.hpp"
 
 #include "PCMDataSource.hpp"
+#include "Thread/Policy.hpp"
 
 #include <assert.h>
 
@@ -65,6 +66,8 @@ SDLPCMPlayer::Start(PCMDataSource &_source)
   };
   wanted.userdata = this;
 
+  policy_applied = false;
+
   device = SDL_OpenAudioDevice(nullptr, 0, &wanted, &actual,
                                SDL_AUDIO_ALLOW_CHANNELS_CHANGE);
   if (device < 1)
@@ -91,6 +94,11 @@ SDLPCMPlayer::Stop()
 inline void
 SDLPCMPlayer::AudioCallback(int16_t *stream, size_t len_bytes)
 {
+  if (!policy_applied) {
+    policy_applied = true;
+    ApplyThreadPolicy(ThreadRole::AUDIO);
+  }
+
   const size_t num_frames = len_bytes / (channels * sizeof(stream[0]));
   const size_t read_frames = FillPCMBuffer(stream, num_frames);
   if (0 == read_frames)
@@ -34,6 +34,13 @@ Copyright_License {
 class SDLPCMPlayer : public PCMPlayer {
   SDL_AudioDeviceID device = -1;
 
+  /**
+   * Has the #ThreadRole::AUDIO policy already been applied to the
+   * SDL audio thread?  Only accessed from that thread (and by
+   * Start() before the device is opened).
+   */
+  bool policy_applied = false;
+
   inline void AudioCallback(int16_t *stream, size_t len);
 
 public:
@@ -25,33 +25,46 @@ Copyright_License {
 #include "Math/FastTrig.hpp"
 #include "Util/Macros.hpp"
 
-#include <assert.h>
+/**
+ * Shift a #ToneSynthesiser phase value right by this many bits to
+ * obtain the #ISINETABLE index.
+ */
+static constexpr unsigned PHASE_SHIFT = 32 - 12;
+
+static_assert(ARRAY_SIZE(ISINETABLE) == 1u << (32 - PHASE_SHIFT),
+              "PHASE_SHIFT does not match ISINETABLE");
 
 void
 ToneSynthesiser::SetTone(unsigned tone_hz)
 {
-  increment = ARRAY_SIZE(ISINETABLE) * tone_hz / sample_rate;
+  increment = uint32_t((uint64_t(tone_hz) << 32) / sample_rate);
 }
 
 void
 ToneSynthesiser::Synthesise(int16_t *buffer, size_t n)
 {
-  assert(angle < ARRAY_SIZE(ISINETABLE));
+  /* the volume is folded into one 16.16 fixed-point factor, so the
+     loop needs no division; at 100% this is exactly the old
+     "* (32767 / 1024)" scaling of the +/-1024 table values */
+  const int32_t gain = (32767 / 1024) * int32_t(volume) * 65536 / 100;
+
+  uint32_t p = phase;
+  const uint32_t inc = increment;
 
   for (int16_t *end = buffer + n; buffer != end; ++buffer) {
-    *buffer = ISINETABLE[angle] * (32767 / 1024) * (int)volume / 100;
-    angle = (angle + increment) & (ARRAY_SIZE(ISINETABLE) - 1);
+    *buffer = int16_t((ISINETABLE[p >> PHASE_SHIFT] * gain) >> 16);
+    p += inc;
   }
+
+  phase = p;
 }
 
 unsigned
 ToneSynthesiser::ToZero() const
 {
-  assert(angle < ARRAY_SIZE(ISINETABLE));
-
-  if (angle < increment)
+  if (phase < increment)
     /* close enough */
     return 0;
 
-  return (ARRAY_SIZE(ISINETABLE) - angle) / increment;
+  return (0u - phase) / increment;
 }
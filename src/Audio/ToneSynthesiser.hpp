@@ -27,11 +27,21 @@ Copyright_License {
 #include "PCMSynthesiser.hpp"
 #include "Compiler.h"
 
+#include <stdint.h>
+
 /**
  * This class generates tones with a sine wave.
  */
 class ToneSynthesiser : public PCMSynthesiser {
-  unsigned volume = 100, angle = 0, increment = 0;
+  unsigned volume = 100;
+
+  /**
+   * A 32 bit phase accumulator; one full sine wave is 2^32.  The
+   * upper bits are the index into #ISINETABLE.  Unlike an increment
+   * in table units, this does not round the frequency to a multiple
+   * of sample_rate/INT_ANGLE_RANGE (~11 Hz at 44.1 kHz).
+   */
+  uint32_t phase = 0, increment = 0;
 
 public:
   explicit ToneSynthesiser(unsigned _sample_rate) : sample_rate(_sample_rate) {
@@ -70,7 +80,7 @@ protected:
    * Start a new period.
    */
   void Restart() {
-    angle = 0;
+    phase = 0;
   }
 };
 
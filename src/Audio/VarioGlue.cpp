@@ -35,6 +35,13 @@ Copyright_License {
 
 static constexpr unsigned sample_rate = 44100;
 
+/**
+ * The audio buffer duration.  The vario tone must follow the vario
+ * value closely, so this is much smaller than the default, which
+ * would add nearly 200 ms of latency on Android.
+ */
+static constexpr unsigned period_ms = 10;
+
 #ifdef ANDROID
 static bool have_sles;
 #endif
@@ -64,7 +71,7 @@ AudioVarioGlue::Initialise()
     return;
 #endif
 
-  player = PCMPlayerFactory::CreateInstance();
+  player = PCMPlayerFactory::CreateInstance(period_ms);
   synthesiser = new VarioSynthesiser(sample_rate);
 }
 
@@ -27,6 +27,8 @@ Copyright_License {
 
 #include <algorithm>
 
+#include <assert.h>
+
 /**
  * The minimum and maximum vario range for the constants below [cm/s].
  */
@@ -44,13 +46,16 @@ VarioSynthesiser::VarioToFrequency(int ivario)
 void
 VarioSynthesiser::SetVario(double vario)
 {
-  const ScopeLock protect(mutex);
-
-  const int ivario = Clamp((int)(vario * 100), min_vario, max_vario);
+  pending_vario.store(Clamp((int)(vario * 100), min_vario, max_vario),
+                      std::memory_order_relaxed);
+}
 
-  if (dead_band_enabled && InDeadBand(ivario)) {
-    /* inside the "dead band" */
-    UnsafeSetSilence();
+void
+VarioSynthesiser::ApplyVario(int ivario)
+{
+  if (ivario == SILENCE || (dead_band_enabled && InDeadBand(ivario))) {
+    /* silence requested, or inside the "dead band" */
+    ApplySilence();
     return;
   }
 
@@ -87,12 +92,11 @@ VarioSynthesiser::SetVario(double vario)
 void
 VarioSynthesiser::SetSilence()
 {
-  const ScopeLock protect(mutex);
-  UnsafeSetSilence();
+  pending_vario.store(SILENCE, std::memory_order_relaxed);
 }
 
 void
-VarioSynthesiser::UnsafeSetSilence()
+VarioSynthesiser::ApplySilence()
 {
   audible_count = 0;
   silence_count = 1;
@@ -110,7 +114,11 @@ VarioSynthesiser::UnsafeSetSilence()
 void
 VarioSynthesiser::Synthesise(int16_t *buffer, size_t n)
 {
-  const ScopeLock protect(mutex);
+  const int ivario = pending_vario.load(std::memory_order_relaxed);
+  if (ivario != current_vario) {
+    current_vario = ivario;
+    ApplyVario(ivario);
+  }
 
   assert(audible_count > 0 || silence_count > 0);
 
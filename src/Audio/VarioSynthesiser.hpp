@@ -25,18 +25,36 @@ Copyright_License {
 #define XCSOAR_AUDIO_VARIO_SYNTHESISER_HPP
 
 #include "ToneSynthesiser.hpp"
-#include "Thread/Mutex.hpp"
 #include "Compiler.h"
 
+#include <atomic>
+
+#include <limits.h>
+
 /**
  * This class generates vario sound.
  */
 class VarioSynthesiser final : public ToneSynthesiser {
   /**
-   * This mutex protects all atttributes below.  It is locked
-   * automatically by all public methods.
+   * Magic value for #pending_vario and #current_vario: produce
+   * silence.
+   */
+  static constexpr int SILENCE = INT_MIN;
+
+  /**
+   * The most recent vario value [cm/s] submitted by SetVario(), or
+   * #SILENCE.  This single-value slot is written by the device
+   * threads and consumed by Synthesise() at the start of each audio
+   * callback, without a lock, so neither side ever waits for the
+   * other and the next buffer always uses the latest value.
    */
-  Mutex mutex;
+  std::atomic<int> pending_vario;
+
+  /**
+   * The #pending_vario value which the attributes below were
+   * calculated for.  Only accessed by Synthesise().
+   */
+  int current_vario;
 
   /**
    * The number of audible samples in each period.
@@ -92,6 +110,7 @@ class VarioSynthesiser final : public ToneSynthesiser {
 public:
   explicit VarioSynthesiser(unsigned sample_rate)
     :ToneSynthesiser(sample_rate),
+     pending_vario(SILENCE), current_vario(SILENCE),
      audible_count(0), silence_count(1),
      audible_remaining(0), silence_remaining(0),
      dead_band_enabled(false),
@@ -100,8 +119,10 @@ public:
      min_dead(-30), max_dead(10) {}
 
   /**
-   * Update the vario value.  This calculates a new tone frequency and
-   * a new "silence" rate (for positive vario values).
+   * Update the vario value.  The audio callback will calculate a new
+   * tone frequency and a new "silence" rate (for positive vario
+   * values) from it.  This method is lock-free and may be called
+   * from any thread.
    *
    * @param vario the current vario value [m/s]
    */
@@ -149,9 +170,12 @@ public:
 
 private:
   /**
-   * Same as SetSilence(), but doesn't lock the mutex.
+   * Recalculate the tone parameters for a new #pending_vario value.
+   * Called by Synthesise() in the audio thread.
    */
-  void UnsafeSetSilence();
+  void ApplyVario(int ivario);
+
+  void ApplySilence();
 
   /**
    * Convert a vario value to a tone frequency.
@@ -29,6 +29,7 @@ BallastDumpManager::Start()
 {
   assert(!IsEnabled());
   enabled = true;
+  pending = 0;
 
   // Update ballast_clock for the next call to BallastDumpManager::Update()
   ballast_clock.Update();
@@ -70,8 +71,10 @@ BallastDumpManager::Update(GlidePolar &glide_polar, unsigned dump_time)
   // How many percent of the max. ballast do we dump in one millisecond
   auto percent_per_millisecond = 1. / (1000 * dump_time);
 
+  pending += dt * percent_per_millisecond;
+
   // Calculate the new ballast percentage
-  auto ballast = glide_polar.GetBallast() - dt * percent_per_millisecond;
+  auto ballast = glide_polar.GetBallast() - pending;
 
   // Check if the plane is dry now
   if (ballast < 0) {
@@ -80,7 +83,11 @@ BallastDumpManager::Update(GlidePolar &glide_polar, unsigned dump_time)
     return false;
   }
 
+  if (pending < MIN_STEP)
+    return true;
+
   // Set new ballast
   glide_polar.SetBallast(ballast);
+  pending = 0;
   return true;
 }
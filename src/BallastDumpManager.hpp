@@ -30,11 +30,25 @@ class GlidePolar;
 
 class BallastDumpManager
 {
+  /**
+   * The ballast (ratio of the maximum ballast) is only applied to the
+   * #GlidePolar in steps of this size.  Every change recalculates the
+   * polar and invalidates the task and route solutions, and smaller
+   * steps make no practical difference.
+   */
+  static constexpr double MIN_STEP = 0.01;
+
   bool enabled;
   PeriodClock ballast_clock;
 
+  /**
+   * The ballast ratio which has been dumped since the last change to
+   * the #GlidePolar.
+   */
+  double pending;
+
 public:
-  constexpr BallastDumpManager():enabled(false) {}
+  constexpr BallastDumpManager():enabled(false), pending(0) {}
 
   bool IsEnabled() const {
     return enabled;
@@ -46,7 +60,8 @@ public:
   void SetEnabled(bool _enabled);
 
   /**
-   * Updates the ballast of the given GlidePolar.
+   * Updates the ballast of the given GlidePolar.  The GlidePolar is
+   * only modified after at least #MIN_STEP has been dumped.
    * This function must not be called if the BallastDumpManager is not enabled!
    * @param glide_polar The GlidePolar to update
    * @param dump_time Time that it takes to dump the entire ballast
@@ -66,3 +66,13 @@ BatteryTimer::Process()
   }
 #endif /* HAVE_BATTERY */
 }
+
+bool
+BatteryTimer::IsPowerSaving()
+{
+#if defined(KOBO) && defined(HAVE_BATTERY)
+  return Power::External::Status == Power::External::OFF;
+#else
+  return false;
+#endif
+}
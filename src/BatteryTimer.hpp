@@ -25,6 +25,7 @@ Copyright_License {
 #define XCSOAR_BATTERY_TIMER_HPP
 
 #include "Time/PeriodClock.hpp"
+#include "Compiler.h"
 
 class BatteryTimer {
   // Battery status for SIMULATOR mode
@@ -38,6 +39,13 @@ class BatteryTimer {
 
 public:
   void Process();
+
+  /**
+   * Shall the application save power?  This is the case on Kobo
+   * while there is no external power supply.
+   */
+  gcc_pure
+  static bool IsPowerSaving();
 };
 
 #endif
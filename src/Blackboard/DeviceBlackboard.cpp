@@ -33,7 +33,8 @@ Copyright_License {
  * Initializes the DeviceBlackboard
  */
 DeviceBlackboard::DeviceBlackboard()
-  :devices(nullptr)
+  :devices(nullptr), vario_handler(nullptr),
+   merge_wait_us(0), calculation_wait_us(0)
 {
   // Clear the gps_info and calculated_info
   gps_info.Reset();
@@ -52,6 +53,9 @@ DeviceBlackboard::DeviceBlackboard()
 
   real_clock.Reset();
   replay_clock.Reset();
+
+  basic_snapshot.Publish(gps_info);
+  calculated_snapshot.Publish(calculated_info);
 }
 
 /**
@@ -182,6 +186,7 @@ void
 DeviceBlackboard::ReadBlackboard(const DerivedInfo &derived_info)
 {
   calculated_info = derived_info;
+  calculated_snapshot.Publish(calculated_info);
 }
 
 /**
@@ -224,6 +229,26 @@ DeviceBlackboard::ScheduleMerge()
   TriggerMergeThread();
 }
 
+void
+DeviceBlackboard::OnTotalEnergyVario(unsigned i)
+{
+  assert(i < NUMDEV);
+
+  if (vario_handler == nullptr ||
+      /* the physical devices are not being used */
+      replay_data.alive || simulator_data.alive)
+    return;
+
+  /* Merge() uses the first device which has a value, see
+     NMEAInfo::Complement() */
+  for (unsigned j = 0; j < i; ++j)
+    if (per_device_data[j].alive &&
+        per_device_data[j].total_energy_vario_available)
+      return;
+
+  vario_handler(per_device_data[i].total_energy_vario);
+}
+
 void
 DeviceBlackboard::Merge()
 {
@@ -243,7 +268,7 @@ DeviceBlackboard::Merge()
 
   if (replay_data.alive) {
     replay_data.Expire();
-    basic = replay_data;
+    basic.CopyFrom(replay_data);
 
     /* WrapClock operates on the replay_data copy to avoid feeding
        back BrokenDate modifications to the NMEA parser, as this would
@@ -252,9 +277,9 @@ DeviceBlackboard::Merge()
   } else if (simulator_data.alive) {
     simulator_data.UpdateClock();
     simulator_data.Expire();
-    basic = simulator_data;
+    basic.CopyFrom(simulator_data);
   } else {
-    basic = real_data;
+    basic.CopyFrom(real_data);
   }
 }
 
@@ -29,8 +29,10 @@ Copyright_License {
 #include "Device/Simulator.hpp"
 #include "Device/Features.hpp"
 #include "Thread/Mutex.hpp"
+#include "Thread/SnapshotBuffer.hpp"
 #include "Time/WrapClock.hpp"
 
+#include <atomic>
 #include <cassert>
 
 class MultipleDevices;
@@ -79,9 +81,39 @@ class DeviceBlackboard
    */
   WrapClock real_clock, replay_clock;
 
+  /**
+   * Copies of #gps_info and #calculated_info, published whenever they
+   * change.  Threads which only need to read these can use them
+   * instead of locking #mutex.
+   */
+  SnapshotBuffer<MoreData> basic_snapshot;
+  SnapshotBuffer<DerivedInfo> calculated_snapshot;
+
+public:
+  /**
+   * A function which receives each new total energy vario value as
+   * soon as the device delivers it.
+   */
+  typedef void (*VarioHandler)(double vario);
+
+private:
+  /**
+   * Called by OnTotalEnergyVario().  This bypasses the MergeThread,
+   * whose cycle would add up to 60 ms latency to the audio vario.
+   * Protected by #mutex.
+   */
+  VarioHandler vario_handler;
+
 public:
   Mutex mutex;
 
+  /**
+   * The total time [microseconds] the MergeThread and the
+   * CalculationThread have spent waiting for #mutex.  This is for
+   * diagnostics only, and the counters wrap around.
+   */
+  std::atomic<unsigned> merge_wait_us, calculation_wait_us;
+
 public:
   DeviceBlackboard();
 
@@ -91,6 +123,26 @@ public:
     devices = &_devices;
   }
 
+  /**
+   * Install (or remove with nullptr) the #VarioHandler.  Caller must
+   * not lock the blackboard.
+   */
+  void SetVarioHandler(VarioHandler handler) {
+    const ScopeLock protect(mutex);
+    vario_handler = handler;
+  }
+
+  /**
+   * The given device has just received a new total energy vario
+   * value.  If this device is the one whose value will be merged,
+   * pass it to the #VarioHandler.  Caller must lock the blackboard.
+   */
+  void OnTotalEnergyVario(unsigned i);
+
+  /**
+   * Store a new #calculated_info and publish it.  Caller must lock
+   * the blackboard.
+   */
   void ReadBlackboard(const DerivedInfo &derived_info);
   void ReadComputerSettings(const ComputerSettings &settings);
 
@@ -115,6 +167,30 @@ public:
 public:
   const NMEAInfo &RealState() const { return real_data; }
 
+  /**
+   * The most recently published copy of Basic().  It may be read
+   * without holding the lock.
+   */
+  const SnapshotBuffer<MoreData> &GetBasicSnapshot() const {
+    return basic_snapshot;
+  }
+
+  /**
+   * The most recently published copy of Calculated().  It may be
+   * read without holding the lock.
+   */
+  const SnapshotBuffer<DerivedInfo> &GetCalculatedSnapshot() const {
+    return calculated_snapshot;
+  }
+
+  /**
+   * Publish the current Basic() to #basic_snapshot.  Caller must lock
+   * the blackboard.
+   */
+  void PublishBasic() {
+    basic_snapshot.Publish(gps_info);
+  }
+
   /**
    * Is the specified device a FLARM?
    *
@@ -23,10 +23,12 @@ Copyright_License {
 
 #include "CalculationThread.hpp"
 #include "Computer/GlideComputer.hpp"
+#include "Computer/StageTimer.hpp"
 #include "Protection.hpp"
 #include "Blackboard/DeviceBlackboard.hpp"
 #include "Components.hpp"
 #include "Hardware/CPU.hpp"
+#include "OS/Clock.hpp"
 
 /**
  * Constructor of the CalculationThread class
@@ -58,6 +60,8 @@ CalculationThread::SetScreenDistanceMeters(double new_value)
 void
 CalculationThread::Tick()
 {
+  const ScopeStageTimer stage_timer(StageTimer::Stage::CALCULATION);
+
 #ifdef HAVE_CPU_FREQUENCY
   const ScopeLockCPU cpu;
 #endif
@@ -66,12 +70,13 @@ CalculationThread::Tick()
 
   // update and transfer master info to glide computer
   {
-    ScopeLock protect(device_blackboard->mutex);
-
-    gps_updated = device_blackboard->Basic().location_available.Modified(glide_computer.Basic().location_available);
+    const Validity old_location_available =
+      glide_computer.Basic().location_available;
 
     // Copy data from DeviceBlackboard to GlideComputerBlackboard
-    glide_computer.ReadBlackboard(device_blackboard->Basic());
+    glide_computer.ReadBlackboard(device_blackboard->GetBasicSnapshot());
+
+    gps_updated = glide_computer.Basic().location_available.Modified(old_location_available);
   }
 
   bool force;
@@ -99,7 +104,10 @@ CalculationThread::Tick()
   // should be changed in DoCalculations, so we only need to write
   // that one back (otherwise we may write over new data)
   {
+    const auto wait_start = MonotonicClockUS();
     ScopeLock protect(device_blackboard->mutex);
+    device_blackboard->calculation_wait_us += MonotonicClockUS() - wait_start;
+
     device_blackboard->ReadBlackboard(glide_computer.Calculated());
   }
 
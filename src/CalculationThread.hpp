@@ -25,6 +25,7 @@ Copyright_License {
 #define XCSOAR_CALCULATION_THREAD_HPP
 
 #include "Thread/WorkerThread.hpp"
+#include "Thread/Policy.hpp"
 #include "Thread/Mutex.hpp"
 #include "Computer/Settings.hpp"
 
@@ -62,17 +63,15 @@ public:
   void SetComputerSettings(const ComputerSettings &new_value);
   void SetScreenDistanceMeters(double new_value);
 
-  bool Start(bool suspended=false) {
-    if (!WorkerThread::Start(suspended))
-      return false;
-
-    SetLowPriority();
-    return true;
-  }
-
   void ForceTrigger();
 
 protected:
+  /* virtual methods from class Thread */
+  void Run() override {
+    ApplyThreadPolicy(ThreadRole::CALCULATION);
+    WorkerThread::Run();
+  }
+
   virtual void Tick();
 };
 
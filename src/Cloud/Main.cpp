@@ -40,9 +40,15 @@ Copyright_License {
 #include <boost/asio/steady_timer.hpp>
 
 #include <array>
+#include <vector>
+#include <algorithm>
+#include <string>
+#include <thread>
 #include <iostream>
 #include <iomanip>
 
+#include <stdlib.h>
+
 // TODO: review these settings
 static constexpr double TRAFFIC_RANGE = 50000;
 static constexpr double THERMAL_RANGE = 50000;
@@ -56,6 +62,23 @@ using std::cout;
 using std::cerr;
 using std::endl;
 
+/**
+ * An #OutputStream which collects all data in memory.
+ */
+class StringOutputStream final : public OutputStream {
+  std::string value;
+
+public:
+  std::string &GetValue() {
+    return value;
+  }
+
+  /* virtual methods from class OutputStream */
+  void Write(const void *data, size_t size) override {
+    value.append((const char *)data, size);
+  }
+};
+
 class CloudServer final
   : public SkyLinesTracking::Server,
 #ifdef __linux__
@@ -67,6 +90,12 @@ class CloudServer final
 
   boost::asio::steady_timer save_timer, expire_timer;
 
+  /**
+   * Writes the serialised database to #db_path, so the io_service
+   * thread does not have to wait for the disk.
+   */
+  std::thread save_thread;
+
 public:
   CloudServer(AllocatedPath &&_db_path, boost::asio::io_service &io_service,
               boost::asio::ip::udp::endpoint endpoint)
@@ -85,12 +114,19 @@ public:
     ScheduleSave();
   }
 
+  ~CloudServer() {
+    if (save_thread.joinable())
+      save_thread.join();
+  }
+
   using SkyLinesTracking::Server::get_io_service;
 
   void Load();
   void Save();
 
 private:
+  static void WriteFile(Path path, const std::string &data);
+
   void ScheduleSave() {
     save_timer.expires_from_now(std::chrono::minutes(1));
     save_timer.async_wait([this](const boost::system::error_code &ec){
@@ -109,7 +145,8 @@ private:
           return;
 
         clients.Expire(expire_timer.expires_at() - std::chrono::minutes(10));
-        if (!clients.empty())
+        thermals.Expire(expire_timer.expires_at() - MAX_THERMAL_AGE);
+        if (!clients.empty() || !thermals.empty())
           ScheduleExpire();
       });
   }
@@ -191,7 +228,7 @@ CloudServer::OnFix(const Client &c,
          << client->id << '\t'
          << client->location << '\t'
          << client->altitude << 'm'
-         << endl;
+         << '\n';
 
     if (was_empty)
       ScheduleExpire();
@@ -284,7 +321,7 @@ CloudServer::OnWaveSubmit(const Client &c,
        << b << '\t'
        << bottom_altitude << '-' << top_altitude << "m\t"
        << lift << "m/s"
-       << endl;
+       << '\n';
 }
 
 void
@@ -309,7 +346,7 @@ CloudServer::OnThermalSubmit(const Client &c,
        << top_location << '\t'
        << bottom_altitude << '-' << top_altitude << "m\t"
        << lift << "m/s"
-       << endl;
+       << '\n';
 
   const auto &thermal =
     thermals.Make(c.key,
@@ -349,28 +386,34 @@ CloudServer::OnThermalRequest(const Client &c)
 
   client->wants_thermals = now + REQUEST_EXPIRY;
 
-  const auto min_time = now - MAX_THERMAL_AGE;
+  /* don't send old thermals, they're useless; and don't let them
+     slow down the query */
+  thermals.Expire(now - MAX_THERMAL_AGE);
 
-  ThermalResponseSender s(*this, c);
-
-  unsigned n = 0;
+  std::vector<const CloudThermal *> candidates;
   for (const auto &thermal : thermals.QueryWithinRange(client->location,
-                                                       THERMAL_RANGE)) {
-    if (thermal->client_key == c.key)
+                                                       THERMAL_RANGE))
+    if (thermal->client_key != c.key)
       /* ignore this client's own submissions - he knows them
          already */
-      continue;
+      candidates.push_back(thermal.get());
+
+  /* if there are too many, send the strongest ones */
+  constexpr size_t MAX_THERMALS = 256;
+  if (candidates.size() > MAX_THERMALS) {
+    std::nth_element(candidates.begin(),
+                     candidates.begin() + MAX_THERMALS, candidates.end(),
+                     [](const CloudThermal *a, const CloudThermal *b){
+                       return a->lift > b->lift;
+                     });
+    candidates.resize(MAX_THERMALS);
+  }
 
-    if (thermal->time < min_time)
-      /* don't send old thermals, they're useless */
-      continue;
+  ThermalResponseSender s(*this, c);
 
+  for (const auto *thermal : candidates)
     s.Add(thermal->Pack());
 
-    if (++n > 256)
-      break;
-  }
-
   s.Flush();
 }
 
@@ -382,36 +425,68 @@ CloudServer::Load()
   CloudData::Load(s);
 }
 
+void
+CloudServer::WriteFile(Path path, const std::string &data)
+try {
+  FileOutputStream fos(path);
+  fos.Write(data.data(), data.size());
+  fos.Commit();
+} catch (const std::exception &e) {
+  PrintException(e);
+}
+
 void
 CloudServer::Save()
 {
+  /* this also flushes the FIX/WAVE/THERMAL lines, which are not
+     flushed one by one to avoid a write() call per datagram */
   cout << "Saving data to " << db_path.c_str() << endl;
 
-  FileOutputStream fos(db_path);
+  /* serialising into memory is quick; only the file is written in
+     another thread */
+  StringOutputStream sos;
 
   {
-    Serialiser s(fos);
+    Serialiser s(sos);
     CloudData::Save(s);
     s.Flush();
   }
 
-  fos.Commit();
+  if (save_thread.joinable())
+    /* wait for the previous save, which should have finished long
+       ago */
+    save_thread.join();
+
+  save_thread = std::thread(WriteFile, Path(db_path),
+                            std::move(sos.GetValue()));
 }
 
 int
 main(int argc, char **argv)
 try {
-  if (argc != 2) {
-    cerr << "Usage: " << argv[0] << " DBPATH" << endl;
+  if (argc < 2 || argc > 3) {
+    cerr << "Usage: " << argv[0] << " DBPATH [PORT]" << endl;
     return EXIT_FAILURE;
   }
 
   const Path db_path(argv[1]);
 
+  /* a non-default port allows running several instances (e.g. one
+     per region) on one host */
+  unsigned port = CloudServer::GetDefaultPort();
+  if (argc > 2) {
+    char *endptr;
+    port = strtoul(argv[2], &endptr, 10);
+    if (endptr == argv[2] || *endptr != 0 || port == 0 || port > 0xffff) {
+      cerr << "Invalid port: " << argv[2] << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
   boost::asio::io_service io_service;
 
   const boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::udp::v4(),
-                                                CloudServer::GetDefaultPort());
+                                                port);
 
   CloudServer server(db_path, io_service, endpoint);
 
@@ -32,6 +32,7 @@ Copyright_License {
 #include "Util/StringAPI.hxx"
 #include "Util/NumberParser.hpp"
 #include "Asset.hpp"
+#include "Logger/DeviceCapture.hpp"
 
 #ifdef WIN32
 #include <windows.h> /* for AllocConsole() */
@@ -84,6 +85,8 @@ CommandLine::Parse(Args &args)
     } else if (StringIsEqual(s, "-replay=", 8)) {
       replay_path = s + 8;
 #endif
+    } else if (StringIsEqual(s, "-capture")) {
+      DeviceCapture::enabled = true;
 #ifdef SIMULATOR_AVAILABLE
     } else if (StringIsEqual(s, "-simulator")) {
       global_simulator_flag = true;
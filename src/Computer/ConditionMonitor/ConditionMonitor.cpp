@@ -37,6 +37,10 @@ ConditionMonitor::Update(const NMEAInfo &basic, const DerivedInfo &calculated,
   const auto Time = basic.time;
   if (Ready_Time_Check(Time, &restart)) {
     LastTime_Check = Time;
+    if (!restart && !InputsModified(basic, calculated))
+      /* nothing new to look at */
+      return;
+
     if (CheckCondition(basic, calculated, settings)) {
       if (Ready_Time_Notification(Time) && !restart) {
         LastTime_Notification = Time;
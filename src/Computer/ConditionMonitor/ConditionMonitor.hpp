@@ -51,6 +51,16 @@ public:
               const ComputerSettings &settings);
 
 private:
+  /**
+   * Have the inputs of CheckCondition() changed since the last
+   * check?  If not, the check is skipped.  Monitors which cannot
+   * tell cheaply should not override this method.
+   */
+  virtual bool InputsModified(const NMEAInfo &basic,
+                              const DerivedInfo &calculated) const {
+    return true;
+  }
+
   virtual bool CheckCondition(const NMEAInfo &basic,
                               const DerivedInfo &calculated,
                               const ComputerSettings &settings) = 0;
@@ -47,9 +47,8 @@ ConditionMonitorSunset::CheckCondition(const NMEAInfo &basic,
 
   /// @todo should be destination location
 
-  SunEphemeris::Result sun =
-    SunEphemeris::CalcSunTimes(basic.location, basic.date_time_utc,
-                               settings.utc_offset);
+  const SunEphemeris::Result &sun =
+    sun_cache.Get(basic.location, basic.date_time_utc, settings.utc_offset);
 
   const auto time_local = basic.time + settings.utc_offset.AsSeconds();
   const auto d1 = (time_local + res.time_elapsed) / 3600;
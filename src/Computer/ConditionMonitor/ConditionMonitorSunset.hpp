@@ -25,10 +25,13 @@ Copyright_License {
 #define XCSOAR_CONDITION_MONITOR_SUNSET_HPP
 
 #include "ConditionMonitor.hpp"
+#include "Math/SunEphemeris.hpp"
 
 class ConditionMonitorSunset final : public ConditionMonitor {
+  SunEphemeris::Cache sun_cache;
+
 public:
-  constexpr ConditionMonitorSunset():ConditionMonitor(60 * 30, 60) {}
+  ConditionMonitorSunset():ConditionMonitor(60 * 30, 60) {}
 
 protected:
   bool CheckCondition(const NMEAInfo &basic,
@@ -27,12 +27,20 @@ Copyright_License {
 #include "Language/Language.hpp"
 #include "Message.hpp"
 
+bool
+ConditionMonitorWind::InputsModified(const NMEAInfo &basic,
+                                     const DerivedInfo &calculated) const
+{
+  return calculated.wind_available != last_wind_available;
+}
+
 bool
 ConditionMonitorWind::CheckCondition(const NMEAInfo &basic,
                                      const DerivedInfo &calculated,
                                      const ComputerSettings &settings)
 {
   wind = calculated.GetWindOrZero();
+  last_wind_available = calculated.wind_available;
 
   if (!calculated.flight.flying) {
     last_wind = wind;
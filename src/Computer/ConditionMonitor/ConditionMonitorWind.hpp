@@ -26,18 +26,28 @@ Copyright_License {
 
 #include "ConditionMonitor.hpp"
 #include "Geo/SpeedVector.hpp"
+#include "NMEA/Validity.hpp"
 
 /** #ConditionMonitor to track/warn on significant changes in wind speed */
 class ConditionMonitorWind final : public ConditionMonitor {
   SpeedVector wind;
   SpeedVector last_wind;
 
+  /**
+   * The #DerivedInfo::wind_available value seen by the last check.
+   */
+  Validity last_wind_available;
+
 public:
-  constexpr ConditionMonitorWind()
+  ConditionMonitorWind()
     :ConditionMonitor(60 * 5, 10),
-     wind(SpeedVector::Zero()), last_wind(SpeedVector::Zero()) {}
+     wind(SpeedVector::Zero()), last_wind(SpeedVector::Zero()) {
+    last_wind_available.Clear();
+  }
 
 protected:
+  bool InputsModified(const NMEAInfo &basic,
+                      const DerivedInfo &calculated) const override;
   bool CheckCondition(const NMEAInfo &basic,
                       const DerivedInfo &calculated,
                       const ComputerSettings &settings) override;
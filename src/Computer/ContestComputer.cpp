@@ -23,6 +23,8 @@ Copyright_License {
 
 #include "ContestComputer.hpp"
 #include "Engine/Contest/Settings.hpp"
+#include "Engine/Contest/Solvers/AbstractContest.hpp"
+#include "OS/Clock.hpp"
 
 ContestComputer::ContestComputer(const Trace &trace_full,
                                  const Trace &trace_triangle,
@@ -30,6 +32,27 @@ ContestComputer::ContestComputer(const Trace &trace_full,
   :contest_manager(Contest::OLC_SPRINT, trace_full, trace_triangle, trace_sprint, true)
 {
   contest_manager.SetIncremental(true);
+
+  solver_duration_us[0] = solver_duration_us[1] = 0;
+}
+
+ContestComputer::~ContestComputer()
+{
+  solver_thread.LockStop();
+}
+
+void
+ContestComputer::Solve(AbstractContest &a, SolverResult &result_a,
+                       AbstractContest &b, SolverResult &result_b,
+                       bool exhaustive)
+{
+  solver_thread.Start(b, exhaustive);
+
+  const uint64_t start = MonotonicClockUS();
+  result_a = a.Solve(exhaustive);
+  solver_duration_us[0] = MonotonicClockUS() - start;
+
+  result_b = solver_thread.Wait(solver_duration_us[1]);
 }
 
 void
@@ -42,7 +65,7 @@ ContestComputer::Solve(const ContestSettings &settings,
   contest_manager.SetHandicap(settings.handicap);
   contest_manager.SetContest(settings.contest);
 
-  contest_manager.UpdateIdle();
+  contest_manager.UpdateIdle(false, this);
 
   contest_stats = contest_manager.GetStats();
 }
@@ -57,7 +80,9 @@ ContestComputer::SolveExhaustive(const ContestSettings &settings,
   contest_manager.SetHandicap(settings.handicap);
   contest_manager.SetContest(settings.contest);
 
-  bool result = contest_manager.SolveExhaustive();
+  solver_duration_us[0] = solver_duration_us[1] = 0;
+
+  bool result = contest_manager.SolveExhaustive(this);
 
   contest_stats = contest_manager.GetStats();
 
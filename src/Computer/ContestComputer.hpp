@@ -24,20 +24,39 @@ Copyright_License {
 #ifndef XCSOAR_CONTEST_COMPUTER_HPP
 #define XCSOAR_CONTEST_COMPUTER_HPP
 
+#include "ContestSolverThread.hpp"
 #include "Engine/Contest/ContestManager.hpp"
 
+#include <stdint.h>
+#include <assert.h>
+
 struct ContestSettings;
 struct ContestStatistics;
 class Trace;
 
-class ContestComputer {
+class ContestComputer final : ContestManager::SolverRunner {
   ContestManager contest_manager;
 
+  /**
+   * Solves the second of two independent contest searches (e.g. the
+   * XContest triangle) while the #CalculationThread solves the first
+   * one.
+   */
+  ContestSolverThread solver_thread;
+
+  /**
+   * The wall time of the two most recent parallel solver runs [us].
+   * Used for diagnostics only.
+   */
+  uint64_t solver_duration_us[2];
+
 public:
   ContestComputer(const Trace &trace_full,
                   const Trace &trace_triangle,
                   const Trace &trace_sprint);
 
+  ~ContestComputer();
+
   void SetIncremental(bool incremental) {
     contest_manager.SetIncremental(incremental);
   }
@@ -58,6 +77,22 @@ public:
 
   bool SolveExhaustive(const ContestSettings &settings_computer,
                        ContestStatistics &contest_stats);
+
+  /**
+   * Returns the wall time of the given solver during the most recent
+   * parallel run [us].
+   */
+  uint64_t GetSolverDuration(unsigned i) const {
+    assert(i < 2);
+
+    return solver_duration_us[i];
+  }
+
+private:
+  /* virtual methods from class ContestManager::SolverRunner */
+  void Solve(AbstractContest &a, SolverResult &result_a,
+             AbstractContest &b, SolverResult &result_b,
+             bool exhaustive) override;
 };
 
 #endif
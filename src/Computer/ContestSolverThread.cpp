@@ -0,0 +1,77 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#include "ContestSolverThread.hpp"
+#include "Engine/Contest/Solvers/AbstractContest.hpp"
+#include "OS/Clock.hpp"
+
+ContestSolverThread::ContestSolverThread()
+  :StandbyThread("ContestSolver") {}
+
+void
+ContestSolverThread::Start(AbstractContest &_contest, bool _exhaustive)
+{
+  const ScopeLock protect(mutex);
+  assert(!IsBusy());
+
+  contest = &_contest;
+  exhaustive = _exhaustive;
+  Trigger();
+}
+
+SolverResult
+ContestSolverThread::Wait(uint64_t &duration_us_r)
+{
+  const ScopeLock protect(mutex);
+  WaitDone();
+
+  if (contest != nullptr)
+    /* the thread has failed to start; solve it in the calling
+       thread */
+    Tick();
+
+  duration_us_r = duration_us;
+  return result;
+}
+
+void
+ContestSolverThread::Tick()
+{
+  AbstractContest &c = *contest;
+  const bool e = exhaustive;
+
+  SolverResult r;
+  uint64_t t;
+
+  {
+    const ScopeUnlock unlock(mutex);
+
+    const uint64_t start = MonotonicClockUS();
+    r = c.Solve(e);
+    t = MonotonicClockUS() - start;
+  }
+
+  contest = nullptr;
+  result = r;
+  duration_us = t;
+}
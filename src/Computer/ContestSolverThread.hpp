@@ -0,0 +1,72 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#ifndef XCSOAR_CONTEST_SOLVER_THREAD_HPP
+#define XCSOAR_CONTEST_SOLVER_THREAD_HPP
+
+#include "Thread/StandbyThread.hpp"
+#include "Engine/PathSolvers/SolverResult.hpp"
+
+#include <stdint.h>
+
+class AbstractContest;
+
+/**
+ * A helper thread which runs one contest solver while the
+ * #CalculationThread runs another one.
+ */
+class ContestSolverThread final : private StandbyThread {
+  AbstractContest *contest = nullptr;
+  bool exhaustive;
+
+  SolverResult result;
+
+  /**
+   * The wall time of the last Solve() call [us].
+   */
+  uint64_t duration_us = 0;
+
+public:
+  ContestSolverThread();
+
+  using StandbyThread::LockStop;
+
+  /**
+   * Start solving the given contest in background.  Must not be
+   * called while the thread is busy.
+   */
+  void Start(AbstractContest &_contest, bool _exhaustive);
+
+  /**
+   * Wait for the solver which was passed to Start().
+   *
+   * @param duration_us_r receives the wall time of the solver [us]
+   */
+  SolverResult Wait(uint64_t &duration_us_r);
+
+private:
+  /* virtual methods from class StandbyThread */
+  void Tick() override;
+};
+
+#endif
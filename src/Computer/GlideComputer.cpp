@@ -22,11 +22,13 @@ Copyright_License {
 */
 
 #include "GlideComputer.hpp"
+#include "StageTimer.hpp"
 #include "Computer/Settings.hpp"
 #include "NMEA/Derived.hpp"
 #include "ConditionMonitor/ConditionMonitors.hpp"
 #include "GlideComputerInterface.hpp"
 #include "Engine/Waypoint/Waypoints.hpp"
+#include "OS/Clock.hpp"
 
 static PeriodClock last_team_code_update;
 
@@ -56,6 +58,7 @@ GlideComputer::ResetFlight(const bool full)
   stats_computer.ResetFlight(full);
   log_computer.Reset();
   retrospective.Reset();
+  idle_scheduler.Reset();
 
   cu_computer.Reset();
   warning_computer.Reset();
@@ -72,10 +75,15 @@ GlideComputer::Initialise()
 bool
 GlideComputer::ProcessGPS(bool force)
 {
+  const ScopeStageTimer stage_timer(StageTimer::Stage::GPS);
+
   const MoreData &basic = Basic();
   DerivedInfo &calculated = SetCalculated();
   const ComputerSettings &settings = GetComputerSettings();
 
+  if (!force && basic.time_available)
+    idle_scheduler.OnFix(basic.time);
+
   const bool last_flying = calculated.flight.flying;
 
   if (basic.time_available) {
@@ -96,16 +104,22 @@ GlideComputer::ProcessGPS(bool force)
   calculated.Expire(basic.clock);
 
   // Process basic information
-  air_data_computer.ProcessBasic(Basic(), SetCalculated(),
-                                 settings);
+  {
+    const ScopeStageTimer air_data_timer(StageTimer::Stage::AIR_DATA);
+    air_data_computer.ProcessBasic(Basic(), SetCalculated(),
+                                   settings);
+  }
 
   // Process basic task information
   const bool last_finished = calculated.ordered_task_stats.task_finished;
 
-  task_computer.ProcessBasicTask(basic,
-                                 calculated,
-                                 settings,
-                                 force);
+  {
+    const ScopeStageTimer task_timer(StageTimer::Stage::TASK);
+    task_computer.ProcessBasicTask(basic,
+                                   calculated,
+                                   settings,
+                                   force);
+  }
 
   CalculateWorkingBand();
 
@@ -155,26 +169,63 @@ GlideComputer::ProcessGPS(bool force)
   return idle_clock.CheckUpdate(500);
 }
 
+/**
+ * Run the given idle job if the #IdleScheduler permits it, and let it
+ * know how long it took.
+ */
+template<typename F>
+static void
+RunIdleJob(IdleScheduler &scheduler, IdleScheduler::Job job, F &&f)
+{
+  if (!scheduler.Check(job))
+    return;
+
+  const uint64_t start = MonotonicClockUS();
+  f();
+  scheduler.Finished(job, unsigned(MonotonicClockUS() - start));
+}
+
 void
 GlideComputer::ProcessIdle(bool exhaustive)
 {
+  const ScopeStageTimer stage_timer(StageTimer::Stage::IDLE);
+
   const MoreData &basic = Basic();
   DerivedInfo &calculated = SetCalculated();
 
   // Log GPS fixes for internal usage
   // (snail trail, stats, olc, ...)
-  stats_computer.DoLogging(basic, calculated);
+  {
+    const ScopeStageTimer stats_timer(StageTimer::Stage::STATS);
+    stats_computer.DoLogging(basic, calculated);
+  }
+
   log_computer.Run(basic, calculated, GetComputerSettings().logger);
 
-  task_computer.ProcessIdle(basic, calculated, GetComputerSettings(),
-                            exhaustive);
+  /* the remaining jobs are postponed if they would delay the next
+     fix */
+  idle_scheduler.BeginCycle(exhaustive);
+
+  RunIdleJob(idle_scheduler, IdleScheduler::Job::WARNING, [&](){
+      const ScopeStageTimer warning_timer(StageTimer::Stage::WARNING);
+      warning_computer.Update(GetComputerSettings(), basic,
+                              calculated, calculated.airspace_warnings);
+    });
+
+  RunIdleJob(idle_scheduler, IdleScheduler::Job::TASK, [&](){
+      task_computer.ProcessIdleTask(basic, calculated);
+    });
 
-  warning_computer.Update(GetComputerSettings(), basic,
-                          calculated, calculated.airspace_warnings);
+  RunIdleJob(idle_scheduler, IdleScheduler::Job::CONTEST, [&](){
+      task_computer.ProcessIdleContest(basic, calculated,
+                                       GetComputerSettings(), exhaustive);
+    });
 
   // Calculate summary of flight
   if (basic.location_available)
-    retrospective.UpdateSample(basic.location);
+    RunIdleJob(idle_scheduler, IdleScheduler::Job::RETROSPECTIVE, [&](){
+        retrospective.UpdateSample(basic.location);
+      });
 }
 
 bool
@@ -33,6 +33,7 @@ Copyright_License {
 #include "LogComputer.hpp"
 #include "WarningComputer.hpp"
 #include "CuComputer.hpp"
+#include "IdleScheduler.hpp"
 #include "Compiler.h"
 #include "Engine/Contest/Solvers/Retrospective.hpp"
 
@@ -63,6 +64,12 @@ class GlideComputer : public GlideComputerBlackboard
 
   PeriodClock idle_clock;
 
+  /**
+   * Decides which parts of ProcessIdle() fit into the time left
+   * before the next GPS fix.
+   */
+  IdleScheduler idle_scheduler;
+
   /**
    * This object is used to check whether to update
    * DerivedInfo::trace_history.
@@ -107,6 +114,12 @@ public:
 
   /**
    * Process slow calculations. Called by the CalculationThread.
+   *
+   * Jobs which do not fit into the time left before the next GPS
+   * fix are postponed to the next call (see #IdleScheduler).
+   *
+   * @param exhaustive run all jobs to completion, ignoring the
+   * deadline
    */
   void ProcessIdle(bool exhaustive=false);
 
@@ -138,6 +151,17 @@ public:
     return task_computer.GetTraceComputer();
   }
 
+  /**
+   * @see GlideComputerAirData::GetThermalDatabase()
+   */
+  ThermalDatabase &GetThermalDatabase() {
+    return air_data_computer.GetThermalDatabase();
+  }
+
+  const ThermalDatabase &GetThermalDatabase() const {
+    return air_data_computer.GetThermalDatabase();
+  }
+
   const ProtectedTaskManager &GetProtectedTaskManager() const {
     return task_computer.GetProtectedTaskManager();
   }
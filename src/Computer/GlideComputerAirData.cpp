@@ -345,6 +345,18 @@ GlideComputerAirData::ThermalSources(const MoreData &basic,
     source.location = ground_location;
     source.ground_height = ground_altitude;
     source.time = basic.time;
+
+    ThermalRecord record;
+    record.location = ground_location;
+    record.ground_height = ground_altitude;
+    record.base = calculated.last_thermal.start_altitude;
+    record.top = calculated.last_thermal.start_altitude
+      + calculated.last_thermal.gain;
+    record.lift_rate = calculated.last_thermal.lift_rate;
+    record.time_of_day = unsigned(basic.time);
+
+    const ScopeLock protect(thermal_database.mutex);
+    thermal_database.Add(record);
   }
 }
 
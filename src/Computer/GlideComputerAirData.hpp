@@ -34,6 +34,7 @@ Copyright_License {
 #include "LiftDatabaseComputer.hpp"
 #include "AverageVarioComputer.hpp"
 #include "ThermalLocator.hpp"
+#include "ThermalDatabase.hpp"
 
 struct VarioInfo;
 struct OneClimbInfo;
@@ -64,6 +65,11 @@ class GlideComputerAirData {
 
   ThermalLocator thermallocator;
 
+  /**
+   * All climbs of this and (if loaded) earlier flights.
+   */
+  ThermalDatabase thermal_database;
+
   AverageVarioComputer average_vario;
 
   /**
@@ -82,6 +88,14 @@ public:
     return wind_computer.GetWindStore();
   }
 
+  ThermalDatabase &GetThermalDatabase() {
+    return thermal_database;
+  }
+
+  const ThermalDatabase &GetThermalDatabase() const {
+    return thermal_database;
+  }
+
   void ResetFlight(DerivedInfo &calculated, const bool full=true);
 
   void ResetStats() {
@@ -23,6 +23,7 @@ Copyright_License {
 */
 
 #include "GlideComputerBlackboard.hpp"
+#include "Thread/SnapshotBuffer.hpp"
 
 /**
  * Resets the GlideComputerBlackboard
@@ -85,6 +86,12 @@ GlideComputerBlackboard::ReadBlackboard(const MoreData &nmea_info)
   gps_info = nmea_info;
 }
 
+void
+GlideComputerBlackboard::ReadBlackboard(const SnapshotBuffer<MoreData> &snapshot)
+{
+  snapshot.Read(gps_info);
+}
+
 /**
  * Retrieves settings from the DeviceBlackboard
  * @param settings New settings
@@ -27,6 +27,8 @@ Copyright_License {
 #include "Blackboard/BaseBlackboard.hpp"
 #include "Blackboard/ComputerSettingsBlackboard.hpp"
 
+template<typename T> class SnapshotBuffer;
+
 /**
  * Blackboard class used by glide computer (calculation) thread.
  * Can only write DERIVED_INFO
@@ -39,6 +41,12 @@ class GlideComputerBlackboard:
 
 public:
   void ReadBlackboard(const MoreData &nmea_info);
+
+  /**
+   * Copy the most recently published snapshot, without locking the
+   * source blackboard.
+   */
+  void ReadBlackboard(const SnapshotBuffer<MoreData> &snapshot);
   void ReadComputerSettings(const ComputerSettings &settings);
 
 protected:
@@ -0,0 +1,117 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#include "IdleScheduler.hpp"
+#include "OS/Clock.hpp"
+
+#include <assert.h>
+
+/**
+ * The number of cycles a job may be postponed before it is run even
+ * if it misses the deadline.
+ */
+static constexpr unsigned max_postponed[unsigned(IdleScheduler::Job::COUNT)] = {
+  1,
+  2,
+  4,
+  4,
+};
+
+/**
+ * The fraction of the fix interval which is reserved for the next
+ * fix and for other threads (e.g. drawing the map).
+ */
+static constexpr unsigned RESERVE_DIVISOR = 4;
+
+void
+IdleScheduler::Reset()
+{
+  for (auto &i : jobs) {
+    i.cost_us = 0;
+    i.postponed = 0;
+  }
+
+  last_fix_time = -1;
+  last_fix_clock = 0;
+  fix_interval_us = 0;
+  deadline = 0;
+}
+
+void
+IdleScheduler::OnFix(double time)
+{
+  last_fix_clock = MonotonicClockUS();
+
+  if (last_fix_time >= 0) {
+    const double dt = time - last_fix_time;
+    if (dt >= 0.1 && dt <= 10) {
+      const unsigned dt_us = unsigned(dt * 1000000);
+      fix_interval_us = fix_interval_us > 0
+        ? (fix_interval_us * 3 + dt_us) / 4
+        : dt_us;
+    } else if (dt < 0 || dt > 10)
+      /* time warp or long gap */
+      fix_interval_us = 0;
+  }
+
+  last_fix_time = time;
+}
+
+void
+IdleScheduler::BeginCycle(bool exhaustive)
+{
+  if (exhaustive || fix_interval_us == 0) {
+    deadline = 0;
+    return;
+  }
+
+  deadline = last_fix_clock + fix_interval_us
+    - fix_interval_us / RESERVE_DIVISOR;
+}
+
+bool
+IdleScheduler::Check(Job job)
+{
+  assert(job < Job::COUNT);
+
+  JobState &state = jobs[unsigned(job)];
+
+  if (deadline == 0 || state.postponed >= max_postponed[unsigned(job)] ||
+      MonotonicClockUS() + state.cost_us <= deadline)
+    return true;
+
+  ++state.postponed;
+  return false;
+}
+
+void
+IdleScheduler::Finished(Job job, unsigned duration_us)
+{
+  assert(job < Job::COUNT);
+
+  JobState &state = jobs[unsigned(job)];
+  state.cost_us = state.cost_us > 0
+    ? (state.cost_us * 3 + duration_us) / 4
+    : duration_us;
+  state.postponed = 0;
+}
@@ -0,0 +1,128 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#ifndef XCSOAR_IDLE_SCHEDULER_HPP
+#define XCSOAR_IDLE_SCHEDULER_HPP
+
+#include <stdint.h>
+
+/**
+ * Decides which of the slow calculations in
+ * GlideComputer::ProcessIdle() fit into the time left before the
+ * next GPS fix is expected.  The cost of each job is measured; a job
+ * which does not fit is postponed to the next cycle, but only a
+ * limited number of times, so no job starves.
+ *
+ * The jobs are listed in the order of descending priority; they are
+ * also executed in this order.
+ */
+class IdleScheduler {
+public:
+  enum class Job : uint8_t {
+    /** WarningComputer::Update() */
+    WARNING,
+
+    /** TaskManager::UpdateIdle() */
+    TASK,
+
+    /** ContestComputer::Solve() */
+    CONTEST,
+
+    /** Retrospective::UpdateSample() */
+    RETROSPECTIVE,
+
+    COUNT,
+  };
+
+private:
+  struct JobState {
+    /**
+     * Moving average of the run time [us].
+     */
+    unsigned cost_us;
+
+    /**
+     * The number of consecutive cycles this job was postponed.
+     */
+    unsigned postponed;
+  };
+
+  JobState jobs[unsigned(Job::COUNT)];
+
+  /**
+   * The GPS time of the previous fix [s]; negative if unknown.
+   */
+  double last_fix_time;
+
+  /**
+   * The monotonic time when the previous fix was processed [us].
+   */
+  uint64_t last_fix_clock;
+
+  /**
+   * Moving average of the interval between two fixes [us]; zero if
+   * unknown.
+   */
+  unsigned fix_interval_us;
+
+  /**
+   * The monotonic time until which the current cycle may run [us];
+   * zero means "no deadline".
+   */
+  uint64_t deadline;
+
+public:
+  IdleScheduler() {
+    Reset();
+  }
+
+  void Reset();
+
+  /**
+   * A new GPS fix has been received.
+   *
+   * @param time the GPS time of the fix [s]
+   */
+  void OnFix(double time);
+
+  /**
+   * Start a new GlideComputer::ProcessIdle() cycle.
+   *
+   * @param exhaustive if true, then all jobs run regardless of the
+   * deadline
+   */
+  void BeginCycle(bool exhaustive);
+
+  /**
+   * Shall the given job be run now?  If this returns false, the job
+   * is postponed to the next cycle.
+   */
+  bool Check(Job job);
+
+  /**
+   * Report the run time of a job which was permitted by Check().
+   */
+  void Finished(Job job, unsigned duration_us);
+};
+
+#endif
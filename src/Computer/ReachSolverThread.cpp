@@ -0,0 +1,106 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#include "ReachSolverThread.hpp"
+#include "Terrain/RasterTerrain.hpp"
+
+ReachSolverThread::ReachSolverThread()
+  :StandbyThread("ReachSolver") {}
+
+void
+ReachSolverThread::Start(const RasterTerrain *_terrain,
+                         const AGeoPoint &_origin,
+                         bool _do_solve, bool _coarse)
+{
+  const ScopeLock protect(mutex);
+  assert(!IsBusy() || !IsAlive());
+
+  terrain = _terrain;
+  origin = _origin;
+  do_solve = _do_solve;
+  coarse = _coarse;
+  scheduled = true;
+  finished = false;
+  Trigger();
+}
+
+bool
+ReachSolverThread::IsRunning()
+{
+  const ScopeLock protect(mutex);
+  return scheduled && IsAlive();
+}
+
+bool
+ReachSolverThread::Poll()
+{
+  const ScopeLock protect(mutex);
+
+  if (scheduled) {
+    if (IsAlive())
+      return false;
+
+    /* the thread has failed to start; solve it in the calling
+       thread */
+    Tick();
+  }
+
+  const bool result = finished;
+  finished = false;
+  return result;
+}
+
+void
+ReachSolverThread::Wait()
+{
+  const ScopeLock protect(mutex);
+  WaitDone();
+
+  scheduled = false;
+  finished = false;
+}
+
+void
+ReachSolverThread::Tick()
+{
+  if (!scheduled)
+    return;
+
+  const RasterTerrain *const t = terrain;
+  const AGeoPoint o = origin;
+  const bool s = do_solve, c = coarse;
+
+  {
+    const ScopeUnlock unlock(mutex);
+
+    if (t != nullptr) {
+      RasterTerrain::Lease lease(*t);
+      const RasterMap &map = lease;
+      solution.Solve(o, &map, s, c);
+    } else
+      solution.Solve(o, nullptr, s, c);
+  }
+
+  scheduled = false;
+  finished = true;
+}
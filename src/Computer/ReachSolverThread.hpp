@@ -0,0 +1,108 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#ifndef XCSOAR_REACH_SOLVER_THREAD_HPP
+#define XCSOAR_REACH_SOLVER_THREAD_HPP
+
+#include "Thread/StandbyThread.hpp"
+#include "Engine/Route/ReachSolution.hpp"
+#include "Geo/GeoPoint.hpp"
+
+class RasterTerrain;
+
+/**
+ * A helper thread which calculates the reach fans, so the
+ * #CalculationThread does not have to wait for it.
+ *
+ * All fans are allocated and freed in this thread (or in the calling
+ * thread while this one is idle), because the fan allocator is not
+ * thread-safe.
+ */
+class ReachSolverThread final : private StandbyThread {
+  const RasterTerrain *terrain;
+  AGeoPoint origin;
+  bool do_solve, coarse;
+
+  /**
+   * Has a job been passed to Start() which has not been solved yet?
+   */
+  bool scheduled = false;
+
+  /**
+   * Is there a result in #solution which has not been collected by
+   * Poll() yet?
+   */
+  bool finished = false;
+
+  ReachSolution solution;
+
+public:
+  ReachSolverThread();
+
+  using StandbyThread::LockStop;
+
+  /**
+   * Returns the solution object, to be prepared before Start() and
+   * to be collected after Poll().  Must not be used while the thread
+   * is busy.
+   */
+  ReachSolution &GetSolution() {
+    return solution;
+  }
+
+  /**
+   * Start solving #solution in background.  Must not be called while
+   * the thread is busy.
+   *
+   * @param terrain the terrain to be locked while solving; may be
+   * nullptr
+   */
+  void Start(const RasterTerrain *_terrain, const AGeoPoint &_origin,
+             bool _do_solve, bool _coarse);
+
+  /**
+   * Is a job running which was passed to Start()?
+   */
+  bool IsRunning();
+
+  /**
+   * Check whether the job passed to Start() is finished, without
+   * blocking.  If the thread has failed to start, the job is solved
+   * in the calling thread.
+   *
+   * @return true if a new result is available in GetSolution()
+   */
+  bool Poll();
+
+  /**
+   * Wait for the job passed to Start() to finish and discard its
+   * result.  After this, the caller may free fans.
+   */
+  void Wait();
+
+private:
+  /* virtual methods from class StandbyThread */
+  void Tick() override;
+};
+
+#endif
@@ -37,11 +37,17 @@ RouteComputer::RouteComputer(const Airspaces &airspace_database,
    terrain(NULL)
 {}
 
+RouteComputer::~RouteComputer()
+{
+  reach_thread.LockStop();
+}
+
 void
 RouteComputer::ResetFlight()
 {
   route_clock.Reset();
   reach_clock.Reset();
+  reach_thread.Wait();
   protected_route_planner.Reset();
 
   last_task_type = TaskType::NONE;
@@ -133,10 +139,35 @@ RouteComputer::Reach(const MoreData &basic, DerivedInfo &calculated,
     /* without valid terrain information, we cannot calculate
        reachabilty, so let's skip that step completely */
     calculated.terrain_base_valid = false;
+    reach_thread.Wait();
     protected_route_planner.ClearReach();
     return;
   }
 
+  if (reach_thread.Poll()) {
+    /* publish the new solution; the old fans are moved to the
+       thread, which frees them when it solves the next one */
+    ReachSolution &solution = reach_thread.GetSolution();
+    const bool coarse = solution.coarse;
+    protected_route_planner.AcceptReach(solution);
+
+    if (reach_do_solve) {
+      calculated.terrain_base = route_planner.GetTerrainBase();
+      calculated.terrain_base_valid = true;
+    }
+
+    if (coarse) {
+      /* now refine the coarse solution with the same parameters */
+      reach_thread.Start(terrain, reach_origin, reach_do_solve, false);
+      return;
+    }
+  }
+
+  if (reach_thread.IsRunning())
+    /* the previous solution is still being calculated; keep showing
+       the one before */
+    return;
+
   const bool do_solve = config.IsReachEnabled() && terrain != NULL;
 
   const AircraftState state = ToAircraftState(basic, calculated);
@@ -145,17 +176,22 @@ RouteComputer::Reach(const MoreData &basic, DerivedInfo &calculated,
                                (int)calculated.common_stats.height_max_working));
 
   if (reach_clock.CheckAdvance(basic.time, PERIOD)) {
-    protected_route_planner.SolveReach(start, config, h_ceiling, do_solve);
-
-    if (do_solve) {
-      calculated.terrain_base = route_planner.GetTerrainBase();
-      calculated.terrain_base_valid = true;
-    }
+    /* if nothing has been published yet, start with a quick coarse
+       pass, so the map does not stay empty for long; later updates
+       replace a refined solution with another refined one */
+    const bool coarse = route_planner.IsTerrainReachEmpty();
+
+    route_planner.PrepareReach(reach_thread.GetSolution(),
+                               start, config, h_ceiling);
+    reach_origin = start;
+    reach_do_solve = do_solve;
+    reach_thread.Start(terrain, start, do_solve, coarse);
   }
 }
 
 void
 RouteComputer::set_terrain(const RasterTerrain* _terrain) {
+  reach_thread.Wait();
   terrain = _terrain;
   protected_route_planner.SetTerrain(terrain);
 }
@@ -24,6 +24,7 @@ Copyright_License {
 #ifndef XCSOAR_ROUTE_COMPUTER_HPP
 #define XCSOAR_ROUTE_COMPUTER_HPP
 
+#include "ReachSolverThread.hpp"
 #include "Task/ProtectedRoutePlanner.hpp"
 #include "Engine/Task/TaskType.hpp"
 #include "Engine/Route/RoutePlanner.hpp"
@@ -46,6 +47,20 @@ class RouteComputer {
   GPSClock route_clock;
   GPSClock reach_clock;
 
+  /**
+   * Calculates the reach fans in background.  A solution is
+   * published with RoutePlanner::AcceptReach() as soon as it is
+   * finished.
+   */
+  ReachSolverThread reach_thread;
+
+  /**
+   * The parameters of the job which was last passed to
+   * #reach_thread, for refining a coarse solution.
+   */
+  AGeoPoint reach_origin;
+  bool reach_do_solve = false;
+
   const RasterTerrain *terrain;
 
   TaskType last_task_type;
@@ -54,6 +69,7 @@ class RouteComputer {
 public:
   RouteComputer(const Airspaces &airspace_database,
                 const ProtectedAirspaceWarningManager *warnings);
+  ~RouteComputer();
 
   /**
    * Returns a reference to the unprotected route planner object,
@@ -72,6 +88,7 @@ public:
    * container.  Call this before modifying the container.
    */
   void ClearAirspaces() {
+    reach_thread.Wait();
     route_planner.Reset();
   }
 
@@ -0,0 +1,172 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#include "StageSampler.hpp"
+#include "StageTimer.hpp"
+#include "Thread/Thread.hpp"
+#include "Thread/Mutex.hpp"
+#include "Thread/Cond.hxx"
+#include "IO/FileOutputStream.hxx"
+#include "IO/BufferedOutputStream.hxx"
+
+#include <algorithm>
+
+#include <assert.h>
+#include <time.h>
+#include <stdint.h>
+
+namespace StageSampler {
+
+struct Record {
+  /**
+   * The UNIX time stamp of the second covered by this record.
+   */
+  uint32_t time;
+
+  /**
+   * The number of samples in which each stage was active; at
+   * most #SAMPLE_RATE.
+   */
+  uint8_t busy[unsigned(StageTimer::Stage::COUNT)];
+};
+
+class SamplerThread final : public Thread {
+  Mutex mutex;
+  Cond cond;
+  bool stop = false;
+
+  Record records[N_RECORDS];
+
+  /**
+   * The index in #records where the next record will be stored.
+   */
+  unsigned position = 0;
+
+  /**
+   * The number of valid records, at most #N_RECORDS.
+   */
+  unsigned n_records = 0;
+
+public:
+  SamplerThread():Thread("StageSampler") {}
+
+  void BeginStop() {
+    const ScopeLock protect(mutex);
+    stop = true;
+    cond.signal();
+  }
+
+  void Save(BufferedOutputStream &writer);
+
+protected:
+  /* virtual methods from class Thread */
+  void Run() override;
+};
+
+static SamplerThread *thread;
+
+}
+
+void
+StageSampler::SamplerThread::Run()
+{
+  const ScopeLock protect(mutex);
+
+  while (!stop) {
+    Record record;
+    record.time = uint32_t(time(nullptr));
+    std::fill_n(record.busy, unsigned(StageTimer::Stage::COUNT), 0);
+
+    for (unsigned i = 0; i < SAMPLE_RATE && !stop; ++i) {
+      cond.timed_wait(mutex, 1000 / SAMPLE_RATE);
+
+      const uint32_t mask = StageTimer::GetActiveMask();
+      for (unsigned j = 0; j < unsigned(StageTimer::Stage::COUNT); ++j)
+        if (mask & (1u << j))
+          ++record.busy[j];
+    }
+
+    records[position] = record;
+    position = (position + 1) % N_RECORDS;
+    if (n_records < N_RECORDS)
+      ++n_records;
+  }
+}
+
+void
+StageSampler::SamplerThread::Save(BufferedOutputStream &writer)
+{
+  const ScopeLock protect(mutex);
+
+  writer.Write("time");
+  for (unsigned j = 0; j < unsigned(StageTimer::Stage::COUNT); ++j)
+    writer.Format(",%s", StageTimer::GetName(StageTimer::Stage(j)));
+  writer.Write('\n');
+
+  for (unsigned i = 0; i < n_records; ++i) {
+    const Record &record =
+      records[(position + N_RECORDS - n_records + i) % N_RECORDS];
+
+    writer.Format("%lu", (unsigned long)record.time);
+    for (unsigned j = 0; j < unsigned(StageTimer::Stage::COUNT); ++j)
+      writer.Format(",%u", record.busy[j] * 100u / SAMPLE_RATE);
+    writer.Write('\n');
+  }
+}
+
+void
+StageSampler::Start()
+{
+  assert(thread == nullptr);
+
+  thread = new SamplerThread();
+  if (!thread->Start()) {
+    delete thread;
+    thread = nullptr;
+  }
+}
+
+void
+StageSampler::Stop()
+{
+  if (thread == nullptr)
+    return;
+
+  thread->BeginStop();
+  thread->Join();
+  delete thread;
+  thread = nullptr;
+}
+
+void
+StageSampler::Save(Path path)
+{
+  if (thread == nullptr)
+    return;
+
+  FileOutputStream file(path);
+  BufferedOutputStream writer(file);
+  thread->Save(writer);
+  writer.Flush();
+  file.Commit();
+}
@@ -0,0 +1,72 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#ifndef XCSOAR_STAGE_SAMPLER_HPP
+#define XCSOAR_STAGE_SAMPLER_HPP
+
+class Path;
+
+/**
+ * A low-overhead sampling profiler.  A background thread samples
+ * StageTimer::GetActiveMask() #SAMPLE_RATE times per second and
+ * condenses the samples into one record per second, which is kept
+ * in a ring buffer covering the last #N_RECORDS seconds.  Each
+ * record tells how busy each #StageTimer::Stage (and thus its
+ * thread) was during that second.
+ */
+namespace StageSampler {
+
+/**
+ * The number of samples per second.
+ */
+static constexpr unsigned SAMPLE_RATE = 20;
+
+/**
+ * The size of the ring buffer [records = seconds].
+ */
+static constexpr unsigned N_RECORDS = 4 * 3600;
+
+void
+Start();
+
+/**
+ * Stop the thread and discard the collected records.
+ */
+void
+Stop();
+
+/**
+ * Write the ring buffer to a CSV file: one line per second with
+ * the UNIX time stamp and the percentage of samples in which each
+ * stage was active.
+ *
+ * This is a no-op if the sampler is not running.
+ *
+ * Throws std::runtime_error on error.
+ */
+void
+Save(Path path);
+
+}
+
+#endif
@@ -0,0 +1,229 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#include "StageTimer.hpp"
+#include "Thread/Mutex.hpp"
+#include "LogFile.hpp"
+#include "Util/StringAPI.hxx"
+
+#include <algorithm>
+#include <atomic>
+
+#include <assert.h>
+#include <stdio.h>
+
+namespace StageTimer {
+
+static constexpr const char *const names[] = {
+  "calculation",
+  "gps",
+  "idle",
+  "air_data",
+  "task",
+  "route",
+  "contest",
+  "warning",
+  "stats",
+  "merge",
+  "draw",
+  "terrain",
+  "topography",
+  "device",
+};
+
+static_assert(sizeof(names) / sizeof(names[0]) == unsigned(Stage::COUNT),
+              "Wrong number of stage names");
+
+struct StageData {
+  unsigned long count;
+
+  /**
+   * A ring buffer of the most recent samples [us].
+   */
+  uint32_t window[WINDOW_SIZE];
+
+  /**
+   * The index in #window where the next sample will be stored.
+   */
+  unsigned position;
+
+  unsigned last, max;
+
+  uint64_t total;
+
+  unsigned long histogram[N_BUCKETS];
+};
+
+static Mutex mutex;
+static StageData stages[unsigned(Stage::COUNT)];
+
+static_assert(unsigned(Stage::COUNT) <= 32, "Too many stages for the mask");
+
+/**
+ * The number of threads which are currently inside each stage.
+ */
+static std::atomic<unsigned> active[unsigned(Stage::COUNT)];
+
+gcc_const
+static unsigned
+GetBucket(unsigned duration_us)
+{
+  unsigned ms = duration_us / 1000;
+  unsigned bucket = 0;
+  while (ms > 0 && bucket < N_BUCKETS - 1) {
+    ms >>= 1;
+    ++bucket;
+  }
+
+  return bucket;
+}
+
+}
+
+const char *
+StageTimer::GetName(Stage stage)
+{
+  assert(stage < Stage::COUNT);
+
+  return names[unsigned(stage)];
+}
+
+bool
+StageTimer::FindByName(const char *name, Stage &stage)
+{
+  for (unsigned i = 0; i < unsigned(Stage::COUNT); ++i) {
+    if (StringIsEqual(names[i], name)) {
+      stage = Stage(i);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void
+StageTimer::Add(Stage stage, unsigned duration_us)
+{
+  assert(stage < Stage::COUNT);
+
+  const ScopeLock protect(mutex);
+
+  StageData &data = stages[unsigned(stage)];
+  ++data.count;
+  data.window[data.position] = duration_us;
+  data.position = (data.position + 1) % WINDOW_SIZE;
+  data.last = duration_us;
+  data.max = std::max(data.max, duration_us);
+  data.total += duration_us;
+  ++data.histogram[GetBucket(duration_us)];
+}
+
+StageTimer::Summary
+StageTimer::GetSummary(Stage stage)
+{
+  assert(stage < Stage::COUNT);
+
+  uint32_t window[WINDOW_SIZE];
+  unsigned n;
+
+  Summary summary;
+
+  {
+    const ScopeLock protect(mutex);
+
+    const StageData &data = stages[unsigned(stage)];
+    summary.count = data.count;
+    summary.last = data.last;
+    summary.max = data.max;
+    summary.total = data.total;
+    std::copy_n(data.histogram, N_BUCKETS, summary.histogram);
+
+    n = std::min<unsigned long>(data.count, WINDOW_SIZE);
+    std::copy_n(data.window, n, window);
+  }
+
+  if (n == 0) {
+    summary.mean = summary.p99 = summary.window_max = 0;
+    return summary;
+  }
+
+  uint64_t sum = 0;
+  for (unsigned i = 0; i < n; ++i)
+    sum += window[i];
+  summary.mean = unsigned(sum / n);
+
+  const unsigned p99_index = (n * 99 - 1) / 100;
+  std::nth_element(window, window + p99_index, window + n);
+  summary.p99 = window[p99_index];
+  summary.window_max = *std::max_element(window + p99_index, window + n);
+
+  return summary;
+}
+
+void
+StageTimer::Log()
+{
+  for (unsigned i = 0; i < unsigned(Stage::COUNT); ++i) {
+    const Summary s = GetSummary(Stage(i));
+    if (s.count == 0)
+      continue;
+
+    char histogram[N_BUCKETS * 12];
+    size_t length = 0;
+    for (unsigned j = 0; j < N_BUCKETS && length < sizeof(histogram); ++j)
+      length += snprintf(histogram + length, sizeof(histogram) - length,
+                         " %lu", s.histogram[j]);
+
+    LogFormat("StageTimer '%s': count=%lu mean=%u p99=%u max=%u"
+              " histogram:%s",
+              names[i], s.count, s.mean, s.p99, s.max, histogram);
+  }
+}
+
+void
+StageTimer::Enter(Stage stage)
+{
+  assert(stage < Stage::COUNT);
+
+  active[unsigned(stage)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void
+StageTimer::Leave(Stage stage)
+{
+  assert(stage < Stage::COUNT);
+  assert(active[unsigned(stage)] > 0);
+
+  active[unsigned(stage)].fetch_sub(1, std::memory_order_relaxed);
+}
+
+uint32_t
+StageTimer::GetActiveMask()
+{
+  uint32_t mask = 0;
+  for (unsigned i = 0; i < unsigned(Stage::COUNT); ++i)
+    if (active[i].load(std::memory_order_relaxed) > 0)
+      mask |= 1u << i;
+
+  return mask;
+}
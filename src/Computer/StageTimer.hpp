@@ -0,0 +1,209 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#ifndef XCSOAR_STAGE_TIMER_HPP
+#define XCSOAR_STAGE_TIMER_HPP
+
+#include "OS/Clock.hpp"
+#include "Compiler.h"
+
+#include <stdint.h>
+
+/**
+ * Run time statistics for the processing stages of the calculation
+ * thread, the merge thread and the map renderer.  Each stage records
+ * the duration of every invocation; the statistics can be obtained
+ * with GetSummary() and may be written to the log file with Log().
+ *
+ * This library is thread-safe.
+ */
+namespace StageTimer {
+
+enum class Stage : uint8_t {
+  /** CalculationThread::Tick() */
+  CALCULATION,
+
+  /** GlideComputer::ProcessGPS() */
+  GPS,
+
+  /** GlideComputer::ProcessIdle() */
+  IDLE,
+
+  /** GlideComputerAirData::ProcessBasic() */
+  AIR_DATA,
+
+  /** TaskComputer::ProcessBasicTask() */
+  TASK,
+
+  /** RouteComputer::ProcessRoute() */
+  ROUTE,
+
+  /** ContestComputer::Solve() and SolveExhaustive() */
+  CONTEST,
+
+  /** WarningComputer::Update() */
+  WARNING,
+
+  /** StatsComputer::DoLogging() */
+  STATS,
+
+  /** MergeThread::Process() */
+  MERGE,
+
+  /** rendering the main map */
+  DRAW,
+
+  /** TerrainThread::Tick() */
+  TERRAIN,
+
+  /** TopographyThread::Tick() */
+  TOPOGRAPHY,
+
+  /** DeviceDescriptor::DataReceived(), i.e. the port threads */
+  DEVICE,
+
+  COUNT
+};
+
+/**
+ * The number of most recent samples which are used to calculate the
+ * mean and the 99th percentile.
+ */
+static constexpr unsigned WINDOW_SIZE = 100;
+
+/**
+ * The number of histogram buckets.  The first bucket counts samples
+ * below 1 ms, the bucket i counts samples in the range
+ * [2^(i-1), 2^i) ms, and the last one counts everything above.
+ */
+static constexpr unsigned N_BUCKETS = 12;
+
+struct Summary {
+  /**
+   * The total number of samples.  All other attributes are
+   * meaningless if this is zero.
+   */
+  unsigned long count;
+
+  /**
+   * The duration [us] of the most recent invocation.
+   */
+  unsigned last;
+
+  /**
+   * The mean, the 99th percentile and the maximum duration [us]
+   * within the last #WINDOW_SIZE samples.
+   */
+  unsigned mean, p99, window_max;
+
+  /**
+   * The maximum duration [us] since startup.
+   */
+  unsigned max;
+
+  /**
+   * The sum of all durations [us] since startup.
+   */
+  uint64_t total;
+
+  /**
+   * The number of samples in each duration bucket since startup.
+   */
+  unsigned long histogram[N_BUCKETS];
+};
+
+/**
+ * Returns a short name for the stage, to be used in the log file and
+ * in Lua.
+ */
+gcc_const
+const char *
+GetName(Stage stage);
+
+/**
+ * Look up a stage by its name.
+ *
+ * @return true if the name was found
+ */
+gcc_pure
+bool
+FindByName(const char *name, Stage &stage);
+
+void
+Add(Stage stage, unsigned duration_us);
+
+gcc_pure
+Summary
+GetSummary(Stage stage);
+
+/**
+ * Write the statistics of all stages to the log file.
+ */
+void
+Log();
+
+/**
+ * Mark the beginning of a stage in the current thread.  Must be
+ * followed by Leave().  #ScopeStageTimer does this automatically.
+ */
+void
+Enter(Stage stage);
+
+void
+Leave(Stage stage);
+
+/**
+ * Returns a bit mask of the stages which are currently being
+ * executed by any thread (bit i = Stage(i)).  This is used by the
+ * #StageSampler.
+ */
+gcc_pure
+uint32_t
+GetActiveMask();
+
+}
+
+/**
+ * Measures the time from its construction to its destruction and
+ * adds it to the given stage.
+ */
+class ScopeStageTimer {
+  const StageTimer::Stage stage;
+  const uint64_t start;
+
+public:
+  explicit ScopeStageTimer(StageTimer::Stage _stage)
+    :stage(_stage), start(MonotonicClockUS()) {
+    StageTimer::Enter(stage);
+  }
+
+  ScopeStageTimer(const ScopeStageTimer &) = delete;
+  ScopeStageTimer &operator=(const ScopeStageTimer &) = delete;
+
+  ~ScopeStageTimer() {
+    StageTimer::Leave(stage);
+    StageTimer::Add(stage, unsigned(MonotonicClockUS() - start));
+  }
+};
+
+#endif
@@ -23,6 +23,7 @@ Copyright_License {
 */
 
 #include "TaskComputer.hpp"
+#include "StageTimer.hpp"
 #include "Task/ProtectedTaskManager.hpp"
 #include "Engine/Task/TaskManager.hpp"
 #include "Engine/Task/Ordered/OrderedTask.hpp"
@@ -109,10 +110,13 @@ TaskComputer::ProcessMoreTask(const MoreData &basic,
   const GlidePolar &glide_polar = settings_computer.polar.glide_polar_task;
   const GlidePolar &safety_polar = calculated.glide_polar_safety;
 
-  route.ProcessRoute(basic, calculated,
-                     settings_computer.task.glide,
-                     settings_computer.task.route_planner,
-                     glide_polar, safety_polar);
+  {
+    const ScopeStageTimer route_timer(StageTimer::Stage::ROUTE);
+    route.ProcessRoute(basic, calculated,
+                       settings_computer.task.glide,
+                       settings_computer.task.route_planner,
+                       glide_polar, safety_polar);
+  }
 
   if (settings_computer.features.block_stf_enabled)
     calculated.V_stf = calculated.common_stats.V_block;
@@ -146,25 +150,34 @@ Predicted(const ContestSettings &settings,
 }
 
 void
-TaskComputer::ProcessIdle(const MoreData &basic, DerivedInfo &calculated,
-                          const ComputerSettings &settings_computer,
-                          bool exhaustive)
+TaskComputer::ProcessIdleTask(const MoreData &basic,
+                              const DerivedInfo &calculated)
 {
-  contest.SetPredicted(Predicted(settings_computer.contest, basic,
-                                 calculated.task_stats.current_leg));
-
-  if (exhaustive)
-    contest.SolveExhaustive(settings_computer.contest,
-                            calculated.contest_stats);
-  else
-    contest.Solve(settings_computer.contest, calculated.contest_stats);
-
   const AircraftState as = ToAircraftState(basic, calculated);
 
   ProtectedTaskManager::ExclusiveLease _task(task);
   _task->UpdateIdle(as);
 }
 
+void
+TaskComputer::ProcessIdleContest(const MoreData &basic,
+                                 DerivedInfo &calculated,
+                                 const ComputerSettings &settings_computer,
+                                 bool exhaustive)
+{
+  contest.SetPredicted(Predicted(settings_computer.contest, basic,
+                                 calculated.task_stats.current_leg));
+
+  {
+    const ScopeStageTimer contest_timer(StageTimer::Stage::CONTEST);
+    if (exhaustive)
+      contest.SolveExhaustive(settings_computer.contest,
+                              calculated.contest_stats);
+    else
+      contest.Solve(settings_computer.contest, calculated.contest_stats);
+  }
+}
+
 void 
 TaskComputer::ProcessAutoTask(const NMEAInfo &basic,
                               const DerivedInfo &calculated)
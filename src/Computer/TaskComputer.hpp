@@ -101,9 +101,18 @@ public:
    */
   void ProcessAutoTask(const NMEAInfo &basic, const DerivedInfo &calculated);
 
-  void ProcessIdle(const MoreData &basic, DerivedInfo &calculated,
-                   const ComputerSettings &settings_computer,
-                   bool exhaustive=false);
+  /**
+   * Run the idle calculations of the task (e.g. optimise the AAT
+   * targets).
+   */
+  void ProcessIdleTask(const MoreData &basic, const DerivedInfo &calculated);
+
+  /**
+   * Continue the contest optimisation.
+   */
+  void ProcessIdleContest(const MoreData &basic, DerivedInfo &calculated,
+                          const ComputerSettings &settings_computer,
+                          bool exhaustive=false);
 };
 
 #endif
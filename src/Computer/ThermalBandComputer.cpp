@@ -55,7 +55,7 @@ ThermalBandComputer::Compute(const MoreData &basic,
       teb.AddSample(basic.time, h_thermal);
       in_encounter = true;
     } else if (in_encounter) {
-      tec.Merge(teb);
+      tec.Merge(teb, CLIMB_DECAY);
       teb.Reset();
       in_encounter = false;
     }
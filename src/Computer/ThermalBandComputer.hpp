@@ -38,6 +38,13 @@ struct ComputerSettings;
  * @see ThermalBandInfo
  */
 class ThermalBandComputer {
+  /**
+   * The weight of all previous climbs is multiplied by this factor
+   * when a new climb is merged, so the thermal band follows changing
+   * conditions during the day.
+   */
+  static constexpr double CLIMB_DECAY = 0.85;
+
   Validity last_vario_available;
 
 public:
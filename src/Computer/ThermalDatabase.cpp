@@ -0,0 +1,88 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#include "ThermalDatabase.hpp"
+#include "NMEA/ThermalLocator.hpp"
+
+ThermalSource
+ThermalRecord::ToSource() const
+{
+  ThermalSource source;
+  source.location = location;
+  source.ground_height = ground_height;
+  source.lift_rate = lift_rate;
+  source.time = time_of_day;
+  return source;
+}
+
+void
+ThermalDatabase::Clear()
+{
+  tree.clear();
+  projection.SetInvalid();
+}
+
+bool
+ThermalDatabase::Add(const ThermalRecord &record)
+{
+  if (!Append(record))
+    return false;
+
+  if (!tree.HaveBounds())
+    /* the new record was outside of the bounds, and the QuadTree has
+       been flattened */
+    tree.Optimise();
+
+  return true;
+}
+
+bool
+ThermalDatabase::Append(const ThermalRecord &_record)
+{
+  if (tree.size() >= MAX_SIZE)
+    return false;
+
+  if (!projection.IsValid())
+    projection.SetCenter(_record.location);
+
+  ThermalRecord record = _record;
+  record.flat_location = projection.ProjectInteger(record.location);
+  tree.Add(record);
+  return true;
+}
+
+const ThermalRecord *
+ThermalDatabase::FindNearest(const GeoPoint &location, double range) const
+{
+  if (IsEmpty())
+    return nullptr;
+
+  ThermalRecord key;
+  key.flat_location = projection.ProjectInteger(location);
+  const unsigned mrange = projection.ProjectRangeInteger(location, range);
+  const auto found = tree.FindNearest(key, mrange);
+  if (found.first == tree.end())
+    return nullptr;
+
+  return &*found.first;
+}
@@ -0,0 +1,175 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#ifndef XCSOAR_THERMAL_DATABASE_HPP
+#define XCSOAR_THERMAL_DATABASE_HPP
+
+#include "Geo/GeoPoint.hpp"
+#include "Geo/Flat/FlatGeoPoint.hpp"
+#include "Geo/Flat/FlatProjection.hpp"
+#include "Util/QuadTree.hpp"
+#include "Thread/Mutex.hpp"
+#include "Compiler.h"
+
+struct ThermalSource;
+
+/**
+ * One climb which was recorded in the #ThermalDatabase.
+ */
+struct ThermalRecord {
+  /** The estimated location of the thermal source on the ground */
+  GeoPoint location;
+
+  /** The terrain height at #location [m] */
+  double ground_height;
+
+  /** The altitude where the climb started and ended [m] */
+  double base, top;
+
+  /** The average climb rate [m/s] */
+  double lift_rate;
+
+  /** The UTC time of day when the climb ended [s] */
+  unsigned time_of_day;
+
+  /** #location projected by ThermalDatabase::Add() */
+  FlatGeoPoint flat_location;
+
+  /**
+   * Convert to a #ThermalSource, e.g. for drawing it on the map.
+   */
+  gcc_pure
+  ThermalSource ToSource() const;
+};
+
+/**
+ * A geo-indexed collection of all climbs, which survives the flight
+ * and may be saved to a file (see ThermalDatabaseGlue).  This allows
+ * showing the thermals of earlier flights at the same site.
+ *
+ * Callers must lock #mutex.
+ */
+class ThermalDatabase {
+  /**
+   * When this number of records is reached, new climbs are not
+   * added anymore.
+   */
+  static constexpr unsigned MAX_SIZE = 10000;
+
+  struct Accessor {
+    gcc_pure
+    int GetX(const ThermalRecord &record) const {
+      return record.flat_location.x;
+    }
+
+    gcc_pure
+    int GetY(const ThermalRecord &record) const {
+      return record.flat_location.y;
+    }
+  };
+
+  typedef QuadTree<ThermalRecord, Accessor> Tree;
+
+  /**
+   * The projection of all records; its center is the location of
+   * the first record.
+   */
+  FlatProjection projection;
+
+  Tree tree;
+
+public:
+  mutable Mutex mutex;
+
+  ThermalDatabase() {
+    projection.SetInvalid();
+  }
+
+  bool IsEmpty() const {
+    return tree.IsEmpty();
+  }
+
+  unsigned size() const {
+    return tree.size();
+  }
+
+  Tree::const_iterator begin() const {
+    return tree.begin();
+  }
+
+  Tree::const_iterator end() const {
+    return tree.end();
+  }
+
+  void Clear();
+
+  /**
+   * Add a climb.
+   *
+   * @return false if the database is full
+   */
+  bool Add(const ThermalRecord &record);
+
+  /**
+   * Like Add(), but don't rebuild the index.  Call Optimise() after
+   * adding many records in a row.
+   */
+  bool Append(const ThermalRecord &record);
+
+  /**
+   * Rebuild the index after Append().
+   */
+  void Optimise() {
+    tree.Optimise();
+  }
+
+  /**
+   * Call the given function for each record whose #location is
+   * within the given range.
+   *
+   * @param range the range [m]
+   */
+  template<typename V>
+  void VisitWithinRange(const GeoPoint &location, double range,
+                        V &&visitor) const {
+    if (IsEmpty())
+      return;
+
+    ThermalRecord key;
+    key.flat_location = projection.ProjectInteger(location);
+    const unsigned mrange = projection.ProjectRangeInteger(location, range);
+    tree.VisitWithinRange(key, mrange, visitor);
+  }
+
+  /**
+   * Find the record nearest to the given location.
+   *
+   * @param range the maximum range [m]
+   * @return the record or nullptr if there is none within the range
+   */
+  gcc_pure
+  const ThermalRecord *FindNearest(const GeoPoint &location,
+                                   double range) const;
+};
+
+#endif
@@ -0,0 +1,120 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#include "ThermalDatabaseGlue.hpp"
+#include "ThermalDatabase.hpp"
+#include "IO/FileLineReader.hpp"
+#include "IO/FileOutputStream.hxx"
+#include "IO/BufferedOutputStream.hxx"
+#include "OS/FileUtil.hpp"
+#include "OS/Path.hpp"
+#include "Util/NumberParser.hpp"
+#include "LogFile.hpp"
+
+#include <stdexcept>
+
+/*
+ * File format: one climb per line, separated by spaces:
+ *
+ *   latitude longitude ground_height base top lift_rate time_of_day
+ *
+ * The angles are in degrees, the altitudes in meters, the lift rate
+ * in m/s and the time in seconds since midnight UTC.
+ */
+
+static bool
+ParseLine(const char *line, ThermalRecord &record)
+{
+  char *endptr;
+
+  const double latitude = ParseDouble(line, &endptr);
+  if (endptr == line)
+    return false;
+
+  const char *p = endptr;
+  const double longitude = ParseDouble(p, &endptr);
+  if (endptr == p)
+    return false;
+
+  record.location = GeoPoint(Angle::Degrees(longitude),
+                             Angle::Degrees(latitude));
+  if (!record.location.Check())
+    return false;
+
+  double *const values[] = {
+    &record.ground_height, &record.base, &record.top, &record.lift_rate,
+  };
+
+  for (double *value : values) {
+    p = endptr;
+    *value = ParseDouble(p, &endptr);
+    if (endptr == p)
+      return false;
+  }
+
+  p = endptr;
+  record.time_of_day = ParseUnsigned(p, &endptr);
+  return endptr != p;
+}
+
+void
+ThermalDatabaseGlue::Load(ThermalDatabase &database, Path path)
+try {
+  if (!File::Exists(path))
+    return;
+
+  FileLineReaderA reader(path);
+
+  const char *line;
+  while ((line = reader.ReadLine()) != nullptr) {
+    ThermalRecord record;
+    if (ParseLine(line, record) && !database.Append(record))
+      break;
+  }
+
+  database.Optimise();
+
+  LogFormat("Loaded %u climbs from the thermal database",
+            database.size());
+} catch (const std::runtime_error &e) {
+  LogError(e);
+}
+
+void
+ThermalDatabaseGlue::Save(const ThermalDatabase &database, Path path)
+try {
+  FileOutputStream file(path);
+  BufferedOutputStream os(file);
+
+  for (const ThermalRecord &record : database)
+    os.Format("%f %f %.0f %.0f %.0f %.2f %u\n",
+              record.location.latitude.Degrees(),
+              record.location.longitude.Degrees(),
+              record.ground_height, record.base, record.top,
+              record.lift_rate, record.time_of_day);
+
+  os.Flush();
+  file.Commit();
+} catch (const std::runtime_error &e) {
+  LogError(e);
+}
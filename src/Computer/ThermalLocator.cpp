@@ -146,6 +146,14 @@ ThermalLocator::Process(const bool circling, const double time,
                         const SpeedVector wind, ThermalLocatorInfo& therm)
 {
   if (circling) {
+    if (n_points > 0) {
+      const double last_time =
+        points[(n_index + TLOCATOR_NMAX - 1) % TLOCATOR_NMAX].t_0;
+      if (time >= last_time && time < last_time + MIN_SAMPLE_INTERVAL)
+        /* too soon; keep the previous estimate */
+        return;
+    }
+
     AddPoint(time, location, w);
     Update(time, location, wind, therm);
   } else {
@@ -40,6 +40,14 @@ public:
   static constexpr unsigned TLOCATOR_NMIN = 5;
   static constexpr unsigned TLOCATOR_NMAX = 60;
 
+  /**
+   * The minimum time between two samples [s].  With a high-rate GPS,
+   * the buffer would otherwise cover only a fraction of a circle,
+   * and each update would be more expensive without improving the
+   * estimate.
+   */
+  static constexpr double MIN_SAMPLE_INTERVAL = 0.9;
+
 private:
   /** Class used to hold thermal estimate samples */
   struct Point 
@@ -26,6 +26,7 @@ Copyright_License {
 #include "NMEA/MoreData.hpp"
 #include "NMEA/Derived.hpp"
 #include "Asset.hpp"
+#include "Util/AllocationStats.hpp"
 
 static constexpr unsigned full_trace_size =
   HasLittleMemory() ? 512 : 1024;
@@ -78,6 +79,8 @@ void
 TraceComputer::Update(const ComputerSettings &settings_computer,
                       const MoreData &basic, const DerivedInfo &calculated)
 {
+  const ScopeAllocationTag alloc_tag(AllocationTag::TRACE);
+
   /* time warps are handled by the Trace class */
 
   if (!basic.time_available || !basic.location_available ||
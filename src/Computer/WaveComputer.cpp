@@ -28,6 +28,7 @@ Copyright_License {
 #include "NMEA/FlyingState.hpp"
 #include "Geo/Flat/FlatPoint.hpp"
 #include "Geo/Flat/FlatLine.hpp"
+#include "Engine/Trace/Vector.hpp"
 
 void
 WaveComputer::Initialise()
@@ -324,8 +325,57 @@ WaveComputer::Compute(const NMEAInfo &basic,
     /* throttle */
     return;
 
-  const auto vario = basic.netto_vario;
+  const double time = basic.time_available ? basic.time : 0;
 
+  Feed(time, basic.location, basic.netto_vario, dt);
+
+  if (basic.time_available)
+    /* forget all waves which are older than 8 hours */
+    Decay(basic.time - 8 * 3600);
+
+  FillResult(result, time);
+
+  /* remember some data for the next iteration */
+  last_location_available = basic.location_available;
+  last_netto_vario_available = netto_vario_available;
+}
+
+void
+WaveComputer::ComputeTrace(const TracePointVector &trace, WaveResult &result)
+{
+  Initialise();
+
+  DeltaTime trace_delta_time;
+  trace_delta_time.Reset();
+
+  double time = 0;
+  for (const TracePoint &point : trace) {
+    time = point.GetTime();
+
+    const auto dt = trace_delta_time.Update(time, 0.5, 20);
+    if (dt < 0) {
+      /* time warp: the trace is not sorted, start over */
+      ResetCurrent();
+      continue;
+    }
+
+    if (dt <= 0)
+      /* throttle */
+      continue;
+
+    Feed(time, point.GetLocation(), point.GetVario(), dt);
+  }
+
+  FillResult(result, time);
+
+  /* mark the live calculation as uninitialised */
+  last_enabled = false;
+}
+
+void
+WaveComputer::Feed(double time, const GeoPoint &location,
+                   const double vario, const double dt)
+{
   constexpr double threshold(0.5);
   if (vario > threshold) {
     /* positive vario value - feed it to the #LeastSquares instance */
@@ -333,9 +383,9 @@ WaveComputer::Compute(const NMEAInfo &basic,
     if (ls.IsEmpty())
       /* initialise the projection each time we inspect a new wave
          "candidate" */
-      projection.SetCenter(basic.location);
+      projection.SetCenter(location);
 
-    auto flat = projection.ProjectFloat(basic.location);
+    auto flat = projection.ProjectFloat(location);
     ls.Update(flat.x, flat.y, vario - threshold / 2);
   }
 
@@ -351,8 +401,7 @@ WaveComputer::Compute(const NMEAInfo &basic,
     if (ls.GetCount() > 30) {
       /* we've been lifting in the wave for some time; see if we
          really spotted a wave */
-      const WaveInfo wave = GetWaveInfo(ls, projection,
-                                        basic.time_available ? basic.time : 0);
+      const WaveInfo wave = GetWaveInfo(ls, projection, time);
       if (wave.IsDefined())
         /* yes, spotted a wave: copy it from the #LeastSquares
            instance to the list of waves */
@@ -361,19 +410,16 @@ WaveComputer::Compute(const NMEAInfo &basic,
 
     ls.Reset();
   }
+}
 
-  if (basic.time_available)
-    /* forget all waves which are older than 8 hours */
-    Decay(basic.time - 8 * 3600);
-
-  /* fill the #WaveResult */
-
+void
+WaveComputer::FillResult(WaveResult &result, double time) const
+{
   result.Clear();
 
   /* first copy the wave that is currently being calculated (partial
      data) */
-  WaveInfo wave = GetWaveInfo(ls, projection,
-                              basic.time_available ? basic.time : 0);
+  WaveInfo wave = GetWaveInfo(ls, projection, time);
   if (wave.IsDefined())
     result.waves.push_back(wave);
 
@@ -381,8 +427,4 @@ WaveComputer::Compute(const NMEAInfo &basic,
   for (auto i = waves.begin(), end = waves.end();
        i != end && !result.waves.full(); ++i)
     result.waves.push_back(*i);
-
-  /* remember some data for the next iteration */
-  last_location_available = basic.location_available;
-  last_netto_vario_available = netto_vario_available;
 }
@@ -36,6 +36,7 @@ Copyright_License {
 struct NMEAInfo;
 struct FlyingState;
 struct WaveSettings;
+class TracePointVector;
 
 /**
  * Detect wave locations.
@@ -86,6 +87,16 @@ public:
                WaveResult &result,
                const WaveSettings &settings);
 
+  /**
+   * Detect all waves in a complete trace in one pass, e.g. for
+   * post-flight analysis.  This discards the state of the live
+   * calculation; call Reset() afterwards to resume Compute().
+   *
+   * The trace is assumed to contain only free flight, and the
+   * #TracePoint vario is used as netto vario.
+   */
+  void ComputeTrace(const TracePointVector &trace, WaveResult &result);
+
 private:
   void Initialise();
 
@@ -100,6 +111,19 @@ private:
   void Decay(double min_time);
 
   void FoundWave(const WaveInfo &new_wave);
+
+  /**
+   * Feed one sample into the current wave calculation.
+   *
+   * @param dt the time since the previous sample [s]
+   */
+  void Feed(double time, const GeoPoint &location, double netto_vario,
+            double dt);
+
+  /**
+   * Copy the current wave and the detected waves to #result.
+   */
+  void FillResult(WaveResult &result, double time) const;
 };
 
 #endif
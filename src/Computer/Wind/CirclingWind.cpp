@@ -118,7 +118,11 @@ CirclingWind::NewSample(const MoreData &info, const CirclingInfo &circling)
     //to determine the quality)
   }
 
-  if (!samples.full()) {
+  if (!samples.empty() && info.clock >= samples.back().time &&
+      info.clock < samples.back().time + MIN_SAMPLE_INTERVAL) {
+    /* too soon after the previous sample; the circle detection
+       above still sees every fix */
+  } else if (!samples.full()) {
     Sample &sample = samples.append();
     sample.time = info.clock;
     sample.vector = SpeedVector(info.track, info.ground_speed);
@@ -60,6 +60,12 @@ class CirclingWind
 
   Angle last_track;
 
+  /**
+   * The minimum time between two samples [s].  With a high-rate GPS,
+   * a circle would otherwise not fit into #samples.
+   */
+  static constexpr double MIN_SAMPLE_INTERVAL = 0.9;
+
   StaticArray<Sample, 50> samples;
 
 public:
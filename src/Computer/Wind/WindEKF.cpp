@@ -29,7 +29,8 @@ Copyright_License {
 #define WIND_K1 1.0e-5f
 
 void
-WindEKF::Update(const double airspeed, const float gps_vel[2])
+WindEKF::Update(const double airspeed, const float gps_vel[2],
+                const float dt)
 {
   // airsp = sf * | gps_v - wind_v |
   const float dx = gps_vel[0]-X[0];
@@ -37,11 +38,11 @@ WindEKF::Update(const double airspeed, const float gps_vel[2])
   const float mag = hypotf(dx, dy);
 
   const float K[3] = {
-    -X[2]*dx/mag*k,
-    -X[2]*dy/mag*k,
-    mag*WIND_K1
+    -X[2]*dx/mag*k*dt,
+    -X[2]*dy/mag*k*dt,
+    mag*WIND_K1*dt
   };
-  k += 0.01f*(WIND_K0-k);
+  k += 0.01f*dt*(WIND_K0-k);
   
   // measurement equation
   const float Error = (float)airspeed - X[2]*mag;
@@ -30,7 +30,15 @@ class WindEKF {
 
 public:
   void Init();
-  void Update(double airspeed, const float gps_vel[2]);
+
+  /**
+   * Feed one sample into the filter.
+   *
+   * @param dt the time since the previous sample [s]; the gains are
+   * scaled with it, so the filter converges at the same speed
+   * regardless of the sample rate
+   */
+  void Update(double airspeed, const float gps_vel[2], float dt=1);
   const float* get_state() const { return X; };
 };
 
@@ -27,25 +27,28 @@ Copyright_License {
 #include "NMEA/Info.hpp"
 #include "NMEA/Derived.hpp"
 
+#include <algorithm>
+
 void
 WindEKFGlue::Reset()
 {
   reset_pending = true;
   last_ground_speed_available.Clear();
   last_airspeed_available.Clear();
-  i = 0;
+  last_time = -1;
+  elapsed = 0;
 
   ResetBlackout();
 }
 
 static constexpr unsigned
-CounterToQuality(unsigned i)
+ElapsedToQuality(double elapsed)
 {
-  return i >= 600u
+  return elapsed >= 600
     ? 4u
-    : (i >= 120u
+    : (elapsed >= 120
        ? 3u
-       : (i >= 30u
+       : (elapsed >= 30
           ? 2u
           : 1u));
 }
@@ -85,7 +88,7 @@ WindEKFGlue::Update(const NMEAInfo &basic, const DerivedInfo &derived)
   if (derived.circling)
     /* reset the counter so the first wind estimate after circling
        ends is delayed for another 10 seconds */
-    i = 0;
+    elapsed = 0;
 
   unsigned time(basic.clock);
   if (derived.turn_rate.Absolute() > Angle::Degrees(20) ||
@@ -116,16 +119,25 @@ WindEKFGlue::Update(const NMEAInfo &basic, const DerivedInfo &derived)
     ekf.Init();
   }
 
-  ekf.Update(V, gps_vel);
+  /* with a high-rate GPS, each sample gets a smaller weight; gaps
+     (e.g. after a blackout) count as one second at most */
+  const double dt = last_time >= 0 && basic.clock > last_time
+    ? std::min(basic.clock - last_time, 1.)
+    : 1.;
+  last_time = basic.clock;
+
+  ekf.Update(V, gps_vel, (float)dt);
 
-  ++i;
-  if (i % 10 != 0)
+  const double previous = elapsed;
+  elapsed += dt;
+  /* the epsilon tolerates clock jitter at 1 Hz */
+  if (unsigned((elapsed + 0.05) / 10) == unsigned((previous + 0.05) / 10))
     return Result(0);
 
   const float* x = ekf.get_state();
 
   Result res;
-  res.quality = CounterToQuality(i);
+  res.quality = ElapsedToQuality(elapsed);
   res.wind = SpeedVector(-x[0], -x[1]);
 
   return res;
@@ -56,10 +56,17 @@ class WindEKFGlue
   Validity last_ground_speed_available, last_airspeed_available;
 
   /**
-   * The number of samples we have fed into the #WindEKF.  This is
-   * used to determine the quality.
+   * The #NMEAInfo::clock of the last sample fed into the #WindEKF;
+   * negative if there was none yet.
    */
-  unsigned i;
+  double last_time;
+
+  /**
+   * The accumulated sample time [s] fed into the #WindEKF.  This is
+   * used to determine the quality, and a result is returned each
+   * time it crosses a multiple of 10 seconds.
+   */
+  double elapsed;
 
   unsigned time_blackout;
 
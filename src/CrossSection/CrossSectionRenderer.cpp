@@ -42,7 +42,8 @@ CrossSectionRenderer::CrossSectionRenderer(const CrossSectionLook &_look,
     :inverse(_inverse), look(_look), chart_look(_chart_look), airspace_renderer(_airspace_look),
    terrain_renderer(look), terrain(NULL), airspace_database(NULL),
    start(GeoPoint::Invalid()),
-   vec(50000, Angle::Zero()) {}
+   vec(50000, Angle::Zero()),
+   elevations_start(GeoPoint::Invalid()) {}
 
 void
 CrossSectionRenderer::ReadBlackboard(const MoreData &_gps_info,
@@ -84,8 +85,7 @@ CrossSectionRenderer::Paint(Canvas &canvas, const PixelRect rc) const
   chart.ScaleYFromValue(hmin);
   chart.ScaleYFromValue(hmax);
 
-  TerrainHeight elevations[NUM_SLICES];
-  UpdateTerrain(elevations);
+  const TerrainHeight *elevations = UpdateTerrain();
 
   if (airspace_database != nullptr) {
     const AircraftState aircraft = ToAircraftState(Basic(), Calculated());
@@ -104,24 +104,43 @@ CrossSectionRenderer::Paint(Canvas &canvas, const PixelRect rc) const
   PaintGrid(canvas, chart);
 }
 
-void
-CrossSectionRenderer::UpdateTerrain(TerrainHeight *elevations) const
+const TerrainHeight *
+CrossSectionRenderer::UpdateTerrain() const
 {
   if (terrain == NULL) {
     const auto invalid = TerrainHeight::Invalid();
     std::fill_n(elevations, NUM_SLICES, invalid);
-    return;
+    elevations_start.SetInvalid();
+    return elevations;
   }
 
-  const GeoPoint point_diff = vec.EndPoint(start) - start;
+  const GeoPoint end = vec.EndPoint(start);
 
   RasterTerrain::Lease map(*terrain);
+
+  /* while the aircraft moves by less than a quarter slice, the old
+     profile is still accurate enough */
+  const double tolerance = vec.distance / (4 * (NUM_SLICES - 1));
+  if (elevations_start.IsValid() &&
+      map->GetSerial() == elevations_serial &&
+      start.DistanceS(elevations_start) < tolerance &&
+      end.DistanceS(elevations_end) < tolerance)
+    return elevations;
+
+  const GeoPoint point_diff = end - start;
+
+  GeoPoint slice_points[NUM_SLICES];
   for (unsigned i = 0; i < NUM_SLICES; ++i) {
     const auto slice_distance_factor = double(i) / (NUM_SLICES - 1);
-    const GeoPoint slice_point = start + point_diff * slice_distance_factor;
-
-    elevations[i] = map->GetHeight(slice_point);
+    slice_points[i] = start + point_diff * slice_distance_factor;
   }
+
+  map->GetHeights({slice_points, NUM_SLICES}, elevations);
+
+  elevations_start = start;
+  elevations_end = end;
+  elevations_serial = map->GetSerial();
+  return elevations;
 }
 
 void
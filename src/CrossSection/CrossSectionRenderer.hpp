@@ -29,6 +29,7 @@
 #include "AirspaceXSRenderer.hpp"
 #include "Engine/GlideSolvers/GlideSettings.hpp"
 #include "Engine/GlideSolvers/GlidePolar.hpp"
+#include "Util/Serial.hpp"
 
 struct PixelRect;
 struct MoreData;
@@ -72,6 +73,14 @@ protected:
   /** Range and direction of the CrossSection */
   GeoVector vec;
 
+  /**
+   * The terrain profile filled by UpdateTerrain(), and the geometry
+   * and terrain version it was sampled for.
+   */
+  mutable TerrainHeight elevations[NUM_SLICES];
+  mutable GeoPoint elevations_start, elevations_end;
+  mutable Serial elevations_serial;
+
 public:
   /**
    * Constructor. Initializes most class members.
@@ -108,6 +117,7 @@ public:
    */
   void SetTerrain(const RasterTerrain *_terrain) {
     terrain = _terrain;
+    elevations_start.SetInvalid();
   }
 
   /**
@@ -140,7 +150,12 @@ public:
   }
 
 protected:
-  void UpdateTerrain(TerrainHeight *elevations) const;
+  /**
+   * Sample the terrain along the cross section into #elevations.
+   * The previous profile is kept if the line has moved by only a
+   * fraction of the slice spacing and the terrain is unchanged.
+   */
+  const TerrainHeight *UpdateTerrain() const;
 
   void PaintGlide(ChartRenderer &chart) const;
   void PaintAircraft(Canvas &canvas, const ChartRenderer &chart,
@@ -37,6 +37,7 @@ Copyright_License {
 #include "Util/StringAPI.hxx"
 #include "Util/ConvertString.hpp"
 #include "Logger/NMEALogger.hpp"
+#include "Logger/DeviceCapture.hpp"
 #include "Language/Language.hpp"
 #include "Operation/Operation.hpp"
 #include "OS/Path.hpp"
@@ -44,6 +45,7 @@ Copyright_License {
 #include "Input/InputQueue.hpp"
 #include "LogFile.hpp"
 #include "Job/Job.hpp"
+#include "Computer/StageTimer.hpp"
 
 #ifdef ANDROID
 #include "Java/Object.hxx"
@@ -1144,7 +1146,15 @@ DeviceDescriptor::ParseLine(const char *line)
   ScopeLock protect(device_blackboard->mutex);
   NMEAInfo &basic = device_blackboard->SetRealState(index);
   basic.UpdateClock();
-  return ParseNMEA(line, basic);
+
+  const Validity old_vario = basic.total_energy_vario_available;
+  if (!ParseNMEA(line, basic))
+    return false;
+
+  if (basic.total_energy_vario_available.Modified(old_vario))
+    device_blackboard->OnTotalEnergyVario(index);
+
+  return true;
 }
 
 void
@@ -1196,6 +1206,10 @@ DeviceDescriptor::PortError(const char *msg)
 void
 DeviceDescriptor::DataReceived(const void *data, size_t length)
 {
+  const ScopeStageTimer stage_timer(StageTimer::Stage::DEVICE);
+
+  DeviceCapture::Log(index, data, length);
+
   if (monitor != nullptr)
     monitor->DataReceived(data, length);
 
@@ -1206,11 +1220,15 @@ DeviceDescriptor::DataReceived(const void *data, size_t length)
     basic.UpdateClock();
 
     const ExternalSettings old_settings = basic.settings;
+    const Validity old_vario = basic.total_energy_vario_available;
 
     if (device->DataReceived(data, length, basic)) {
       if (!config.sync_from_device)
         basic.settings = old_settings;
 
+      if (basic.total_energy_vario_available.Modified(old_vario))
+        device_blackboard->OnTotalEnergyVario(index);
+
       device_blackboard->ScheduleMerge();
     }
 
@@ -26,6 +26,9 @@ Copyright_License {
 #include "NMEA/Info.hpp"
 #include "NMEA/InputLine.hpp"
 #include "NMEA/Checksum.hpp"
+#include "NMEA/SentenceTable.hpp"
+
+#include <stdint.h>
 
 static bool
 ReadSpeedVector(NMEAInputLine &line, SpeedVector &value_r)
@@ -141,6 +144,22 @@ cai_w(NMEAInputLine &line, NMEAInfo &info)
   return true;
 }
 
+/**
+ * The sentences parsed by CAI302Device::ParseNMEA().
+ */
+enum class CAI302Sentence : uint8_t {
+  W, PCAIB, PCAID,
+};
+
+static constexpr NMEASentenceEntry<CAI302Sentence> cai302_sentences[] = {
+  { "!w", CAI302Sentence::W },
+  { "$PCAIB", CAI302Sentence::PCAIB },
+  { "$PCAID", CAI302Sentence::PCAID },
+};
+
+static_assert(NMEASentenceTable::IsSorted(cai302_sentences),
+              "Sentence table must be sorted");
+
 bool
 CAI302Device::ParseNMEA(const char *String, NMEAInfo &info)
 {
@@ -151,14 +170,20 @@ CAI302Device::ParseNMEA(const char *String, NMEAInfo &info)
   char type[16];
   line.Read(type, 16);
 
-  if (StringIsEqual(type, "$PCAIB"))
+  const auto *entry = NMEASentenceTable::Find(cai302_sentences, type);
+  if (entry == nullptr)
+    return false;
+
+  switch (entry->value) {
+  case CAI302Sentence::PCAIB:
     return cai_PCAIB(line, info);
 
-  if (StringIsEqual(type, "$PCAID"))
+  case CAI302Sentence::PCAID:
     return cai_PCAID(line, info);
 
-  if (StringIsEqual(type, "!w"))
+  case CAI302Sentence::W:
     return cai_w(line, info);
+  }
 
   return false;
 }
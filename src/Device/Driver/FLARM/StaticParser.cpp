@@ -30,6 +30,8 @@ Copyright_License {
 #include "Util/Macros.hpp"
 #include "Util/StringAPI.hxx"
 
+#include <math.h>
+
 void
 ParsePFLAE(NMEAInputLine &line, FlarmError &error, double clock)
 {
@@ -180,9 +182,10 @@ ParsePFLAA(NMEAInputLine &line, TrafficList &flarm, double clock)
 
   FlarmTraffic *flarm_slot = flarm.FindTraffic(traffic.id);
   if (flarm_slot == nullptr) {
-    flarm_slot = flarm.AllocateTraffic();
+    flarm_slot = flarm.AllocateTraffic(hypot(traffic.relative_north,
+                                             traffic.relative_east));
     if (flarm_slot == nullptr)
-      // no more slots available
+      // no more slots available, and all targets are closer
       return;
 
     flarm_slot->Clear();
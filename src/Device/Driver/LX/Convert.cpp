@@ -25,6 +25,8 @@ Copyright_License {
 #include "LXN.hpp"
 #include "OS/ByteOrder.hpp"
 
+#include <algorithm>
+
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
@@ -60,6 +62,116 @@ ValidString(const char *p, size_t size)
   return memchr(p, 0, size) != nullptr;
 }
 
+/*
+ * The following functions format the records which occur once per
+ * fix into a buffer, which is then written with one fwrite() call.
+ * They produce the same output as the printf() formats noted in
+ * their descriptions.
+ */
+
+/**
+ * Like printf("%0*u", width, value).
+ *
+ * @return a pointer to the end of the written string
+ */
+static char *
+FormatDecimal(char *p, unsigned value, unsigned width)
+{
+  char digits[16];
+  char *q = digits + sizeof(digits);
+  do {
+    *--q = '0' + value % 10;
+    value /= 10;
+  } while (value > 0);
+
+  const unsigned n = digits + sizeof(digits) - q;
+  for (; width > n; --width)
+    *p++ = '0';
+
+  memcpy(p, q, n);
+  return p + n;
+}
+
+/**
+ * Like printf("%0*d", width, value).
+ */
+static char *
+FormatSignedDecimal(char *p, int value, unsigned width)
+{
+  if (value >= 0)
+    return FormatDecimal(p, value, width);
+
+  *p++ = '-';
+  return FormatDecimal(p, 0u - (unsigned)value,
+                       width > 1 ? width - 1 : 0);
+}
+
+/**
+ * Like printf("%02d%02d%02d", hours, minutes, seconds).
+ */
+static char *
+FormatTime(char *p, unsigned time)
+{
+  p = FormatDecimal(p, time / 3600, 2);
+  p = FormatDecimal(p, time % 3600 / 60, 2);
+  return FormatDecimal(p, time % 60, 2);
+}
+
+/**
+ * Format an angle [1/60000 degrees] like printf("%0*d%05d%c").
+ */
+static char *
+FormatAngle(char *p, int value, unsigned degree_width,
+            char positive, char negative)
+{
+  const unsigned a = value >= 0 ? value : 0u - (unsigned)value;
+  p = FormatDecimal(p, a / 60000, degree_width);
+  p = FormatDecimal(p, a % 60000, 5);
+  *p++ = value >= 0 ? positive : negative;
+  return p;
+}
+
+/**
+ * Write the bytes in upper case hexadecimal notation.
+ */
+static void
+WriteHex(FILE *file, const uint8_t *data, size_t size)
+{
+  static constexpr char hex_digits[] = "0123456789ABCDEF";
+
+  char buffer[128];
+  while (size > 0) {
+    const size_t n = std::min(size, sizeof(buffer) / 2);
+    for (size_t i = 0; i < n; ++i) {
+      buffer[2 * i] = hex_digits[data[i] >> 4];
+      buffer[2 * i + 1] = hex_digits[data[i] & 0xf];
+    }
+
+    fwrite(buffer, 1, 2 * n, file);
+    data += n;
+    size -= n;
+  }
+}
+
+/**
+ * Write the values of a "B" or "K" record extension packet.
+ */
+template<typename T>
+static void
+WriteExtensions(FILE *file, const LXN::ExtensionConfig &config,
+                const T &packet)
+{
+  char buffer[16 * 12 + 2];
+  char *p = buffer;
+  for (unsigned i = 0; i < config.num; ++i)
+    p = FormatDecimal(p, FromBE16(packet.data[i]),
+                      config.extensions[i].width);
+
+  *p++ = '\r';
+  *p++ = '\n';
+  fwrite(buffer, 1, p - buffer, file);
+}
+
 static void
 HandlePosition(FILE *file, Context &context,
                const struct LXN::Position &position)
@@ -78,23 +190,25 @@ HandlePosition(FILE *file, Context &context,
         context.is_event = 0;
     }
 
-    fprintf(file, "B%02d%02d%02d",
-            context.time / 3600, context.time % 3600 / 60, context.time % 60);
-    fprintf(file, "%02d%05d%c" "%03d%05d%c",
-            abs(latitude) / 60000, abs(latitude) % 60000,
-            latitude >= 0 ? 'N' : 'S',
-            abs(longitude) / 60000, abs(longitude) % 60000,
-            longitude >= 0 ? 'E' : 'W');
-    fprintf(file, "%c", context.fix_stat);
-    fprintf(file, "%05d%05d",
-            /* altitudes can be negative, so cast the uint16_t to
-               int16_t to interpret the most significant bit as sign
-               bit */
-            (int16_t)FromBE16(position.aalt),
-            (int16_t)FromBE16(position.galt));
-
-    if (context.b_ext.num == 0)
-        fprintf(file, "\r\n");
+    /* "B%02d%02d%02d" "%02d%05d%c" "%03d%05d%c" "%c" "%05d%05d" */
+    char buffer[64];
+    char *p = buffer;
+    *p++ = 'B';
+    p = FormatTime(p, context.time);
+    p = FormatAngle(p, latitude, 2, 'N', 'S');
+    p = FormatAngle(p, longitude, 3, 'E', 'W');
+    *p++ = context.fix_stat;
+    /* altitudes can be negative, so cast the uint16_t to int16_t to
+       interpret the most significant bit as sign bit */
+    p = FormatSignedDecimal(p, (int16_t)FromBE16(position.aalt), 5);
+    p = FormatSignedDecimal(p, (int16_t)FromBE16(position.galt), 5);
+
+    if (context.b_ext.num == 0) {
+        *p++ = '\r';
+        *p++ = '\n';
+    }
+
+    fwrite(buffer, 1, p - buffer, file);
 }
 
 static void
@@ -243,10 +357,7 @@ LX::ConvertLXNToIGC(const void *_data, size_t _length,
         return false;
 
       fprintf(file, "G%c", ch);
-
-      for (unsigned i = 0; i < packet.security->length; ++i)
-        fprintf(file, "%02X", packet.security->foo[i]);
-
+      WriteHex(file, packet.security->foo, packet.security->length);
       fprintf(file, "\r\n");
       break;
 
@@ -257,17 +368,14 @@ LX::ConvertLXNToIGC(const void *_data, size_t _length,
         return false;
 
       fprintf(file, "G3");
-      for (auto ch : packet.security_7000->line1)
-        fprintf(file, "%02X", ch);
-
+      WriteHex(file, packet.security_7000->line1,
+               sizeof(packet.security_7000->line1));
       fprintf(file, "\r\nG");
-      for (auto ch : packet.security_7000->line2)
-        fprintf(file, "%02X", ch);
-
+      WriteHex(file, packet.security_7000->line2,
+               sizeof(packet.security_7000->line2));
       fprintf(file, "\r\nG");
-      for (auto ch : packet.security_7000->line3)
-        fprintf(file, "%02X", ch);
-
+      WriteHex(file, packet.security_7000->line3,
+               sizeof(packet.security_7000->line3));
       fprintf(file, "\r\n");
       break;
 
@@ -352,12 +460,7 @@ LX::ConvertLXNToIGC(const void *_data, size_t _length,
       if (data > end)
         return false;
 
-      for (unsigned i = 0; i < context.b_ext.num; ++i)
-        fprintf(file, "%0*u",
-                (int)context.b_ext.extensions[i].width,
-                FromBE16(packet.b_ext->data[i]));
-
-      fprintf(file, "\r\n");
+      WriteExtensions(file, context.b_ext, *packet.b_ext);
       break;
 
     case LXN::K_EXT:
@@ -370,12 +473,7 @@ LX::ConvertLXNToIGC(const void *_data, size_t _length,
       fprintf(file, "K%02d%02d%02d",
               l / 3600, l % 3600 / 60, l % 60);
 
-      for (unsigned i = 0; i < context.k_ext.num; ++i)
-        fprintf(file, "%0*u",
-                context.k_ext.extensions[i].width,
-                FromBE16(packet.k_ext->data[i]));
-
-      fprintf(file, "\r\n");
+      WriteExtensions(file, context.k_ext, *packet.k_ext);
       break;
 
     case LXN::DATE:
@@ -290,6 +290,19 @@ HandleFlightLine(const char *_line, FILE *file,
   return true;
 }
 
+/**
+ * The number of rows requested at a time.
+ */
+static constexpr unsigned ROWS_PER_REQUEST = 32;
+
+/**
+ * Keep one more request in flight while the previous one is still
+ * being received, to hide the round trip time of the Bluetooth link.
+ * The Nano answers requests in order, and HandleFlightLine() rejects
+ * any row out of sequence.
+ */
+static constexpr unsigned PIPELINE_ROWS = 2 * ROWS_PER_REQUEST;
+
 static bool
 DownloadFlightInner(Port &port, const char *filename, FILE *file,
                     OperationEnvironment &env)
@@ -297,60 +310,66 @@ DownloadFlightInner(Port &port, const char *filename, FILE *file,
   PortNMEAReader reader(port, env);
   unsigned row_count = 0, i = 1;
 
+  /* the first row which has not been requested yet */
+  unsigned requested_end = 1;
+
+  unsigned retry_count = 0;
+
   while (true) {
-    /* read up to 32 lines at a time */
-    unsigned nrequest = row_count == 0 ? 1 : 32;
-    if (row_count > 0) {
-      assert(i <= row_count);
-      const unsigned remaining = row_count - i + 1;
-      if (nrequest > remaining)
-        nrequest = remaining;
+    if (requested_end == i) {
+      /* nothing in flight (first request, or after an error): start
+         over from the last good row; the first request only asks for
+         one row, to learn the length of the file */
+      reader.Flush();
+
+      const unsigned nrequest = row_count == 0
+        ? 1
+        : std::min(ROWS_PER_REQUEST, row_count - i + 1);
+      if (!RequestFlight(port, filename, i, i + nrequest, env))
+        return false;
+
+      requested_end = i + nrequest;
+    } else if (row_count > 0 && requested_end <= row_count &&
+               requested_end - i <= PIPELINE_ROWS - ROWS_PER_REQUEST) {
+      /* queue the next range while the current one is still being
+         received */
+      const unsigned nrequest =
+        std::min(ROWS_PER_REQUEST, row_count - requested_end + 1);
+      if (!RequestFlight(port, filename, requested_end,
+                         requested_end + nrequest, env))
+        return false;
+
+      requested_end += nrequest;
     }
 
-    const unsigned start = i;
-    const unsigned end = start + nrequest;
-    unsigned request_retry_count = 0;
-
-    /* read the requested lines and save to file */
-
-    while (i != end) {
-      if (i == start) {
-        /* send request range to Nano */
-        reader.Flush();
-        if (!RequestFlight(port, filename, start, end, env))
-          return false;
-        request_retry_count++;
-      }
-
-      TimeoutClock timeout(2000);
-      const char *line = reader.ExpectLine("PLXVC,FLIGHT,A,", timeout);
-      if (line == nullptr || !HandleFlightLine(line, file, i, row_count)) {
-        if (request_retry_count > 5)
-          return false;
-
-        /* Discard data which might still be in-transit, e.g. buffered
-           inside a bluetooth dongle */
-        port.FullFlush(env, 200, 2000);
-
-        /* If we already received parts of the request range correctly break
-           out of the loop to calculate new request range */
-        if (i != start)
-          break;
-
-        /* No valid reply received (i==start) - request same range again */
-      }
+    TimeoutClock timeout(2000);
+    const char *line = reader.ExpectLine("PLXVC,FLIGHT,A,", timeout);
+    const bool first = row_count == 0;
+    if (line == nullptr || !HandleFlightLine(line, file, i, row_count)) {
+      if (++retry_count > 5)
+        return false;
+
+      /* Discard data which might still be in-transit, e.g. buffered
+         inside a bluetooth dongle, and resume from the last good
+         row */
+      port.FullFlush(env, 200, 2000);
+      requested_end = i;
+      continue;
     }
 
+    retry_count = 0;
+
     if (i > row_count)
       /* finished successfully */
       return true;
 
-    if (start == 1)
+    if (first)
       /* configure the range in the first iteration, now that we know
          the length of the file */
       env.SetProgressRange(row_count);
 
-    env.SetProgressPosition(i - 1);
+    if ((i - 1) % ROWS_PER_REQUEST == 0)
+      env.SetProgressPosition(i - 1);
   }
 }
 
@@ -24,12 +24,15 @@ Copyright_License {
 #include "Internal.hpp"
 #include "NMEA/Checksum.hpp"
 #include "NMEA/InputLine.hpp"
+#include "NMEA/SentenceTable.hpp"
 #include "NMEA/Info.hpp"
 #include "Geo/SpeedVector.hpp"
 #include "Units/System.hpp"
 #include "Util/Macros.hpp"
 #include "Util/StringCompare.hxx"
 
+#include <stdint.h>
+
 static bool
 ReadSpeedVector(NMEAInputLine &line, SpeedVector &value_r)
 {
@@ -337,6 +340,27 @@ PLXVS(NMEAInputLine &line, NMEAInfo &info)
   return true;
 }
 
+/**
+ * The sentences parsed by LXDevice::ParseNMEA().
+ */
+enum class LXSentence : uint8_t {
+  LXWP0, LXWP1, LXWP2, LXWP3, PLXV0, PLXVC, PLXVF, PLXVS,
+};
+
+static constexpr NMEASentenceEntry<LXSentence> lx_sentences[] = {
+  { "$LXWP0", LXSentence::LXWP0 },
+  { "$LXWP1", LXSentence::LXWP1 },
+  { "$LXWP2", LXSentence::LXWP2 },
+  { "$LXWP3", LXSentence::LXWP3 },
+  { "$PLXV0", LXSentence::PLXV0 },
+  { "$PLXVC", LXSentence::PLXVC },
+  { "$PLXVF", LXSentence::PLXVF },
+  { "$PLXVS", LXSentence::PLXVS },
+};
+
+static_assert(NMEASentenceTable::IsSorted(lx_sentences),
+              "Sentence table must be sorted");
+
 bool
 LXDevice::ParseNMEA(const char *String, NMEAInfo &info)
 {
@@ -347,10 +371,15 @@ LXDevice::ParseNMEA(const char *String, NMEAInfo &info)
   char type[16];
   line.Read(type, 16);
 
-  if (StringIsEqual(type, "$LXWP0"))
+  const auto *entry = NMEASentenceTable::Find(lx_sentences, type);
+  if (entry == nullptr)
+    return false;
+
+  switch (entry->value) {
+  case LXSentence::LXWP0:
     return LXWP0(line, info);
 
-  if (StringIsEqual(type, "$LXWP1")) {
+  case LXSentence::LXWP1: {
     /* if in pass-through mode, assume that this line was sent by the
        secondary device */
     DeviceInfo &device_info = mode == Mode::PASS_THROUGH
@@ -384,34 +413,31 @@ LXDevice::ParseNMEA(const char *String, NMEAInfo &info)
     return true;
   }
 
-  if (StringIsEqual(type, "$LXWP2"))
+  case LXSentence::LXWP2:
     return LXWP2(line, info);
 
-  if (StringIsEqual(type, "$LXWP3"))
+  case LXSentence::LXWP3:
     return LXWP3(line, info);
 
-  if (StringIsEqual(type, "$PLXV0")) {
+  case LXSentence::PLXV0:
     is_v7 = true;
     is_colibri = false;
     return PLXV0(line, v7_settings);
-  }
 
-  if (StringIsEqual(type, "$PLXVC")) {
+  case LXSentence::PLXVC:
     is_nano = true;
     is_colibri = false;
     PLXVC(line, info.device, info.secondary_device, nano_settings);
     is_forwarded_nano = info.secondary_device.product.equals("NANO") ||
                           info.secondary_device.product.equals("NANO3");
     return true;
-  }
 
-  if (StringIsEqual(type, "$PLXVF")) {
+  case LXSentence::PLXVF:
     is_v7 = true;
     is_colibri = false;
     return PLXVF(line, info);
-  }
 
-  if (StringIsEqual(type, "$PLXVS")) {
+  case LXSentence::PLXVS:
     is_v7 = true;
     is_colibri = false;
     return PLXVS(line, info);
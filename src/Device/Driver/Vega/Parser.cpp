@@ -25,9 +25,11 @@ Copyright_License {
 #include "Message.hpp"
 #include "NMEA/Info.hpp"
 #include "NMEA/InputLine.hpp"
+#include "NMEA/SentenceTable.hpp"
 #include "Compiler.h"
 
 #include <tchar.h>
+#include <stdint.h>
 #include <algorithm>
 
 #ifdef _UNICODE
@@ -214,6 +216,27 @@ PDTSM(NMEAInputLine &line, gcc_unused NMEAInfo &info)
   return true;
 }
 
+/**
+ * The sentences parsed by VegaDevice::ParseNMEA().
+ */
+enum class VegaSentence : uint8_t {
+  PDAAV, PDSWC, PDTSM, PDVDS, PDVDV, PDVSC, PDVSD, PDVVT,
+};
+
+static constexpr NMEASentenceEntry<VegaSentence> vega_sentences[] = {
+  { "$PDAAV", VegaSentence::PDAAV },
+  { "$PDSWC", VegaSentence::PDSWC },
+  { "$PDTSM", VegaSentence::PDTSM },
+  { "$PDVDS", VegaSentence::PDVDS },
+  { "$PDVDV", VegaSentence::PDVDV },
+  { "$PDVSC", VegaSentence::PDVSC },
+  { "$PDVSD", VegaSentence::PDVSD },
+  { "$PDVVT", VegaSentence::PDVVT },
+};
+
+static_assert(NMEASentenceTable::IsSorted(vega_sentences),
+              "Sentence table must be sorted");
+
 bool
 VegaDevice::ParseNMEA(const char *String, NMEAInfo &info)
 {
@@ -224,26 +247,40 @@ VegaDevice::ParseNMEA(const char *String, NMEAInfo &info)
   if (memcmp(type, "$PD", 3) == 0)
     detected = true;
 
-  if (StringIsEqual(type, "$PDSWC"))
-    return PDSWC(line, info, volatile_data);
-  else if (StringIsEqual(type, "$PDAAV"))
+  const auto *entry = NMEASentenceTable::Find(vega_sentences, type);
+  if (entry == nullptr)
+    return false;
+
+  switch (entry->value) {
+  case VegaSentence::PDAAV:
     return PDAAV(line, info);
-  else if (StringIsEqual(type, "$PDVSC"))
-    return PDVSC(line, info);
-  else if (StringIsEqual(type, "$PDVDV"))
-    return PDVDV(line, info);
-  else if (StringIsEqual(type, "$PDVDS"))
+
+  case VegaSentence::PDSWC:
+    return PDSWC(line, info, volatile_data);
+
+  case VegaSentence::PDTSM:
+    return PDTSM(line, info);
+
+  case VegaSentence::PDVDS:
     return PDVDS(line, info);
-  else if (StringIsEqual(type, "$PDVVT"))
-    return PDVVT(line, info);
-  else if (StringIsEqual(type, "$PDVSD")) {
+
+  case VegaSentence::PDVDV:
+    return PDVDV(line, info);
+
+  case VegaSentence::PDVSC:
+    return PDVSC(line, info);
+
+  case VegaSentence::PDVSD: {
     const auto message = line.Rest();
     StaticString<256> buffer;
     buffer.SetASCII(message.begin(), message.end());
     Message::AddMessage(buffer);
     return true;
-  } else if (StringIsEqual(type, "$PDTSM"))
-    return PDTSM(line, info);
-  else
-    return false;
+  }
+
+  case VegaSentence::PDVVT:
+    return PDVVT(line, info);
+  }
+
+  return false;
 }
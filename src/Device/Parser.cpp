@@ -29,9 +29,52 @@ Copyright_License {
 #include "NMEA/Info.hpp"
 #include "NMEA/Checksum.hpp"
 #include "NMEA/InputLine.hpp"
+#include "NMEA/SentenceTable.hpp"
 #include "Units/System.hpp"
 #include "Driver/FLARM/StaticParser.hpp"
 
+#include <stdint.h>
+
+/**
+ * Standard sentences, identified by the three letters following the
+ * talker id.
+ */
+enum class StandardSentence : uint8_t {
+  GGA, GLL, GSA, HDM, MWV, RMC,
+};
+
+static constexpr NMEASentenceEntry<StandardSentence> standard_sentences[] = {
+  { "GGA", StandardSentence::GGA },
+  { "GLL", StandardSentence::GLL },
+  { "GSA", StandardSentence::GSA },
+  { "HDM", StandardSentence::HDM },
+  { "MWV", StandardSentence::MWV },
+  { "RMC", StandardSentence::RMC },
+};
+
+static_assert(NMEASentenceTable::IsSorted(standard_sentences),
+              "Sentence table must be sorted");
+
+/**
+ * Proprietary sentences, identified by their full name without the
+ * dollar sign.
+ */
+enum class ProprietarySentence : uint8_t {
+  PFLAA, PFLAE, PFLAU, PFLAV, PGRMZ, PTAS1,
+};
+
+static constexpr NMEASentenceEntry<ProprietarySentence> proprietary_sentences[] = {
+  { "PFLAA", ProprietarySentence::PFLAA },
+  { "PFLAE", ProprietarySentence::PFLAE },
+  { "PFLAU", ProprietarySentence::PFLAU },
+  { "PFLAV", ProprietarySentence::PFLAV },
+  { "PGRMZ", ProprietarySentence::PGRMZ },
+  { "PTAS1", ProprietarySentence::PTAS1 },
+};
+
+static_assert(NMEASentenceTable::IsSorted(proprietary_sentences),
+              "Sentence table must be sorted");
+
 NMEAParser::NMEAParser()
 {
   Reset();
@@ -62,57 +105,63 @@ NMEAParser::ParseLine(const char *string, NMEAInfo &info)
   line.Read(type, 16);
 
   if (IsAlphaASCII(type[1]) && IsAlphaASCII(type[2])) {
-    if (StringIsEqual(type + 3, "GSA"))
-      return GSA(line, info);
+    const auto *entry = NMEASentenceTable::Find(standard_sentences,
+                                                type + 3);
+    if (entry != nullptr) {
+      switch (entry->value) {
+      case StandardSentence::GGA:
+        return GGA(line, info);
 
-    if (StringIsEqual(type + 3, "GLL"))
-      return GLL(line, info);
+      case StandardSentence::GLL:
+        return GLL(line, info);
 
-    if (StringIsEqual(type + 3, "RMC"))
-      return RMC(line, info);
+      case StandardSentence::GSA:
+        return GSA(line, info);
 
-    if (StringIsEqual(type + 3, "GGA"))
-      return GGA(line, info);
+      case StandardSentence::HDM:
+        return HDM(line, info);
 
-    if (StringIsEqual(type + 3, "HDM"))
-      return HDM(line, info);
+      case StandardSentence::MWV:
+        return MWV(line, info);
 
-    if (StringIsEqual(type + 3, "MWV"))
-      return MWV(line, info);
+      case StandardSentence::RMC:
+        return RMC(line, info);
+      }
+    }
   }
 
   // if (proprietary sentence) ...
   if (type[1] == 'P') {
-    // Airspeed and vario sentence
-    if (StringIsEqual(type + 1, "PTAS1"))
-      return PTAS1(line, info);
+    const auto *entry = NMEASentenceTable::Find(proprietary_sentences,
+                                                type + 1);
+    if (entry == nullptr)
+      return false;
 
-    // FLARM sentences
-    if (StringIsEqual(type + 1, "PFLAE")) {
-      ParsePFLAE(line, info.flarm.error, info.clock);
+    switch (entry->value) {
+    case ProprietarySentence::PFLAA:
+      ParsePFLAA(line, info.flarm.traffic, info.clock);
       return true;
-    }
 
-    if (StringIsEqual(type + 1, "PFLAV")) {
-      ParsePFLAV(line, info.flarm.version, info.clock);
+    case ProprietarySentence::PFLAE:
+      ParsePFLAE(line, info.flarm.error, info.clock);
       return true;
-    }
 
-    if (StringIsEqual(type + 1, "PFLAA")) {
-      ParsePFLAA(line, info.flarm.traffic, info.clock);
+    case ProprietarySentence::PFLAU:
+      ParsePFLAU(line, info.flarm.status, info.clock);
       return true;
-    }
 
-    if (StringIsEqual(type + 1, "PFLAU")) {
-      ParsePFLAU(line, info.flarm.status, info.clock);
+    case ProprietarySentence::PFLAV:
+      ParsePFLAV(line, info.flarm.version, info.clock);
       return true;
-    }
 
-    // Garmin altitude sentence
-    if (StringIsEqual(type + 1, "PGRMZ"))
+    case ProprietarySentence::PGRMZ:
+      // Garmin altitude sentence
       return RMZ(line, info);
 
-    return false;
+    case ProprietarySentence::PTAS1:
+      // Airspeed and vario sentence
+      return PTAS1(line, info);
+    }
   }
 
   return false;
@@ -37,6 +37,14 @@ Copyright_License {
  * FIFO buffer.  This buffer can be fed from another thread.  Derive
  * from this class and call DataReceived() (or use the DataHandler
  * base class) whenever you get some data from the device.
+ *
+ * On POSIX, the subclasses (#TTYPort, #TCPPort, #UDPPort,
+ * #TCPClientPort) are driven by the global #AsioThread and don't
+ * have a thread of their own.  The Android ports are fed by the Java
+ * side, and only #SerialPort (Windows) still runs its own thread.
+ * The blocking methods (WaitRead(), FullRead(), ExpectString()) are
+ * only used by driver operations such as declaration and flight
+ * download, which run in a job thread and wait on #cond.
  */
 class BufferedPort : public Port, protected DataHandler {
   /**
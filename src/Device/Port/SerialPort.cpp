@@ -26,6 +26,7 @@ Copyright_License {
 #include "OS/LogError.hpp"
 #include "OS/Sleep.h"
 #include "OS/OverlappedEvent.hpp"
+#include "Thread/Policy.hpp"
 
 #include <windows.h>
 
@@ -238,6 +239,8 @@ SerialPort::Run()
 {
   assert(Thread::IsInside());
 
+  ApplyThreadPolicy(ThreadRole::PORT_IO);
+
   DWORD dwBytesTransferred;
   BYTE inbuf[1024];
 
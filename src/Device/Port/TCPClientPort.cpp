@@ -114,6 +114,11 @@ TCPClientPort::OnConnect(const boost::system::error_code &ec)
   SendTimeoutS send_timeout(1);
   socket.set_option(send_timeout);
 
+  const boost::asio::socket_base::receive_buffer_size
+    receive_buffer_size(FEED_RECEIVE_BUFFER_SIZE);
+  boost::system::error_code error;
+  socket.set_option(receive_buffer_size, error);
+
   state = PortState::READY;
   StateChanged();
 
@@ -139,6 +144,7 @@ TCPClientPort::OnRead(const boost::system::error_code &ec, size_t nbytes)
     return;
   }
 
+  nbytes = ReceiveAvailable(socket, input, sizeof(input), nbytes);
   DataReceived(input, nbytes);
 
   socket.async_receive(boost::asio::buffer(input, sizeof(input)),
@@ -37,7 +37,7 @@ class TCPClientPort final
   boost::asio::ip::tcp::resolver resolver;
   boost::asio::ip::tcp::socket socket;
 
-  char input[4096];
+  char input[16384];
 
   PortState state = PortState::LIMBO;
 
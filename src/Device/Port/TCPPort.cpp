@@ -95,6 +95,11 @@ TCPPort::OnAccept(const boost::system::error_code &ec)
 
   connection.set_option(SendTimeoutS(1));
 
+  const boost::asio::socket_base::receive_buffer_size
+    receive_buffer_size(FEED_RECEIVE_BUFFER_SIZE);
+  boost::system::error_code error;
+  connection.set_option(receive_buffer_size, error);
+
   AsyncRead();
 }
 
@@ -114,6 +119,7 @@ TCPPort::OnRead(const boost::system::error_code &ec, size_t nbytes)
     return;
   }
 
+  nbytes = ReceiveAvailable(connection, input, sizeof(input), nbytes);
   DataReceived(input, nbytes);
 
   AsyncRead();
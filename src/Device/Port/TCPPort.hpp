@@ -36,7 +36,7 @@ class TCPPort final : public BufferedPort
   boost::asio::ip::tcp::acceptor acceptor;
   boost::asio::ip::tcp::socket connection;
 
-  char input[4096];
+  char input[16384];
 
 public:
   /**
@@ -22,6 +22,7 @@ Copyright_License {
 */
 
 #include "UDPPort.hpp"
+#include "Net/Option.hpp"
 #include "IO/Async/AsioUtil.hpp"
 
 UDPPort::UDPPort(boost::asio::io_service &io_service,
@@ -31,6 +32,11 @@ UDPPort::UDPPort(boost::asio::io_service &io_service,
    socket(io_service,
           boost::asio::ip::udp::endpoint(boost::asio::ip::udp::v4(), port))
 {
+  const boost::asio::socket_base::receive_buffer_size
+    receive_buffer_size(FEED_RECEIVE_BUFFER_SIZE);
+  boost::system::error_code ec;
+  socket.set_option(receive_buffer_size, ec);
+
   AsyncRead();
 }
 
@@ -82,6 +88,9 @@ UDPPort::OnRead(const boost::system::error_code &ec, size_t nbytes)
     return;
   }
 
+  /* collect all datagrams which have arrived meanwhile */
+  nbytes = ReceiveAvailable(socket, input, sizeof(input), nbytes);
+
   DataReceived(input, nbytes);
 
   AsyncRead();
@@ -35,7 +35,7 @@ class UDPPort final : public BufferedPort
 {
   boost::asio::ip::udp::socket socket;
 
-  char input[4096];
+  char input[16384];
 
 public:
   /**
@@ -22,7 +22,6 @@ Copyright_License {
 */
 
 #include "LineSplitter.hpp"
-#include "Util/TextFile.hxx"
 #include "Util/StringUtil.hpp"
 
 #include <algorithm>
@@ -70,25 +69,32 @@ PortLineSplitter::DataReceived(const void *_data, size_t length)
     while (true) {
       /* read data from the buffer, to see if there's a newline
          character */
-      char *line = ReadBufferedLine(buffer);
-      if (line == nullptr)
+      auto r = buffer.Read();
+      char *const newline = (char *)memchr(r.data, '\n', r.size);
+      if (newline == nullptr)
         /* no newline here: wait for more data */
         break;
 
-      char *end = line + strlen(line);
+      buffer.Consume(newline + 1 - r.data);
 
-      /* remove trailing whitespace, such as '\r' */
-      end = StripRight(line, end);
-
-      SanitiseLine(line, end);
+      /* the line is parsed in place inside the buffer; the newline
+         position is already known, so there's no need for
+         strlen() */
+      char *line = r.data;
 
       /* if there are NUL bytes in the line, skip to after the last
          one, to avoid conflicts with NUL terminated C strings due to
          binary garbage */
       void *nul;
-      while ((nul = memchr(line, 0, end - line)) != nullptr)
+      while ((nul = memchr(line, 0, newline - line)) != nullptr)
         line = (char *)nul + 1;
 
+      /* remove trailing whitespace, such as '\r' */
+      char *end = StripRight(line, newline);
+      *end = 0;
+
+      SanitiseLine(line, end);
+
       LineReceived(line);
     }
   } while (data < end);
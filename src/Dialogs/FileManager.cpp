@@ -57,6 +57,9 @@ Copyright_License {
 #include "Event/Notify.hpp"
 #include "Thread/Mutex.hpp"
 #include "Event/Timer.hpp"
+#include "Logger/MD5.hpp"
+#include "Logger/MD5File.hpp"
+#include "Util/StringAPI.hxx"
 
 #include <map>
 #include <set>
@@ -104,6 +107,26 @@ CanDownload(const FileRepository &repository, const TCHAR *name)
   return FindRemoteFile(repository, name) != nullptr;
 }
 
+/**
+ * Does the local file differ from the one described by the
+ * repository?  Files without size and digest in the repository are
+ * assumed to be current.
+ */
+static bool
+IsModified(const AvailableFile &remote_file, Path path)
+{
+  if (remote_file.size >= 0 &&
+      int64_t(File::GetSize(path)) != remote_file.size)
+    return true;
+
+  if (remote_file.md5.empty())
+    return false;
+
+  char digest[MD5::DIGEST_LENGTH + 1];
+  return !ComputeFileMD5(path, digest) ||
+    !StringIsEqual(digest, remote_file.md5);
+}
+
 #endif
 
 class ManagedFileListWidget
@@ -115,6 +138,7 @@ class ManagedFileListWidget
   enum Buttons {
     DOWNLOAD,
     ADD,
+    UPDATE,
     CANCEL,
   };
 
@@ -163,7 +187,7 @@ class ManagedFileListWidget
   TwoTextRowsRenderer row_renderer;
 
 #ifdef HAVE_DOWNLOAD_MANAGER
-  Button *download_button, *add_button, *cancel_button;
+  Button *download_button, *add_button, *update_button, *cancel_button;
 #endif
 
   FileRepository repository;
@@ -264,6 +288,7 @@ protected:
 
   void Download();
   void Add();
+  void UpdateAll();
   void Cancel();
 
 public:
@@ -403,6 +428,7 @@ ManagedFileListWidget::CreateButtons(WidgetDialog &dialog)
   if (Net::DownloadManager::IsAvailable()) {
     download_button = dialog.AddButton(_("Download"), *this, DOWNLOAD);
     add_button = dialog.AddButton(_("Add"), *this, ADD);
+    update_button = dialog.AddButton(_("Update all"), *this, UPDATE);
     cancel_button = dialog.AddButton(_("Cancel"), *this, CANCEL);
   }
 #endif
@@ -417,6 +443,7 @@ ManagedFileListWidget::UpdateButtons()
 
     download_button->SetEnabled(!items.empty() &&
                                 CanDownload(repository, items[current].name));
+    update_button->SetEnabled(!items.empty());
     cancel_button->SetEnabled(!items.empty() && items[current].downloading);
   }
 #endif
@@ -486,7 +513,8 @@ ManagedFileListWidget::Download()
   if (!base.IsValid())
     return;
 
-  Net::DownloadManager::Enqueue(remote_file.uri.c_str(), Path(base));
+  Net::DownloadManager::Enqueue(remote_file.uri.c_str(), Path(base),
+                                remote_file.GetMD5());
 #endif
 }
 
@@ -561,7 +589,33 @@ ManagedFileListWidget::Add()
   if (!base.IsValid())
     return;
 
-  Net::DownloadManager::Enqueue(remote_file.GetURI(), Path(base));
+  Net::DownloadManager::Enqueue(remote_file.GetURI(), Path(base),
+                                remote_file.GetMD5());
+#endif
+}
+
+void
+ManagedFileListWidget::UpdateAll()
+{
+#ifdef HAVE_DOWNLOAD_MANAGER
+  assert(Net::DownloadManager::IsAvailable());
+
+  for (const auto &remote_file : repository) {
+    if (!remote_file.HasChecksum() || IsDownloading(remote_file))
+      continue;
+
+    const auto path = LocalPath(remote_file);
+    if (path.IsNull() || !File::Exists(path) ||
+        !IsModified(remote_file, path))
+      continue;
+
+    const UTF8ToWideConverter base(remote_file.GetName());
+    if (!base.IsValid())
+      continue;
+
+    Net::DownloadManager::Enqueue(remote_file.GetURI(), Path(base),
+                                  remote_file.GetMD5());
+  }
 #endif
 }
 
@@ -594,6 +648,10 @@ ManagedFileListWidget::OnAction(int id)
     Add();
     break;
 
+  case UPDATE:
+    UpdateAll();
+    break;
+
   case CANCEL:
     Cancel();
     break;
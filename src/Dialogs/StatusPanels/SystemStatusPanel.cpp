@@ -27,7 +27,16 @@ Copyright_License {
 #include "Interface.hpp"
 #include "Language/Language.hpp"
 #include "Hardware/Battery.hpp"
+#include "BatteryTimer.hpp"
 #include "Net/State.hpp"
+#include "Computer/StageTimer.hpp"
+#include "Util/AllocationStats.hpp"
+
+#ifdef ALLOC_STATS
+#include "Formatter/ByteSizeFormatter.hpp"
+#include "Util/ConvertString.hpp"
+#include "Util/Macros.hpp"
+#endif
 
 enum Controls {
   GPS,
@@ -37,6 +46,9 @@ enum Controls {
   Logger,
   Battery,
   Network,
+  CalculationTime,
+  DrawTime,
+  FirstAllocationTag,
 };
 
 gcc_pure
@@ -119,11 +131,63 @@ SystemStatusPanel::Refresh()
   else if (basic.battery_level_available)
     Temp.AppendFormat(_T("%.0f%%"), (double)basic.battery_level);
 
+  if (BatteryTimer::IsPowerSaving()) {
+    if (!Temp.empty())
+      Temp.push_back(_T(' '));
+    Temp.append(_("(power saving)"));
+  }
+
   SetText(Battery, Temp);
 
   SetText(Network, ToString(GetNetState()));
+
+  SetStageTime(CalculationTime, StageTimer::Stage::CALCULATION);
+  SetStageTime(DrawTime, StageTimer::Stage::DRAW);
+
+#ifdef ALLOC_STATS
+  for (unsigned i = 0; i < unsigned(AllocationTag::COUNT); ++i)
+    SetAllocationStats(FirstAllocationTag + i, AllocationTag(i));
+#endif
+}
+
+void
+SystemStatusPanel::SetStageTime(unsigned control, StageTimer::Stage stage)
+{
+  const auto summary = StageTimer::GetSummary(stage);
+  if (summary.count == 0) {
+    ClearText(control);
+    return;
+  }
+
+  /* mean / 99th percentile / maximum */
+  StaticString<64> buffer;
+  buffer.Format(_T("%.1f / %.1f / %.1f ms"),
+                summary.mean / 1000., summary.p99 / 1000.,
+                summary.max / 1000.);
+  SetText(control, buffer);
 }
 
+#ifdef ALLOC_STATS
+
+void
+SystemStatusPanel::SetAllocationStats(unsigned control, AllocationTag tag)
+{
+  const auto counters = GetAllocationCounters(tag);
+
+  /* current / peak size, number of allocations */
+  TCHAR bytes[32], peak_bytes[32];
+  FormatByteSize(bytes, ARRAY_SIZE(bytes), counters.bytes, true);
+  FormatByteSize(peak_bytes, ARRAY_SIZE(peak_bytes), counters.peak_bytes,
+                 true);
+
+  StaticString<80> buffer;
+  buffer.Format(_T("%s / %s (%lu)"), bytes, peak_bytes,
+                (unsigned long)counters.allocations);
+  SetText(control, buffer);
+}
+
+#endif
+
 void
 SystemStatusPanel::Prepare(ContainerWindow &parent, const PixelRect &rc)
 {
@@ -134,6 +198,17 @@ SystemStatusPanel::Prepare(ContainerWindow &parent, const PixelRect &rc)
   AddReadOnly(_("Logger"));
   AddReadOnly(_("Supply voltage"));
   AddReadOnly(_("Network"));
+  AddReadOnly(_("Calculation time"),
+              _("Time needed for one calculation cycle: mean and 99th percentile of the last 100 cycles, and the maximum."));
+  AddReadOnly(_("Drawing time"),
+              _("Time needed to draw the map: mean and 99th percentile of the last 100 frames, and the maximum."));
+
+#ifdef ALLOC_STATS
+  for (unsigned i = 0; i < unsigned(AllocationTag::COUNT); ++i) {
+    const UTF8ToWideConverter name(ToString(AllocationTag(i)));
+    AddReadOnly(name);
+  }
+#endif
 }
 
 void
@@ -26,6 +26,9 @@ Copyright_License {
 
 #include "StatusPanel.hpp"
 #include "Blackboard/RateLimitedBlackboardListener.hpp"
+#include "Computer/StageTimer.hpp"
+
+enum class AllocationTag : uint8_t;
 
 class SystemStatusPanel final
   : public StatusPanel,
@@ -45,6 +48,12 @@ public:
   void Hide() override;
 
 private:
+  void SetStageTime(unsigned control, StageTimer::Stage stage);
+
+#ifdef ALLOC_STATS
+  void SetAllocationStats(unsigned control, AllocationTag tag);
+#endif
+
   /* virtual methods from class BlackboardListener */
   void OnGPSUpdate(const MoreData &basic) override;
 };
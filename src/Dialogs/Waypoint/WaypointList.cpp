@@ -42,6 +42,7 @@ Copyright_License {
 #include "Form/DataField/Enum.hpp"
 #include "Util/StringPointer.hxx"
 #include "Util/AllocatedString.hxx"
+#include "Util/StringAPI.hxx"
 #include "UIGlobals.hpp"
 #include "Look/MapLook.hpp"
 #include "Look/DialogLook.hpp"
@@ -107,6 +108,21 @@ struct WaypointListDialogState
       direction_index > 0 || type_index != TypeFilter::ALL;
   }
 
+  /**
+   * Does this state match a subset of what the given (older) state
+   * matched?  This is only implemented for a name which was extended
+   * while all other filters stayed the same.
+   */
+  gcc_pure
+  bool IsNarrowerThan(const WaypointListDialogState &other) const {
+    return distance_index == other.distance_index &&
+      direction_index == other.direction_index &&
+      type_index == other.type_index &&
+      name.length() >= other.name.length() &&
+      StringIsEqualIgnoreCase(name.c_str(), other.name.c_str(),
+                              other.name.length());
+  }
+
   void ToFilter(WaypointFilter &filter, Angle heading) const {
     filter.name = name;
     filter.distance =
@@ -139,6 +155,16 @@ class WaypointListWidget final
   OrderedTask *const ordered_task;
   const unsigned ordered_task_index;
 
+  /**
+   * The filter state #items was built with, and whether the list was
+   * built from a visit of all matching waypoints (see FillList()).
+   * Used to refine the list instead of rebuilding it while the user
+   * types a name.
+   */
+  WaypointListDialogState items_state;
+  Angle items_heading;
+  bool items_complete = false;
+
 public:
   WaypointListWidget(ActionListener &_action_listener,
                      WaypointFilterWidget &_filter_widget,
@@ -273,13 +299,17 @@ WaypointFilterWidget::Update(Angle _last_heading)
   direction_control.RefreshDisplay();
 }
 
-static void
+/**
+ * @return false if the list was left empty because there are too
+ * many waypoints to show without a filter
+ */
+static bool
 FillList(WaypointList &list, const Waypoints &src,
          GeoPoint location, Angle heading, const WaypointListDialogState &state,
          OrderedTask *ordered_task, unsigned ordered_task_index)
 {
   if (!state.IsDefined() && src.size() >= 500)
-    return;
+    return false;
 
   WaypointFilter filter;
   state.ToFilter(filter, heading);
@@ -290,6 +320,25 @@ FillList(WaypointList &list, const Waypoints &src,
 
   if (filter.distance > 0 || !filter.direction.IsNegative())
     list.SortByDistance(location);
+
+  return true;
+}
+
+/**
+ * Remove items from a list built by FillList() which do not match the
+ * (narrower) new filter state.  The list stays sorted.
+ */
+static void
+RefineList(WaypointList &list, GeoPoint location, Angle heading,
+           const WaypointListDialogState &state,
+           OrderedTask *ordered_task, unsigned ordered_task_index)
+{
+  WaypointFilter filter;
+  state.ToFilter(filter, heading);
+
+  WaypointListBuilder builder(filter, location, list,
+                              ordered_task, ordered_task_index);
+  builder.Refine();
 }
 
 static void
@@ -309,15 +358,27 @@ FillLastUsedList(WaypointList &list,
 void
 WaypointListWidget::UpdateList()
 {
-  items.clear();
-
-  if (dialog_state.type_index == TypeFilter::LAST_USED)
+  if (dialog_state.type_index == TypeFilter::LAST_USED) {
+    items.clear();
     FillLastUsedList(items, LastUsedWaypoints::GetList(),
                      way_points);
-  else
-    FillList(items, way_points, location, last_heading,
-             dialog_state,
-             ordered_task, ordered_task_index);
+    items_complete = false;
+  } else if (items_complete && last_heading == items_heading &&
+             /* without a distance filter, the name is matched by
+                the name index, not by WaypointFilter::Matches() */
+             dialog_state.distance_index > 0 &&
+             dialog_state.IsNarrowerThan(items_state)) {
+    RefineList(items, location, last_heading, dialog_state,
+               ordered_task, ordered_task_index);
+  } else {
+    items.clear();
+    items_complete = FillList(items, way_points, location, last_heading,
+                              dialog_state,
+                              ordered_task, ordered_task_index);
+  }
+
+  items_state = dialog_state;
+  items_heading = last_heading;
 
   auto &list = GetList();
   list.SetLength(std::max(1u, (unsigned)items.size()));
@@ -44,6 +44,12 @@ Copyright_License {
 #include "Util/StaticString.hxx"
 #include "Util/StringAPI.hxx"
 #include "Util/StringCompare.hxx"
+#include "Job/Job.hpp"
+
+#ifdef USE_GEOTIFF
+#include "Screen/Custom/LibTiff.hpp"
+#include "Screen/Custom/UncompressedImage.hpp"
+#endif
 
 #include <vector>
 
@@ -322,6 +328,62 @@ SetupOverlay(MapOverlayBitmap &bmp, Path::const_pointer name)
   }
 }
 
+#ifdef USE_GEOTIFF
+
+/**
+ * Decodes a GeoTIFF file.  This is done in a job thread, because
+ * large overlays take a while to decode.
+ */
+class DecodeGeoTiffJob final : public Job {
+  const Path path;
+
+  std::pair<UncompressedImage, GeoQuadrilateral> result;
+
+public:
+  explicit DecodeGeoTiffJob(Path _path):path(_path) {}
+
+  std::pair<UncompressedImage, GeoQuadrilateral> &GetResult() {
+    return result;
+  }
+
+  /* virtual methods from class Job */
+  void Run(OperationEnvironment &env) override {
+    result = LoadGeoTiff(path);
+  }
+};
+
+/**
+ * Decode the GeoTIFF in a job thread, and create the #Bitmap (which
+ * must be done in the main thread) from the result.
+ *
+ * @return the overlay or nullptr if the job was cancelled
+ */
+static std::unique_ptr<MapOverlayBitmap>
+LoadGeoTiffOverlay(Path path)
+{
+  DecodeGeoTiffJob job(path);
+
+  DialogJobRunner runner(UIGlobals::GetMainWindow(),
+                         UIGlobals::GetDialogLook(),
+                         _("Weather"), true);
+  if (!runner.Run(job))
+    return nullptr;
+
+  auto &result = job.GetResult();
+
+  Bitmap bitmap;
+  if (!bitmap.Load(std::move(result.first)))
+    throw std::runtime_error("Failed to use geo image file");
+
+  const Path base = path.GetBase();
+  const TCHAR *name = (base != nullptr ? base : path).c_str();
+  return std::unique_ptr<MapOverlayBitmap>(new MapOverlayBitmap(std::move(bitmap),
+                                                                result.second,
+                                                                name));
+}
+
+#endif
+
 void
 WeatherMapOverlayListWidget::SetOverlay(Path path, const TCHAR *label)
 {
@@ -331,12 +393,22 @@ WeatherMapOverlayListWidget::SetOverlay(Path path, const TCHAR *label)
 
   std::unique_ptr<MapOverlayBitmap> bmp;
   try {
-    bmp.reset(new MapOverlayBitmap(path));
+#ifdef USE_GEOTIFF
+    if (path.MatchesExtension(_T(".tif")) ||
+        path.MatchesExtension(_T(".tiff")))
+      bmp = LoadGeoTiffOverlay(path);
+    else
+#endif
+      bmp.reset(new MapOverlayBitmap(path));
   } catch (const std::exception &e) {
     ShowError(e, _("Weather"));
     return;
   }
 
+  if (!bmp)
+    /* cancelled */
+    return;
+
   SetupOverlay(*bmp, path.GetBase().c_str());
 
   if (label != nullptr)
@@ -53,7 +53,8 @@ BitmapDialog(const Bitmap &bitmap)
 }
 
 static void
-BitmapDialog(const PCMet::ImageType &type, const PCMet::ImageArea &area)
+BitmapDialog(const PCMet::ImageType &type, const PCMet::ImageArea &area,
+             PCMet::ImageCache &cache)
 {
   const auto &settings = CommonInterface::GetComputerSettings().weather.pcmet;
 
@@ -62,15 +63,16 @@ BitmapDialog(const PCMet::ImageType &type, const PCMet::ImageArea &area)
                          _("Download"), true);
 
   try {
-    Bitmap bitmap = PCMet::DownloadLatestImage(type.uri, area.name,
-                                               settings, runner);
-    if (!bitmap.IsDefined()) {
+    const Bitmap *bitmap = PCMet::DownloadLatestImage(type.uri, area.name,
+                                                      settings, cache,
+                                                      runner);
+    if (bitmap == nullptr) {
       ShowMessageBox(_("Failed to download file."),
                      _T("pc_met"), MB_OK);
       return;
     }
 
-    BitmapDialog(bitmap);
+    BitmapDialog(*bitmap);
   } catch (const std::exception &exception) {
     ShowError(exception, _T("pc_met"));
   }
@@ -80,6 +82,8 @@ class ImageAreaListWidget final : public TextListWidget {
   const PCMet::ImageType *type = nullptr;
   const PCMet::ImageArea *areas = nullptr;
 
+  PCMet::ImageCache cache;
+
 public:
   void SetType(const PCMet::ImageType *_type) {
     if (_type == type)
@@ -110,7 +114,7 @@ protected:
   }
 
   virtual void OnActivateItem(unsigned index) override {
-    BitmapDialog(*type, areas[index]);
+    BitmapDialog(*type, areas[index], cache);
   }
 };
 
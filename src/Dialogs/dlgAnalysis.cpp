@@ -148,6 +148,11 @@ class AnalysisWidget final : public NullWidget, ActionListener, Timer {
   Button details_button, previous_button, next_button, close_button;
   ChartControl chart;
 
+  /**
+   * The FlightStatistics::GetSerial() value at the last Update().
+   */
+  Serial chart_serial;
+
 public:
   AnalysisWidget(WndForm &_dialog, const Look &look,
                  const Airspaces *airspaces,
@@ -174,6 +179,9 @@ public:
 private:
   void OnCalcClicked();
 
+  gcc_pure
+  bool IsChartUpToDate() const;
+
 protected:
   /* virtual methods from class Widget */
   void Prepare(ContainerWindow &parent, const PixelRect &rc) override;
@@ -241,7 +249,8 @@ private:
 
   /* virtual methods from class Timer */
   void OnTimer() override {
-    Update();
+    if (!IsChartUpToDate())
+      Update();
   }
 };
 
@@ -461,11 +470,42 @@ ChartControl::UpdateCrossSection(const MoreData &basic,
     cross_section_renderer.SetInvalid();
 }
 
+/**
+ * Does the chart on this page depend only on #FlightStatistics, the
+ * task and the settings?  These are not modified while the aircraft
+ * is on the ground, unless the user edits them from this dialog.
+ */
+gcc_const
+static bool
+IsFlightStatisticsPage(AnalysisPage page)
+{
+  switch (page) {
+  case AnalysisPage::BAROGRAPH:
+  case AnalysisPage::CLIMB:
+  case AnalysisPage::VARIO_HISTOGRAM:
+  case AnalysisPage::TASK_SPEED:
+    return true;
+
+  default:
+    return false;
+  }
+}
+
+bool
+AnalysisWidget::IsChartUpToDate() const
+{
+  return IsFlightStatisticsPage(page) &&
+    !blackboard.Calculated().flight.flying &&
+    glide_computer.GetFlightStats().GetSerial() == chart_serial;
+}
+
 void
 AnalysisWidget::Update()
 {
   TCHAR sTmp[1000];
 
+  chart_serial = glide_computer.GetFlightStats().GetSerial();
+
   const ComputerSettings &settings_computer = blackboard.GetComputerSettings();
   const DerivedInfo &calculated = blackboard.Calculated();
 
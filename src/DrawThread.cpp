@@ -27,6 +27,7 @@ Copyright_License {
 
 #include "MapWindow/GlueMapWindow.hpp"
 #include "Hardware/CPU.hpp"
+#include "Thread/Policy.hpp"
 
 /**
  * Main loop of the DrawThread
@@ -34,7 +35,7 @@ Copyright_License {
 void
 DrawThread::Run()
 {
-  SetLowPriority();
+  ApplyThreadPolicy(ThreadRole::DRAW);
 
   const ScopeLock lock(mutex);
 
@@ -45,7 +46,20 @@ DrawThread::Run()
       continue;
     }
 
+    const unsigned min_wait_time = power_saving
+      ? POWER_SAVING_WAIT_TIME
+      : MIN_WAIT_TIME;
+    const int elapsed = frame_clock.Elapsed();
+    if (elapsed >= 0 && unsigned(elapsed) < min_wait_time) {
+      /* limit the frame rate; this gives the other threads some air
+         while data arrives quickly, and the next frame shows the
+         newest data anyway */
+      command_trigger.timed_wait(mutex, min_wait_time - elapsed);
+      continue;
+    }
+
     pending = false;
+    frame_clock.Update();
 
     const ScopeUnlock unlock(mutex);
 
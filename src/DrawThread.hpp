@@ -25,6 +25,7 @@ Copyright_License {
 #define XCSOAR_DRAW_THREAD_HPP
 
 #include "Thread/RecursivelySuspensibleThread.hpp"
+#include "Time/PeriodClock.hpp"
 
 class GlueMapWindow;
 
@@ -37,14 +38,35 @@ class GlueMapWindow;
  * 
  */
 class DrawThread final : public RecursivelySuspensibleThread {
+  /**
+   * The minimum time between the start of two frames [ms].  Redraw
+   * requests arriving faster than that are merged into one frame.
+   */
   static constexpr unsigned MIN_WAIT_TIME = 100;
 
+  /**
+   * The minimum time between two frames [ms] in power saving mode.
+   * Each frame locks the CPU at its highest frequency (see
+   * #ScopeLockCPU), therefore fewer frames save battery.
+   */
+  static constexpr unsigned POWER_SAVING_WAIT_TIME = 500;
+
+  /**
+   * Is the power saving mode enabled?  Protected by the mutex.
+   */
+  bool power_saving = false;
+
   /**
    * Is work pending?  This flag gets cleared by the thread as soon as
    * it starts working.
    */
   bool pending = true;
 
+  /**
+   * The time stamp of the start of the last frame.
+   */
+  PeriodClock frame_clock;
+
   /** Pointer to the MapWindow */
   GlueMapWindow &map;
 
@@ -61,6 +83,15 @@ public:
     command_trigger.signal();
   }
 
+  /**
+   * Enable or disable the power saving mode, which limits the frame
+   * rate further.  This is used when running on battery.
+   */
+  void SetPowerSaving(bool _power_saving) {
+    const ScopeLock lock(mutex);
+    power_saving = _power_saving;
+  }
+
 protected:
   virtual void Run();
 };
@@ -23,6 +23,8 @@
 #include "AirspacePolygon.hpp"
 #include "Geo/Flat/FlatProjection.hpp"
 #include "Geo/Flat/FlatRay.hpp"
+#include "Geo/Flat/FlatBoundingBox.hpp"
+#include "Math/Line2D.hpp"
 #include "AirspaceIntersectSort.hpp"
 #include "AirspaceIntersectionVector.hpp"
 
@@ -51,6 +53,15 @@ AirspacePolygon::AirspacePolygon(const std::vector<GeoPoint> &pts,
   } else {
     is_convex = TriState::UNKNOWN;
   }
+
+  edges.SetGeo(m_border);
+}
+
+void
+AirspacePolygon::Project(const FlatProjection &projection)
+{
+  AbstractAirspace::Project(projection);
+  edges.SetFlat(m_border);
 }
 
 const GeoPoint
@@ -79,10 +90,52 @@ AirspacePolygon::GetCenter() const
   return GeoPoint(Angle::Native(lon), Angle::Native(lat));
 }
 
+/**
+ * Tests if a point is left (>0), on (=0) or right (<0) of the
+ * infinite line through P0 and P1.  Same as in PolygonInterior().
+ */
+static double
+IsLeft(const GeoPoint &p0, const GeoPoint &p1, const GeoPoint &p2)
+{
+  return Line2D<Point2D<double>>({p0.longitude.Native(), p0.latitude.Native()},
+                                 {p1.longitude.Native(), p1.latitude.Native()})
+    .LocatePoint({p2.longitude.Native(), p2.latitude.Native()});
+}
+
 bool
 AirspacePolygon::Inside(const GeoPoint &loc) const
 {
-  return m_border.IsInside(loc);
+  /* the winding number test of PolygonInterior(), but only edges
+     crossing the latitude can change the winding number, and those
+     are found by the SIMD kernel */
+  const unsigned n = edges.GetEdgeCount();
+  if (n < 2)
+    return false;
+
+  const double latitude = loc.latitude.Native();
+  int wn = 0;
+
+  for (unsigned first = 0; first < n;
+       first += AirspacePolygonEdges::CHUNK_SIZE) {
+    for (uint64_t mask = edges.LatitudeCrossingMask(latitude, first);
+         mask != 0; mask &= mask - 1) {
+      const unsigned i = first + __builtin_ctzll(mask);
+      const GeoPoint &a = m_border[i].GetLocation();
+      const GeoPoint &b = m_border[i + 1].GetLocation();
+
+      if (a.latitude <= loc.latitude) {
+        // an upward crossing
+        if (IsLeft(a, b, loc) > 0)
+          ++wn;
+      } else {
+        // a downward crossing
+        if (IsLeft(a, b, loc) < 0)
+          --wn;
+      }
+    }
+  }
+
+  return wn != 0;
 }
 
 AirspaceIntersectionVector
@@ -94,12 +147,34 @@ AirspacePolygon::Intersects(const GeoPoint &start, const GeoPoint &end,
 
   AirspaceIntersectSort sorter(start, *this);
 
-  for (auto it = m_border.begin(); it + 1 != m_border.end(); ++it) {
+  const unsigned n = edges.GetEdgeCount();
+  if (!edges.IsProjected() || n == 0) {
+    for (auto it = m_border.begin(); it + 1 != m_border.end(); ++it) {
+      const FlatRay r_seg(it->GetFlatLocation(), (it + 1)->GetFlatLocation());
+      auto t = ray.DistinctIntersection(r_seg);
+      if (t >= 0)
+        sorter.add(t, projection.Unproject(ray.Parametric(t)));
+    }
+
+    return sorter.all();
+  }
 
-    const FlatRay r_seg(it->GetFlatLocation(), (it + 1)->GetFlatLocation());
-    auto t = ray.DistinctIntersection(r_seg);
-    if (t >= 0)
-      sorter.add(t, projection.Unproject(ray.Parametric(t)));
+  /* only edges whose bounding box overlaps the ray's can intersect
+     it; the SIMD kernel culls all others */
+  FlatBoundingBox box(ray.point);
+  box.Expand(ray.point + ray.vector);
+
+  for (unsigned first = 0; first < n;
+       first += AirspacePolygonEdges::CHUNK_SIZE) {
+    for (uint64_t mask = edges.BoundsOverlapMask(box, first);
+         mask != 0; mask &= mask - 1) {
+      const unsigned i = first + __builtin_ctzll(mask);
+      const FlatRay r_seg(m_border[i].GetFlatLocation(),
+                          m_border[i + 1].GetFlatLocation());
+      auto t = ray.DistinctIntersection(r_seg);
+      if (t >= 0)
+        sorter.add(t, projection.Unproject(ray.Parametric(t)));
+    }
   }
 
   return sorter.all();
@@ -0,0 +1,207 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#include "AirspacePolygonEdges.hpp"
+#include "Geo/Flat/FlatBoundingBox.hpp"
+
+#include <assert.h>
+
+#ifdef __ARM_NEON__
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+static constexpr unsigned
+PaddedSize(unsigned n_edges)
+{
+  /* one chunk may read one vertex past its last edge */
+  return (n_edges + AirspacePolygonEdges::CHUNK_SIZE - 1)
+    / AirspacePolygonEdges::CHUNK_SIZE * AirspacePolygonEdges::CHUNK_SIZE
+    + 1;
+}
+
+/**
+ * Clear the bits of edges beyond the end of the polygon.
+ */
+static constexpr uint64_t
+MaskTail(uint64_t mask, unsigned first, unsigned n_edges)
+{
+  return n_edges - first < AirspacePolygonEdges::CHUNK_SIZE
+    ? mask & ((uint64_t(1) << (n_edges - first)) - 1)
+    : mask;
+}
+
+void
+AirspacePolygonEdges::SetGeo(const SearchPointVector &border)
+{
+  n_edges = border.size() >= 2 ? border.size() - 1 : 0;
+
+  latitudes.clear();
+  latitudes.reserve(PaddedSize(n_edges));
+  for (const auto &i : border)
+    latitudes.push_back(i.GetLocation().latitude.Native());
+
+  if (!latitudes.empty())
+    latitudes.resize(PaddedSize(n_edges), latitudes.back());
+}
+
+void
+AirspacePolygonEdges::SetFlat(const SearchPointVector &border)
+{
+  assert(border.size() == n_edges + 1 || n_edges == 0);
+
+  x.clear();
+  y.clear();
+  x.reserve(PaddedSize(n_edges));
+  y.reserve(PaddedSize(n_edges));
+  for (const auto &i : border) {
+    x.push_back(i.GetFlatLocation().x);
+    y.push_back(i.GetFlatLocation().y);
+  }
+
+  if (!x.empty()) {
+    x.resize(PaddedSize(n_edges), x.back());
+    y.resize(PaddedSize(n_edges), y.back());
+  }
+}
+
+uint64_t
+AirspacePolygonEdges::LatitudeCrossingMask(double latitude,
+                                           unsigned first) const
+{
+  assert(first < n_edges);
+
+  const double *p = latitudes.data() + first;
+  uint64_t mask = 0;
+
+#if defined(__SSE2__) && !defined(__ARM_NEON__)
+  const __m128d l = _mm_set1_pd(latitude);
+  for (unsigned j = 0; j < CHUNK_SIZE; j += 2) {
+    const __m128d a = _mm_cmple_pd(_mm_loadu_pd(p + j), l);
+    const __m128d b = _mm_cmple_pd(_mm_loadu_pd(p + j + 1), l);
+    mask |= uint64_t(_mm_movemask_pd(_mm_xor_pd(a, b))) << j;
+  }
+#else
+  /* ARMv7 NEON has no double precision vectors */
+  for (unsigned j = 0; j < CHUNK_SIZE; ++j)
+    mask |= uint64_t((p[j] <= latitude) != (p[j + 1] <= latitude)) << j;
+#endif
+
+  return MaskTail(mask, first, n_edges);
+}
+
+#ifdef __ARM_NEON__
+
+/**
+ * Returns a mask of the edges [i, i+4) whose bounding box is entirely
+ * on one side of the given box.
+ */
+gcc_always_inline
+static inline unsigned
+NEONRejectBounds4(const int32_t *x, const int32_t *y,
+                  int32x4_t left, int32x4_t right,
+                  int32x4_t bottom, int32x4_t top)
+{
+  const int32x4_t x0 = vld1q_s32(x), x1 = vld1q_s32(x + 1);
+  const int32x4_t y0 = vld1q_s32(y), y1 = vld1q_s32(y + 1);
+
+  uint32x4_t reject =
+    vandq_u32(vcltq_s32(x0, left), vcltq_s32(x1, left));
+  reject = vorrq_u32(reject,
+                     vandq_u32(vcgtq_s32(x0, right), vcgtq_s32(x1, right)));
+  reject = vorrq_u32(reject,
+                     vandq_u32(vcltq_s32(y0, bottom), vcltq_s32(y1, bottom)));
+  reject = vorrq_u32(reject,
+                     vandq_u32(vcgtq_s32(y0, top), vcgtq_s32(y1, top)));
+
+  /* collapse the lane masks to four bits */
+  static const uint32_t bits[4] = { 1, 2, 4, 8 };
+  const uint32x4_t b = vandq_u32(reject, vld1q_u32(bits));
+  uint32x2_t s = vpadd_u32(vget_low_u32(b), vget_high_u32(b));
+  s = vpadd_u32(s, s);
+  return vget_lane_u32(s, 0);
+}
+
+#elif defined(__SSE2__)
+
+gcc_always_inline
+static inline unsigned
+SSE2RejectBounds4(const int32_t *x, const int32_t *y,
+                  __m128i left, __m128i right,
+                  __m128i bottom, __m128i top)
+{
+  const __m128i x0 = _mm_loadu_si128((const __m128i *)x);
+  const __m128i x1 = _mm_loadu_si128((const __m128i *)(x + 1));
+  const __m128i y0 = _mm_loadu_si128((const __m128i *)y);
+  const __m128i y1 = _mm_loadu_si128((const __m128i *)(y + 1));
+
+  __m128i reject =
+    _mm_and_si128(_mm_cmplt_epi32(x0, left), _mm_cmplt_epi32(x1, left));
+  reject = _mm_or_si128(reject, _mm_and_si128(_mm_cmpgt_epi32(x0, right),
+                                              _mm_cmpgt_epi32(x1, right)));
+  reject = _mm_or_si128(reject, _mm_and_si128(_mm_cmplt_epi32(y0, bottom),
+                                              _mm_cmplt_epi32(y1, bottom)));
+  reject = _mm_or_si128(reject, _mm_and_si128(_mm_cmpgt_epi32(y0, top),
+                                              _mm_cmpgt_epi32(y1, top)));
+
+  return _mm_movemask_ps(_mm_castsi128_ps(reject));
+}
+
+#endif
+
+uint64_t
+AirspacePolygonEdges::BoundsOverlapMask(const FlatBoundingBox &box,
+                                        unsigned first) const
+{
+  assert(first < n_edges);
+  assert(x.size() == PaddedSize(n_edges));
+
+  const int32_t *px = x.data() + first, *py = y.data() + first;
+  const int32_t left = box.GetLowerLeft().x, right = box.GetUpperRight().x;
+  const int32_t bottom = box.GetLowerLeft().y, top = box.GetUpperRight().y;
+
+  uint64_t reject = 0;
+
+#ifdef __ARM_NEON__
+  const int32x4_t l = vdupq_n_s32(left), r = vdupq_n_s32(right);
+  const int32x4_t b = vdupq_n_s32(bottom), t = vdupq_n_s32(top);
+  for (unsigned j = 0; j < CHUNK_SIZE; j += 4)
+    reject |= uint64_t(NEONRejectBounds4(px + j, py + j, l, r, b, t)) << j;
+#elif defined(__SSE2__)
+  const __m128i l = _mm_set1_epi32(left), r = _mm_set1_epi32(right);
+  const __m128i b = _mm_set1_epi32(bottom), t = _mm_set1_epi32(top);
+  for (unsigned j = 0; j < CHUNK_SIZE; j += 4)
+    reject |= uint64_t(SSE2RejectBounds4(px + j, py + j, l, r, b, t)) << j;
+#else
+  for (unsigned j = 0; j < CHUNK_SIZE; ++j) {
+    const bool r = (px[j] < left && px[j + 1] < left) ||
+      (px[j] > right && px[j + 1] > right) ||
+      (py[j] < bottom && py[j + 1] < bottom) ||
+      (py[j] > top && py[j + 1] > top);
+    reject |= uint64_t(r) << j;
+  }
+#endif
+
+  return MaskTail(~reject, first, n_edges);
+}
@@ -0,0 +1,102 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#ifndef XCSOAR_AIRSPACE_POLYGON_EDGES_HPP
+#define XCSOAR_AIRSPACE_POLYGON_EDGES_HPP
+
+#include "Geo/SearchPointVector.hpp"
+#include "Compiler.h"
+
+#include <vector>
+
+#include <stdint.h>
+
+struct FlatBoundingBox;
+
+/**
+ * A copy of a closed polygon border with the coordinates stored in
+ * separate arrays, so the per-edge tests of #AirspacePolygon can be
+ * done several edges at a time with ARM NEON or SSE2.  They only
+ * cull edges which cannot matter; the exact test is then done by the
+ * caller on the remaining ones.
+ *
+ * Edges are processed in chunks of #CHUNK_SIZE: each method returns
+ * a bit mask for the edges [first, first+CHUNK_SIZE), where edge i
+ * goes from vertex i to vertex i+1.
+ */
+class AirspacePolygonEdges {
+public:
+  static constexpr unsigned CHUNK_SIZE = 64;
+
+private:
+  unsigned n_edges = 0;
+
+  /**
+   * The flat coordinates of all vertices, padded with copies of the
+   * last one, so whole SIMD vectors can be loaded at any chunk.
+   */
+  std::vector<int32_t> x, y;
+
+  std::vector<double> latitudes;
+
+public:
+  unsigned GetEdgeCount() const {
+    return n_edges;
+  }
+
+  /**
+   * Has SetFlat() been called?
+   */
+  bool IsProjected() const {
+    return !x.empty();
+  }
+
+  /**
+   * Copy the geographic coordinates of the (closed) border.
+   */
+  void SetGeo(const SearchPointVector &border);
+
+  /**
+   * Copy the flat coordinates of the border after it has been
+   * projected.
+   */
+  void SetFlat(const SearchPointVector &border);
+
+  /**
+   * Which edges cross the given latitude, i.e. have one vertex at or
+   * south of it and the other one north of it?
+   */
+  gcc_pure
+  uint64_t LatitudeCrossingMask(double latitude, unsigned first) const;
+
+  /**
+   * Which edges have a bounding box overlapping the given one?  An
+   * edge can only intersect a ray inside the box if this bit is set.
+   * Requires SetFlat().
+   */
+  gcc_pure
+  uint64_t BoundsOverlapMask(const FlatBoundingBox &box,
+                             unsigned first) const;
+};
+
+#endif
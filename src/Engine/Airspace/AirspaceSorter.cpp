@@ -1,7 +1,6 @@
 #include "AirspaceSorter.hpp"
 #include "Airspace/Airspaces.hpp"
 #include "AbstractAirspace.hpp"
-#include "Predicate/AirspacePredicate.hpp"
 #include "Geo/GeoVector.hpp"
 #include "Util/StringAPI.hxx"
 
@@ -26,9 +25,7 @@ AirspaceSelectInfo::GetVector(const GeoPoint &location,
 }
 
 bool
-AirspaceFilterData::Match(const GeoPoint &location,
-                          const FlatProjection &projection,
-                          const AbstractAirspace &as) const
+AirspaceFilterData::MatchAttributes(const AbstractAirspace &as) const
 {
   if (cls != AirspaceClass::AIRSPACECLASSCOUNT && as.GetType() != cls)
     return false;
@@ -36,39 +33,39 @@ AirspaceFilterData::Match(const GeoPoint &location,
   if (name_prefix != nullptr && !as.MatchNamePrefix(name_prefix))
     return false;
 
+  return true;
+}
+
+bool
+AirspaceFilterData::MatchVector(const GeoVector &vector) const
+{
   if (!direction.IsNegative()) {
-    const auto closest = as.ClosestPoint(location, projection);
-    const auto bearing = location.Bearing(closest);
-    auto direction_error = (bearing - direction).AsDelta().AbsoluteDegrees();
+    auto direction_error =
+      (vector.bearing - direction).AsDelta().AbsoluteDegrees();
     if (direction_error > 18)
       return false;
   }
 
-  if (distance >= 0) {
-    const auto closest = as.ClosestPoint(location, projection);
-    const auto distance = location.Distance(closest);
-    if (distance > distance)
-      return false;
-  }
+  if (distance >= 0 && vector.distance > distance)
+    return false;
 
   return true;
 }
 
-class AirspaceFilterPredicate final : public AirspacePredicate {
-  const GeoPoint location;
-  const FlatProjection &projection;
-  const AirspaceFilterData &filter;
+bool
+AirspaceFilterData::Match(const GeoPoint &location,
+                          const FlatProjection &projection,
+                          const AbstractAirspace &as) const
+{
+  if (!MatchAttributes(as))
+    return false;
 
-public:
-  AirspaceFilterPredicate(const GeoPoint &_location,
-                          const FlatProjection &_projection,
-                          const AirspaceFilterData &_filter)
-    :location(_location), projection(_projection), filter(_filter) {}
+  if (!NeedsVector())
+    return true;
 
-  bool operator()(const AbstractAirspace &as) const override {
-    return filter.Match(location, projection, as);
-  }
-};
+  const auto closest = as.ClosestPoint(location, projection);
+  return MatchVector(GeoVector(location, closest));
+}
 
 static void
 SortByDistance(AirspaceSelectInfoVector &vec, const GeoPoint &location,
@@ -99,21 +96,31 @@ AirspaceSelectInfoVector
 FilterAirspaces(const Airspaces &airspaces, const GeoPoint &location,
                 const AirspaceFilterData &filter)
 {
-  const AirspaceFilterPredicate predicate(location, airspaces.GetProjection(),
-                                          filter);
+  const FlatProjection &projection = airspaces.GetProjection();
   AirspaceSelectInfoVector result;
 
   auto range = filter.distance < 0
     ? airspaces.QueryAll()
     : airspaces.QueryWithinRange(location, filter.distance);
-  for (const auto &i : range)
-    if (predicate(i.GetAirspace()))
-      result.emplace_back(i.GetAirspace());
+  for (const auto &i : range) {
+    const AbstractAirspace &as = i.GetAirspace();
+    if (!filter.MatchAttributes(as))
+      continue;
+
+    result.emplace_back(as);
+
+    /* the closest point is calculated only once per airspace; the
+       vector remains cached in the AirspaceSelectInfo for
+       SortByDistance() */
+    if (filter.NeedsVector() &&
+        !filter.MatchVector(result.back().GetVector(location, projection)))
+      result.pop_back();
+  }
 
   if (filter.direction.IsNegative() && filter.distance < 0)
     SortByName(result);
   else
-    SortByDistance(result, location, airspaces.GetProjection());
+    SortByDistance(result, location, projection);
 
   return result;
 }
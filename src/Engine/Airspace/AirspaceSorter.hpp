@@ -71,10 +71,32 @@ struct AirspaceFilterData {
     distance = -1;
   }
 
+  /**
+   * Do the direction or distance filters need the vector to the
+   * closest point of the airspace?
+   */
+  bool NeedsVector() const {
+    return !direction.IsNegative() || distance >= 0;
+  }
+
   gcc_pure
   bool Match(const GeoPoint &location,
              const FlatProjection &projection,
              const AbstractAirspace &as) const;
+
+  /**
+   * Check the filters which only depend on the airspace itself (class
+   * and name).
+   */
+  gcc_pure
+  bool MatchAttributes(const AbstractAirspace &as) const;
+
+  /**
+   * Check the filters which depend on the vector from the aircraft to
+   * the closest point of the airspace (direction and distance).
+   */
+  gcc_pure
+  bool MatchVector(const GeoVector &vector) const;
 };
 
 /**
@@ -27,9 +27,18 @@
 #include "AirspaceIntersectionVisitor.hpp"
 #include "AirspaceAircraftPerformance.hpp"
 #include "Task/Stats/TaskStats.hpp"
+#include "Util/AllocationStats.hpp"
+#include "Util/GlobalSliceAllocator.hpp"
 
 #define CRUISE_FILTER_FACT 0.5
 
+/**
+ * Only this fraction of the distance to an airspace outline is
+ * trusted when skipping intersection tests; this absorbs the error
+ * of the flat projection used by AbstractAirspace::ClosestPoint().
+ */
+static constexpr double CLEARANCE_FACTOR = 0.9;
+
 AirspaceWarningManager::AirspaceWarningManager(const AirspaceWarningConfig &_config,
                                                const Airspaces &_airspaces)
   :airspaces(_airspaces), serial(0)
@@ -65,6 +74,7 @@ AirspaceWarningManager::Reset(const AircraftState &state)
 {
   ++serial;
   warnings.clear();
+  clearances.clear();
   cruise_filter.Reset(state);
   circling_filter.Reset(state);
 }
@@ -123,6 +133,8 @@ AirspaceWarningManager::Update(const AircraftState& state,
                                const bool circling,
                                const unsigned dt)
 {
+  const ScopeAllocationTag alloc_tag(AllocationTag::AIRSPACE);
+
   bool changed = false;
 
   // update warning states
@@ -132,6 +144,12 @@ AirspaceWarningManager::Update(const AircraftState& state,
     return false;
   }
 
+  if (airspaces.GetSerial() != clearances_serial) {
+    /* the airspace pointers may have become stale */
+    clearances.clear();
+    clearances_serial = airspaces.GetSerial();
+  }
+
   // save old state
   for (auto &w : warnings)
     w.SaveState();
@@ -269,6 +287,39 @@ private:
   }
 };
 
+void
+AirspaceWarningManager::VisitIntersecting(const GeoPoint &location,
+                                          const GeoPoint &location_predicted,
+                                          AirspaceIntersectionVisitor &visitor)
+{
+  const FlatProjection &projection = airspaces.GetProjection();
+  const auto length = location.Distance(location_predicted);
+
+  for (const auto &i : airspaces.QueryIntersecting(location,
+                                                   location_predicted)) {
+    const AbstractAirspace &airspace = i.GetAirspace();
+
+    auto c = clearances.find(&airspace);
+    if (c != clearances.end()) {
+      if (c->second.origin.Distance(location) + length < c->second.distance)
+        /* still clear of the outline */
+        continue;
+
+      clearances.erase(c);
+    }
+
+    if (visitor.SetIntersections(i.Intersects(location, location_predicted,
+                                              projection))) {
+      visitor.Visit(airspace);
+      continue;
+    }
+
+    const auto distance = CLEARANCE_FACTOR *
+      location.Distance(airspace.ClosestPoint(location, projection));
+    if (distance > length)
+      clearances.emplace(&airspace, Clearance{location, distance});
+  }
+}
 
 bool 
 AirspaceWarningManager::UpdatePredicted(const AircraftState& state, 
@@ -299,7 +350,7 @@ AirspaceWarningManager::UpdatePredicted(const AircraftState& state,
                                              warning_state, max_time_limit,
                                              ceiling);
 
-  airspaces.VisitIntersecting(state.location, location_predicted, visitor);
+  VisitIntersecting(state.location, location_predicted, visitor);
 
   visitor.SetMode(true);
 
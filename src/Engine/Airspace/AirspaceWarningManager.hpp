@@ -25,15 +25,20 @@
 #include "AirspaceWarning.hpp"
 #include "AirspaceWarningConfig.hpp"
 #include "Util/AircraftStateFilter.hpp"
+#include "Util/Serial.hpp"
+#include "Util/SliceAllocator.hpp"
+#include "Geo/GeoPoint.hpp"
 #include "Compiler.h"
 
 #include <list>
+#include <unordered_map>
 
 class TaskStats;
 class GlidePolar;
 class Airspaces;
 class FlatProjection;
 class AirspaceAircraftPerformance;
+class AirspaceIntersectionVisitor;
 
 /**
  * Class to detect and track airspace warnings
@@ -57,10 +62,37 @@ class AirspaceWarningManager {
   AircraftStateFilter cruise_filter;
   AircraftStateFilter circling_filter;
 
-  typedef std::list<AirspaceWarning> AirspaceWarningList;
+  /**
+   * Warnings are added and removed all the time during a flight;
+   * their nodes are kept in a pool to avoid heap fragmentation.
+   * This is only safe because there is just one instance, which is
+   * protected by #ProtectedAirspaceWarningManager.
+   */
+  typedef std::list<AirspaceWarning,
+                    GlobalSliceAllocator<AirspaceWarning, 64u>> AirspaceWarningList;
 
   AirspaceWarningList warnings;
 
+  /**
+   * The lateral clearance of an airspace which was found not to
+   * intersect a predicted path: the distance from #origin to the
+   * airspace outline.  As long as the aircraft position plus the
+   * length of the prediction stays within this distance of #origin,
+   * the predicted path cannot reach the outline, and the (expensive)
+   * intersection test is skipped.
+   */
+  struct Clearance {
+    GeoPoint origin;
+    double distance;
+  };
+
+  std::unordered_map<const AbstractAirspace *, Clearance> clearances;
+
+  /**
+   * The Airspaces::GetSerial() value #clearances was built for.
+   */
+  Serial clearances_serial;
+
   /**
    * This number is incremented each time this object is modified.
    */
@@ -267,6 +299,14 @@ private:
   bool UpdateGlide(const AircraftState& state, const GlidePolar &glide_polar);
   bool UpdateInside(const AircraftState& state, const GlidePolar &glide_polar);
 
+  /**
+   * Like Airspaces::VisitIntersecting(), but skip airspaces whose
+   * #clearances entry proves that they cannot be intersected.
+   */
+  void VisitIntersecting(const GeoPoint &location,
+                         const GeoPoint &location_predicted,
+                         AirspaceIntersectionVisitor &visitor);
+
   bool UpdatePredicted(const AircraftState& state, 
                        const GeoPoint &location_predicted,
                        const AirspaceAircraftPerformance &perf,
@@ -25,6 +25,7 @@
 #include "AirspaceIntersectionVisitor.hpp"
 #include "Predicate/AirspacePredicate.hpp"
 #include "Navigation/Aircraft.hpp"
+#include "Util/AllocationStats.hpp"
 
 #include <boost/geometry/geometries/linestring.hpp>
 
@@ -84,6 +85,8 @@ Airspaces::VisitIntersecting(const GeoPoint &loc, const GeoPoint &end,
 void
 Airspaces::Optimise()
 {
+  const ScopeAllocationTag alloc_tag(AllocationTag::AIRSPACE);
+
   if (IsEmpty())
     /* avoid assertion failure in uninitialised task_projection */
     return;
@@ -100,9 +103,25 @@ Airspaces::Optimise()
     airspace_tree.clear();
   }
 
-  for (AbstractAirspace *i : tmp_as) {
-    Airspace as(*i, task_projection);
-    airspace_tree.insert(as);
+  if (tmp_as.size() >= airspace_tree.size()) {
+    /* most items are new: bulk-load a packed tree (boost's STR
+       packing), which has much less node overlap than incremental R*
+       insertion and therefore visits fewer nodes per query */
+    AirspaceVector v;
+    v.reserve(airspace_tree.size() + tmp_as.size());
+
+    for (const auto &i : QueryAll())
+      v.push_back(i);
+
+    for (AbstractAirspace *i : tmp_as)
+      v.emplace_back(*i, task_projection);
+
+    airspace_tree = AirspaceTree(v.begin(), v.end());
+  } else {
+    for (AbstractAirspace *i : tmp_as) {
+      Airspace as(*i, task_projection);
+      airspace_tree.insert(as);
+    }
   }
 
   tmp_as.clear();
@@ -113,6 +132,8 @@ Airspaces::Optimise()
 void
 Airspaces::Add(AbstractAirspace *airspace)
 {
+  const ScopeAllocationTag alloc_tag(AllocationTag::AIRSPACE);
+
   if (!airspace)
     // nothing to add
     return;
@@ -248,10 +269,7 @@ Airspaces::SynchroniseInRange(const Airspaces &master,
 
   for (auto &i : QueryAll())
     i.ClearClearance();
-  airspace_tree.clear();
-
-  for (const auto &i : contents_master)
-    airspace_tree.insert(i);
+  airspace_tree = AirspaceTree(contents_master.begin(), contents_master.end());
 
   ++serial;
 
@@ -32,6 +32,8 @@
 
 #include <deque>
 
+#include <assert.h>
+
 class RasterTerrain;
 class AirspaceIntersectionVisitor;
 class AirspacePredicate;
@@ -100,6 +102,24 @@ public:
    */
   void Optimise();
 
+  /**
+   * Returns the number of airspaces which have been added since the
+   * last Optimise() call.
+   */
+  unsigned GetPendingSize() const {
+    return tmp_as.size();
+  }
+
+  /**
+   * Returns an airspace which has been added since the last
+   * Optimise() call.
+   */
+  const AbstractAirspace &GetPending(unsigned i) const {
+    assert(i < tmp_as.size());
+
+    return *tmp_as[i];
+  }
+
   /**
    * Clear the airspace store, deleting airspace objects if m_owner is true
    */
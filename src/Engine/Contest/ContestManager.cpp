@@ -94,13 +94,11 @@ ContestManager::SetHandicap(unsigned handicap)
 }
 
 static bool
-RunContest(AbstractContest &_contest,
-           ContestResult &result, ContestTraceVector &solution,
-           bool exhaustive)
+StoreResult(const AbstractContest &_contest, SolverResult r,
+            ContestResult &result, ContestTraceVector &solution)
 {
-  // run solver, return immediately if further processing is required
-  // by subsequent calls
-  SolverResult r = _contest.Solve(exhaustive);
+  // return immediately if further processing is required by
+  // subsequent calls
   if (r != SolverResult::VALID)
     return false;
 
@@ -116,8 +114,43 @@ RunContest(AbstractContest &_contest,
   return true;
 }
 
+static bool
+RunContest(AbstractContest &_contest,
+           ContestResult &result, ContestTraceVector &solution,
+           bool exhaustive)
+{
+  return StoreResult(_contest, _contest.Solve(exhaustive),
+                     result, solution);
+}
+
+/**
+ * Run two solvers which do not depend on each other, in parallel if
+ * a #ContestManager::SolverRunner was given.
+ */
+static bool
+RunContests(ContestManager::SolverRunner *runner,
+            AbstractContest &a,
+            ContestResult &result_a, ContestTraceVector &solution_a,
+            AbstractContest &b,
+            ContestResult &result_b, ContestTraceVector &solution_b,
+            bool exhaustive)
+{
+  if (runner == nullptr) {
+    bool retval = RunContest(a, result_a, solution_a, exhaustive);
+    retval |= RunContest(b, result_b, solution_b, exhaustive);
+    return retval;
+  }
+
+  SolverResult r_a, r_b;
+  runner->Solve(a, r_a, b, r_b, exhaustive);
+
+  bool retval = StoreResult(a, r_a, result_a, solution_a);
+  retval |= StoreResult(b, r_b, result_b, solution_b);
+  return retval;
+}
+
 bool
-ContestManager::UpdateIdle(bool exhaustive)
+ContestManager::UpdateIdle(bool exhaustive, SolverRunner *runner)
 {
   bool retval = false;
 
@@ -151,11 +184,10 @@ ContestManager::UpdateIdle(bool exhaustive)
     break;
 
   case Contest::OLC_PLUS:
-    retval = RunContest(olc_classic, stats.result[0],
-                        stats.solution[0], exhaustive);
-
-    retval |= RunContest(olc_fai, stats.result[1],
-                         stats.solution[1], exhaustive);
+    retval = RunContests(runner,
+                         olc_classic, stats.result[0], stats.solution[0],
+                         olc_fai, stats.result[1], stats.solution[1],
+                         exhaustive);
 
     if (retval) {
       olc_plus.Feed(stats.result[0], stats.solution[0],
@@ -173,17 +205,17 @@ ContestManager::UpdateIdle(bool exhaustive)
     break;
 
   case Contest::XCONTEST:
-    retval = RunContest(xcontest_free, stats.result[0],
-                        stats.solution[0], exhaustive);
-    retval |= RunContest(xcontest_triangle, stats.result[1],
-                         stats.solution[1], exhaustive);
+    retval = RunContests(runner,
+                         xcontest_free, stats.result[0], stats.solution[0],
+                         xcontest_triangle, stats.result[1], stats.solution[1],
+                         exhaustive);
     break;
 
   case Contest::DHV_XC:
-    retval = RunContest(dhv_xc_free, stats.result[0],
-                        stats.solution[0], exhaustive);
-    retval |= RunContest(dhv_xc_triangle, stats.result[1],
-                         stats.solution[1], exhaustive);
+    retval = RunContests(runner,
+                         dhv_xc_free, stats.result[0], stats.solution[0],
+                         dhv_xc_triangle, stats.result[1], stats.solution[1],
+                         exhaustive);
     break;
 
   case Contest::SIS_AT:
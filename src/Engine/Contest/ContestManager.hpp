@@ -37,6 +37,7 @@
 #include "ContestStatistics.hpp"
 
 class Trace;
+class AbstractContest;
 
 /**
  * Special task holder for Online Contest calculations
@@ -45,6 +46,27 @@ class ContestManager
 {
   friend class PrintHelper;
 
+public:
+  /**
+   * An interface which allows the caller to run two independent
+   * solvers concurrently.  The engine does not create threads by
+   * itself; the application may implement this with a worker
+   * thread (see #ContestComputer).
+   */
+  class SolverRunner {
+  public:
+    /**
+     * Call AbstractContest::Solve() on both solvers and return after
+     * both have finished.  The two solvers do not share any mutable
+     * state, and the traces they read are not modified meanwhile.
+     */
+    virtual void Solve(AbstractContest &a, SolverResult &result_a,
+                       AbstractContest &b, SolverResult &result_b,
+                       bool exhaustive) = 0;
+  };
+
+private:
+
   Contest contest;
 
   ContestStatistics stats;
@@ -102,12 +124,14 @@ public:
    *
    * @param exhaustive true to find the final solution, false stops
    * after a number of iterations (incremental search)
+   * @param runner an optional #SolverRunner which is used to solve
+   * contests consisting of two independent searches in parallel
    * @return True if internal state changed
    */
-  bool UpdateIdle(bool exhaustive = false);
+  bool UpdateIdle(bool exhaustive = false, SolverRunner *runner = nullptr);
 
-  bool SolveExhaustive() {
-    return UpdateIdle(true);
+  bool SolveExhaustive(SolverRunner *runner = nullptr) {
+    return UpdateIdle(true, runner);
   }
 
   /**
@@ -64,7 +64,8 @@ OLCTriangle::OLCTriangle(const Trace &_trace,
    is_closed(false),
    is_complete(false),
    max_iterations(1e6),
-   max_tree_size(5e5)
+   max_tree_size(5e5),
+   total_iterations(0), peak_tree_size(0)
 {
 }
 
@@ -79,7 +80,11 @@ OLCTriangle::Reset()
   // this should be adjusted when the trace size is known
   tick_iterations = 1000;
 
+  total_iterations = 0;
+  peak_tree_size = 0;
+
   closing_pairs.Clear();
+  solved_pairs.Clear();
   ClearTrace();
 
   ResetBranchAndBound();
@@ -120,6 +125,7 @@ OLCTriangle::UpdateTrace(bool force)
     best_d = 0;
 
     closing_pairs.Clear();
+    solved_pairs.Clear();
     is_closed = FindClosingPairs(0);
 
    } else if (is_complete && incremental) {
@@ -197,6 +203,11 @@ OLCTriangle::SolveTriangle(bool exhaustive)
         // this pair is already relaxed... continue with next
         continue;
 
+      auto already_solved = solved_pairs.FindRange(*closing_pair);
+      if (already_solved.first != 0 || already_solved.second != 0)
+        // this pair was searched completely in a previous run
+        continue;
+
       unsigned relax_first = closing_pair->first;
       unsigned relax_last = closing_pair->second;
 
@@ -220,7 +231,9 @@ OLCTriangle::SolveTriangle(bool exhaustive)
 
       std::tuple<unsigned, unsigned, unsigned, unsigned> triangle;
 
+      const bool was_running = running;
       triangle = RunBranchAndBound(relaxed_pair.first, relaxed_pair.second, best_d, exhaustive);
+      bool completed = !was_running && !running;
 
       if (std::get<3>(triangle) > best_d) {
         // solution is better than best_d
@@ -244,16 +257,26 @@ OLCTriangle::SolveTriangle(bool exhaustive)
                 closing_pair.second <= relaxed_pair.second)
               close_look.Insert(closing_pair);
          }
+
+          // the best triangle of this range is not a valid one,
+          // so it is not solved until the close look is done
+          completed = false;
        }
       }
+
+      if (completed)
+        solved_pairs.Insert(relaxed_pair);
     }
 
     for (const auto &close_look_pair : close_look.closing_pairs) {
       std::tuple<unsigned, unsigned, unsigned, unsigned> triangle;
 
+      const bool was_running = running;
       triangle = RunBranchAndBound(close_look_pair.first,
                                    close_look_pair.second,
                                    best_d, exhaustive);
+      if (!was_running && !running)
+        solved_pairs.Insert(close_look_pair);
 
       if (std::get<3>(triangle) > best_d) {
         // solution is better than best_d
@@ -359,6 +382,9 @@ OLCTriangle::RunBranchAndBound(unsigned from, unsigned to, unsigned worst_d, boo
      */
 
     iterations++;
+    total_iterations++;
+    peak_tree_size = std::max(peak_tree_size,
+                              (unsigned)branch_and_bound.size());
 
     // break loop if max_iterations or max_tree_size exceeded
     if (iterations > max_iterations || branch_and_bound.size() > max_tree_size)
@@ -91,6 +91,13 @@ private:
   unsigned max_iterations,
            max_tree_size;
 
+  /**
+   * Statistics since the last Reset(), for benchmarks: the total
+   * number of branch and bound iterations and the largest tree size.
+   */
+  unsigned long total_iterations;
+  unsigned peak_tree_size;
+
   typedef std::pair<unsigned, unsigned> ClosingPair;
 
   struct ClosingPairs {
@@ -140,6 +147,15 @@ private:
 
   ClosingPairs closing_pairs;
 
+  /**
+   * Ranges which have been searched completely with the current
+   * trace.  No triangle inside them is better than #best_d, and
+   * since an incremental update only appends points (and thus keeps
+   * all indices stable), they don't need to be searched again.  This
+   * is cleared whenever the trace is rebuilt from scratch.
+   */
+  ClosingPairs solved_pairs;
+
   /**
    * A bounding box around a range of trace points.
    */
@@ -360,6 +376,14 @@ public:
     max_tree_size = _max_tree_size;
   };
 
+  unsigned long GetTotalIterations() const {
+    return total_iterations;
+  }
+
+  unsigned GetPeakTreeSize() const {
+    return peak_tree_size;
+  }
+
   /* virtual methods from AbstractContest */
   void Reset() override;
   SolverResult Solve(bool exhaustive) override;
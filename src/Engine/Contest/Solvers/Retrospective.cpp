@@ -23,8 +23,16 @@
 #include "Retrospective.hpp"
 #include "Waypoint/Waypoints.hpp"
 
+/**
+ * The nearest waypoint is looked up again only after the aircraft has
+ * moved this far [m].  Compared with #search_range, this is far below
+ * the precision of the retrospective task.
+ */
+static constexpr double LOOKUP_DISTANCE = 250;
+
 Retrospective::Retrospective(const Waypoints &wps)
   :waypoints(wps),
+   lookup_location(GeoPoint::Invalid()),
    search_range(15000),
    angle_tolerance(Angle::Degrees(25))
 {
@@ -34,6 +42,21 @@ void
 Retrospective::Clear()
 {
   candidate_list.clear();
+  lookup_location = GeoPoint::Invalid();
+  lookup_result = nullptr;
+}
+
+WaypointPtr
+Retrospective::LookupNearWaypoint(const GeoPoint &aircraft_location)
+{
+  if (!lookup_location.IsValid() ||
+      lookup_location.Distance(aircraft_location) > LOOKUP_DISTANCE) {
+    lookup_location = aircraft_location;
+    lookup_result = waypoints.LookupLocation(aircraft_location,
+                                             search_range);
+  }
+
+  return lookup_result;
 }
 
 void
@@ -84,7 +107,7 @@ Retrospective::UpdateSample(const GeoPoint &aircraft_location)
 
   // retrospective task
 
-  auto waypoint = waypoints.LookupLocation(aircraft_location, search_range);
+  auto waypoint = LookupNearWaypoint(aircraft_location);
   // TODO actually need to find *all* in search range!
 
   // ignore if none found in search box
@@ -144,17 +167,9 @@ Retrospective::UpdateSample(const GeoPoint &aircraft_location)
 
   }
 
-  if (candidate_list.size()<2) {
-    return changed;
-  } else if (changed && (candidate_list.size() > 2)) {
+  if (changed && candidate_list.size() > 2)
     PruneCandidates();
-  }
 
-  if (changed) {
-    double d_ach = 0;
-    double d_can = 0;
-    CalcDistances(d_ach, d_can);
-  }
   return changed;
 }
 
@@ -81,8 +81,27 @@ protected:
 
   NearWaypointList candidate_list;
 
+  /**
+   * The location of the last waypoint lookup; invalid if there was
+   * none yet.
+   */
+  GeoPoint lookup_location;
+
+  /**
+   * The waypoint nearest to #lookup_location within #search_range,
+   * or nullptr if there is none.
+   */
+  WaypointPtr lookup_result;
+
   void PruneCandidates();
 
+  /**
+   * Find the waypoint nearest to the aircraft within #search_range.
+   * The quadtree is only queried again after the aircraft has moved
+   * away from the previous query location.
+   */
+  WaypointPtr LookupNearWaypoint(const GeoPoint &aircraft_location);
+
 public:
   const NearWaypointList& getNearWaypointList() const {
     return candidate_list;
@@ -108,6 +108,26 @@ GlidePolar::SetBallastLitres(const double litres)
   Update();
 }
 
+bool
+GlidePolar::operator==(const GlidePolar &other) const
+{
+  return mc == other.mc && inv_mc == other.inv_mc &&
+    bugs == other.bugs && ballast == other.ballast &&
+    cruise_efficiency == other.cruise_efficiency &&
+    bestLD == other.bestLD && VbestLD == other.VbestLD &&
+    SbestLD == other.SbestLD &&
+    Vmax == other.Vmax && Smax == other.Smax &&
+    Vmin == other.Vmin && Smin == other.Smin &&
+    ideal_polar.a == other.ideal_polar.a &&
+    ideal_polar.b == other.ideal_polar.b &&
+    ideal_polar.c == other.ideal_polar.c &&
+    polar.a == other.polar.a && polar.b == other.polar.b &&
+    polar.c == other.polar.c &&
+    ballast_ratio == other.ballast_ratio &&
+    reference_mass == other.reference_mass &&
+    dry_mass == other.dry_mass && wing_area == other.wing_area;
+}
+
 void
 GlidePolar::SetMC(const double _mc)
 {
@@ -145,6 +145,17 @@ public:
     return Vmin < Vmax;
   }
 
+  /**
+   * Do both objects describe the same polar with the same settings,
+   * i.e. will they yield the same results?
+   */
+  gcc_pure
+  bool operator==(const GlidePolar &other) const;
+
+  bool operator!=(const GlidePolar &other) const {
+    return !(*this == other);
+  }
+
   /**
    * Accesses minimum sink rate
    *
@@ -26,8 +26,13 @@
 #include "GlideResult.hpp"
 #include "Math/ZeroFinder.hpp"
 #include "Util/Tolerances.hpp"
+#include "Util/Clamp.hpp"
+#include "Math/Util.hpp"
+
+#include <algorithm>
 
 #include <assert.h>
+#include <math.h>
 
 MacCready::MacCready(const GlideSettings &_settings,
                      const GlidePolar &_glide_polar,
@@ -380,11 +385,102 @@ public:
   }
 };
 
+/**
+ * Find the speed which maximises the glide ratio over ground, i.e.
+ * minimises SinkRate(v) / GroundSpeed(v), without the numeric search
+ * done by #MacCreadyVopt.
+ *
+ * With the parabolic polar s(v) = a*v^2 + b*v + c and no cross wind,
+ * the optimum has a closed form.  A cross wind component is
+ * accounted for by a few Newton iterations on the derivative,
+ * starting at the closed form solution.
+ *
+ * @param head_wind the head wind component [m/s]
+ * @param cross_wind_squared the square of the cross wind component
+ * @return the optimal speed (clamped to the polar's speed range), or
+ * a negative value if no solution was found
+ */
+gcc_pure
+static double
+FindBestGlideSpeed(const GlidePolar &glide_polar,
+                   const double cruise_efficiency,
+                   const double head_wind, const double cross_wind_squared)
+{
+  const PolarCoefficients polar = glide_polar.GetCoefficients();
+  const double a = polar.a, b = polar.b, c = polar.c;
+  const double ce = cruise_efficiency;
+
+  if (a <= 0 || ce <= 0)
+    return -1;
+
+  /* closed form for pure head/tail wind: the root of
+     a*ce*v^2 - 2*a*h*v - b*h - c*ce = 0 */
+  const double s = head_wind * head_wind + ce * (b * head_wind + c * ce) / a;
+  if (s < 0)
+    return -1;
+
+  double v = (head_wind + sqrt(s)) / ce;
+
+  if (cross_wind_squared > 0) {
+    /* solve F(v) = s'(v)*g(v) - s(v)*g'(v) = 0 with the ground speed
+       g(v) = sqrt((ce*v)^2 - k) - h; this converges within a few
+       steps because the closed form is already close */
+    for (unsigned i = 0;; ++i) {
+      if (i == 8)
+        return -1;
+
+      const double u = ce * v;
+      const double r2 = u * u - cross_wind_squared;
+      if (r2 <= 0)
+        return -1;
+
+      const double r = sqrt(r2);
+      const double g = r - head_wind;
+      if (g <= 0)
+        return -1;
+
+      const double sink = (a * v + b) * v + c;
+      const double d_sink = 2 * a * v + b;
+      const double d_g = ce * u / r;
+      const double dd_g = -ce * ce * cross_wind_squared / (r2 * r);
+
+      const double f = d_sink * g - sink * d_g;
+      const double d_f = 2 * a * g - sink * dd_g;
+      if (d_f <= 0)
+        return -1;
+
+      const double step = f / d_f;
+      v -= step;
+
+      if (fabs(step) < TOLERANCE_MC_OPT_GLIDE)
+        break;
+    }
+  }
+
+  /* the glide ratio is unimodal, so the best speed inside the
+     polar's range is found by clamping */
+  return Clamp(v, glide_polar.GetVMin(), glide_polar.GetVMax());
+}
+
 GlideResult
 MacCready::OptimiseGlide(const GlideState &task, const bool allow_partial) const
 {
   assert(glide_polar.GetMC() <= 0);
 
+  if (!allow_partial || task.altitude_difference >= 0) {
+    const double cross_wind_squared =
+      std::max(Square(task.wind.norm) - Square(task.head_wind), 0.);
+    const double v = FindBestGlideSpeed(glide_polar, cruise_efficiency,
+                                        task.head_wind, cross_wind_squared);
+    if (v > 0) {
+      GlideResult result = SolveGlide(task, v, allow_partial);
+      if (result.IsOk())
+        return result;
+    }
+  }
+
+  /* fall back to a numeric search */
+
   MacCreadyVopt mc_vopt(task, *this,
                        glide_polar.GetVMin(), glide_polar.GetVMax(),
                        allow_partial);
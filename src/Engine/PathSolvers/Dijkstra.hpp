@@ -212,6 +212,28 @@ public:
       q.push(Value(i.second.value, i));
   }
 
+  /**
+   * Resume a search after some of its nodes have become obsolete:
+   * remove all nodes matching #erase from the edge map, and restart
+   * the queue with the remaining nodes matching #requeue.  The
+   * values and predecessors of the remaining nodes are kept.
+   */
+  template<typename E, typename R>
+  void Restart(E &&erase, R &&requeue) {
+    q.clear();
+    current_value = 0;
+
+    for (auto i = edges.begin(); i != edges.end();) {
+      if (erase(i->first)) {
+        i = edges.erase(i);
+      } else {
+        if (requeue(i->first))
+          q.push(Value(i->second.value, i));
+        ++i;
+      }
+    }
+  }
+
 private:
   /**
    * Add node to search queue
@@ -27,6 +27,7 @@ Copyright_License {
 #include "Dijkstra.hpp"
 #include "ScanTaskPoint.hpp"
 #include "SolverResult.hpp"
+#include "Util/NodePool.hpp"
 #include "Compiler.h"
 
 #include <unordered_map>
@@ -57,9 +58,35 @@ protected:
       }
     };
 
+    /**
+     * The edge map owns a #NodePool, so the nodes released by
+     * Dijkstra::Clear() are reused by the next solver run.
+     */
     template<typename Value>
-    struct Bind : public std::unordered_map<ScanTaskPoint, Value,
-                                            Hash, Equal> {
+    struct Bind
+      : private NodePool,
+        public std::unordered_map<ScanTaskPoint, Value, Hash, Equal,
+                                  NodePoolAllocator<std::pair<const ScanTaskPoint,
+                                                              Value>>> {
+      typedef std::unordered_map<ScanTaskPoint, Value, Hash, Equal,
+                                 NodePoolAllocator<std::pair<const ScanTaskPoint,
+                                                             Value>>> Base;
+
+      Bind()
+        :Base(typename Base::allocator_type(static_cast<NodePool &>(*this))) {}
+
+      /**
+       * The copy gets a pool of its own.
+       */
+      Bind(const Bind &other)
+        :NodePool(),
+         Base(other,
+              typename Base::allocator_type(static_cast<NodePool &>(*this))) {}
+
+      Bind &operator=(const Bind &other) {
+        Base::operator=(other);
+        return *this;
+      }
     };
   };
 
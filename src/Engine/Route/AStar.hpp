@@ -25,6 +25,7 @@ Copyright_License {
 #define ASTAR_HPP
 
 #include "Util/ReservablePriorityQueue.hpp"
+#include "Util/NodePool.hpp"
 #include "Compiler.h"
 
 #include <unordered_map>
@@ -75,12 +76,16 @@ template <class Node, class Hash=std::hash<Node>,
           bool m_min=true>
 class AStar
 {
-  typedef std::unordered_map<Node, AStarPriorityValue, Hash, KeyEqual> node_value_map;
+  typedef std::unordered_map<Node, AStarPriorityValue, Hash, KeyEqual,
+                             NodePoolAllocator<std::pair<const Node,
+                                                         AStarPriorityValue>>> node_value_map;
 
   typedef typename node_value_map::iterator node_value_iterator;
   typedef typename node_value_map::const_iterator node_value_const_iterator;
 
-  typedef std::unordered_map<Node, Node, Hash, KeyEqual> node_parent_map;
+  typedef std::unordered_map<Node, Node, Hash, KeyEqual,
+                             NodePoolAllocator<std::pair<const Node,
+                                                         Node>>> node_parent_map;
 
   typedef typename node_parent_map::iterator node_parent_iterator;
   typedef typename node_parent_map::const_iterator node_parent_const_iterator;
@@ -104,6 +109,13 @@ class AStar
     }
   };
 
+  /**
+   * These keep the nodes of #node_values and #node_parents across
+   * Clear() calls, so a new search does not need to allocate them
+   * again.
+   */
+  NodePool value_pool, parent_pool;
+
   /**
    * Stores the value of each node.  It is updated by push(), if a
    * value lower than the current one is found.
@@ -132,6 +144,8 @@ public:
    * @param is_min Whether this algorithm will search for min or max distance
    */
   AStar(unsigned reserve_default = DEFAULT_QUEUE_SIZE)
+    :node_values(typename node_value_map::allocator_type(value_pool)),
+     node_parents(typename node_parent_map::allocator_type(parent_pool))
   {
     Reserve(reserve_default);
   }
@@ -143,6 +157,8 @@ public:
    * @param is_min Whether this algorithm will search for min or max distance
    */
   AStar(const Node &node, unsigned reserve_default = DEFAULT_QUEUE_SIZE)
+    :node_values(typename node_value_map::allocator_type(value_pool)),
+     node_parents(typename node_parent_map::allocator_type(parent_pool))
   {
     Reserve(reserve_default);
     Push(node, node, AStarPriorityValue(0));
@@ -28,6 +28,7 @@
 #include "Util/ConstBuffer.hxx"
 
 #include <vector>
+#include <utility>
 
 class FlatTriangleFan {
   typedef std::vector<FlatGeoPoint> VertexVector;
@@ -69,6 +70,12 @@ public:
     vs.clear();
   }
 
+  void Swap(FlatTriangleFan &other) {
+    vs.swap(other.vs);
+    std::swap(bounding_box, other.bounding_box);
+    std::swap(height, other.height);
+  }
+
   gcc_pure
   bool IsEmpty() const {
     return vs.empty();
@@ -26,14 +26,23 @@
 #include "ReachFanParms.hpp"
 #include "Util/GlobalSliceAllocator.hpp"
 #include "Geo/Flat/FlatProjection.hpp"
+#include "Thread/TaskPool.hpp"
+
+#include <algorithm>
 
 #define REACH_BUFFER 1
 #define REACH_SWEEP (ROUTEPOLAR_Q1-REACH_BUFFER)
 
 #define REACH_MAX_DEPTH 4
+#define REACH_COARSE_STEP 3
 #define REACH_MIN_STEP 25
 #define REACH_MAX_VERTICES 2000
 
+/**
+ * The number of root fan directions scanned by one parallel task.
+ */
+#define REACH_DIRECTIONS_PER_TASK 8
+
 static bool
 AlmostTheSame(const FlatGeoPoint p1, const FlatGeoPoint p2)
 {
@@ -71,11 +80,13 @@ FlatTriangleFanTree::FillReach(const AFlatGeoPoint &origin,
 
   FillReach(origin, 0, ROUTEPOLAR_POINTS, parms);
 
-  for (parms.set_depth = 0; parms.set_depth < REACH_MAX_DEPTH;
-      ++parms.set_depth)
-    if (!FillDepth(origin, parms))
-      // stop searching
-      break;
+  /* a coarse pass skips the turning reach */
+  if (!parms.coarse)
+    for (parms.set_depth = 0; parms.set_depth < REACH_MAX_DEPTH;
+         ++parms.set_depth)
+      if (!FillDepth(origin, parms))
+        // stop searching
+        break;
 
   // this boundingbox update visits the tree recursively
   CalcBB();
@@ -90,26 +101,65 @@ FlatTriangleFanTree::DummyReach(const AFlatGeoPoint &ao)
   CalcBB();
 }
 
+void
+FlatTriangleFanTree::CollectUnfilled(const unsigned char _depth,
+                                     std::vector<FlatTriangleFanTree *> &dest)
+{
+  if (depth == _depth) {
+    if (!gaps_filled)
+      dest.push_back(this);
+  } else if (depth < _depth) {
+    for (auto &child : children)
+      child.CollectUnfilled(_depth, dest);
+  }
+}
+
 bool
 FlatTriangleFanTree::FillDepth(const AFlatGeoPoint &origin,
                                ReachFanParms &parms)
 {
-  if (depth == parms.set_depth) {
-    if (gaps_filled)
-      return true;
-    gaps_filled = true;
-
-    if (parms.vertex_counter > REACH_MAX_VERTICES)
-      return false;
-    if (parms.fan_counter > REACH_MAX_FANS)
+  std::vector<FlatTriangleFanTree *> fans;
+  CollectUnfilled(parms.set_depth, fans);
+
+  /* the child fans are calculated speculatively, even though the
+     limits checked below may discard some of them; the
+     GlobalSliceAllocator used by #children is not thread-safe, so
+     the tasks only fill these vectors */
+  std::vector<std::vector<FlatTriangleFanTree>> gaps(fans.size());
+
+  if (fans.size() > 1 &&
+      parms.vertex_counter <= REACH_MAX_VERTICES &&
+      parms.fan_counter <= REACH_MAX_FANS) {
+    const ReachFanParms &const_parms = parms;
+
+    TaskGroup group;
+    for (unsigned i = 0; i < fans.size(); ++i)
+      group.Submit([&fans, &gaps, &origin, &const_parms, i](){
+          fans[i]->FillGaps(origin, const_parms, gaps[i]);
+        });
+
+    group.Wait();
+  } else if (!fans.empty())
+    fans.front()->FillGaps(origin, parms, gaps.front());
+
+  for (unsigned i = 0; i < fans.size(); ++i) {
+    FlatTriangleFanTree &fan = *fans[i];
+    assert(fan.children.empty());
+
+    fan.gaps_filled = true;
+
+    if (parms.vertex_counter > REACH_MAX_VERTICES ||
+        parms.fan_counter > REACH_MAX_FANS)
+      // stop searching
       return false;
 
-    FillGaps(origin, parms);
-  } else if (depth < parms.set_depth) {
-    for (auto &child : children)
-      if (!child.FillDepth(origin, parms))
-        return false; // stop searching
+    for (auto &child : gaps[i]) {
+      parms.vertex_counter += child.vs.size();
+      parms.fan_counter++;
+      fan.children.emplace_back(std::move(child));
+    }
   }
+
   return true;
 }
 
@@ -130,8 +180,19 @@ FlatTriangleFanTree::FillReach(const AFlatGeoPoint &origin, const int index_low,
       return false;
   }
 
-  AddOrigin(origin, index_high - index_low);
-  for (int index = index_low; index < index_high; ++index) {
+  /* a coarse pass samples only a few directions of the root fan;
+     ROUTEPOLAR_POINTS-1 is a multiple of the step, so the last
+     direction closes the circle */
+  const int step = IsRoot() && parms.coarse ? REACH_COARSE_STEP : 1;
+
+  AddOrigin(origin, (index_high - index_low + step - 1) / step);
+
+  if (IsRoot()) {
+    FillRootPoints(origin, geo_origin, index_low, index_high, step, parms);
+    return CommitPoints(true);
+  }
+
+  for (int index = index_low; index < index_high; index += step) {
     FlatGeoPoint x = parms.ReachIntercept(index, origin, geo_origin);
     /* if ReachIntercept() did not find anything reasonable it returns
        a FlatGeoPoint that is almost the same as origin, but differs
@@ -147,7 +208,54 @@ FlatTriangleFanTree::FillReach(const AFlatGeoPoint &origin, const int index_low,
 }
 
 void
-FlatTriangleFanTree::FillGaps(const AFlatGeoPoint &origin, ReachFanParms &parms)
+FlatTriangleFanTree::FillRootPoints(const AFlatGeoPoint &origin,
+                                    const GeoPoint &geo_origin,
+                                    const int index_low, const int index_high,
+                                    const int step,
+                                    const ReachFanParms &parms)
+{
+  const unsigned n = (index_high - index_low + step - 1) / step;
+  FlatGeoPoint points[ROUTEPOLAR_POINTS];
+  assert(n <= ROUTEPOLAR_POINTS);
+
+  /* each direction is an independent terrain intersection test */
+  const auto scan = [&](unsigned begin, unsigned end){
+    for (unsigned i = begin; i < end; ++i) {
+      FlatGeoPoint x = parms.ReachIntercept(index_low + int(i) * step,
+                                            origin, geo_origin);
+      /* if ReachIntercept() did not find anything reasonable it
+         returns a FlatGeoPoint that is almost the same as origin,
+         but differs +/- 1 due to conversion errors. The resulting
+         polygon can have overlapping edges causing triangulation
+         failures. */
+      if (AlmostTheSame(origin, x))
+        x = origin;
+
+      points[i] = x;
+    }
+  };
+
+  if (parms.terrain != nullptr && n > REACH_DIRECTIONS_PER_TASK) {
+    TaskGroup group;
+    for (unsigned i = 0; i < n; i += REACH_DIRECTIONS_PER_TASK) {
+      const unsigned end = std::min(i + REACH_DIRECTIONS_PER_TASK, n);
+      group.Submit([&scan, i, end](){
+          scan(i, end);
+        });
+    }
+
+    group.Wait();
+  } else
+    scan(0, n);
+
+  for (unsigned i = 0; i < n; ++i)
+    AddPoint(points[i]);
+}
+
+void
+FlatTriangleFanTree::FillGaps(const AFlatGeoPoint &origin,
+                              const ReachFanParms &parms,
+                              std::vector<FlatTriangleFanTree> &gaps) const
 {
   // worth checking for gaps?
   if (vs.size() > 2 && parms.rpolars.IsTurningReachEnabled()) {
@@ -162,7 +270,7 @@ FlatTriangleFanTree::FillGaps(const AFlatGeoPoint &origin, ReachFanParms &parms)
 
       const RouteLink e(RoutePoint(*x, 0), origin, parms.projection);
       // check if children need to be added
-      CheckGap(origin, e_last, e, parms);
+      CheckGap(origin, e_last, e, parms, gaps);
 
       e_last = e;
     }
@@ -178,17 +286,31 @@ FlatTriangleFanTree::UpdateTerrainBase(const FlatGeoPoint o,
     return;
   }
 
-  for (const auto &x : vs) {
-    const FlatGeoPoint av = (o + x) * 0.5;
-    const GeoPoint p = parms.projection.Unproject(av);
-    const auto h = parms.terrain->GetHeight(p);
-
-    if (h.IsWater())
-      /* water: assume 0m MSL */
-      parms.terrain_counter++;
-    else if (!h.IsInvalid()) {
-      parms.terrain_counter++;
-      parms.terrain_base += h.GetValue();
+  /* look up the heights in batches, which is cheaper than one
+     RasterMap::GetHeight() call per vertex */
+  static constexpr unsigned BATCH_SIZE = 64;
+  GeoPoint locations[BATCH_SIZE];
+  TerrainHeight heights[BATCH_SIZE];
+
+  for (auto i = vs.cbegin(), end = vs.cend(); i != end;) {
+    unsigned n = 0;
+    for (; i != end && n < BATCH_SIZE; ++i, ++n) {
+      const FlatGeoPoint av = (o + *i) * 0.5;
+      locations[n] = parms.projection.Unproject(av);
+    }
+
+    parms.terrain->GetHeights({locations, n}, heights);
+
+    for (unsigned j = 0; j < n; ++j) {
+      const auto h = heights[j];
+
+      if (h.IsWater())
+        /* water: assume 0m MSL */
+        parms.terrain_counter++;
+      else if (!h.IsInvalid()) {
+        parms.terrain_counter++;
+        parms.terrain_base += h.GetValue();
+      }
     }
   }
 
@@ -198,7 +320,9 @@ FlatTriangleFanTree::UpdateTerrainBase(const FlatGeoPoint o,
 
 bool
 FlatTriangleFanTree::CheckGap(const AFlatGeoPoint &n, const RouteLink &e_1,
-                              const RouteLink &e_2, ReachFanParms &parms)
+                              const RouteLink &e_2,
+                              const ReachFanParms &parms,
+                              std::vector<FlatTriangleFanTree> &gaps) const
 {
   const bool side = (e_1.d > e_2.d);
   const RouteLink &e_long = (side ? e_1 : e_2);
@@ -238,9 +362,7 @@ FlatTriangleFanTree::CheckGap(const AFlatGeoPoint &n, const RouteLink &e_1,
 
     FlatTriangleFanTree child(depth + 1);
     if (child.FillReach(x, index_left, index_right, parms)) {
-      parms.vertex_counter += child.vs.size();
-      parms.fan_counter++;
-      children.emplace_back(std::move(child));
+      gaps.emplace_back(std::move(child));
       return true;
     }
   }
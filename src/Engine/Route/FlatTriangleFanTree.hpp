@@ -28,6 +28,10 @@
 #include "FlatTriangleFan.hpp"
 
 #include <list>
+#include <vector>
+#include <utility>
+
+#include <assert.h>
 
 class FlatProjection;
 struct GeoPoint;
@@ -72,6 +76,19 @@ public:
     children.clear();
   }
 
+  /**
+   * Exchange the contents of two trees.  This does not allocate or
+   * free any nodes.  Both trees must have the same depth.
+   */
+  void Swap(FlatTriangleFanTree &other) {
+    assert(depth == other.depth);
+
+    FlatTriangleFan::Swap(other);
+    std::swap(bb_children, other.bb_children);
+    children.swap(other.children);
+    std::swap(gaps_filled, other.gaps_filled);
+  }
+
   void CalcBB();
 
   gcc_pure
@@ -100,11 +117,26 @@ public:
                  const int index_low, const int index_high,
                  const ReachFanParms &parms);
 
+  /**
+   * Fill the gaps of all fans at depth ReachFanParms::set_depth.
+   * The fans are independent of each other, so they are calculated
+   * in parallel; the result is merged in tree order, which makes it
+   * the same as a sequential calculation.
+   *
+   * @return false if the vertex or fan limit has been reached
+   */
   bool FillDepth(const AFlatGeoPoint &origin, ReachFanParms &parms);
-  void FillGaps(const AFlatGeoPoint &origin, ReachFanParms &parms);
+
+  /**
+   * Calculate the child fans which cover the gaps of this fan.  This
+   * does not modify the tree, and may be called from any thread.
+   */
+  void FillGaps(const AFlatGeoPoint &origin, const ReachFanParms &parms,
+                std::vector<FlatTriangleFanTree> &gaps) const;
 
   bool CheckGap(const AFlatGeoPoint &n, const RouteLink &e_1,
-                const RouteLink &e_2, ReachFanParms &parms);
+                const RouteLink &e_2, const ReachFanParms &parms,
+                std::vector<FlatTriangleFanTree> &gaps) const;
 
   bool FindPositiveArrival(FlatGeoPoint n,
                            const ReachFanParms &parms,
@@ -117,6 +149,22 @@ public:
 
   gcc_pure
   int DirectArrival(FlatGeoPoint dest, const ReachFanParms &parms) const;
+
+private:
+  /**
+   * Collect all fans at the specified depth whose gaps have not yet
+   * been filled, in tree order.
+   */
+  void CollectUnfilled(unsigned char _depth,
+                       std::vector<FlatTriangleFanTree *> &dest);
+
+  /**
+   * Calculate the vertices of the root fan, scanning the directions
+   * in parallel.
+   */
+  void FillRootPoints(const AFlatGeoPoint &origin, const GeoPoint &geo_origin,
+                      int index_low, int index_high, int step,
+                      const ReachFanParms &parms);
 };
 
 #endif
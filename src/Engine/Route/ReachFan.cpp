@@ -36,7 +36,8 @@ ReachFan::Reset()
 
 bool
 ReachFan::Solve(const AGeoPoint origin, const RoutePolars &rpolars,
-                const RasterMap* terrain, const bool do_solve)
+                const RasterMap* terrain, const bool do_solve,
+                const bool coarse)
 {
   Reset();
 
@@ -49,6 +50,7 @@ ReachFan::Solve(const AGeoPoint origin, const RoutePolars &rpolars,
   const int h2 = h.GetValueOr0();
 
   ReachFanParms parms(rpolars, projection, terrain_base, terrain);
+  parms.coarse = coarse;
   const AFlatGeoPoint ao(projection.ProjectInteger(origin), origin.altitude);
 
   // immediate exit if starting below terrain, or starting below floor
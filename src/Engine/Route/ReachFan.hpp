@@ -52,8 +52,23 @@ public:
 
   void Reset();
 
+  /**
+   * Exchange the contents with another object, without copying the
+   * fans.
+   */
+  void Swap(ReachFan &other) {
+    std::swap(projection, other.projection);
+    root.Swap(other.root);
+    std::swap(terrain_base, other.terrain_base);
+  }
+
+  /**
+   * @param coarse scan only a few directions and no turning reach;
+   * see ReachFanParms::coarse
+   */
   bool Solve(const AGeoPoint origin, const RoutePolars &rpolars,
-             const RasterMap *terrain, const bool do_solve = true);
+             const RasterMap *terrain, const bool do_solve = true,
+             const bool coarse = false);
 
   bool FindPositiveArrival(const AGeoPoint dest, const RoutePolars &rpolars,
                            ReachResult &result_r) const;
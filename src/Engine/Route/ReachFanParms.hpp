@@ -38,6 +38,12 @@ struct ReachFanParms {
   unsigned vertex_counter = 0;
   unsigned char set_depth = 0;
 
+  /**
+   * Scan only a few directions and no turning reach, for a quick
+   * first estimate which gets refined later.
+   */
+  bool coarse = false;
+
   ReachFanParms(const RoutePolars& _rpolars,
                 const FlatProjection &_projection,
                 const short _terrain_base,
@@ -0,0 +1,66 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#ifndef XCSOAR_REACH_SOLUTION_HPP
+#define XCSOAR_REACH_SOLUTION_HPP
+
+#include "ReachFan.hpp"
+#include "RoutePolars.hpp"
+
+class RasterMap;
+
+/**
+ * A self-contained reach calculation: copies of the polars it was
+ * set up with, and the resulting terrain and working floor fans.
+ * It can be solved outside of #RoutePlanner (e.g. in a helper
+ * thread) and then be moved into it with RoutePlanner::AcceptReach().
+ */
+struct ReachSolution {
+  /** Aircraft performance model for reach to terrain */
+  RoutePolars rpolars_terrain;
+  /** Aircraft performance model for reach to working floor */
+  RoutePolars rpolars_working;
+
+  ReachFan terrain;
+  ReachFan working;
+
+  RoutePlannerConfig::Polar polar_mode = RoutePlannerConfig::Polar::TASK;
+
+  /**
+   * Was this solution obtained by a coarse pass?  See
+   * ReachFanParms::coarse.
+   */
+  bool coarse = false;
+
+  /**
+   * Solve both fans.  The polars must have been prepared by
+   * RoutePlanner::PrepareReach().
+   *
+   * @param do_solve actually solve or just perform minimal calculations
+   * @param coarse scan only a few directions and no turning reach
+   */
+  void Solve(const AGeoPoint &origin, const RasterMap *map,
+             bool do_solve, bool coarse);
+};
+
+#endif
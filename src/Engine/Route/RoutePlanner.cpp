@@ -21,9 +21,13 @@
  */
 
 #include "RoutePlanner.hpp"
+#include "ReachSolution.hpp"
 #include "Terrain/RasterMap.hpp"
 #include "Geo/Flat/FlatProjection.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 RoutePlanner::RoutePlanner()
   :terrain(NULL), planner(0),
    unique_links(50000),
@@ -37,6 +41,7 @@ RoutePlanner::ClearReach()
 {
   reach_terrain.Reset();
   reach_working.Reset();
+  ++reach_serial;
 }
 
 void
@@ -46,6 +51,8 @@ RoutePlanner::Reset()
   destination_last = AFlatGeoPoint(0, 0, 0);
   dirty = true;
   solution_route.clear();
+  solution_nodes.clear();
+  repair_count = 0;
   planner.Clear();
   unique_links.clear();
   h_min = -1;
@@ -62,6 +69,7 @@ RoutePlanner::SolveReachTerrain(const AGeoPoint &origin,
   rpolars_reach.SetConfig(config, origin.altitude, h_ceiling);
   reach_polar_mode = config.reach_polar_mode;
 
+  ++reach_serial;
   return reach_terrain.Solve(origin, rpolars_reach, terrain, do_solve);
 }
 
@@ -76,6 +84,30 @@ RoutePlanner::SolveReachWorking(const AGeoPoint &origin,
   return reach_working.Solve(origin, rpolars_reach_working, terrain, do_solve);
 }
 
+void
+RoutePlanner::PrepareReach(ReachSolution &solution, const AGeoPoint &origin,
+                           const RoutePlannerConfig &config,
+                           const int h_ceiling) const
+{
+  solution.rpolars_terrain = rpolars_reach;
+  solution.rpolars_terrain.SetConfig(config, origin.altitude, h_ceiling);
+  solution.rpolars_working = rpolars_reach_working;
+  solution.rpolars_working.SetConfig(config, origin.altitude, h_ceiling);
+  solution.polar_mode = config.reach_polar_mode;
+}
+
+void
+RoutePlanner::AcceptReach(ReachSolution &solution)
+{
+  rpolars_reach = solution.rpolars_terrain;
+  rpolars_reach_working = solution.rpolars_working;
+  reach_polar_mode = solution.polar_mode;
+
+  reach_terrain.Swap(solution.terrain);
+  reach_working.Swap(solution.working);
+  ++reach_serial;
+}
+
 bool
 RoutePlanner::Solve(const AGeoPoint &origin, const AGeoPoint &destination,
                     const RoutePlannerConfig &config, const int h_ceiling)
@@ -84,6 +116,12 @@ RoutePlanner::Solve(const AGeoPoint &origin, const AGeoPoint &destination,
   rpolars_route.SetConfig(config, std::max(destination.altitude, origin.altitude),
                           h_ceiling);
 
+  /* if "dirty" was already set before looking at the origin and the
+     destination, the obstacles (e.g. the airspaces) have changed, and
+     the previous solution cannot be repaired */
+  const bool obstacles_changed = dirty;
+  const AFlatGeoPoint previous_destination = destination_last;
+
   {
     const AFlatGeoPoint s_origin(projection.ProjectInteger(origin),
                                  origin.altitude);
@@ -129,6 +167,20 @@ RoutePlanner::Solve(const AGeoPoint &origin, const AGeoPoint &destination,
   count_terrain = 0;
   count_supressed = 0;
 
+  if (!obstacles_changed && repair_count < MAX_REPAIRS &&
+      solution_nodes.size() >= 2 && solution_nodes.front() == start &&
+      previous_destination.Distance(astar_goal) <=
+      projection.ProjectRangeInteger(destination, MAX_REPAIR_DISTANCE) &&
+      RepairSolution()) {
+    ++repair_count;
+    BuildRoute(solution_nodes, solution_route);
+    CorrectSolution(origin, destination);
+    return true;
+  }
+
+  repair_count = 0;
+  solution_nodes.clear();
+
   bool retval = false;
   planner.Restart(start);
 
@@ -149,11 +201,11 @@ RoutePlanner::Solve(const AGeoPoint &origin, const AGeoPoint &destination,
 
     if (is_final) // @todo: allow fallback if failed
     { // copy improving solutions
-      Route this_solution;
+      std::vector<RoutePoint> this_solution;
       unsigned d = FindSolution(node, this_solution);
       if (d < best_d) {
         best_d = d;
-        solution_route = this_solution;
+        solution_nodes.swap(this_solution);
       }
     }
 
@@ -175,18 +227,10 @@ RoutePlanner::Solve(const AGeoPoint &origin, const AGeoPoint &destination,
   count_unique = unique_links.size();
 
   if (retval) {
-    // correct solution for rounding
-    assert(solution_route.size()>=2);
-    for (auto &i : solution_route) {
-      FlatGeoPoint p(projection.ProjectInteger(i));
-      if (p == origin_last) {
-        i = AGeoPoint(origin, i.altitude);
-      } else if (p == destination_last) {
-        i = AGeoPoint(destination, i.altitude);
-      }
-    }
-
+    BuildRoute(solution_nodes, solution_route);
+    CorrectSolution(origin, destination);
   } else {
+    solution_nodes.clear();
     solution_route.clear();
     solution_route.push_back(origin);
     solution_route.push_back(destination);
@@ -198,27 +242,98 @@ RoutePlanner::Solve(const AGeoPoint &origin, const AGeoPoint &destination,
   return retval;
 }
 
+void
+RoutePlanner::CorrectSolution(const AGeoPoint &origin,
+                              const AGeoPoint &destination)
+{
+  // correct solution for rounding
+  assert(solution_route.size()>=2);
+  for (auto &i : solution_route) {
+    FlatGeoPoint p(projection.ProjectInteger(i));
+    if (p == origin_last) {
+      i = AGeoPoint(origin, i.altitude);
+    } else if (p == destination_last) {
+      i = AGeoPoint(destination, i.altitude);
+    }
+  }
+}
+
+bool
+RoutePlanner::IsFinalLinkClear(const RouteLink &e) const
+{
+  assert(e.second == astar_goal);
+
+  if (e.IsShort() || !rpolars_route.IsAchievable(e, true) ||
+      rpolars_route.CalcTime(e) == UINT_MAX)
+    return false;
+
+  RoutePoint inx;
+  return CheckClearance(e, inx);
+}
+
+bool
+RoutePlanner::RepairSolution()
+{
+  assert(solution_nodes.size() >= 2);
+
+  /* the last node is the previous destination; replace it with the
+     new one, skipping the last turn point if the aircraft has already
+     passed it */
+
+  solution_nodes.pop_back();
+
+  const unsigned n = solution_nodes.size();
+  for (unsigned i = n >= 2 ? n - 2 : 0; i < n; ++i) {
+    if (IsFinalLinkClear(RouteLink(solution_nodes[i], astar_goal,
+                                   projection))) {
+      solution_nodes.resize(i + 1);
+      solution_nodes.push_back(astar_goal);
+      return true;
+    }
+  }
+
+  /* the route has become blocked */
+  solution_nodes.clear();
+  return false;
+}
+
 unsigned
 RoutePlanner::FindSolution(const RoutePoint &final_point,
-                           Route &this_route) const
+                           std::vector<RoutePoint> &nodes) const
 {
   // we are iterating from goal (aircraft) backwards to start (target)
 
+  nodes.clear();
+
   RoutePoint p(final_point);
-  RoutePoint p_last(p);
-  bool finished = false;
+  while (true) {
+    nodes.push_back(p);
 
-  this_route.insert(this_route.begin(),
-                    AGeoPoint(projection.Unproject(p), p.altitude));
+    const RoutePoint previous = planner.GetPredecessor(p);
+    if (previous == p)
+      break;
 
-  do {
-    p_last = p;
-    p = planner.GetPredecessor(p);
+    p = previous;
+  }
 
-    if (p == p_last) {
-      finished = true;
-      continue;
-    }
+  std::reverse(nodes.begin(), nodes.end());
+
+  return planner.GetNodeValue(final_point).h;
+}
+
+void
+RoutePlanner::BuildRoute(const std::vector<RoutePoint> &nodes,
+                         Route &this_route) const
+{
+  assert(!nodes.empty());
+
+  this_route.clear();
+  this_route.push_back(AGeoPoint(projection.Unproject(nodes.front()),
+                                 nodes.front().altitude));
+
+  for (auto i = std::next(nodes.begin()); i != nodes.end(); ++i) {
+    const RoutePoint &p = *std::prev(i);
+    const RoutePoint &p_last = *i;
 
     if (p.altitude < p_last.altitude &&
         !((FlatGeoPoint)p == (FlatGeoPoint)p_last)) {
@@ -232,21 +347,19 @@ RoutePlanner::FindSolution(const RoutePoint &final_point,
         const auto gp = projection.Unproject(p);
         const auto gp_last = projection.Unproject(p_last);
         const AGeoPoint gp_int(gp.Interpolate(gp_last, f), p_last.altitude);
-        this_route.insert(this_route.begin(), gp_int);
+        this_route.push_back(gp_int);
         // @todo: assert check_clearance?
       }
     } else if (p.altitude > p_last.altitude) {
       // create intermediate point for jump at end
       const AGeoPoint gp_int(projection.Unproject(p_last), p.altitude);
-      this_route.insert(this_route.begin(), gp_int);
+      this_route.push_back(gp_int);
     }
 
-    this_route.insert(this_route.begin(),
-                      AGeoPoint(projection.Unproject(p), p.altitude));
+    this_route.push_back(AGeoPoint(projection.Unproject(p_last),
+                                   p_last.altitude));
     // @todo: assert check_clearance
-  } while (!finished);
-
-  return planner.GetNodeValue(final_point).h;
+  }
 }
 
 bool
@@ -395,6 +508,7 @@ RoutePlanner::UpdatePolar(const GlideSettings &settings,
   }
   rpolars_reach_working.SetConfig(config);
   rpolars_reach_working.Initialise(settings, task_polar, wind, height_min_working);
+  ++reach_serial;
 }
 
 /*
@@ -30,6 +30,7 @@
 #include "Geo/Flat/FlatProjection.hpp"
 #include "Geo/SearchPointVector.hpp"
 #include "ReachFan.hpp"
+#include "Util/Serial.hpp"
 
 #include <utility>
 #include <unordered_set>
@@ -37,6 +38,7 @@
 #include <limits.h>
 
 class GlidePolar;
+struct ReachSolution;
 
 /**
  * RoutePlanner is an abstract class for planning paths (routes) through
@@ -138,6 +140,19 @@ private:
   /** Result route found by solve() method */
   Route solution_route;
 
+  /**
+   * The A* nodes of #solution_route, from the origin to the
+   * destination.  Empty if the last Solve() call did not find a
+   * solution.  This is used by RepairSolution().
+   */
+  std::vector<RoutePoint> solution_nodes;
+
+  /**
+   * The number of RepairSolution() calls since the last full
+   * search.
+   */
+  unsigned repair_count;
+
   /** Origin at last call to solve() */
   AFlatGeoPoint origin_last;
   /** Destination at last call to solve() */
@@ -148,6 +163,26 @@ private:
 
   RoutePlannerConfig::Polar reach_polar_mode;
 
+  /**
+   * Incremented whenever the reach fans or the reach polars change,
+   * i.e. whenever FindPositiveArrival() may return a different
+   * result.
+   */
+  Serial reach_serial;
+
+  /**
+   * A full search is done after this many repaired solutions, to
+   * avoid drifting away from the optimal route.
+   */
+  static constexpr unsigned MAX_REPAIRS = 10;
+
+  /**
+   * The destination may move by up to this distance (m) between two
+   * Solve() calls for the previous solution to be repaired instead
+   * of doing a full search.
+   */
+  static constexpr double MAX_REPAIR_DISTANCE = 2000;
+
   mutable unsigned long count_dij;
   mutable unsigned long count_unique;
   mutable unsigned long count_supressed;
@@ -179,6 +214,10 @@ public:
     return reach_terrain.IsEmpty();
   }
 
+  const Serial &GetReachSerial() const {
+    return reach_serial;
+  }
+
   /**
    * Delete all reach fans.
    */
@@ -222,6 +261,22 @@ public:
   bool SolveReachWorking(const AGeoPoint &origin, const RoutePlannerConfig &config,
                          int h_ceiling, bool do_solve=true);
 
+  /**
+   * Copy the reach polars into a #ReachSolution, so it can be solved
+   * without accessing this object.
+   *
+   * @param origin The start of the search (current aircraft location)
+   */
+  void PrepareReach(ReachSolution &solution, const AGeoPoint &origin,
+                    const RoutePlannerConfig &config, int h_ceiling) const;
+
+  /**
+   * Replace the reach fans with the ones from a #ReachSolution
+   * solved elsewhere.  The previous fans are moved into the
+   * #ReachSolution, to be freed by whoever reuses it.
+   */
+  void AcceptReach(ReachSolution &solution);
+
   const FlatProjection &GetTerrainReachProjection() const {
     return reach_terrain.GetProjection();
   }
@@ -445,16 +500,48 @@ private:
   bool IsHullExtended(const RoutePoint& p);
 
   /**
-   * Backtrack solution from A* internal structure to construct a
-   * Route.
+   * Backtrack solution from A* internal structure to obtain the list
+   * of nodes.
    *
    * @param final_point Final point from search to backtrack
-   * @param this_route Route to copy into
+   * @param nodes Vector to copy the nodes into (origin first)
    *
    * @return Destination score (s)
    */
   unsigned FindSolution(const RoutePoint &final_point,
-                        Route& this_route) const;
+                        std::vector<RoutePoint> &nodes) const;
+
+  /**
+   * Construct a Route from a list of nodes obtained by
+   * FindSolution(), inserting intermediate points where a link is
+   * part cruise, part glide.
+   */
+  void BuildRoute(const std::vector<RoutePoint> &nodes,
+                  Route &route) const;
+
+  /**
+   * Replace the rounded origin and destination in #solution_route
+   * with the exact locations.
+   */
+  void CorrectSolution(const AGeoPoint &origin,
+                       const AGeoPoint &destination);
+
+  /**
+   * Check whether the final link to #astar_goal can be flown.
+   */
+  bool IsFinalLinkClear(const RouteLink &e) const;
+
+  /**
+   * Attempt to adapt the previous solution to the new destination
+   * (#astar_goal) instead of searching again: the previous nodes stay
+   * valid as long as the obstacles have not changed, so only the
+   * final link (or a shortcut skipping the last turn point) needs to
+   * be checked.
+   *
+   * @return true if #solution_nodes has been updated, false if a
+   * full search is needed
+   */
+  bool RepairSolution();
 };
 
 #endif
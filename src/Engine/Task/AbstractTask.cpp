@@ -37,7 +37,8 @@ AbstractTask::AbstractTask(TaskType _type,
    mc_lpf(8),
    ce_lpf(60),
    em_lpf(60),
-   mc_lpf_valid(false)
+   mc_lpf_valid(false),
+   last_glide_solution_serial(0)
 {
    stats.reset();
    stats_computer.Reset(stats);
@@ -252,6 +253,13 @@ AbstractTask::Update(const AircraftState &state,
   UpdateGlideSolutions(state, glide_polar);
   UpdateStatsTimes(state.time);
 
+  const unsigned glide_solution_serial = GetGlideSolutionSerial();
+  if (full_update || glide_solution_serial == 0 ||
+      glide_solution_serial != last_glide_solution_serial) {
+    last_glide_solution_serial = glide_solution_serial;
+    ++stats.generation;
+  }
+
   const bool sample_updated = state.location.IsValid() &&
     UpdateSample(state, glide_polar, full_update);
 
@@ -312,7 +320,13 @@ AbstractTask::Reset()
 {
   ResetAutoMC();
   ce_lpf.Reset(1);
+
+  /* don't let the generation go back, consumers might still hold
+     statistics from before the reset */
+  const unsigned generation = stats.generation;
   stats.reset();
+  stats.generation = generation + 1;
+
   stats_computer.Reset(stats);
   force_full_update = true;
 }
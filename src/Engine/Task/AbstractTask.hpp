@@ -73,6 +73,11 @@ private:
    */
   bool mc_lpf_valid;
 
+  /**
+   * The value of GetGlideSolutionSerial() at the last Update().
+   */
+  unsigned last_glide_solution_serial;
+
 public:
   /** 
    * Base constructor.  Sets time constants of Best Mc and cruise efficiency
@@ -384,6 +389,17 @@ protected:
                                     const GlideResult &solution_remaining_total,
                                     const GlideResult &solution_remaining_leg) = 0;
 
+  /**
+   * Returns a number which is modified whenever the Glide*()
+   * methods above have recalculated at least one leg.  Tasks which
+   * don't keep track of this return 0, which means the solutions are
+   * assumed to have changed on every update.
+   */
+  gcc_pure
+  virtual unsigned GetGlideSolutionSerial() const {
+    return 0;
+  }
+
   /** Determines whether this task is scored */
   gcc_pure
   virtual bool IsScored() const = 0;
@@ -65,6 +65,16 @@ public:
    * @return Location of point on isoline segment
    */
   GeoPoint Parametric(double t) const;
+
+  /**
+   * Returns the parameter of the AAT point's target, which the
+   * isoline was constructed through.  Only valid if IsValid()
+   * returns true.
+   */
+  gcc_pure
+  double GetTargetParameter() const {
+    return -t_down / (t_up - t_down);
+  }
 };
 
 #endif
@@ -88,6 +88,7 @@ OrderedTask::OrderedTask(const TaskBehaviour &tb)
   :AbstractTask(TaskType::ORDERED, tb),
    taskpoint_start(nullptr),
    taskpoint_finish(nullptr),
+   last_min_target(0),
    factory_mode(tb.task_type_default),
    active_factory(nullptr),
    ordered_settings(tb.ordered_defaults),
@@ -153,6 +154,13 @@ OrderedTask::UpdateStatsGeometry()
 void
 OrderedTask::UpdateGeometry()
 {
+  /* task points may have been replaced; don't let the solvers
+     mistake a new one for an old one */
+  if (dijkstra_min != nullptr)
+    dijkstra_min->Invalidate();
+  if (dijkstra_max != nullptr)
+    dijkstra_max->Invalidate();
+
   UpdateStatsGeometry();
 
   if (task_points.empty())
@@ -236,7 +244,8 @@ OrderedTask::RunDijsktraMin(const GeoPoint &location)
   dijkstra.SetTaskSize(task_size - active_index);
   for (unsigned i = active_index; i != task_size; ++i) {
     const SearchPointVector &boundary = task_points[i]->GetSearchPoints();
-    dijkstra.SetBoundary(i - active_index, boundary);
+    dijkstra.SetBoundary(i - active_index, boundary,
+                         task_points[i]->GetSerial());
   }
 
   SearchPoint ac(location, task_projection);
@@ -299,7 +308,7 @@ OrderedTask::RunDijsktraMax()
          the full boundary here */
       ? task_points[i]->GetBoundaryPoints()
       : task_points[i]->GetSearchPoints();
-    dijkstra_max->SetBoundary(i, boundary);
+    dijkstra_max->SetBoundary(i, boundary, task_points[i]->GetSerial());
   }
 
   double start_radius(-1), finish_radius(-1);
@@ -311,12 +320,13 @@ OrderedTask::RunDijsktraMax()
     const auto &start = *task_points.front();
     start_radius = GetCylinderRadiusOrMinusOne(start);
     if (start_radius > 0)
-      dijkstra.SetBoundary(0, start.GetNominalPoints());
+      dijkstra.SetBoundary(0, start.GetNominalPoints(), start.GetSerial());
 
     const auto &finish = *task_points.back();
     finish_radius = GetCylinderRadiusOrMinusOne(finish);
     if (finish_radius > 0)
-      dijkstra.SetBoundary(task_size - 1, finish.GetNominalPoints());
+      dijkstra.SetBoundary(task_size - 1, finish.GetNominalPoints(),
+                           finish.GetSerial());
   }
 
   if (!dijkstra_max->DistanceMax())
@@ -634,7 +644,7 @@ OrderedTask::UpdateIdle(const AircraftState &state,
       TaskOptTarget tot(task_points, active_task_point, state,
                         task_behaviour.glide, glide_polar,
                         *ap, task_projection, taskpoint_start);
-      tot.search(0.5);
+      tot.search_from_target();
     }
     retval = true;
   }
@@ -924,10 +934,34 @@ OrderedTask::GlideSolutionRemaining(const AircraftState &aircraft,
   TaskMacCreadyRemaining tm(task_points.cbegin(), task_points.cend(),
                             active_task_point,
                             task_behaviour.glide, polar);
+  /* AbstractTask::UpdateGlideSolutions() calls this twice, once
+     with MacCready zero; keep those apart to avoid thrashing one
+     cache */
+  tm.SetCache(polar.GetMC() > 0 ? remaining_cache : remaining_mc0_cache);
   total = tm.glide_solution(aircraft);
   leg = tm.get_active_solution();
 }
 
+void
+OrderedTask::CalcGlideSolutions(const AircraftState &aircraft,
+                                const GlidePolar *polars, unsigned n,
+                                GlideResult *results) const
+{
+  if (n == 0)
+    return;
+
+  if (!aircraft.location.IsValid() || task_points.empty()) {
+    for (unsigned i = 0; i < n; ++i)
+      results[i].Reset();
+    return;
+  }
+
+  TaskMacCreadyRemaining tm(task_points.cbegin(), task_points.cend(),
+                            active_task_point,
+                            task_behaviour.glide, polars[0]);
+  tm.glide_solutions(aircraft, polars, n, results);
+}
+
 void
 OrderedTask::GlideSolutionTravelled(const AircraftState &aircraft,
                                     const GlidePolar &glide_polar,
@@ -942,6 +976,7 @@ OrderedTask::GlideSolutionTravelled(const AircraftState &aircraft,
 
   TaskMacCreadyTravelled tm(task_points.cbegin(), active_task_point,
                             task_behaviour.glide, glide_polar);
+  tm.SetCache(travelled_cache);
   total = tm.glide_solution(aircraft);
   leg = tm.get_active_solution();
 }
@@ -967,6 +1002,7 @@ OrderedTask::GlideSolutionPlanned(const AircraftState &aircraft,
   TaskMacCreadyTotal tm(task_points.cbegin(), task_points.cend(),
                         active_task_point,
                         task_behaviour.glide, glide_polar);
+  tm.SetCache(planned_cache);
   total = tm.glide_solution(aircraft);
   leg = tm.get_active_solution();
 
@@ -981,6 +1017,15 @@ OrderedTask::GlideSolutionPlanned(const AircraftState &aircraft,
     leg_remaining_effective.Reset();
 }
 
+unsigned
+OrderedTask::GetGlideSolutionSerial() const
+{
+  /* the sum changes whenever one of the caches had a miss; start at
+     one, because zero means "unknown" */
+  return 1 + remaining_cache.GetSerial() + remaining_mc0_cache.GetSerial() +
+    travelled_cache.GetSerial() + planned_cache.GetSerial();
+}
+
 // Auxiliary glide functions
 
 double
@@ -1000,7 +1045,7 @@ OrderedTask::CalcBestMC(const AircraftState &aircraft,
   // note setting of lower limit on mc
   TaskBestMc bmc(task_points, active_task_point, aircraft,
                  task_behaviour.glide, glide_polar);
-  return bmc.search(glide_polar.GetMC(), best);
+  return bmc.search(glide_polar.GetMC(), best, stats.mc_best);
 }
 
 
@@ -1028,7 +1073,8 @@ OrderedTask::CalcCruiseEfficiency(const AircraftState &aircraft,
   if (AllowIncrementalBoundaryStats(aircraft)) {
     TaskCruiseEfficiency bce(task_points, active_task_point, aircraft,
                              task_behaviour.glide, glide_polar);
-    val = bce.search(1);
+    /* start with the previous solution */
+    val = bce.search(stats.cruise_efficiency);
     return true;
   } else {
     val = 1;
@@ -1044,7 +1090,8 @@ OrderedTask::CalcEffectiveMC(const AircraftState &aircraft,
   if (AllowIncrementalBoundaryStats(aircraft)) {
     TaskEffectiveMacCready bce(task_points, active_task_point, aircraft,
                                task_behaviour.glide, glide_polar);
-    val = bce.search(glide_polar.GetMC());
+    /* start with the previous solution */
+    val = bce.search(stats.effective_mc);
     return true;
   } else {
     val = glide_polar.GetMC();
@@ -1065,8 +1112,8 @@ OrderedTask::CalcMinTarget(const AircraftState &aircraft,
     TaskMinTarget bmt(task_points, active_task_point, aircraft,
                       task_behaviour.glide, glide_polar,
                       t_rem, taskpoint_start);
-    auto p = bmt.search(0);
-    return p;
+    last_min_target = bmt.search(last_min_target);
+    return last_min_target;
   }
 
   return 0;
@@ -1246,6 +1293,14 @@ OrderedTask::GetTaskRadius() const
 
 OrderedTask*
 OrderedTask::Clone(const TaskBehaviour &tb) const
+{
+  OrderedTask *new_task = CloneWithoutGeometry(tb);
+  new_task->UpdateGeometry();
+  return new_task;
+}
+
+OrderedTask *
+OrderedTask::CloneWithoutGeometry(const TaskBehaviour &tb) const
 {
   OrderedTask* new_task = new OrderedTask(tb);
 
@@ -1253,6 +1308,9 @@ OrderedTask::Clone(const TaskBehaviour &tb) const
 
   new_task->ordered_settings = ordered_settings;
 
+  new_task->task_points.reserve(task_points.size());
+  new_task->optional_start_points.reserve(optional_start_points.size());
+
   for (const OrderedTaskPoint *tp : task_points)
     new_task->Append(*tp);
 
@@ -1260,7 +1318,6 @@ OrderedTask::Clone(const TaskBehaviour &tb) const
     new_task->AppendOptionalStart(*tp);
 
   new_task->active_task_point = active_task_point;
-  new_task->UpdateGeometry();
 
   new_task->SetName(GetName());
 
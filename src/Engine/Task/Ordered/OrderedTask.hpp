@@ -26,6 +26,7 @@
 #include "Geo/Flat/TaskProjection.hpp"
 #include "Task/AbstractTask.hpp"
 #include "SmartTaskAdvance.hpp"
+#include "Task/Solvers/TaskLegCache.hpp"
 #include "Waypoint/Ptr.hpp"
 #include "Util/DereferenceIterator.hpp"
 #include "Util/StaticString.hxx"
@@ -79,6 +80,12 @@ private:
 
   GeoPoint last_min_location;
 
+  /**
+   * The target range found by the last CalcMinTarget() call, used as
+   * the initial guess for the next one.
+   */
+  double last_min_target;
+
   TaskFactoryType factory_mode;
   AbstractTaskFactory* active_factory;
   OrderedTaskSettings ordered_settings;
@@ -86,6 +93,14 @@ private:
   TaskDijkstraMin *dijkstra_min;
   TaskDijkstraMax *dijkstra_max;
 
+  /**
+   * Leg solutions of the glide calculations performed on each
+   * update, see GlideSolutionRemaining(), GlideSolutionTravelled()
+   * and GlideSolutionPlanned().
+   */
+  TaskLegCache remaining_cache, remaining_mc0_cache;
+  TaskLegCache travelled_cache, planned_cache;
+
   StaticString<64> name;
 
 public:
@@ -157,6 +172,15 @@ public:
   gcc_malloc
   OrderedTask *Clone(const TaskBehaviour &tb) const;
 
+  /**
+   * Like Clone(), but does not call UpdateGeometry() on the new
+   * object.  The caller must do that before using it; this allows
+   * doing the expensive part after the lock protecting this object
+   * has been released.
+   */
+  gcc_malloc
+  OrderedTask *CloneWithoutGeometry(const TaskBehaviour &tb) const;
+
   /**
    * Copy task into this task
    *
@@ -632,6 +656,21 @@ public:
   gcc_pure
   double GetTaskRadius() const;
 
+  /**
+   * Calculate the remaining glide solution of the whole task for
+   * each of the given glide polars, like GlideSolutionRemaining()
+   * does for one.  The leg geometry is calculated only once for all
+   * polars, which makes this cheap enough for MacCready/ballast/bugs
+   * sweeps, e.g. a "speed vs MacCready" chart.
+   *
+   * @param polars an array of #n glide polars
+   * @param results an array of #n glide results (output); they are
+   * reset if the aircraft location is invalid or the task is empty
+   */
+  void CalcGlideSolutions(const AircraftState &state,
+                          const GlidePolar *polars, unsigned n,
+                          GlideResult *results) const;
+
   /**
    * returns the index of the highest intermediate TP that has been entered.
    * if none have been entered, returns zero
@@ -713,6 +752,7 @@ protected:
                             DistanceStat &leg_remaining_effective,
                             const GlideResult &solution_remaining_total,
                             const GlideResult &solution_remaining_leg) override;
+  unsigned GetGlideSolutionSerial() const override;
 protected:
   bool IsScored() const override;
 
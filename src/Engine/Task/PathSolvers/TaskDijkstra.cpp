@@ -23,9 +23,11 @@
 #include "TaskDijkstra.hpp"
 #include "Geo/SearchPointVector.hpp"
 
+#include <algorithm>
+
 TaskDijkstra::TaskDijkstra(bool _is_min)
   :NavDijkstra(0),
-   is_min(_is_min)
+   is_min(_is_min), previous_num_stages(0)
 {
 }
 
@@ -34,13 +36,25 @@ TaskDijkstra::GetStageSize(const unsigned stage) const
 {
   assert(stage < num_stages);
 
-  return boundaries[stage]->size();
+  return stages[stage].boundary->size();
 }
 
 const SearchPoint &
 TaskDijkstra::GetPoint(const ScanTaskPoint sp) const
 {
-  return (*boundaries[sp.GetStageNumber()])[sp.GetPointIndex()];
+  return (*stages[sp.GetStageNumber()].boundary)[sp.GetPointIndex()];
+}
+
+unsigned
+TaskDijkstra::FindFirstChangedStage() const
+{
+  const unsigned n = std::min(num_stages, previous_num_stages);
+
+  unsigned i = 0;
+  while (i < n && stages[i] == previous_stages[i])
+    ++i;
+
+  return i;
 }
 
 void
@@ -83,6 +97,12 @@ bool
 TaskDijkstra::Run()
 {
   const bool retval = DistanceGeneral() == SolverResult::VALID;
-  dijkstra.Clear();
+
+  if (retval) {
+    std::copy_n(stages, num_stages, previous_stages);
+    previous_num_stages = num_stages;
+  } else
+    previous_num_stages = 0;
+
   return retval;
 }
@@ -25,6 +25,7 @@
 
 #include "PathSolvers/NavDijkstra.hpp"
 #include "Geo/SearchPoint.hpp"
+#include "Util/Serial.hpp"
 
 #include <assert.h>
 
@@ -50,13 +51,43 @@ class SearchPointVector;
  * call SetBoundary() for each task point.
  *
  * This uses a Dijkstra search and so is O(N log(N)).
+ *
+ * The boundaries of the last successful search are remembered, which
+ * allows subclasses to skip the search or resume it at the first
+ * stage that has changed.
  */
 class TaskDijkstra : protected NavDijkstra
 {
-  const SearchPointVector *boundaries[MAX_STAGES];
+  struct Stage {
+    const SearchPointVector *boundary;
+
+    /**
+     * The serial of the boundary's owner, incremented whenever the
+     * boundary was modified in place.
+     */
+    Serial serial;
+
+    bool operator==(const Stage &other) const {
+      return boundary == other.boundary && serial == other.serial;
+    }
+  };
+
+  Stage stages[MAX_STAGES];
+
+  /**
+   * The stages of the last successful search.
+   */
+  Stage previous_stages[MAX_STAGES];
 
   const bool is_min;
 
+protected:
+  /**
+   * The number of stages of the last successful search; 0 if there
+   * is none.
+   */
+  unsigned previous_num_stages;
+
 public:
   /**
    * Constructor
@@ -69,10 +100,23 @@ public:
     SetStageCount(size);
   }
 
-  void SetBoundary(unsigned idx, const SearchPointVector &boundary) {
+  /**
+   * @param serial the serial of the task point the boundary belongs
+   * to; it must change whenever the boundary is modified
+   */
+  void SetBoundary(unsigned idx, const SearchPointVector &boundary,
+                   Serial serial) {
     assert(idx < num_stages);
 
-    boundaries[idx] = &boundary;
+    stages[idx].boundary = &boundary;
+    stages[idx].serial = serial;
+  }
+
+  /**
+   * Forget the last search, e.g. after the task has been modified.
+   */
+  void Invalidate() {
+    previous_num_stages = 0;
   }
 
   /**
@@ -89,6 +133,31 @@ protected:
   gcc_pure
   const SearchPoint &GetPoint(ScanTaskPoint sp) const;
 
+  /**
+   * Determine the first stage whose boundary is different from the
+   * last successful search.
+   *
+   * @return the stage index, or the smaller of both stage counts if
+   * all common stages are unchanged
+   */
+  gcc_pure
+  unsigned FindFirstChangedStage() const;
+
+  /**
+   * Has nothing changed since the last successful search?  Then the
+   * solution is still valid.
+   */
+  gcc_pure
+  bool IsUnchanged() const {
+    return previous_num_stages == num_stages &&
+      FindFirstChangedStage() == num_stages;
+  }
+
+  /**
+   * Run the search.  On success, the stages are remembered for the
+   * next call.  The edge map is not cleared; it's up to the caller
+   * to decide whether it can be reused.
+   */
   bool Run();
 
   bool Link(const ScanTaskPoint node, const ScanTaskPoint parent,
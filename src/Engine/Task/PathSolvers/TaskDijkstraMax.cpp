@@ -22,11 +22,39 @@
 
 #include "TaskDijkstraMax.hpp"
 
+#include <algorithm>
+
 bool
 TaskDijkstraMax::DistanceMax()
 {
-  dijkstra.Clear();
-  dijkstra.Reserve(256);
-  AddZeroStartEdges();
-  return Run();
+  if (IsUnchanged())
+    /* the previous solution is still valid */
+    return true;
+
+  /* when maximising, each link adds DIJKSTRA_MINMAX_OFFSET, so all
+     nodes of a stage are settled before any node of the next stage
+     is popped; therefore the values of all nodes before the first
+     changed stage are final and can be reused, as long as that stage
+     was not the final one of the previous search */
+  unsigned keep = previous_num_stages > 0
+    ? std::min(FindFirstChangedStage(), previous_num_stages - 1)
+    : 0;
+
+  if (keep > 0) {
+    const unsigned last_kept = keep - 1;
+    dijkstra.Restart([keep](ScanTaskPoint p){
+        return p.GetStageNumber() >= keep;
+      }, [last_kept](ScanTaskPoint p){
+        return p.GetStageNumber() == last_kept;
+      });
+  } else {
+    dijkstra.Clear();
+    dijkstra.Reserve(256);
+    AddZeroStartEdges();
+  }
+
+  const bool result = Run();
+  if (!result)
+    dijkstra.Clear();
+  return result;
 }
@@ -39,6 +39,9 @@ public:
    * in the corresponding task points for later accurate distance
    * measurement.
    *
+   * The search is skipped if no boundary has changed since the last
+   * call, and resumed at the first changed stage otherwise.
+   *
    * @return True if succeeded
    */
   bool DistanceMax();
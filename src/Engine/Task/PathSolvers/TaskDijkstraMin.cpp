@@ -25,6 +25,15 @@
 bool
 TaskDijkstraMin::DistanceMin(const SearchPoint &currentLocation)
 {
+  /* the start edges depend on the location, and unlike
+     TaskDijkstraMax, nodes which were not on the optimal path may not
+     have been settled, so the previous search can only be reused as
+     a whole */
+  if (IsUnchanged() && currentLocation.IsValid() == last_location.IsValid() &&
+      (!currentLocation.IsValid() ||
+       currentLocation.GetLocation() == last_location.GetLocation()))
+    return true;
+
   dijkstra.Clear();
   dijkstra.Reserve(256);
 
@@ -34,6 +43,10 @@ TaskDijkstraMin::DistanceMin(const SearchPoint &currentLocation)
     AddZeroStartEdges();
   }
 
-  return Run();
+  last_location = currentLocation;
+
+  const bool result = Run();
+  dijkstra.Clear();
+  return result;
 }
 
@@ -29,9 +29,16 @@
  * Specialisation of TaskDijkstra for minimum distance search
  */
 class TaskDijkstraMin final : public TaskDijkstra {
+  /**
+   * The aircraft location of the last search.
+   */
+  SearchPoint last_location;
+
 public:
   TaskDijkstraMin()
-    :TaskDijkstra(true) {}
+    :TaskDijkstra(true) {
+    last_location.SetInvalid();
+  }
 
   /**
    * Search task points for targets within OZs to produce the
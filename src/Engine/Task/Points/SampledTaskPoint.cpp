@@ -43,20 +43,18 @@ SampledTaskPoint::AddInsideSample(const AircraftState& state,
 {
   assert(state.location.IsValid());
 
-  // if sample is inside sample polygon
-  if (sampled_points.IsInside(state.location))
-    // return false (no update required)
-    return false;
+  const unsigned old_size = sampled_points.size();
 
-  // add sample to polygon
+  // add sample to the convex hull, unless it is inside already
   SearchPoint sp(state.location, projection);
-  sampled_points.push_back(sp);
+  if (!sampled_points.AddToHull(sp))
+    // return false (no update required)
+    return false;
 
-  // re-compute convex hull
-  bool retval = sampled_points.PruneInterior();
+  ++serial;
 
-  // only return true if hull changed
-  // return true; (update required)
+  // only return true if other points were removed from the hull
+  const bool retval = sampled_points.size() <= old_size;
   return sampled_points.ThinToSize(64) || retval;
 
   /* thin to size is used here to ensure the sampled points vector
@@ -71,6 +69,7 @@ SampledTaskPoint::ClearSampleAllButLast(const AircraftState& ref_last,
     sampled_points.clear();
     SearchPoint sp(ref_last.location, projection);
     sampled_points.push_back(sp);
+    ++serial;
   }
 }
 
@@ -99,12 +98,14 @@ SampledTaskPoint::UpdateProjection(const FlatProjection &projection)
   nominal_points.Project(projection);
   sampled_points.Project(projection);
   boundary_points.Project(projection);
+  ++serial;
 }
 
 void
 SampledTaskPoint::Reset()
 {
   sampled_points.clear();
+  ++serial;
 }
 
 const SearchPointVector &
@@ -24,6 +24,7 @@
 #define SAMPLEDTASKPOINT_H
 
 #include "Geo/SearchPointVector.hpp"
+#include "Util/Serial.hpp"
 #include "Compiler.h"
 
 class FlatProjection;
@@ -61,6 +62,13 @@ class SampledTaskPoint {
   SearchPoint search_max;
   SearchPoint search_min;
 
+  /**
+   * Incremented whenever one of the point vectors is modified.  This
+   * allows the task solvers to reuse results of stages which have not
+   * changed.
+   */
+  Serial serial;
+
 public:
   /**
    * Constructor.  Clears boundary and interior samples on
@@ -170,9 +178,16 @@ public:
     return boundary_scored;
   }
 
+  Serial GetSerial() const {
+    return serial;
+  }
+
 protected:
   void SetPast(bool _past) {
-    past = _past;
+    if (_past != past) {
+      past = _past;
+      ++serial;
+    }
   }
 
   /**
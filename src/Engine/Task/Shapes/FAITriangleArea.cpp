@@ -46,34 +46,32 @@ CalcAlpha(double dist_a, double dist_b, double dist_c)
     return Angle::acos(cos_alpha);
 }
 
-gcc_const
-static Angle
-CalcAngle(Angle angle, double dist_a, double dist_b, double dist_c,
-          bool reverse)
-{
-  const Angle alpha = CalcAlpha(dist_a, dist_b, dist_c);
-  return reverse
-    ? angle + alpha
-    : angle - alpha;
-}
+/**
+ * A point of the sector, relative to the first point of leg C: the
+ * angle between leg C and leg B, and the length of leg B.  This does
+ * not depend on the direction, therefore both sectors of a leg can be
+ * generated from the same list.
+ */
+struct SectorPoint {
+  Angle alpha;
+  double distance;
+};
 
-gcc_pure
-static GeoPoint
-CalcGeoPoint(const GeoPoint &origin, Angle angle,
-             double dist_a, double dist_b, double dist_c, bool reverse)
+gcc_const
+static SectorPoint
+CalcSectorPoint(double dist_a, double dist_b, double dist_c)
 {
-  return FindLatitudeLongitude(origin, CalcAngle(angle, dist_a, dist_b, dist_c,
-                                                 reverse), dist_b);
+  return {CalcAlpha(dist_a, dist_b, dist_c), dist_b};
 }
 
 /**
  * Total=min..max; A=28%
  */
-static GeoPoint *
-GenerateFAITriangleRight(GeoPoint *dest,
-                         const GeoPoint &origin, const GeoVector &leg_c,
+static SectorPoint *
+GenerateFAITriangleRight(SectorPoint *dest,
+                         const GeoVector &leg_c,
                          const double dist_min, const double dist_max,
-                         bool reverse, const double large_threshold)
+                         const double large_threshold)
 {
   const auto delta_distance = (dist_max - dist_min) / STEPS;
   auto total_distance = dist_min;
@@ -82,8 +80,7 @@ GenerateFAITriangleRight(GeoPoint *dest,
     const auto dist_a = SMALL_MIN_LEG * total_distance;
     const auto dist_b = total_distance - dist_a - leg_c.distance;
 
-    *dest++ = CalcGeoPoint(origin, leg_c.bearing,
-                           dist_a, dist_b, leg_c.distance, reverse);
+    *dest++ = CalcSectorPoint(dist_a, dist_b, leg_c.distance);
   }
 
   return dest;
@@ -92,11 +89,10 @@ GenerateFAITriangleRight(GeoPoint *dest,
 /**
  * Total=max
  */
-static GeoPoint *
-GenerateFAITriangleTop(GeoPoint *dest,
-                       const GeoPoint &origin, const GeoVector &leg_c,
-                       const double dist_max,
-                       bool reverse)
+static SectorPoint *
+GenerateFAITriangleTop(SectorPoint *dest,
+                       const GeoVector &leg_c,
+                       const double dist_max)
 {
   const auto delta_distance = dist_max * (1 - 3 * SMALL_MIN_LEG)
     / STEPS;
@@ -105,8 +101,7 @@ GenerateFAITriangleTop(GeoPoint *dest,
   for (unsigned i = 0; i < STEPS; ++i,
          dist_a += delta_distance,
          dist_b -= delta_distance) {
-    *dest++ = CalcGeoPoint(origin, leg_c.bearing,
-                           dist_a, dist_b, leg_c.distance, reverse);
+    *dest++ = CalcSectorPoint(dist_a, dist_b, leg_c.distance);
   }
 
   return dest;
@@ -115,11 +110,11 @@ GenerateFAITriangleTop(GeoPoint *dest,
 /**
  * Total=max..min; B=28%
  */
-static GeoPoint *
-GenerateFAITriangleLeft(GeoPoint *dest,
-                        const GeoPoint &origin, const GeoVector &leg_c,
+static SectorPoint *
+GenerateFAITriangleLeft(SectorPoint *dest,
+                        const GeoVector &leg_c,
                         const double dist_min, const double dist_max,
-                        bool reverse, const double large_threshold)
+                        const double large_threshold)
 {
   const auto delta_distance = (dist_max - dist_min) / STEPS;
   auto total_distance = dist_max;
@@ -131,8 +126,7 @@ GenerateFAITriangleLeft(GeoPoint *dest,
     const auto dist_b = SMALL_MIN_LEG * total_distance;
     const auto dist_a = total_distance - dist_b - leg_c.distance;
 
-    *dest++ = CalcGeoPoint(origin, leg_c.bearing,
-                           dist_a, dist_b, leg_c.distance, reverse);
+    *dest++ = CalcSectorPoint(dist_a, dist_b, leg_c.distance);
   }
 
   return dest;
@@ -141,10 +135,9 @@ GenerateFAITriangleLeft(GeoPoint *dest,
 /**
  * Total=C/LARGE_MAX_LEG; A=25..30%; B=30%..25%; C=45%
  */
-static GeoPoint *
-GenerateFAITriangleLargeBottom(GeoPoint *dest,
-                               const GeoPoint &origin, const GeoVector &leg_c,
-                               bool reverse)
+static SectorPoint *
+GenerateFAITriangleLargeBottom(SectorPoint *dest,
+                               const GeoVector &leg_c)
 {
   const auto total = leg_c.distance / LARGE_MAX_LEG;
 
@@ -154,8 +147,7 @@ GenerateFAITriangleLargeBottom(GeoPoint *dest,
   const auto delta_distance = (dist_a - dist_b) / STEPS;
   for (unsigned i = 0; i < STEPS; ++i,
          dist_a -= delta_distance, dist_b += delta_distance)
-    *dest++ = CalcGeoPoint(origin, leg_c.bearing,
-                           dist_a, dist_b, leg_c.distance, reverse);
+    *dest++ = CalcSectorPoint(dist_a, dist_b, leg_c.distance);
 
   return dest;
 }
@@ -163,10 +155,10 @@ GenerateFAITriangleLargeBottom(GeoPoint *dest,
 /**
  * Total=threshold; A=25%; B=30%..45%; C=45%..30%
  */
-static GeoPoint *
-GenerateFAITriangleLargeBottomRight(GeoPoint *dest,
-                                    const GeoPoint &origin, const GeoVector &leg_c,
-                                    bool reverse, const double large_threshold)
+static SectorPoint *
+GenerateFAITriangleLargeBottomRight(SectorPoint *dest,
+                                    const GeoVector &leg_c,
+                                    const double large_threshold)
 {
   const auto max_leg = large_threshold * LARGE_MAX_LEG;
   const auto min_leg = large_threshold - max_leg - leg_c.distance;
@@ -185,8 +177,7 @@ GenerateFAITriangleLargeBottomRight(GeoPoint *dest,
   const auto delta_distance = (a_start - a_end) / STEPS;
   for (unsigned i = 0; i < STEPS; ++i,
          dist_a -= delta_distance, dist_b += delta_distance) {
-    *dest++ = CalcGeoPoint(origin, leg_c.bearing,
-                           dist_a, dist_b, leg_c.distance, reverse);
+    *dest++ = CalcSectorPoint(dist_a, dist_b, leg_c.distance);
   }
 
   return dest;
@@ -195,11 +186,11 @@ GenerateFAITriangleLargeBottomRight(GeoPoint *dest,
 /**
  * Total=threshold..max[*]; A=25%; B=30%..45%; C=45%..30%
  */
-static GeoPoint *
-GenerateFAITriangleLargeRight1(GeoPoint *dest,
-                               const GeoPoint &origin, const GeoVector &leg_c,
+static SectorPoint *
+GenerateFAITriangleLargeRight1(SectorPoint *dest,
+                               const GeoVector &leg_c,
                                const double dist_min, const double dist_max,
-                               bool reverse, const double large_threshold)
+                               const double large_threshold)
 {
   const auto delta_distance = (dist_max - large_threshold) / STEPS;
   auto total_distance = std::max(dist_min, large_threshold);
@@ -211,8 +202,7 @@ GenerateFAITriangleLargeRight1(GeoPoint *dest,
     if (dist_b > total_distance * LARGE_MAX_LEG)
       break;
 
-    *dest++ = CalcGeoPoint(origin, leg_c.bearing,
-                           dist_a, dist_b, leg_c.distance, reverse);
+    *dest++ = CalcSectorPoint(dist_a, dist_b, leg_c.distance);
   }
 
   return dest;
@@ -221,11 +211,11 @@ GenerateFAITriangleLargeRight1(GeoPoint *dest,
 /**
  * Total=min..max; A=25%..30%; B=45%; C=30%..25%
  */
-static GeoPoint *
-GenerateFAITriangleLargeRight2(GeoPoint *dest,
-                               const GeoPoint &origin, const GeoVector &leg_c,
+static SectorPoint *
+GenerateFAITriangleLargeRight2(SectorPoint *dest,
+                               const GeoVector &leg_c,
                                const double dist_min, const double dist_max,
-                               bool reverse, const double large_threshold)
+                               const double large_threshold)
 {
   /* this is the total distance where the Right1 arc ends; here, A is
      25% */
@@ -240,18 +230,16 @@ GenerateFAITriangleLargeRight2(GeoPoint *dest,
     const auto dist_b = total_distance * LARGE_MAX_LEG;
     const auto dist_a = total_distance - dist_b - leg_c.distance;
 
-    *dest++ = CalcGeoPoint(origin, leg_c.bearing,
-                           dist_a, dist_b, leg_c.distance, reverse);
+    *dest++ = CalcSectorPoint(dist_a, dist_b, leg_c.distance);
   }
 
   return dest;
 }
 
-static GeoPoint *
-GenerateFAITriangleLargeTop(GeoPoint *dest,
-                            const GeoPoint &origin, const GeoVector &leg_c,
-                            const double dist_max,
-                            bool reverse)
+static SectorPoint *
+GenerateFAITriangleLargeTop(SectorPoint *dest,
+                            const GeoVector &leg_c,
+                            const double dist_max)
 {
   const auto max_leg = dist_max * LARGE_MAX_LEG;
   const auto min_leg = dist_max - leg_c.distance - max_leg;
@@ -261,8 +249,7 @@ GenerateFAITriangleLargeTop(GeoPoint *dest,
   auto dist_a = min_leg, dist_b = max_leg;
   for (unsigned i = 0; i < STEPS; ++i,
          dist_a += delta_distance, dist_b -= delta_distance) {
-    *dest++ = CalcGeoPoint(origin, leg_c.bearing,
-                           dist_a, dist_b, leg_c.distance, reverse);
+    *dest++ = CalcSectorPoint(dist_a, dist_b, leg_c.distance);
   }
 
   return dest;
@@ -271,11 +258,11 @@ GenerateFAITriangleLargeTop(GeoPoint *dest,
 /**
  * Total=max..min; A=45%; B=30%..25%; C=25%..30%
  */
-static GeoPoint *
-GenerateFAITriangleLargeLeft2(GeoPoint *dest,
-                              const GeoPoint &origin, const GeoVector &leg_c,
+static SectorPoint *
+GenerateFAITriangleLargeLeft2(SectorPoint *dest,
+                              const GeoVector &leg_c,
                               const double dist_min, const double dist_max,
-                              bool reverse, const double large_threshold)
+                              const double large_threshold)
 {
   const auto delta_distance = (dist_max - dist_min) / STEPS;
   auto total_distance = dist_max;
@@ -289,8 +276,7 @@ GenerateFAITriangleLargeLeft2(GeoPoint *dest,
     if (dist_b < LargeMinLeg(total_distance))
       break;
 
-    *dest++ = CalcGeoPoint(origin, leg_c.bearing,
-                           dist_a, dist_b, leg_c.distance, reverse);
+    *dest++ = CalcSectorPoint(dist_a, dist_b, leg_c.distance);
   }
 
   return dest;
@@ -299,11 +285,11 @@ GenerateFAITriangleLargeLeft2(GeoPoint *dest,
 /**
  * Total=min..threshold; A=45%..30%; B=25%; C=30%..45%
  */
-static GeoPoint *
-GenerateFAITriangleLargeLeft1(GeoPoint *dest,
-                              const GeoPoint &origin, const GeoVector &leg_c,
+static SectorPoint *
+GenerateFAITriangleLargeLeft1(SectorPoint *dest,
+                              const GeoVector &leg_c,
                               const double dist_min, const double dist_max,
-                              bool reverse, const double large_threshold)
+                              const double large_threshold)
 {
   /* this is the total distance where the Left1 arc starts; here, A is
      25% */
@@ -323,8 +309,7 @@ GenerateFAITriangleLargeLeft1(GeoPoint *dest,
     const auto dist_b = LargeMinLeg(total_distance);
     const auto dist_a = total_distance - dist_b - leg_c.distance;
 
-    *dest++ = CalcGeoPoint(origin, leg_c.bearing,
-                           dist_a, dist_b, leg_c.distance, reverse);
+    *dest++ = CalcSectorPoint(dist_a, dist_b, leg_c.distance);
   }
 
   //*dest++ = leg_c.EndPoint(origin);
@@ -335,10 +320,10 @@ GenerateFAITriangleLargeLeft1(GeoPoint *dest,
 /**
  * Total=threshold; A=30%..45%; B=25%; C=45%..30%
  */
-static GeoPoint *
-GenerateFAITriangleLargeBottomLeft(GeoPoint *dest,
-                                    const GeoPoint &origin, const GeoVector &leg_c,
-                                    bool reverse, const double large_threshold)
+static SectorPoint *
+GenerateFAITriangleLargeBottomLeft(SectorPoint *dest,
+                                    const GeoVector &leg_c,
+                                    const double large_threshold)
 {
   const auto max_leg = large_threshold * LARGE_MAX_LEG;
   const auto min_leg = large_threshold - max_leg - leg_c.distance;
@@ -357,23 +342,18 @@ GenerateFAITriangleLargeBottomLeft(GeoPoint *dest,
   const auto delta_distance = (b_end - b_start) / STEPS;
   for (unsigned i = 0; i < STEPS; ++i,
          dist_a -= delta_distance, dist_b += delta_distance) {
-    *dest++ = CalcGeoPoint(origin, leg_c.bearing,
-                           dist_a, dist_b, leg_c.distance, reverse);
+    *dest++ = CalcSectorPoint(dist_a, dist_b, leg_c.distance);
   }
 
   return dest;
 }
 
-GeoPoint *
-GenerateFAITriangleArea(GeoPoint *dest,
-                        const GeoPoint &pt1, const GeoPoint &pt2,
-                        bool reverse,
-                        const FAITriangleSettings &settings)
+static SectorPoint *
+GenerateFAITriangleSector(SectorPoint *dest, const GeoVector &leg_c,
+                          const FAITriangleSettings &settings)
 {
   const auto large_threshold = settings.GetThreshold();
 
-  const auto leg_c = pt1.DistanceBearing(pt2);
-
   const auto dist_max = leg_c.distance / SMALL_MIN_LEG;
   const auto dist_min = leg_c.distance / SMALL_MAX_LEG;
 
@@ -384,52 +364,90 @@ GenerateFAITriangleArea(GeoPoint *dest,
   const bool have_small = large_dist_min < large_threshold || dist_min <= large_dist_min;
 
   if (have_small) {
-    dest = GenerateFAITriangleRight(dest, pt1, leg_c,
+    dest = GenerateFAITriangleRight(dest, leg_c,
                                     dist_min, dist_max,
-                                    reverse, large_threshold);
+                                    large_threshold);
 
     if (have_large)
-      dest = GenerateFAITriangleLargeBottomRight(dest, pt1, leg_c,
-                                                 reverse, large_threshold);
+      dest = GenerateFAITriangleLargeBottomRight(dest, leg_c,
+                                                 large_threshold);
   } else
-    dest = GenerateFAITriangleLargeBottom(dest, pt1, leg_c,
-                                          reverse);
+    dest = GenerateFAITriangleLargeBottom(dest, leg_c);
 
   if (have_large) {
-    dest = GenerateFAITriangleLargeRight1(dest, pt1, leg_c,
+    dest = GenerateFAITriangleLargeRight1(dest, leg_c,
                                           large_dist_min, large_dist_max,
-                                          reverse, large_threshold);
+                                          large_threshold);
 
-    dest = GenerateFAITriangleLargeRight2(dest, pt1, leg_c,
+    dest = GenerateFAITriangleLargeRight2(dest, leg_c,
                                           large_dist_min, large_dist_max,
-                                          reverse, large_threshold);
+                                          large_threshold);
 
-    dest = GenerateFAITriangleLargeTop(dest, pt1, leg_c,
-                                       large_dist_max,
-                                       reverse);
+    dest = GenerateFAITriangleLargeTop(dest, leg_c, large_dist_max);
 
-    dest = GenerateFAITriangleLargeLeft2(dest, pt1, leg_c,
+    dest = GenerateFAITriangleLargeLeft2(dest, leg_c,
                                          large_dist_min, large_dist_max,
-                                         reverse, large_threshold);
+                                         large_threshold);
 
-    dest = GenerateFAITriangleLargeLeft1(dest, pt1, leg_c,
+    dest = GenerateFAITriangleLargeLeft1(dest, leg_c,
                                          large_dist_min, large_dist_max,
-                                         reverse, large_threshold);
+                                         large_threshold);
   }
 
   if (have_small) {
     if (have_large)
-      dest = GenerateFAITriangleLargeBottomLeft(dest, pt1, leg_c,
-                                                reverse, large_threshold);
+      dest = GenerateFAITriangleLargeBottomLeft(dest, leg_c,
+                                                large_threshold);
     else
-      dest = GenerateFAITriangleTop(dest, pt1, leg_c,
-                                    dist_max,
-                                    reverse);
+      dest = GenerateFAITriangleTop(dest, leg_c, dist_max);
 
-    dest = GenerateFAITriangleLeft(dest, pt1, leg_c,
+    dest = GenerateFAITriangleLeft(dest, leg_c,
                                    dist_min, dist_max,
-                                   reverse, large_threshold);
+                                   large_threshold);
+  }
+
+  return dest;
+}
+
+GeoPoint *
+GenerateFAITriangleArea(GeoPoint *dest,
+                        const GeoPoint &pt1, const GeoPoint &pt2,
+                        bool reverse,
+                        const FAITriangleSettings &settings)
+{
+  const auto leg_c = pt1.DistanceBearing(pt2);
+
+  SectorPoint sector[FAI_TRIANGLE_SECTOR_MAX];
+  const SectorPoint *const end =
+    GenerateFAITriangleSector(sector, leg_c, settings);
+
+  for (const SectorPoint *i = sector; i != end; ++i) {
+    const Angle angle = reverse
+      ? leg_c.bearing + i->alpha
+      : leg_c.bearing - i->alpha;
+    *dest++ = FindLatitudeLongitude(pt1, angle, i->distance);
   }
 
   return dest;
 }
+
+unsigned
+GenerateFAITriangleAreas(GeoPoint *dest, GeoPoint *reverse_dest,
+                         const GeoPoint &pt1, const GeoPoint &pt2,
+                         const FAITriangleSettings &settings)
+{
+  const auto leg_c = pt1.DistanceBearing(pt2);
+
+  SectorPoint sector[FAI_TRIANGLE_SECTOR_MAX];
+  const SectorPoint *const end =
+    GenerateFAITriangleSector(sector, leg_c, settings);
+
+  for (const SectorPoint *i = sector; i != end; ++i) {
+    *dest++ = FindLatitudeLongitude(pt1, leg_c.bearing - i->alpha,
+                                    i->distance);
+    *reverse_dest++ = FindLatitudeLongitude(pt1, leg_c.bearing + i->alpha,
+                                            i->distance);
+  }
+
+  return end - sector;
+}
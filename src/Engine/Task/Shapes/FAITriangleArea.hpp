@@ -38,4 +38,19 @@ GenerateFAITriangleArea(GeoPoint *dest,
                         bool reverse,
                         const FAITriangleSettings &settings);
 
+/**
+ * Generate both sectors of the leg pt1-pt2 in one pass, i.e. the
+ * results of GenerateFAITriangleArea() with reverse=false and
+ * reverse=true.  This is cheaper than two separate calls, because
+ * the sector shape is calculated only once.
+ *
+ * @param dest the destination for the sector left of the leg
+ * @param reverse_dest the destination for the sector right of the leg
+ * @return the number of points written to each of the two buffers
+ */
+unsigned
+GenerateFAITriangleAreas(GeoPoint *dest, GeoPoint *reverse_dest,
+                         const GeoPoint &pt1, const GeoPoint &pt2,
+                         const FAITriangleSettings &settings);
+
 #endif
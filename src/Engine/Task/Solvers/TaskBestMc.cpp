@@ -80,12 +80,12 @@ TaskBestMc::search(const double mc)
 }
 
 bool
-TaskBestMc::search(const double mc, double &result)
+TaskBestMc::search(const double mc, double &result, const double previous)
 {
   // only search if mc zero is valid
   f(0);
   if (valid(0)) {
-    auto a = find_zero(mc);
+    auto a = find_zero_near(previous, SEARCH_RADIUS);
     if (valid(a)) {
       result = a;
       return true;
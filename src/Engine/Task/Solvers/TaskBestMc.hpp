@@ -78,7 +78,19 @@ public:
    */
   double search(double mc);
 
-  bool search(double mc, double &result);
+  /**
+   * Search for best MC, starting in a narrow range around a previous
+   * solution.
+   *
+   * @param mc Default MacCready value (m/s)
+   * @param result receives the best MC value found or the default
+   * value if no solution
+   * @param previous the solution of the previous search; this is only
+   * a hint to reduce the number of iterations
+   *
+   * @return true if a solution was found
+   */
+  bool search(double mc, double &result, double previous);
 
 private:
 
@@ -92,6 +104,12 @@ private:
   gcc_pure
   bool valid(double mc) const;
 
+  /**
+   * Half width of the range around the previous solution which is
+   * searched first.
+   */
+  static constexpr double SEARCH_RADIUS = 0.5;
+
   /* virtual methods from class ZeroFinder */
   virtual double f(double mc) override;
 };
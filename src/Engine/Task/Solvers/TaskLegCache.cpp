@@ -0,0 +1,79 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#include "TaskLegCache.hpp"
+#include "GlideSolvers/GlideState.hpp"
+#include "GlideSolvers/MacCready.hpp"
+
+#include <assert.h>
+
+inline bool
+TaskLegCache::Leg::Matches(const GlideState &state) const
+{
+  return valid &&
+    vector.distance == state.vector.distance &&
+    vector.bearing == state.vector.bearing &&
+    min_arrival_altitude == state.min_arrival_altitude &&
+    altitude_difference == state.altitude_difference &&
+    wind.norm == state.wind.norm &&
+    wind.bearing == state.wind.bearing;
+}
+
+void
+TaskLegCache::Clear()
+{
+  for (auto &leg : legs)
+    leg.valid = false;
+}
+
+void
+TaskLegCache::Begin(const GlideSettings &_settings, const GlidePolar &_polar)
+{
+  if (_settings.predict_wind_drift == settings.predict_wind_drift &&
+      _polar == polar)
+    return;
+
+  settings = _settings;
+  polar = _polar;
+  Clear();
+}
+
+GlideResult
+TaskLegCache::Solve(unsigned i, const GlideState &state)
+{
+  assert(i < legs.size());
+
+  Leg &leg = legs[i];
+  if (leg.Matches(state))
+    return leg.result;
+
+  leg.vector = state.vector;
+  leg.min_arrival_altitude = state.min_arrival_altitude;
+  leg.altitude_difference = state.altitude_difference;
+  leg.wind = state.wind;
+  leg.result = MacCready::Solve(settings, polar, state);
+  leg.valid = true;
+
+  ++serial;
+  return leg.result;
+}
@@ -0,0 +1,113 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#ifndef TASK_LEG_CACHE_HPP
+#define TASK_LEG_CACHE_HPP
+
+#include "GlideSolvers/GlidePolar.hpp"
+#include "GlideSolvers/GlideResult.hpp"
+#include "GlideSolvers/GlideSettings.hpp"
+#include "Geo/GeoVector.hpp"
+#include "Geo/SpeedVector.hpp"
+
+#include <array>
+
+struct GlideState;
+
+/**
+ * Remembers the glide solution of each leg calculated by
+ * #TaskMacCready, together with the inputs it was calculated from.
+ * Between two task updates, most legs have the same inputs, and
+ * their solution can be reused instead of invoking the MacCready
+ * solver again.
+ *
+ * One instance shall be used for only one kind of calculation
+ * (e.g. remaining or planned), because legs are looked up by their
+ * index.
+ */
+class TaskLegCache {
+public:
+  static constexpr unsigned MAX_SIZE = 32;
+
+private:
+  struct Leg {
+    GeoVector vector;
+    double min_arrival_altitude;
+    double altitude_difference;
+    SpeedVector wind;
+
+    GlideResult result;
+
+    bool valid;
+
+    gcc_pure
+    bool Matches(const GlideState &state) const;
+  };
+
+  std::array<Leg, MAX_SIZE> legs;
+
+  GlideSettings settings;
+  GlidePolar polar;
+
+  /**
+   * Incremented each time a leg was calculated (i.e. was not found
+   * in the cache).
+   */
+  unsigned serial;
+
+public:
+  TaskLegCache()
+    :polar(GlidePolar::Invalid()), serial(0) {
+    settings.SetDefaults();
+    Clear();
+  }
+
+  /**
+   * Discard all cached solutions.
+   */
+  void Clear();
+
+  /**
+   * Prepare a calculation with the specified parameters.  If they
+   * differ from the previous ones, all cached solutions are
+   * discarded.
+   */
+  void Begin(const GlideSettings &_settings, const GlidePolar &_polar);
+
+  /**
+   * Calculate the glide solution of the specified leg, or return
+   * the cached one if its inputs have not changed.
+   */
+  GlideResult Solve(unsigned i, const GlideState &state);
+
+  /**
+   * Returns a number which is modified each time a leg was
+   * calculated.  Callers may compare it with a previous value to
+   * check whether Solve() has produced any new result.
+   */
+  unsigned GetSerial() const {
+    return serial;
+  }
+};
+
+#endif
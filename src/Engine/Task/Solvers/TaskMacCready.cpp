@@ -24,12 +24,26 @@
 #include "TaskSolution.hpp"
 #include "Task/Points/TaskPoint.hpp"
 #include "Navigation/Aircraft.hpp"
+#include "GlideSolvers/GlideState.hpp"
+#include "GlideSolvers/MacCready.hpp"
 
 #include <algorithm>
+#include <vector>
+
+inline GlideResult
+TaskMacCready::SolvePoint(unsigned i, const GlideState &state)
+{
+  return cache != nullptr
+    ? cache->Solve(i, state)
+    : MacCready::Solve(settings, glide_polar, state);
+}
 
 GlideResult
 TaskMacCready::glide_solution(const AircraftState &aircraft)
 {
+  if (cache != nullptr)
+    cache->Begin(settings, glide_polar);
+
   const auto aircraft_min_height = get_min_height(aircraft);
   GlideResult acc_gr;
   auto aircraft_predict = get_aircraft_start(aircraft);
@@ -39,7 +53,8 @@ TaskMacCready::glide_solution(const AircraftState &aircraft)
                                         points[i]->GetElevation());
 
     // perform estimate, ensuring that alt is above previous taskpoint
-    const auto gr = SolvePoint(*points[i], aircraft_predict, tp_min_height);
+    const auto gr = SolvePoint(i, GetGlideState(*points[i], aircraft_predict,
+                                                tp_min_height));
     leg_solutions[i] = gr;
 
     // update state
@@ -62,6 +77,55 @@ TaskMacCready::glide_solution(const AircraftState &aircraft)
   return acc_gr;
 }
 
+void
+TaskMacCready::glide_solutions(const AircraftState &aircraft,
+                               const GlidePolar *polars, unsigned n,
+                               GlideResult *results)
+{
+  const auto aircraft_min_height = get_min_height(aircraft);
+  const auto aircraft_start = get_aircraft_start(aircraft);
+  const unsigned size = points.size();
+
+  /* everything but the altitude difference is independent of the
+     glide polar; the altitude difference is patched below */
+  std::array<double, MAX_SIZE> min_heights;
+  std::vector<GlideState> states;
+  states.reserve(size);
+  for (unsigned i = 0; i < size; ++i) {
+    min_heights[i] = std::max(aircraft_min_height,
+                              points[i]->GetElevation());
+    states.push_back(GetGlideState(*points[i], aircraft_start,
+                                   min_heights[i]));
+  }
+
+  for (unsigned j = 0; j < n; ++j) {
+    GlideResult acc_gr;
+    auto altitude = aircraft_start.altitude;
+
+    for (unsigned i = 0; i < size; ++i) {
+      GlideState &state = states[i];
+      state.altitude_difference = altitude - state.min_arrival_altitude;
+
+      const auto gr = MacCready::Solve(settings, polars[j], state);
+      leg_solutions[i] = gr;
+
+      if (i == 0)
+        acc_gr = gr;
+      else
+        acc_gr.Add(gr);
+
+      /* see glide_solution() */
+      altitude = min_heights[i];
+      if (gr.altitude_difference > 0)
+        altitude += gr.altitude_difference;
+    }
+
+    leg_solutions[active_index].CalcDeferred();
+    acc_gr.CalcDeferred();
+    results[j] = acc_gr;
+  }
+}
+
 GlideResult
 TaskMacCready::glide_sink(const AircraftState &aircraft, const double S) const
 {
@@ -26,11 +26,13 @@
 #include "Util/StaticArray.hxx"
 #include "GlideSolvers/GlidePolar.hpp"
 #include "GlideSolvers/GlideResult.hpp"
+#include "TaskLegCache.hpp"
 
 #include <array>
 
 struct AircraftState;
 struct GlideSettings;
+struct GlideState;
 class TaskPoint;
 class OrderedTaskPoint;
 
@@ -80,6 +82,14 @@ protected:
    */
   GlidePolar glide_polar;
 
+  /**
+   * If not nullptr, then glide_solution() looks up leg solutions in
+   * this cache instead of always calculating them.
+   */
+  TaskLegCache *cache = nullptr;
+
+  static_assert(TaskLegCache::MAX_SIZE >= MAX_SIZE, "Cache too small");
+
 public:
   /**
    * Constructor for ordered task points
@@ -119,6 +129,23 @@ public:
    */
   GlideResult glide_solution(const AircraftState &aircraft);
 
+  /**
+   * Calculate the glide solution for each of the given glide polars,
+   * e.g. for a MacCready/ballast/bugs sweep.  This is equivalent to
+   * calling glide_solution() with each polar, but the leg geometry
+   * and the wind components are calculated only once and shared by
+   * all of them.  The cache is not used.
+   *
+   * After returning, get_active_solution() refers to the last polar.
+   *
+   * @param aircraft Aircraft state
+   * @param polars an array of #n glide polars
+   * @param results an array of #n glide results (output)
+   */
+  void glide_solutions(const AircraftState &aircraft,
+                       const GlidePolar *polars, unsigned n,
+                       GlideResult *results);
+
   /**
    * Calculate glide solution for externally specified aircraft sink rate
    *
@@ -130,6 +157,14 @@ public:
   gcc_pure
   GlideResult glide_sink(const AircraftState &aircraft, double S) const;
 
+  /**
+   * Use the specified cache for glide_solution().  It must not be
+   * used for any other kind of calculation.
+   */
+  void SetCache(TaskLegCache &_cache) {
+    cache = &_cache;
+  }
+
   /**
    * Adjust MacCready value of internal glide polar
    *
@@ -176,20 +211,26 @@ private:
   virtual double get_min_height(const AircraftState &state) const = 0;
 
   /**
-   * Pure virtual method to calculate glide solution for specified point, given
-   * aircraft state and height constraint.
+   * Pure virtual method to describe the glide to the specified point,
+   * given aircraft state and height constraint.
    * This is used to provide alternate methods for different perspectives
    * on the task, e.g. planned/remaining/travelled
    *
    * @param state Aircraft state at origin
    * @param minH Minimum height at destination
    *
-   * @return Glide result for segment
+   * @return Glide state for segment
    */
   gcc_pure
-  virtual GlideResult SolvePoint(const TaskPoint &tp,
-                                 const AircraftState &state,
-                                 double minH) const = 0;
+  virtual GlideState GetGlideState(const TaskPoint &tp,
+                                   const AircraftState &state,
+                                   double minH) const = 0;
+
+  /**
+   * Calculate the glide solution for the specified leg, using the
+   * cache if one was set.
+   */
+  GlideResult SolvePoint(unsigned i, const GlideState &state);
 
   /**
    * Pure virtual method to obtain aircraft state at start of task.
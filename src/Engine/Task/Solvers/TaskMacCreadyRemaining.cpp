@@ -22,14 +22,13 @@
 
 #include "TaskMacCreadyRemaining.hpp"
 #include "GlideSolvers/GlideState.hpp"
-#include "GlideSolvers/MacCready.hpp"
 #include "Task/Points/TaskPoint.hpp"
 #include "Task/Ordered/Points/AATPoint.hpp"
 
-GlideResult
-TaskMacCreadyRemaining::SolvePoint(const TaskPoint &tp,
-                                   const AircraftState &aircraft,
-                                   double minH) const
+GlideState
+TaskMacCreadyRemaining::GetGlideState(const TaskPoint &tp,
+                                      const AircraftState &aircraft,
+                                      double minH) const
 {
   GlideState gs = GlideState::Remaining(tp, aircraft, minH);
 
@@ -39,7 +38,7 @@ TaskMacCreadyRemaining::SolvePoint(const TaskPoint &tp,
     /* ignore the travel to the start point */
     gs.vector.distance = 0;
 
-  return MacCready::Solve(settings, glide_polar, gs);
+  return gs;
 }
 
 
@@ -97,9 +97,9 @@ private:
     return 0;
   }
 
-  GlideResult SolvePoint(const TaskPoint &tp,
-                         const AircraftState &aircraft,
-                         double minH) const override;
+  GlideState GetGlideState(const TaskPoint &tp,
+                           const AircraftState &aircraft,
+                           double minH) const override;
 
   AircraftState get_aircraft_start(const AircraftState &aircraft) const override;
 };
@@ -21,20 +21,25 @@
  */
 
 #include "TaskMacCreadyTotal.hpp"
-#include "TaskSolution.hpp"
+#include "GlideSolvers/GlideState.hpp"
 #include "Task/Points/TaskPoint.hpp"
 #include "Task/Ordered/Points/OrderedTaskPoint.hpp"
+#include "Navigation/Aircraft.hpp"
 
-GlideResult
-TaskMacCreadyTotal::SolvePoint(const TaskPoint &tp,
-                               const AircraftState &aircraft,
-                               double minH) const
+#include <algorithm>
+
+GlideState
+TaskMacCreadyTotal::GetGlideState(const TaskPoint &tp,
+                                  const AircraftState &aircraft,
+                                  double minH) const
 {
   assert(tp.GetType() != TaskPointType::UNORDERED);
+  assert(aircraft.location.IsValid());
   const OrderedTaskPoint &otp = (const OrderedTaskPoint &)tp;
 
-  return TaskSolution::GlideSolutionPlanned(otp, aircraft,
-                                            settings, glide_polar, minH);
+  return GlideState(otp.GetVectorPlanned(),
+                    std::max(minH, otp.GetElevation()),
+                    aircraft.altitude, aircraft.wind);
 }
 
 AircraftState
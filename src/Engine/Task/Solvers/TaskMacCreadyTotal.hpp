@@ -71,9 +71,9 @@ private:
     return double(0);
   }
 
-  GlideResult SolvePoint(const TaskPoint &tp,
-                         const AircraftState &aircraft,
-                         double minH) const override;
+  GlideState GetGlideState(const TaskPoint &tp,
+                           const AircraftState &aircraft,
+                           double minH) const override;
 
   AircraftState get_aircraft_start(const AircraftState &aircraft) const override;
 };
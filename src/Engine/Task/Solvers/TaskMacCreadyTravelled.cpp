@@ -21,21 +21,25 @@
  */
 
 #include "TaskMacCreadyTravelled.hpp"
-#include "TaskSolution.hpp"
+#include "GlideSolvers/GlideState.hpp"
 #include "Task/Points/TaskPoint.hpp"
 #include "Task/Ordered/Points/OrderedTaskPoint.hpp"
 #include "Navigation/Aircraft.hpp"
 
-GlideResult
-TaskMacCreadyTravelled::SolvePoint(const TaskPoint &tp,
-                                   const AircraftState &aircraft,
-                                   double minH) const
+#include <algorithm>
+
+GlideState
+TaskMacCreadyTravelled::GetGlideState(const TaskPoint &tp,
+                                      const AircraftState &aircraft,
+                                      double minH) const
 {
   assert(tp.GetType() != TaskPointType::UNORDERED);
+  assert(aircraft.location.IsValid());
   const OrderedTaskPoint &otp = (const OrderedTaskPoint &)tp;
 
-  return TaskSolution::GlideSolutionTravelled(otp, aircraft,
-                                              settings, glide_polar, minH);
+  return GlideState(otp.GetVectorTravelled(),
+                    std::max(minH, otp.GetElevation()),
+                    aircraft.altitude, aircraft.wind);
 }
 
 AircraftState
@@ -48,9 +48,9 @@ private:
   /* virtual methods from class TaskMacCready */
   virtual double get_min_height(const AircraftState &aircraft) const override;
 
-  virtual GlideResult SolvePoint(const TaskPoint &tp,
-                                 const AircraftState &aircraft,
-                                 double minH) const override;
+  virtual GlideState GetGlideState(const TaskPoint &tp,
+                                   const AircraftState &aircraft,
+                                   double minH) const override;
 
   virtual AircraftState get_aircraft_start(const AircraftState &aircraft) const override;
 };
@@ -40,7 +40,7 @@ TaskMinTarget::TaskMinTarget(const std::vector<OrderedTaskPoint*>& tps,
    tp_start(_ts),
    force_current(false)
 {
-
+  tm.SetCache(leg_cache);
 }
 
 double
@@ -70,7 +70,7 @@ TaskMinTarget::search(const double tp)
 
   force_current = false;
   /// @todo if search fails, force current
-  const auto p = find_zero(tp);
+  const auto p = find_zero_near(tp, SEARCH_RADIUS);
   if (valid(p)) {
     return p;
   } else {
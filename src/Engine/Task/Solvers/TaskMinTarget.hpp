@@ -41,6 +41,12 @@ class StartPoint;
  *   target.
  */
 class TaskMinTarget final : private ZeroFinder {
+  /**
+   * Legs whose end points are not adjusted by set_range() (e.g. locked
+   * targets) are looked up here instead of being solved again on
+   * each evaluation.
+   */
+  TaskLegCache leg_cache;
   TaskMacCreadyRemaining tm;
   GlideResult res;
   const AircraftState &aircraft;
@@ -48,6 +54,9 @@ class TaskMinTarget final : private ZeroFinder {
   StartPoint *tp_start;
   bool force_current;
 
+  /** Half width of the range tried first around the initial guess */
+  static constexpr double SEARCH_RADIUS = 0.05;
+
 public:
   /**
    * Constructor for ordered task points
@@ -85,7 +94,8 @@ public:
    *
    * Running this adjusts the target values for AAT task points.
    *
-   * @param p Default range (0-1)
+   * @param p Initial guess of the range (0-1), e.g. the solution of
+   * the previous search
    *
    * @return Range value for solution
    */
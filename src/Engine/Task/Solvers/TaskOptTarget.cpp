@@ -43,6 +43,7 @@ TaskOptTarget::TaskOptTarget(const std::vector<OrderedTaskPoint*>& tps,
    tp_current(_tp_current),
    iso(_tp_current, projection)
 {
+  tm.SetCache(leg_cache);
 }
 
 double
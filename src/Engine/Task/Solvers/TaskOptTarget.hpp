@@ -41,6 +41,11 @@ class StartPoint;
  */
 class TaskOptTarget final : public ZeroFinder
 {
+  /**
+   * Only the legs adjacent to the moving target change between two
+   * evaluations; the others are looked up here.
+   */
+  TaskLegCache leg_cache;
   /** Object to calculate remaining task statistics */
   TaskMacCreadyRemaining tm;
   /** Glide solution used in search */
@@ -96,6 +101,17 @@ public:
    */
   virtual double search(double p);
 
+  /**
+   * Search, starting at the current target.  If the target is still
+   * optimal (the usual case since it is the result of the previous
+   * search), this takes only a few evaluations.
+   *
+   * @return Isoline value for solution
+   */
+  double search_from_target() {
+    return search(iso.IsValid() ? iso.GetTargetParameter() : 0.5);
+  }
+
 private:
   /** Sets target location along isoline */
   void SetTarget(double p);
@@ -69,7 +69,7 @@ double
 TaskSolveTravelled::search(const double ce)
 {
 #ifdef SOLVE_ZERO
-  return find_zero(ce);
+  return find_zero_near(ce, (xmax - xmin) / 16);
 #else
   return find_min(ce);
 #endif
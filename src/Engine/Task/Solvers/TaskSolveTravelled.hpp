@@ -66,7 +66,9 @@ protected:
 
 public:
   /**
-   * Search for parameter value.
+   * Search for parameter value.  The search starts in a narrow
+   * range around the given value, so passing the previous solution
+   * saves most iterations if it did not change much.
    *
    * @param ce Default parameter value
    *
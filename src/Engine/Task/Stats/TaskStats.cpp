@@ -55,6 +55,7 @@ TaskStats::reset()
   flight_mode_final_glide = false;
   start.Reset();
   last_hour.Reset();
+  generation = 0;
 }
 
 bool
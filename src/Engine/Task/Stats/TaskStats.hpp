@@ -103,6 +103,14 @@ public:
 
   WindowStats last_hour;
 
+  /**
+   * Incremented by each task update which has modified the task
+   * geometry or at least one leg's glide solution.  Consumers may
+   * compare it with the value they have seen previously to skip
+   * redundant work.
+   */
+  unsigned generation;
+
   double GetEstimatedTotalTime() const {
     return total.time_elapsed + total.time_remaining_start;
   }
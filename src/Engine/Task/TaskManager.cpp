@@ -26,6 +26,7 @@
 #include "Ordered/Points/AATPoint.hpp"
 #include "Unordered/GotoTask.hpp"
 #include "Unordered/AlternateTask.hpp"
+#include "Util/AllocationStats.hpp"
 
 TaskManager::TaskManager(const TaskBehaviour &_task_behaviour,
                          const Waypoints &wps)
@@ -265,6 +266,8 @@ bool
 TaskManager::Update(const AircraftState &state,
                     const AircraftState &state_last)
 {
+  const ScopeAllocationTag alloc_tag(AllocationTag::TASK);
+
   /* always update ordered task so even if we are temporarily in a
      different mode, so the task stats are still updated.  Otherwise,
      the task stats would freeze and sampling etc would not be
@@ -517,6 +520,26 @@ TaskManager::Clone(const TaskBehaviour &tb) const
   return ordered_task->Clone(tb);
 }
 
+OrderedTask *
+TaskManager::CloneWithoutGeometry(const TaskBehaviour &tb) const
+{
+  return ordered_task->CloneWithoutGeometry(tb);
+}
+
+void
+TaskManager::CalcGlideSolutions(const AircraftState &state,
+                                const GlidePolar *polars, unsigned n,
+                                GlideResult *results) const
+{
+  if (mode == TaskType::ORDERED) {
+    ordered_task->CalcGlideSolutions(state, polars, n, results);
+    return;
+  }
+
+  for (unsigned i = 0; i < n; ++i)
+    results[i].Reset();
+}
+
 bool
 TaskManager::Commit(const OrderedTask &other)
 {
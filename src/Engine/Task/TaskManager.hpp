@@ -287,6 +287,13 @@ public:
   gcc_malloc
   OrderedTask *Clone(const TaskBehaviour &tb) const;
 
+  /**
+   * Create a clone of the ordered task without calculating its
+   * geometry, see OrderedTask::CloneWithoutGeometry().
+   */
+  gcc_malloc
+  OrderedTask *CloneWithoutGeometry(const TaskBehaviour &tb) const;
+
   /**
    * Copy task into this task
    *
@@ -334,6 +341,17 @@ public:
     return glide_polar;
   }
 
+  /**
+   * Calculate the remaining glide solution of the ordered task for
+   * each of the given glide polars (e.g. with different MacCready,
+   * ballast or bugs settings) in one pass, see
+   * OrderedTask::CalcGlideSolutions().  The results are reset if the
+   * ordered task is not active.
+   */
+  void CalcGlideSolutions(const AircraftState &state,
+                          const GlidePolar *polars, unsigned n,
+                          GlideResult *results) const;
+
   /**
    * Update glide polar used by task system
    *
@@ -25,13 +25,17 @@
 #include "AlternateList.hpp"
 #include "Navigation/Aircraft.hpp"
 #include "Task/Visitors/TaskPointVisitor.hpp"
-#include "Task/Solvers/TaskSolution.hpp"
+#include "GlideSolvers/MacCready.hpp"
+#include "GlideSolvers/GlideState.hpp"
+#include "Geo/GeoVector.hpp"
 #include "GlideSolvers/GlidePolar.hpp"
 #include "Waypoint/Waypoints.hpp"
 #include "Waypoint/WaypointVisitor.hpp"
 #include "Util/ReservablePriorityQueue.hpp"
 #include "Util/Clamp.hpp"
 
+#include <algorithm>
+
 /** min search range in m */
 static constexpr double min_search_range = 50000;
 
@@ -136,6 +140,23 @@ IsReachable(const GlideResult &result, bool final_glide)
     : result.IsAchievable();
 }
 
+/**
+ * Solve the glide to the specified candidate, like
+ * TaskSolution::GlideSolutionRemaining() would do for an
+ * #UnorderedTaskPoint, but without constructing one.
+ */
+gcc_pure
+static GlideResult
+SolveCandidate(const Waypoint &waypoint, const AircraftState &state,
+               const TaskBehaviour &task_behaviour, const GlidePolar &polar)
+{
+  const GlideState gs(GeoVector(state.location, waypoint.location),
+                      std::max(0., waypoint.elevation +
+                               task_behaviour.safety_height_arrival),
+                      state.altitude, state.wind);
+  return MacCready::Solve(task_behaviour.glide, polar, gs);
+}
+
 bool
 AbortTask::FillReachable(const AircraftState &state,
                          AlternateList &approx_waypoints,
@@ -145,48 +166,49 @@ AbortTask::FillReachable(const AircraftState &state,
   if (IsTaskFull() || approx_waypoints.empty())
     return false;
 
-  const AGeoPoint p_start(state.location, state.altitude);
-
   bool found_final_glide = false;
   reservable_priority_queue<AlternatePoint, AlternateList, AbortRank> q;
   q.reserve(32);
 
-  for (auto v = approx_waypoints.begin(); v != approx_waypoints.end();) {
-    if (only_airfield && !v->waypoint->IsAirport()) {
-      ++v;
-      continue;
-    }
-
-    auto wp = v->waypoint;
-    UnorderedTaskPoint t(std::move(wp), task_behaviour);
-    GlideResult result =
-        TaskSolution::GlideSolutionRemaining(t, state,
-                                             task_behaviour.glide, polar);
-
-    if (IsReachable(result, final_glide)) {
-      bool intersects = false;
-      const bool is_reachable_final = IsReachable(result, true);
-
-      if (intersection_test && final_glide && is_reachable_final)
-        intersects = intersection_test->Intersects(
-            AGeoPoint(v->waypoint->location, result.min_arrival_altitude));
-
-      if (!intersects) {
-        wp = v->waypoint;
-        q.push(AlternatePoint(std::move(wp), result));
-        // remove it since it's already in the list now      
-        v = approx_waypoints.erase(v);
-
-        if (is_reachable_final)
-          found_final_glide = true;
-
-        continue; // skip incrementing v since we just erased it
+  /* candidates which are taken are moved to the queue, the others are
+     compacted to the front of the list, which is cheaper than
+     erasing from the middle of the vector */
+  auto kept = approx_waypoints.begin();
+  for (auto &v : approx_waypoints) {
+    if (!only_airfield || v.waypoint->IsAirport()) {
+      /* this method is called several times with the same state and
+         polar, so each candidate needs to be solved only once */
+      if (!v.solution.IsDefined())
+        v.solution = SolveCandidate(*v.waypoint, state,
+                                    task_behaviour, polar);
+
+      const GlideResult &result = v.solution;
+      if (IsReachable(result, final_glide)) {
+        bool intersects = false;
+        const bool is_reachable_final = IsReachable(result, true);
+
+        if (intersection_test && final_glide && is_reachable_final)
+          intersects = intersection_test->Intersects(
+              AGeoPoint(v.waypoint->location, result.min_arrival_altitude));
+
+        if (!intersects) {
+          q.push(std::move(v));
+
+          if (is_reachable_final)
+            found_final_glide = true;
+
+          continue;
+        }
       }
-    } 
+    }
 
-    ++v;
+    if (&*kept != &v)
+      *kept = std::move(v);
+    ++kept;
   }
 
+  approx_waypoints.erase(kept, approx_waypoints.end());
+
   while (!q.empty() && !IsTaskFull()) {
     auto top = q.top();
     task_points.emplace_back(std::move(top.waypoint), task_behaviour,
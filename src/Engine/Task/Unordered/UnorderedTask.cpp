@@ -45,7 +45,7 @@ UnorderedTask::CalcBestMC(const AircraftState &aircraft,
   }
 
   TaskBestMc bmc(tp, aircraft, task_behaviour.glide, glide_polar);
-  return bmc.search(glide_polar.GetMC(), best);
+  return bmc.search(glide_polar.GetMC(), best, stats.mc_best);
 }
 
 bool
@@ -24,8 +24,10 @@
 #include <assert.h>
 
 void
-ThermalEncounterCollection::Merge(const ThermalBand& tb)
+ThermalEncounterCollection::Merge(const ThermalBand& tb, double decay)
 {
+     assert(decay > 0 && decay <= 1);
+
      if (!tb.Valid()) {
           // nothing to do
           return;
@@ -38,6 +40,10 @@ ThermalEncounterCollection::Merge(const ThermalBand& tb)
           return;
      }
 
+     // fade out older climbs
+     if (decay < 1)
+          Decay(decay);
+
      // check for floor lowering with new data
      LowerFloor(tb.GetFloor());
 
@@ -50,6 +56,14 @@ ThermalEncounterCollection::Merge(const ThermalBand& tb)
      UpdateTimes();
 }
 
+void
+ThermalEncounterCollection::Decay(const double factor)
+{
+     for (unsigned i=0; i< size(); ++i) {
+          slices[i].Decay(factor);
+     }
+}
+
 void
 ThermalEncounterCollection::LowerFloor(const double new_floor)
 {
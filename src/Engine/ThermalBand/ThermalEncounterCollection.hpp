@@ -26,8 +26,12 @@
 
 class ThermalEncounterCollection: public ThermalBand {
 public:
-     void Merge(const ThermalBand& tb);
+     // merge a climb into the collection.  The weight of all previous
+     // climbs is multiplied by decay (0 < decay <= 1) first, so that
+     // recent climbs dominate.  Cost is linear in the number of slices.
+     void Merge(const ThermalBand& tb, double decay=1);
 private:
+     void Decay(const double factor);
      void MergeUnsafe(const ThermalBand& o);
      void LowerFloor(const double new_floor);
      void UpdateTimes();
@@ -60,6 +60,13 @@ struct ThermalSlice {
      // update climb statistics other slice's time and height difference
      void Update(const ThermalSlice& o, const double dh);
 
+     // reduce the weight of this slice in later merges; climb rates are
+     // unchanged
+     void Decay(const double factor) {
+          n *= factor;
+          dt *= factor;
+     }
+
      void Reset() {
           w_n=0;
           w_t=0;
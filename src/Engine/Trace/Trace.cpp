@@ -23,13 +23,13 @@ Copyright_License {
 
 #include "Trace.hpp"
 #include "Vector.hpp"
-#include "Util/GlobalSliceAllocator.hpp"
 
 #include <algorithm>
 
 Trace::Trace(const unsigned _no_thin_time, const unsigned max_time,
              const unsigned max_size)
-  :cached_size(0),
+  :pool(max_size),
+   cached_size(0),
    max_time(max_time),
    no_thin_time(_no_thin_time),
    max_size(max_size),
@@ -128,8 +128,10 @@ Trace::EraseDelta(const unsigned target_size, const unsigned recent)
 
   const unsigned recent_time = GetRecentTime(recent);
 
+  /* the edges have the largest rank, so if everything else is too
+     recent, the loop hits the end of the list */
   auto candidate = delta_list.begin();
-  while (size() > target_size) {
+  while (size() > target_size && candidate != delta_list.end()) {
     const TraceDelta &td = *candidate;
     if (!td.IsEdge() && td.point.GetTime() < recent_time) {
       EraseInside(candidate);
@@ -152,13 +154,11 @@ Trace::EraseEarlierThan(const unsigned p_time)
     return false;
 
   do {
-    auto ci = chronological_list.begin();
-    TraceDelta &td = *ci;
-    chronological_list.erase(ci);
-
-    auto i = delta_list.find(td);
-    assert(i != delta_list.end());
-    delta_list.erase_and_dispose(i, MakeDisposer());
+    /* the node is linked in both containers, so it can be unlinked
+       from the delta tree directly, without searching it */
+    TraceDelta &td = chronological_list.front();
+    chronological_list.pop_front();
+    delta_list.erase_and_dispose(delta_list.iterator_to(td), MakeDisposer());
 
     --cached_size;
   } while (!empty() && GetFront().point.GetTime() < p_time);
@@ -181,12 +181,8 @@ Trace::EraseLaterThan(const unsigned min_time)
 
   while (!empty() && GetBack().point.GetTime() > min_time) {
     TraceDelta &td = GetBack();
-
-    chronological_list.erase(chronological_list.iterator_to(td));
-
-    auto i = delta_list.find(td);
-    assert(i != delta_list.end());
-    delta_list.erase_and_dispose(i, MakeDisposer());
+    chronological_list.pop_back();
+    delta_list.erase_and_dispose(delta_list.iterator_to(td), MakeDisposer());
 
     --cached_size;
   }
@@ -208,7 +204,9 @@ Trace::EraseStart(TraceDelta &td)
   td.elim_distance = null_delta;
   td.elim_time = null_time;
 
-  delta_list.insert(td);
+  /* edges have the largest possible rank, so they usually belong at
+     the end of the tree */
+  delta_list.insert(delta_list.end(), td);
 }
 
 void
@@ -244,11 +242,12 @@ Trace::push_back(const TracePoint &point)
 
   assert(size() < max_size);
 
-  TraceDelta *td = allocator.allocate(1);
-  allocator.construct(td, point);
+  TraceDelta *td = pool.Allocate(point);
   td->point.Project(task_projection);
 
-  delta_list.insert(*td);
+  /* the new point is an edge and the newest one, so it always
+     belongs at the end of the tree */
+  delta_list.insert(delta_list.end(), *td);
   chronological_list.push_back(*td);
 
   ++cached_size;
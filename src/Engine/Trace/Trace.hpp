@@ -26,7 +26,6 @@ Copyright_License {
 
 #include "Point.hpp"
 #include "Util/NonCopyable.hpp"
-#include "Util/SliceAllocator.hpp"
 #include "Util/Serial.hpp"
 #include "Geo/Flat/TaskProjection.hpp"
 #include "Compiler.h"
@@ -35,6 +34,9 @@ Copyright_License {
 #include <boost/intrusive/set.hpp>
 
 #include <algorithm>
+#include <memory>
+#include <new>
+#include <type_traits>
 
 #include <assert.h>
 #include <stdlib.h>
@@ -54,8 +56,14 @@ class TracePointerVector;
  */
 class Trace : private NonCopyable
 {
+  /**
+   * The set hook is size-optimised (the red-black colour is packed
+   * into the parent pointer); this saves 8 bytes on each of the
+   * max_size nodes.
+   */
   struct TraceDelta
-    : boost::intrusive::set_base_hook<boost::intrusive::link_mode<boost::intrusive::normal_link>>,
+    : boost::intrusive::set_base_hook<boost::intrusive::link_mode<boost::intrusive::normal_link>,
+                                      boost::intrusive::optimize_size<true>>,
       boost::intrusive::list_base_hook<boost::intrusive::link_mode<boost::intrusive::normal_link>> {
 
     /**
@@ -168,6 +176,78 @@ class Trace : private NonCopyable
     }
   };
 
+  /**
+   * A fixed-size pool of #TraceDelta objects.  The number of points
+   * is limited by #max_size, so the memory for all of them is
+   * allocated at once, in one contiguous array.  This avoids heap
+   * allocations while recording, and keeps the nodes walked by the
+   * thinning code close together.
+   */
+  class DeltaPool {
+    typedef std::aligned_storage<sizeof(TraceDelta),
+                                 alignof(TraceDelta)>::type Slot;
+
+    const std::unique_ptr<Slot[]> slots;
+
+    /**
+     * The number of slots which have ever been used.  All slots
+     * beyond this index are free, and are not on the #available
+     * list.
+     */
+    unsigned n_used;
+
+    /**
+     * A list of freed slots, linked through their first bytes.
+     */
+    Slot *available;
+
+#ifndef NDEBUG
+    const unsigned capacity;
+    unsigned n_allocated;
+#endif
+
+  public:
+    explicit DeltaPool(unsigned _capacity)
+      :slots(new Slot[_capacity]), n_used(0), available(nullptr)
+#ifndef NDEBUG
+      , capacity(_capacity), n_allocated(0)
+#endif
+    {}
+
+    ~DeltaPool() {
+      assert(n_allocated == 0);
+    }
+
+    TraceDelta *Allocate(const TracePoint &point) {
+      Slot *slot;
+      if (available != nullptr) {
+        slot = available;
+        available = *reinterpret_cast<Slot **>(slot);
+      } else {
+        assert(n_used < capacity);
+        slot = &slots[n_used++];
+      }
+
+#ifndef NDEBUG
+      ++n_allocated;
+#endif
+      return new(slot) TraceDelta(point);
+    }
+
+    void Free(TraceDelta *td) {
+      assert(n_allocated > 0);
+#ifndef NDEBUG
+      --n_allocated;
+#endif
+
+      td->~TraceDelta();
+
+      Slot *slot = reinterpret_cast<Slot *>(td);
+      *reinterpret_cast<Slot **>(slot) = available;
+      available = slot;
+    }
+  };
+
   /* using multiset, not because we need multiple values (we don't),
      but to avoid set's overhead for duplicate elimination */
   typedef boost::intrusive::multiset<TraceDelta,
@@ -177,7 +257,7 @@ class Trace : private NonCopyable
   typedef boost::intrusive::list<TraceDelta,
                                  boost::intrusive::constant_time_size<false>> ChronologicalList;
 
-  SliceAllocator<TraceDelta, 128u> allocator;
+  DeltaPool pool;
 
   DeltaList delta_list;
   ChronologicalList chronological_list;
@@ -195,23 +275,16 @@ class Trace : private NonCopyable
 
   Serial append_serial, modify_serial;
 
-  template<typename Alloc>
   struct Disposer {
-    Alloc &alloc;
+    DeltaPool &pool;
 
-    void operator()(typename Alloc::pointer td) {
-      alloc.destroy(td);
-      alloc.deallocate(td, 1);
+    void operator()(TraceDelta *td) {
+      pool.Free(td);
     }
   };
 
-  template<typename Alloc>
-  static Disposer<Alloc> MakeDisposer(Alloc &alloc) {
-    return {alloc};
-  }
-
-  Disposer<decltype(allocator)> MakeDisposer() {
-    return MakeDisposer(allocator);
+  Disposer MakeDisposer() {
+    return {pool};
   }
 
 public:
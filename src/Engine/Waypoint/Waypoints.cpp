@@ -23,6 +23,10 @@
 #include "Waypoints.hpp"
 #include "WaypointVisitor.hpp"
 #include "Util/StringUtil.hpp"
+#include "Util/StringAPI.hxx"
+#include "Util/StringCompare.hxx"
+
+#include <algorithm>
 
 // global, used for test harness
 unsigned n_queries = 0;
@@ -72,48 +76,173 @@ struct VisitorAdapter {
   }
 };
 
+/**
+ * Returns the normalised form of the given waypoint name.
+ */
+gcc_pure
+static tstring
+NormalizeName(const TCHAR *name)
+{
+  TCHAR normalized[StringLength(name) + 1];
+  NormalizeSearchString(normalized, name);
+  return normalized;
+}
+
+Waypoints::WaypointNameIndex::ItemVector::const_iterator
+Waypoints::WaypointNameIndex::LowerBound(const tstring &name) const
+{
+  return std::lower_bound(sorted.begin(), sorted.end(), name,
+                          [](const Item &item, const tstring &n){
+                            return item.name < n;
+                          });
+}
+
 WaypointPtr
-Waypoints::WaypointNameTree::Get(const TCHAR *name) const
+Waypoints::WaypointNameIndex::Get(const TCHAR *name) const
 {
-  TCHAR normalized_name[_tcslen(name) + 1];
-  NormalizeSearchString(normalized_name, name);
-  return RadixTree<WaypointPtr>::Get(normalized_name, nullptr);
+  const tstring normalized = NormalizeName(name);
+
+  /* the most recently added waypoint wins */
+  for (auto i = pending.rbegin(); i != pending.rend(); ++i)
+    if (i->name == normalized)
+      return i->waypoint;
+
+  const auto i = LowerBound(normalized);
+  return i != sorted.end() && i->name == normalized
+    ? i->waypoint
+    : nullptr;
 }
 
 void
-Waypoints::WaypointNameTree::VisitNormalisedPrefix(const TCHAR *prefix,
-                                                   WaypointVisitor &visitor) const
+Waypoints::WaypointNameIndex::VisitNormalisedPrefix(const TCHAR *prefix,
+                                                    WaypointVisitor &visitor) const
+{
+  const tstring normalized = NormalizeName(prefix);
+
+  for (auto i = LowerBound(normalized);
+       i != sorted.end() && StringStartsWith(i->name.c_str(),
+                                             normalized.c_str());
+       ++i)
+    visitor.Visit(i->waypoint);
+
+  for (const auto &i : pending)
+    if (StringStartsWith(i.name.c_str(), normalized.c_str()))
+      visitor.Visit(i.waypoint);
+}
+
+/**
+ * Add the character following the prefix in the given name to the
+ * sorted list of characters in the buffer.
+ */
+static void
+AddSuggestion(const tstring &name, size_t prefix_length,
+              TCHAR *dest, TCHAR *&end, const TCHAR *limit)
 {
-  TCHAR normalized[_tcslen(prefix) + 1];
-  NormalizeSearchString(normalized, prefix);
-  VisitorAdapter adapter(visitor);
-  VisitPrefix(normalized, adapter);
+  if (name.length() <= prefix_length)
+    /* exact match, no following character */
+    return;
+
+  const TCHAR ch = name[prefix_length];
+  TCHAR *p = std::lower_bound(dest, end, ch);
+  if (p != end && *p == ch)
+    /* already there */
+    return;
+
+  if (end == limit)
+    return;
+
+  std::copy_backward(p, end, end + 1);
+  *p = ch;
+  ++end;
 }
 
 TCHAR *
-Waypoints::WaypointNameTree::SuggestNormalisedPrefix(const TCHAR *prefix,
-                                                     TCHAR *dest,
-                                                     size_t max_length) const
+Waypoints::WaypointNameIndex::SuggestNormalisedPrefix(const TCHAR *prefix,
+                                                      TCHAR *dest,
+                                                      size_t max_length) const
 {
-  TCHAR normalized[_tcslen(prefix) + 1];
-  NormalizeSearchString(normalized, prefix);
-  return Suggest(normalized, dest, max_length);
+  assert(max_length > 0);
+
+  const tstring normalized = NormalizeName(prefix);
+  const size_t length = normalized.length();
+
+  TCHAR *end = dest;
+  const TCHAR *const limit = dest + max_length - 1;
+  bool found = false;
+
+  for (auto i = LowerBound(normalized);
+       i != sorted.end() && StringStartsWith(i->name.c_str(),
+                                             normalized.c_str());
+       ++i) {
+    found = true;
+    AddSuggestion(i->name, length, dest, end, limit);
+  }
+
+  for (const auto &i : pending) {
+    if (StringStartsWith(i.name.c_str(), normalized.c_str())) {
+      found = true;
+      AddSuggestion(i.name, length, dest, end, limit);
+    }
+  }
+
+  if (!found)
+    return nullptr;
+
+  *end = _T('\0');
+  return dest;
 }
 
 void
-Waypoints::WaypointNameTree::Add(WaypointPtr wp)
+Waypoints::WaypointNameIndex::Add(WaypointPtr wp)
 {
-  TCHAR normalized_name[wp->name.length() + 1];
-  NormalizeSearchString(normalized_name, wp->name.c_str());
-  RadixTree<WaypointPtr>::Add(normalized_name, std::move(wp));
+  pending.push_back({NormalizeName(wp->name.c_str()), std::move(wp)});
 }
 
 void
-Waypoints::WaypointNameTree::Remove(const WaypointPtr &wp)
+Waypoints::WaypointNameIndex::Remove(const WaypointPtr &wp)
 {
-  TCHAR normalized_name[wp->name.length() + 1];
-  NormalizeSearchString(normalized_name, wp->name.c_str());
-  RadixTree<WaypointPtr>::Remove(normalized_name, wp);
+  for (auto i = pending.begin(); i != pending.end(); ++i) {
+    if (i->waypoint == wp) {
+      pending.erase(i);
+      return;
+    }
+  }
+
+  const tstring normalized = NormalizeName(wp->name.c_str());
+  for (auto i = LowerBound(normalized);
+       i != sorted.end() && i->name == normalized; ++i) {
+    if (i->waypoint == wp) {
+      sorted.erase(i);
+      return;
+    }
+  }
+}
+
+void
+Waypoints::WaypointNameIndex::Optimise()
+{
+  if (pending.empty())
+    return;
+
+  /* newest first among equal names, see #sorted */
+  std::reverse(pending.begin(), pending.end());
+  std::stable_sort(pending.begin(), pending.end());
+
+  if (sorted.empty()) {
+    sorted.swap(pending);
+    return;
+  }
+
+  ItemVector merged;
+  merged.reserve(sorted.size() + pending.size());
+  std::merge(std::make_move_iterator(pending.begin()),
+             std::make_move_iterator(pending.end()),
+             std::make_move_iterator(sorted.begin()),
+             std::make_move_iterator(sorted.end()),
+             std::back_inserter(merged));
+
+  sorted.swap(merged);
+  pending.clear();
 }
 
 Waypoints::Waypoints()
@@ -125,6 +254,8 @@ Waypoints::Waypoints()
 void
 Waypoints::Optimise()
 {
+  name_index.Optimise();
+
   if (waypoint_tree.IsEmpty() || waypoint_tree.HaveBounds())
     /* empty or already optimised */
     return;
@@ -159,7 +290,7 @@ Waypoints::Append(WaypointPtr wp)
   w.id = next_id++;
 
   waypoint_tree.Add(wp);
-  name_tree.Add(wp);
+  name_index.Add(wp);
 
   ++serial;
 }
@@ -217,7 +348,7 @@ Waypoints::GetNearestIf(const GeoPoint &loc, double range,
 WaypointPtr
 Waypoints::LookupName(const TCHAR *name) const
 {
-  return name_tree.Get(name);
+  return name_index.Get(name);
 }
 
 WaypointPtr
@@ -290,7 +421,7 @@ void
 Waypoints::VisitNamePrefix(const TCHAR *prefix,
                            WaypointVisitor& visitor) const
 {
-  name_tree.VisitNormalisedPrefix(prefix, visitor);
+  name_index.VisitNormalisedPrefix(prefix, visitor);
 }
 
 void
@@ -298,7 +429,7 @@ Waypoints::Clear()
 {
   ++serial;
   home = nullptr;
-  name_tree.Clear();
+  name_index.Clear();
   waypoint_tree.clear();
   next_id = 1;
 }
@@ -315,7 +446,7 @@ Waypoints::Erase(WaypointPtr &&wp)
                                        });
   assert(f.first != waypoint_tree.end());
 
-  name_tree.Remove(std::move(wp));
+  name_index.Remove(std::move(wp));
   waypoint_tree.erase(f.first);
   ++serial;
 }
@@ -329,7 +460,7 @@ Waypoints::EraseUserMarkers()
         if (home == wp)
           home = nullptr;
 
-        name_tree.Remove(wp);
+        name_index.Remove(wp);
         ++serial;
         return true;
       } else
@@ -342,7 +473,7 @@ Waypoints::Replace(const WaypointPtr &orig, Waypoint &&replacement)
 {
   assert(!waypoint_tree.IsEmpty());
 
-  name_tree.Remove(orig);
+  name_index.Remove(orig);
 
   replacement.id = orig->id;
 
@@ -356,7 +487,7 @@ Waypoints::Replace(const WaypointPtr &orig, Waypoint &&replacement)
   }
 
   WaypointPtr new_ptr(new Waypoint(std::move(replacement)));
-  name_tree.Add(new_ptr);
+  name_index.Add(new_ptr);
 
   auto f = waypoint_tree.FindNearestIf(waypoint_tree.GetPosition(orig), 0,
                                        [&orig](const WaypointPtr &ptr){
@@ -22,13 +22,17 @@
 #ifndef WAYPOINTS_HPP
 #define WAYPOINTS_HPP
 
-#include "Util/RadixTree.hpp"
 #include "Util/QuadTree.hpp"
+#include "Util/SliceAllocator.hpp"
+#include "Util/StaticString.hxx"
+#include "Util/StringCompare.hxx"
 #include "Util/Serial.hpp"
 #include "Ptr.hpp"
 #include "Waypoint.hpp"
 #include "Geo/Flat/TaskProjection.hpp"
 
+#include <vector>
+
 class WaypointVisitor;
 
 /**
@@ -53,11 +57,43 @@ class Waypoints {
   };
 
   /**
-   * Type of KD-tree data structure for waypoint container
+   * Type of KD-tree data structure for waypoint container.  Its nodes
+   * are allocated from contiguous slices, which keeps bulk loading
+   * and clearing cheap.
+   */
+  typedef QuadTree<WaypointPtr, WaypointAccessor,
+                   SliceAllocator<WaypointPtr, 1024u>> WaypointTree;
+
+  /**
+   * An index of all waypoints sorted by their normalised name.  New
+   * waypoints are collected in an unsorted list, which gets merged
+   * into the sorted array in one pass by Optimise().
    */
-  typedef QuadTree<WaypointPtr, WaypointAccessor> WaypointTree;
+  class WaypointNameIndex {
+    struct Item {
+      tstring name;
+      WaypointPtr waypoint;
+
+      gcc_pure
+      bool operator<(const Item &other) const {
+        return name < other.name;
+      }
+    };
+
+    typedef std::vector<Item> ItemVector;
+
+    /**
+     * All items sorted by name; among items with the same name, the
+     * most recently added comes first.
+     */
+    ItemVector sorted;
+
+    /**
+     * Items which were added after the last Optimise() call, in the
+     * order they were added.
+     */
+    ItemVector pending;
 
-  class WaypointNameTree : public RadixTree<WaypointPtr> {
   public:
     WaypointPtr Get(const TCHAR *name) const;
     void VisitNormalisedPrefix(const TCHAR *prefix, WaypointVisitor &visitor) const;
@@ -65,6 +101,20 @@ class Waypoints {
                                    TCHAR *dest, size_t max_length) const;
     void Add(WaypointPtr wp);
     void Remove(const WaypointPtr &wp);
+
+    /**
+     * Merge the pending items into the sorted array.
+     */
+    void Optimise();
+
+    void Clear() {
+      sorted.clear();
+      pending.clear();
+    }
+
+  private:
+    gcc_pure
+    ItemVector::const_iterator LowerBound(const tstring &name) const;
   };
 
   /**
@@ -75,7 +125,7 @@ class Waypoints {
   unsigned next_id;
 
   WaypointTree waypoint_tree;
-  WaypointNameTree name_tree;
+  WaypointNameIndex name_index;
   TaskProjection task_projection;
 
   WaypointPtr home;
@@ -310,7 +360,7 @@ public:
   gcc_pure
   TCHAR *SuggestNamePrefix(const TCHAR *prefix,
                            TCHAR *dest, size_t max_length) const {
-    return name_tree.SuggestNormalisedPrefix(prefix, dest, max_length);
+    return name_index.SuggestNormalisedPrefix(prefix, dest, max_length);
   }
 
   /**
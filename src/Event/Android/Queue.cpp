@@ -22,6 +22,7 @@ Copyright_License {
 */
 
 #include "Queue.hpp"
+#include "../Shared/Coalesce.hpp"
 #include "OS/Clock.hpp"
 
 EventQueue::EventQueue()
@@ -35,7 +36,8 @@ EventQueue::Push(const Event &event)
   if (quit)
     return;
 
-  events.push(event);
+  if (!CoalesceEvent(events, event))
+    events.push_back(event);
   cond.signal();
 }
 
@@ -47,7 +49,7 @@ EventQueue::Pop(Event &event)
     return false;
 
   event = events.front();
-  events.pop();
+  events.pop_front();
   return true;
 }
 
@@ -88,7 +90,7 @@ EventQueue::Wait(Event &event)
   }
 
   event = events.front();
-  events.pop();
+  events.pop_front();
   return true;
 }
 
@@ -99,8 +101,8 @@ EventQueue::Purge(bool (*match)(const Event &event, void *ctx), void *ctx)
   size_t n = events.size();
   while (n-- > 0) {
     if (!match(events.front(), ctx))
-      events.push(events.front());
-    events.pop();
+      events.push_back(events.front());
+    events.pop_front();
   }
 }
 
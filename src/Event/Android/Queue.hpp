@@ -29,12 +29,12 @@ Copyright_License {
 #include "Thread/Mutex.hpp"
 #include "Thread/Cond.hxx"
 
-#include <queue>
+#include <deque>
 
 class Window;
 
 class EventQueue {
-  std::queue<Event> events;
+  std::deque<Event> events;
 
   /**
    * The current time after the event thread returned from sleeping.
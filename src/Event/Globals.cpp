@@ -24,3 +24,5 @@ Copyright_License {
 #include "Globals.hpp"
 
 EventQueue *event_queue;
+
+std::atomic<unsigned> n_coalesced_events;
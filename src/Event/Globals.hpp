@@ -24,8 +24,17 @@ Copyright_License {
 #ifndef XCSOAR_EVENT_GLOBALS_HPP
 #define XCSOAR_EVENT_GLOBALS_HPP
 
+#include <atomic>
+
 class EventQueue;
 
 extern EventQueue *event_queue;
 
+/**
+ * The number of notifications and events which were merged into an
+ * already pending one instead of being delivered separately.  This
+ * is for diagnostics only.
+ */
+extern std::atomic<unsigned> n_coalesced_events;
+
 #endif
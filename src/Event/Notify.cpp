@@ -36,8 +36,11 @@ Notify::Notify()
 void
 Notify::SendNotification()
 {
-  if (pending.exchange(true, std::memory_order_relaxed))
+  if (pending.exchange(true, std::memory_order_relaxed)) {
+    /* the main thread has not yet handled the previous one */
+    ++n_coalesced_events;
     return;
+  }
 
 #if defined(ANDROID) || defined(USE_POLL_EVENT) || defined(ENABLE_SDL)
   event_queue->Push(Callback, this);
@@ -22,8 +22,10 @@ Copyright_License {
 */
 
 #include "Queue.hpp"
+#include "../Shared/Coalesce.hpp"
 #include "DisplayOrientation.hpp"
 #include "OS/Clock.hpp"
+#include "Util/AllocationStats.hpp"
 
 EventQueue::EventQueue()
   :SignalListener(io_service),
@@ -34,7 +36,11 @@ EventQueue::EventQueue()
    event_pipe_asio(io_service),
    quit(false)
 {
+#ifdef ALLOC_STATS
+  SignalListener::Create(SIGINT, SIGTERM, SIGUSR1);
+#else
   SignalListener::Create(SIGINT, SIGTERM);
+#endif
 
   event_pipe.Create();
   event_pipe_asio.assign(event_pipe.GetReadFD().Get());
@@ -49,7 +55,8 @@ void
 EventQueue::Push(const Event &event)
 {
   ScopeLock protect(mutex);
-  events.push(event);
+  if (!CoalesceEvent(events, event))
+    events.push_back(event);
   WakeUp();
 }
 
@@ -94,7 +101,7 @@ EventQueue::Pop(Event &event)
   }
 
   event = events.front();
-  events.pop();
+  events.pop_front();
 
   return true;
 }
@@ -126,7 +133,7 @@ EventQueue::Wait(Event &event)
   }
 
   event = events.front();
-  events.pop();
+  events.pop_front();
 
   return true;
 }
@@ -138,8 +145,8 @@ EventQueue::Purge(bool (*match)(const Event &event, void *ctx), void *ctx)
   size_t n = events.size();
   while (n-- > 0) {
     if (!match(events.front(), ctx))
-      events.push(events.front());
-    events.pop();
+      events.push_back(events.front());
+    events.pop_front();
   }
 }
 
@@ -186,6 +193,13 @@ EventQueue::Purge(Window &window)
 void
 EventQueue::OnSignal(int signo)
 {
+#ifdef ALLOC_STATS
+  if (signo == SIGUSR1) {
+    PrintAllocationStats(stderr);
+    return;
+  }
+#endif
+
   Quit();
 }
 
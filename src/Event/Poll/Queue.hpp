@@ -42,7 +42,7 @@ Copyright_License {
 
 #include <stdint.h>
 
-#include <queue>
+#include <deque>
 
 enum class DisplayOrientation : uint8_t;
 class Window;
@@ -74,7 +74,7 @@ class EventQueue final : public IOServiceOwner, private SignalListener {
 
   Mutex mutex;
 
-  std::queue<Event> events;
+  std::deque<Event> events;
 
   EventPipe event_pipe;
   boost::asio::posix::stream_descriptor event_pipe_asio;
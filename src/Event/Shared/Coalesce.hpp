@@ -0,0 +1,76 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#ifndef XCSOAR_EVENT_SHARED_COALESCE_HPP
+#define XCSOAR_EVENT_SHARED_COALESCE_HPP
+
+#include "Event.hpp"
+#include "../Globals.hpp"
+
+/**
+ * Attempt to merge a new event into the ones already queued, instead
+ * of appending it.  This is done for events which only say "the
+ * state has changed, look again":
+ *
+ * - a #Event::USER event for a #Window which already has one with
+ *   the same parameter pending is dropped
+ *
+ * - a #Event::MOUSE_MOTION event directly following another one
+ *   replaces that one's position (motion events separated by a
+ *   button event are not merged, to preserve the gesture)
+ *
+ * Caller must lock the queue's mutex.
+ *
+ * @return true if the event has been merged and must not be queued
+ */
+template<typename Container>
+static inline bool
+CoalesceEvent(Container &events, const Event &event)
+{
+  switch (event.type) {
+  case Event::USER:
+    for (const auto &i : events) {
+      if (i.type == Event::USER && i.ptr == event.ptr &&
+          i.param == event.param) {
+        ++n_coalesced_events;
+        return true;
+      }
+    }
+
+    return false;
+
+  case Event::MOUSE_MOTION:
+    if (!events.empty() && events.back().type == Event::MOUSE_MOTION) {
+      events.back().point = event.point;
+      ++n_coalesced_events;
+      return true;
+    }
+
+    return false;
+
+  default:
+    return false;
+  }
+}
+
+#endif
@@ -75,6 +75,12 @@ struct Event {
      * can be created again.
      */
     RESUME,
+
+    /**
+     * The system is running low on memory, and caches should be
+     * flushed.
+     */
+    LOW_MEMORY,
 #endif
 
 #ifdef USE_X11
@@ -22,47 +22,193 @@ Copyright_License {
 */
 
 #include "TimerQueue.hpp"
+#include "../Timer.hpp"
+#include "OS/Clock.hpp"
+
+#include <algorithm>
+
+#include <assert.h>
+
+TimerQueue::TimerQueue()
+  :current_tick(MonotonicClockUS() / TICK_US) {}
+
+uint64_t
+TimerQueue::GetEarliestUS() const
+{
+  assert(size > 0);
+
+  if (!ready.empty())
+    return ready.front().due_us;
+
+  uint64_t earliest = UINT64_MAX;
+
+  /* all timers in one level 0 slot are due at the same tick */
+  const unsigned index0 = current_tick & SLOT_MASK;
+  for (unsigned i = 0; i < SLOTS; ++i) {
+    const List &list = wheel[0][(index0 + i) & SLOT_MASK];
+    if (!list.empty()) {
+      earliest = list.front().due_us;
+      break;
+    }
+  }
+
+  /* on the higher levels, only the first non-empty slot after the
+     current position can contain the earliest timer of that level;
+     the slot at the current position belongs to the next
+     revolution */
+  for (unsigned level = 1; level < LEVELS; ++level) {
+    const unsigned index = (current_tick >> (LEVEL_BITS * level)) & SLOT_MASK;
+    for (unsigned i = 1; i <= SLOTS; ++i) {
+      const List &list = wheel[level][(index + i) & SLOT_MASK];
+      if (!list.empty()) {
+        for (const auto &entry : list)
+          earliest = std::min(earliest, entry.due_us);
+        break;
+      }
+    }
+  }
+
+  for (const auto &entry : overflow)
+    earliest = std::min(earliest, entry.due_us);
+
+  return earliest;
+}
 
 int64_t
 TimerQueue::GetTimeoutUS(uint64_t now_us) const
 {
-  auto i = timers.begin();
-  if (i != timers.end()) {
-    int64_t relative = i->due_us - now_us;
-    if (relative <= 0)
-      return 0;
+  if (size == 0)
+    return -1;
 
-    return relative;
+  int64_t relative = GetEarliestUS() - now_us;
+  if (relative <= 0)
+    return 0;
+
+  return relative;
+}
+
+void
+TimerQueue::Insert(TimerQueueEntry &entry)
+{
+  const uint64_t tick = entry.due_us / TICK_US;
+  assert(tick >= current_tick);
+
+  const uint64_t delta = tick - current_tick;
+
+  for (unsigned level = 0; level < LEVELS; ++level) {
+    if (delta < uint64_t(1) << (LEVEL_BITS * (level + 1))) {
+      const unsigned index = (tick >> (LEVEL_BITS * level)) & SLOT_MASK;
+      wheel[level][index].push_back(entry);
+      if (level == 0)
+        level0_mask |= uint64_t(1) << index;
+      return;
+    }
   }
 
-  return -1;
+  overflow.push_back(entry);
+}
+
+void
+TimerQueue::Cascade(List &list)
+{
+  List tmp;
+  tmp.swap(list);
+
+  while (!tmp.empty()) {
+    TimerQueueEntry &entry = tmp.front();
+    tmp.pop_front();
+    Insert(entry);
+  }
+}
+
+void
+TimerQueue::Advance(uint64_t now_tick)
+{
+  while (current_tick <= now_tick) {
+    const unsigned index = current_tick & SLOT_MASK;
+
+    if (index == 0) {
+      /* level 0 has completed a revolution: move the timers of the
+         next level's slot down, and so on for each level which also
+         completes a revolution now */
+      for (unsigned level = 1; level < LEVELS; ++level) {
+        const unsigned i = (current_tick >> (LEVEL_BITS * level)) & SLOT_MASK;
+        Cascade(wheel[level][i]);
+        if (i != 0)
+          break;
+
+        if (level == LEVELS - 1)
+          Cascade(overflow);
+      }
+    }
+
+    const uint64_t bit = uint64_t(1) << index;
+    if (level0_mask & bit) {
+      ready.splice(ready.end(), wheel[0][index]);
+      level0_mask &= ~bit;
+    }
+
+    /* skip empty slots, but stop at the end of this revolution to
+       cascade */
+    const uint64_t later = (level0_mask >> index) >> 1;
+    const unsigned step = later != 0
+      ? unsigned(__builtin_ctzll(later)) + 1
+      : SLOTS - index;
+
+    current_tick = std::min(current_tick + step, now_tick + 1);
+  }
 }
 
 Timer *
 TimerQueue::Pop(uint64_t now_us)
 {
-  auto t = timers.begin();
-  if (t != timers.end() && t->IsDue(now_us)) {
-    Timer *timer = t->timer;
-    timers.erase(t);
-    return timer;
-  } else
+  if (size == 0)
     return nullptr;
+
+  Advance(now_us / TICK_US);
+
+  if (ready.empty())
+    return nullptr;
+
+  TimerQueueEntry &entry = ready.front();
+  ready.pop_front();
+  --size;
+  return static_cast<Timer *>(&entry);
 }
 
 void
 TimerQueue::Add(Timer &timer, uint64_t due_us)
 {
-  timers.insert(TimerRecord(timer, due_us));
+  TimerQueueEntry &entry = timer;
+  assert(!entry.is_linked());
+
+  if (size == 0)
+    /* the wheel was idle and Advance() has not been called for a
+       while; catch up without walking through all the empty
+       ticks */
+    current_tick = std::max(current_tick, MonotonicClockUS() / TICK_US);
+
+  uint64_t tick = std::max((due_us + TICK_US - 1) / TICK_US, current_tick);
+
+  /* coalesce: round up to a power of two ticks not larger than 1/16
+     of the delay */
+  const uint64_t delay = tick - current_tick;
+  uint64_t granularity = 1;
+  while (granularity * 32 <= delay)
+    granularity *= 2;
+  tick = (tick + granularity - 1) & ~(granularity - 1);
+
+  entry.due_us = tick * TICK_US;
+  Insert(entry);
+  ++size;
 }
 
 void
 TimerQueue::Cancel(Timer &timer)
 {
-  for (auto i = timers.begin(), end = timers.end(); i != end; ++i) {
-    if (i->timer == &timer) {
-      timers.erase(i);
-      return;
-    }
+  TimerQueueEntry &entry = timer;
+  if (entry.is_linked()) {
+    entry.unlink();
+    --size;
   }
 }
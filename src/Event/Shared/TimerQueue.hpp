@@ -26,41 +26,81 @@ Copyright_License {
 
 #include "Compiler.h"
 
-#include <set>
+#include <boost/intrusive/list.hpp>
 
 #include <stdint.h>
 
 class Timer;
 
+/**
+ * The part of a #Timer which is managed by #TimerQueue.  Embedding
+ * it in the #Timer means that scheduling never allocates memory, and
+ * cancelling is a constant-time unlink.
+ */
+class TimerQueueEntry
+  : public boost::intrusive::list_base_hook<boost::intrusive::link_mode<boost::intrusive::auto_unlink>> {
+  friend class TimerQueue;
+
+  /**
+   * Projected MonotonicClockUS() value when this timer is due,
+   * rounded to the #TimerQueue tick.
+   */
+  uint64_t due_us;
+};
+
+/**
+ * A hierarchical timer wheel: #LEVELS rings of #SLOTS lists each,
+ * where a slot on level n covers SLOTS^n ticks.  Timers move down one
+ * level whenever the wheel below has completed a revolution, so
+ * adding and cancelling is O(1), and expiring costs O(1) amortised
+ * per timer.
+ *
+ * Due times are rounded up by up to 1/16 of the delay, to a power of
+ * two ticks, so timers scheduled at about the same time expire
+ * together and the event thread wakes up less often.
+ */
 class TimerQueue {
-  struct TimerRecord {
-    /**
-     * Projected MonotonicClockUS() value when this timer is due.
-     */
-    uint64_t due_us;
+  typedef boost::intrusive::list<TimerQueueEntry,
+                                 boost::intrusive::constant_time_size<false>> List;
 
-    Timer *timer;
+  static constexpr unsigned TICK_US = 1000;
 
-    constexpr TimerRecord(Timer &_timer, uint64_t _due_us)
-      :due_us(_due_us), timer(&_timer) {}
+  static constexpr unsigned LEVEL_BITS = 6;
+  static constexpr unsigned SLOTS = 1u << LEVEL_BITS;
+  static constexpr unsigned SLOT_MASK = SLOTS - 1;
+  static constexpr unsigned LEVELS = 4;
 
-    TimerRecord(TimerRecord &&other) = default;
-    TimerRecord(const TimerRecord &other) = delete;
-    TimerRecord &operator=(const TimerRecord &other) = delete;
+  List wheel[LEVELS][SLOTS];
 
-    bool operator<(const TimerRecord &other) const {
-      return due_us < other.due_us;
-    }
+  /**
+   * Bit n is set if wheel[0][n] may be non-empty.  Cancelled timers
+   * may leave stale bits, which are cleared lazily.
+   */
+  uint64_t level0_mask = 0;
 
-    bool IsDue(uint64_t now_us) const {
-      return now_us >= due_us;
-    }
-  };
+  /**
+   * Timers which are due more than SLOTS^LEVELS ticks (about 4.6
+   * hours) in the future.
+   */
+  List overflow;
 
-  std::multiset<TimerRecord> timers;
+  /**
+   * Expired timers waiting to be returned by Pop().
+   */
+  List ready;
+
+  /**
+   * The next tick which has not yet been moved to #ready.
+   */
+  uint64_t current_tick;
+
+  /**
+   * The number of queued timers, including #ready.
+   */
+  unsigned size = 0;
 
 public:
-  TimerQueue() = default;
+  TimerQueue();
   TimerQueue(const TimerQueue &other) = delete;
   TimerQueue &operator=(const TimerQueue &other) = delete;
 
@@ -70,8 +110,9 @@ public:
    * specified time stamp will require adjusting the poll timeout,
    * i.e. the event thread must be woken up.
    */
+  gcc_pure
   bool IsBefore(uint64_t t) const {
-    return timers.empty() || t < timers.begin()->due_us;
+    return size == 0 || t < GetEarliestUS();
   }
 
   /**
@@ -100,6 +141,28 @@ public:
    * Caller must lock a mutex.
    */
   void Cancel(Timer &timer);
+
+private:
+  /**
+   * Returns the due time of the earliest timer.  There must be at
+   * least one.
+   */
+  gcc_pure
+  uint64_t GetEarliestUS() const;
+
+  void Insert(TimerQueueEntry &entry);
+
+  /**
+   * Re-insert the entries of the given list, which move to a lower
+   * level now.
+   */
+  void Cascade(List &list);
+
+  /**
+   * Move all timers due up to and including the given tick to
+   * #ready.
+   */
+  void Advance(uint64_t now_tick);
 };
 
 #endif
@@ -26,6 +26,8 @@ Copyright_License {
 
 #ifdef USE_POLL_EVENT
 #include <boost/asio/steady_timer.hpp>
+#else
+#include "Shared/TimerQueue.hpp"
 #endif
 
 #include <atomic>
@@ -44,7 +46,15 @@ Copyright_License {
  * The class #WindowTimer is cheaper on WIN32; use it instead of this
  * class if you are implementing a #Window.
  */
-class Timer {
+class Timer
+#ifndef USE_POLL_EVENT
+  : TimerQueueEntry
+#endif
+{
+#ifndef USE_POLL_EVENT
+  friend class TimerQueue;
+#endif
+
   std::atomic<bool> enabled, queued;
   unsigned ms;
 
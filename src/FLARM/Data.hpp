@@ -41,6 +41,9 @@ struct FlarmData {
 
   FlarmStatus status;
 
+  /**
+   * This must remain the last attribute, see NMEAInfo::CopyFrom().
+   */
   TrafficList traffic;
 
   bool IsDetected() const {
@@ -26,6 +26,24 @@ Copyright_License {
 #include "NMEA/Info.hpp"
 #include "Geo/GeoVector.hpp"
 
+/**
+ * Calculate the vector from #a to #b using the given linear
+ * conversion factors from metres to degrees.
+ */
+gcc_pure
+static GeoVector
+FlatVector(const GeoPoint &a, const GeoPoint &b,
+           double north_to_latitude, double east_to_longitude)
+{
+  const double north =
+    (b.latitude - a.latitude).Degrees() / north_to_latitude;
+  const double east =
+    (b.longitude - a.longitude).AsDelta().Degrees() / east_to_longitude;
+
+  return GeoVector(hypot(north, east),
+                   Angle::FromXY(north, east).AsBearing());
+}
+
 void
 FlarmComputer::Process(FlarmData &flarm, const FlarmData &last_flarm,
                        const NMEAInfo &basic)
@@ -127,7 +145,13 @@ FlarmComputer::Process(FlarmData &flarm, const FlarmData &last_flarm,
         traffic.location_available &&
         last_traffic->location_available) {
       // Calculate the GeoVector between now and the last contact
-      GeoVector vec = last_traffic->location.DistanceBearing(traffic.location);
+      const GeoVector vec = north_to_latitude > 0 && east_to_longitude > 0
+        /* both positions are within FLARM range of our location, so
+           the flat projection prepared above is precise enough and
+           much cheaper than the spherical formula */
+        ? FlatVector(last_traffic->location, traffic.location,
+                     north_to_latitude, east_to_longitude)
+        : last_traffic->location.DistanceBearing(traffic.location);
 
       if (!traffic.track_received)
         traffic.track = vec.bearing;
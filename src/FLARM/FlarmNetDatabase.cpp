@@ -22,7 +22,8 @@ Copyright_License {
 */
 
 #include "FlarmNetDatabase.hpp"
-#include "Util/StringUtil.hpp"
+
+#include <algorithm>
 
 #include <assert.h>
 
@@ -34,21 +35,83 @@ FlarmNetDatabase::Insert(const FlarmNetRecord &record)
     /* ignore malformed records */
     return;
 
-  map.insert(std::make_pair(id, record));
+  records.emplace_back(id, record);
+#ifndef NDEBUG
+  finished = false;
+#endif
+}
+
+void
+FlarmNetDatabase::Finish()
+{
+  /* a stable sort keeps the first one of duplicate ids in front */
+  std::stable_sort(records.begin(), records.end(),
+                   [](const Item &a, const Item &b){
+                     return a.first < b.first;
+                   });
+  records.erase(std::unique(records.begin(), records.end(),
+                            [](const Item &a, const Item &b){
+                              return a.first == b.first;
+                            }),
+                records.end());
+  records.shrink_to_fit();
+
+  by_callsign.clear();
+  by_callsign.reserve(records.size());
+  for (unsigned i = 0, n = records.size(); i < n; ++i)
+    by_callsign.push_back(i);
+
+  std::stable_sort(by_callsign.begin(), by_callsign.end(),
+                   [this](unsigned a, unsigned b){
+                     return _tcscmp(records[a].second.callsign,
+                                    records[b].second.callsign) < 0;
+                   });
+
+#ifndef NDEBUG
+  finished = true;
+#endif
 }
 
 const FlarmNetRecord *
-FlarmNetDatabase::FindFirstRecordByCallSign(const TCHAR *cn) const
+FlarmNetDatabase::FindRecordById(FlarmId id) const
 {
-  for (const auto &i : map) {
-    assert(i.first.IsDefined());
+  assert(finished);
+
+  auto i = std::lower_bound(records.begin(), records.end(), id,
+                            [](const Item &item, FlarmId id){
+                              return item.first < id;
+                            });
+  return i != records.end() && i->first == id
+    ? &i->second
+    : NULL;
+}
 
-    const FlarmNetRecord &record = i.second;
-    if (StringIsEqual(record.callsign, cn))
-      return &record;
-  }
+std::pair<std::vector<unsigned>::const_iterator,
+          std::vector<unsigned>::const_iterator>
+FlarmNetDatabase::FindCallSign(const TCHAR *cn) const
+{
+  assert(finished);
+
+  auto first = std::lower_bound(by_callsign.begin(), by_callsign.end(), cn,
+                                [this](unsigned i, const TCHAR *cn){
+                                  return _tcscmp(records[i].second.callsign,
+                                                 cn) < 0;
+                                });
+  auto last = std::upper_bound(first, by_callsign.end(), cn,
+                               [this](const TCHAR *cn, unsigned i){
+                                 return _tcscmp(cn,
+                                                records[i].second.callsign) < 0;
+                               });
+  return std::make_pair(first, last);
+}
 
-  return NULL;
+const FlarmNetRecord *
+FlarmNetDatabase::FindFirstRecordByCallSign(const TCHAR *cn) const
+{
+  const auto range = FindCallSign(cn);
+  return range.first != range.second
+    ? &records[*range.first].second
+    : NULL;
 }
 
 unsigned
@@ -58,13 +121,9 @@ FlarmNetDatabase::FindRecordsByCallSign(const TCHAR *cn,
 {
   unsigned count = 0;
 
-  for (const auto &i : map) {
-    assert(i.first.IsDefined());
-
-    const FlarmNetRecord &record = i.second;
-    if (StringIsEqual(record.callsign, cn))
-      array[count++] = &record;
-  }
+  const auto range = FindCallSign(cn);
+  for (auto i = range.first; i != range.second && count < size; ++i)
+    array[count++] = &records[*i].second;
 
   return count;
 }
@@ -75,13 +134,9 @@ FlarmNetDatabase::FindIdsByCallSign(const TCHAR *cn, FlarmId array[],
 {
   unsigned count = 0;
 
-  for (const auto &i : map) {
-    assert(i.first.IsDefined());
-
-    const FlarmNetRecord &record = i.second;
-    if (StringIsEqual(record.callsign, cn))
-      array[count++] = i.first;
-  }
+  const auto range = FindCallSign(cn);
+  for (auto i = range.first; i != range.second && count < size; ++i)
+    array[count++] = records[*i].first;
 
   return count;
 }
@@ -28,39 +28,62 @@ Copyright_License {
 #include "FlarmNetRecord.hpp"
 #include "Compiler.h"
 
-#include <map>
+#include <vector>
+#include <utility>
 #include <tchar.h>
 
 /**
  * An in-memory representation of the FlarmNet.org database.
+ *
+ * The records are kept in one vector sorted by FLARM id, and a
+ * second vector of indices sorted by callsign; both are searched
+ * with a binary search.  After inserting records, Finish() must be
+ * called before the database can be queried.
  */
 class FlarmNetDatabase {
-  typedef std::map<FlarmId, FlarmNetRecord> RecordMap;
-  RecordMap map;
+  typedef std::pair<FlarmId, FlarmNetRecord> Item;
+  typedef std::vector<Item> RecordVector;
+  RecordVector records;
+
+  /**
+   * Indices into #records, sorted by callsign (and by id among
+   * equal callsigns).
+   */
+  std::vector<unsigned> by_callsign;
+
+#ifndef NDEBUG
+  bool finished = true;
+#endif
 
 public:
   bool IsEmpty() const {
-    return map.empty();
+    return records.empty();
   }
 
   void Clear() {
-    map.clear();
+    records.clear();
+    by_callsign.clear();
+#ifndef NDEBUG
+    finished = true;
+#endif
   }
 
   void Insert(const FlarmNetRecord &record);
 
+  /**
+   * Sort the records inserted since the last call and build the
+   * callsign index.  If an id was inserted more than once, the first
+   * record wins.
+   */
+  void Finish();
+
   /**
    * Finds a FLARMNetRecord object based on the given FLARM id
    * @param id FLARM id
    * @return FLARMNetRecord object
    */
   gcc_pure
-  const FlarmNetRecord *FindRecordById(FlarmId id) const {
-    auto i = map.find(id);
-    return i != map.end()
-      ? &i->second
-      : NULL;
-  }
+  const FlarmNetRecord *FindRecordById(FlarmId id) const;
 
   /**
    * Finds a FLARMNetRecord object based on the given Callsign
@@ -76,13 +99,19 @@ public:
   unsigned FindIdsByCallSign(const TCHAR *cn, FlarmId array[],
                              unsigned size) const;
 
-  RecordMap::const_iterator begin() const {
-    return map.begin();
+  RecordVector::const_iterator begin() const {
+    return records.begin();
   }
 
-  RecordMap::const_iterator end() const {
-    return map.end();
+  RecordVector::const_iterator end() const {
+    return records.end();
   }
+
+private:
+  gcc_pure
+  std::pair<std::vector<unsigned>::const_iterator,
+            std::vector<unsigned>::const_iterator>
+  FindCallSign(const TCHAR *cn) const;
 };
 
 #endif
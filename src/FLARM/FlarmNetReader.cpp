@@ -139,6 +139,7 @@ FlarmNetReader::LoadFile(NLineReader &reader, FlarmNetDatabase &database)
     }
   }
 
+  database.Finish();
   return itemCount;
 }
 
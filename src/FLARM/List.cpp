@@ -23,6 +23,34 @@ Copyright_License {
 
 #include "List.hpp"
 
+#include <math.h>
+
+FlarmTraffic *
+TrafficList::AllocateTraffic(double distance)
+{
+  if (!list.full())
+    return &list.append();
+
+  /* the list is full: evict the most distant target; this uses the
+     relative position because FlarmTraffic::distance is only
+     calculated later by the FlarmComputer */
+  FlarmTraffic *farthest = NULL;
+  double farthest_distance = distance;
+
+  for (auto &traffic : list) {
+    if (traffic.HasAlarm())
+      continue;
+
+    const double d = hypot(traffic.relative_north, traffic.relative_east);
+    if (d > farthest_distance) {
+      farthest = &traffic;
+      farthest_distance = d;
+    }
+  }
+
+  return farthest;
+}
+
 const FlarmTraffic *
 TrafficList::FindMaximumAlert() const
 {
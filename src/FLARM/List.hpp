@@ -28,6 +28,7 @@ Copyright_License {
 #include "NMEA/Validity.hpp"
 #include "Util/TrivialArray.hxx"
 
+#include <algorithm>
 #include <type_traits>
 
 /**
@@ -35,7 +36,12 @@ Copyright_License {
  * FLARM.
  */
 struct TrafficList {
-  static constexpr size_t MAX_COUNT = 25;
+  /**
+   * The maximum number of targets.  This is more than a FLARM
+   * reports by itself, to leave room for targets merged from
+   * receivers with a longer range.
+   */
+  static constexpr size_t MAX_COUNT = 50;
 
   /**
    * Time stamp of the latest modification to this object.
@@ -47,7 +53,10 @@ struct TrafficList {
    */
   Validity new_traffic;
 
-  /** Flarm traffic information */
+  /**
+   * Flarm traffic information.  This must remain the last attribute,
+   * see NMEAInfo::CopyFrom().
+   */
   TrivialArray<FlarmTraffic, MAX_COUNT> list;
 
   void Clear() {
@@ -66,7 +75,19 @@ struct TrafficList {
    */
   void Complement(const TrafficList &add) {
     if (IsEmpty() && !add.IsEmpty())
-      *this = add;
+      CopyFrom(add);
+  }
+
+  /**
+   * Copy the specified object into this one, but only the active
+   * targets.  This is much cheaper than the assignment operator,
+   * which copies all #MAX_COUNT slots even if the list is empty.
+   */
+  void CopyFrom(const TrafficList &src) {
+    modified = src.modified;
+    new_traffic = src.new_traffic;
+    list.resize(src.list.size());
+    std::copy(src.list.begin(), src.list.end(), list.begin());
   }
 
   void Expire(double clock) {
@@ -149,6 +170,17 @@ struct TrafficList {
       : &list.append();
   }
 
+  /**
+   * Like AllocateTraffic(), but if the array is full, reuse the slot
+   * of the most distant target which has no alarm and is farther
+   * away than the new one.  The caller is responsible for clearing
+   * the returned object.
+   *
+   * @param distance the distance of the new target [m]
+   * @return the FLARM_TRAFFIC pointer, NULL if no slot is available
+   */
+  FlarmTraffic *AllocateTraffic(double distance);
+
   /**
    * Search for the previous traffic in the ordered list.
    */
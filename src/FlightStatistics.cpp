@@ -25,6 +25,7 @@ Copyright_License {
 
 void FlightStatistics::Reset() {
   ScopeLock lock(mutex);
+  ++serial;
 
   thermal_average.Reset();
   altitude.Reset();
@@ -40,6 +41,7 @@ void
 FlightStatistics::StartTask()
 {
   ScopeLock lock(mutex);
+  ++serial;
   // JMW clear thermal climb average on task start
   //  thermal_average.Reset();
   vario_circling_histogram.Clear();
@@ -50,6 +52,7 @@ void
 FlightStatistics::AddAltitudeTerrain(const double tflight, const double terrainalt)
 {
   ScopeLock lock(mutex);
+  ++serial;
   altitude_terrain.Update(std::max(0., tflight / 3600.),
                           terrainalt);
 }
@@ -58,6 +61,7 @@ void
 FlightStatistics::AddAltitude(const double tflight, const double alt, const bool final_glide)
 {
   ScopeLock lock(mutex);
+  ++serial;
 
   const double t = std::max(0., tflight / 3600);
 
@@ -96,6 +100,7 @@ void
 FlightStatistics::AddTaskSpeed(const double tflight, const double val)
 {
   ScopeLock lock(mutex);
+  ++serial;
   task_speed.Update(tflight / 3600, val);
 }
 
@@ -103,6 +108,7 @@ void
 FlightStatistics::AddClimbBase(const double tflight, const double alt)
 {
   ScopeLock lock(mutex);
+  ++serial;
 
   // only add base after finished second climb, to avoid having the takeoff height
   // as the base
@@ -115,6 +121,7 @@ void
 FlightStatistics::AddClimbCeiling(const double tflight, const double alt)
 {
   ScopeLock lock(mutex);
+  ++serial;
   altitude_ceiling.UpdateConvexPositive(std::max(0., tflight) / 3600, alt);
 }
 
@@ -127,6 +134,7 @@ FlightStatistics::AddThermalAverage(const double tflight_start,
                                     const double tflight_end, const double v)
 {
   ScopeLock lock(mutex);
+  ++serial;
   thermal_average.Update(std::max(0., tflight_start) / 3600, v,
                          (tflight_end-tflight_start)/3600);
 }
@@ -135,6 +143,7 @@ void
 FlightStatistics::AddClimbRate(const double tflight, const double vario, const bool circling)
 {
   ScopeLock lock(mutex);
+  ++serial;
   if (circling) {
     vario_circling_histogram.UpdateHistogram(vario);
   } else {
@@ -28,6 +28,8 @@ Copyright_License {
 #include "Math/ConvexFilter.hpp"
 #include "Math/Histogram.hpp"
 #include "Thread/Mutex.hpp"
+#include "Util/Serial.hpp"
+#include "Compiler.h"
 
 class FlightStatistics {
 public:
@@ -41,6 +43,12 @@ public:
   Histogram vario_cruise_histogram;
   mutable Mutex mutex;
 
+  /**
+   * Incremented by every modification, to allow observers to detect
+   * whether anything has changed.  Protected by #mutex.
+   */
+  Serial serial;
+
   void StartTask();
 
   double AverageThermalAdjusted(double wthis, const bool circling);
@@ -58,6 +66,12 @@ public:
   void AddClimbRate(double tflight, double vario, bool circling);
 
   void Reset();
+
+  gcc_pure
+  Serial GetSerial() const {
+    ScopeLock lock(mutex);
+    return serial;
+  }
 };
 
 #endif
@@ -87,6 +87,13 @@ Button::SetCaption(const TCHAR *caption)
   Invalidate();
 }
 
+const TCHAR *
+Button::GetCaption() const
+{
+  const TextButtonRenderer &r = *(const TextButtonRenderer *)renderer;
+  return r.GetCaption();
+}
+
 void
 Button::SetSelected(bool _selected)
 {
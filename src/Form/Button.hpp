@@ -106,6 +106,13 @@ public:
    */
   void SetCaption(const TCHAR *caption);
 
+  /**
+   * Returns the current caption.  Like SetCaption(), this may only be
+   * used with a #TextButtonRenderer.
+   */
+  gcc_pure
+  const TCHAR *GetCaption() const;
+
   void SetSelected(bool _selected);
 
   gcc_pure
@@ -342,8 +342,9 @@ ListControl::SetPixelPan(unsigned _pixel_pan)
   if (pixel_pan == _pixel_pan)
     return;
 
+  const int delta = (int)pixel_pan - (int)_pixel_pan;
   pixel_pan = _pixel_pan;
-  Invalidate();
+  ScrollPixels(delta);
 }
 
 void
@@ -360,17 +361,21 @@ ListControl::SetOrigin(int i)
   if ((unsigned)i == origin)
     return;
 
-#ifdef USE_GDI
-  int delta = origin - i;
-#endif
-
+  const int delta = (int)origin - i;
   origin = i;
+  ScrollPixels(delta * (int)item_height);
+}
 
+void
+ListControl::ScrollPixels(int delta)
+{
 #ifdef USE_WINUSER
-  if ((unsigned)abs(delta) < items_visible) {
+  if ((unsigned)abs(delta) < GetHeight()) {
+    /* move the rows which remain visible and invalidate only the
+       uncovered area */
     PixelRect rc = GetClientRect();
     rc.right = scroll_bar.GetLeft(GetSize());
-    Scroll(0, delta * item_height, rc);
+    Scroll(0, delta, rc);
 
     /* repaint the scrollbar synchronously; we could Invalidate its
        area and repaint asynchronously via WM_PAINT, but then the clip
@@ -379,6 +384,8 @@ ListControl::SetOrigin(int i)
     DrawScrollBar(canvas);
     return;
   }
+#else
+  (void)delta;
 #endif
 
   Invalidate();
@@ -394,10 +401,19 @@ ListControl::SetPixelOrigin(int pixel_origin)
   if (pixel_origin < 0)
     pixel_origin = 0;
 
-  SetOrigin(pixel_origin / item_height);
-
   /* no pixel panning on e-paper screens to avoid tearing */
-  SetPixelPan(UsePixelPan() ? pixel_origin % item_height : 0);
+  if (!UsePixelPan())
+    pixel_origin -= pixel_origin % item_height;
+
+  /* move origin and pan in one step, so the window needs to be
+     scrolled or invalidated only once */
+  const int delta = (int)GetPixelOrigin() - pixel_origin;
+  if (delta == 0)
+    return;
+
+  origin = pixel_origin / item_height;
+  pixel_pan = pixel_origin % item_height;
+  ScrollPixels(delta);
 }
 
 void
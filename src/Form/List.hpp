@@ -273,6 +273,14 @@ protected:
   /** Checks whether a ScrollBar is needed and shows/hides it */
   void show_or_hide_scroll_bar();
 
+  /**
+   * The list contents have moved by the given number of pixels
+   * (positive: down).  Where the backend supports it, the rows which
+   * are still visible are moved on the screen, and only the uncovered
+   * area is repainted; otherwise the whole window is invalidated.
+   */
+  void ScrollPixels(int delta);
+
   /**
    * Scroll to the ListItem defined by i
    * @param i The ListItem array id
@@ -27,6 +27,131 @@ Copyright_License {
 #include "Atmosphere/Pressure.hpp"
 #include "Math/Util.hpp"
 #include "Util/StringFormat.hpp"
+#include "Util/StringAPI.hxx"
+#include "Util/Macros.hpp"
+
+#include <assert.h>
+#include <math.h>
+
+/**
+ * Write the decimal digits of #value (backwards, starting at #end)
+ * and return a pointer to the first digit.
+ */
+static TCHAR *
+WriteDigitsBackwards(TCHAR *end, unsigned long long value,
+                     unsigned min_digits)
+{
+  TCHAR *p = end;
+  do {
+    *--p = _T('0') + value % 10;
+    value /= 10;
+  } while (value > 0);
+
+  while (unsigned(end - p) < min_digits)
+    *--p = _T('0');
+
+  return p;
+}
+
+static TCHAR *
+AppendUnit(TCHAR *p, bool include_unit, Unit unit)
+{
+  if (include_unit) {
+    *p++ = _T(' ');
+    p = UnsafeCopyStringP(p, Units::GetUnitName(unit));
+  } else
+    *p = _T('\0');
+
+  return p;
+}
+
+/**
+ * Equivalent to printf("%d") / printf("%+d"), followed by the unit
+ * name if requested.
+ */
+static void
+FormatIntegerValue(TCHAR *buffer, int value, bool include_sign,
+                   bool include_unit, Unit unit)
+{
+  TCHAR digits[16];
+  TCHAR *const end = digits + ARRAY_SIZE(digits);
+  const unsigned long long magnitude = value < 0
+    ? -(long long)value
+    : (long long)value;
+  const TCHAR *first = WriteDigitsBackwards(end, magnitude, 1);
+
+  TCHAR *p = buffer;
+  if (value < 0)
+    *p++ = _T('-');
+  else if (include_sign)
+    *p++ = _T('+');
+
+  while (first != end)
+    *p++ = *first++;
+
+  AppendUnit(p, include_unit, unit);
+}
+
+/**
+ * Equivalent to printf("%.*f") / printf("%+.*f") with a precision of
+ * 0 to 2, followed by the unit name if requested, but without the
+ * format string interpretation.  The value is rounded exactly like
+ * printf() does (to nearest, ties to even, based on the exact binary
+ * value), so the output is identical.
+ */
+static void
+FormatDecimalValue(TCHAR *buffer, double value, unsigned precision,
+                   bool include_sign, bool include_unit, Unit unit)
+{
+  assert(precision <= 2);
+
+  static constexpr double scales[] = { 1, 10, 100 };
+  const double scale = scales[precision];
+  const double product = value * scale;
+
+  if (!isfinite(product) || fabs(product) >= 4503599627370496.) {
+    /* huge or invalid values are rare; let printf() deal with them */
+    if (include_unit)
+      StringFormatUnsafe(buffer, include_sign ? _T("%+.*f %s") : _T("%.*f %s"),
+                         precision, value, Units::GetUnitName(unit));
+    else
+      StringFormatUnsafe(buffer, include_sign ? _T("%+.*f") : _T("%.*f"),
+                         precision, value);
+    return;
+  }
+
+  /* the product may have been rounded; the exact product is
+     "product + error" since "scale" is exact */
+  const double error = fma(value, scale, -product);
+  double rounded = nearbyint(product);
+  if (error != 0 && fabs(product - rounded) == 0.5)
+    /* the rounded product is exactly halfway, but the exact one is
+       not: the error decides, not nearbyint()'s ties-to-even rule */
+    rounded = floor(product) + (error > 0);
+
+  TCHAR digits[32];
+  TCHAR *const end = digits + ARRAY_SIZE(digits);
+  const unsigned long long magnitude = (unsigned long long)fabs(rounded);
+  TCHAR *first = WriteDigitsBackwards(end, magnitude, precision + 1);
+
+  TCHAR *p = buffer;
+  if (signbit(value))
+    *p++ = _T('-');
+  else if (include_sign)
+    *p++ = _T('+');
+
+  const TCHAR *const point = end - precision;
+  while (first != point)
+    *p++ = *first++;
+
+  if (precision > 0) {
+    *p++ = _T('.');
+    while (first != end)
+      *p++ = *first++;
+  }
+
+  AppendUnit(p, include_unit, unit);
+}
 
 static void
 FormatInteger(TCHAR *buffer,
@@ -36,11 +161,7 @@ FormatInteger(TCHAR *buffer,
   const auto uvalue = Units::ToUserUnit(value, unit);
   const int ivalue = iround(uvalue);
 
-  if (include_unit)
-    StringFormatUnsafe(buffer, include_sign ? _T("%+d %s") : _T("%d %s"),
-                       ivalue, Units::GetUnitName(unit));
-  else
-    StringFormatUnsafe(buffer, include_sign ? _T("%+d") : _T("%d"), ivalue);
+  FormatIntegerValue(buffer, ivalue, include_sign, include_unit, unit);
 }
 
 void
@@ -57,11 +178,7 @@ FormatWingLoading(TCHAR *buffer, double value, Unit unit,
   const auto uvalue = Units::ToUserUnit(value, unit);
   int precision = uvalue > 20 ? 0 : 1;
 
-    if (include_unit)
-      _stprintf(buffer, _T("%.*f %s"), precision, (double)uvalue,
-                Units::GetUnitName(unit));
-    else
-      _stprintf(buffer, _T("%.*f"), precision, (double)uvalue);
+  FormatDecimalValue(buffer, uvalue, precision, false, include_unit, unit);
 }
 
 void
@@ -84,11 +201,7 @@ FormatDistance(TCHAR *buffer, double value, Unit unit,
 {
   value = Units::ToUserUnit(value, unit);
 
-  if (include_unit)
-    StringFormatUnsafe(buffer, _T("%.*f %s"), precision, (double)value,
-                       Units::GetUnitName(unit));
-  else
-    StringFormatUnsafe(buffer, _T("%.*f"), precision, (double)value);
+  FormatDecimalValue(buffer, value, precision, false, include_unit, unit);
 }
 
 gcc_const
@@ -115,11 +228,7 @@ FormatSmallDistance(TCHAR *buffer, double value, Unit unit,
   unit = GetSmallerDistanceUnit(unit);
   value = Units::ToUserUnit(value, unit);
 
-  if (include_unit)
-    StringFormatUnsafe(buffer, _T("%.*f %s"), precision, (double)value,
-                       Units::GetUnitName(unit));
-  else
-    StringFormatUnsafe(buffer, _T("%.*f"), precision, (double)value);
+  FormatDecimalValue(buffer, value, precision, false, include_unit, unit);
 
   return unit;
 }
@@ -166,11 +275,7 @@ FormatSpeed(TCHAR *buffer,
   value = Units::ToUserUnit(value, unit);
 
   const int prec = precision && value < 100;
-  if (include_unit)
-    StringFormatUnsafe(buffer, _T("%.*f %s"), prec, (double)value,
-                       Units::GetUnitName(unit));
-  else
-    StringFormatUnsafe(buffer, _T("%.*f"), prec, (double)value);
+  FormatDecimalValue(buffer, value, prec, false, include_unit, unit);
 }
 
 const TCHAR*
@@ -207,14 +312,10 @@ FormatVerticalSpeed(TCHAR *buffer, double value, Unit unit,
 {
   value = Units::ToUserUnit(value, unit);
 
-  if (include_unit)
-    StringFormatUnsafe(buffer,
-                       GetVerticalSpeedFormat(unit, include_unit, include_sign),
-                       (double)value, Units::GetUnitName(unit));
-  else
-    StringFormatUnsafe(buffer,
-                       GetVerticalSpeedFormat(unit, include_unit, include_sign),
-                       (double)value);
+  /* same precision as GetVerticalSpeedFormat() */
+  const unsigned precision = unit == Unit::FEET_PER_MINUTE ? 0 : 1;
+  FormatDecimalValue(buffer, value, precision, include_sign,
+                     include_unit, unit);
 }
 
 void
@@ -223,11 +324,7 @@ FormatTemperature(TCHAR *buffer, double value, Unit unit,
 {
   value = Units::ToUserUnit(value, unit);
 
-  if (include_unit)
-    StringFormatUnsafe(buffer, _T("%.0f %s"),
-                       (double)value, Units::GetUnitName(unit));
-  else
-    StringFormatUnsafe(buffer, _T("%.0f"), (double)value);
+  FormatDecimalValue(buffer, value, 0, false, include_unit, unit);
 }
 
 void
@@ -236,13 +333,9 @@ FormatPressure(TCHAR *buffer, AtmosphericPressure pressure,
 {
   auto _pressure = Units::ToUserUnit(pressure.GetHectoPascal(), unit);
 
-  if (include_unit)
-    StringFormatUnsafe(buffer, GetPressureFormat(unit, include_unit),
-                       (double)_pressure,
-                       Units::GetUnitName(unit));
-  else
-    StringFormatUnsafe(buffer, GetPressureFormat(unit, include_unit),
-                       (double)_pressure);
+  /* same precision as GetPressureFormat() */
+  const unsigned precision = unit == Unit::INCH_MERCURY ? 2 : 0;
+  FormatDecimalValue(buffer, _pressure, precision, false, include_unit, unit);
 }
 
 const TCHAR*
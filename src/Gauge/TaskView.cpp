@@ -37,6 +37,9 @@
 #include "Look/TaskLook.hpp"
 #include "Look/MapLook.hpp"
 #include "MapSettings.hpp"
+#include "Util/Macros.hpp"
+
+#include <assert.h>
 
 #ifndef ENABLE_OPENGL
 #include "Screen/BufferCanvas.hpp"
@@ -79,27 +82,38 @@ IsFAITriangleApplicable(const OrderedTask &task)
     task.TaskSize() >= 2 && task.TaskSize() <= 4;
 }
 
+/**
+ * The FAI triangle sectors of the task legs, reused while the task
+ * geometry does not change.  This is only used by the UI thread.
+ */
+static FAITriangleAreaRenderer fai_sector_renderers[3];
+
 static void
-RenderFAISectors(Canvas &canvas, const WindowProjection &projection,
-                 const OrderedTask &task)
+UpdateFAISectors(const OrderedTask &task)
 {
   const FAITriangleSettings &settings =
     task.GetOrderedTaskSettings().fai_triangle;
 
-  const unsigned size = task.TaskSize();
-  const unsigned end = size - 1;
+  const unsigned end = task.TaskSize() - 1;
+  assert(end <= ARRAY_SIZE(fai_sector_renderers));
 
   for (unsigned i = 0; i != end; ++i)
-    RenderFAISector(canvas, projection,
-                    task.GetPoint(i).GetLocation(),
-                    task.GetPoint(i + 1).GetLocation(),
-                    true, settings);
+    fai_sector_renderers[i].Update(task.GetPoint(i).GetLocation(),
+                                   task.GetPoint(i + 1).GetLocation(),
+                                   settings);
+}
+
+static void
+RenderFAISectors(Canvas &canvas, const WindowProjection &projection,
+                 const OrderedTask &task)
+{
+  const unsigned end = task.TaskSize() - 1;
 
   for (unsigned i = 0; i != end; ++i)
-    RenderFAISector(canvas, projection,
-                    task.GetPoint(i).GetLocation(),
-                    task.GetPoint(i + 1).GetLocation(),
-                    false, settings);
+    fai_sector_renderers[i].Draw(canvas, projection, true);
+
+  for (unsigned i = 0; i != end; ++i)
+    fai_sector_renderers[i].Draw(canvas, projection, false);
 }
 
 void
@@ -139,6 +153,8 @@ PaintTask(Canvas &canvas, const WindowProjection &projection,
 #endif
 
   if (fai_sectors && IsFAITriangleApplicable(task)) {
+    UpdateFAISectors(task);
+
     static constexpr Color fill_color = COLOR_YELLOW;
 #if defined(ENABLE_OPENGL) || defined(USE_MEMORY_CANVAS)
 #ifdef ENABLE_OPENGL
@@ -57,15 +57,36 @@ ThermalAssistantRenderer::ThermalAssistantRenderer(const ThermalAssistantLook &_
   :look(_look),
    padding(_padding),
    small(_small),
-   direction(Angle::Zero()) {}
+   direction(Angle::Zero()),
+   valid(false), serial(1) {}
 
-void
+bool
 ThermalAssistantRenderer::Update(const AttitudeState &attitude,
                                const DerivedInfo &derived)
 {
+  static constexpr Angle min_heading_delta = Angle::Degrees(2);
+
+  const bool changed = !valid ||
+    derived.circling != circling.circling ||
+    ceil(CalculateMaxLift()) !=
+    ceil(std::max(1., *std::max_element(derived.lift_database.begin(),
+                                        derived.lift_database.end()))) ||
+    /* the lift points are only shown while circling */
+    (derived.circling &&
+     (derived.TurningLeft() != circling.TurningLeft() ||
+      derived.lift_database != vario.lift_database ||
+      (attitude.heading - direction).Absolute() >= min_heading_delta));
+
+  if (!changed)
+    /* no change - don't redraw */
+    return false;
+
   direction = attitude.heading;
   circling = (CirclingInfo)derived;
   vario = (VarioInfo)derived;
+  valid = true;
+  ++serial;
+  return true;
 }
 
 double
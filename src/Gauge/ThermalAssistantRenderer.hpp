@@ -67,6 +67,17 @@ protected:
   CirclingInfo circling;
   VarioInfo vario;
 
+  /**
+   * Have #direction, #circling and #vario been initialised by
+   * Update()?
+   */
+  bool valid;
+
+  /**
+   * Incremented by Update() each time the picture changes.
+   */
+  unsigned serial;
+
 public:
   ThermalAssistantRenderer(const ThermalAssistantLook &look,
                            unsigned _padding, bool _small = false);
@@ -80,7 +91,18 @@ public:
     return radius;
   }
 
-  void Update(const AttitudeState &attitude, const DerivedInfo &_derived);
+  /**
+   * @return true if the picture has changed and needs to be
+   * repainted
+   */
+  bool Update(const AttitudeState &attitude, const DerivedInfo &_derived);
+
+  /**
+   * Returns a number which changes each time Update() returns true.
+   */
+  unsigned GetSerial() const {
+    return serial;
+  }
 
   void UpdateLayout(const PixelRect &rc);
   void Paint(Canvas &canvas);
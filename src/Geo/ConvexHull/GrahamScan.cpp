@@ -23,6 +23,8 @@
 #include "GrahamScan.hpp"
 #include "Geo/SearchPointVector.hpp"
 
+#include <algorithm>
+
 static bool
 sortleft
 (const SearchPoint& sp1, const SearchPoint& sp2)
@@ -97,7 +99,7 @@ GrahamScan::PartitionPoints()
   //
   // Step one in partitioning the points is to sort the raw data
   //
-  raw_points.sort(sortleft);
+  std::stable_sort(raw_points.begin(), raw_points.end(), sortleft);
 
   //
   // The the far left and far right points, remove them from the
@@ -152,52 +154,56 @@ GrahamScan::BuildHull()
 }
 
 void
-GrahamScan::BuildHalfHull(std::vector<SearchPoint*> input,
+GrahamScan::BuildHalfHull(const std::vector<SearchPoint*> &input,
                           std::vector<SearchPoint*> &output, int factor)
 {
   //
   // This is the method that builds either the upper or the lower half convex
-  // hull. It takes as its input a copy of the input array, which will be the
-  // sorted list of points in one of the two halfs. It produces as output a list
-  // of the points in the corresponding convex hull.
+  // hull. It takes as its input the sorted list of points in one of the two
+  // halfs. It produces as output a list of the points in the corresponding
+  // convex hull.
   //
   // The factor should be 1 for the lower hull, and -1 for the upper hull.
   //
 
-  output.reserve(input.size() + 1);
+  output.reserve(input.size() + 2);
 
   //
   // The hull will always start with the left point, and end with the
-  // right point. According, we start by adding the left point as the
-  // first point in the output sequence, and make sure the right point
-  // is the last point in the input sequence.
+  // right point.
   //
-  input.push_back(right);
   output.push_back(left);
 
+  for (const auto &i : input)
+    AddToHalfHull(i, output, factor);
+
+  AddToHalfHull(right, output, factor);
+}
+
+void
+GrahamScan::AddToHalfHull(SearchPoint *p,
+                          std::vector<SearchPoint*> &output, int factor) const
+{
   //
-  // The construction loop runs until the input is exhausted
+  // Add the leftmost point to the hull, then test to see if a
+  // convexity violation has occured. If it has, fix things up by
+  // removing the next-to-last point in the output sequence until
+  // convexity is restored.
   //
-  for (const auto &i : input) {
-    //
-    // Repeatedly add the leftmost point to the hull, then test to see
-    // if a convexity violation has occured. If it has, fix things up
-    // by removing the next-to-last point in the output sequence until
-    // convexity is restored.
-    //
-    output.push_back(i);
+  output.push_back(p);
 
-    while (output.size() >= 3) {
-      const auto end = output.size() - 1;
+  while (output.size() >= 3) {
+    const auto end = output.size() - 1;
 
-      if (factor * Direction(output[end - 2]->GetLocation(),
-                             output[end]->GetLocation(),
-                             output[end - 1]->GetLocation(),
-                             tolerance) > 0)
-        break;
+    if (factor * Direction(output[end - 2]->GetLocation(),
+                           output[end]->GetLocation(),
+                           output[end - 1]->GetLocation(),
+                           tolerance) > 0)
+      break;
 
-      output.erase(output.begin() + end - 1);
-    }
+    /* remove the next-to-last point */
+    output[end - 1] = output[end];
+    output.pop_back();
   }
 }
 
@@ -25,7 +25,6 @@
 
 #include "Util/NonCopyable.hpp"
 
-#include <list>
 #include <vector>
 
 class SearchPointVector;
@@ -40,7 +39,7 @@ struct GeoPoint;
  */
 class GrahamScan: private NonCopyable
 {
-  std::list<SearchPoint> raw_points;
+  std::vector<SearchPoint> raw_points;
   SearchPoint *left;
   SearchPoint *right;
   std::vector<SearchPoint*> upper_partition_points;
@@ -72,8 +71,10 @@ public:
 private:
   void PartitionPoints();
   void BuildHull();
-  void BuildHalfHull(std::vector<SearchPoint*> input,
+  void BuildHalfHull(const std::vector<SearchPoint*> &input,
                      std::vector<SearchPoint*> &output, int factor);
+  void AddToHalfHull(SearchPoint *p,
+                     std::vector<SearchPoint*> &output, int factor) const;
 };
 
 
@@ -29,8 +29,7 @@
 
 #include <cassert>
 
-// scaling for flat earth integer representation, gives approximately 50m resolution
-static constexpr int fixed_scale = 57296;
+static constexpr int fixed_scale = FlatProjection::FIXED_SCALE;
 static constexpr double inv_scale(1.0/fixed_scale);
 
 void
@@ -45,17 +44,6 @@ FlatProjection::SetCenter(const GeoPoint &_center)
   approx_scale = Unproject(FlatGeoPoint(0,-1)).DistanceS(Unproject(FlatGeoPoint(0,1))) / 2;
 }
 
-FlatPoint
-FlatProjection::ProjectFloat(const GeoPoint &tp) const
-{
-  assert(IsValid());
-
-  return FlatPoint((tp.longitude - center.longitude)
-                   .AsDelta().Native() * cos,
-                   (tp.latitude - center.latitude)
-                   .AsDelta().Native() * fixed_scale);
-}
-
 GeoPoint
 FlatProjection::Unproject(const FlatPoint &fp) const
 {
@@ -67,15 +55,6 @@ FlatProjection::Unproject(const FlatPoint &fp) const
   return tp;
 }
 
-FlatGeoPoint
-FlatProjection::ProjectInteger(const GeoPoint &tp) const
-{
-  assert(IsValid());
-
-  FlatPoint f = ProjectFloat(tp);
-  return FlatGeoPoint(iround(f.x), iround(f.y));
-}
-
 GeoPoint
 FlatProjection::Unproject(const FlatGeoPoint &fp) const
 {
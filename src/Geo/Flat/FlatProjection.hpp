@@ -23,11 +23,13 @@
 #ifndef XCSOAR_FLAT_PROJECTION_HPP
 #define XCSOAR_FLAT_PROJECTION_HPP
 
+#include "FlatPoint.hpp"
+#include "FlatGeoPoint.hpp"
 #include "Geo/GeoPoint.hpp"
 #include "Compiler.h"
 
-struct FlatPoint;
-struct FlatGeoPoint;
+#include <cassert>
+
 struct FlatBoundingBox;
 class GeoBounds;
 
@@ -39,6 +41,14 @@ class GeoBounds;
  * Needs to be initialized with reset() before first use.
  */
 class FlatProjection {
+public:
+  /**
+   * Scaling for the flat earth integer representation, gives
+   * approximately 50m resolution.
+   */
+  static constexpr int FIXED_SCALE = 57296;
+
+private:
   /**
    * The "reference" location, used as projection center point.
    */
@@ -92,7 +102,10 @@ public:
    * @return Projected point
    */
   gcc_pure
-  FlatGeoPoint ProjectInteger(const GeoPoint &tp) const;
+  FlatGeoPoint ProjectInteger(const GeoPoint &tp) const {
+    const FlatPoint f = ProjectFloat(tp);
+    return FlatGeoPoint(iround(f.x), iround(f.y));
+  }
 
   /**
    * Projects a GeoBounds to integer 2-d representation bounding box
@@ -138,7 +151,12 @@ public:
    * @return Projected point
    */
   gcc_pure
-  FlatPoint ProjectFloat(const GeoPoint &tp) const;
+  FlatPoint ProjectFloat(const GeoPoint &tp) const {
+    assert(IsValid());
+
+    return FlatPoint(DeltaNative(tp.longitude - center.longitude) * cos,
+                     DeltaNative(tp.latitude - center.latitude) * FIXED_SCALE);
+  }
 
   /**
    * Projects an integer 2-d representation to a Geodetic point
@@ -191,6 +209,20 @@ public:
   double GetApproximateScale() const {
     return approx_scale;
   }
+
+private:
+  /**
+   * Same as Angle::AsDelta().Native(), but the common case (the
+   * difference of two normalised latitudes, or of two nearby
+   * longitudes) is handled inline.
+   */
+  gcc_const
+  static double DeltaNative(Angle delta) {
+    if (delta > -Angle::HalfCircle() && delta <= Angle::HalfCircle())
+      return delta.Native();
+
+    return delta.AsDelta().Native();
+  }
 };
 
 #endif
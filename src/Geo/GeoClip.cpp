@@ -410,8 +410,42 @@ GeoClip::ClipPolygon(GeoPoint *dest,
     return 0;
 
   GeoPoint *imported = dest + src_length * 2;
-  for (unsigned i = 0; i < src_length; ++i)
-    imported[i] = ImportPoint(src[i]);
+
+  /* collect the bounds of the polygon while importing, to handle the
+     common cases (entirely inside or entirely outside the screen)
+     without the per-vertex clipping */
+  imported[0] = ImportPoint(src[0]);
+  Angle min_longitude = imported[0].longitude;
+  Angle max_longitude = min_longitude;
+  Angle min_latitude = imported[0].latitude;
+  Angle max_latitude = min_latitude;
+
+  for (unsigned i = 1; i < src_length; ++i) {
+    const GeoPoint p = imported[i] = ImportPoint(src[i]);
+
+    if (p.longitude < min_longitude)
+      min_longitude = p.longitude;
+    else if (p.longitude > max_longitude)
+      max_longitude = p.longitude;
+
+    if (p.latitude < min_latitude)
+      min_latitude = p.latitude;
+    else if (p.latitude > max_latitude)
+      max_latitude = p.latitude;
+  }
+
+  if (max_longitude < Angle::Zero() || min_longitude > width ||
+      max_latitude < GetSouth() || min_latitude > GetNorth())
+    /* trivial reject: all vertices are beyond the same bound */
+    return 0;
+
+  if (min_longitude >= Angle::Zero() && max_longitude <= width &&
+      min_latitude >= GetSouth() && max_latitude <= GetNorth()) {
+    /* trivial accept: nothing to clip */
+    for (unsigned i = 0; i < src_length; ++i)
+      dest[i] = ExportPoint(imported[i]);
+    return src_length;
+  }
 
   GeoPoint *first_stage = dest + src_length;
   unsigned n = ClipPolygonLongitude(Angle::Zero(), width,
@@ -31,10 +31,20 @@ Copyright_License {
 #include "Geo/GeoPoint.hpp"
 #include "Math/Util.hpp"
 
+#include <algorithm>
+
 #include <stdint.h>
 
 #define EGM96SIZE 16200
 
+/**
+ * The grid has one row per 2 degrees latitude (starting at the north
+ * pole) and one column per 2 degrees longitude (starting at the
+ * prime meridian, going east).
+ */
+static constexpr unsigned EGM96_COLUMNS = 180;
+static constexpr unsigned EGM96_ROWS = EGM96SIZE / EGM96_COLUMNS;
+
 extern "C" const uint8_t egm96s_dem[];
 
 double
@@ -52,3 +62,42 @@ EGM96::LookupSeparation(const GeoPoint &pt)
 
   return (int)egm96s_dem[offset] - 127;
 }
+
+static inline int
+GetGridValue(unsigned row, unsigned column)
+{
+  return (int)egm96s_dem[row * EGM96_COLUMNS + column] - 127;
+}
+
+double
+EGM96::InterpolateSeparation(const GeoPoint &pt)
+{
+  /* fractional grid coordinates; the southernmost row is the last
+     one in the table, so clamp there instead of extrapolating */
+  const double y = std::min(std::max((Angle::QuarterCircle() - pt.latitude)
+                                     .Half().Degrees(), 0.),
+                            double(EGM96_ROWS - 1));
+  const double x = pt.longitude.AsBearing().Half().Degrees();
+
+  const unsigned row0 = std::min(unsigned(y), EGM96_ROWS - 2);
+  const unsigned row1 = row0 + 1;
+  const unsigned column0 = std::min(unsigned(x), EGM96_COLUMNS - 1);
+  /* longitude wraps around */
+  const unsigned column1 = column0 + 1 < EGM96_COLUMNS ? column0 + 1 : 0;
+
+  const double fy = y - row0, fx = x - column0;
+
+  const double top = GetGridValue(row0, column0) * (1 - fx) +
+    GetGridValue(row0, column1) * fx;
+  const double bottom = GetGridValue(row1, column0) * (1 - fx) +
+    GetGridValue(row1, column1) * fx;
+  return top * (1 - fy) + bottom * fy;
+}
+
+void
+EGM96::InterpolateSeparation(const GeoPoint *points, double *separations,
+                             unsigned n)
+{
+  for (unsigned i = 0; i < n; ++i)
+    separations[i] = InterpolateSeparation(points[i]);
+}
@@ -39,6 +39,24 @@ namespace EGM96
    */
   gcc_pure
   double LookupSeparation(const GeoPoint &pt);
+
+  /**
+   * Like LookupSeparation(), but interpolates bilinearly between the
+   * four surrounding grid points instead of picking the nearest one.
+   * This avoids steps of several metres when the location crosses a
+   * grid cell boundary, which matters when converting whole traces.
+   */
+  gcc_pure
+  double InterpolateSeparation(const GeoPoint &pt);
+
+  /**
+   * Batch version of InterpolateSeparation() for bulk conversions.
+   *
+   * @param separations an array which receives one separation per
+   * element of #points
+   */
+  void InterpolateSeparation(const GeoPoint *points, double *separations,
+                             unsigned n);
 }
 
 #endif
@@ -159,18 +159,30 @@ Middle(const GeoPoint &a, const GeoPoint &b)
   return IntermediatePoint(a, b, distance / 2);
 }
 
-void
-DistanceBearing(const GeoPoint &loc1, const GeoPoint &loc2,
+/**
+ * The sine and cosine of the "reduced latitude" of a point, which is
+ * all that the Vincenty formula needs from each latitude.  The batch
+ * functions below compute it only once per point.
+ */
+struct ReducedLatitude {
+  double sin, cos;
+
+  explicit ReducedLatitude(Angle latitude) {
+    const auto u = atan((1 - FLATTENING) * latitude.tan());
+    sin = ::sin(u);
+    cos = ::cos(u);
+  }
+};
+
+static void
+DistanceBearing(const GeoPoint &loc1, const ReducedLatitude &r1,
+                const GeoPoint &loc2, const ReducedLatitude &r2,
                 double *distance, Angle *bearing)
 {
   const auto lon21 = loc2.longitude - loc1.longitude;
 
-  auto u1 = atan((1 - FLATTENING) * loc1.latitude.tan()),
-    u2 = atan((1 - FLATTENING) * loc2.latitude.tan());
-
-  auto sinu1 = sin(u1), cosu1 = cos(u1);
-
-  auto sinu2 = sin(u2), cosu2 = cos(u2);
+  const auto sinu1 = r1.sin, cosu1 = r1.cos;
+  const auto sinu2 = r2.sin, cosu2 = r2.cos;
 
   auto lambda = lon21.Radians(), lambda_p = Angle::FullCircle().Radians();
 
@@ -241,6 +253,46 @@ DistanceBearing(const GeoPoint &loc1, const GeoPoint &loc2,
       cosu1 * sinu2 - sinu1 * cosu2 * cos(lambda))).AsBearing();
 }
 
+void
+DistanceBearing(const GeoPoint &loc1, const GeoPoint &loc2,
+                double *distance, Angle *bearing)
+{
+  DistanceBearing(loc1, ReducedLatitude(loc1.latitude),
+                  loc2, ReducedLatitude(loc2.latitude),
+                  distance, bearing);
+}
+
+void
+DistanceBearing(const GeoPoint &origin, const GeoPoint *points, unsigned n,
+                double *distances, Angle *bearings)
+{
+  const ReducedLatitude r_origin(origin.latitude);
+
+  for (unsigned i = 0; i < n; ++i)
+    DistanceBearing(origin, r_origin,
+                    points[i], ReducedLatitude(points[i].latitude),
+                    distances != nullptr ? distances + i : nullptr,
+                    bearings != nullptr ? bearings + i : nullptr);
+}
+
+void
+LegDistanceBearing(const GeoPoint *points, unsigned n,
+                   double *distances, Angle *bearings)
+{
+  if (n < 2)
+    return;
+
+  ReducedLatitude r_previous(points[0].latitude);
+
+  for (unsigned i = 1; i < n; ++i) {
+    const ReducedLatitude r(points[i].latitude);
+    DistanceBearing(points[i - 1], r_previous, points[i], r,
+                    distances != nullptr ? distances + i - 1 : nullptr,
+                    bearings != nullptr ? bearings + i - 1 : nullptr);
+    r_previous = r;
+  }
+}
+
 double
 ProjectedDistance(const GeoPoint &loc1, const GeoPoint &loc2,
                   const GeoPoint &loc3)
@@ -48,6 +48,32 @@ void
 DistanceBearing(const GeoPoint &loc1, const GeoPoint &loc2,
                 double *distance, Angle *bearing);
 
+/**
+ * Calculates the distance and bearing from one origin to each of the
+ * given points.  The results are identical to calling
+ * DistanceBearing() for each point, but the terms which depend only
+ * on the origin are calculated once.
+ *
+ * @param distances an array of #n elements or nullptr
+ * @param bearings an array of #n elements or nullptr
+ */
+void
+DistanceBearing(const GeoPoint &origin, const GeoPoint *points, unsigned n,
+                double *distances, Angle *bearings);
+
+/**
+ * Calculates the distance and bearing of each leg of a polyline,
+ * i.e. from points[i] to points[i+1].  The results are identical to
+ * calling DistanceBearing() for each leg, but each point's terms are
+ * calculated only once instead of twice.
+ *
+ * @param distances an array of #n-1 elements or nullptr
+ * @param bearings an array of #n-1 elements or nullptr
+ */
+void
+LegDistanceBearing(const GeoPoint *points, unsigned n,
+                   double *distances, Angle *bearings);
+
 /**
  * Calculates the distance between two locations
  * @param loc1 Location 1
@@ -27,6 +27,8 @@
 #include "Flat/FlatRay.hpp"
 #include "Flat/FlatBoundingBox.hpp"
 
+#include <algorithm>
+
 bool 
 SearchPointVector::PruneInterior()
 {
@@ -48,6 +50,96 @@ SearchPointVector::ThinToSize(const unsigned max_size)
   return retval;
 }
 
+/**
+ * Is the point on the right side of the edge from a to b?  The hulls
+ * produced by #GrahamScan are counter-clockwise, so this means the
+ * edge is visible from outside.
+ */
+gcc_pure
+static bool
+IsRightOf(const GeoPoint &a, const GeoPoint &b, const GeoPoint &p)
+{
+  const auto ab = b - a;
+  const auto ap = p - a;
+
+  return ab.longitude.Native() * ap.latitude.Native() <
+    ab.latitude.Native() * ap.longitude.Native();
+}
+
+/**
+ * Is the point m between the (collinear) points a and b?
+ */
+gcc_pure
+static bool
+IsBetween(const GeoPoint &a, const GeoPoint &m, const GeoPoint &b)
+{
+  const auto am = m - a;
+  const auto ab = b - a;
+  const double dot = am.longitude.Native() * ab.longitude.Native() +
+    am.latitude.Native() * ab.latitude.Native();
+  const double ab2 = ab.longitude.Native() * ab.longitude.Native() +
+    ab.latitude.Native() * ab.latitude.Native();
+  return dot >= 0 && dot <= ab2;
+}
+
+bool
+SearchPointVector::AddToHull(const SearchPoint &sp)
+{
+  if (size() < 3) {
+    /* not a polygon yet; PruneInterior() doesn't reorder the points
+       if none was removed, so establish the orientation here */
+    push_back(sp);
+    if (size() == 3) {
+      const GeoPoint &a = (*this)[0].GetLocation();
+      const GeoPoint &b = (*this)[1].GetLocation();
+      const GeoPoint &c = (*this)[2].GetLocation();
+      if (IsRightOf(a, b, c))
+        std::swap((*this)[1], (*this)[2]);
+      else if (!IsRightOf(a, c, b))
+        /* collinear: keep only the two outermost points */
+        erase(begin() + (IsBetween(a, b, c)
+                         ? 1
+                         : (IsBetween(b, a, c) ? 0 : 2)));
+    }
+
+    return true;
+  }
+
+  const unsigned n = size();
+  const GeoPoint &p = sp.GetLocation();
+
+  auto is_visible = [this, n, &p](unsigned i){
+    return IsRightOf((*this)[i].GetLocation(),
+                     (*this)[(i + 1) % n].GetLocation(), p);
+  };
+
+  unsigned first = 0;
+  while (!is_visible(first))
+    if (++first == n)
+      /* no edge is visible: the point is inside */
+      return false;
+
+  if (first == 0) {
+    /* the visible edges are consecutive, but the chain may wrap
+       around; walk back to its beginning */
+    unsigned i = n;
+    while (i > 1 && is_visible(i - 1))
+      --i;
+    first = i % n;
+  }
+
+  unsigned count = 1;
+  while (count < n && is_visible((first + count) % n))
+    ++count;
+
+  /* move the first vertex of the chain to the front, replace the
+     vertices between the visible edges with the new point */
+  std::rotate(begin(), begin() + first, end());
+  erase(begin() + 1, begin() + count);
+  insert(begin() + 1, sp);
+  return true;
+}
+
 void 
 SearchPointVector::Project(const FlatProjection &tp)
 {
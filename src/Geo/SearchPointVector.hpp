@@ -47,6 +47,17 @@ public:
    */
   bool ThinToSize(const unsigned max_size);
 
+  /**
+   * Add a point to this convex hull (e.g. the result of
+   * PruneInterior()), and remove the points which become interior.
+   * This is cheaper than appending the point and pruning the whole
+   * vector again.
+   *
+   * @return True if the point was outside the hull and the vector
+   * was modified
+   */
+  bool AddToHull(const SearchPoint &sp);
+
   void Project(const FlatProjection &tp);
 
   gcc_pure
@@ -216,21 +216,54 @@ ParseExtensionValueN(const char *p, const char *end, size_t n,
     value_r = value;
 }
 
+/**
+ * Parse a fixed-width altitude column: digits, optionally with a
+ * leading minus sign.
+ *
+ * @return the value, or false on error
+ */
+static bool
+ParseAltitude(const char *p, int &value_r)
+{
+  static constexpr size_t width = 5;
+
+  if (*p == '-') {
+    const int value = ParseUnsigned(p + 1, p + width);
+    if (value < 0)
+      return false;
+
+    value_r = -value;
+  } else {
+    const int value = ParseUnsigned(p, p + width);
+    if (value < 0)
+      return false;
+
+    value_r = value;
+  }
+
+  return true;
+}
+
 bool
 IGCParseFix(const char *buffer, const IGCExtensions &extensions, IGCFix &fix)
 {
   if (*buffer != 'B')
     return false;
 
+  /* the mandatory columns, up to and including the GPS altitude */
+  const size_t line_length = strlen(buffer);
+  if (line_length < 35)
+    return false;
+
   BrokenTime time;
   if (!IGCParseTime(buffer + 1, time))
     return false;
 
-  char valid_char;
+  const char valid_char = buffer[24];
   int gps_altitude, pressure_altitude;
 
-  if (sscanf(buffer + 24, "%c%05d%05d",
-             &valid_char, &pressure_altitude, &gps_altitude) != 3)
+  if (!ParseAltitude(buffer + 25, pressure_altitude) ||
+      !ParseAltitude(buffer + 30, gps_altitude))
     return false;
 
   if (valid_char == 'A')
@@ -250,7 +283,6 @@ IGCParseFix(const char *buffer, const IGCExtensions &extensions, IGCFix &fix)
 
   fix.ClearExtensions();
 
-  const size_t line_length = strlen(buffer);
   for (auto i = extensions.begin(), end = extensions.end(); i != end; ++i) {
     const IGCExtension &extension = *i;
     assert(extension.start > 0);
@@ -291,16 +323,30 @@ IGCParseFix(const char *buffer, const IGCExtensions &extensions, IGCFix &fix)
 bool
 IGCParseLocation(const char *buffer, GeoPoint &location)
 {
-  unsigned lat_degrees, lat_minutes, lon_degrees, lon_minutes;
-  char lat_char, lon_char;
+  /* fixed-width columns: DDMMmmmN DDDMMmmmE */
+  const int lat_degrees = ParseTwoDigits(buffer);
+  if (lat_degrees < 0)
+    return false;
+
+  const int lat_minutes = ParseUnsigned(buffer + 2, buffer + 7);
+  if (lat_minutes < 0)
+    return false;
 
-  if (sscanf(buffer, "%02u%05u%c%03u%05u%c",
-             &lat_degrees, &lat_minutes, &lat_char,
-             &lon_degrees, &lon_minutes, &lon_char) != 6)
+  const char lat_char = buffer[7];
+  if (lat_char != 'N' && lat_char != 'S')
     return false;
 
-  if (lat_degrees >= 90 || lat_minutes >= 60000 ||
-      (lat_char != 'N' && lat_char != 'S'))
+  const int lon_degrees = ParseUnsigned(buffer + 8, buffer + 11);
+  if (lon_degrees < 0)
+    return false;
+
+  const int lon_minutes = ParseUnsigned(buffer + 11, buffer + 16);
+  if (lon_minutes < 0)
+    return false;
+
+  const char lon_char = buffer[16];
+
+  if (lat_degrees >= 90 || lat_minutes >= 60000)
     return false;
 
   if (lon_degrees >= 180 || lon_minutes >= 60000 ||
@@ -323,9 +369,16 @@ IGCParseLocation(const char *buffer, GeoPoint &location)
 bool
 IGCParseTime(const char *buffer, BrokenTime &time)
 {
-  unsigned hour, minute, second;
+  const int hour = ParseTwoDigits(buffer);
+  if (hour < 0)
+    return false;
+
+  const int minute = ParseTwoDigits(buffer + 2);
+  if (minute < 0)
+    return false;
 
-  if (sscanf(buffer, "%02u%02u%02u", &hour, &minute, &second) != 3)
+  const int second = ParseTwoDigits(buffer + 4);
+  if (second < 0)
     return false;
 
   time = BrokenTime(hour, minute, second);
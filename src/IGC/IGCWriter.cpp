@@ -26,16 +26,11 @@ Copyright_License {
 #include "Generator.hpp"
 #include "NMEA/Info.hpp"
 #include "Version.hpp"
-#include "OS/Path.hpp"
 
 #include <assert.h>
 
-IGCWriter::IGCWriter(Path path)
-  :file(path,
-        /* we use CREATE_VISIBLE here so the user can recover partial
-           IGC files after a crash/battery failure/etc. */
-        FileOutputStream::Mode::CREATE_VISIBLE),
-   buffered(file)
+IGCWriter::IGCWriter(OutputStream &os)
+  :buffered(os)
 {
   fix.Clear();
 
@@ -26,12 +26,11 @@ Copyright_License {
 
 #include "Logger/GRecord.hpp"
 #include "IGCFix.hpp"
-#include "IO/FileOutputStream.hxx"
 #include "IO/BufferedOutputStream.hxx"
 
 #include <tchar.h>
 
-class Path;
+class OutputStream;
 struct GPSState;
 struct BrokenDateTime;
 struct NMEAInfo;
@@ -42,7 +41,6 @@ class IGCWriter {
     MAX_IGC_BUFF = 255,
   };
 
-  FileOutputStream file;
   BufferedOutputStream buffered;
 
   GRecord grecord;
@@ -53,9 +51,11 @@ class IGCWriter {
 
 public:
   /**
-   * Create a new IGC file.  The caller must check IsOpen().
+   * Write a new IGC file to the given #OutputStream.  The caller is
+   * responsible for opening the file and for closing it after the
+   * last Flush().
    */
-  explicit IGCWriter(Path path);
+  explicit IGCWriter(OutputStream &os);
 
   void Flush() {
     buffered.Flush();
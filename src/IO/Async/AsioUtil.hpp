@@ -85,4 +85,37 @@ CancelWait(T &t)
   CancelWait(t.get_io_service(), t);
 }
 
+/**
+ * After an asynchronous receive has completed, append the data which
+ * is already queued in the socket, without blocking.  This batches a
+ * burst of packets into one handler call.  Data (or a datagram)
+ * which doesn't fit into the rest of the buffer is left for the next
+ * receive.
+ *
+ * @param nbytes the number of bytes already in the buffer
+ * @return the new number of bytes in the buffer
+ */
+template<typename S>
+size_t
+ReceiveAvailable(S &socket, char *buffer, size_t size, size_t nbytes)
+{
+  boost::system::error_code ec;
+
+  while (nbytes < size) {
+    const size_t available = socket.available(ec);
+    if (ec || available == 0 || available > size - nbytes)
+      break;
+
+    const size_t n = socket.receive(boost::asio::buffer(buffer + nbytes,
+                                                        size - nbytes),
+                                    0, ec);
+    if (ec || n == 0)
+      break;
+
+    nbytes += n;
+  }
+
+  return nbytes;
+}
+
 #endif
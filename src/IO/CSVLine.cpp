@@ -28,6 +28,7 @@ Copyright_License {
 
 #include <assert.h>
 #include <stdlib.h>
+#include <string.h>
 
 static const char *
 EndOfLine(const char *line)
@@ -41,8 +42,8 @@ CSVLine::CSVLine(const char *line):
 size_t
 CSVLine::Skip()
 {
-  const char* _seperator = strchr(data, ',');
-  if (_seperator != nullptr && _seperator < end) {
+  const char *_seperator = (const char *)memchr(data, ',', end - data);
+  if (_seperator != nullptr) {
     size_t length = _seperator - data;
     data = _seperator + 1;
     return length;
@@ -35,6 +35,13 @@ class CSVLine {
 protected:
   const char *data, *end;
 
+  /**
+   * Construct an instance for a line whose end is already known,
+   * which saves the strlen() call.
+   */
+  CSVLine(const char *line, const char *_end)
+    :data(line), end(_end) {}
+
 public:
   CSVLine(const char *line);
 
@@ -35,13 +35,11 @@ class FileCache {
 public:
   FileCache(AllocatedPath &&_cache_path);
 
-protected:
   gcc_pure
   AllocatedPath MakeCachePath(const TCHAR *name) const {
     return AllocatedPath::Build(cache_path, name);
   }
 
-public:
   void Flush(const TCHAR *name);
   FILE *Load(const TCHAR *name, Path original_path);
 
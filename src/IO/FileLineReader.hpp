@@ -51,6 +51,18 @@ public:
     buffered.Reset();
   }
 
+  /**
+   * Move to the given byte offset.  This is usually not at the start
+   * of a line, and the next ReadLine() returns the remainder of the
+   * current line.
+   *
+   * Throws std::runtime_errror on error.
+   */
+  void Seek(uint64_t offset) {
+    file.Seek(offset);
+    buffered.Reset();
+  }
+
 public:
   /* virtual methods from class NLineReader */
   char *ReadLine() override;
@@ -24,15 +24,30 @@ Copyright_License {
 #include "ZipArchive.hpp"
 #include "OS/ConvertPathName.hpp"
 
-#include <zzip/zzip.h>
+#include <zzip/lib.h>
 
 #include <stdexcept>
 
+#include <string.h>
+
 ZipArchive::ZipArchive(Path path)
   :dir(zzip_dir_open(NarrowPathName(path), nullptr))
 {
   if (dir == nullptr)
     throw std::runtime_error(std::string("Failed to open ZIP archive ") + (const char *)NarrowPathName(path));
+
+  /* walk the central directory directly instead of using
+     zzip_dir_read(), which would move the cursor used by
+     NextName() */
+  for (const struct zzip_dir_hdr *hdr = dir->hdr0; hdr != nullptr;
+       hdr = hdr->d_reclen != 0
+         ? (const struct zzip_dir_hdr *)((const char *)hdr + hdr->d_reclen)
+         : nullptr)
+    names.push_back(hdr->d_name);
+
+  std::sort(names.begin(), names.end(), [](const char *a, const char *b){
+      return strcmp(a, b) < 0;
+    });
 }
 
 ZipArchive::~ZipArchive()
@@ -44,8 +59,10 @@ ZipArchive::~ZipArchive()
 bool
 ZipArchive::Exists(const char *name) const
 {
-  ZZIP_STAT st;
-  return zzip_dir_stat(dir, name, &st, 0) == 0;
+  return std::binary_search(names.begin(), names.end(), name,
+                            [](const char *a, const char *b){
+                              return strcmp(a, b) < 0;
+                            });
 }
 
 std::string
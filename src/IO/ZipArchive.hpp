@@ -28,6 +28,7 @@ Copyright_License {
 
 #include <algorithm>
 #include <string>
+#include <vector>
 #include <cstddef>
 
 class Path;
@@ -35,10 +36,21 @@ class Path;
 /**
  * A handle to z ZIP archive file.  It is a OO wrapper for struct
  * zzip_dir.
+ *
+ * zziplib keeps the parsed central directory in memory, but looks up
+ * names with a linear search.  This class builds a sorted index of
+ * all names once when the archive is opened, which makes Exists()
+ * cheap even on archives with thousands of members.
  */
 class ZipArchive {
   struct zzip_dir *dir = nullptr;
 
+  /**
+   * All member names, sorted with strcmp().  The pointers refer to
+   * the central directory owned by #dir.
+   */
+  std::vector<const char *> names;
+
 public:
   /**
    * Open a ZIP archive.  Throws std::runtime_error on error.
@@ -46,12 +58,14 @@ public:
   explicit ZipArchive(Path path);
   ~ZipArchive();
 
-  ZipArchive(ZipArchive &&src):dir(src.dir) {
+  ZipArchive(ZipArchive &&src)
+    :dir(src.dir), names(std::move(src.names)) {
     src.dir = nullptr;
   }
 
   ZipArchive &operator=(ZipArchive &&src) {
     std::swap(dir, src.dir);
+    std::swap(names, src.names);
     return *this;
   }
 
@@ -59,6 +73,10 @@ public:
     return dir;
   }
 
+  /**
+   * Does the archive contain a member with the given name?  The
+   * comparison is case sensitive.
+   */
   gcc_pure
   bool Exists(const char *name) const;
 
@@ -30,6 +30,8 @@ Copyright_License {
 #include "Language/Language.hpp"
 #include "UIGlobals.hpp"
 #include "Look/Look.hpp"
+#include "Math/Util.hpp"
+#include "Util/Clamp.hpp"
 
 #include <tchar.h>
 
@@ -165,5 +167,14 @@ InfoBoxContentHorizon::Update(InfoBoxData &data)
     return;
   }
 
-  data.SetCustom();
+  /* repaint only if the horizon moves by at least one degree */
+  const auto &attitude = CommonInterface::Basic().attitude;
+  const int bank = attitude.IsBankAngleUseable()
+    ? Clamp(iround(attitude.bank_angle.Degrees()), -90, 90)
+    : 0;
+  const int pitch = attitude.IsPitchAngleUseable()
+    ? Clamp(iround(attitude.pitch_angle.Degrees()), -90, 90)
+    : 0;
+  data.SetCustom(1 + CommonInterface::Basic().acceleration.available +
+                 2 * ((bank + 90) + 181 * (pitch + 90)));
 }
@@ -37,6 +37,7 @@ Copyright_License {
 #include "Renderer/NextArrowRenderer.hpp"
 #include "UIGlobals.hpp"
 #include "Look/Look.hpp"
+#include "Math/Util.hpp"
 
 #include <tchar.h>
 
@@ -906,9 +907,12 @@ InfoBoxContentNextArrow::Update(InfoBoxData &data)
     data.SetTitle(way_point->name.c_str());
 
   // Set value
-  if (angle_valid)
-    data.SetCustom(); // Enables OnCustomPaint
-  else
+  if (angle_valid) {
+    /* enables OnCustomPaint(); repaint only if the arrow turns by
+       at least one degree */
+    const Angle bd = vector_remaining.bearing - basic.track;
+    data.SetCustom(1 + uround(bd.AsBearing().Degrees()) % 360);
+  } else
     data.SetInvalid();
 
   // Set comment
@@ -244,10 +244,10 @@ InfoBoxContentThermalAssistant::Update(InfoBoxData &data)
     return;
   }
 
-  data.SetCustom();
-
   renderer.Update(CommonInterface::Basic().attitude,
                   CommonInterface::Calculated());
+
+  data.SetCustom(renderer.GetSerial());
 }
 
 void
@@ -192,7 +192,14 @@ InfoBoxContentWindArrow::Update(InfoBoxData &data)
     return;
   }
 
-  data.SetCustom();
+  /* repaint only if the arrow changes visibly; see OnCustomPaint() */
+  const auto angle = info.wind.bearing -
+    CommonInterface::Basic().attitude.heading;
+  const unsigned length = std::min(uround(4 * info.wind.norm), 0xffffu);
+  const unsigned style =
+    (unsigned)CommonInterface::GetMapSettings().wind_arrow_style;
+  data.SetCustom(1 + uround(angle.AsBearing().Degrees()) % 360 +
+                 360 * (length + 0x10000 * style));
 
   TCHAR speed_buffer[16];
   FormatUserWindSpeed(info.wind.norm, speed_buffer, true, false);
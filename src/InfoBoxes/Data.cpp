@@ -34,6 +34,7 @@ void
 InfoBoxData::SetInvalid()
 {
   SetAllColors(0);
+  custom_key = 0;
   SetValueInvalid();
   SetValueUnit(Unit::UNDEFINED);
   SetCommentInvalid();
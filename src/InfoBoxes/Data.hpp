@@ -26,6 +26,7 @@ Copyright_License {
 
 #include "Util/StaticString.hxx"
 #include "Units/Unit.hpp"
+#include "Compiler.h"
 
 #include <tchar.h>
 
@@ -42,21 +43,53 @@ struct InfoBoxData {
 
   uint8_t title_color, value_color, comment_color;
 
+  /**
+   * Describes the input of InfoBoxContent::OnCustomPaint(), see
+   * SetCustom(unsigned).  0 means unknown.
+   */
+  unsigned custom_key;
+
   void Clear();
 
   /**
    * Enable custom painting via InfoBoxContent::OnCustomPaint().
    */
   void SetCustom() {
+    SetCustom(0);
+  }
+
+  /**
+   * Enable custom painting via InfoBoxContent::OnCustomPaint(), and
+   * declare what it depends on.  If the key did not change since the
+   * last update, the custom area is not repainted.
+   *
+   * @param key a value derived from all input of OnCustomPaint()
+   * (e.g. an angle rounded to what is visible); 0 means unknown,
+   * i.e. always repaint
+   */
+  void SetCustom(unsigned key) {
     /* 0xff is a "magic" value that indicates custom painting*/
     value_color = 0xff;
     value.clear();
+    custom_key = key;
   }
 
   bool GetCustom() const {
     return value_color == 0xff;
   }
 
+  /**
+   * Does the custom painted area look the same as in the other
+   * object?
+   */
+  gcc_pure
+  bool CompareCustom(const InfoBoxData &other) const {
+    return GetCustom() && other.GetCustom() &&
+      custom_key != 0 && custom_key == other.custom_key &&
+      /* the custom area grows if there's no comment */
+      comment.empty() == other.comment.empty();
+  }
+
   /**
    * Resets value to --- and unassigns the unit
    */
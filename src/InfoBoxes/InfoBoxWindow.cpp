@@ -251,9 +251,10 @@ InfoBoxWindow::UpdateContent()
   InfoBoxData old = data;
   content->Update(data);
 
-  if (old.GetCustom() || data.GetCustom())
+  if ((old.GetCustom() || data.GetCustom()) && !data.CompareCustom(old))
     /* must Invalidate everything when custom painting is/was
-       enabled */
+       enabled, unless the content declared that its input did not
+       change */
     Invalidate();
   else {
 #ifdef ENABLE_OPENGL
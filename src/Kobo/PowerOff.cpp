@@ -92,10 +92,18 @@ DrawBanner(Canvas &canvas, PixelRect &rc)
   rc.top += banner_height + 8;
 }
 
+/**
+ * Only this many bytes at the end of flights.log are parsed.  A
+ * flight takes two lines of about 27 bytes each, so this covers far
+ * more flights than fit on the screen.
+ */
+static constexpr uint64_t FLIGHT_LOG_TAIL = 16 * 1024;
+
 static void
 DrawFlights(Canvas &canvas, const PixelRect &rc)
 try {
   FileLineReaderA file(Path("/mnt/onboard/XCSoarData/flights.log"));
+  SkipToFlightLogTail(file, FLIGHT_LOG_TAIL);
 
   FlightListRenderer renderer(normal_font, bold_font);
 
@@ -27,7 +27,8 @@ Copyright_License {
 #include <string.h>
 
 MOFile::MOFile(const void *_data, size_t _size)
-  :data((const uint8_t *)_data), size(_size), count(0) {
+  :data((const uint8_t *)_data), size(_size), count(0),
+   hash_table(nullptr), hash_table_size(0), sorted(true) {
   const struct mo_header *header = (const struct mo_header *)_data;
   if (size < sizeof(*header))
     return;
@@ -52,6 +53,9 @@ MOFile::MOFile(const void *_data, size_t _size)
     strings[i].original = get_string(entry++);
     if (strings[i].original == NULL)
       return;
+
+    if (i > 0 && strcmp(strings[i - 1].original, strings[i].original) > 0)
+      sorted = false;
   }
 
   entry = (const struct mo_table_entry *)(const void *)
@@ -63,6 +67,84 @@ MOFile::MOFile(const void *_data, size_t _size)
   }
 
   count = n;
+
+  /* the hash table is optional; the lookup algorithm requires at
+     least three slots */
+  const unsigned hash_size = import_uint32(header->hash_table_size);
+  const unsigned hash_offset = import_uint32(header->hash_table_offset);
+  if (hash_size > 2 && hash_size < 0x1000000 && hash_offset % 4 == 0 &&
+      hash_offset <= size && (size - hash_offset) / 4 >= hash_size) {
+    hash_table = (const uint32_t *)(const void *)(data + hash_offset);
+    hash_table_size = hash_size;
+  }
+}
+
+/**
+ * The string hash function of GNU gettext ("hashpjw"), which was used
+ * to build the hash table.
+ */
+gcc_pure
+static uint32_t
+HashString(const char *p)
+{
+  uint32_t hash = 0;
+  for (; *p != 0; ++p) {
+    hash = (hash << 4) + (uint8_t)*p;
+    const uint32_t g = hash & 0xf0000000;
+    if (g != 0) {
+      hash ^= g >> 24;
+      hash ^= g;
+    }
+  }
+
+  return hash;
+}
+
+const char *
+MOFile::LookupHash(const char *p) const
+{
+  assert(hash_table != nullptr);
+
+  /* open addressing with double hashing, as in GNU gettext */
+  const uint32_t hash = HashString(p);
+  unsigned i = hash % hash_table_size;
+  const unsigned increment = 1 + hash % (hash_table_size - 2);
+
+  for (unsigned n = 0; n < hash_table_size; ++n) {
+    const uint32_t entry = import_uint32(hash_table[i]);
+    if (entry == 0)
+      /* empty slot: not found */
+      return nullptr;
+
+    if (entry <= count && strcmp(strings[entry - 1].original, p) == 0)
+      return strings[entry - 1].translation;
+
+    if (i >= hash_table_size - increment)
+      i -= hash_table_size - increment;
+    else
+      i += increment;
+  }
+
+  return nullptr;
+}
+
+const char *
+MOFile::LookupSorted(const char *p) const
+{
+  unsigned left = 0, right = count;
+  while (left < right) {
+    const unsigned middle = (left + right) / 2;
+    const int cmp = strcmp(strings[middle].original, p);
+    if (cmp == 0)
+      return strings[middle].translation;
+
+    if (cmp < 0)
+      left = middle + 1;
+    else
+      right = middle;
+  }
+
+  return nullptr;
 }
 
 const char *
@@ -70,6 +152,12 @@ MOFile::lookup(const char *p) const
 {
   assert(p != NULL);
 
+  if (hash_table != nullptr)
+    return LookupHash(p);
+
+  if (sorted)
+    return LookupSorted(p);
+
   for (unsigned i = 0; i < count; ++i)
     if (strcmp(strings[i].original, p) == 0)
       return strings[i].translation;
@@ -25,6 +25,7 @@ Copyright_License {
 #define XCSOAR_MO_FILE_HPP
 
 #include "Util/AllocatedArray.hxx"
+#include "Compiler.h"
 
 #include <stdint.h>
 
@@ -57,6 +58,19 @@ class MOFile {
   unsigned count;
   AllocatedArray<string_pair> strings;
 
+  /**
+   * The hash table of the file (in file byte order), or nullptr if
+   * the file doesn't have a usable one.  Each non-zero entry is one
+   * plus the index of an original string.
+   */
+  const uint32_t *hash_table;
+  unsigned hash_table_size;
+
+  /**
+   * Are the original strings sorted, as they should be?
+   */
+  bool sorted;
+
 public:
   MOFile(const void *data, size_t size);
 
@@ -64,9 +78,22 @@ public:
     return count == 0;
   }
 
+  gcc_pure
   const char *lookup(const char *p) const;
 
 private:
+  /**
+   * Look up the string in the hash table.
+   */
+  gcc_pure
+  const char *LookupHash(const char *p) const;
+
+  /**
+   * Look up the string with a binary search.  Requires #sorted.
+   */
+  gcc_pure
+  const char *LookupSorted(const char *p) const;
+
   uint32_t import_uint32(uint32_t x) const {
     return native_byte_order
       ? x
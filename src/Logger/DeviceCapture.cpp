@@ -0,0 +1,151 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#include "DeviceCapture.hpp"
+#include "LoggerWriteThread.hpp"
+#include "IO/FileOutputStream.hxx"
+#include "LocalPath.hpp"
+#include "LogFile.hpp"
+#include "Time/BrokenDateTime.hpp"
+#include "Thread/Mutex.hpp"
+#include "OS/ByteOrder.hpp"
+#include "OS/Clock.hpp"
+#include "OS/Path.hpp"
+#include "Util/StaticString.hxx"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <string.h>
+
+namespace DeviceCapture
+{
+  /**
+   * The maximum amount of data waiting for the writer thread.  Raw
+   * device data may arrive at a much higher rate than NMEA lines, so
+   * this is larger than the NMEA logger's limit.
+   */
+  static constexpr size_t MAX_QUEUE = 1024 * 1024;
+
+  static Mutex mutex;
+  static FileOutputStream *file;
+  static LoggerWriteThread *write_thread;
+
+  /**
+   * The MonotonicClockMS() value when the capture was started.
+   */
+  static unsigned start_time;
+
+  bool enabled = false;
+
+  static bool Start();
+}
+
+bool
+DeviceCapture::Start()
+{
+  if (write_thread != nullptr)
+    return true;
+
+  BrokenDateTime dt = BrokenDateTime::NowUTC();
+  assert(dt.IsPlausible());
+
+  StaticString<64> name;
+  name.Format(_T("%04u-%02u-%02u_%02u-%02u.xcap"),
+              dt.year, dt.month, dt.day,
+              dt.hour, dt.minute);
+
+  const auto logs_path = MakeLocalPath(_T("logs"));
+
+  const auto path = AllocatedPath::Build(logs_path, name);
+
+  try {
+    file = new FileOutputStream(path,
+                                FileOutputStream::Mode::CREATE_VISIBLE);
+  } catch (const std::runtime_error &e) {
+    enabled = false;
+    LogError(e);
+    return false;
+  }
+
+  write_thread = new LoggerWriteThread(*file, MAX_QUEUE);
+  write_thread->Write(MAGIC, sizeof(MAGIC) - 1);
+  start_time = MonotonicClockMS();
+  return true;
+}
+
+void
+DeviceCapture::Shutdown()
+{
+  ScopeLock protect(mutex);
+
+  if (write_thread == nullptr)
+    return;
+
+  write_thread->Finish();
+
+  const unsigned n_dropped = write_thread->GetDropped();
+  if (n_dropped > 0)
+    LogFormat("Device capture dropped %u records", n_dropped);
+
+  delete write_thread;
+  write_thread = nullptr;
+
+  delete file;
+  file = nullptr;
+}
+
+void
+DeviceCapture::Log(unsigned device, const void *data, size_t length)
+{
+  if (!enabled)
+    return;
+
+  ScopeLock protect(mutex);
+  if (!Start())
+    return;
+
+  const uint32_t time = MonotonicClockMS() - start_time;
+  const uint8_t *p = (const uint8_t *)data;
+
+  /* each record is queued with a single Write() call, so it is
+     either logged or dropped as a whole, and the file never
+     contains a truncated record */
+  while (length > 0) {
+    uint8_t buffer[sizeof(RecordHeader) + 1024];
+    const size_t chunk = std::min(length, sizeof(buffer) - sizeof(RecordHeader));
+
+    RecordHeader header;
+    header.time = ToLE32(time);
+    header.device = device;
+    header.reserved = 0;
+    header.length = ToLE16(chunk);
+
+    memcpy(buffer, &header, sizeof(header));
+    memcpy(buffer + sizeof(header), p, chunk);
+    write_thread->Write(buffer, sizeof(header) + chunk);
+
+    p += chunk;
+    length -= chunk;
+  }
+}
@@ -0,0 +1,76 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#ifndef XCSOAR_DEVICE_CAPTURE_HPP
+#define XCSOAR_DEVICE_CAPTURE_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Records the raw bytes received by all devices, with monotonic
+ * timestamps, so a flight can be replayed through the drivers
+ * exactly as it was received (see test/src/ReplayCapture.cpp).
+ *
+ * The file starts with #MAGIC, followed by a sequence of records,
+ * each consisting of a #RecordHeader and "length" payload bytes.
+ * All integers are little-endian.
+ */
+namespace DeviceCapture
+{
+  static constexpr char MAGIC[] = "XCSOAR-CAPTURE 1\n";
+
+  struct RecordHeader {
+    /**
+     * Milliseconds since the capture was started.
+     */
+    uint32_t time;
+
+    /**
+     * The index of the #DeviceDescriptor which received the data.
+     */
+    uint8_t device;
+
+    uint8_t reserved;
+
+    /**
+     * The number of payload bytes following this header.
+     */
+    uint16_t length;
+  };
+
+  static_assert(sizeof(RecordHeader) == 8, "Wrong RecordHeader size");
+
+  extern bool enabled;
+
+  void Shutdown();
+
+  /**
+   * Append a chunk of raw data received by the specified device.
+   * This method is thread-safe; it may be called from any device
+   * I/O thread.
+   */
+  void Log(unsigned device, const void *data, size_t length);
+}
+
+#endif
@@ -43,6 +43,13 @@
 #include "IGC/IGCHeader.hpp"
 #include "Formatter/IGCFilenameFormatter.hpp"
 #include "Time/BrokenDate.hpp"
+#include "Thread/Thread.hpp"
+#include "Thread/Mutex.hpp"
+#include "Thread/Cond.hxx"
+#include "Util/StaticString.hxx"
+
+#include <memory>
+#include <vector>
 
 class DeclareJob {
   DeviceDescriptor &device;
@@ -113,23 +120,253 @@ DeviceDeclare(DeviceDescriptor &dev, const Declaration &declaration,
   gcc_unreachable();
 }
 
+/**
+ * Declares the task to one of several devices in a separate thread.
+ * Each device has its own port, so all of them can be declared at
+ * the same time instead of one after the other.
+ */
+class DeclareThread final : public Thread, OperationEnvironment {
+  DeclareJob job;
+
+  OperationEnvironment &parent;
+
+  /**
+   * Protects #done; shared with the other threads of the same
+   * #MultipleDeclareJob.
+   */
+  Mutex &mutex;
+
+  /**
+   * Broadcast when #done is set.
+   */
+  Cond &cond;
+
+  bool done = false;
+
+  TriStateJobResult result = TriStateJobResult::ERROR;
+
+public:
+  DeclareThread(DeviceDescriptor &_device,
+                const struct Declaration &declaration,
+                const Waypoint *home,
+                OperationEnvironment &_parent,
+                Mutex &_mutex, Cond &_cond)
+    :Thread("Declare"), job(_device, declaration, home),
+     parent(_parent), mutex(_mutex), cond(_cond) {}
+
+  /**
+   * Caller must lock the mutex.
+   */
+  bool IsDone() const {
+    return done;
+  }
+
+  TriStateJobResult GetResult() const {
+    return result;
+  }
+
+  /**
+   * Mark this thread as finished without having started it.
+   */
+  void SetFailed() {
+    const ScopeLock protect(mutex);
+    done = true;
+    cond.broadcast();
+  }
+
+protected:
+  /* virtual methods from class Thread */
+  void Run() override {
+    const TriStateJobResult _result = job.Run(*this)
+      ? TriStateJobResult::SUCCESS
+      : (parent.IsCancelled()
+         ? TriStateJobResult::CANCELLED
+         : TriStateJobResult::ERROR);
+
+    const ScopeLock protect(mutex);
+    result = _result;
+    done = true;
+    cond.broadcast();
+  }
+
+private:
+  /* virtual methods from class OperationEnvironment; the progress
+     of a single device is not shown, the parent only displays which
+     devices are still busy */
+  bool IsCancelled() const override {
+    return parent.IsCancelled();
+  }
+
+  void Sleep(unsigned ms) override {
+    parent.Sleep(ms);
+  }
+
+  void SetErrorMessage(const TCHAR *text) override {}
+  void SetText(const TCHAR *text) override {}
+  void SetProgressRange(unsigned range) override {}
+  void SetProgressPosition(unsigned position) override {}
+};
+
+/**
+ * Declares the task to several devices in parallel.
+ */
+class MultipleDeclareJob {
+  const std::vector<DeviceDescriptor *> &devices;
+  const struct Declaration &declaration;
+  const Waypoint *home;
+
+  std::vector<TriStateJobResult> results;
+
+public:
+  MultipleDeclareJob(const std::vector<DeviceDescriptor *> &_devices,
+                     const struct Declaration &_declaration,
+                     const Waypoint *_home)
+    :devices(_devices), declaration(_declaration), home(_home),
+     results(_devices.size(), TriStateJobResult::ERROR) {}
+
+  TriStateJobResult GetDeviceResult(unsigned i) const {
+    return results[i];
+  }
+
+  bool Run(OperationEnvironment &env) {
+    Mutex mutex;
+    Cond cond;
+
+    std::vector<std::unique_ptr<DeclareThread>> threads;
+    threads.reserve(devices.size());
+    for (DeviceDescriptor *device : devices)
+      threads.emplace_back(new DeclareThread(*device, declaration, home,
+                                             env, mutex, cond));
+
+    for (auto &thread : threads)
+      if (!thread->Start())
+        thread->SetFailed();
+
+    env.SetProgressRange(threads.size());
+
+    {
+      const ScopeLock protect(mutex);
+      while (true) {
+        /* show the devices which are still being declared */
+        StaticString<128> text;
+        text.clear();
+        unsigned n_done = 0;
+        for (unsigned i = 0; i < threads.size(); ++i) {
+          if (threads[i]->IsDone()) {
+            ++n_done;
+            continue;
+          }
+
+          const TCHAR *name = devices[i]->GetDisplayName();
+          if (name == nullptr)
+            continue;
+
+          if (!text.empty())
+            text.append(_T(", "));
+          text.append(name);
+        }
+
+        env.SetProgressPosition(n_done);
+
+        if (n_done == threads.size())
+          break;
+
+        env.SetText(text);
+        cond.wait(mutex);
+      }
+    }
+
+    bool result = false;
+    for (unsigned i = 0; i < threads.size(); ++i) {
+      if (threads[i]->IsDefined())
+        threads[i]->Join();
+
+      results[i] = threads[i]->GetResult();
+      if (results[i] == TriStateJobResult::SUCCESS)
+        result = true;
+    }
+
+    return result;
+  }
+};
+
+static void
+DeviceDeclare(const std::vector<DeviceDescriptor *> &devices,
+              const Declaration &declaration, const Waypoint *home)
+{
+  if (ShowMessageBox(_("Declare task?"), _("Declare task"),
+                     MB_YESNO | MB_ICONQUESTION) != IDYES)
+    return;
+
+  std::vector<DeviceDescriptor *> borrowed;
+  for (DeviceDescriptor *device : devices)
+    if (device->Borrow())
+      borrowed.push_back(device);
+
+  if (borrowed.empty())
+    return;
+
+  TriStateJob<MultipleDeclareJob> job(borrowed, declaration, home);
+
+  bool finished;
+  try {
+    finished = JobDialog(UIGlobals::GetMainWindow(),
+                         UIGlobals::GetDialogLook(),
+                         _("Declare task"), job, true);
+  } catch (const std::runtime_error &e) {
+    LogError(e);
+    finished = false;
+  }
+
+  for (DeviceDescriptor *device : borrowed)
+    device->Return();
+
+  if (!finished || job.GetResult() == TriStateJobResult::CANCELLED)
+    return;
+
+  /* report the result of each device in one message box */
+  StaticString<512> message;
+  message.clear();
+  for (unsigned i = 0; i < borrowed.size(); ++i) {
+    const TCHAR *name = borrowed[i]->GetDisplayName();
+    if (name == nullptr)
+      name = _("Unknown");
+
+    message.AppendFormat(_T("%s: %s\n"), name,
+                         job.GetDeviceResult(i) == TriStateJobResult::SUCCESS
+                         ? _("Task declared!")
+                         : _("Task NOT declared!"));
+  }
+
+  ShowMessageBox(message, _("Declare task"),
+                 job.GetResult() == TriStateJobResult::SUCCESS
+                 ? MB_OK | MB_ICONINFORMATION
+                 : MB_OK | MB_ICONERROR);
+}
+
 void
 ExternalLogger::Declare(const Declaration &decl, const Waypoint *home)
 {
   bool found_logger = false;
+  std::vector<DeviceDescriptor *> loggers;
 
   for (DeviceDescriptor *i : *devices) {
     DeviceDescriptor &device = *i;
 
     if (device.CanDeclare() && device.GetState() == PortState::READY) {
       found_logger = true;
-      DeviceDeclare(device, decl, home);
+      if (!device.IsOccupied())
+        loggers.push_back(&device);
     }
   }
 
   if (!found_logger)
     ShowMessageBox(_("No logger connected"),
                 _("Declare task"), MB_OK | MB_ICONINFORMATION);
+  else if (loggers.size() == 1)
+    DeviceDeclare(*loggers.front(), decl, home);
+  else if (loggers.size() > 1)
+    DeviceDeclare(loggers, decl, home);
 }
 
 class ReadFlightListJob {
@@ -22,7 +22,7 @@ Copyright_License {
 */
 
 #include "FlightParser.hpp"
-#include "IO/LineReader.hpp"
+#include "IO/FileLineReader.hpp"
 #include "FlightInfo.hpp"
 #include "Time/BrokenDateTime.hpp"
 #include "Util/StringAPI.hxx"
@@ -111,3 +111,16 @@ FlightParser::ReadLine(BrokenDateTime &dt)
 
   return nullptr;
 }
+
+void
+SkipToFlightLogTail(FileLineReaderA &file, uint64_t max_size)
+{
+  const uint64_t size = file.GetSize();
+  if (size <= max_size)
+    return;
+
+  file.Seek(size - max_size);
+
+  /* discard the partial line */
+  file.ReadLine();
+}
@@ -24,9 +24,12 @@ Copyright_License {
 #ifndef XCSOAR_FLIGHT_PARSER_HPP
 #define XCSOAR_FLIGHT_PARSER_HPP
 
+#include <stdint.h>
+
 struct FlightInfo;
 struct BrokenDateTime;
 class NLineReader;
+class FileLineReaderA;
 
 /**
  * A parser for files generated by #FlightLogger.
@@ -51,4 +54,16 @@ private:
   char *ReadLine(BrokenDateTime &dt);
 };
 
+/**
+ * Skip all but the last @a max_size bytes of the flight log, for
+ * callers which need only the most recent flights.  The partial line
+ * at the new position is skipped as well.  The first flight parsed
+ * after this may lack its start time, because its "start" line was
+ * skipped.
+ *
+ * Throws std::runtime_errror on error.
+ */
+void
+SkipToFlightLogTail(FileLineReaderA &file, uint64_t max_size);
+
 #endif
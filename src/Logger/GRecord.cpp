@@ -43,13 +43,18 @@ static constexpr MD5::State g_key[GRecord::N_MD5] = {
   { 0xc8e899e8,0x9321c28a,0x438eba12,0x8cbe0aee },
 };
 
+static_assert(GRecord::N_MD5 == MD5x4State::N, "Wrong number of keys");
+
 void
 GRecord::Initialize()
 {
   ignore_comma = true;
 
+  MD5x4State state;
   for (unsigned i = 0; i < N_MD5; ++i)
-    md5[i].Initialise(g_key[i]);
+    state.Set(i, g_key[i]);
+
+  md5.Initialise(state);
 }
 
 bool
@@ -72,37 +77,48 @@ GRecord::AppendRecordToBuffer(const char *in)
  * it's a valid IGC character
  */
 static void
-AppendIGCString(MD5 &md5, const char *s, bool ignore_comma)
+AppendIGCString(MD5x4 &md5, const char *s, bool ignore_comma)
 {
+  /* filter into a small buffer and append it in blocks, instead of
+     feeding the digests one character at a time */
+  char buffer[256];
+  char *p = buffer;
+
   while (*s != '\0') {
     const char ch = *s++;
     if (ignore_comma && ch == ',')
       continue;
 
-    if (IsValidIGCChar(ch))
-      md5.Append(ch);
+    if (IsValidIGCChar(ch)) {
+      *p++ = ch;
+
+      if (p == buffer + sizeof(buffer)) {
+        md5.Append(buffer, p - buffer);
+        p = buffer;
+      }
+    }
   }
+
+  md5.Append(buffer, p - buffer);
 }
 
 void
 GRecord::AppendStringToBuffer(const char *in)
 {
-  for (auto &i : md5)
-    AppendIGCString(i, in, ignore_comma);
+  AppendIGCString(md5, in, ignore_comma);
 }
 
 void
 GRecord::FinalizeBuffer()
 {
-  for (auto &i : md5)
-    i.Finalize();
+  md5.Finalize();
 }
 
 void
 GRecord::GetDigest(char *output) const
 {
-  for (auto &i : md5)
-    output = i.GetDigest(output);
+  for (unsigned i = 0; i < N_MD5; ++i)
+    output = MD5::GetDigest(md5.GetState().Get(i), output);
 }
 
 bool
@@ -169,23 +185,35 @@ GRecord::AppendGRecordToFile(Path path)
   file.Commit();
 }
 
+/**
+ * Append the digest characters of one G record line to the buffer.
+ *
+ * Throws std::runtime_errror if the buffer is full.
+ */
+static void
+AppendGRecordLine(const char *data, char *output, size_t &digest_length,
+                  size_t max_length)
+{
+  for (const char *p = data + 1; *p != '\0'; ++p) {
+    output[digest_length++] = *p;
+    if (digest_length >= max_length)
+      throw std::runtime_error("G record too large");
+  }
+}
+
 void
 GRecord::ReadGRecordFromFile(Path path,
                              char *output, size_t max_length)
 {
   FileLineReaderA reader(path);
 
-  unsigned int digest_length = 0;
+  size_t digest_length = 0;
   char *data;
   while ((data = reader.ReadLine()) != nullptr) {
     if (data[0] != 'G')
       continue;
 
-    for (const char *p = data + 1; *p != '\0'; ++p) {
-      output[digest_length++] = *p;
-      if (digest_length >= max_length)
-        throw std::runtime_error("G record too large");
-    }
+    AppendGRecordLine(data, output, digest_length, max_length);
   }
 
   output[digest_length] = '\0';
@@ -194,13 +222,25 @@ GRecord::ReadGRecordFromFile(Path path,
 void
 GRecord::VerifyGRecordInFile(Path path)
 {
-  // assumes FileName member is set
-  // Load File into Buffer (assume name is already set)
-  LoadFileToBuffer(path);
-
-  // load Existing Digest "old"
+  /* read the file only once: the G record lines are collected, and
+     all others are fed into the digest */
   char old_g_record[DIGEST_LENGTH + 1];
-  ReadGRecordFromFile(path, old_g_record, ARRAY_SIZE(old_g_record));
+  size_t old_length = 0;
+
+  {
+    FileLineReaderA reader(path);
+
+    char *line;
+    while ((line = reader.ReadLine()) != nullptr) {
+      if (line[0] == 'G')
+        AppendGRecordLine(line, old_g_record, old_length,
+                          ARRAY_SIZE(old_g_record));
+      else
+        AppendRecordToBuffer(line);
+    }
+  }
+
+  old_g_record[old_length] = '\0';
 
   // recalculate digest from buffer
   FinalizeBuffer();
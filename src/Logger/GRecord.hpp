@@ -37,7 +37,12 @@ public:
   static constexpr size_t DIGEST_LENGTH = N_MD5 * MD5::DIGEST_LENGTH;
 
 private:
-  MD5 md5[N_MD5];
+  /**
+   * All #N_MD5 digests are calculated over the same data, only with
+   * different keys, so they share one buffer and are advanced
+   * together.
+   */
+  MD5x4 md5;
 
   /**
    * If true, then the comma is ignored in the MD5 calculation, even
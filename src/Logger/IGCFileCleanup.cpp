@@ -22,12 +22,14 @@
 */
 
 #include "IGCFileCleanup.hpp"
-#include "Util/StaticString.hxx"
 #include "LocalPath.hpp"
 #include "OS/FileUtil.hpp"
 #include "OS/Path.hpp"
 #include "UtilsSystem.hpp"
 
+#include <algorithm>
+#include <vector>
+
 #include <tchar.h>
 #include <time.h>
 #include <windef.h>
@@ -107,71 +109,59 @@ LogFileDate(unsigned current_year, const TCHAR *filename)
   return 0;
 }
 
-class OldIGCFileFinder: public File::Visitor
+/**
+ * Collects all IGC files with their dates, so the directory needs to
+ * be scanned only once, no matter how many files have to be deleted.
+ */
+class IGCFileCollector: public File::Visitor
 {
   unsigned current_year;
-  time_t oldest_time;
-  StaticString<MAX_PATH> oldest_path;
 
 public:
-  OldIGCFileFinder(unsigned _current_year):current_year(_current_year) {
-    oldest_path.clear();
-  }
+  typedef std::pair<time_t, AllocatedPath> Item;
+  std::vector<Item> files;
+
+  IGCFileCollector(unsigned _current_year):current_year(_current_year) {}
 
   void Visit(Path path, Path filename) override {
-    time_t this_time = LogFileDate(current_year, filename.c_str());
-    if (oldest_path.empty() || oldest_time > this_time) {
-      oldest_time = this_time;
-      oldest_path = path.c_str();
-    }
+    files.emplace_back(LogFileDate(current_year, filename.c_str()), path);
   }
 
-  Path GetOldestIGCFile() const {
-    return Path(oldest_path.c_str());
+  /**
+   * Sort the files, oldest first; files with the same date remain in
+   * the order they were found.
+   */
+  void Sort() {
+    std::stable_sort(files.begin(), files.end(),
+                     [](const Item &a, const Item &b){
+                       return a.first < b.first;
+                     });
   }
 };
 
-/**
- * Delete eldest IGC file in the given path
- * @param gps_info Current NMEA_INFO
- * @param pathname Path where to search for the IGC files
- * @return True if a file was found and deleted, False otherwise
- */
-static bool
-DeleteOldestIGCFile(unsigned current_year, Path pathname)
-{
-  OldIGCFileFinder visitor(current_year);
-  Directory::VisitSpecificFiles(pathname, _T("*.igc"), visitor, true);
-
-  if (visitor.GetOldestIGCFile().IsEmpty())
-    return false;
-
-  // now, delete the file...
-  File::Delete(visitor.GetOldestIGCFile());
-  return true;
-}
-
 bool
 IGCFileCleanup(unsigned current_year)
 {
   const auto pathname = GetPrimaryDataPath();
 
-  int numtries = 0;
-  do {
-    // Find out how much space is available
-    unsigned long kbfree = FindFreeSpace(pathname.c_str());
-    if (kbfree >= LOGGER_MINFREESTORAGE) {
-      // if enough space is available we return happily
-      return true;
-    }
+  // Find out how much space is available
+  if (FindFreeSpace(pathname.c_str()) >= LOGGER_MINFREESTORAGE)
+    // if enough space is available we return happily
+    return true;
+
+  // if we don't have enough space yet we try to delete old IGC files
+  IGCFileCollector collector(current_year);
+  Directory::VisitSpecificFiles(pathname, _T("*.igc"), collector, true);
+  collector.Sort();
 
-    // if we don't have enough space yet we try to delete old IGC files
-    if (!DeleteOldestIGCFile(current_year, pathname))
-      break;
+  // but only 100 of them
+  const unsigned max_delete = std::min<size_t>(collector.files.size(), 100);
+  for (unsigned i = 0; i < max_delete; ++i) {
+    File::Delete(collector.files[i].second);
 
-    // but only 100 times
-    numtries++;
-  } while (numtries < 100);
+    if (FindFreeSpace(pathname.c_str()) >= LOGGER_MINFREESTORAGE)
+      return true;
+  }
 
   // if we get to this point we don't have any IGC files left or deleted
   // 100 old IGC files already
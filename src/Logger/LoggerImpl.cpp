@@ -23,6 +23,7 @@
 
 #include "Logger/LoggerImpl.hpp"
 #include "Logger/Settings.hpp"
+#include "LoggerWriteThread.hpp"
 #include "LogFile.hpp"
 #include "LocalPath.hpp"
 #include "Device/Declaration.hpp"
@@ -34,6 +35,7 @@
 #include "Util/CharUtil.hpp"
 #include "IGCFileCleanup.hpp"
 #include "IGC/IGCWriter.hpp"
+#include "IO/FileOutputStream.hxx"
 
 #include <tchar.h>
 #include <algorithm>
@@ -77,13 +79,15 @@ LoggerImpl::PreTakeoffBuffer::operator=(const NMEAInfo &src)
 }
 
 LoggerImpl::LoggerImpl()
-  :filename(nullptr), writer(nullptr)
+  :filename(nullptr), file(nullptr), write_thread(nullptr), writer(nullptr)
 {
 }
 
 LoggerImpl::~LoggerImpl()
 {
   delete writer;
+  delete write_thread;
+  delete file;
 }
 
 void
@@ -99,12 +103,17 @@ LoggerImpl::StopLogger(const NMEAInfo &gps_info)
     writer->Sign();
 
   writer->Flush();
+  write_thread->Finish();
 
   LogFormat(_T("Logger stopped: %s"), filename.c_str());
 
   // Logger off
   delete writer;
   writer = nullptr;
+  delete write_thread;
+  write_thread = nullptr;
+  delete file;
+  file = nullptr;
 
   // Make space for logger file, if unsuccessful -> cancel
   if (gps_info.gps.real && gps_info.date_time_utc.IsDatePlausible())
@@ -253,12 +262,19 @@ LoggerImpl::StartLogger(const NMEAInfo &gps_info,
   frecord.Reset();
 
   try {
-    writer = new IGCWriter(filename);
+    file = new FileOutputStream(filename,
+                                /* we use CREATE_VISIBLE here so the
+                                   user can recover partial IGC files
+                                   after a crash/battery failure/etc. */
+                                FileOutputStream::Mode::CREATE_VISIBLE);
   } catch (const std::runtime_error &e) {
     LogError(e);
     return false;
   }
 
+  write_thread = new LoggerWriteThread(*file);
+  writer = new IGCWriter(*write_thread);
+
   LogFormat(_T("Logger Started: %s"), filename.c_str());
   return true;
 }
@@ -35,6 +35,8 @@ Copyright_License {
 struct NMEAInfo;
 struct LoggerSettings;
 struct Declaration;
+class FileOutputStream;
+class LoggerWriteThread;
 class IGCWriter;
 
 /**
@@ -92,6 +94,15 @@ public:
 
 private:
   AllocatedPath filename;
+
+  FileOutputStream *file;
+
+  /**
+   * Writes the IGC records to #file in background, so a slow
+   * storage device does not block the calculation thread.
+   */
+  LoggerWriteThread *write_thread;
+
   IGCWriter *writer;
 
   OverwritingRingBuffer<PreTakeoffBuffer, PRETAKEOFF_BUFFER_MAX> pre_takeoff_buffer;
@@ -0,0 +1,86 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#include "LoggerWriteThread.hpp"
+#include "LogFile.hpp"
+
+#include <exception>
+
+LoggerWriteThread::LoggerWriteThread(OutputStream &_next,
+                                     size_t _max_queue)
+  :StandbyThread("LoggerWrite"), next(_next), max_queue(_max_queue) {}
+
+LoggerWriteThread::~LoggerWriteThread()
+{
+  LockStop();
+}
+
+void
+LoggerWriteThread::Write(const void *data, size_t size)
+{
+  const char *p = (const char *)data;
+
+  const ScopeLock protect(mutex);
+  if (max_queue > 0 && queue.size() + size > max_queue) {
+    ++n_dropped;
+    return;
+  }
+
+  queue.insert(queue.end(), p, p + size);
+  Trigger();
+}
+
+void
+LoggerWriteThread::Finish()
+{
+  const ScopeLock protect(mutex);
+  WaitDone();
+  Stop();
+}
+
+unsigned
+LoggerWriteThread::GetDropped() const
+{
+  const ScopeLock protect(const_cast<Mutex &>(mutex));
+  return n_dropped;
+}
+
+void
+LoggerWriteThread::Tick()
+{
+  while (!queue.empty()) {
+    writing.swap(queue);
+
+    {
+      const ScopeUnlock unlock(mutex);
+
+      try {
+        next.Write(writing.data(), writing.size());
+      } catch (const std::exception &e) {
+        LogError("Failed to write IGC file", e);
+      }
+    }
+
+    writing.clear();
+  }
+}
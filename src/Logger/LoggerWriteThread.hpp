@@ -0,0 +1,104 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#ifndef XCSOAR_LOGGER_WRITE_THREAD_HPP
+#define XCSOAR_LOGGER_WRITE_THREAD_HPP
+
+#include "Thread/StandbyThread.hpp"
+#include "IO/OutputStream.hxx"
+
+#include <vector>
+
+/**
+ * An #OutputStream which forwards all data to another #OutputStream
+ * in a background thread.  This keeps slow storage (e.g. SD cards)
+ * from blocking the calculation thread while the logger writes.
+ *
+ * Write() only copies the data into a queue and wakes up the
+ * thread, which then writes everything that was queued so far.  It
+ * is meant to be used behind a #BufferedOutputStream, which calls
+ * Write() only when it gets flushed.  Write errors are logged by the
+ * thread, and the affected data is discarded.
+ *
+ * Optionally, the queue size can be limited; if the storage cannot
+ * keep up, Write() then discards data instead of growing the queue.
+ */
+class LoggerWriteThread final : public OutputStream, private StandbyThread {
+  OutputStream &next;
+
+  /**
+   * Data which was passed to Write(), but has not been picked up by
+   * the thread yet.  Protected by #mutex.
+   */
+  std::vector<char> queue;
+
+  /**
+   * The buffer being written by the thread.  Its capacity is kept
+   * between flushes, so the steady state does not allocate.  Only
+   * accessed by the thread.
+   */
+  std::vector<char> writing;
+
+  /**
+   * The maximum number of bytes in #queue; 0 means unlimited.
+   */
+  const size_t max_queue;
+
+  /**
+   * The number of Write() calls whose data was discarded because
+   * the queue was full.  Protected by #mutex.
+   */
+  unsigned n_dropped = 0;
+
+public:
+  explicit LoggerWriteThread(OutputStream &_next, size_t _max_queue=0);
+
+  /**
+   * Stops the thread.  Data which has not been written yet may be
+   * lost; call Finish() before destroying this object.
+   */
+  ~LoggerWriteThread();
+
+  /**
+   * Wait until all queued data has been written and stop the
+   * thread.  After returning, the #OutputStream passed to the
+   * constructor may be closed.
+   */
+  void Finish();
+
+  /**
+   * Returns the number of Write() calls whose data was discarded
+   * because the queue was full.
+   */
+  gcc_pure
+  unsigned GetDropped() const;
+
+  /* virtual methods from class OutputStream */
+  void Write(const void *data, size_t size) override;
+
+private:
+  /* virtual methods from class StandbyThread */
+  void Tick() override;
+};
+
+#endif
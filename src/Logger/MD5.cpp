@@ -26,6 +26,7 @@
 
 #include <algorithm>
 #include <stdio.h>
+#include <string.h>
 
 static constexpr uint32_t k[64] = {
   // k[i] := floor(abs(sin(i)) * (2 pow 32))
@@ -103,24 +104,114 @@ static constexpr uint32_t r[64] = {
   6, 10, 15, 21,  6, 10, 15, 21,  6, 10, 15, 21,  6, 10, 15, 21,
 };
 
-static constexpr MD5::State md5_start = {
+static constexpr MD5State md5_start = {
   0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476
 };
 
-static inline uint32_t
-leftrotate(uint32_t x, uint32_t c)
+template<typename T>
+static inline T
+leftrotate(T x, uint32_t c)
 {
     return (x << c) | (x >> (32 - c));
 }
 
+/**
+ * The MD5 compression function.  #T may be uint32_t for one digest,
+ * or a vector type holding one word of several digests of the same
+ * block; all operations are lane-wise.
+ */
+template<typename T>
+static inline void
+MD5Rounds(T &state_a, T &state_b, T &state_c, T &state_d,
+          const uint32_t *w)
+{
+  // Initialize hash value for this chunk:
+  T a = state_a, b = state_b, c = state_c, d = state_d;
+
+  // Main loop:
+  for (int i = 0; i < 64; i++) {
+    T f;
+    unsigned g;
+    if (i <= 15) {
+      f = (b & c) | ((~b) & d);
+      g = i;
+    } else if (i <= 31) {
+      f = (d & b) | ((~d) & c);
+      g = (5 * i + 1) % 16;
+    } else if (i <= 47) {
+      f = b ^ c ^ d;
+      g = (3 * i + 5) % 16;
+    } else {
+      f = c ^ (b | (~d));
+      g = (7 * i) % 16;
+    }
+
+    T temp = d;
+    d = c;
+    c = b;
+    b += leftrotate<T>(a + f + k[i] + w[g], r[i]);
+    a = temp;
+  }
+
+  // Add this chunk's hash to result so far:
+  state_a += a;
+  state_b += b;
+  state_c += c;
+  state_d += d;
+}
+
+void
+MD5State::Process512(const uint32_t *w)
+{
+  MD5Rounds(a, b, c, d, w);
+}
+
+/**
+ * Four 32 bit lanes; GCC and clang map this to SSE2/NEON registers,
+ * or to plain integer operations on CPUs without a vector unit.
+ */
+typedef uint32_t MD5Vector __attribute__((vector_size(16)));
+
+static_assert(sizeof(MD5Vector) == sizeof(MD5x4State::a),
+              "Wrong vector size");
+
+static inline MD5Vector
+LoadVector(const uint32_t *src)
+{
+  MD5Vector v;
+  memcpy(&v, src, sizeof(v));
+  return v;
+}
+
+static inline void
+StoreVector(uint32_t *dest, MD5Vector v)
+{
+  memcpy(dest, &v, sizeof(v));
+}
+
+void
+MD5x4State::Process512(const uint32_t *w)
+{
+  MD5Vector va = LoadVector(a), vb = LoadVector(b),
+    vc = LoadVector(c), vd = LoadVector(d);
+
+  MD5Rounds(va, vb, vc, vd, w);
+
+  StoreVector(a, va);
+  StoreVector(b, vb);
+  StoreVector(c, vc);
+  StoreVector(d, vd);
+}
+
 void
 MD5::Initialise()
 {
   Initialise(md5_start);
 }
 
+template<typename S>
 void
-MD5::Append(uint8_t ch)
+BasicMD5<S>::Append(uint8_t ch)
 {
   unsigned position = unsigned(message_length++) % ARRAY_SIZE(buff512bits);
   buff512bits[position++] = ch;
@@ -128,13 +219,28 @@ MD5::Append(uint8_t ch)
     Process512(buff512bits);
 }
 
+template<typename S>
 void
-MD5::Append(const void *data, size_t length)
+BasicMD5<S>::Append(const void *data, size_t length)
 {
-  const uint8_t *i = (const uint8_t *)data, *const end = i + length;
-
-  while (i != end)
-    Append(*i++);
+  const uint8_t *i = (const uint8_t *)data;
+
+  unsigned position = unsigned(message_length) % ARRAY_SIZE(buff512bits);
+  message_length += length;
+
+  while (length > 0) {
+    const size_t n = std::min(length,
+                              size_t(ARRAY_SIZE(buff512bits) - position));
+    std::copy_n(i, n, buff512bits + position);
+    i += n;
+    length -= n;
+    position += n;
+
+    if (position == ARRAY_SIZE(buff512bits)) {
+      Process512(buff512bits);
+      position = 0;
+    }
+  }
 }
 
 /**
@@ -146,8 +252,9 @@ WriteLE64(void *p, uint64_t value)
   *(uint64_t *)p = ToLE64(value);
 }
 
+template<typename S>
 void
-MD5::Finalize()
+BasicMD5<S>::Finalize()
 {
   // append "0" bits until message length in bits ? 448 (mod 512)
   int buffer_left_over = message_length % 64;
@@ -189,8 +296,9 @@ MD5::Finalize()
   Process512(buff512bits);
 }
 
+template<typename S>
 void
-MD5::Process512(const uint8_t *s512in)
+BasicMD5<S>::Process512(const uint8_t *s512in)
 {
   // assume exactly 512 bits
 
@@ -200,42 +308,14 @@ MD5::Process512(const uint8_t *s512in)
   for (int j = 0; j < 16; j++)
     w[j] = ToLE32(s512_32[j]);
 
-  // Initialize hash value for this chunk:
-  uint32_t a = state.a, b = state.b, c = state.c, d = state.d;
-
-  // Main loop:
-  for (int i = 0; i < 64; i++) {
-    uint32_t f, g;
-    if (i <= 15) {
-      f = (b & c) | ((~b) & d);
-      g = i;
-    } else if (i <= 31) {
-      f = (d & b) | ((~d) & c);
-      g = (5 * i + 1) % 16;
-    } else if (i <= 47) {
-      f = b ^ c ^ d;
-      g = (3 * i + 5) % 16;
-    } else {
-      f = c ^ (b | (~d));
-      g = (7 * i) % 16;
-    }
-
-    uint32_t temp = d;
-    d = c;
-    c = b;
-    b += leftrotate((a + f + k[i] + w[g]), r[i]);
-    a = temp;
-  }
-
-  // Add this chunk's hash to result so far:
-  state.a += a;
-  state.b += b;
-  state.c += c;
-  state.d += d;
+  state.Process512(w);
 }
 
+template class BasicMD5<MD5State>;
+template class BasicMD5<MD5x4State>;
+
 char *
-MD5::GetDigest(char *buffer) const
+MD5::GetDigest(const State &state, char *buffer)
 {
   sprintf(buffer, "%08x%08x%08x%08x",
           ByteSwap32(state.a), ByteSwap32(state.b), ByteSwap32(state.c), ByteSwap32(state.d));
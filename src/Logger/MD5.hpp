@@ -26,14 +26,52 @@
 #include <stdint.h>
 #include <stddef.h>
 
-class MD5
+/**
+ * The state of one MD5 calculation.
+ */
+struct MD5State {
+  uint32_t a, b, c, d;
+
+  /**
+   * Feed one 512 bit block (16 little-endian words) into the
+   * compression function.
+   */
+  void Process512(const uint32_t *w);
+};
+
+/**
+ * The state of four MD5 calculations over the same message, but with
+ * different initial states (keys).  The four of them are advanced in
+ * parallel, one per SIMD lane where the CPU has a vector unit.
+ */
+struct MD5x4State {
+  static constexpr unsigned N = 4;
+
+  uint32_t a[N], b[N], c[N], d[N];
+
+  void Set(unsigned i, const MD5State &src) {
+    a[i] = src.a;
+    b[i] = src.b;
+    c[i] = src.c;
+    d[i] = src.d;
+  }
+
+  MD5State Get(unsigned i) const {
+    return {a[i], b[i], c[i], d[i]};
+  }
+
+  void Process512(const uint32_t *w);
+};
+
+/**
+ * Splits a message into 512 bit blocks and applies the MD5 padding.
+ * The compression function is implemented by the #S state type.
+ */
+template<typename S>
+class BasicMD5
 {
 public:
-  static constexpr size_t DIGEST_LENGTH = 32;
-
-  struct State {
-    uint32_t a, b, c, d;
-  };
+  typedef S State;
 
 private:
   uint8_t buff512bits[64];
@@ -51,21 +89,43 @@ public:
     message_length = 0;
   }
 
-  /**
-   * Initialise with the default key.
-   */
-  void Initialise();
+  const State &GetState() const {
+    return state;
+  }
 
   void Append(uint8_t ch);
   void Append(const void *data, size_t length);
 
   void Finalize();
+};
+
+class MD5 : public BasicMD5<MD5State>
+{
+public:
+  static constexpr size_t DIGEST_LENGTH = 32;
+
+  using BasicMD5::Initialise;
+
+  /**
+   * Initialise with the default key.
+   */
+  void Initialise();
 
   /**
    * @param buffer a buffer of at least #DIGEST_LENGTH+1 bytes
    * @return a pointer to the null terminator
    */
-  char *GetDigest(char *buffer) const;
+  char *GetDigest(char *buffer) const {
+    return GetDigest(GetState(), buffer);
+  }
+
+  /**
+   * @param buffer a buffer of at least #DIGEST_LENGTH+1 bytes
+   * @return a pointer to the null terminator
+   */
+  static char *GetDigest(const State &state, char *buffer);
 };
 
+typedef BasicMD5<MD5x4State> MD5x4;
+
 #endif
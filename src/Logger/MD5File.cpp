@@ -0,0 +1,55 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#include "MD5File.hpp"
+#include "MD5.hpp"
+#include "OS/Path.hpp"
+
+#include <stdio.h>
+#include <tchar.h>
+
+bool
+ComputeFileMD5(Path path, char *digest)
+{
+  FILE *file = _tfopen(path.c_str(), _T("rb"));
+  if (file == nullptr)
+    return false;
+
+  MD5 md5;
+  md5.Initialise();
+
+  uint8_t buffer[16384];
+  size_t nbytes;
+  while ((nbytes = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    md5.Append(buffer, nbytes);
+
+  const bool success = !ferror(file);
+  fclose(file);
+
+  if (!success)
+    return false;
+
+  md5.Finalize();
+  md5.GetDigest(digest);
+  return true;
+}
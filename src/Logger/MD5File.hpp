@@ -0,0 +1,39 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#ifndef XCSOAR_MD5_FILE_HPP
+#define XCSOAR_MD5_FILE_HPP
+
+class Path;
+
+/**
+ * Calculate the MD5 digest of a file's contents.
+ *
+ * @param digest a buffer of at least MD5::DIGEST_LENGTH+1 bytes,
+ * receives the hex digest
+ * @return false if the file could not be read
+ */
+bool
+ComputeFileMD5(Path path, char *digest);
+
+#endif
@@ -22,17 +22,36 @@ Copyright_License {
 */
 
 #include "Logger/NMEALogger.hpp"
-#include "IO/TextWriter.hpp"
+#include "LoggerWriteThread.hpp"
+#include "IO/FileOutputStream.hxx"
 #include "LocalPath.hpp"
+#include "LogFile.hpp"
 #include "Time/BrokenDateTime.hpp"
 #include "Thread/Mutex.hpp"
 #include "OS/Path.hpp"
 #include "Util/StaticString.hxx"
 
+#include <stdexcept>
+
+#include <string.h>
+
 namespace NMEALogger
 {
+  /**
+   * The maximum amount of data waiting for the writer thread.  If
+   * the storage cannot keep up, more lines are discarded instead of
+   * filling up the memory.
+   */
+  static constexpr size_t MAX_QUEUE = 256 * 1024;
+
   static Mutex mutex;
-  static TextWriter *writer;
+  static FileOutputStream *file;
+
+  /**
+   * Writes the lines to #file in background, so a slow storage device
+   * does not delay the device I/O threads which call Log().
+   */
+  static LoggerWriteThread *write_thread;
 
   bool enabled = false;
 
@@ -42,7 +61,7 @@ namespace NMEALogger
 bool
 NMEALogger::Start()
 {
-  if (writer != nullptr)
+  if (write_thread != nullptr)
     return true;
 
   BrokenDateTime dt = BrokenDateTime::NowUTC();
@@ -56,23 +75,37 @@ NMEALogger::Start()
   const auto logs_path = MakeLocalPath(_T("logs"));
 
   const auto path = AllocatedPath::Build(logs_path, name);
-  writer = new TextWriter(path, false);
-  if (writer == nullptr)
-    return false;
 
-  if (!writer->IsOpen()) {
-    delete writer;
-    writer = nullptr;
+  try {
+    file = new FileOutputStream(path,
+                                FileOutputStream::Mode::CREATE_VISIBLE);
+  } catch (const std::runtime_error &e) {
     return false;
   }
 
+  write_thread = new LoggerWriteThread(*file, MAX_QUEUE);
   return true;
 }
 
 void
 NMEALogger::Shutdown()
 {
-  delete writer;
+  ScopeLock protect(mutex);
+
+  if (write_thread == nullptr)
+    return;
+
+  write_thread->Finish();
+
+  const unsigned n_dropped = write_thread->GetDropped();
+  if (n_dropped > 0)
+    LogFormat("NMEA logger dropped %u lines", n_dropped);
+
+  delete write_thread;
+  write_thread = nullptr;
+
+  delete file;
+  file = nullptr;
 }
 
 void
@@ -81,7 +114,28 @@ NMEALogger::Log(const char *text)
   if (!enabled)
     return;
 
+#ifdef HAVE_POSIX
+  static constexpr char newline[] = "\n";
+#else
+  static constexpr char newline[] = "\r\n";
+#endif
+
   ScopeLock protect(mutex);
-  if (Start())
-    writer->WriteLine(text);
+  if (!Start())
+    return;
+
+  const size_t length = strlen(text);
+
+  /* append the line ending in a stack buffer, so the line is queued
+     with a single Write() call and is either logged or dropped as a
+     whole */
+  char buffer[256];
+  if (length + sizeof(newline) <= sizeof(buffer)) {
+    memcpy(buffer, text, length);
+    memcpy(buffer + length, newline, sizeof(newline) - 1);
+    write_thread->Write(buffer, length + sizeof(newline) - 1);
+  } else {
+    write_thread->Write(text, length);
+    write_thread->Write(newline, sizeof(newline) - 1);
+  }
 }
@@ -25,8 +25,18 @@ Copyright_License {
 #include "Geo.hpp"
 #include "Util.hpp"
 #include "Util/StringAPI.hxx"
+#include "Util/Macros.hpp"
 #include "Interface.hpp"
 
+extern "C" {
+#include <lauxlib.h>
+}
+
+#include <algorithm>
+#include <iterator>
+
+#include <string.h>
+
 namespace Lua {
 
 template<typename V>
@@ -39,59 +49,148 @@ static void PushOptional(lua_State *L, bool available, V &&value) {
 
 }
 
+/**
+ * One attribute of "xcsoar.blackboard".
+ */
+struct BlackboardField {
+  const char *name;
+
+  /**
+   * Push the value (or nil if it is not available).
+   */
+  void (*push)(lua_State *L, const MoreData &basic);
+};
+
+/**
+ * All attributes, sorted by name for LookupField().
+ */
+static const BlackboardField blackboard_fields[] = {
+  { "air_speed", [](lua_State *L, const MoreData &basic){
+      Lua::PushOptional(L, basic.airspeed_available, basic.true_airspeed);
+    } },
+  { "altitude", [](lua_State *L, const MoreData &basic){
+      Lua::PushOptional(L, basic.NavAltitudeAvailable(), basic.nav_altitude);
+    } },
+  { "bank_angle", [](lua_State *L, const MoreData &basic){
+      Lua::PushOptional(L, basic.attitude.IsBankAngleUseable(),
+                      basic.attitude.bank_angle);
+    } },
+  { "battery_level", [](lua_State *L, const MoreData &basic){
+      Lua::PushOptional(L, basic.battery_level_available, basic.battery_level);
+    } },
+  { "dynamic_pressure", [](lua_State *L, const MoreData &basic){
+      Lua::PushOptional(L, basic.dyn_pressure_available,
+                      basic.dyn_pressure.GetPascal());
+    } },
+  { "g_load", [](lua_State *L, const MoreData &basic){
+      Lua::PushOptional(L, basic.acceleration.available, basic.acceleration.g_load);
+    } },
+  { "ground_speed", [](lua_State *L, const MoreData &basic){
+      Lua::PushOptional(L, basic.ground_speed_available, basic.ground_speed);
+    } },
+  { "heading", [](lua_State *L, const MoreData &basic){
+      Lua::PushOptional(L, basic.attitude.IsHeadingUseable(),
+                      basic.attitude.heading);
+    } },
+  { "humidity", [](lua_State *L, const MoreData &basic){
+      Lua::PushOptional(L, basic.humidity_available, basic.humidity);
+    } },
+  { "location", [](lua_State *L, const MoreData &basic){
+      Lua::PushOptional(L, basic.location_available, basic.location);
+    } },
+  { "netto_vario", [](lua_State *L, const MoreData &basic){
+      Lua::PushOptional(L, basic.netto_vario_available, basic.netto_vario);
+    } },
+  { "noncomp_vario", [](lua_State *L, const MoreData &basic){
+      Lua::PushOptional(L, basic.noncomp_vario_available, basic.noncomp_vario);
+    } },
+  { "pitch_angle", [](lua_State *L, const MoreData &basic){
+      Lua::PushOptional(L, basic.attitude.IsPitchAngleUseable(),
+                      basic.attitude.pitch_angle);
+    } },
+  { "pitot_pressure", [](lua_State *L, const MoreData &basic){
+      Lua::PushOptional(L, basic.pitot_pressure_available,
+                      basic.pitot_pressure.GetPascal());
+    } },
+  { "static_pressure", [](lua_State *L, const MoreData &basic){
+      Lua::PushOptional(L, basic.static_pressure_available,
+                      basic.static_pressure.GetPascal());
+    } },
+  { "temperature", [](lua_State *L, const MoreData &basic){
+      Lua::PushOptional(L, basic.temperature_available,
+                      basic.temperature.ToKelvin());
+    } },
+  { "total_energy_vario", [](lua_State *L, const MoreData &basic){
+      Lua::PushOptional(L, basic.total_energy_vario_available,
+                      basic.total_energy_vario);
+    } },
+  { "track", [](lua_State *L, const MoreData &basic){
+      Lua::PushOptional(L, basic.track_available, basic.track);
+    } },
+  { "voltage", [](lua_State *L, const MoreData &basic){
+      Lua::PushOptional(L, basic.voltage_available, basic.voltage);
+    } },
+};
+
+gcc_pure
+static const BlackboardField *
+LookupField(const char *name)
+{
+  const auto end = std::end(blackboard_fields);
+  const auto i = std::lower_bound(std::begin(blackboard_fields), end, name,
+                                  [](const BlackboardField &f, const char *n){
+                                    return strcmp(f.name, n) < 0;
+                                  });
+  return i != end && StringIsEqual(i->name, name)
+    ? i
+    : nullptr;
+}
+
 static int
 l_blackboard_index(lua_State *L)
 {
-  const auto &basic = CommonInterface::Basic();
-
   const char *name = lua_tostring(L, 2);
   if (name == nullptr)
     return 0;
-  else if (StringIsEqual(name, "location"))
-    Lua::PushOptional(L, basic.location_available, basic.location);
-  else if (StringIsEqual(name, "altitude"))
-    Lua::PushOptional(L, basic.NavAltitudeAvailable(), basic.nav_altitude);
-  else if (StringIsEqual(name, "track"))
-    Lua::PushOptional(L, basic.track_available, basic.track);
-  else if (StringIsEqual(name, "ground_speed"))
-    Lua::PushOptional(L, basic.ground_speed_available, basic.ground_speed);
-  else if (StringIsEqual(name, "air_speed"))
-    Lua::PushOptional(L, basic.airspeed_available, basic.true_airspeed);
-  else if (StringIsEqual(name, "bank_angle"))
-    Lua::PushOptional(L, basic.attitude.IsBankAngleUseable(), basic.attitude.bank_angle);
-  else if (StringIsEqual(name, "pitch_angle"))
-    Lua::PushOptional(L, basic.attitude.IsPitchAngleUseable(), basic.attitude.pitch_angle); 
-  else if (StringIsEqual(name, "heading"))
-    Lua::PushOptional(L, basic.attitude.IsHeadingUseable(), basic.attitude.heading);
-  else if (StringIsEqual(name, "g_load"))
-    Lua::PushOptional(L, basic.acceleration.available, basic.acceleration.g_load);
-  else if (StringIsEqual(name, "static_pressure"))
-    Lua::PushOptional(L, basic.static_pressure_available, basic.static_pressure.GetPascal());
-  else if (StringIsEqual(name, "pitot_pressure"))
-    Lua::PushOptional(L, basic.pitot_pressure_available, basic.pitot_pressure.GetPascal());
-  else if (StringIsEqual(name, "dynamic_pressure"))
-    Lua::PushOptional(L, basic.dyn_pressure_available, basic.dyn_pressure.GetPascal());
-  else if (StringIsEqual(name, "temperature"))
-    Lua::PushOptional(L, basic.temperature_available,
-                      basic.temperature.ToKelvin());
-  else if (StringIsEqual(name, "humidity"))
-    Lua::PushOptional(L, basic.humidity_available, basic.humidity);
-  else if (StringIsEqual(name, "voltage"))
-    Lua::PushOptional(L, basic.voltage_available, basic.voltage);
-  else if (StringIsEqual(name, "battery_level"))
-    Lua::PushOptional(L, basic.battery_level_available, basic.battery_level);
-  else if (StringIsEqual(name, "noncomp_vario"))
-    Lua::PushOptional(L, basic.noncomp_vario_available, basic.noncomp_vario);
-  else if (StringIsEqual(name, "total_energy_vario"))
-    Lua::PushOptional(L, basic.total_energy_vario_available, basic.total_energy_vario);
-  else if (StringIsEqual(name, "netto_vario"))
-    Lua::PushOptional(L, basic.netto_vario_available, basic.netto_vario);
-  else
+
+  const auto *field = LookupField(name);
+  if (field == nullptr)
     return 0;
 
+  field->push(L, CommonInterface::Basic());
   return 1;
 }
 
+/**
+ * Returns a new table with all available attributes, for scripts
+ * which need many of them at once.
+ */
+static int
+l_blackboard_get_all(lua_State *L)
+{
+  if (lua_gettop(L) != 0)
+    return luaL_error(L, "Invalid parameters");
+
+  const auto &basic = CommonInterface::Basic();
+
+  lua_createtable(L, 0, ARRAY_SIZE(blackboard_fields));
+
+  for (const auto &field : blackboard_fields) {
+    field.push(L, basic);
+    if (lua_isnil(L, -1))
+      lua_pop(L, 1);
+    else
+      lua_setfield(L, -2, field.name);
+  }
+
+  return 1;
+}
+
+static constexpr struct luaL_Reg blackboard_funcs[] = {
+  {"get_all", l_blackboard_get_all},
+  {nullptr, nullptr}
+};
+
 void
 Lua::InitBlackboard(lua_State *L)
 {
@@ -103,6 +202,8 @@ Lua::InitBlackboard(lua_State *L)
   SetField(L, -2, "__index", l_blackboard_index);
   lua_setmetatable(L, -2);
 
+  luaL_setfuncs(L, blackboard_funcs, 0);
+
   lua_setfield(L, -2, "blackboard");
 
   lua_pop(L, 1);
@@ -0,0 +1,65 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#include "Budget.hpp"
+#include "Util.hpp"
+#include "Time/TimeoutClock.hpp"
+
+extern "C" {
+#include <lauxlib.h>
+}
+
+static constexpr char budget_key[] = "xcsoar.budget";
+
+/**
+ * Check the time budget after this number of VM instructions.
+ */
+static constexpr int BUDGET_CHECK_COUNT = 10000;
+
+static void
+BudgetHook(lua_State *L, lua_Debug *)
+{
+  const auto *clock = (const TimeoutClock *)
+    Lua::GetRegistryLightUserData(L, budget_key);
+  if (clock != nullptr && clock->HasExpired())
+    luaL_error(L, "Script exceeded its time budget");
+}
+
+int
+Lua::ProtectedCall(lua_State *L, int nargs, int nresults,
+                   unsigned max_duration_ms)
+{
+  if (GetRegistryLightUserData(L, budget_key) != nullptr)
+    /* nested call: the outer budget applies */
+    return lua_pcall(L, nargs, nresults, 0);
+
+  TimeoutClock clock(max_duration_ms);
+  SetRegistry(L, budget_key, LightUserData(&clock));
+  lua_sethook(L, BudgetHook, LUA_MASKCOUNT, BUDGET_CHECK_COUNT);
+
+  int result = lua_pcall(L, nargs, nresults, 0);
+
+  lua_sethook(L, nullptr, 0, 0);
+  SetRegistry(L, budget_key, nullptr);
+  return result;
+}
@@ -0,0 +1,52 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#ifndef XCSOAR_LUA_BUDGET_HPP
+#define XCSOAR_LUA_BUDGET_HPP
+
+struct lua_State;
+
+namespace Lua {
+
+/**
+ * The default run time limit for one callback [ms].
+ */
+static constexpr unsigned DEFAULT_BUDGET_MS = 1000;
+
+/**
+ * Like lua_pcall(), but raise a Lua error inside the called function
+ * if it runs longer than the given time budget.  This prevents a
+ * misbehaving script from freezing the user interface.
+ *
+ * If this is called recursively from inside a Lua function which
+ * already runs with a budget, the outer budget remains in effect.
+ *
+ * @return the lua_pcall() result code
+ */
+int
+ProtectedCall(lua_State *L, int nargs, int nresults,
+              unsigned max_duration_ms=DEFAULT_BUDGET_MS);
+
+}
+
+#endif
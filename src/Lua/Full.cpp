@@ -41,6 +41,7 @@ Copyright_License {
 #include "Wind.hpp"
 #include "Logger.hpp"
 #include "Tracking.hpp"
+#include "Timing.hpp"
 #include "Replay.hpp"
 #include "InputEvent.hpp"
 
@@ -62,6 +63,7 @@ Lua::NewFullState()
   InitWind(L);
   InitLogger(L);
   InitTracking(L);
+  InitTiming(L);
   InitReplay(L);
   InitInputEvent(L);
 
@@ -24,6 +24,7 @@ Copyright_License {
 #include "InputEvent.hpp"
 #include "Error.hpp"
 #include "Catch.hpp"
+#include "Budget.hpp"
 #include "Associate.hpp"
 #include "Persistent.hpp"
 #include "Input/InputQueue.hpp"
@@ -132,7 +133,7 @@ public:
     if (PushTable()) {
       lua_getfield(L, -1, "callback");
       lua_getfield(L, -2, "input_event");
-      if (lua_pcall(L, 1, 0, 0))
+      if (Lua::ProtectedCall(L, 1, 0))
         Lua::ThrowError(L, Lua::PopError(L));
 
       Lua::CheckPersistent(L);
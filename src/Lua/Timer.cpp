@@ -24,6 +24,7 @@ Copyright_License {
 #include "Timer.hpp"
 #include "Error.hpp"
 #include "Catch.hpp"
+#include "Budget.hpp"
 #include "Associate.hpp"
 #include "Persistent.hpp"
 #include "Event/Timer.hpp"
@@ -69,7 +70,7 @@ protected:
     if (PushTable()) {
       lua_getfield(L, -1, "callback");
       lua_getfield(L, -2, "timer");
-      if (lua_pcall(L, 1, 0, 0))
+      if (Lua::ProtectedCall(L, 1, 0))
         Lua::ThrowError(L, Lua::PopError(L));
 
       Lua::CheckPersistent(L);
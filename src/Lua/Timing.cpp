@@ -0,0 +1,71 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#include "Timing.hpp"
+#include "Util.hpp"
+#include "Computer/StageTimer.hpp"
+
+extern "C" {
+#include <lauxlib.h>
+}
+
+static double
+ToMilliseconds(unsigned us)
+{
+  return us / 1000.;
+}
+
+static int
+l_timing_index(lua_State *L)
+{
+  const char *name = lua_tostring(L, 2);
+  StageTimer::Stage stage;
+  if (name == nullptr || !StageTimer::FindByName(name, stage))
+    return 0;
+
+  const auto summary = StageTimer::GetSummary(stage);
+
+  lua_newtable(L);
+  SetField(L, -2, "count", double(summary.count));
+  SetField(L, -2, "last", ToMilliseconds(summary.last));
+  SetField(L, -2, "mean", ToMilliseconds(summary.mean));
+  SetField(L, -2, "p99", ToMilliseconds(summary.p99));
+  SetField(L, -2, "max", ToMilliseconds(summary.max));
+  return 1;
+}
+
+void
+Lua::InitTiming(lua_State *L)
+{
+  lua_getglobal(L, "xcsoar");
+
+  lua_newtable(L);
+
+  lua_newtable(L);
+  SetField(L, -2, "__index", l_timing_index);
+  lua_setmetatable(L, -2);
+
+  lua_setfield(L, -2, "timing");
+
+  lua_pop(L, 1);
+}
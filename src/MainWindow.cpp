@@ -657,6 +657,11 @@ MainWindow::OnTimer(WindowTimer &_timer)
 
   battery_timer.Process();
 
+#ifndef ENABLE_OPENGL
+  if (draw_thread != nullptr)
+    draw_thread->SetPowerSaving(BatteryTimer::IsPowerSaving());
+#endif
+
   return true;
 }
 
@@ -1027,4 +1032,14 @@ MainWindow::OnPause()
   SingleWindow::OnPause();
 }
 
+void
+MainWindow::OnLowMemory()
+{
+  /* the map renderers will rebuild their caches on the next
+     redraw */
+  FlushRendererCaches();
+
+  SingleWindow::OnLowMemory();
+}
+
 #endif /* ANDROID */
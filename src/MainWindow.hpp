@@ -363,6 +363,7 @@ protected:
 
 #ifdef ANDROID
   virtual void OnPause() override;
+  virtual void OnLowMemory() override;
 #endif
 };
 
@@ -130,13 +130,12 @@ GlueMapWindow::SetUIState(const UIState &new_value)
 void
 GlueMapWindow::ExchangeBlackboard()
 {
-  /* copy device_blackboard to MapWindow */
+  /* copy device_blackboard to MapWindow; the snapshots can be read
+     without locking, so the DrawThread doesn't compete with the
+     MergeThread and the CalculationThread for the mutex */
 
-  {
-    const ScopeLock lock(device_blackboard->mutex);
-    ReadBlackboard(device_blackboard->Basic(),
-                   device_blackboard->Calculated());
-  }
+  ReadBlackboard(device_blackboard->GetBasicSnapshot(),
+                 device_blackboard->GetCalculatedSnapshot());
 
 #ifndef ENABLE_OPENGL
   {
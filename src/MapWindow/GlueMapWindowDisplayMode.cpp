@@ -28,8 +28,18 @@ Copyright_License {
 #include "Interface.hpp"
 #include "Profile/Profile.hpp"
 #include "Screen/Layout.hpp"
+#include "Geo/GeoVector.hpp"
+#include "Geo/Math.hpp"
 #include "Util/Clamp.hpp"
 
+#include <algorithm>
+
+/**
+ * How far ahead (in seconds of flight at the current ground speed)
+ * shall terrain tiles be loaded in advance?
+ */
+static constexpr double TERRAIN_PREFETCH_TIME = 300;
+
 void
 OffsetHistory::Reset()
 {
@@ -108,6 +118,52 @@ GlueMapWindow::PanTo(const GeoPoint &location)
   FullRedraw();
 }
 
+static void
+AddPrefetchLine(TerrainThread::PrefetchList &list, unsigned max_size,
+                const GeoPoint &origin, Angle bearing,
+                double distance, double step)
+{
+  for (double d = step; d <= distance && list.size() < max_size; d += step)
+    list.append(FindLatitudeLongitude(origin, bearing, d));
+}
+
+/**
+ * Determine the locations which will probably become visible within
+ * the next few minutes: along the current track and along the active
+ * task leg.
+ */
+static void
+GetTerrainPrefetch(const MoreData &basic, const DerivedInfo &calculated,
+                   double radius, TerrainThread::PrefetchList &list)
+{
+  if (!basic.location_available || !basic.MovementDetected())
+    return;
+
+  const double range = basic.ground_speed * TERRAIN_PREFETCH_TIME;
+  if (range <= radius)
+    /* we won't leave the visible area soon */
+    return;
+
+  /* each location loads one screen radius around it, so that is the
+     step size; half of the list is reserved for the task leg */
+  const double step = std::max(radius, range / (list.capacity() / 2));
+
+  if (basic.track_available)
+    AddPrefetchLine(list, list.capacity() / 2,
+                    basic.location, basic.track, range, step);
+
+  const auto &target = calculated.task_stats.current_leg.location_remaining;
+  if (calculated.task_stats.task_valid && target.IsValid()) {
+    const GeoVector vector(basic.location, target);
+    AddPrefetchLine(list, list.capacity(),
+                    basic.location, vector.bearing,
+                    std::min(vector.distance, range), step);
+
+    if (vector.distance <= range && !list.full())
+      list.append(target);
+  }
+}
+
 void
 GlueMapWindow::UpdateScreenBounds()
 {
@@ -122,8 +178,16 @@ GlueMapWindow::UpdateScreenBounds()
      it's used by other calculations, therefore don't check if terrain
      display is enabled */
   if (terrain_thread != nullptr &&
-      visible_projection.IsValid())
-    terrain_thread->Trigger(visible_projection);
+      visible_projection.IsValid()) {
+    TerrainThread::PrefetchList prefetch;
+    GetTerrainPrefetch(CommonInterface::Basic(),
+                       CommonInterface::Calculated(),
+                       visible_projection.GetScreenWidthMeters() / 2,
+                       prefetch);
+
+    terrain_thread->Trigger(visible_projection,
+                            {prefetch.begin(), prefetch.size()});
+  }
 }
 
 void
@@ -33,6 +33,7 @@ Copyright_License {
 #include "Pan.hpp"
 #include "Util/Clamp.hpp"
 #include "Topography/Thread.hpp"
+#include "Computer/StageTimer.hpp"
 
 #ifdef USE_X11
 #include "Event/Globals.hpp"
@@ -401,6 +402,8 @@ GlueMapWindow::OnPaint(Canvas &canvas)
 void
 GlueMapWindow::OnPaintBuffer(Canvas &canvas)
 {
+  const ScopeStageTimer stage_timer(StageTimer::Stage::DRAW);
+
 #ifdef ENABLE_OPENGL
   ExchangeBlackboard();
 
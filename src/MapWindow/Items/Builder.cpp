@@ -50,6 +50,21 @@ public:
   }
 };
 
+double
+MapItemListBuilder::GetElevation(const RasterTerrain *terrain)
+{
+  if (!elevation_known) {
+    elevation = LocationMapItem::UNKNOWN_ELEVATION;
+    if (terrain != nullptr)
+      elevation = terrain->GetTerrainHeight(location)
+        .ToDouble(LocationMapItem::UNKNOWN_ELEVATION);
+
+    elevation_known = true;
+  }
+
+  return elevation;
+}
+
 void
 MapItemListBuilder::AddLocation(const NMEAInfo &basic,
                                 const RasterTerrain *terrain)
@@ -63,12 +78,7 @@ MapItemListBuilder::AddLocation(const NMEAInfo &basic,
   else
     vector.SetInvalid();
 
-  double elevation = LocationMapItem::UNKNOWN_ELEVATION;
-  if (terrain != nullptr)
-    elevation = terrain->GetTerrainHeight(location)
-      .ToDouble(LocationMapItem::UNKNOWN_ELEVATION);
-
-  list.append(new LocationMapItem(vector, elevation));
+  list.append(new LocationMapItem(vector, GetElevation(terrain)));
 }
 
 void
@@ -80,10 +90,7 @@ MapItemListBuilder::AddArrivalAltitudes(
     return;
 
   // Calculate terrain elevation if possible
-  double elevation = LocationMapItem::UNKNOWN_ELEVATION;
-  if (terrain != nullptr)
-    elevation = terrain->GetTerrainHeight(location)
-      .ToDouble(LocationMapItem::UNKNOWN_ELEVATION);
+  const double elevation = GetElevation(terrain);
 
   // Calculate target altitude
   double target_elevation = 0;
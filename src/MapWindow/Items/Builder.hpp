@@ -49,6 +49,14 @@ class MapItemListBuilder
   GeoPoint location;
   double range;
 
+  /**
+   * The terrain elevation at #location, looked up by the first
+   * GetElevation() call, because the terrain is locked for each
+   * lookup.  Only valid if #elevation_known is true.
+   */
+  double elevation;
+  bool elevation_known = false;
+
 public:
   MapItemListBuilder(MapItemList &_list, GeoPoint _location, double _range)
     :list(_list), location(_location), range(_range) {}
@@ -70,6 +78,13 @@ public:
                    const MoreData &basic, const DerivedInfo &calculated);
 
   void AddWeatherStations(NOAAStore &store);
+
+private:
+  /**
+   * Returns the terrain elevation at #location or
+   * LocationMapItem::UNKNOWN_ELEVATION.
+   */
+  double GetElevation(const RasterTerrain *terrain);
 };
 
 #endif
@@ -63,8 +63,9 @@ void
 MapCanvas::Project(const Projection &projection,
                    const SearchPointVector &points, BulkPixelPoint *screen)
 {
+  const auto convert = projection.GetScreenConverter();
   for (auto it = points.begin(); it != points.end(); ++it)
-    *screen++ = projection.GeoToScreen(it->GetLocation());
+    *screen++ = convert(it->GetLocation());
 }
 
 bool
@@ -88,8 +89,8 @@ MapCanvas::PreparePolygon(const SearchPointVector &points)
 
   /* project all GeoPoints to screen coordinates */
   raster_points.GrowDiscard(num_raster_points);
-  for (unsigned i = 0; i < num_raster_points; ++i)
-    raster_points[i] = projection.GeoToScreen(geo_points[i]);
+  projection.GeoToScreen(geo_points.begin(), raster_points.begin(),
+                         num_raster_points);
 
   return true;
 }
@@ -43,7 +43,12 @@ MapWindow::MapWindow(const MapLook &_look,
    waypoint_renderer(nullptr, look.waypoint),
    airspace_renderer(look.airspace),
    airspace_label_renderer(look.airspace),
-   trail_renderer(look.trail) {}
+   trail_renderer(look.trail)
+{
+#ifdef ENABLE_OPENGL
+  airspace_renderer.EnableLayerCache();
+#endif
+}
 
 MapWindow::~MapWindow()
 {
@@ -74,6 +79,9 @@ MapWindow::SetGlideComputer(GlideComputer *_gc)
 void
 MapWindow::FlushCaches()
 {
+#ifndef ENABLE_OPENGL
+  background_layer.Invalidate();
+#endif
   background.Flush();
   if (rasp_renderer)
     rasp_renderer->Flush();
@@ -153,6 +161,10 @@ MapWindow::SetTopography(TopographyStore *_topography)
 {
   topography = _topography;
 
+#ifndef ENABLE_OPENGL
+  background_layer.Invalidate();
+#endif
+
   delete topography_renderer;
   topography_renderer = topography != nullptr
     ? new CachedTopographyRenderer(*topography, look.topography)
@@ -164,6 +176,10 @@ MapWindow::SetTerrain(RasterTerrain *_terrain)
 {
   terrain = _terrain;
   background.SetTerrain(_terrain);
+
+#ifndef ENABLE_OPENGL
+  background_layer.Invalidate();
+#endif
 }
 
 void
@@ -29,14 +29,18 @@ Copyright_License {
 #include "Screen/DoubleBufferWindow.hpp"
 #ifndef ENABLE_OPENGL
 #include "Screen/BufferCanvas.hpp"
+#include "Terrain/TerrainSettings.hpp"
+#include "Util/Serial.hpp"
 #endif
 #include "Renderer/LabelBlock.hpp"
 #include "Screen/StopWatch.hpp"
 #include "MapWindowBlackboard.hpp"
 #include "Renderer/AirspaceLabelRenderer.hpp"
 #include "Renderer/BackgroundRenderer.hpp"
+#include "Renderer/TransparentRendererCache.hpp"
 #include "Renderer/WaypointRenderer.hpp"
 #include "Renderer/TrailRenderer.hpp"
+#include "Renderer/FAITriangleAreaRenderer.hpp"
 #include "Compiler.h"
 #include "Weather/Features.hpp"
 #include "Tracking/SkyLines/Features.hpp"
@@ -139,6 +143,39 @@ protected:
   const TrafficLook &traffic_look;
 
   BackgroundRenderer background;
+
+#ifndef ENABLE_OPENGL
+  /**
+   * The inputs of the cached background layer, see
+   * RenderBackground().
+   */
+  struct BackgroundLayerState {
+    Serial terrain_serial;
+    unsigned topography_serial;
+    TerrainRendererSettings terrain_settings;
+    Angle shading_angle;
+    bool topography_enabled;
+
+    gcc_pure
+    bool operator==(const BackgroundLayerState &other) const {
+      return terrain_serial == other.terrain_serial &&
+        topography_serial == other.topography_serial &&
+        terrain_settings == other.terrain_settings &&
+        shading_angle.CompareRoughly(other.shading_angle) &&
+        topography_enabled == other.topography_enabled;
+    }
+  };
+
+  /**
+   * Caches the terrain and the topography.  It is copied to the
+   * screen as long as the projection and the #BackgroundLayerState
+   * stay the same, e.g. when only the aircraft, its trail or the
+   * traffic has moved.
+   */
+  TransparentRendererCache background_layer;
+  BackgroundLayerState background_layer_state;
+#endif
+
   WaypointRenderer waypoint_renderer;
 
   AirspaceRenderer airspace_renderer;
@@ -146,6 +183,8 @@ protected:
 
   TrailRenderer trail_renderer;
 
+  FAITriangleAreaRenderer fai_triangle_area_renderer;
+
   ProtectedTaskManager *task = nullptr;
   const ProtectedRoutePlanner *route_planner = nullptr;
   GlideComputer *glide_computer = nullptr;
@@ -346,6 +385,12 @@ private:
 
   void RenderRasp(Canvas &canvas);
 
+  /**
+   * Renders terrain, RASP and topography, from the background layer
+   * cache if possible.
+   */
+  void RenderBackground(Canvas &canvas);
+
   void RenderTerrainAbove(Canvas &canvas, bool working);
 
   /**
@@ -22,6 +22,7 @@ Copyright_License {
 */
 
 #include "MapWindowBlackboard.hpp"
+#include "Thread/SnapshotBuffer.hpp"
 
 void
 MapWindowBlackboard::ReadComputerSettings(const ComputerSettings
@@ -43,5 +44,18 @@ MapWindowBlackboard::ReadBlackboard(const MoreData &nmea_info,
 {
   gps_info = nmea_info;
   calculated_info = derived_info;
+
+  basic_generation = calculated_generation = 0;
+}
+
+void
+MapWindowBlackboard::ReadBlackboard(const SnapshotBuffer<MoreData> &basic,
+                                    const SnapshotBuffer<DerivedInfo> &calculated)
+{
+  /* the DrawThread often renders several frames (e.g. while
+     panning) between two GPS updates; don't copy the same data again
+     for each of them */
+  basic.ReadModified(gps_info, basic_generation);
+  calculated.ReadModified(calculated_info, calculated_generation);
 }
 
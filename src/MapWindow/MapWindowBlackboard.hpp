@@ -30,6 +30,8 @@ Copyright_License {
 #include "Thread/Debug.hpp"
 #include "UIState.hpp"
 
+template<typename T> class SnapshotBuffer;
+
 /**
  * Blackboard used by map window: provides read-only access to local
  * copies of data required by map window
@@ -42,7 +44,18 @@ class MapWindowBlackboard:
 {
   UIState ui_state;
 
+  /**
+   * The generation numbers of the snapshots which were last copied
+   * to #gps_info and #calculated_info, see
+   * SnapshotBuffer::ReadModified().  Zero means the copies did not
+   * come from a #SnapshotBuffer.
+   */
+  unsigned basic_generation, calculated_generation;
+
 protected:
+  MapWindowBlackboard()
+    :basic_generation(0), calculated_generation(0) {}
+
   gcc_const
   const MoreData &Basic() const {
     assert(InDrawThread());
@@ -80,6 +93,14 @@ protected:
 
   void ReadBlackboard(const MoreData &nmea_info,
                       const DerivedInfo &derived_info);
+
+  /**
+   * Copy the most recently published snapshots, without locking the
+   * source blackboard.  Snapshots which have already been copied are
+   * skipped.
+   */
+  void ReadBlackboard(const SnapshotBuffer<MoreData> &basic,
+                      const SnapshotBuffer<DerivedInfo> &calculated);
   void ReadComputerSettings(const ComputerSettings &settings);
   void ReadMapSettings(const MapSettings &settings);
 
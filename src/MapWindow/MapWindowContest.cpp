@@ -22,7 +22,6 @@ Copyright_License {
 */
 
 #include "MapWindow.hpp"
-#include "Renderer/FAITriangleAreaRenderer.hpp"
 #include "Look/MapLook.hpp"
 
 #ifndef ENABLE_OPENGL
@@ -33,11 +32,10 @@ Copyright_License {
 
 static void
 RenderFAISectors(Canvas &canvas, const WindowProjection &projection,
-                 const GeoPoint &a, const GeoPoint &b,
-                 const FAITriangleSettings &settings)
+                 const FAITriangleAreaRenderer &renderer)
 {
-  RenderFAISector(canvas, projection, a, b, false, settings);
-  RenderFAISector(canvas, projection, a, b, true, settings);
+  renderer.Draw(canvas, projection, false);
+  renderer.Draw(canvas, projection, true);
 }
 
 void
@@ -47,8 +45,9 @@ MapWindow::DrawContest(Canvas &canvas)
 
   if (GetMapSettings().show_fai_triangle_areas &&
       flying.release_location.IsValid() && flying.far_location.IsValid()) {
-    const FAITriangleSettings &settings =
-      GetMapSettings().fai_triangle_settings;
+    fai_triangle_area_renderer.Update(flying.release_location,
+                                      flying.far_location,
+                                      GetMapSettings().fai_triangle_settings);
 
     /* draw FAI triangle areas */
     static constexpr Color fill_color = COLOR_YELLOW;
@@ -60,8 +59,7 @@ MapWindow::DrawContest(Canvas &canvas)
     canvas.Select(Pen(1, COLOR_BLACK.WithAlpha(90)));
 
     RenderFAISectors(canvas, render_projection,
-                     flying.release_location, flying.far_location,
-                     settings);
+                     fai_triangle_area_renderer);
 #else
     BufferCanvas buffer_canvas;
     buffer_canvas.Create(canvas);
@@ -75,8 +73,7 @@ MapWindow::DrawContest(Canvas &canvas)
 #endif
     buffer_canvas.SelectBlackPen();
     RenderFAISectors(buffer_canvas, render_projection,
-                     flying.release_location, flying.far_location,
-                     settings);
+                     fai_triangle_area_renderer);
     canvas.CopyAnd(buffer_canvas);
 #endif
   }
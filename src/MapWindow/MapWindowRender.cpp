@@ -29,8 +29,11 @@ Copyright_License {
 #include "Topography/CachedTopographyRenderer.hpp"
 #include "Renderer/AircraftRenderer.hpp"
 #include "Renderer/WaveRenderer.hpp"
+#include "Terrain/RasterTerrain.hpp"
+#include "Topography/TopographyStore.hpp"
 #include "Operation/Operation.hpp"
 #include "Tracking/SkyLines/Data.hpp"
+#include "Util/AllocationStats.hpp"
 
 #ifdef HAVE_NOAA
 #include "Weather/NOAAStore.hpp"
@@ -88,6 +91,60 @@ MapWindow::RenderRasp(Canvas &canvas)
     rasp_renderer->Draw(canvas, render_projection);
 }
 
+void
+MapWindow::RenderBackground(Canvas &canvas)
+{
+#ifndef ENABLE_OPENGL
+  /* RASP depends on the time of day and has its own cache; don't
+     bother caching the background while it is shown */
+  if (rasp_store == nullptr || GetUIState().weather.map < 0) {
+    background.SetShadingAngle(render_projection, GetMapSettings().terrain,
+                               Calculated());
+
+    BackgroundLayerState state;
+    if (terrain != nullptr)
+      state.terrain_serial = terrain->GetSerial();
+    state.topography_serial = topography != nullptr
+      ? topography->GetSerial()
+      : 0;
+    state.terrain_settings = GetMapSettings().terrain;
+    state.shading_angle = background.GetShadingAngle();
+    state.topography_enabled = GetMapSettings().topography_enabled;
+
+    if (!background_layer.Check(render_projection) ||
+        !(state == background_layer_state)) {
+      Canvas &buffer = background_layer.Begin(canvas, render_projection);
+
+      draw_sw.Mark("RenderTerrain");
+      RenderTerrain(buffer);
+
+      draw_sw.Mark("RenderRasp");
+      RenderRasp(buffer);
+
+      draw_sw.Mark("RenderTopography");
+      RenderTopography(buffer);
+
+      background_layer.Commit(canvas, render_projection);
+      background_layer_state = state;
+    }
+
+    background_layer.CopyTo(canvas, render_projection);
+    return;
+  }
+
+  background_layer.Invalidate();
+#endif
+
+  draw_sw.Mark("RenderTerrain");
+  RenderTerrain(canvas);
+
+  draw_sw.Mark("RenderRasp");
+  RenderRasp(canvas);
+
+  draw_sw.Mark("RenderTopography");
+  RenderTopography(canvas);
+}
+
 void
 MapWindow::RenderTopography(Canvas &canvas)
 {
@@ -184,6 +241,8 @@ MapWindow::RenderGlide(Canvas &canvas)
 void
 MapWindow::Render(Canvas &canvas, const PixelRect &rc)
 {
+  const ScopeAllocationTag alloc_tag(AllocationTag::RENDERER);
+
   const NMEAInfo &basic = Basic();
 
   // reset label over-write preventer
@@ -210,14 +269,7 @@ MapWindow::Render(Canvas &canvas, const PixelRect &rc)
   //////////////////////////////////////////////// items on ground
 
   // Render terrain, groundline and topography
-  draw_sw.Mark("RenderTerrain");
-  RenderTerrain(canvas);
-
-  draw_sw.Mark("RenderRasp");
-  RenderRasp(canvas);
-
-  draw_sw.Mark("RenderTopography");
-  RenderTopography(canvas);
+  RenderBackground(canvas);
 
   draw_sw.Mark("RenderOverlays");
   RenderOverlays(canvas);
@@ -84,8 +84,9 @@ MapWindow::DrawRoute(Canvas &canvas)
 
   const auto r_size = route.size();
   BulkPixelPoint p[r_size], *pp = &p[0];
+  const auto convert = render_projection.GetScreenConverter();
   for (auto i = route.begin(), end = route.end(); i != end; ++i, ++pp)
-    *pp = render_projection.GeoToScreen(*i);
+    *pp = convert(*i);
 
   p[r_size - 1] = ScreenClosestPoint(p[r_size-1], p[r_size-2], p[r_size-1], Layout::Scale(20));
 
@@ -25,6 +25,8 @@ Copyright_License {
 #include "Look/MapLook.hpp"
 #include "Screen/Icon.hpp"
 #include "Tracking/SkyLines/Data.hpp"
+#include "Computer/GlideComputer.hpp"
+#include "Util/StaticArray.hxx"
 
 template<typename T>
 static void
@@ -63,10 +65,30 @@ MapWindow::DrawThermalEstimate(Canvas &canvas) const
 
   // draw only at close map scales in non-circling mode
 
-  DrawThermalSources(canvas, look.thermal_source_icon, render_projection,
-                     thermal_locator.sources, basic.nav_altitude,
-                     calculated.wind_available
-                     ? calculated.wind : SpeedVector::Zero());
+  const SpeedVector wind = calculated.wind_available
+    ? calculated.wind : SpeedVector::Zero();
+
+  if (glide_computer != nullptr) {
+    /* the thermal database contains the sources of this flight and
+       of earlier flights */
+    StaticArray<ThermalSource, 64> sources;
+
+    {
+      const ThermalDatabase &database = glide_computer->GetThermalDatabase();
+      ScopeLock protect(database.mutex);
+      database.VisitWithinRange(render_projection.GetGeoScreenCenter(),
+                                render_projection.GetScreenDistanceMeters(),
+                                [&sources](const ThermalRecord &record){
+                                  if (!sources.full())
+                                    sources.append(record.ToSource());
+                                });
+    }
+
+    DrawThermalSources(canvas, look.thermal_source_icon, render_projection,
+                       sources, basic.nav_altitude, wind);
+  } else
+    DrawThermalSources(canvas, look.thermal_source_icon, render_projection,
+                       thermal_locator.sources, basic.nav_altitude, wind);
 
   const auto &cloud_settings = ComputerSettings().tracking.skylines.cloud;
   if (cloud_settings.show_thermals && skylines_data != nullptr) {
@@ -31,6 +31,40 @@ Copyright_License {
 #include "FLARM/Friends.hpp"
 #include "Tracking/SkyLines/Data.hpp"
 #include "Util/StringCompare.hxx"
+#include "Util/StaticArray.hxx"
+
+#include <algorithm>
+
+/**
+ * A FLARM target which is visible on the screen.
+ */
+struct VisibleTraffic {
+  const FlarmTraffic *traffic;
+  PixelPoint pt;
+};
+
+/**
+ * Targets with a higher value are drawn on top of the others.
+ */
+gcc_const
+static unsigned
+GetDrawPriority(FlarmTraffic::AlarmType alarm_level)
+{
+  switch (alarm_level) {
+  case FlarmTraffic::AlarmType::NONE:
+    break;
+
+  case FlarmTraffic::AlarmType::LOW:
+  case FlarmTraffic::AlarmType::INFO_ALERT:
+    return 1;
+
+  case FlarmTraffic::AlarmType::IMPORTANT:
+  case FlarmTraffic::AlarmType::URGENT:
+    return 2;
+  }
+
+  return 0;
+}
 
 /**
  * Draws the FLARM traffic icons onto the given canvas
@@ -57,62 +91,80 @@ MapWindow::DrawFLARMTraffic(Canvas &canvas,
   if (projection.GetMapScale() > 7300)
     return;
 
-  canvas.Select(*traffic_look.font);
-
-  // Circle through the FLARM targets
-  for (auto it = flarm.list.begin(), end = flarm.list.end();
-      it != end; ++it) {
-    const FlarmTraffic &traffic = *it;
+  /* project all targets once; the labels are drawn first, so they
+     never cover an icon, and the icons are drawn in the order of
+     their alarm level, so the most important targets end up on
+     top */
+  StaticArray<VisibleTraffic, TrafficList::MAX_COUNT> visible;
 
+  for (const FlarmTraffic &traffic : flarm.list) {
     if (!traffic.location_available)
       continue;
 
-    // Save the location of the FLARM target
-    GeoPoint target_loc = traffic.location;
+    // If FLARM target not on the screen, move to the next one
+    PixelPoint sc;
+    if (projection.GeoToScreenIfVisible(traffic.location, sc))
+      visible.append({&traffic, sc});
+  }
 
-    // Points for the screen coordinates for the icon, name and average climb
-    PixelPoint sc, sc_name, sc_av;
+  if (visible.empty())
+    return;
 
-    // If FLARM target not on the screen, move to the next one
-    if (!projection.GeoToScreenIfVisible(target_loc, sc))
-      continue;
+  std::stable_sort(visible.begin(), visible.end(),
+                   [](const VisibleTraffic &a, const VisibleTraffic &b){
+                     return GetDrawPriority(a.traffic->alarm_level) <
+                       GetDrawPriority(b.traffic->alarm_level);
+                   });
+
+  canvas.Select(*traffic_look.font);
+
+  TextInBoxMode mode;
+  mode.shape = LabelShape::OUTLINED;
+
+  for (const VisibleTraffic &i : visible) {
+    const FlarmTraffic &traffic = *i.traffic;
+
+    // Points for the screen coordinates for the name and average climb
+    PixelPoint sc_name, sc_av;
 
     // Draw the name 16 points below the icon
-    sc_name = sc;
+    sc_name = i.pt;
     sc_name.y -= Layout::Scale(20);
 
     // Draw the average climb value above the icon
-    sc_av = sc;
+    sc_av = i.pt;
     sc_av.y += Layout::Scale(5);
 
-    TextInBoxMode mode;
-    mode.shape = LabelShape::OUTLINED;
-
     // JMW TODO enhancement: decluttering of FLARM altitudes (sort by max lift)
 
     int dx = sc_av.x - aircraft_pos.x;
     int dy = sc_av.y - aircraft_pos.y;
 
     // only draw labels if not close to aircraft
-    if (dx * dx + dy * dy > Layout::Scale(30 * 30)) {
-      // If FLARM callsign/name available draw it to the canvas
-      if (traffic.HasName() && !StringIsEmpty(traffic.name))
-        TextInBox(canvas, traffic.name, sc_name.x, sc_name.y,
-                  mode, GetClientRect());
-
-      if (traffic.climb_rate_avg30s >= 0.1) {
-        // If average climb data available draw it to the canvas
-        TCHAR label_avg[100];
-        FormatUserVerticalSpeed(traffic.climb_rate_avg30s,
-                                       label_avg, false);
-        TextInBox(canvas, label_avg, sc_av.x, sc_av.y, mode, GetClientRect());
-      }
+    if (dx * dx + dy * dy <= Layout::Scale(30 * 30))
+      continue;
+
+    // If FLARM callsign/name available draw it to the canvas
+    if (traffic.HasName() && !StringIsEmpty(traffic.name))
+      TextInBox(canvas, traffic.name, sc_name.x, sc_name.y,
+                mode, GetClientRect());
+
+    if (traffic.climb_rate_avg30s >= 0.1) {
+      // If average climb data available draw it to the canvas
+      TCHAR label_avg[100];
+      FormatUserVerticalSpeed(traffic.climb_rate_avg30s,
+                                     label_avg, false);
+      TextInBox(canvas, label_avg, sc_av.x, sc_av.y, mode, GetClientRect());
     }
+  }
+
+  for (const VisibleTraffic &i : visible) {
+    const FlarmTraffic &traffic = *i.traffic;
 
     auto color = FlarmFriends::GetFriendColor(traffic.id);
     TrafficRenderer::Draw(canvas, traffic_look, traffic,
                           traffic.track - projection.GetScreenAngle(),
-                          color, sc);
+                          color, i.pt);
   }
 }
 
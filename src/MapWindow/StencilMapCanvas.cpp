@@ -73,8 +73,7 @@ StencilMapCanvas::DrawSearchPointVector(const SearchPointVector &points)
 
   /* draw it all */
   BulkPixelPoint screen[size];
-  for (unsigned i = 0; i < size; ++i)
-    screen[i] = proj.GeoToScreen(geo_points[i]);
+  proj.GeoToScreen(geo_points.begin(), screen, size);
 
   buffer.DrawPolygon(&screen[0], size);
   if (use_stencil)
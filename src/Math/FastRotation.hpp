@@ -82,6 +82,7 @@ class FastIntegerRotation {
   int cost, sint;
 
   friend class FastRowRotation;
+  friend class Projection;
 
 public:
   typedef IntPoint2D Point;
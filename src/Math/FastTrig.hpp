@@ -27,6 +27,10 @@ Copyright_License {
 #include "Constants.hpp"
 #include "Compiler.h"
 
+#ifdef POLY_TRIG
+#include "PolyTrig.hpp"
+#endif
+
 static constexpr unsigned INT_ANGLE_RANGE = 4096;
 static constexpr unsigned INT_ANGLE_MASK = INT_ANGLE_RANGE - 1;
 static constexpr unsigned INT_QUARTER_CIRCLE = INT_ANGLE_RANGE / 4;
@@ -87,6 +91,42 @@ invfastcosine(double x)
   return INVCOSINETABLE[NATIVE_TO_INT(x)];
 }
 
+#ifdef POLY_TRIG
+
+/* compile-time alternative to the lookup tables: evaluate the
+   polynomials from PolyTrig.hpp; this is more precise, and it can be
+   vectorised */
+
+gcc_const
+static inline int
+ifastsine(double x)
+{
+  return int(floor(PolySine(x) * 1024 + 0.5));
+}
+
+gcc_const
+static inline int
+ifastcosine(double x)
+{
+  return int(floor(PolyCosine(x) * 1024 + 0.5));
+}
+
+gcc_const
+static inline double
+fastsine(double x)
+{
+  return PolySine(x);
+}
+
+gcc_const
+static inline double
+fastcosine(double x)
+{
+  return PolyCosine(x);
+}
+
+#else
+
 gcc_const
 static inline int
 ifastsine(double x)
@@ -116,3 +156,5 @@ fastcosine(double x)
 }
 
 #endif
+
+#endif
@@ -61,6 +61,32 @@ Histogram::UpdateHistogram(double x)
   x_max = std::max(x+1.5/m, x_max);
 }
 
+void
+Histogram::UpdateHistogram(const double *x, unsigned n)
+{
+  for (unsigned i = 0; i < n; ++i)
+    UpdateHistogram(x[i]);
+}
+
+void
+Histogram::Merge(const Histogram &other)
+{
+  assert(other.sum_n == sum_n);
+  assert(other.m == m);
+  assert(other.b == b);
+
+  if (other.n_pts == 0)
+    return;
+
+  for (unsigned i = 0; i < sum_n; ++i)
+    IncrementSlot(i, other.slots[i].y);
+
+  x_min = std::min(x_min, other.x_min);
+  x_max = std::max(x_max, other.x_max);
+
+  n_pts += other.n_pts;
+}
+
 void Histogram::Reset(double minx, double maxx)
 {
   assert(maxx > minx);
@@ -44,6 +44,20 @@ public:
    */
   void UpdateHistogram(double x);
 
+  /**
+   * Add many data points at once.
+   *
+   * @param x an array of #n x-Values
+   */
+  void UpdateHistogram(const double *x, unsigned n);
+
+  /**
+   * Add the counters of another histogram, which must have been
+   * initialised with the same range.  This allows accumulating
+   * partial histograms in parallel.
+   */
+  void Merge(const Histogram &other);
+
   /**
    * Initialise the histogram, with specified range
    */
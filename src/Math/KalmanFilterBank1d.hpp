@@ -0,0 +1,139 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+ */
+
+#ifndef XCSOAR_KALMAN_FILTER_BANK_1D_HPP
+#define XCSOAR_KALMAN_FILTER_BANK_1D_HPP
+
+#include "Util.hpp"
+
+#include <assert.h>
+
+/**
+ * A bank of #N independent #KalmanFilter1d instances which are fed
+ * at the same rate, e.g. several channels of one sensor.  The model
+ * and arithmetic are identical to #KalmanFilter1d, but the state is
+ * stored as one array per variable, and all filters are updated in
+ * one pass.  The acceleration variance is shared by all filters, so
+ * the process noise which depends only on "dt" is calculated only
+ * once per update, and the loop over the filters is free of branches
+ * and can be vectorised by the compiler.
+ */
+template<unsigned N>
+class KalmanFilterBank1d {
+  static_assert(N > 0, "Empty filter bank");
+
+  // The state we are tracking, see KalmanFilter1d.
+  double x_abs[N];
+  double x_vel[N];
+
+  // Covariance matrix for the state.
+  double p_abs_abs[N];
+  double p_abs_vel[N];
+  double p_vel_vel[N];
+
+  // The variance of the acceleration noise input to the system model, in units
+  // per second squared.
+  double var_x_accel;
+
+public:
+  explicit KalmanFilterBank1d(double _var_x_accel=1)
+    :var_x_accel(_var_x_accel) {
+    Reset();
+  }
+
+  static constexpr unsigned size() {
+    return N;
+  }
+
+  /**
+   * Resets all filters, see KalmanFilter1d::Reset().
+   */
+  void Reset() {
+    for (unsigned i = 0; i < N; ++i)
+      Reset(i, 0, 0);
+  }
+
+  /**
+   * Resets one filter, see KalmanFilter1d::Reset().
+   */
+  void Reset(unsigned i, double x_abs_value, double x_vel_value=0) {
+    assert(i < N);
+
+    x_abs[i] = x_abs_value;
+    x_vel[i] = x_vel_value;
+    p_abs_abs[i] = 1.e6;
+    p_abs_vel[i] = 0;
+    p_vel_vel[i] = var_x_accel;
+  }
+
+  void SetAccelerationVariance(double _var_x_accel) {
+    var_x_accel = _var_x_accel;
+  }
+
+  /**
+   * Updates all filters given one direct sensor measurement per
+   * filter, the variance of each measurement, and the interval since
+   * the last measurement in seconds.  This interval must be greater
+   * than 0; for the first measurement after a Reset(), it's safe to
+   * use 1.0.
+   */
+  void Update(const double (&z_abs)[N], const double (&var_z_abs)[N],
+              double dt) {
+    assert(dt > 0);
+
+    // Process noise, shared by all filters.
+    const auto dt2 = Square(dt);
+    const auto q_abs_abs = var_x_accel * Square(dt2) / 4;
+    const auto q_abs_vel = var_x_accel * dt * dt2 / 2;
+    const auto q_vel_vel = var_x_accel * dt2;
+
+    for (unsigned i = 0; i < N; ++i) {
+      // Predict step.
+      const auto xa = x_abs[i] + x_vel[i] * dt;
+      const auto paa = p_abs_abs[i] + 2 * dt * p_abs_vel[i]
+        + dt2 * p_vel_vel[i] + q_abs_abs;
+      const auto pav = p_abs_vel[i] + dt * p_vel_vel[i] + q_abs_vel;
+      const auto pvv = p_vel_vel[i] + q_vel_vel;
+
+      // Update step.
+      const auto y = z_abs[i] - xa;
+      const auto s_inv = 1 / (paa + var_z_abs[i]);
+      const auto k_abs = paa * s_inv;
+      const auto k_vel = pav * s_inv;
+
+      x_abs[i] = xa + k_abs * y;
+      x_vel[i] += k_vel * y;
+      p_vel_vel[i] = pvv - pav * k_vel;
+      p_abs_vel[i] = pav - pav * k_abs;
+      p_abs_abs[i] = paa - paa * k_abs;
+    }
+  }
+
+  // Getters for the state and its covariance.
+  double GetXAbs(unsigned i) const { return x_abs[i]; }
+  double GetXVel(unsigned i) const { return x_vel[i]; }
+  double GetCovAbsAbs(unsigned i) const { return p_abs_abs[i]; }
+  double GetCovAbsVel(unsigned i) const { return p_abs_vel[i]; }
+  double GetCovVelVel(unsigned i) const { return p_vel_vel[i]; }
+};
+
+#endif
@@ -45,6 +45,8 @@ Copyright_License {
 #include "LeastSquares.hpp"
 #include "Util.hpp"
 
+#include <algorithm>
+
 #include <math.h>
 
 /*
@@ -131,6 +133,61 @@ LeastSquares::Update(double x, double y, double weight)
     max_error = error;
 }
 
+void
+LeastSquares::Update(const double *x, const double *y, unsigned n,
+                     double weight)
+{
+  if (n == 0)
+    return;
+
+  for (unsigned i = 0; i < n; ++i)
+    Add(x[i], y[i], weight);
+
+  Compute();
+
+  for (unsigned i = 0; i < n; ++i) {
+    auto error = fabs(y[i] - GetYAt(x[i]));
+    sum_error += Square(error) * weight;
+    if (error > max_error)
+      max_error = error;
+  }
+}
+
+void
+LeastSquares::Merge(const LeastSquares &other)
+{
+  if (other.IsEmpty())
+    return;
+
+  if (IsEmpty()) {
+    *this = other;
+    return;
+  }
+
+  sum_xxw += other.sum_xxw;
+  sum_xyw += other.sum_xyw;
+  sum_error += other.sum_error;
+  max_error = std::max(max_error, other.max_error);
+
+  /* combine the running means and co-moments, see Chan, Golub and
+     LeVeque: "Updating Formulae and a Pairwise Algorithm for
+     Computing Sample Variances" */
+  const double n_a = sum_n, n_b = other.sum_n, n = n_a + n_b;
+  const auto dx = other.x_mean - x_mean;
+  const auto dy = other.y_mean - y_mean;
+  const auto f = n_a * n_b / n;
+
+  x_mean += dx * n_b / n;
+  y_mean += dy * n_b / n;
+  x_S += other.x_S + dx * dx * f;
+  y_S += other.y_S + dy * dy * f;
+  xy_C += other.xy_C + dx * dy * f;
+
+  StoreMerge(other);
+
+  Compute();
+}
+
 void
 LeastSquares::UpdateError()
 {
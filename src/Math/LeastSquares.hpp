@@ -189,6 +189,28 @@ public:
    */
   void Update(double x, double y, double weight=1);
 
+  /**
+   * Add many data points at once.  This is cheaper than calling
+   * Update() for each point, because the fit is calculated only
+   * once.  The error is calculated against the final fit, not
+   * against the intermediate ones.
+   *
+   * @param x an array of #n x-Values
+   * @param y an array of #n y-Values
+   * @param weight Weight of the new data points (optional)
+   */
+  void Update(const double *x, const double *y, unsigned n,
+              double weight=1);
+
+  /**
+   * Combine with the statistics of another instance, which was fed
+   * with the points following the ones added to this instance.  This
+   * allows calculating partial results in parallel.  The result is
+   * the same as if all points had been added to one instance (within
+   * rounding).
+   */
+  void Merge(const LeastSquares &other);
+
   /**
    * Calculate the 1 std error ellipse fitting the data
    */
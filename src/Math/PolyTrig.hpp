@@ -0,0 +1,143 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#ifndef XCSOAR_MATH_POLY_TRIG_HPP
+#define XCSOAR_MATH_POLY_TRIG_HPP
+
+#include "Compiler.h"
+
+#include <math.h>
+
+/*
+ * Sine and cosine approximated by polynomials.
+ *
+ * The argument is reduced to [-pi/4, pi/4] (Cody-Waite, with a
+ * two-part pi/2), and the quadrant is applied arithmetically without
+ * branches, so loops over arrays (see PolySinCos()) can be
+ * vectorised by the compiler.  The polynomials are the Taylor series
+ * up to x^13 (sine) and x^14 (cosine); on the reduced interval, the
+ * truncation error is below 3e-15.  With the range reduction, the
+ * absolute error against sin()/cos() stays below 1e-13 for |x| <=
+ * 1000 (verified by TestAngle), which is far better than the 4096
+ * entry tables in FastTrig.hpp.
+ */
+
+namespace PolyTrigDetail {
+
+static constexpr double TWO_OVER_PI = 0.63661977236758134308;
+static constexpr double PIO2_HI = 1.57079632673412561417e+00;
+static constexpr double PIO2_LO = 6.07710050650619224932e-11;
+
+/**
+ * Sine on [-pi/4, pi/4].
+ */
+gcc_const
+static inline double
+ReducedSine(double r)
+{
+  const double r2 = r * r;
+  return r * (1 + r2 * (-1. / 6 + r2 * (1. / 120 + r2 * (-1. / 5040
+         + r2 * (1. / 362880 + r2 * (-1. / 39916800
+         + r2 * (1. / 6227020800)))))));
+}
+
+/**
+ * Cosine on [-pi/4, pi/4].
+ */
+gcc_const
+static inline double
+ReducedCosine(double r)
+{
+  const double r2 = r * r;
+  return 1 + r2 * (-1. / 2 + r2 * (1. / 24 + r2 * (-1. / 720
+         + r2 * (1. / 40320 + r2 * (-1. / 3628800
+         + r2 * (1. / 479001600 + r2 * (-1. / 87178291200)))))));
+}
+
+}
+
+/**
+ * Calculate the sine and the cosine of the given angle (radians).
+ */
+static inline void
+PolySinCos(double x, double &sine, double &cosine)
+{
+  using namespace PolyTrigDetail;
+
+  const double k = floor(x * TWO_OVER_PI + 0.5);
+  const double r = (x - k * PIO2_HI) - k * PIO2_LO;
+  const int q = int(k);
+
+  const double s = ReducedSine(r), c = ReducedCosine(r);
+
+  /* quadrant 0: ( s,  c)
+     quadrant 1: ( c, -s)
+     quadrant 2: (-s, -c)
+     quadrant 3: (-c,  s) */
+  const bool swap = q & 1;
+  const double sine_sign = 1 - 2 * ((q >> 1) & 1);
+  const double cosine_sign = 1 - 2 * (((q + 1) >> 1) & 1);
+
+  sine = sine_sign * (swap ? c : s);
+  cosine = cosine_sign * (swap ? s : c);
+}
+
+gcc_const
+static inline double
+PolySine(double x)
+{
+  double s, c;
+  PolySinCos(x, s, c);
+  return s;
+}
+
+gcc_const
+static inline double
+PolyCosine(double x)
+{
+  double s, c;
+  PolySinCos(x, s, c);
+  return c;
+}
+
+/**
+ * Calculate the sine and the cosine of each element of an array.
+ *
+ * @param sine an array of #n elements or nullptr
+ * @param cosine an array of #n elements or nullptr
+ */
+static inline void
+PolySinCos(const double *gcc_restrict x, double *gcc_restrict sine,
+           double *gcc_restrict cosine, unsigned n)
+{
+  for (unsigned i = 0; i < n; ++i) {
+    double s, c;
+    PolySinCos(x[i], s, c);
+    if (sine != nullptr)
+      sine[i] = s;
+    if (cosine != nullptr)
+      cosine[i] = c;
+  }
+}
+
+#endif
@@ -51,11 +51,16 @@ SelfTimingKalmanFilter1d::GetMaxDt() const
 void
 SelfTimingKalmanFilter1d::Update(const double z_abs, const double var_z_abs)
 {
-  const unsigned int t_us = MonotonicClockUS();
+  Update(z_abs, var_z_abs, MonotonicClockUS());
+}
 
+void
+SelfTimingKalmanFilter1d::Update(const double z_abs, const double var_z_abs,
+                                 const uint64_t t_us)
+{
   /* if we're called too quickly (less than 1us), round dt up to 1us
      to avoid problems in KalmanFilter1d::Update() */
-  const unsigned int dt_us = std::max(t_us - t_last_update_us_, uint64_t(1));
+  const uint64_t dt_us = std::max(t_us - t_last_update_us_, uint64_t(1));
 
   t_last_update_us_ = t_us;
 
@@ -74,6 +74,14 @@ public:
    */
   void Update(double z_abs, double var_z_abs);
 
+  /**
+   * Like Update(double, double), but uses the given time stamp of the
+   * measurement [us] instead of the current time.  This is used for
+   * batched measurements which all arrive at once.  Don't mix the two
+   * methods, the time stamps may use a different clock.
+   */
+  void Update(double z_abs, double var_z_abs, uint64_t t_us);
+
   // Remaining methods are identical to their counterparts in KalmanFilter1d.
 
   void Reset() {
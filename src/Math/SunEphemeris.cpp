@@ -31,6 +31,8 @@ Copyright_License {
 #include "Time/BrokenDateTime.hpp"
 #include "Time/RoughTime.hpp"
 
+#include <math.h>
+
 /** Sun radius in degrees (?) */
 static constexpr double SUN_DIAMETER = 0.53;
 
@@ -78,6 +80,14 @@ namespace SunEphemeris
 
   gcc_pure
   Angle GetMeanSunLongitude(double d);
+
+  /**
+   * Calculate the sun times, and return the declination of the sun
+   * which was used for them.
+   */
+  Result CalcSunTimes(const GeoPoint &location,
+                      const BrokenDateTime &date_time,
+                      RoughTimeDelta time_zone, Angle &declination_r);
 }
 
 double
@@ -163,6 +173,16 @@ SunEphemeris::Result
 SunEphemeris::CalcSunTimes(const GeoPoint &location,
                            const BrokenDateTime &date_time,
                            const RoughTimeDelta time_zone)
+{
+  Angle declination;
+  return CalcSunTimes(location, date_time, time_zone, declination);
+}
+
+SunEphemeris::Result
+SunEphemeris::CalcSunTimes(const GeoPoint &location,
+                           const BrokenDateTime &date_time,
+                           const RoughTimeDelta time_zone,
+                           Angle &declination_r)
 {
   Result result;
 
@@ -220,6 +240,7 @@ SunEphemeris::CalcSunTimes(const GeoPoint &location,
   // evening twilight end
   result.evening_twilight = result.time_of_sunset + twilight_hours;
 
+  declination_r = delta;
   return result;
 }
 
@@ -245,3 +266,39 @@ SunEphemeris::CalcAzimuth(const GeoPoint &location,
 
   return CalculateAzimuth(location, date_time, time_zone, delta);
 }
+
+const SunEphemeris::Result &
+SunEphemeris::Cache::Get(const GeoPoint &location,
+                         const BrokenDateTime &date_time,
+                         const RoughTimeDelta time_zone)
+{
+  assert(date_time.IsPlausible());
+
+  const int new_latitude_cell =
+    (int)floor(location.latitude.Degrees() * CELLS_PER_DEGREE);
+  const int new_longitude_cell =
+    (int)floor(location.longitude.Degrees() * CELLS_PER_DEGREE);
+  const unsigned new_hour_key =
+    ((date_time.year * 12 + date_time.month) * 31 + date_time.day) * 24
+    + date_time.hour;
+  const int new_time_zone_minutes = time_zone.AsMinutes();
+
+  if (valid && new_latitude_cell == latitude_cell &&
+      new_longitude_cell == longitude_cell &&
+      new_hour_key == hour_key &&
+      new_time_zone_minutes == time_zone_minutes) {
+    /* the times are still good; only the azimuth needs to be
+       updated */
+    result.azimuth = CalculateAzimuth(location, date_time, time_zone,
+                                      declination);
+    return result;
+  }
+
+  result = CalcSunTimes(location, date_time, time_zone, declination);
+  latitude_cell = new_latitude_cell;
+  longitude_cell = new_longitude_cell;
+  hour_key = new_hour_key;
+  time_zone_minutes = new_time_zone_minutes;
+  valid = true;
+  return result;
+}
@@ -62,6 +62,43 @@ namespace SunEphemeris
    */
   Angle CalcAzimuth(const GeoPoint &location, const BrokenDateTime &date_time,
                     RoughTimeDelta time_zone);
+
+  /**
+   * Remembers the result of CalcSunTimes() for callers which ask
+   * repeatedly for nearly the same place and time.  The times are
+   * reused within the same hour and a grid cell of
+   * 1/#CELLS_PER_DEGREE degrees; the azimuth is always calculated
+   * for the exact location and time.
+   */
+  class Cache {
+    static constexpr int CELLS_PER_DEGREE = 10;
+
+    bool valid = false;
+
+    int latitude_cell, longitude_cell;
+    unsigned hour_key;
+    int time_zone_minutes;
+
+    /**
+     * The declination of the sun during #hour_key.
+     */
+    Angle declination;
+
+    Result result;
+
+  public:
+    void Clear() {
+      valid = false;
+    }
+
+    /**
+     * Like CalcSunTimes(), but reuses the previous result if
+     * possible.
+     */
+    const Result &Get(const GeoPoint &location,
+                      const BrokenDateTime &date_time,
+                      RoughTimeDelta time_zone);
+  };
 }
 
 #endif
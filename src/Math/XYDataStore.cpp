@@ -50,9 +50,10 @@ XYDataStore::StoreAdd(double x, double y, double weight)
     x_min = x;
 
   // Add point
-  // TODO code: really should have a circular buffer here
-  if (!slots.full())
-    slots.append() = Slot(x, y, weight);
+  if (slots.full())
+    Decimate();
+
+  slots.append() = Slot(x, y, weight);
 
   ++sum_n;
 
@@ -63,10 +64,70 @@ XYDataStore::StoreAdd(double x, double y, double weight)
   sum_yw += y * weight;
 }
 
+void
+XYDataStore::StoreMerge(const XYDataStore &other)
+{
+  if (other.IsEmpty())
+    return;
+
+  if (IsEmpty() || other.y_max > y_max)
+    y_max = other.y_max;
+
+  if (IsEmpty() || other.y_min < y_min)
+    y_min = other.y_min;
+
+  if (IsEmpty() || other.x_max > x_max)
+    x_max = other.x_max;
+
+  if (IsEmpty() || other.x_min < x_min)
+    x_min = other.x_min;
+
+  for (const auto &i : other.slots) {
+    if (slots.full())
+      Decimate();
+
+    slots.append() = i;
+  }
+
+  sum_n += other.sum_n;
+  sum_weights += other.sum_weights;
+  sum_xw += other.sum_xw;
+  sum_yw += other.sum_yw;
+}
+
+void
+XYDataStore::Decimate()
+{
+  const unsigned n = slots.size();
+  unsigned dest = 0;
+
+  for (unsigned i = 0; i + 1 < n; i += 2) {
+    const Slot &a = slots[i], &b = slots[i + 1];
+
+#ifdef LEASTSQS_WEIGHT_STORE
+    const double w = a.weight + b.weight;
+    slots[dest++] = w > 0
+      ? Slot((a.x * a.weight + b.x * b.weight) / w,
+             (a.y * a.weight + b.y * b.weight) / w,
+             w)
+      : Slot((a.x + b.x) / 2, (a.y + b.y) / 2, w);
+#else
+    slots[dest++] = Slot((a.x + b.x) / 2, (a.y + b.y) / 2, 2);
+#endif
+  }
+
+  if (n % 2 != 0)
+    /* keep the newest point as it is */
+    slots[dest++] = slots[n - 1];
+
+  slots.shrink(dest);
+}
+
 void
 XYDataStore::StoreRemove(const unsigned i)
 {
   assert(i< sum_n);
+  assert(sum_n == slots.size());
   const auto &pt = slots[i];
 
   // Remove weighted point
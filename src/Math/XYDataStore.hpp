@@ -104,6 +104,11 @@ public:
     return y_max;
   }
 
+  /**
+   * Returns the stored data points.  When more points were added
+   * than fit into the store, older points have been merged pairwise
+   * (see Decimate()), so there may be fewer slots than GetCount().
+   */
   const TrivialArray<Slot, 1000> &GetSlots() const {
     return slots;
   }
@@ -122,9 +127,28 @@ protected:
   /**
    * Remove data point to the values.
    * If weights aren't stored, this assumes weight = 1
+   *
+   * This must not be used after the store has been decimated.
    */
   void StoreRemove(const unsigned i);
 
+  /**
+   * Add all data points of another store, which is assumed to hold
+   * the points following the ones in this store (e.g. the next chunk
+   * of a flight).  Slots are decimated as needed.
+   */
+  void StoreMerge(const XYDataStore &other);
+
+private:
+  /**
+   * Halve the number of slots by replacing each pair of adjacent
+   * slots with their weighted mean.  This is called when the store
+   * is full, so long recordings (e.g. the barograph of a long
+   * flight) keep covering the whole time range instead of losing
+   * all new points.  The sums are not affected.
+   */
+  void Decimate();
+
 };
 
 static_assert(std::is_trivial<XYDataStore>::value, "type is not trivial");
@@ -21,6 +21,7 @@
  */
 #include "ZeroFinder.hpp"
 
+#include <algorithm>
 #include <limits>
 
 #include <math.h>
@@ -50,10 +51,11 @@ ZeroFinder::tolerance_actual_zero(const double x) const
   return 2 * epsilon * fabs(x) + tolerance / 2;
 }
 
-//#define INSTRUMENT_ZERO
 #ifdef INSTRUMENT_ZERO
 unsigned long zero_skipped = 0;
 unsigned long zero_total = 0;
+unsigned long zero_near_hits = 0;
+unsigned long zero_iterations = 0;
 #endif
 
 inline bool
@@ -138,32 +140,68 @@ ZeroFinder::find_zero(const double xstart)
   zero_total++;
 #endif
   if ((xmin<=xstart) || (xstart<=xmax) ||
-      (f(xstart)> sqrt_epsilon))
-    return find_zero_actual(xstart);
+      (f(xstart)> sqrt_epsilon)) {
+    const auto fa = f(xmin);
+    const auto fb = f(xmax);
+    return find_zero_actual(xmin, fa, xmax, fb);
+  }
 #ifdef INSTRUMENT_ZERO
   zero_skipped++;
 #endif
   return xstart;
 }
 
+double
+ZeroFinder::find_zero_near(const double xstart, const double radius)
+{
+#ifdef INSTRUMENT_ZERO
+  zero_total++;
+#endif
+  const auto a = std::max(xmin, xstart - radius);
+  const auto b = std::min(xmax, xstart + radius);
+  if (a >= b)
+    return find_zero(xstart);
+
+  auto fa = f(a);
+  auto fb = f(b);
+  if (fa * fb <= 0) {
+    /* the solution is within this range */
+#ifdef INSTRUMENT_ZERO
+    zero_near_hits++;
+#endif
+    return find_zero_actual(a, fa, b, fb);
+  }
+
+  /* fall back to the whole range; f(xmax) is always called last,
+     because find_zero_actual() assumes f(b) is the last call */
+  if (a > xmin)
+    fa = f(xmin);
+  fb = f(xmax);
+  return find_zero_actual(xmin, fa, xmax, fb);
+}
+
+/**
+ * @param a Lower end of the range to search
+ * @param fa f(a)
+ * @param b Upper end of the range to search
+ * @param fb f(b), which must have the opposite sign of fa
+ */
 inline double
-ZeroFinder::find_zero_actual(const double xstart)
+ZeroFinder::find_zero_actual(double a, double fa, double b, double fb)
 {
-  double a, b, c; // Abscissae, descr. see above
-  double fa; // f(a)
-  double fb; // f(b)
+  double c; // Abscissae, descr. see above
   double fc; // f(c)
 
   bool b_best = true; // b is best and last called
 
-  c = a = xmin;  
-  fc = fa = f(a);  
-
-  b = xmax;  
-  fb = f(b);
+  c = a;
+  fc = fa;
 
   // Main iteration loop
   for (;;) {
+#ifdef INSTRUMENT_ZERO
+    zero_iterations++;
+#endif
     // Distance from the last but one to the last approximation
     auto prev_step = b - a;
    
@@ -345,6 +383,9 @@ ZeroFinder::find_min_actual(const double xstart)
 
   // Main iteration loop
   for (;;) {
+#ifdef INSTRUMENT_ZERO
+    zero_iterations++;
+#endif
     // Range over which the minimum is seeked for
     const auto range = b - a;
     const auto middle_range = (a + b) / 2;
@@ -27,6 +27,20 @@
 
 #include <assert.h>
 
+//#define INSTRUMENT_ZERO
+#ifdef INSTRUMENT_ZERO
+/** number of searches which were skipped because the initial guess
+    was good enough */
+extern unsigned long zero_skipped;
+/** total number of searches */
+extern unsigned long zero_total;
+/** number of find_zero_near() calls which found a bracket around the
+    initial guess */
+extern unsigned long zero_near_hits;
+/** total number of search iterations */
+extern unsigned long zero_iterations;
+#endif
+
 /**
  * Zero finding and minimisation search algorithm
  *
@@ -77,6 +91,21 @@ public:
   gcc_pure
   double find_zero(const double xstart);
 
+  /**
+   * Like find_zero(), but first tries to bracket the solution in a
+   * narrow range around the initial guess.  This needs fewer
+   * iterations if the guess is good, e.g. the solution of a previous
+   * search, and falls back to searching the whole range otherwise.
+   *
+   * @param xstart Initial guess of x
+   * @param radius Half width of the range around xstart to be tried
+   * first
+   *
+   * @return x value of best solution
+   */
+  gcc_pure
+  double find_zero_near(const double xstart, const double radius);
+
   /**
    * Find value of x that minimises f(x)
    * Method used is a variant of a bisector search.
@@ -91,7 +120,7 @@ public:
 
 private:
   gcc_pure
-  double find_zero_actual(const double xstart);
+  double find_zero_actual(double a, double fa, double b, double fb);
 
   gcc_pure
   double find_min_actual(const double xstart);
@@ -24,6 +24,7 @@ Copyright_License {
 #include "MenuBar.hpp"
 #include "Screen/ContainerWindow.hpp"
 #include "Input/InputEvents.hpp"
+#include "Util/StringAPI.hxx"
 
 #include <assert.h>
 
@@ -108,10 +109,17 @@ MenuBar::ShowButton(unsigned i, bool enabled, const TCHAR *text,
 
   Button &button = buttons[i];
 
-  button.SetCaption(text);
+  /* the dynamic labels are refreshed periodically; avoid redrawing
+     the button if nothing has changed */
+  const bool changed = !StringIsEqual(button.GetCaption(), text);
+  if (changed)
+    button.SetCaption(text);
+
   button.SetEnabled(enabled && event > 0);
   button.SetEvent(event);
-  button.ShowOnTop();
+
+  if (changed || !button.IsVisible())
+    button.ShowOnTop();
 }
 
 void
@@ -44,6 +44,7 @@ Menu::Add(const TCHAR *label, int location, unsigned event_id)
 
   item.label = label;
   item.event = event_id;
+  item.dynamic = label != NULL && _tcsstr(label, _T("$(")) != NULL;
 }
 
 int
@@ -37,9 +37,16 @@ public:
   const TCHAR *label;
   unsigned event;
 
+  /**
+   * Does the label contain a macro?  Determined once when the item is
+   * added, because IsDynamic() is checked on each menu refresh.
+   */
+  bool dynamic;
+
   void Clear() {
     label = NULL;
     event = 0;
+    dynamic = false;
   }
 
   constexpr
@@ -52,9 +59,9 @@ public:
    * often, because the variables that the label depends on may change
    * at any time.
    */
-  gcc_pure
+  constexpr
   bool IsDynamic() const {
-    return label != NULL && _tcsstr(label, _T("$(")) != NULL;
+    return dynamic;
   }
 };
 
@@ -28,6 +28,8 @@ Copyright_License {
 #include "NMEA/MoreData.hpp"
 #include "Audio/VarioGlue.hpp"
 #include "Device/MultipleDevices.hpp"
+#include "Computer/StageTimer.hpp"
+#include "OS/Clock.hpp"
 
 MergeThread::MergeThread(DeviceBlackboard &_device_blackboard)
   :WorkerThread("MergeThread", 50, 20, 10),
@@ -42,6 +44,8 @@ MergeThread::Process()
 {
   assert(!IsDefined() || IsInside());
 
+  const ScopeStageTimer stage_timer(StageTimer::Stage::MERGE);
+
   device_blackboard.Merge();
 
   const MoreData &basic = device_blackboard.Basic();
@@ -67,10 +71,16 @@ MergeThread::Tick()
 #endif
 
   {
+    const auto wait_start = MonotonicClockUS();
     ScopeLock protect(device_blackboard.mutex);
+    device_blackboard.merge_wait_us += MonotonicClockUS() - wait_start;
 
     Process();
 
+    /* let the CalculationThread and the DrawThread see the new data
+       without having to take the lock */
+    device_blackboard.PublishBasic();
+
     const MoreData &basic = device_blackboard.Basic();
 
     /* call Driver::OnSensorUpdate() on all devices */
@@ -92,13 +102,13 @@ MergeThread::Tick()
 #endif
 
     /* update last_any in every iteration */
-    last_any = basic;
+    last_any.CopyFrom(basic);
 
     /* update last_fix only when a new GPS fix was received */
     if ((basic.time_available &&
          (!last_fix.time_available || basic.time != last_fix.time)) ||
         basic.location_available != last_fix.location_available)
-      last_fix = basic;
+      last_fix.CopyFrom(basic);
   }
 
 #ifdef HAVE_PCM_PLAYER
@@ -25,6 +25,7 @@ Copyright_License {
 #define XCSOAR_MERGE_THREAD_HPP
 
 #include "Thread/WorkerThread.hpp"
+#include "Thread/Policy.hpp"
 #include "Computer/BasicComputer.hpp"
 #include "FLARM/FlarmComputer.hpp"
 #include "NMEA/MoreData.hpp"
@@ -66,18 +67,16 @@ public:
     Process();
   }
 
-  bool Start(bool suspended=false) {
-    if (!WorkerThread::Start(suspended))
-      return false;
-
-    SetLowPriority();
-    return true;
-  }
-
 private:
   void Process();
 
 protected:
+  /* virtual methods from class Thread */
+  void Run() override {
+    ApplyThreadPolicy(ThreadRole::MERGE);
+    WorkerThread::Run();
+  }
+
   virtual void Tick();
 };
 
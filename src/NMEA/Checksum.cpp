@@ -25,29 +25,64 @@ Copyright_License {
 
 #include <cassert>
 #include <cstring>
-#include <cstdlib>
 #include <cstdio>
 #include <stdint.h>
 
+static constexpr int
+ParseHexDigit(char ch)
+{
+  return ch >= '0' && ch <= '9'
+    ? ch - '0'
+    : (ch >= 'A' && ch <= 'F'
+       ? ch - 'A' + 0xa
+       : (ch >= 'a' && ch <= 'f'
+          ? ch - 'a' + 0xa
+          : -1));
+}
+
 bool
 VerifyNMEAChecksum(const char *p)
 {
   assert(p != NULL);
 
-  const char *asterisk = strrchr(p, '*');
+  /* skip the dollar sign at the beginning (the exclamation mark is
+     used by CAI302 */
+  if (*p == '$' || *p == '!')
+    ++p;
+
+  /* walk the line only once: accumulate the checksum and remember
+     its value at the last asterisk, which is what strrchr() would
+     find */
+  uint8_t checksum = 0, calculated = 0;
+  const char *asterisk = NULL;
+  for (; *p != 0; ++p) {
+    if (*p == '*') {
+      asterisk = p;
+      calculated = checksum;
+    }
+
+    checksum ^= *p;
+  }
+
   if (asterisk == NULL)
     return false;
 
+  /* one or two hex digits, and nothing else */
   const char *checksum_string = asterisk + 1;
-  char *endptr;
-  unsigned long ReadCheckSum2 = strtoul(checksum_string, &endptr, 16);
-  if (endptr == checksum_string || *endptr != 0 || ReadCheckSum2 >= 0x100)
+  const int high = ParseHexDigit(checksum_string[0]);
+  if (high < 0)
     return false;
 
-  uint8_t ReadCheckSum = (unsigned char)ReadCheckSum2;
-  uint8_t CalcCheckSum = NMEAChecksum(p, asterisk - p);
+  unsigned received = high;
+  if (checksum_string[1] != 0) {
+    const int low = ParseHexDigit(checksum_string[1]);
+    if (low < 0 || checksum_string[2] != 0)
+      return false;
+
+    received = (received << 4) | low;
+  }
 
-  return CalcCheckSum == ReadCheckSum;
+  return calculated == received;
 }
 
 void
@@ -25,6 +25,8 @@ Copyright_License {
 #include "OS/Clock.hpp"
 #include "Atmosphere/AirDensity.hpp"
 
+#include <string.h>
+
 void
 GPSState::Reset()
 {
@@ -373,3 +375,14 @@ NMEAInfo::Complement(const NMEAInfo &add)
 
   flarm.Complement(add.flarm);
 }
+
+void
+NMEAInfo::CopyFrom(const NMEAInfo &src)
+{
+  /* the traffic list is the last attribute (see declaration); copy
+     everything before it in one go */
+  const size_t head = (const char *)&src.flarm.traffic - (const char *)&src;
+  memcpy((void *)this, (const void *)&src, head);
+
+  flarm.traffic.CopyFrom(src.flarm.traffic);
+}
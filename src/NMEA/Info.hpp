@@ -357,6 +357,9 @@ struct NMEAInfo {
    */
   DeviceInfo secondary_device;
 
+  /**
+   * This must remain the last attribute, see CopyFrom().
+   */
   FlarmData flarm;
 
   void UpdateClock();
@@ -621,6 +624,13 @@ struct NMEAInfo {
    * outside of the NMEA parser.
    */
   void Complement(const NMEAInfo &add);
+
+  /**
+   * Copy all attributes from the specified object.  Unlike the
+   * assignment operator, this skips the unused slots of the FLARM
+   * traffic list, which make up most of this object's size.
+   */
+  void CopyFrom(const NMEAInfo &src);
 };
 
 static_assert(std::is_trivial<NMEAInfo>::value, "type is not trivial");
@@ -22,13 +22,21 @@ Copyright_License {
 */
 
 #include "NMEA/InputLine.hpp"
+#include "Compiler.h"
 
-#include <string.h>
-
-NMEAInputLine::NMEAInputLine(const char* line):
-  CSVLine(line)
+/**
+ * Find the end of the NMEA payload: the asterisk introducing the
+ * checksum, or the end of the string.  This is a single pass, where
+ * strlen() plus strchr() would walk the line twice.
+ */
+gcc_pure
+static const char *
+FindPayloadEnd(const char *p)
 {
-  const char* asterisk = strchr(line, '*');
-  if (asterisk != NULL)
-    end = asterisk;
+  while (*p != 0 && *p != '*')
+    ++p;
+  return p;
 }
+
+NMEAInputLine::NMEAInputLine(const char *line)
+  :CSVLine(line, FindPayloadEnd(line)) {}
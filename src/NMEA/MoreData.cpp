@@ -40,3 +40,20 @@ MoreData::Reset()
 
   NMEAInfo::Reset();
 }
+
+void
+MoreData::CopyFrom(const MoreData &src)
+{
+  NMEAInfo::CopyFrom(src);
+
+  nav_altitude = src.nav_altitude;
+  energy_height = src.energy_height;
+  TE_altitude = src.TE_altitude;
+
+  gps_vario = src.gps_vario;
+  gps_vario_TE = src.gps_vario_TE;
+  gps_vario_available = src.gps_vario_available;
+
+  brutto_vario = src.brutto_vario;
+  brutto_vario_available = src.brutto_vario_available;
+}
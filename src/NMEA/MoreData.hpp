@@ -61,6 +61,12 @@ struct MoreData : public NMEAInfo {
 
   void Reset();
 
+  /**
+   * Copy all attributes from the specified object, see
+   * NMEAInfo::CopyFrom().
+   */
+  void CopyFrom(const MoreData &src);
+
   bool NavAltitudeAvailable() const {
     return baro_altitude_available || gps_altitude_available;
   }
@@ -0,0 +1,100 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#ifndef XCSOAR_NMEA_SENTENCE_TABLE_HPP
+#define XCSOAR_NMEA_SENTENCE_TABLE_HPP
+
+#include "Compiler.h"
+
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * One entry of a sentence dispatch table: maps a sentence identifier
+ * (e.g. "$PFLAU") to a value, usually an enum which the caller
+ * switches on.
+ */
+template<typename T>
+struct NMEASentenceEntry {
+  const char *name;
+  T value;
+};
+
+namespace NMEASentenceTable {
+
+constexpr int
+Compare(const char *a, const char *b)
+{
+  while (*a != 0 && *a == *b) {
+    ++a;
+    ++b;
+  }
+
+  return (unsigned char)*a - (unsigned char)*b;
+}
+
+/**
+ * Check whether the table is sorted by name, without duplicates.
+ * Use this in a static_assert() next to the table definition.
+ */
+template<typename T, size_t N>
+constexpr bool
+IsSorted(const NMEASentenceEntry<T> (&table)[N])
+{
+  for (size_t i = 1; i < N; ++i)
+    if (Compare(table[i - 1].name, table[i].name) >= 0)
+      return false;
+
+  return true;
+}
+
+/**
+ * Look up a sentence identifier with a binary search.  The table
+ * must be sorted, see IsSorted().
+ *
+ * @return the matching entry or nullptr if the sentence is unknown
+ */
+template<typename T, size_t N>
+gcc_pure
+static inline const NMEASentenceEntry<T> *
+Find(const NMEASentenceEntry<T> (&table)[N], const char *name)
+{
+  size_t low = 0, high = N;
+  while (low < high) {
+    const size_t middle = (low + high) / 2;
+    const int cmp = strcmp(name, table[middle].name);
+    if (cmp == 0)
+      return &table[middle];
+
+    if (cmp < 0)
+      high = middle;
+    else
+      low = middle + 1;
+  }
+
+  return nullptr;
+}
+
+}
+
+#endif
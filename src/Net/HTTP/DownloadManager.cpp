@@ -87,7 +87,8 @@ Net::DownloadManager::Enumerate(DownloadListener &listener)
 }
 
 void
-Net::DownloadManager::Enqueue(const char *uri, Path relative_path)
+Net::DownloadManager::Enqueue(const char *uri, Path relative_path,
+                              gcc_unused const char *md5)
 {
   assert(download_manager != nullptr);
 
@@ -110,6 +111,9 @@ Net::DownloadManager::Cancel(Path relative_path)
 #include "Operation/Operation.hpp"
 #include "LocalPath.hpp"
 #include "IO/FileTransaction.hpp"
+#include "OS/FileUtil.hpp"
+#include "Logger/MD5.hpp"
+#include "Logger/MD5File.hpp"
 #include "LogFile.hpp"
 
 #include <string>
@@ -124,14 +128,21 @@ class DownloadManagerThread final
     std::string uri;
     AllocatedPath path_relative;
 
+    /**
+     * The expected MD5 digest; empty if unknown.
+     */
+    std::string md5;
+
     Item(const Item &other) = delete;
 
     Item(Item &&other)
       :uri(std::move(other.uri)),
-       path_relative(std::move(other.path_relative)) {}
+       path_relative(std::move(other.path_relative)),
+       md5(std::move(other.md5)) {}
 
-    Item(const char *_uri, Path _path_relative)
-      :uri(_uri), path_relative(_path_relative) {}
+    Item(const char *_uri, Path _path_relative, const char *_md5)
+      :uri(_uri), path_relative(_path_relative),
+       md5(_md5 != nullptr ? _md5 : "") {}
 
     Item &operator=(const Item &other) = delete;
 
@@ -199,9 +210,9 @@ public:
     }
   }
 
-  void Enqueue(const char *uri, Path path_relative) {
+  void Enqueue(const char *uri, Path path_relative, const char *md5) {
     ScopeLock protect(mutex);
-    queue.emplace_back(uri, path_relative);
+    queue.emplace_back(uri, path_relative, md5);
 
     for (auto *listener : listeners)
       listener->OnDownloadAdded(path_relative, -1, -1);
@@ -262,15 +273,68 @@ private:
   }
 };
 
+/**
+ * How often an interrupted transfer is resumed before giving up.
+ */
+static constexpr unsigned MAX_RESUME_ATTEMPTS = 8;
+
+/**
+ * Verify the MD5 digest of a downloaded file.
+ *
+ * @param md5 the expected digest; empty if unknown
+ */
+static bool
+VerifyDownload(Path path, const std::string &md5)
+{
+  if (md5.empty())
+    return true;
+
+  char digest[MD5::DIGEST_LENGTH + 1];
+  if (!ComputeFileMD5(path, digest))
+    return false;
+
+  if (md5 != digest) {
+    LogFormat("MD5 mismatch in download: expected %s, got %s",
+              md5.c_str(), digest);
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Download into a temporary file.  Each time the transfer fails, it
+ * is resumed with a HTTP range request, as long as the previous
+ * attempt made some progress.  The old file is only replaced if the
+ * new one matches the expected MD5 digest.
+ */
 static bool
 DownloadToFileTransaction(Net::Session &session,
                           const char *url, Path path,
-                          char *md5_digest, OperationEnvironment &env)
+                          const std::string &md5,
+                          OperationEnvironment &env)
 {
   FileTransaction transaction(path);
-  return DownloadToFile(session, url, transaction.GetTemporaryPath(),
-                        md5_digest, env) &&
-    transaction.Commit();
+  const Path temporary_path = transaction.GetTemporaryPath();
+
+  uint64_t previous_size = 0;
+  for (unsigned attempt = 1;; ++attempt) {
+    try {
+      return Net::ResumeDownloadToFile(session, url, temporary_path, env) &&
+        VerifyDownload(temporary_path, md5) &&
+        transaction.Commit();
+    } catch (const std::runtime_error &exception) {
+      const uint64_t size = File::Exists(temporary_path)
+        ? File::GetSize(temporary_path)
+        : 0;
+      if (attempt >= MAX_RESUME_ATTEMPTS || size <= previous_size ||
+          env.IsCancelled())
+        throw;
+
+      LogError("Download interrupted, resuming", exception);
+      previous_size = size;
+    }
+  }
 }
 
 inline void
@@ -288,7 +352,7 @@ DownloadManagerThread::ProcessQueue(Net::Session &session)
       const ScopeUnlock unlock(mutex);
       success = DownloadToFileTransaction(session, item.uri.c_str(),
                                           LocalPath(item.path_relative.c_str()),
-                                          nullptr, *this);
+                                          item.md5, *this);
     } catch (const std::exception &exception) {
       LogError(exception);
     }
@@ -387,11 +451,12 @@ Net::DownloadManager::Enumerate(DownloadListener &listener)
 }
 
 void
-Net::DownloadManager::Enqueue(const char *uri, Path relative_path)
+Net::DownloadManager::Enqueue(const char *uri, Path relative_path,
+                              const char *md5)
 {
   assert(thread != nullptr);
 
-  thread->Enqueue(uri, relative_path);
+  thread->Enqueue(uri, relative_path, md5);
 }
 
 void
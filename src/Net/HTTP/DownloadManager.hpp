@@ -70,7 +70,14 @@ namespace Net {
      */
     void Enumerate(DownloadListener &listener);
 
-    void Enqueue(const char *uri, Path relative_path);
+    /**
+     * @param md5 the expected MD5 hex digest of the file, or nullptr
+     * if unknown; if the downloaded file doesn't match, it is
+     * discarded and the old file is kept (not implemented on
+     * Android, where the system download manager is used)
+     */
+    void Enqueue(const char *uri, Path relative_path,
+                 const char *md5=nullptr);
 
     /**
      * Cancel the download.  The download may however be already
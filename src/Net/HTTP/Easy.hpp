@@ -102,6 +102,29 @@ namespace Net {
       SetOption(CURLOPT_HTTPPOST, post);
     }
 
+    void SetResumeFrom(int64_t offset) {
+      SetOption(CURLOPT_RESUME_FROM_LARGE, curl_off_t(offset));
+    }
+
+    /**
+     * Ask the server to send the resource only if it has been
+     * modified after the given time (HTTP "If-Modified-Since").
+     *
+     * @param t seconds since the epoch
+     */
+    void SetIfModifiedSince(int64_t t) {
+      SetOption(CURLOPT_TIMECONDITION, long(CURL_TIMECOND_IFMODSINCE));
+      SetOption(CURLOPT_TIMEVALUE, long(t));
+    }
+
+    /**
+     * Enable parsing the "Last-Modified" response header, see
+     * GetFileTime().
+     */
+    void SetFileTime(bool value) {
+      SetOption(CURLOPT_FILETIME, long(value));
+    }
+
     template<typename T>
     bool GetInfo(CURLINFO info, T value_r) const {
       return ::curl_easy_getinfo(handle, info, value_r) == CURLE_OK;
@@ -115,6 +138,28 @@ namespace Net {
         : -1;
     }
 
+    /**
+     * Returns the "Last-Modified" time in seconds since the epoch, or
+     * -1 if it is unknown.  Requires SetFileTime(true).
+     */
+    gcc_pure
+    int64_t GetFileTime() const {
+      long value;
+      return GetInfo(CURLINFO_FILETIME, &value)
+        ? (int64_t)value
+        : -1;
+    }
+
+    /**
+     * Was the response suppressed by the condition set with
+     * SetIfModifiedSince()?
+     */
+    gcc_pure
+    bool IsConditionUnmet() const {
+      long value;
+      return GetInfo(CURLINFO_CONDITION_UNMET, &value) && value != 0;
+    }
+
     bool Unpause() {
       return ::curl_easy_pause(handle, CURLPAUSE_CONT) == CURLE_OK;
     }
@@ -28,7 +28,7 @@ Copyright_License {
 Net::MultiPartFormData &
 Net::MultiPartFormData::AddFile(const char *name, Path path)
 {
-  return Add(CURLFORM_COPYNAME, "name",
+  return Add(CURLFORM_COPYNAME, name,
              CURLFORM_FILE,
              (const char *)NarrowPathName(path));
 }
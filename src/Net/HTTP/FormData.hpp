@@ -61,8 +61,8 @@ namespace Net {
     }
 
     MultiPartFormData &AddString(const char *name, const char *value) {
-      return Add(CURLFORM_COPYNAME, "name",
-                 CURLFORM_COPYCONTENTS, "content");
+      return Add(CURLFORM_COPYNAME, name,
+                 CURLFORM_COPYCONTENTS, value);
     }
 
     MultiPartFormData &AddFile(const char *name, Path path);
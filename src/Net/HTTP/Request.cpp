@@ -26,6 +26,7 @@ Copyright_License {
 #include "Handler.hpp"
 #include "FormData.hpp"
 #include "Version.hpp"
+#include "Operation/Operation.hpp"
 #include "Util/ConvertString.hpp"
 
 Net::Request::Request(Session &_session, ResponseHandler &_handler,
@@ -78,6 +79,35 @@ Net::Request::SetRequestBody(const MultiPartFormData &body)
   handle.SetHttpPost(body.Get());
 }
 
+void
+Net::Request::SetUploadProgress(OperationEnvironment &env)
+{
+  assert(!submitted);
+
+  handle.SetOption(CURLOPT_XFERINFOFUNCTION, UploadProgressCallback);
+  handle.SetOption(CURLOPT_XFERINFODATA, (void *)&env);
+  handle.SetOption(CURLOPT_NOPROGRESS, 0L);
+}
+
+int
+Net::Request::UploadProgressCallback(void *userdata,
+                                     gcc_unused curl_off_t dltotal,
+                                     gcc_unused curl_off_t dlnow,
+                                     curl_off_t ultotal, curl_off_t ulnow)
+{
+  OperationEnvironment &env = *(OperationEnvironment *)userdata;
+  if (env.IsCancelled())
+    /* abort the transfer */
+    return 1;
+
+  if (ultotal > 0) {
+    env.SetProgressRange(ultotal);
+    env.SetProgressPosition(ulnow);
+  }
+
+  return 0;
+}
+
 size_t
 Net::Request::ResponseData(const uint8_t *ptr, size_t size)
 {
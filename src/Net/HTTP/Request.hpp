@@ -30,6 +30,9 @@ Copyright_License {
 
 #include <stddef.h>
 #include <stdint.h>
+#include <assert.h>
+
+class OperationEnvironment;
 
 namespace Net {
   class Session;
@@ -71,12 +74,47 @@ namespace Net {
 
     void SetBasicAuth(const char *username, const char *password);
 
+    /**
+     * Request only the part of the resource after the given offset
+     * (HTTP "Range").  If the server doesn't support that, Send()
+     * fails instead of delivering the whole resource.
+     */
+    void SetResumeFrom(int64_t offset) {
+      assert(!submitted);
+
+      handle.SetResumeFrom(offset);
+    }
+
+    /**
+     * Make this a conditional request: the server sends the body only
+     * if the resource has been modified after the given time.  Use
+     * IsNotModified() to check.  This also enables
+     * GetLastModified().
+     *
+     * @param t seconds since the epoch; 0 requests the resource
+     * unconditionally
+     */
+    void SetIfModifiedSince(int64_t t) {
+      assert(!submitted);
+
+      handle.SetFileTime(true);
+      if (t > 0)
+        handle.SetIfModifiedSince(t);
+    }
+
     /**
      * Change the method to POST and use the given request body.  It
      * must not be destructed until Send() returns.
      */
     void SetRequestBody(const MultiPartFormData &body);
 
+    /**
+     * Report the progress of sending the request body to the given
+     * #OperationEnvironment, and abort the transfer when it gets
+     * cancelled.  It must not be destructed until Send() returns.
+     */
+    void SetUploadProgress(OperationEnvironment &env);
+
     /**
      * Send the request to the server and receive response headers.
      * This function fails if the connection could not be established
@@ -93,6 +131,26 @@ namespace Net {
      */
     int64_t GetLength() const;
 
+    /**
+     * Returns the "Last-Modified" time of the response in seconds
+     * since the epoch, or -1 if it is unknown.  Requires
+     * SetIfModifiedSince().
+     */
+    gcc_pure
+    int64_t GetLastModified() const {
+      return handle.GetFileTime();
+    }
+
+    /**
+     * Has the server reported that the resource was not modified
+     * since the time passed to SetIfModifiedSince()?  In this case,
+     * there is no response body.
+     */
+    gcc_pure
+    bool IsNotModified() const {
+      return handle.IsConditionUnmet();
+    }
+
     /**
      * Reads a number of bytes from the server.
      * This function must not be called before Send() !
@@ -110,6 +168,10 @@ namespace Net {
 
     static size_t WriteCallback(char *ptr, size_t size, size_t nmemb,
                                 void *userdata);
+
+    static int UploadProgressCallback(void *userdata,
+                                      curl_off_t dltotal, curl_off_t dlnow,
+                                      curl_off_t ultotal, curl_off_t ulnow);
 };
 }
 
@@ -38,15 +38,20 @@ class DownloadToFileHandler final : public Net::ResponseHandler {
 
   MD5 md5;
 
-  size_t received = 0;
+  /**
+   * The number of bytes in the file, including the ones which were
+   * already there when resuming.
+   */
+  int64_t received;
 
   OperationEnvironment &env;
 
   bool do_md5;
 
 public:
-  DownloadToFileHandler(FILE *_file, bool _do_md5, OperationEnvironment &_env)
-    :file(_file), env(_env), do_md5(_do_md5) {
+  DownloadToFileHandler(FILE *_file, int64_t offset, bool _do_md5,
+                        OperationEnvironment &_env)
+    :file(_file), received(offset), env(_env), do_md5(_do_md5) {
     if (do_md5)
       md5.Initialise();
   }
@@ -60,7 +65,9 @@ public:
 
   void ResponseReceived(int64_t content_length) override {
     if (content_length > 0)
-      env.SetProgressRange(content_length);
+      env.SetProgressRange(received + content_length);
+
+    env.SetProgressPosition(received);
   };
 
   void DataReceived(const void *data, size_t length) override {
@@ -73,24 +80,28 @@ public:
 
     received += length;
 
-    env.SetProgressRange(received);
+    env.SetProgressPosition(received);
   };
 };
 
 static bool
 DownloadToFile(Net::Session &session, const char *url,
                const char *username, const char *password,
-               FILE *file, char *md5_digest,
+               FILE *file, int64_t offset, char *md5_digest,
                OperationEnvironment &env)
 {
   assert(url != nullptr);
   assert(file != nullptr);
+  assert(offset == 0 || md5_digest == nullptr);
 
-  DownloadToFileHandler handler(file, md5_digest != nullptr, env);
+  DownloadToFileHandler handler(file, offset, md5_digest != nullptr, env);
   Net::Request request(session, handler, url);
   if (username != nullptr)
     request.SetBasicAuth(username, password);
 
+  if (offset > 0)
+    request.SetResumeFrom(offset);
+
   try {
     request.Send(10000);
   } catch (CancelDownloadToFile) {
@@ -122,8 +133,16 @@ Net::DownloadToFile(Session &session, const char *url,
   if (file == nullptr)
     return false;
 
-  bool success = ::DownloadToFile(session, url, username, password,
-                                  file, md5_digest, env);
+  bool success;
+  try {
+    success = ::DownloadToFile(session, url, username, password,
+                               file, 0, md5_digest, env);
+  } catch (...) {
+    fclose(file);
+    File::Delete(path);
+    throw;
+  }
+
   success &= fclose(file) == 0;
 
   if (!success)
@@ -133,6 +152,33 @@ Net::DownloadToFile(Session &session, const char *url,
   return success;
 }
 
+bool
+Net::ResumeDownloadToFile(Session &session, const char *url, Path path,
+                          OperationEnvironment &env)
+{
+  assert(url != nullptr);
+  assert(path != nullptr);
+
+  const int64_t offset = File::Exists(path) ? File::GetSize(path) : 0;
+
+  FILE *file = _tfopen(path.c_str(), _T("ab"));
+  if (file == nullptr)
+    return false;
+
+  bool success;
+  try {
+    success = ::DownloadToFile(session, url, nullptr, nullptr,
+                               file, offset, nullptr, env);
+  } catch (...) {
+    /* keep the partial file, the caller may try again */
+    fclose(file);
+    throw;
+  }
+
+  success &= fclose(file) == 0;
+  return success;
+}
+
 void
 Net::DownloadToFileJob::Run(OperationEnvironment &env)
 {
@@ -53,6 +53,21 @@ namespace Net {
                           path, md5_digest, env);
   }
 
+  /**
+   * Download a URL into the specified file, appending to the data
+   * which is already in the file (from a previous, interrupted
+   * attempt) using a HTTP range request.  Unlike DownloadToFile(),
+   * the partial file is not deleted on error, so the caller can call
+   * this function again to continue.
+   *
+   * Throws std::runtime_error on transfer failure (including a
+   * server which doesn't support ranges).
+   *
+   * @return true on success, false on local error
+   */
+  bool ResumeDownloadToFile(Session &session, const char *url, Path path,
+                            OperationEnvironment &env);
+
   class DownloadToFileJob : public Job {
     Session &session;
     const char *url;
@@ -0,0 +1,130 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#include "Upload.hpp"
+#include "Request.hpp"
+#include "Handler.hpp"
+#include "FormData.hpp"
+#include "Operation/Operation.hpp"
+
+#include <stdexcept>
+
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * How often a failed upload is attempted before giving up?
+ */
+static constexpr unsigned MAX_UPLOAD_ATTEMPTS = 3;
+
+/**
+ * The delay before the second attempt [ms]; it is doubled for each
+ * following one.
+ */
+static constexpr unsigned UPLOAD_RETRY_DELAY = 2000;
+
+class UploadResponseHandler final : public Net::ResponseHandler {
+  uint8_t *buffer;
+  const size_t max_size;
+
+  size_t received = 0;
+
+public:
+  UploadResponseHandler(void *_buffer, size_t _max_size)
+    :buffer((uint8_t *)_buffer), max_size(_max_size) {}
+
+  size_t GetReceived() const {
+    return received;
+  }
+
+  void ResponseReceived(int64_t content_length) override {}
+
+  void DataReceived(const void *data, size_t length) override {
+    /* silently discard the rest of an oversized response */
+    size_t remaining = max_size - received;
+    if (length > remaining)
+      length = remaining;
+
+    memcpy(buffer + received, data, length);
+    received += length;
+  };
+};
+
+static size_t
+UploadFileOnce(Net::Session &session, const char *url,
+               const char *username, const char *password,
+               const Net::MultiPartFormData &form,
+               void *response, size_t max_response_length,
+               OperationEnvironment &env)
+{
+  UploadResponseHandler handler(response, max_response_length);
+  Net::Request request(session, handler, url);
+  if (username != nullptr)
+    request.SetBasicAuth(username, password);
+
+  request.SetRequestBody(form);
+  request.SetUploadProgress(env);
+  request.Send(30000);
+
+  return handler.GetReceived();
+}
+
+size_t
+Net::UploadFile(Session &session, const char *url,
+                const char *username, const char *password,
+                const char *field_name, Path path,
+                void *response, size_t max_response_length,
+                OperationEnvironment &env)
+{
+  MultiPartFormData form;
+  form.AddFile(field_name, path);
+
+  unsigned delay = UPLOAD_RETRY_DELAY;
+  for (unsigned attempt = 1;; ++attempt) {
+    try {
+      return UploadFileOnce(session, url, username, password, form,
+                            response, max_response_length, env);
+    } catch (const std::runtime_error &) {
+      if (env.IsCancelled())
+        return -1;
+
+      if (attempt >= MAX_UPLOAD_ATTEMPTS)
+        throw;
+    }
+
+    env.Sleep(delay);
+    if (env.IsCancelled())
+      return -1;
+
+    delay *= 2;
+  }
+}
+
+void
+Net::UploadFileJob::Run(OperationEnvironment &env)
+{
+  length = UploadFile(session, url, username, password,
+                      field_name, path,
+                      response, max_response_length, env);
+}
@@ -0,0 +1,90 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#ifndef NET_UPLOAD_HPP
+#define NET_UPLOAD_HPP
+
+#include "Job/Job.hpp"
+#include "OS/Path.hpp"
+
+#include <stddef.h>
+
+class OperationEnvironment;
+
+namespace Net {
+  class Session;
+
+  /**
+   * Upload a file (e.g. an IGC flight log) with a
+   * "multipart/form-data" POST request.  libcurl reads the file from
+   * disk in small chunks while sending it, so it is never loaded into
+   * memory.  Transfer failures are retried a few times with a growing
+   * delay, because uploads often go through a congested hotspot.
+   *
+   * Throws std::runtime_error if the last attempt has failed.
+   *
+   * @param field_name the name of the form field containing the file
+   * @param response a buffer receiving the response body; if the
+   * response is too long, it is truncated
+   * @return the number of response bytes written, or -1 if the
+   * operation was cancelled
+   */
+  size_t UploadFile(Session &session, const char *url,
+                    const char *username, const char *password,
+                    const char *field_name, Path path,
+                    void *response, size_t max_response_length,
+                    OperationEnvironment &env);
+
+  class UploadFileJob : public Job {
+    Session &session;
+    const char *url;
+    const char *username = nullptr, *password = nullptr;
+    const char *field_name;
+    const Path path;
+    void *response;
+    size_t max_response_length;
+    size_t length;
+
+  public:
+    UploadFileJob(Session &_session, const char *_url,
+                  const char *_field_name, Path _path,
+                  void *_response, size_t _max_response_length)
+      :session(_session), url(_url), field_name(_field_name), path(_path),
+       response(_response), max_response_length(_max_response_length),
+       length(-1) {}
+
+    void SetBasicAuth(const char *_username, const char *_password) {
+      username = _username;
+      password = _password;
+    }
+
+    size_t GetLength() const {
+      return length;
+    }
+
+    virtual void Run(OperationEnvironment &env);
+  };
+}
+
+#endif
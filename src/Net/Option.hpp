@@ -24,6 +24,13 @@ Copyright_License {
 #ifndef XCSOAR_SOCKET_OPTION_HPP
 #define XCSOAR_SOCKET_OPTION_HPP
 
+/**
+ * The SO_RCVBUF size for sockets which receive high-rate feeds
+ * (simulators, network relays), to survive bursts while the I/O
+ * thread is busy.
+ */
+static constexpr int FEED_RECEIVE_BUFFER_SIZE = 256 * 1024;
+
 /**
  * Parameter type for boost::asio::basic_stream_socket::set_option()
  * which sets SO_SNDTIMEO.
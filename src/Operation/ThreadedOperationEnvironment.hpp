@@ -104,7 +104,7 @@ public:
     const ScopeLock lock(mutex);
     if (!cancel_flag) {
       cancel_flag = true;
-      cancel_cond.signal();
+      cancel_cond.broadcast();
     }
   }
 
@@ -125,11 +125,16 @@ BallastDumpProcessTimer()
   if (!ballast_manager.IsEnabled())
     return;
 
+  const auto old_ballast = glide_polar.GetBallastLitres();
+
   if (!ballast_manager.Update(glide_polar, settings_computer.plane.dump_time))
     // Plane is dry now -> disable ballast_timer
     settings_computer.polar.ballast_timer_active = false;
 
-  if (protected_task_manager != nullptr)
+  /* the BallastDumpManager changes the polar only in steps; don't
+     invalidate the task solutions in between */
+  if (protected_task_manager != nullptr &&
+      glide_polar.GetBallastLitres() != old_ballast)
     protected_task_manager->SetGlidePolar(glide_polar);
 }
 
@@ -24,6 +24,7 @@ Copyright_License {
 #include "Profile.hpp"
 #include "Map.hpp"
 #include "File.hpp"
+#include "SaveThread.hpp"
 #include "Current.hpp"
 #include "LogFile.hpp"
 #include "Asset.hpp"
@@ -43,6 +44,11 @@ Copyright_License {
 
 static AllocatedPath startProfileFile = nullptr;
 
+/**
+ * Created by the first Save() call and destroyed by Flush().
+ */
+static ProfileSaveThread *save_thread = nullptr;
+
 Path
 Profile::GetPath()
 {
@@ -54,6 +60,10 @@ Profile::Load()
 {
   assert(!startProfileFile.IsNull());
 
+  /* don't let a pending background save overwrite the file while
+     it is being read */
+  Flush();
+
   LogFormat("Loading profiles");
   LoadFile(startProfileFile);
   SetModified(false);
@@ -81,12 +91,30 @@ Profile::Save()
     SetFiles(nullptr);
 
   assert(!startProfileFile.IsNull());
-  SaveFile(startProfileFile);
+
+  if (save_thread == nullptr)
+    save_thread = new ProfileSaveThread();
+
+  save_thread->Save(map, startProfileFile);
+  SetModified(false);
+}
+
+void
+Profile::Flush()
+{
+  if (save_thread == nullptr)
+    return;
+
+  save_thread->Finish();
+  delete save_thread;
+  save_thread = nullptr;
 }
 
 void
 Profile::SaveFile(Path path)
 {
+  Flush();
+
   LogFormat(_T("Saving profile to %s"), path.c_str());
   SaveFile(map, path);
 }
@@ -94,6 +122,9 @@ Profile::SaveFile(Path path)
 void
 Profile::SetFiles(Path override_path)
 {
+  /* finish writing the previous file before switching */
+  Flush();
+
   /* set the "modified" flag, because we are potentially saving to a
      new file now */
   SetModified(true);
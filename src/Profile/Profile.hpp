@@ -52,11 +52,20 @@ namespace Profile
   void LoadFile(Path path);
 
   /**
-   * Saves the profile into the profile files
+   * Saves the profile into the profile files.  Does nothing if the
+   * profile has not been modified since the last save.  The file is
+   * written by a background thread; call Flush() to wait for it.
    */
   void Save();
+
+  /**
+   * Wait until all pending Save() calls have been written to disk.
+   * Must be called before shutdown.
+   */
+  void Flush();
+
   /**
-   * Saves the profile into the given profile file
+   * Saves the profile into the given profile file (synchronously)
    */
   void SaveFile(Path path);
 
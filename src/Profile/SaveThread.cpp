@@ -0,0 +1,74 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#include "SaveThread.hpp"
+#include "File.hpp"
+#include "LogFile.hpp"
+
+#include <stdexcept>
+
+ProfileSaveThread::ProfileSaveThread()
+  :StandbyThread("ProfileSave") {}
+
+ProfileSaveThread::~ProfileSaveThread()
+{
+  LockStop();
+}
+
+void
+ProfileSaveThread::Save(const ProfileMap &map, Path path)
+{
+  const ScopeLock protect(mutex);
+  queued_map = map;
+  queued_path = path;
+  queued = true;
+  Trigger();
+}
+
+void
+ProfileSaveThread::Finish()
+{
+  const ScopeLock protect(mutex);
+  WaitDone();
+  Stop();
+}
+
+void
+ProfileSaveThread::Tick()
+{
+  while (queued) {
+    ProfileMap map(std::move(queued_map));
+    AllocatedPath path(std::move(queued_path));
+    queued_map.clear();
+    queued_path = nullptr;
+    queued = false;
+
+    const ScopeUnlock unlock(mutex);
+
+    try {
+      Profile::SaveFile(map, path);
+    } catch (const std::runtime_error &e) {
+      LogError("Failed to save profile", e);
+    }
+  }
+}
@@ -0,0 +1,77 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#ifndef XCSOAR_PROFILE_SAVE_THREAD_HPP
+#define XCSOAR_PROFILE_SAVE_THREAD_HPP
+
+#include "Thread/StandbyThread.hpp"
+#include "Map.hpp"
+#include "OS/Path.hpp"
+
+/**
+ * Writes profile files in a background thread, so slow storage
+ * (e.g. the Kobo's internal flash) does not block the user
+ * interface.
+ *
+ * Save() only copies the map and wakes up the thread.  If another
+ * Save() arrives before the thread has picked up the previous one,
+ * the older snapshot is replaced, i.e. repeated saves are coalesced
+ * into one write of the latest state.  Write errors are logged by
+ * the thread.
+ */
+class ProfileSaveThread final : private StandbyThread {
+  /**
+   * The snapshot which has not been picked up by the thread yet.
+   * Protected by #mutex.
+   */
+  ProfileMap queued_map;
+  AllocatedPath queued_path = nullptr;
+
+  bool queued = false;
+
+public:
+  ProfileSaveThread();
+
+  /**
+   * Stops the thread.  A snapshot which has not been written yet
+   * may be lost; call Finish() before destroying this object.
+   */
+  ~ProfileSaveThread();
+
+  /**
+   * Schedule writing a copy of the given map to the given file.
+   */
+  void Save(const ProfileMap &map, Path path);
+
+  /**
+   * Wait until all queued snapshots have been written and stop the
+   * thread.
+   */
+  void Finish();
+
+private:
+  /* virtual methods from class StandbyThread */
+  void Tick() override;
+};
+
+#endif
@@ -27,9 +27,40 @@ Copyright_License {
 #include "ProfileKeys.hpp"
 #include "SystemSettings.hpp"
 
+#include <stdio.h>
+
+/**
+ * Load the policy of one thread role from the keys
+ * "Thread<Role>Scheduler", "Thread<Role>Nice" and "Thread<Role>CPUs".
+ */
+static void
+Load(const ProfileMap &map, ThreadRole role, ThreadPolicy &policy)
+{
+  char key[64];
+
+  snprintf(key, sizeof(key), "Thread%sScheduler", ToString(role));
+  unsigned scheduler;
+  if (map.Get(key, scheduler) &&
+      scheduler <= unsigned(ThreadPolicy::Scheduler::REALTIME))
+    policy.scheduler = ThreadPolicy::Scheduler(scheduler);
+
+  snprintf(key, sizeof(key), "Thread%sNice", ToString(role));
+  int nice;
+  if (map.Get(key, nice) && nice >= -20 && nice <= 19)
+    policy.nice = nice;
+
+  snprintf(key, sizeof(key), "Thread%sCPUs", ToString(role));
+  unsigned cpus;
+  if (map.Get(key, cpus))
+    policy.cpus = cpus;
+}
+
 void
 Profile::Load(const ProfileMap &map, SystemSettings &settings)
 {
   for (unsigned i = 0; i < settings.devices.size(); ++i)
     GetDeviceConfig(map, i, settings.devices[i]);
+
+  for (unsigned i = 0; i < unsigned(ThreadRole::COUNT); ++i)
+    ::Load(map, ThreadRole(i), settings.threads[ThreadRole(i)]);
 }
@@ -59,24 +59,6 @@ Projection::ScreenToGeo(int x, int y) const
   return g;
 }
 
-PixelPoint
-Projection::GeoToScreen(const GeoPoint &g) const
-{
-  assert(IsValid());
-
-  const GeoPoint d = geo_location-g;
-
-  const auto p =
-    screen_rotation.Rotate(int(g.latitude.fastcosine() *
-                               AngleToPixels(d.longitude)),
-                          (int)AngleToPixels(d.latitude));
-
-  PixelPoint sc;
-  sc.x = screen_origin.x - p.x;
-  sc.y = screen_origin.y + p.y;
-  return sc;
-}
-
 void 
 Projection::SetScale(const double _scale)
 {
@@ -144,12 +144,68 @@ public:
     return ScreenToGeo(pt.x, pt.y);
   }
 
+  /**
+   * A copy of the projection parameters which converts GeoPoints to
+   * screen coordinates with an inline function.  Use it (or the
+   * array version of GeoToScreen()) in loops over many points: the
+   * parameters are loaded once and stay in registers, because the
+   * stores to the destination array cannot alias them.
+   */
+  class ScreenConverter {
+    GeoPoint geo_location;
+    PixelPoint screen_origin;
+    int cost, sint;
+    double draw_scale;
+
+  public:
+    explicit ScreenConverter(const Projection &projection)
+      :geo_location(projection.geo_location),
+       screen_origin(projection.screen_origin),
+       cost(projection.screen_rotation.cost),
+       sint(projection.screen_rotation.sint),
+       draw_scale(projection.draw_scale) {}
+
+    gcc_pure
+    PixelPoint operator()(const GeoPoint &g) const {
+      const GeoPoint d = geo_location - g;
+
+      const int x = int(g.latitude.fastcosine() *
+                        (d.longitude.Radians() * draw_scale));
+      const int y = int(d.latitude.Radians() * draw_scale);
+
+      return PixelPoint(screen_origin.x - ((x * cost - y * sint + 512) >> 10),
+                        screen_origin.y + ((y * cost + x * sint + 512) >> 10));
+    }
+  };
+
+  gcc_pure
+  ScreenConverter GetScreenConverter() const {
+    assert(IsValid());
+
+    return ScreenConverter(*this);
+  }
+
   /**
    * Converts a GeoPoint to screen coordinates
    * @param g GeoPoint to convert
    */
   gcc_pure
-  PixelPoint GeoToScreen(const GeoPoint &g) const;
+  PixelPoint GeoToScreen(const GeoPoint &g) const {
+    return GetScreenConverter()(g);
+  }
+
+  /**
+   * Converts an array of GeoPoints to screen coordinates.
+   *
+   * @param dest an array of #PixelPoint or #BulkPixelPoint with at
+   * least #n elements
+   */
+  template<typename P>
+  void GeoToScreen(const GeoPoint *src, P *dest, unsigned n) const {
+    const ScreenConverter convert = GetScreenConverter();
+    for (unsigned i = 0; i < n; ++i)
+      dest[i] = convert(src[i]);
+  }
 
   /**
    * Returns the origin/rotation center in screen coordinates
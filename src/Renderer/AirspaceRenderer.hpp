@@ -25,9 +25,14 @@ Copyright_License {
 #define XCSOAR_AIRSPACE_RENDERER_HPP
 
 #include "Util/StaticArray.hxx"
+#include "Util/Serial.hpp"
 #include "Geo/GeoPoint.hpp"
 
-#ifndef ENABLE_OPENGL
+#ifdef ENABLE_OPENGL
+#include "AirspaceTriangulationCache.hpp"
+#include "Screen/BufferCanvas.hpp"
+#include "Projection/CompareProjection.hpp"
+#else
 #include "TransparentRendererCache.hpp"
 #endif
 
@@ -52,22 +57,41 @@ class AirspaceRenderer
 
   StaticArray<GeoPoint,32> intersections;
 
-#ifndef ENABLE_OPENGL
+#ifdef ENABLE_OPENGL
+  /**
+   * Shall the airspace layer be cached in #layer_cache?  This pays
+   * off only for long-lived renderers; see EnableLayerCache().
+   */
+  bool layer_cache_enabled;
+
+  /**
+   * This object caches the whole airspace layer (fill and outlines)
+   * in an off-screen buffer with premultiplied alpha.  This avoids
+   * drawing it again and again each frame when nothing has changed.
+   */
+  BufferCanvas layer_cache;
+
+  CompareProjection layer_projection;
+
+  AirspaceTriangulationCache triangulation_cache;
+#else
   /**
    * This object caches the airspace fill.  This avoids drawing it
    * again and again each frame when nothing has changed.
    */
   TransparentRendererCache fill_cache;
+#endif
 
   unsigned last_warning_serial;
-#endif
+  Serial last_airspaces_serial;
 
 public:
   AirspaceRenderer(const AirspaceLook &_look)
-    :look(_look), airspaces(nullptr), warning_manager(nullptr)
-#ifndef ENABLE_OPENGL
-    , last_warning_serial(0)
+    :look(_look), airspaces(nullptr), warning_manager(nullptr),
+#ifdef ENABLE_OPENGL
+     layer_cache_enabled(false),
 #endif
+     last_warning_serial(0)
   {}
 
   const AirspaceLook &GetLook() const {
@@ -90,19 +114,50 @@ public:
     warning_manager = _warning_manager;
   }
 
+#ifdef ENABLE_OPENGL
+  /**
+   * Render the airspaces into an off-screen buffer and reuse it for
+   * the following frames until the projection, the airspaces or the
+   * warnings change.  This requires frame buffer object support;
+   * without it, this is a no-op.
+   */
+  void EnableLayerCache() {
+    layer_cache_enabled = true;
+  }
+#endif
+
   void Clear() {
     airspaces = nullptr;
     warning_manager = nullptr;
+
+#ifdef ENABLE_OPENGL
+    layer_cache.Destroy();
+    layer_projection.Clear();
+    triangulation_cache.Clear();
+#endif
   }
 
   void Flush() {
-#ifndef ENABLE_OPENGL
+#ifdef ENABLE_OPENGL
+    layer_projection.Clear();
+#else
     fill_cache.Invalidate();
 #endif
   }
 
 private:
-#ifndef ENABLE_OPENGL
+#ifdef ENABLE_OPENGL
+  /**
+   * @param premultiplied render with premultiplied alpha (for
+   * #layer_cache)
+   */
+  void DrawLayer(Canvas &canvas,
+                 const WindowProjection &projection,
+                 const AirspaceRendererSettings &settings,
+                 const AirspaceWarningCopy &awc,
+                 const AirspacePredicate &visible,
+                 bool premultiplied);
+#else
   bool DrawFill(Canvas &buffer_canvas, Canvas &stencil_canvas,
                 const WindowProjection &projection,
                 const AirspaceRendererSettings &settings,
@@ -35,6 +35,73 @@ Copyright_License {
 #include "Airspace/AirspaceWarningCopy.hpp"
 #include "Engine/Airspace/Predicate/AirspacePredicate.hpp"
 #include "Screen/OpenGL/Scope.hpp"
+#include "Screen/OpenGL/Globals.hpp"
+#include "Util/AllocatedArray.hxx"
+
+#include <stdlib.h>
+
+/**
+ * Returns the given color with the given alpha value.  When rendering
+ * to AirspaceRenderer's layer cache, the color components are
+ * premultiplied with the alpha value.
+ */
+static constexpr Color
+FillColor(Color color, uint8_t alpha, bool premultiplied)
+{
+  return premultiplied
+    ? Color(color.Red() * alpha / 0xff, color.Green() * alpha / 0xff,
+            color.Blue() * alpha / 0xff, alpha)
+    : color.WithAlpha(alpha);
+}
+
+/**
+ * Set up the blend function for drawing translucent airspace areas.
+ */
+static void
+SetupBlendFunc(bool premultiplied)
+{
+  if (premultiplied)
+    glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+  else
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+}
+
+/**
+ * Fill the airspace polygon with the current brush, using its cached
+ * triangulation instead of triangulating the clipped polygon again.
+ *
+ * @param buffer a buffer for the projected vertices
+ * @return false if that was not possible; the caller must then fall
+ * back to MapCanvas::DrawPrepared()
+ */
+static bool
+FillTriangulated(Canvas &canvas, const Projection &projection,
+                 const SearchPointVector &points,
+                 const std::vector<uint16_t> &indices,
+                 AllocatedArray<BulkPixelPoint> &buffer)
+{
+  /* the vertices are not clipped, and those far away from the screen
+     may not fit into GLvalue (GLshort on OpenGL/ES) */
+  constexpr int MAX_COORDINATE = 16383;
+
+  if (indices.empty())
+    return false;
+
+  const unsigned n = points.size();
+  buffer.GrowDiscard(n);
+
+  const auto convert = projection.GetScreenConverter();
+  for (unsigned i = 0; i < n; ++i) {
+    const PixelPoint p = convert(points[i].GetLocation());
+    if (abs(p.x) > MAX_COORDINATE || abs(p.y) > MAX_COORDINATE)
+      return false;
+
+    buffer[i] = p;
+  }
+
+  canvas.DrawTriangles(buffer.begin(), indices.data(), indices.size());
+  return true;
+}
 
 class AirspaceVisitorRenderer final
   : protected MapCanvas
@@ -42,19 +109,29 @@ class AirspaceVisitorRenderer final
   const AirspaceLook &look;
   const AirspaceWarningCopy &warning_manager;
   const AirspaceRendererSettings &settings;
+  const bool premultiplied;
+
+  AirspaceTriangulationCache &triangulations;
+  const Serial airspaces_serial;
+  AllocatedArray<BulkPixelPoint> unclipped_points;
 
 public:
   AirspaceVisitorRenderer(Canvas &_canvas, const WindowProjection &_projection,
                           const AirspaceLook &_look,
                           const AirspaceWarningCopy &_warnings,
-                          const AirspaceRendererSettings &_settings)
+                          const AirspaceRendererSettings &_settings,
+                          bool _premultiplied,
+                          AirspaceTriangulationCache &_triangulations,
+                          Serial _airspaces_serial)
     :MapCanvas(_canvas, _projection,
                _projection.GetScreenBounds().Scale(1.1)),
-     look(_look), warning_manager(_warnings), settings(_settings)
+     look(_look), warning_manager(_warnings), settings(_settings),
+     premultiplied(_premultiplied),
+     triangulations(_triangulations), airspaces_serial(_airspaces_serial)
   {
     glStencilMask(0xff);
     glClear(GL_STENCIL_BUFFER_BIT);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    SetupBlendFunc(premultiplied);
   }
 
   ~AirspaceVisitorRenderer() {
@@ -85,8 +162,8 @@ private:
         canvas.DrawCircle(screen_center.x, screen_center.y, screen_radius);
       } else {
         // draw a ring inside the circle
-        Color color = class_look.fill_color;
-        Pen pen_donut(look.thick_pen.GetWidth() / 2, color.WithAlpha(90));
+        Pen pen_donut(look.thick_pen.GetWidth() / 2,
+                      FillColor(class_look.fill_color, 90, premultiplied));
         canvas.SelectHollowBrush();
         canvas.Select(pen_donut);
         canvas.DrawCircle(screen_center.x, screen_center.y,
@@ -127,7 +204,10 @@ private:
       {
         SetupInterior(airspace, !fill_airspace);
         const GLEnable<GL_BLEND> blend;
-        DrawPrepared();
+        if (!FillTriangulated(canvas, projection, airspace.GetPoints(),
+                              triangulations.Get(airspace, airspaces_serial),
+                              unclipped_points))
+          DrawPrepared();
       }
 
       if (!fill_airspace) {
@@ -189,7 +269,7 @@ private:
       glStencilFunc(GL_EQUAL, 0, 2);
     glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
 
-    canvas.Select(Brush(class_look.fill_color.WithAlpha(90)));
+    canvas.Select(Brush(FillColor(class_look.fill_color, 90, premultiplied)));
     canvas.SelectNullPen();
   }
 
@@ -220,17 +300,27 @@ class AirspaceFillRenderer final
   const AirspaceLook &look;
   const AirspaceWarningCopy &warning_manager;
   const AirspaceRendererSettings &settings;
+  const bool premultiplied;
+
+  AirspaceTriangulationCache &triangulations;
+  const Serial airspaces_serial;
+  AllocatedArray<BulkPixelPoint> unclipped_points;
 
 public:
   AirspaceFillRenderer(Canvas &_canvas, const WindowProjection &_projection,
                        const AirspaceLook &_look,
                        const AirspaceWarningCopy &_warnings,
-                       const AirspaceRendererSettings &_settings)
+                       const AirspaceRendererSettings &_settings,
+                       bool _premultiplied,
+                       AirspaceTriangulationCache &_triangulations,
+                       Serial _airspaces_serial)
     :MapCanvas(_canvas, _projection,
                _projection.GetScreenBounds().Scale(1.1)),
-     look(_look), warning_manager(_warnings), settings(_settings)
+     look(_look), warning_manager(_warnings), settings(_settings),
+     premultiplied(_premultiplied),
+     triangulations(_triangulations), airspaces_serial(_airspaces_serial)
   {
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    SetupBlendFunc(premultiplied);
   }
 
 private:
@@ -255,7 +345,10 @@ private:
     if (!warning_manager.IsAcked(airspace) && SetupInterior(airspace)) {
       // fill interior without overpainting any previous outlines
       GLEnable<GL_BLEND> blend;
-      DrawPrepared();
+      if (!FillTriangulated(canvas, projection, airspace.GetPoints(),
+                            triangulations.Get(airspace, airspaces_serial),
+                            unclipped_points))
+        DrawPrepared();
     }
 
     // draw outline
@@ -299,19 +392,20 @@ private:
 
     const AirspaceClassLook &class_look = look.classes[airspace.GetType()];
 
-    canvas.Select(Brush(class_look.fill_color.WithAlpha(48)));
+    canvas.Select(Brush(FillColor(class_look.fill_color, 48, premultiplied)));
     canvas.SelectNullPen();
 
     return true;
   }
 };
 
-void
-AirspaceRenderer::DrawInternal(Canvas &canvas,
-                               const WindowProjection &projection,
-                               const AirspaceRendererSettings &settings,
-                               const AirspaceWarningCopy &awc,
-                               const AirspacePredicate &visible)
+inline void
+AirspaceRenderer::DrawLayer(Canvas &canvas,
+                            const WindowProjection &projection,
+                            const AirspaceRendererSettings &settings,
+                            const AirspaceWarningCopy &awc,
+                            const AirspacePredicate &visible,
+                            bool premultiplied)
 {
   const auto range =
     airspaces->QueryWithinRange(projection.GetGeoScreenCenter(),
@@ -319,14 +413,18 @@ AirspaceRenderer::DrawInternal(Canvas &canvas,
 
   if (settings.fill_mode == AirspaceRendererSettings::FillMode::ALL ||
       settings.fill_mode == AirspaceRendererSettings::FillMode::NONE) {
-    AirspaceFillRenderer renderer(canvas, projection, look, awc, settings);
+    AirspaceFillRenderer renderer(canvas, projection, look, awc, settings,
+                                  premultiplied, triangulation_cache,
+                                  airspaces->GetSerial());
     for (const auto &i : range) {
       const AbstractAirspace &airspace = i.GetAirspace();
       if (visible(airspace))
         renderer.Visit(airspace);
     }
   } else {
-    AirspaceVisitorRenderer renderer(canvas, projection, look, awc, settings);
+    AirspaceVisitorRenderer renderer(canvas, projection, look, awc, settings,
+                                     premultiplied, triangulation_cache,
+                                     airspaces->GetSerial());
     for (const auto &i : range) {
       const AbstractAirspace &airspace = i.GetAirspace();
       if (visible(airspace))
@@ -335,4 +433,44 @@ AirspaceRenderer::DrawInternal(Canvas &canvas,
   }
 }
 
+void
+AirspaceRenderer::DrawInternal(Canvas &canvas,
+                               const WindowProjection &projection,
+                               const AirspaceRendererSettings &settings,
+                               const AirspaceWarningCopy &awc,
+                               const AirspacePredicate &visible)
+{
+  if (!layer_cache_enabled ||
+      !OpenGL::frame_buffer_object || !OpenGL::render_buffer_stencil) {
+    DrawLayer(canvas, projection, settings, awc, visible, false);
+    return;
+  }
+
+  if (!layer_cache.IsDefined())
+    layer_cache.Create(canvas.GetSize(), true);
+
+  assert(layer_cache.HasFrameBuffer());
+
+  if (layer_cache.GetSize() == canvas.GetSize() &&
+      layer_projection.Compare(projection) &&
+      awc.GetSerial() == last_warning_serial &&
+      airspaces->GetSerial() == last_airspaces_serial) {
+    /* nothing has changed: reuse the layer from the previous frame */
+    const GLBlend blend(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    layer_cache.CopyTo(canvas);
+    return;
+  }
+
+  layer_projection = CompareProjection(projection);
+  last_warning_serial = awc.GetSerial();
+  last_airspaces_serial = airspaces->GetSerial();
+
+  layer_cache.Begin(canvas);
+  layer_cache.Clear(Color::Transparent());
+  DrawLayer(layer_cache, projection, settings, awc, visible, true);
+
+  const GLBlend blend(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+  layer_cache.Commit(canvas);
+}
+
 #endif /* ENABLE_OPENGL */
@@ -245,8 +245,10 @@ AirspaceRenderer::DrawFillCached(Canvas &canvas, Canvas &stencil_canvas,
                                  const AirspacePredicate &visible)
 {
   if (awc.GetSerial() != last_warning_serial ||
+      airspaces->GetSerial() != last_airspaces_serial ||
       !fill_cache.Check(projection)) {
     last_warning_serial = awc.GetSerial();
+    last_airspaces_serial = airspaces->GetSerial();
 
     Canvas &buffer_canvas = fill_cache.Begin(canvas, projection);
     if (DrawFill(buffer_canvas, stencil_canvas,
@@ -0,0 +1,86 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#ifdef ENABLE_OPENGL
+
+#include "AirspaceTriangulationCache.hpp"
+#include "Engine/Airspace/AbstractAirspace.hpp"
+#include "Screen/OpenGL/Triangulate.hpp"
+#include "Math/Point2D.hpp"
+#include "Util/AllocatedArray.hxx"
+
+#include <type_traits>
+
+static_assert(std::is_same<uint16_t, GLushort>::value,
+              "GLushort is not uint16_t");
+
+/**
+ * Triangulate the polygon in a local flat projection which
+ * resembles the one of #Projection: the longitude difference is
+ * scaled with the cosine of each point's latitude.
+ */
+static void
+TriangulatePolygon(const SearchPointVector &points,
+                   std::vector<uint16_t> &indices)
+{
+  const unsigned n = points.size();
+  if (n < 3 || n >= 65536)
+    return;
+
+  const GeoPoint origin = points.front().GetLocation();
+
+  AllocatedArray<FloatPoint2D> flat(n);
+  for (unsigned i = 0; i < n; ++i) {
+    const GeoPoint &p = points[i].GetLocation();
+    const GeoPoint d = p - origin;
+    flat[i] = FloatPoint2D(p.latitude.fastcosine() *
+                           d.longitude.AsDelta().Radians(),
+                           d.latitude.Radians());
+  }
+
+  indices.resize(3 * (n - 2));
+
+  /* no thinning: the indices must refer to all points */
+  const unsigned count = PolygonToTriangles(flat.begin(), n,
+                                            indices.data(), 0);
+  indices.resize(count);
+  indices.shrink_to_fit();
+}
+
+const std::vector<uint16_t> &
+AirspaceTriangulationCache::Get(const AbstractAirspace &airspace,
+                                Serial serial)
+{
+  if (serial != airspaces_serial) {
+    map.clear();
+    airspaces_serial = serial;
+  }
+
+  auto i = map.emplace(&airspace, std::vector<uint16_t>());
+  if (i.second)
+    TriangulatePolygon(airspace.GetPoints(), i.first->second);
+
+  return i.first->second;
+}
+
+#endif /* ENABLE_OPENGL */
@@ -0,0 +1,70 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#ifndef XCSOAR_AIRSPACE_TRIANGULATION_CACHE_HPP
+#define XCSOAR_AIRSPACE_TRIANGULATION_CACHE_HPP
+
+#include "Util/Serial.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+#include <stdint.h>
+
+class AbstractAirspace;
+
+/**
+ * Caches the triangulation of airspace polygons for filling them
+ * with OpenGL.  The triangulation is calculated once per airspace in
+ * geographic coordinates, so it remains valid while the map moves,
+ * and the polygon's vertices only need to be projected for each
+ * frame.
+ */
+class AirspaceTriangulationCache {
+  std::unordered_map<const AbstractAirspace *, std::vector<uint16_t>> map;
+
+  /**
+   * The Airspaces::GetSerial() value the cache belongs to.
+   */
+  Serial airspaces_serial;
+
+public:
+  void Clear() {
+    map.clear();
+  }
+
+  /**
+   * Returns the triangle indices (into AbstractAirspace::GetPoints())
+   * of the specified airspace polygon.  The list is empty if the
+   * polygon cannot be triangulated; the caller must then fall back
+   * to Canvas::DrawPolygon().
+   *
+   * @param serial the current Airspaces::GetSerial(); if it has
+   * changed, the cache is flushed, because the airspace objects may
+   * have been replaced
+   */
+  const std::vector<uint16_t> &Get(const AbstractAirspace &airspace,
+                                   Serial serial);
+};
+
+#endif
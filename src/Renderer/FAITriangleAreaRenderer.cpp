@@ -22,12 +22,26 @@ Copyright_License {
 */
 
 #include "FAITriangleAreaRenderer.hpp"
-#include "Engine/Task/Shapes/FAITriangleArea.hpp"
-#include "Geo/GeoPoint.hpp"
 #include "Geo/GeoClip.hpp"
 #include "Projection/WindowProjection.hpp"
 #include "Screen/Canvas.hpp"
 
+static void
+RenderFAISector(Canvas &canvas, const WindowProjection &projection,
+                const GeoPoint *geo_points, unsigned n)
+{
+  GeoPoint clipped[FAI_TRIANGLE_SECTOR_MAX * 3],
+    *clipped_end = clipped +
+    GeoClip(projection.GetScreenBounds().Scale(1.1))
+    .ClipPolygon(clipped, geo_points, n);
+
+  const unsigned n_clipped = clipped_end - clipped;
+  BulkPixelPoint points[FAI_TRIANGLE_SECTOR_MAX * 3];
+  projection.GeoToScreen(clipped, points, n_clipped);
+
+  canvas.DrawPolygon(points, n_clipped);
+}
+
 void
 RenderFAISector(Canvas &canvas, const WindowProjection &projection,
                 const GeoPoint &pt1, const GeoPoint &pt2,
@@ -37,14 +51,30 @@ RenderFAISector(Canvas &canvas, const WindowProjection &projection,
   GeoPoint *geo_end = GenerateFAITriangleArea(geo_points, pt1, pt2,
                                               reverse, settings);
 
-  GeoPoint clipped[FAI_TRIANGLE_SECTOR_MAX * 3],
-    *clipped_end = clipped +
-    GeoClip(projection.GetScreenBounds().Scale(1.1))
-    .ClipPolygon(clipped, geo_points, geo_end - geo_points);
+  RenderFAISector(canvas, projection, geo_points, geo_end - geo_points);
+}
 
-  BulkPixelPoint points[FAI_TRIANGLE_SECTOR_MAX], *p = points;
-  for (GeoPoint *geo_i = clipped; geo_i != clipped_end;)
-    *p++ = projection.GeoToScreen(*geo_i++);
+void
+FAITriangleAreaRenderer::Update(const GeoPoint &_pt1, const GeoPoint &_pt2,
+                                const FAITriangleSettings &settings)
+{
+  if (pt1.IsValid() && _pt1 == pt1 && _pt2 == pt2 &&
+      settings.threshold == threshold)
+    /* unchanged */
+    return;
 
-  canvas.DrawPolygon(points, p - points);
+  pt1 = _pt1;
+  pt2 = _pt2;
+  threshold = settings.threshold;
+  n_points = GenerateFAITriangleAreas(points, reverse_points,
+                                      pt1, pt2, settings);
+}
+
+void
+FAITriangleAreaRenderer::Draw(Canvas &canvas,
+                              const WindowProjection &projection,
+                              bool reverse) const
+{
+  RenderFAISector(canvas, projection,
+                  reverse ? reverse_points : points, n_points);
 }
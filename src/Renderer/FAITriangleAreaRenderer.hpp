@@ -24,14 +24,44 @@ Copyright_License {
 #ifndef XCSOAR_FAI_TRIANGLE_AREA_RENDERER_HPP
 #define XCSOAR_FAI_TRIANGLE_AREA_RENDERER_HPP
 
-struct GeoPoint;
+#include "Engine/Task/Shapes/FAITriangleArea.hpp"
+#include "Engine/Task/Shapes/FAITriangleSettings.hpp"
+#include "Geo/GeoPoint.hpp"
+
 class Canvas;
 class WindowProjection;
-struct FAITriangleSettings;
 
 void
 RenderFAISector(Canvas &canvas, const WindowProjection &projection,
                 const GeoPoint &pt1, const GeoPoint &pt2,
                 bool reverse, const FAITriangleSettings &settings);
 
+/**
+ * Renders the two FAI triangle sectors of one leg.  The sectors are
+ * generated only when the leg or the settings change, and reused for
+ * all following frames.
+ */
+class FAITriangleAreaRenderer {
+  GeoPoint pt1, pt2;
+  FAITriangleSettings::Threshold threshold;
+
+  unsigned n_points;
+  GeoPoint points[FAI_TRIANGLE_SECTOR_MAX];
+  GeoPoint reverse_points[FAI_TRIANGLE_SECTOR_MAX];
+
+public:
+  FAITriangleAreaRenderer()
+    :pt1(GeoPoint::Invalid()), n_points(0) {}
+
+  /**
+   * Prepare the sectors of the leg pt1-pt2.  This is cheap if the
+   * parameters are the same as in the previous call.
+   */
+  void Update(const GeoPoint &pt1, const GeoPoint &pt2,
+              const FAITriangleSettings &settings);
+
+  void Draw(Canvas &canvas, const WindowProjection &projection,
+            bool reverse) const;
+};
+
 #endif
@@ -39,10 +39,14 @@ Copyright_License {
 #include "Screen/OpenGL/Compatibility.hpp"
 #endif
 
-void
-DrawGeoBitmap(const RawBitmap &bitmap, PixelSize bitmap_size,
-              const GeoBounds &bounds,
-              const Projection &projection)
+/**
+ * Draw the bound texture with the current shader program (GLSL) or
+ * the current texture environment (OpenGL/ES 1.x).
+ */
+static void
+DrawBoundTexture(const GLTexture &texture, PixelSize bitmap_size,
+                 const GeoBounds &bounds,
+                 const Projection &projection)
 {
   assert(bounds.IsValid());
 
@@ -55,7 +59,6 @@ DrawGeoBitmap(const RawBitmap &bitmap, PixelSize bitmap_size,
 
   const ScopeVertexPointer vp(vertices);
 
-  const GLTexture &texture = bitmap.BindAndGetTexture();
   const PixelSize allocated = texture.GetAllocatedSize();
 
   const GLfloat src_x = 0, src_y = 0, src_width = bitmap_size.cx,
@@ -74,7 +77,6 @@ DrawGeoBitmap(const RawBitmap &bitmap, PixelSize bitmap_size,
   };
 
 #ifdef USE_GLSL
-  OpenGL::texture_shader->Use();
   glEnableVertexAttribArray(OpenGL::Attribute::TEXCOORD);
   glVertexAttribPointer(OpenGL::Attribute::TEXCOORD, 2, GL_FLOAT, GL_FALSE,
                         0, coord);
@@ -90,10 +92,38 @@ DrawGeoBitmap(const RawBitmap &bitmap, PixelSize bitmap_size,
 
 #ifdef USE_GLSL
   glDisableVertexAttribArray(OpenGL::Attribute::TEXCOORD);
-  OpenGL::solid_shader->Use();
 #else
   glDisableClientState(GL_TEXTURE_COORD_ARRAY);
 #endif
 }
 
+void
+DrawGeoBitmap(const RawBitmap &bitmap, PixelSize bitmap_size,
+              const GeoBounds &bounds,
+              const Projection &projection)
+{
+#ifdef USE_GLSL
+  OpenGL::texture_shader->Use();
+#endif
+
+  DrawBoundTexture(bitmap.BindAndGetTexture(), bitmap_size,
+                   bounds, projection);
+
+#ifdef USE_GLSL
+  OpenGL::solid_shader->Use();
+#endif
+}
+
+#ifdef USE_GLSL
+
+void
+DrawGeoTexture(const GLTexture &texture, PixelSize texture_size,
+               const GeoBounds &bounds,
+               const Projection &projection)
+{
+  DrawBoundTexture(texture, texture_size, bounds, projection);
+}
+
+#endif
+
 #endif
@@ -28,6 +28,7 @@ struct PixelSize;
 class RawBitmap;
 class GeoBounds;
 class Projection;
+class GLTexture;
 
 #ifdef ENABLE_OPENGL
 
@@ -44,6 +45,22 @@ DrawGeoBitmap(const RawBitmap &bitmap, PixelSize bitmap_size,
               const GeoBounds &bounds,
               const Projection &projection);
 
+#ifdef USE_GLSL
+
+/**
+ * Like DrawGeoBitmap(), but draw an already bound texture with the
+ * shader program which is currently in use.  The caller is
+ * responsible for setting up the program's uniforms.
+ *
+ * @param texture_size the portion of the texture to be drawn
+ */
+void
+DrawGeoTexture(const GLTexture &texture, PixelSize texture_size,
+               const GeoBounds &bounds,
+               const Projection &projection);
+
+#endif
+
 #endif
 
 #endif
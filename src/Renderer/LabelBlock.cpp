@@ -23,45 +23,68 @@ Copyright_License {
 
 #include "LabelBlock.hpp"
 
+#include <algorithm>
+
+/**
+ * Convert a coordinate to a cell index, clipping to the grid.
+ */
+gcc_const
+static unsigned
+ToCell(int value, unsigned shift, unsigned grid_size)
+{
+  if (value <= 0)
+    return 0;
+
+  return std::min(unsigned(value) >> shift, grid_size - 1);
+}
+
 void
-LabelBlock::Bucket::Clear()
+LabelBlock::reset()
 {
   blocks.clear();
+  links.clear();
+  std::fill_n(&cells[0][0], GRID_SIZE * GRID_SIZE, NONE);
 }
 
-bool
-LabelBlock::Bucket::Check(const PixelRect rc) const
+inline bool
+LabelBlock::Check(unsigned x1, unsigned y1, unsigned x2, unsigned y2,
+                  const PixelRect rc) const
 {
-  for (auto i = blocks.begin(), end = blocks.end(); i != end; ++i)
-    if (i->OverlapsWith(rc))
-      return false;
+  for (unsigned y = y1; y <= y2; ++y)
+    for (unsigned x = x1; x <= x2; ++x)
+      for (uint16_t i = cells[y][x]; i != NONE; i = links[i].next)
+        if (blocks[links[i].block].OverlapsWith(rc))
+          return false;
 
   return true;
 }
 
-void LabelBlock::reset()
-{
-  for (unsigned i = 0; i < BUCKET_COUNT; ++i)
-    buckets[i].Clear();
-}
-
-bool LabelBlock::check(const PixelRect rc)
+bool
+LabelBlock::check(const PixelRect rc)
 {
-  unsigned top = rc.top >> BUCKET_SHIFT;
-  unsigned bottom = rc.bottom >> BUCKET_SHIFT;
+  const unsigned x1 = ToCell(rc.left, CELL_SHIFT, GRID_SIZE);
+  const unsigned x2 = ToCell(rc.right, CELL_SHIFT, GRID_SIZE);
+  const unsigned y1 = ToCell(rc.top, CELL_SHIFT, GRID_SIZE);
+  const unsigned y2 = ToCell(rc.bottom, CELL_SHIFT, GRID_SIZE);
 
-  if (top >= BUCKET_COUNT)
-    top = BUCKET_COUNT - 1;
-
-  if (bottom < BUCKET_COUNT && !buckets[bottom].Check(rc))
+  if (!Check(x1, y1, x2, y2, rc))
     return false;
 
-  if (top < bottom && !buckets[top].Check(rc))
-    return false;
+  const unsigned n_cells = (x2 - x1 + 1) * (y2 - y1 + 1);
+  if (blocks.full() || links.size() + n_cells > links.capacity())
+    /* no room to remember this one */
+    return true;
+
+  const uint16_t block = blocks.size();
+  blocks.append(rc);
 
-  buckets[top].Add(rc);
-  if (bottom < BUCKET_COUNT && top != bottom)
-    buckets[bottom].Add(rc);
+  for (unsigned y = y1; y <= y2; ++y) {
+    for (unsigned x = x1; x <= x2; ++x) {
+      const uint16_t link = links.size();
+      links.append({block, cells[y][x]});
+      cells[y][x] = link;
+    }
+  }
 
   return true;
 }
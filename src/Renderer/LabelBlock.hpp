@@ -28,48 +28,71 @@ Copyright_License {
 #include "Util/StaticArray.hxx"
 #include "Compiler.h"
 
+#include <stdint.h>
+
 /**
  * Simple code to prevent text writing over map city names.
+ *
+ * The screen is divided into a uniform grid of square cells.  Each
+ * cell keeps a list of the rectangles touching it, so a check only
+ * needs to compare with the few rectangles nearby.
  */
 class LabelBlock {
 #if defined(HAVE_GLES)
   /* embedded (Android or Windows CE) */
-  static constexpr unsigned SCREEN_HEIGHT = 2048;
-  static constexpr unsigned BUCKET_SIZE = 64;
+  static constexpr unsigned SCREEN_SIZE = 2048;
 #else
   /* desktop, screen may be huge, lots of memory */
-  static constexpr unsigned SCREEN_HEIGHT = 4096;
-  static constexpr unsigned BUCKET_SIZE = 64;
+  static constexpr unsigned SCREEN_SIZE = 4096;
 #endif
-  static constexpr unsigned BUCKET_SHIFT = 7;
-  static constexpr unsigned BUCKET_HEIGHT = 1 << BUCKET_SHIFT;
-  static constexpr unsigned BUCKET_COUNT = SCREEN_HEIGHT / BUCKET_HEIGHT;
+  static constexpr unsigned CELL_SHIFT = 6;
+  static constexpr unsigned GRID_SIZE = SCREEN_SIZE >> CELL_SHIFT;
 
   /**
-   * A bucket is responsible for hit tests in one horizontal section
-   * of the screen.
+   * The maximum number of rectangles.  Once that is reached, all
+   * further labels are accepted without being recorded.
    */
-  class Bucket {
-    typedef StaticArray<PixelRect, BUCKET_SIZE> BlockArray;
-    BlockArray blocks;
+  static constexpr unsigned MAX_BLOCKS = 1024;
 
-  public:
-    void Clear();
+  /**
+   * The maximum number of (cell, rectangle) links.
+   */
+  static constexpr unsigned MAX_LINKS = 4 * MAX_BLOCKS;
 
-    gcc_pure
-    bool Check(const PixelRect rc) const;
+  static constexpr uint16_t NONE = 0xffff;
 
-    void Add(const PixelRect rc) {
-      if (!blocks.full())
-        blocks.append(rc);
-    }
+  struct Link {
+    /**
+     * Index into #blocks.
+     */
+    uint16_t block;
+
+    /**
+     * Index of the next #Link in this cell, or #NONE.
+     */
+    uint16_t next;
   };
 
-  Bucket buckets[BUCKET_COUNT];
+  StaticArray<PixelRect, MAX_BLOCKS> blocks;
+  StaticArray<Link, MAX_LINKS> links;
+
+  /**
+   * The first #Link of each cell, or #NONE.
+   */
+  uint16_t cells[GRID_SIZE][GRID_SIZE];
 
 public:
+  LabelBlock() {
+    reset();
+  }
+
   bool check(const PixelRect rc);
   void reset();
+
+private:
+  gcc_pure
+  bool Check(unsigned x1, unsigned y1, unsigned x2, unsigned y2,
+             const PixelRect rc) const;
 };
 
 #endif
@@ -142,6 +142,35 @@ TrailRenderer::Draw(Canvas &canvas, const TraceComputer &trace_computer,
 
   const GeoBounds bounds = projection.GetScreenBounds().Scale(4);
 
+  /* consecutive line segments sharing the same pen are collected
+     here and drawn with one DrawPolyline() call instead of one
+     DrawLinePiece() call per segment */
+  BulkPixelPoint *const run = Prepare(trace.size());
+  unsigned run_length = 0;
+  const Pen *run_pen = nullptr;
+
+  const auto flush_run = [&canvas, run, &run_length, &run_pen](){
+    if (run_length >= 2) {
+      canvas.Select(*run_pen);
+      canvas.DrawPolyline(run, run_length);
+    }
+
+    run_length = 0;
+  };
+
+  const auto append_segment = [run, &run_length, &run_pen, &flush_run]
+    (const Pen &pen, PixelPoint a, PixelPoint b){
+    if (run_length == 0 || &pen != run_pen) {
+      flush_run();
+      run_pen = &pen;
+      run[run_length++] = a;
+    }
+
+    run[run_length++] = b;
+  };
+
+  const auto convert = projection.GetScreenConverter();
+
   PixelPoint last_point(0, 0);
   bool last_valid = false;
   for (auto it = trace.begin(), end = trace.end(); it != end; ++it) {
@@ -151,18 +180,18 @@ TrailRenderer::Draw(Canvas &canvas, const TraceComputer &trace_computer,
       : it->GetLocation();
     if (!bounds.IsInside(gp)) {
       /* the point is outside of the MapWindow; don't paint it */
+      flush_run();
       last_valid = false;
       continue;
     }
 
-    auto pt = projection.GeoToScreen(gp);
+    auto pt = convert(gp);
 
     if (last_valid) {
       if (settings.type == TrailSettings::Type::ALTITUDE) {
         unsigned index = GetAltitudeColorIndex(it->GetAltitude(),
                                                value_min, value_max);
-        canvas.Select(look.trail_pens[index]);
-        canvas.DrawLinePiece(last_point, pt);
+        append_segment(look.trail_pens[index], last_point, pt);
       } else {
         unsigned color_index = GetSnailColorIndex(it->GetVario(),
                                                   value_min, value_max);
@@ -170,6 +199,7 @@ TrailRenderer::Draw(Canvas &canvas, const TraceComputer &trace_computer,
             (settings.type == TrailSettings::Type::VARIO_1_DOTS ||
              settings.type == TrailSettings::Type::VARIO_2_DOTS ||
              settings.type == TrailSettings::Type::VARIO_DOTS_AND_LINES)) {
+          flush_run();
           canvas.SelectNullPen();
           canvas.Select(look.trail_brushes[color_index]);
           canvas.DrawCircle((pt.x + last_point.x) / 2, (pt.y + last_point.y) / 2,
@@ -178,18 +208,21 @@ TrailRenderer::Draw(Canvas &canvas, const TraceComputer &trace_computer,
           // positive vario case
 
           if (settings.type == TrailSettings::Type::VARIO_DOTS_AND_LINES) {
+            /* each line piece must be painted over its own dot, so
+               this mode is not batched */
+            flush_run();
             canvas.Select(look.trail_brushes[color_index]);
             canvas.Select(look.trail_pens[color_index]); //fixed-width pen
             canvas.DrawCircle((pt.x + last_point.x) / 2, (pt.y + last_point.y) / 2,
                               look.trail_widths[color_index]);
+            canvas.DrawLinePiece(last_point, pt);
           } else if (scaled_trail)
             // width scaled to vario
-            canvas.Select(look.scaled_trail_pens[color_index]);
+            append_segment(look.scaled_trail_pens[color_index],
+                           last_point, pt);
           else
             // fixed-width pen
-            canvas.Select(look.trail_pens[color_index]);
-
-          canvas.DrawLinePiece(last_point, pt);
+            append_segment(look.trail_pens[color_index], last_point, pt);
         }
       }
     }
@@ -197,6 +230,8 @@ TrailRenderer::Draw(Canvas &canvas, const TraceComputer &trace_computer,
     last_valid = true;
   }
 
+  flush_run();
+
   if (last_valid)
     canvas.DrawLine(last_point, pos);
 }
@@ -247,8 +282,9 @@ TrailRenderer::DrawTraceVector(Canvas &canvas, const Projection &projection,
   const unsigned n = trace.size();
   auto *p = Prepare(n);
 
+  const auto convert = projection.GetScreenConverter();
   for (const auto &i : trace)
-    *p++ = projection.GeoToScreen(i.GetLocation());
+    *p++ = convert(i.GetLocation());
 
   DrawPreparedPolyline(canvas, n);
 }
@@ -276,8 +312,9 @@ TrailRenderer::DrawTraceVector(Canvas &canvas, const Projection &projection,
   const unsigned n = trace.size();
   auto *p = Prepare(n);
 
+  const auto convert = projection.GetScreenConverter();
   for (const auto &i : trace)
-    *p++ = projection.GeoToScreen(i.GetLocation());
+    *p++ = convert(i.GetLocation());
 
   DrawPreparedPolyline(canvas, n);
 }
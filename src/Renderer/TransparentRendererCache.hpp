@@ -60,6 +60,9 @@ public:
   void Commit(Canvas &canvas, const WindowProjection &projection) {
   }
 
+  void CopyTo(Canvas &canvas) const {
+  }
+
   void CopyAndTo(Canvas &canvas) const {
   }
 
@@ -109,6 +112,11 @@ public:
    */
   void Commit(Canvas &canvas, const WindowProjection &projection);
 
+  /**
+   * Copy the cache to the given Canvas, overwriting everything.
+   */
+  void CopyTo(Canvas &canvas, const WindowProjection &projection) const;
+
   void CopyAndTo(Canvas &canvas,
                  const WindowProjection &projection) const;
 
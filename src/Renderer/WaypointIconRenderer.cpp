@@ -68,6 +68,25 @@ GetWaypointIcon(const WaypointLook &look, const Waypoint &wp,
   }
 }
 
+gcc_pure
+static const MaskedIcon &
+GetLandableIcon(const WaypointLook &look, const Waypoint &waypoint,
+                WaypointIconRenderer::Reachability reachable)
+{
+  if (reachable == WaypointIconRenderer::ReachableTerrain)
+    return waypoint.IsAirport()
+      ? look.airport_reachable_icon
+      : look.field_reachable_icon;
+  else if (reachable == WaypointIconRenderer::ReachableStraight)
+    return waypoint.IsAirport()
+      ? look.airport_marginal_icon
+      : look.field_marginal_icon;
+  else
+    return waypoint.IsAirport()
+      ? look.airport_unreachable_icon
+      : look.field_unreachable_icon;
+}
+
 static void
 DrawLandableBase(Canvas &canvas, const PixelPoint &pt, bool airport,
                  const double radius)
@@ -123,22 +142,7 @@ WaypointIconRenderer::DrawLandable(const Waypoint &waypoint,
 {
 
   if (!settings.vector_landable_rendering) {
-    const MaskedIcon *icon;
-
-    if (reachable == ReachableTerrain)
-      icon = waypoint.IsAirport()
-        ? &look.airport_reachable_icon
-        : &look.field_reachable_icon;
-    else if (reachable == ReachableStraight)
-      icon = waypoint.IsAirport()
-        ? &look.airport_marginal_icon
-        : &look.field_marginal_icon;
-    else
-      icon = waypoint.IsAirport()
-        ? &look.airport_unreachable_icon
-        : &look.field_unreachable_icon;
-
-    icon->Draw(canvas, point);
+    GetLandableIcon(look, waypoint, reachable).Draw(canvas, point);
     return;
   }
 
@@ -212,3 +216,16 @@ WaypointIconRenderer::Draw(const Waypoint &waypoint, const PixelPoint &point,
     // non landable turnpoint
     GetWaypointIcon(look, waypoint, small_icons, in_task).Draw(canvas, point);
 }
+
+const MaskedIcon *
+WaypointIconRenderer::GetIcon(const Waypoint &waypoint,
+                              Reachability reachable, bool in_task) const
+{
+  if (!waypoint.IsLandable())
+    return &GetWaypointIcon(look, waypoint, small_icons, in_task);
+
+  if (!settings.vector_landable_rendering)
+    return &GetLandableIcon(look, waypoint, reachable);
+
+  return nullptr;
+}
@@ -25,12 +25,14 @@ Copyright_License {
 #define XCSOAR_WAYPOINT_ICON_RENDERER_HPP
 
 #include "Math/Angle.hpp"
+#include "Compiler.h"
 
 struct PixelPoint;
 struct WaypointRendererSettings;
 struct WaypointLook;
 class Canvas;
 struct Waypoint;
+class MaskedIcon;
 
 class WaypointIconRenderer
 {
@@ -60,6 +62,16 @@ public:
   void Draw(const Waypoint &waypoint, const PixelPoint &point,
             Reachability reachable = Unreachable, bool in_task = false);
 
+  /**
+   * Returns the icon which Draw() paints for the given waypoint, or
+   * nullptr if it is rendered with vector shapes.  Callers may use
+   * this to draw many waypoints with MaskedIcon's batch method.
+   */
+  gcc_pure
+  const MaskedIcon *GetIcon(const Waypoint &waypoint,
+                            Reachability reachable = Unreachable,
+                            bool in_task = false) const;
+
 private:
   void DrawLandable(const Waypoint &waypoint, const PixelPoint &point,
                     Reachability reachable = Unreachable);
@@ -50,6 +50,10 @@ Copyright_License {
 #include "NMEA/Derived.hpp"
 #include "Engine/Route/ReachResult.hpp"
 #include "Look/WaypointLook.hpp"
+#include "Screen/Icon.hpp"
+
+#include <algorithm>
+#include <functional>
 
 #include <assert.h>
 #include <stdio.h>
@@ -129,15 +133,14 @@ struct VisibleWaypoint {
     else
       reachable = WaypointRenderer::ReachableTerrain;
   }
+};
 
-  void DrawSymbol(const struct WaypointRendererSettings &settings,
-                  const WaypointLook &look,
-                  Canvas &canvas, bool small_icons, Angle screen_rotation) const {
-    WaypointIconRenderer wir(settings, look,
-                             canvas, small_icons, screen_rotation);
-    wir.Draw(*waypoint, point, (WaypointIconRenderer::Reachability)reachable,
-             in_task);
-  }
+/**
+ * An icon which is about to be drawn at a waypoint's position.
+ */
+struct IconInstance {
+  const MaskedIcon *icon;
+  PixelPoint point;
 };
 
 class WaypointVisitorMap final
@@ -285,14 +288,50 @@ protected:
     StringFormatUnsafe(buffer + length, _T("%d%s"), uah_glide, altitude_unit);
   }
 
-  void DrawWaypoint(Canvas &canvas, const VisibleWaypoint &vwp) {
+  /**
+   * Draw the symbols of all waypoints.  Vector symbols are drawn
+   * right away; icons are collected and then drawn with one
+   * MaskedIcon::Draw() call per distinct icon.
+   */
+  void DrawSymbols(Canvas &canvas) {
+    WaypointIconRenderer wir(settings, look, canvas,
+                             projection.GetMapScale() > 4000,
+                             projection.GetScreenAngle());
+
+    StaticArray<IconInstance, 256> icons;
+
+    for (const VisibleWaypoint &vwp : waypoints) {
+      const auto reachable =
+        (WaypointIconRenderer::Reachability)vwp.reachable;
+      const MaskedIcon *icon = wir.GetIcon(*vwp.waypoint, reachable,
+                                           vwp.in_task);
+      if (icon != nullptr)
+        icons.append({icon, vwp.point});
+      else
+        wir.Draw(*vwp.waypoint, vwp.point, reachable, vwp.in_task);
+    }
+
+    std::stable_sort(icons.begin(), icons.end(),
+                     [](const IconInstance &a, const IconInstance &b){
+                       return std::less<const MaskedIcon *>()(a.icon, b.icon);
+                     });
+
+    StaticArray<PixelPoint, 256> points;
+    for (auto i = icons.begin(), end = icons.end(); i != end;) {
+      const MaskedIcon &icon = *i->icon;
+
+      points.clear();
+      for (; i != end && i->icon == &icon; ++i)
+        points.append(i->point);
+
+      icon.Draw(canvas, points.begin(), points.size());
+    }
+  }
+
+  void DrawWaypoint(const VisibleWaypoint &vwp) {
     const Waypoint &way_point = *vwp.waypoint;
     bool watchedWaypoint = way_point.flags.watched;
 
-    vwp.DrawSymbol(settings, look, canvas,
-                   projection.GetMapScale() > 4000,
-                   projection.GetScreenAngle());
-
     // Determine whether to draw the waypoint label or not
     switch (settings.label_selection) {
     case WaypointRendererSettings::LabelSelection::NONE:
@@ -389,20 +428,39 @@ public:
     task_valid = true;
   }
 
-  void CalculateRoute(const ProtectedRoutePlanner &route_planner) {
+  void CalculateRoute(const ProtectedRoutePlanner &route_planner,
+                      const Waypoints &way_points,
+                      WaypointRenderer::ReachCache &cache) {
     const ProtectedRoutePlanner::Lease lease(route_planner);
 
+    cache.Update(way_points.GetSerial(), lease->GetReachSerial(),
+                 task_behaviour.safety_height_arrival,
+                 task_behaviour.route_planner.IsReachEnabled());
+
     for (VisibleWaypoint &vwp : waypoints) {
       const Waypoint &way_point = *vwp.waypoint;
 
-      if (way_point.IsLandable() || way_point.flags.watched)
+      if (!way_point.IsLandable() && !way_point.flags.watched)
+        continue;
+
+      auto i = cache.items.find(way_point.id);
+      if (i == cache.items.end()) {
         vwp.CalculateReachability(lease, task_behaviour);
+        cache.items.emplace(way_point.id,
+                            WaypointRenderer::CachedReach{vwp.reach,
+                                                          vwp.reachable});
+      } else {
+        vwp.reach = i->second.reach;
+        vwp.reachable = i->second.reachable;
+      }
     }
   }
 
   void CalculateDirect(const PolarSettings &polar_settings,
                        const TaskBehaviour &task_behaviour,
-                       const DerivedInfo &calculated) {
+                       const DerivedInfo &calculated,
+                       const Waypoints &way_points,
+                       WaypointRenderer::DirectCache &cache) {
     if (!basic.location_available || !basic.NavAltitudeAvailable())
       return;
 
@@ -410,30 +468,53 @@ public:
       task_behaviour.route_planner.reach_polar_mode == RoutePlannerConfig::Polar::TASK
       ? polar_settings.glide_polar_task
       : calculated.glide_polar_safety;
+    const SpeedVector wind = calculated.GetWindOrZero();
+
+    cache.Update(way_points.GetSerial(), basic.location, basic.nav_altitude,
+                 wind, glide_polar, task_behaviour.safety_height_arrival,
+                 task_behaviour.glide.predict_wind_drift);
+
     const MacCready mac_cready(task_behaviour.glide, glide_polar);
 
     for (VisibleWaypoint &vwp : waypoints) {
       const Waypoint &way_point = *vwp.waypoint;
 
-      if (way_point.IsLandable() || way_point.flags.watched)
-        vwp.CalculateReachabilityDirect(basic, calculated.GetWindOrZero(),
+      if (!way_point.IsLandable() && !way_point.flags.watched)
+        continue;
+
+      auto i = cache.items.find(way_point.id);
+      if (i == cache.items.end()) {
+        vwp.CalculateReachabilityDirect(basic, wind,
                                         mac_cready, task_behaviour);
+        cache.items.emplace(way_point.id,
+                            WaypointRenderer::CachedReach{vwp.reach,
+                                                          vwp.reachable});
+      } else {
+        vwp.reach = i->second.reach;
+        vwp.reachable = i->second.reachable;
+      }
     }
   }
 
   void Calculate(const ProtectedRoutePlanner *route_planner,
+                 const Waypoints &way_points,
+                 WaypointRenderer::ReachCache &reach_cache,
+                 WaypointRenderer::DirectCache &direct_cache,
                  const PolarSettings &polar_settings,
                  const TaskBehaviour &task_behaviour,
                  const DerivedInfo &calculated) {
     if (route_planner != nullptr && !route_planner->IsTerrainReachEmpty())
-      CalculateRoute(*route_planner);
+      CalculateRoute(*route_planner, way_points, reach_cache);
     else
-      CalculateDirect(polar_settings, task_behaviour, calculated);
+      CalculateDirect(polar_settings, task_behaviour, calculated,
+                      way_points, direct_cache);
   }
 
   void Draw(Canvas &canvas) {
+    DrawSymbols(canvas);
+
     for (const VisibleWaypoint &vwp : waypoints)
-      DrawWaypoint(canvas, vwp);
+      DrawWaypoint(vwp);
   }
 };
 
@@ -486,7 +567,8 @@ WaypointRenderer::render(Canvas &canvas, LabelBlock &label_block,
   way_points->VisitWithinRange(projection.GetGeoScreenCenter(),
                                  projection.GetScreenDistanceMeters(), v);
 
-  v.Calculate(route_planner, polar_settings, task_behaviour, calculated);
+  v.Calculate(route_planner, *way_points, reach_cache, direct_cache,
+              polar_settings, task_behaviour, calculated);
 
   v.Draw(canvas);
 
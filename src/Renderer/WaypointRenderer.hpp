@@ -25,6 +25,13 @@ Copyright_License {
 #define XCSOAR_WAY_POINT_RENDERER_HPP
 
 #include "Util/NonCopyable.hpp"
+#include "Util/Serial.hpp"
+#include "Engine/Route/ReachResult.hpp"
+#include "Engine/GlideSolvers/GlidePolar.hpp"
+#include "Geo/GeoPoint.hpp"
+#include "Geo/SpeedVector.hpp"
+
+#include <unordered_map>
 
 struct WaypointRendererSettings;
 struct WaypointLook;
@@ -56,12 +63,129 @@ public:
     ReachableTerrain,
   };
 
+  /**
+   * The terrain reach of one waypoint, as obtained from the route
+   * planner.
+   */
+  struct CachedReach {
+    ReachResult reach;
+    Reachability reachable;
+  };
+
+  /**
+   * Remembers the route planner results of the waypoints drawn in
+   * previous frames, indexed by Waypoint::id.  Looking up the reach
+   * fan is expensive, and its result only changes when the route
+   * planner publishes a new reach (see RoutePlanner::GetReachSerial())
+   * or when the parameters below change.
+   */
+  struct ReachCache {
+    std::unordered_map<unsigned, CachedReach> items;
+
+    Serial waypoints_serial, reach_serial;
+    double safety_height;
+    bool reach_enabled;
+
+    bool valid = false;
+
+    /**
+     * Flush the cache unless it was calculated with the given
+     * parameters.
+     */
+    void Update(const Serial &_waypoints_serial,
+                const Serial &_reach_serial,
+                double _safety_height, bool _reach_enabled) {
+      if (valid && _waypoints_serial == waypoints_serial &&
+          _reach_serial == reach_serial &&
+          _safety_height == safety_height &&
+          _reach_enabled == reach_enabled)
+        return;
+
+      items.clear();
+      waypoints_serial = _waypoints_serial;
+      reach_serial = _reach_serial;
+      safety_height = _safety_height;
+      reach_enabled = _reach_enabled;
+      valid = true;
+    }
+
+    void Invalidate() {
+      items.clear();
+      valid = false;
+    }
+  };
+
+  /**
+   * Remembers the straight glide results of the waypoints drawn in
+   * previous frames, indexed by Waypoint::id.  This is used when
+   * there is no terrain reach.  The map is usually redrawn more often
+   * than the aircraft state changes (e.g. while panning or zooming),
+   * and all those frames can share one set of solutions.  The cache
+   * is flushed as soon as one of the inputs below changes.
+   */
+  struct DirectCache {
+    std::unordered_map<unsigned, CachedReach> items;
+
+    Serial waypoints_serial;
+    GeoPoint location;
+    double altitude;
+    SpeedVector wind;
+    GlidePolar glide_polar;
+    double safety_height;
+    bool predict_wind_drift;
+
+    bool valid = false;
+
+    DirectCache():glide_polar(GlidePolar::Invalid()) {}
+
+    /**
+     * Flush the cache unless it was calculated with the given
+     * parameters.
+     */
+    void Update(const Serial &_waypoints_serial,
+                const GeoPoint &_location, double _altitude,
+                const SpeedVector &_wind,
+                const GlidePolar &_glide_polar,
+                double _safety_height, bool _predict_wind_drift) {
+      if (valid && _waypoints_serial == waypoints_serial &&
+          _location == location && _altitude == altitude &&
+          _wind.bearing == wind.bearing && _wind.norm == wind.norm &&
+          _glide_polar == glide_polar &&
+          _safety_height == safety_height &&
+          _predict_wind_drift == predict_wind_drift)
+        return;
+
+      items.clear();
+      waypoints_serial = _waypoints_serial;
+      location = _location;
+      altitude = _altitude;
+      wind = _wind;
+      glide_polar = _glide_polar;
+      safety_height = _safety_height;
+      predict_wind_drift = _predict_wind_drift;
+      valid = true;
+    }
+
+    void Invalidate() {
+      items.clear();
+      valid = false;
+    }
+  };
+
+private:
+  ReachCache reach_cache;
+  DirectCache direct_cache;
+
+public:
+
   WaypointRenderer(const Waypoints *_way_points,
                    const WaypointLook &_look)
     :way_points(_way_points), look(_look) {}
 
   void set_way_points(const Waypoints *_way_points) {
     way_points = _way_points;
+    reach_cache.Invalidate();
+    direct_cache.Invalidate();
   }
 
   void render(Canvas &canvas, LabelBlock &label_block,
@@ -85,6 +85,7 @@ Replay::Start(Path _path)
 
   virtual_time = -1;
   fast_forward = -1;
+  awaiting_calculation = false;
   next_data.Reset();
 
   Timer::Schedule(100);
@@ -114,6 +115,14 @@ Replay::Update()
     if (fast_forward < 0) {
       virtual_time += clock.ElapsedUpdate() * time_scale / 1000;
     } else {
+      const auto &calculated = device_blackboard->GetCalculatedSnapshot();
+      if (awaiting_calculation &&
+          calculated.GetGeneration() == calculated_generation &&
+          !clock.Check(MAX_CALCULATION_WAIT))
+        /* the previous fix has not been processed yet */
+        return true;
+
+      awaiting_calculation = false;
       clock.Update();
 
       virtual_time += 1;
@@ -131,6 +140,12 @@ Replay::Update()
       /* still not time to use next_data */
       return true;
 
+    if (fast_forward >= 0) {
+      calculated_generation =
+        device_blackboard->GetCalculatedSnapshot().GetGeneration();
+      awaiting_calculation = true;
+    }
+
     {
       ScopeLock protect(device_blackboard->mutex);
       device_blackboard->SetReplayState() = next_data;
@@ -225,7 +240,7 @@ Replay::OnTimer()
   if (time_scale <= 0)
     schedule = 1000;
   else if (fast_forward >= 0)
-    schedule = 100;
+    schedule = FAST_FORWARD_INTERVAL;
   else if (virtual_time < 0 || !next_data.time_available)
     schedule = 500;
   else if (cli != nullptr)
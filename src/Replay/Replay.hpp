@@ -38,6 +38,19 @@ class Error;
 class Replay final
   : private Timer
 {
+  /**
+   * The timer interval [ms] while fast-forwarding.  Each tick
+   * advances #virtual_time by one second, once the
+   * CalculationThread has caught up.
+   */
+  static constexpr unsigned FAST_FORWARD_INTERVAL = 10;
+
+  /**
+   * While fast-forwarding, don't wait longer than this [ms] for the
+   * CalculationThread.
+   */
+  static constexpr unsigned MAX_CALCULATION_WAIT = 1000;
+
   double time_scale;
 
   AbstractReplay *replay;
@@ -67,6 +80,16 @@ class Replay final
    */
   PeriodClock clock;
 
+  /**
+   * The generation of DeviceBlackboard::GetCalculatedSnapshot() when
+   * the last fix was submitted during fast-forward.  The next fix is
+   * held back until the CalculationThread has published a new result,
+   * so fast-forward goes as quickly as the computers can follow,
+   * without dropping fixes.
+   */
+  unsigned calculated_generation;
+  bool awaiting_calculation;
+
   /**
    * The last NMEAInfo returned by the #AbstractReplay instance.  It
    * is held back until #virtual_time has passed #next_data.time.
@@ -29,6 +29,8 @@ Copyright_License {
 
 #include <string>
 
+#include <stdint.h>
+
 /**
  * The description of a file that is available in a remote repository.
  */
@@ -51,6 +53,16 @@ struct AvailableFile {
 
   FileType type;
 
+  /**
+   * The size of the file in bytes.  -1 means unknown.
+   */
+  int64_t size;
+
+  /**
+   * The lower-case hex MD5 digest of the file.  Empty means unknown.
+   */
+  NarrowString<33> md5;
+
   bool IsEmpty() const {
     return name.empty();
   }
@@ -64,6 +76,16 @@ struct AvailableFile {
     uri.clear();
     area.clear();
     type = FileType::UNKNOWN;
+    size = -1;
+    md5.clear();
+  }
+
+  /**
+   * Does the repository describe the file contents, so a local copy
+   * can be checked for being current?
+   */
+  bool HasChecksum() const {
+    return size >= 0 || !md5.empty();
   }
 
   const char *GetName() const {
@@ -77,6 +99,13 @@ struct AvailableFile {
   const char *GetArea() const {
     return area;
   }
+
+  /**
+   * @return the MD5 digest or nullptr if unknown
+   */
+  const char *GetMD5() const {
+    return md5.empty() ? nullptr : md5.c_str();
+  }
 };
 
 #endif
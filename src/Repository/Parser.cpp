@@ -25,6 +25,9 @@ Copyright_License {
 #include "FileRepository.hpp"
 #include "IO/LineReader.hpp"
 #include "Util/StringUtil.hpp"
+#include "Util/CharUtil.hpp"
+
+#include <stdlib.h>
 
 static const char *
 ParseLine(char *line)
@@ -46,6 +49,46 @@ ParseLine(char *line)
   return value;
 }
 
+static bool
+ParseSize(const char *value, int64_t &size)
+{
+  char *endptr;
+  const auto n = strtoull(value, &endptr, 10);
+  if (endptr == value || *endptr != 0)
+    return false;
+
+  size = int64_t(n);
+  return size >= 0;
+}
+
+gcc_const
+static bool
+IsHexDigit(char ch)
+{
+  return IsDigitASCII(ch) || (ch >= 'a' && ch <= 'f') ||
+    (ch >= 'A' && ch <= 'F');
+}
+
+static bool
+ParseMD5(const char *value, NarrowString<33> &md5)
+{
+  char buffer[33];
+  unsigned n = 0;
+  for (const char *p = value; *p != 0; ++p) {
+    if (n >= 32 || !IsHexDigit(*p))
+      return false;
+
+    buffer[n++] = ToLowerASCII(*p);
+  }
+
+  if (n != 32)
+    return false;
+
+  buffer[n] = 0;
+  md5 = buffer;
+  return true;
+}
+
 static bool
 Commit(FileRepository &repository, AvailableFile &file)
 {
@@ -96,6 +139,11 @@ ParseFileRepository(FileRepository &repository, NLineReader &reader)
         file.type = FileType::MAP;
       else if (StringIsEqual(value, "flarmnet"))
         file.type = FileType::FLARMNET;
+    } else if (StringIsEqual(name, "size")) {
+      /* ignore malformed values, the file is just not checked */
+      ParseSize(value, file.size);
+    } else if (StringIsEqual(name, "md5")) {
+      ParseMD5(value, file.md5);
     }
   }
 
@@ -137,6 +137,13 @@ TopWindow::OnResume()
   Invalidate();
 }
 
+void
+TopWindow::OnLowMemory()
+{
+  /* the text textures get rendered again when they are needed */
+  TextCache::Flush();
+}
+
 static bool
 match_pause_and_resume(const Event &event, void *ctx)
 {
@@ -161,6 +168,12 @@ TopWindow::Resume()
   event_queue->Push(Event::RESUME);
 }
 
+void
+TopWindow::LowMemory()
+{
+  event_queue->Push(Event::LOW_MEMORY);
+}
+
 bool
 TopWindow::OnEvent(const Event &event)
 {
@@ -234,6 +247,10 @@ TopWindow::OnEvent(const Event &event)
   case Event::RESUME:
     OnResume();
     return true;
+
+  case Event::LOW_MEMORY:
+    OnLowMemory();
+    return true;
   }
 
   return false;
@@ -22,6 +22,7 @@ Copyright_License {
 */
 
 #include "Screen/Bitmap.hpp"
+#include "ImageDecoder.hpp"
 #include "Screen/Debug.hpp"
 #include "OS/Path.hpp"
 
@@ -53,7 +54,7 @@ Bitmap::Load(ConstBuffer<void> buffer, Type type)
   return uncompressed.IsDefined() && Load(std::move(uncompressed), type);
 }
 
-static UncompressedImage
+UncompressedImage
 DecompressImageFile(Path path)
 {
 #ifdef USE_LIBTIFF
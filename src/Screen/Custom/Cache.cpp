@@ -194,15 +194,20 @@ static Mutex text_cache_mutex;
 #endif
 
 static Cache<TextCacheKey, PixelSize, 1024u, TextCacheKey::Hash> size_cache;
-static Cache<TextCacheKey, RenderedText, 256u, TextCacheKey::Hash> text_cache;
+/**
+ * The rendered texts.  This must be large enough to hold all labels
+ * of one frame (map labels, InfoBoxes, gauges), or else they get
+ * evicted and rendered again in each frame.
+ */
+static Cache<TextCacheKey, RenderedText, 512u, TextCacheKey::Hash> text_cache;
 
-PixelSize
-TextCache::GetSize(const Font &font, const char *text)
+/**
+ * Look up the size of the text in #size_cache, and measure and
+ * insert it on a miss.  The caller must hold #text_cache_mutex.
+ */
+static PixelSize
+GetSizeLocked(const Font &font, const char *text)
 {
-#ifndef ENABLE_OPENGL
-  const ScopeLock protect(text_cache_mutex);
-#endif
-
   TextCacheKey key(font, text);
   const PixelSize *cached = size_cache.Get(key);
   if (cached != nullptr)
@@ -219,6 +224,16 @@ TextCache::GetSize(const Font &font, const char *text)
   return size;
 }
 
+PixelSize
+TextCache::GetSize(const Font &font, const char *text)
+{
+#ifndef ENABLE_OPENGL
+  const ScopeLock protect(text_cache_mutex);
+#endif
+
+  return GetSizeLocked(font, text);
+}
+
 PixelSize
 TextCache::LookupSize(const Font &font, const char *text)
 {
@@ -280,7 +295,9 @@ TextCache::Get(const Font &font, const char *text)
 #else
   const TCHAR* text2 = text;
 #endif
-  PixelSize size = font.TextSize(text2);
+  /* labels which were measured (by the layout code) before being
+     drawn don't need to be measured again */
+  const PixelSize size = GetSizeLocked(font, text);
   size_t buffer_size = font.BufferSize(size);
   if (buffer_size == 0) {
 #ifdef ENABLE_OPENGL
@@ -30,7 +30,6 @@ Copyright_License {
 #include <stdexcept>
 
 #include <tchar.h>
-#include <assert.h>
 #include <stdio.h>
 #include <stddef.h>
 
@@ -38,6 +37,14 @@ extern "C" {
 #include <jpeglib.h>
 }
 
+/**
+ * Images larger than this (in either dimension) are scaled down by a
+ * power of two while decoding.  That is much cheaper than decoding
+ * the full resolution, and no screen XCSoar runs on could show more
+ * pixels anyway.
+ */
+static constexpr unsigned MAX_SIZE = 2048;
+
 [[noreturn]]
 static void
 JpegErrorExit(j_common_ptr cinfo)
@@ -74,6 +81,16 @@ LoadJPEGFile(Path path)
 
   cinfo.out_color_space = JCS_RGB;
   cinfo.quantize_colors = (boolean)false;
+
+  /* let the IDCT scale huge images down; libjpeg supports the
+     factors 1/2, 1/4 and 1/8 */
+  cinfo.scale_num = 1;
+  cinfo.scale_denom = 1;
+  while (cinfo.scale_denom < 8 &&
+         std::max(cinfo.image_width, cinfo.image_height) >
+         MAX_SIZE * cinfo.scale_denom)
+    cinfo.scale_denom *= 2;
+
   jpeg_calc_output_dimensions(&cinfo);
 
   jpeg_start_decompress(&cinfo);
@@ -83,24 +100,22 @@ LoadJPEGFile(Path path)
 
   const size_t row_size = 3 * width;
   const size_t image_buffer_size = row_size * height;
-  const size_t row_buffer_size = row_size;
-  /* allocate a buffer that holds the uncompressed image plus a row
-     buffer with packed 24 bit samples (for libjpeg) */
-  std::unique_ptr<uint8_t[]> image_buffer(new uint8_t[image_buffer_size
-                                                      + row_buffer_size]);
+  std::unique_ptr<uint8_t[]> image_buffer(new uint8_t[image_buffer_size]);
 
-  uint8_t *const row = image_buffer.get() + image_buffer_size;
-  JSAMPROW rowptr[1] = { row };
+  /* JCS_RGB produces packed 24 bit samples, which is exactly our
+     format, so libjpeg can write directly into the image buffer, a
+     few rows at a time */
+  constexpr unsigned MAX_ROWS = 16;
+  JSAMPROW rowptr[MAX_ROWS];
 
-  uint8_t *p = image_buffer.get();
   while (cinfo.output_scanline < height) {
-    jpeg_read_scanlines(&cinfo, rowptr, (JDIMENSION)1);
+    const unsigned n = std::min(height - cinfo.output_scanline, MAX_ROWS);
+    for (unsigned i = 0; i < n; ++i)
+      rowptr[i] = image_buffer.get() + (cinfo.output_scanline + i) * row_size;
 
-    p = std::copy_n(row, row_size, p);
+    jpeg_read_scanlines(&cinfo, rowptr, (JDIMENSION)n);
   }
 
-  assert(p == image_buffer.get() + image_buffer_size);
-
   jpeg_finish_decompress(&cinfo);
 
   return UncompressedImage(UncompressedImage::Format::RGB,
@@ -39,6 +39,12 @@ Copyright_License {
 #include <xtiffio.h>
 #endif
 
+/**
+ * If the file contains reduced-resolution versions of the image, the
+ * largest one whose dimensions do not exceed this value is decoded.
+ */
+static constexpr uint32 MAX_OVERVIEW_SIZE = 4096;
+
 static TIFF *
 TiffOpen(Path path, const char *mode)
 {
@@ -75,6 +81,15 @@ public:
     TIFFGetField(tiff, tag, &value_r);
   }
 
+  /**
+   * Select the image directory to be decoded.  Large GeoTIFF files
+   * often contain "overviews" (reduced-resolution copies of the
+   * image, e.g. created by gdaladdo); pick the largest one which fits
+   * in the given size, or the smallest one if none fits.  Without
+   * overviews, this selects the main image.
+   */
+  void SelectDirectory(uint32 max_size);
+
   void RGBAImageBegin(TIFFRGBAImage &img) {
     char emsg[1024];
     if (!TIFFRGBAImageBegin(&img, tiff, 0, emsg))
@@ -82,6 +97,47 @@ public:
   }
 };
 
+void
+TiffLoader::SelectDirectory(uint32 max_size)
+{
+  const tdir_t n = TIFFNumberOfDirectories(tiff);
+
+  tdir_t best = 0;
+  uint32 best_width = 0;
+  bool best_fits = false;
+
+  for (tdir_t i = 0; i < n; ++i) {
+    if (!TIFFSetDirectory(tiff, i))
+      break;
+
+    if (i > 0) {
+      /* skip other pages and transparency masks, only overviews of
+         the main image are interesting */
+      uint32 type;
+      if (!TIFFGetField(tiff, TIFFTAG_SUBFILETYPE, &type) ||
+          (type & FILETYPE_REDUCEDIMAGE) == 0 ||
+          (type & FILETYPE_MASK) != 0)
+        continue;
+    }
+
+    uint32 width, height;
+    if (!TIFFGetField(tiff, TIFFTAG_IMAGEWIDTH, &width) ||
+        !TIFFGetField(tiff, TIFFTAG_IMAGELENGTH, &height))
+      continue;
+
+    const bool fits = width <= max_size && height <= max_size;
+    if (i == 0 ||
+        (fits && (!best_fits || width > best_width)) ||
+        (!best_fits && !fits && width < best_width)) {
+      best = i;
+      best_width = width;
+      best_fits = fits;
+    }
+  }
+
+  TIFFSetDirectory(tiff, best);
+}
+
 static UncompressedImage
 LoadTiff(TIFFRGBAImage &img)
 {
@@ -101,6 +157,8 @@ LoadTiff(TIFFRGBAImage &img)
 static UncompressedImage
 LoadTiff(TiffLoader &tiff)
 {
+  tiff.SelectDirectory(MAX_OVERVIEW_SIZE);
+
   TIFFRGBAImage img;
   tiff.RGBAImageBegin(img);
 
@@ -186,6 +186,25 @@ class TopCanvas
    * this flag can be set true for don't wait eInk Update complete for faster responce time.
    */
   bool frame_sync = false;
+
+  /**
+   * The maximum number of e-ink updates sent by one Flip() call.
+   */
+  static constexpr unsigned MAX_DIRTY_RECTS = 4;
+
+  /**
+   * A copy of the frame that was last sent to the e-ink controller.
+   * Flip() compares the new frame with it and updates only the areas
+   * of the screen that have changed.
+   */
+  WritableImageBuffer<GreyscalePixelTraits> previous =
+    WritableImageBuffer<GreyscalePixelTraits>::Empty();
+
+  /**
+   * Does #previous show what is on the screen?  If not, the next
+   * Flip() updates the whole screen.
+   */
+  bool previous_valid = false;
 #endif
 
 public:
@@ -303,6 +322,10 @@ public:
   void Wait();
 
   void SetEnableDither(bool _enable_dither) {
+    if (_enable_dither != enable_dither)
+      /* the whole screen looks different now */
+      previous_valid = false;
+
     enable_dither = _enable_dither;
   }
 #endif
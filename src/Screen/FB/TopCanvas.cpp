@@ -84,6 +84,11 @@ TopCanvas::Destroy()
 {
   buffer.Free();
 
+#ifdef KOBO
+  previous.Free();
+  previous_valid = false;
+#endif
+
 #ifdef USE_FB
 #ifdef USE_TTY
   DeinitialiseTTY();
@@ -269,6 +274,11 @@ TopCanvas::CheckResize(const PixelSize new_native_size)
 
   buffer.Free();
   buffer.Allocate(new_size.cx, new_size.cy);
+
+#ifdef KOBO
+  previous_valid = false;
+#endif
+
   return true;
 }
 
@@ -283,18 +293,108 @@ TopCanvas::Unlock()
 {
 }
 
+#ifdef KOBO
+
+/**
+ * Compare the new frame with the one that was sent to the e-ink
+ * controller last time, and collect the rectangles that have
+ * changed.  Changed rows which are closer than #MERGE_GAP are merged
+ * into one rectangle, to avoid flooding the controller with tiny
+ * updates.  The changes are copied to #previous.
+ *
+ * @return the number of rectangles stored in #dest
+ */
+static unsigned
+FindDirtyRects(const WritableImageBuffer<GreyscalePixelTraits> &current,
+               WritableImageBuffer<GreyscalePixelTraits> &previous,
+               PixelRect *dest, unsigned max_rects)
+{
+  constexpr unsigned MERGE_GAP = 32;
+
+  const unsigned width = current.width;
+  unsigned n = 0;
+
+  for (unsigned y = 0; y < current.height; ++y) {
+    const uint8_t *a = (const uint8_t *)current.At(0, y);
+    uint8_t *b = (uint8_t *)previous.At(0, y);
+    if (memcmp(a, b, width) == 0)
+      continue;
+
+    unsigned left = 0;
+    while (a[left] == b[left])
+      ++left;
+
+    unsigned right = width;
+    while (a[right - 1] == b[right - 1])
+      --right;
+
+    memcpy(b + left, a + left, right - left);
+
+    if (n > 0 &&
+        (n == max_rects || y < unsigned(dest[n - 1].bottom) + MERGE_GAP)) {
+      PixelRect &rc = dest[n - 1];
+      rc.left = std::min(rc.left, int(left));
+      rc.right = std::max(rc.right, int(right));
+      rc.bottom = y + 1;
+    } else
+      dest[n++] = PixelRect(left, y, right, y + 1);
+  }
+
+  return n;
+}
+
+#endif
+
 void
 TopCanvas::Flip()
 {
 #ifdef USE_FB
 
-#ifdef GREYSCALE
+#ifdef KOBO
+  PixelRect dirty[MAX_DIRTY_RECTS];
+  unsigned n_dirty;
+  if (previous_valid) {
+    n_dirty = FindDirtyRects(buffer, previous, dirty, MAX_DIRTY_RECTS);
+    if (n_dirty == 0)
+      /* nothing has changed */
+      return;
+  } else {
+    if (previous.data == nullptr || previous.width != buffer.width ||
+        previous.height != buffer.height) {
+      previous.Free();
+      previous.Allocate(buffer.width, buffer.height);
+    }
+
+    for (unsigned y = 0; y < buffer.height; ++y)
+      std::copy_n(buffer.At(0, y), buffer.width, previous.At(0, y));
+
+    previous_valid = true;
+
+    dirty[0] = PixelRect(0, 0, buffer.width, buffer.height);
+    n_dirty = 1;
+  }
+#endif
+
+#ifdef KOBO
+  /* convert (and dither) only the areas which will be sent to the
+     e-ink controller; the rest of the frame buffer still contains
+     the previous frame */
+  for (unsigned i = 0; i < n_dirty; ++i) {
+    const PixelRect &rc = dirty[i];
+
+    CopyFromGreyscale(dither, enable_dither,
+                      (uint8_t *)map + rc.top * map_pitch
+                      + rc.left * map_bpp,
+                      map_pitch, map_bpp,
+                      ConstImageBuffer<GreyscalePixelTraits>(buffer.At(rc.left, rc.top),
+                                                             buffer.pitch,
+                                                             rc.GetWidth(),
+                                                             rc.GetHeight()));
+  }
+#elif defined(GREYSCALE)
   CopyFromGreyscale(
 #ifdef DITHER
                     dither,
-#endif
-#ifdef KOBO
-                    enable_dither,
 #endif
                     map, map_pitch, map_bpp,
                     buffer);
@@ -307,27 +407,35 @@ TopCanvas::Flip()
   if (frame_sync)
     Wait();
 
-  epd_update_marker++;
-
-  struct mxcfb_update_data epd_update_data = {
-    {
-      0, 0, buffer.width, buffer.height
-    },
-
-    uint32_t(enable_dither &&
-             (/* use A2 mode only on some Kobo models */
-              DetectKoboModel() == KoboModel::TOUCH2 ||
-              DetectKoboModel() == KoboModel::GLO_HD ||
-              DetectKoboModel() == KoboModel::AURA2)
-             ? WAVEFORM_MODE_A2
-             : WAVEFORM_MODE_AUTO),
-    UPDATE_MODE_FULL, // PARTIAL
-    epd_update_marker,
-    TEMP_USE_AMBIENT,
-    enable_dither ? EPDC_FLAG_FORCE_MONOCHROME : 0,
-  };
-
-  ioctl(fd, MXCFB_SEND_UPDATE, &epd_update_data);
+  const uint32_t waveform_mode =
+    enable_dither &&
+    (/* use A2 mode only on some Kobo models */
+     DetectKoboModel() == KoboModel::TOUCH2 ||
+     DetectKoboModel() == KoboModel::GLO_HD ||
+     DetectKoboModel() == KoboModel::AURA2)
+    ? WAVEFORM_MODE_A2
+    : WAVEFORM_MODE_AUTO;
+
+  for (unsigned i = 0; i < n_dirty; ++i) {
+    const PixelRect &rc = dirty[i];
+
+    epd_update_marker++;
+
+    struct mxcfb_update_data epd_update_data = {
+      {
+        uint32_t(rc.top), uint32_t(rc.left),
+        uint32_t(rc.right - rc.left), uint32_t(rc.bottom - rc.top),
+      },
+
+      waveform_mode,
+      UPDATE_MODE_FULL, // PARTIAL
+      epd_update_marker,
+      TEMP_USE_AMBIENT,
+      enable_dither ? EPDC_FLAG_FORCE_MONOCHROME : 0,
+    };
+
+    ioctl(fd, MXCFB_SEND_UPDATE, &epd_update_data);
+  }
 #endif
 
 #endif /* USE_FB */
@@ -24,6 +24,8 @@ Copyright_License {
 #include "Screen/Icon.hpp"
 #include "Screen/Layout.hpp"
 #include "Screen/Canvas.hpp"
+#include "Thread/Mutex.hpp"
+#include "Util/Macros.hpp"
 
 #ifdef ENABLE_OPENGL
 #include "Screen/OpenGL/Texture.hpp"
@@ -61,9 +63,35 @@ IconStretchInteger(unsigned source_dpi)
 
 #endif
 
+/**
+ * Serialises MaskedIcon::Decode() calls.
+ */
+static Mutex decode_mutex;
+
 void
-MaskedIcon::LoadResource(ResourceId id, ResourceId big_id, bool center)
+MaskedIcon::LoadResource(ResourceId _id, ResourceId _big_id, bool _center)
 {
+  assert(_id.IsDefined());
+
+  Reset();
+
+  id = _id;
+  big_id = _big_id;
+  center = _center;
+}
+
+void
+MaskedIcon::Decode() const
+{
+  assert(IsDefined());
+
+  const ScopeLock protect(decode_mutex);
+  if (loaded.load(std::memory_order_relaxed))
+    /* another thread was faster */
+    return;
+
+  ResourceId id = this->id;
+
 #ifdef ENABLE_OPENGL
   unsigned stretch = 1024;
 #endif
@@ -85,7 +113,7 @@ MaskedIcon::LoadResource(ResourceId id, ResourceId big_id, bool center)
   } else
     bitmap.Load(id);
 
-  assert(IsDefined());
+  assert(bitmap.IsDefined());
 
   size = bitmap.GetSize();
 #ifdef ENABLE_OPENGL
@@ -104,6 +132,8 @@ MaskedIcon::LoadResource(ResourceId id, ResourceId big_id, bool center)
     origin.x = 0;
     origin.y = 0;
   }
+
+  loaded.store(true, std::memory_order_release);
 }
 
 void
@@ -111,6 +141,8 @@ MaskedIcon::Draw(Canvas &canvas, PixelPoint p) const
 {
   assert(IsDefined());
 
+  EnsureLoaded();
+
   p -= origin;
 
 #ifdef ENABLE_OPENGL
@@ -142,9 +174,53 @@ MaskedIcon::Draw(Canvas &canvas, PixelPoint p) const
 #endif
 }
 
+void
+MaskedIcon::Draw(Canvas &canvas, const PixelPoint *points, unsigned n) const
+{
+  assert(IsDefined());
+
+  EnsureLoaded();
+
+#ifdef ENABLE_OPENGL
+  if (n == 0)
+    return;
+
+#ifdef USE_GLSL
+  OpenGL::texture_shader->Use();
+#else
+  const GLEnable<GL_TEXTURE_2D> scope;
+  OpenGL::glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_REPLACE);
+#endif
+
+  const ScopeAlphaBlend alpha_blend;
+
+  /* shift all positions by the origin in chunks */
+  PixelPoint shifted[64];
+
+  GLTexture &texture = *bitmap.GetNative();
+  texture.Bind();
+
+  while (n > 0) {
+    const unsigned chunk = std::min(n, unsigned(ARRAY_SIZE(shifted)));
+    for (unsigned i = 0; i < chunk; ++i)
+      shifted[i] = points[i] - origin;
+
+    texture.Draw(shifted, chunk, size, texture.GetRect());
+
+    points += chunk;
+    n -= chunk;
+  }
+#else
+  for (unsigned i = 0; i < n; ++i)
+    Draw(canvas, points[i]);
+#endif
+}
+
 void
 MaskedIcon::Draw(Canvas &canvas, const PixelRect &rc, bool inverse) const
 {
+  EnsureLoaded();
+
   const PixelPoint position = rc.CenteredTopLeft(size);
 
 #ifdef ENABLE_OPENGL
@@ -28,38 +28,73 @@ Copyright_License {
 #include "Screen/Point.hpp"
 #include "ResourceId.hpp"
 
+#include <atomic>
+
 class Canvas;
 
 /**
  * An icon with a mask which marks transparent pixels.
+ *
+ * LoadResource() only remembers the resource; the bitmap is decoded
+ * when the icon is first drawn or measured.  Most Look classes load
+ * many icons which a given configuration never shows, and this way
+ * startup only pays for the ones that are actually used.  Decoding
+ * is serialised, because (without OpenGL) the #DrawThread and the
+ * main thread may draw the same icon.
  */
 class MaskedIcon {
 protected:
-  Bitmap bitmap;
+  mutable Bitmap bitmap;
+
+  mutable PixelSize size;
+
+  mutable PixelPoint origin;
+
+  ResourceId id = ResourceId::Null(), big_id = ResourceId::Null();
 
-  PixelSize size;
+  bool center;
 
-  PixelPoint origin;
+  /**
+   * Has #bitmap been decoded, and are #size and #origin valid?
+   */
+  mutable std::atomic<bool> loaded{false};
 
 public:
   const PixelSize &GetSize() const {
+    EnsureLoaded();
     return size;
   }
 
   bool IsDefined() const {
-    return bitmap.IsDefined();
+    return id.IsDefined();
   }
 
   void LoadResource(ResourceId id, ResourceId big_id = ResourceId::Null(),
                     bool center=true);
 
   void Reset() {
+    id = big_id = ResourceId::Null();
+    loaded.store(false, std::memory_order_relaxed);
     bitmap.Reset();
   }
 
   void Draw(Canvas &canvas, PixelPoint p) const;
 
+  /**
+   * Draw this icon at several positions.  On OpenGL, this is much
+   * cheaper than calling Draw() for each of them.
+   */
+  void Draw(Canvas &canvas, const PixelPoint *points, unsigned n) const;
+
   void Draw(Canvas &canvas, const PixelRect &rc, bool inverse) const;
+
+private:
+  void EnsureLoaded() const {
+    if (!loaded.load(std::memory_order_acquire))
+      Decode();
+  }
+
+  void Decode() const;
 };
 
 #endif
@@ -30,7 +30,9 @@ Copyright_License {
 #include "NEON.hpp"
 #endif
 
-#ifdef __MMX__
+#ifdef __SSE2__
+#include "SSE2.hpp"
+#elif defined(__MMX__)
 #include "MMX.hpp"
 #endif
 
@@ -136,7 +138,31 @@ public:
 
 #endif
 
-#ifdef __MMX__
+#ifdef __SSE2__
+
+template<>
+class AlphaPixelOperations<GreyscalePixelTraits>
+  : public SelectOptimisedPixelOperations<SSE2AlphaPixelOperations, 16,
+                                          PortableAlphaPixelOperations<GreyscalePixelTraits>> {
+public:
+  explicit constexpr AlphaPixelOperations(const uint8_t alpha)
+    :SelectOptimisedPixelOperations(alpha) {}
+};
+
+#ifndef GREYSCALE
+
+template<>
+class AlphaPixelOperations<BGRAPixelTraits>
+  : public SelectOptimisedPixelOperations<SSE2AlphaPixelOperations, 4,
+                                          PortableAlphaPixelOperations<BGRAPixelTraits>> {
+public:
+  explicit constexpr AlphaPixelOperations(const uint8_t alpha)
+    :SelectOptimisedPixelOperations(alpha) {}
+};
+
+#endif /* !GREYSCALE */
+
+#elif defined(__MMX__)
 
 template<>
 class AlphaPixelOperations<GreyscalePixelTraits>
@@ -42,14 +42,31 @@ Copyright_License {
 
 #include <assert.h>
 
+/**
+ * Reallocate the texture's storage with an alpha channel.
+ */
+static void
+AllocateAlpha(GLTexture &texture)
+{
+  const PixelSize size = texture.GetAllocatedSize();
+
+  texture.Bind();
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, size.cx, size.cy,
+               0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+}
+
 void
-BufferCanvas::Create(PixelSize new_size)
+BufferCanvas::Create(PixelSize new_size, bool _alpha)
 {
   assert(!active);
 
   Destroy();
   texture = new GLTexture(new_size, true);
 
+  alpha = _alpha;
+  if (alpha)
+    AllocateAlpha(*texture);
+
   if (OpenGL::frame_buffer_object && OpenGL::render_buffer_stencil) {
     frame_buffer = new GLFrameBuffer();
 
@@ -91,7 +108,12 @@ BufferCanvas::Resize(PixelSize new_size)
   if (new_size == GetSize())
     return;
 
+  const PixelSize old_allocated_size = texture->GetAllocatedSize();
   texture->ResizeDiscard(new_size);
+  if (alpha && texture->GetAllocatedSize() != old_allocated_size)
+    /* ResizeDiscard() has reallocated the texture without alpha
+       channel */
+    AllocateAlpha(*texture);
 
   if (stencil_buffer != nullptr) {
     /* the stencil buffer must be detached before we resize it */
@@ -47,6 +47,11 @@ class BufferCanvas : public Canvas, private GLSurfaceListener {
 
   GLRenderBuffer *stencil_buffer = nullptr;
 
+  /**
+   * Does the texture have an alpha channel?  See Create().
+   */
+  bool alpha = false;
+
 #ifdef HAVE_GLES
   GLint old_viewport[4];
 #endif
@@ -75,7 +80,13 @@ public:
     return texture != nullptr;
   }
 
-  void Create(PixelSize new_size);
+  /**
+   * @param _alpha allocate a texture with an alpha channel; this is
+   * only useful if a frame buffer object is available (see
+   * HasFrameBuffer()), because otherwise the buffer is a copy of the
+   * screen
+   */
+  void Create(PixelSize new_size, bool _alpha=false);
 
   void Create(const Canvas &canvas, PixelSize new_size) {
     assert(canvas.IsDefined());
@@ -89,6 +100,14 @@ public:
 
   void Destroy();
 
+  /**
+   * Is this buffer backed by a frame buffer object?  If not, painting
+   * happens on the screen, and Commit() copies the screen contents.
+   */
+  bool HasFrameBuffer() const {
+    return frame_buffer != nullptr;
+  }
+
   void Resize(PixelSize new_size);
 
   /**
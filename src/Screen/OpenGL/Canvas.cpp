@@ -167,8 +167,17 @@ Canvas::DrawPolyline(const BulkPixelPoint *points, unsigned num_points)
 
   pen.Bind();
 
-  const ScopeVertexPointer vp(points);
-  glDrawArrays(GL_LINE_STRIP, 0, num_points);
+  if (pen.GetWidth() > 2) {
+    unsigned strip_len = LineToTriangles(points, num_points, vertex_buffer,
+                                         pen.GetWidth(), false, true);
+    if (strip_len > 0) {
+      const ScopeVertexPointer vp(vertex_buffer.begin());
+      glDrawArrays(GL_TRIANGLE_STRIP, 0, strip_len);
+    }
+  } else {
+    const ScopeVertexPointer vp(points);
+    glDrawArrays(GL_LINE_STRIP, 0, num_points);
+  }
 
   pen.Unbind();
 }
@@ -249,6 +258,22 @@ Canvas::DrawTriangleFan(const BulkPixelPoint *points, unsigned num_points)
   }
 }
 
+void
+Canvas::DrawTriangles(const BulkPixelPoint *points,
+                      const GLushort *indices, unsigned num_indices)
+{
+  if (brush.IsHollow() || num_indices == 0)
+    return;
+
+#ifdef USE_GLSL
+  OpenGL::solid_shader->Use();
+#endif
+
+  const ScopeVertexPointer vp(points);
+  brush.Bind();
+  glDrawElements(GL_TRIANGLES, num_indices, GL_UNSIGNED_SHORT, indices);
+}
+
 void
 Canvas::DrawHLine(int x1, int x2, int y, Color color)
 {
@@ -278,6 +278,16 @@ public:
    */
   void DrawTriangleFan(const BulkPixelPoint *points, unsigned num_points);
 
+  /**
+   * Fill triangles (GL_TRIANGLES) with the current brush.  The pen is
+   * ignored.
+   *
+   * @param indices three indices into #points per triangle, e.g.
+   * calculated by PolygonToTriangles()
+   */
+  void DrawTriangles(const BulkPixelPoint *points,
+                     const GLushort *indices, unsigned num_indices);
+
   /**
    * Draw a solid thin horizontal line.
    */
@@ -78,13 +78,35 @@ public:
 class GLProgram {
   const GLuint id;
 
+  /**
+   * The program most recently installed by Use().  Nearly every
+   * #Canvas primitive calls Use(), and this allows skipping the
+   * glUseProgram() call if the program is already installed, which
+   * is the common case.
+   */
+  static GLuint &GetCurrentId() {
+    static GLuint current_id;
+    return current_id;
+  }
+
 public:
   GLProgram():id(glCreateProgram()) {}
 
   ~GLProgram() {
+    if (GetCurrentId() == id)
+      GetCurrentId() = 0;
+
     glDeleteProgram(id);
   }
 
+  /**
+   * Forget which program is installed.  Call this after a new
+   * OpenGL context has been created.
+   */
+  static void InvalidateCurrent() {
+    GetCurrentId() = 0;
+  }
+
   GLuint GetId() const {
     return id;
   }
@@ -120,7 +142,10 @@ public:
   }
 
   void Use() {
-    glUseProgram(id);
+    if (GetCurrentId() != id) {
+      glUseProgram(id);
+      GetCurrentId() = id;
+    }
   }
 
   gcc_pure
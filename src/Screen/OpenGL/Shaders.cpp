@@ -44,6 +44,12 @@ namespace OpenGL {
 
   GLProgram *combine_texture_shader;
   GLint combine_texture_projection, combine_texture_texture;
+
+  GLProgram *terrain_shader;
+  GLint terrain_projection, terrain_texture, terrain_ramp;
+  GLint terrain_step, terrain_texel, terrain_limit;
+  GLint terrain_sun, terrain_slope_z, terrain_contrast;
+  GLint terrain_height_scale, terrain_contour_scale, terrain_shading;
 }
 
 #ifdef HAVE_GLES
@@ -54,6 +60,18 @@ namespace OpenGL {
 #define GLSL_PRECISION
 #endif
 
+#ifdef HAVE_GLES
+/* the terrain shader needs to reconstruct 16 bit integers */
+#define GLSL_HIGH_PRECISION \
+  "#ifdef GL_FRAGMENT_PRECISION_HIGH\n" \
+  "precision highp float;\n" \
+  "#else\n" \
+  "precision mediump float;\n" \
+  "#endif\n"
+#else
+#define GLSL_HIGH_PRECISION
+#endif
+
 static constexpr char solid_vertex_shader[] =
   GLSL_VERSION
   "uniform mat4 projection;"
@@ -132,6 +150,65 @@ static constexpr char combine_texture_fragment_shader[] =
   "  gl_FragColor = colorvar * texture2D(texture, texcoordvar);"
   "}";
 
+static const char *const terrain_vertex_shader = texture_vertex_shader;
+static constexpr char terrain_fragment_shader[] =
+  GLSL_VERSION
+  GLSL_HIGH_PRECISION
+  "uniform sampler2D texture;"
+  "uniform sampler2D ramp;"
+  "uniform vec2 slope_step;"
+  "uniform vec2 texel;"
+  "uniform vec2 limit;"
+  "uniform vec3 sun;"
+  "uniform float slope_z;"
+  "uniform float contrast;"
+  "uniform float height_scale;"
+  "uniform float contour_scale;"
+  "uniform float shading;"
+  "varying vec2 texcoordvar;"
+  "float height(vec2 p) {"
+  "  vec4 c = floor(texture2D(texture, min(p, limit)) * 255.0 + 0.5);"
+  "  float h = c.r + c.a * 256.0;"
+  "  return h >= 32768.0 ? h - 65536.0 : h;"
+  "}"
+  "float contour(float h) {"
+  "  return min(254.0, floor(max(h, 0.0) * contour_scale));"
+  "}"
+  "vec3 ramp_color(float i) {"
+  "  return texture2D(ramp, vec2((i + 0.5) / 256.0, 0.5)).rgb;"
+  "}"
+  "void main() {"
+  "  float h = height(texcoordvar);"
+  "  if (h <= -30000.0) {"
+  "    gl_FragColor = h == -32768.0 ? vec4(1.0) : vec4(ramp_color(255.0), 1.0);"
+  "    return;"
+  "  }"
+  "  vec3 color = ramp_color(min(254.0, floor(max(h, 0.0) * height_scale)));"
+  "  float above = height(texcoordvar - vec2(0.0, slope_step.y));"
+  "  float below = height(texcoordvar + vec2(0.0, slope_step.y));"
+  "  float left = height(texcoordvar - vec2(slope_step.x, 0.0));"
+  "  float right = height(texcoordvar + vec2(slope_step.x, 0.0));"
+  "  bool slope = shading > 0.0 &&"
+  "    min(min(above, below), min(left, right)) > -30000.0;"
+  "  float c = contour(h);"
+  "  if ((slope || shading <= 0.0) &&"
+  "      (c != contour(height(texcoordvar - vec2(texel.x, 0.0))) ||"
+  "       c != contour(height(texcoordvar - vec2(0.0, texel.y))))) {"
+  "    color = mix(color, vec3(100.0, 70.0, 26.0) / 255.0, 0.5);"
+  "  } else if (slope) {"
+  "    vec3 n = normalize(vec3(clamp(right - left, -512.0, 512.0),"
+  "                            clamp(above - below, -512.0, 512.0),"
+  "                            slope_z));"
+  "    float s = clamp((dot(n, sun) - sun.z) * contrast, -63.0, 63.0);"
+  "    if (s < 0.0)"
+  "      color = mix(color, vec3(0.0, 0.0, 64.0 / 255.0), -s / 128.0);"
+  "    else"
+  "      color = mix(color, vec3(1.0, 1.0, 16.0 / 255.0),"
+  "                  min(32.0, s / 2.0) / 128.0);"
+  "  }"
+  "  gl_FragColor = vec4(color, 1.0);"
+  "}";
+
 static void
 CompileAttachShader(GLProgram &program, GLenum type, const char *code)
 {
@@ -182,6 +259,9 @@ OpenGL::InitShaders()
 {
   DeinitShaders();
 
+  /* this is a new context, which has no program installed */
+  GLProgram::InvalidateCurrent();
+
   solid_shader = CompileProgram(solid_vertex_shader, solid_fragment_shader);
   solid_shader->BindAttribLocation(Attribute::TRANSLATE, "translate");
   solid_shader->BindAttribLocation(Attribute::POSITION, "position");
@@ -248,6 +328,38 @@ OpenGL::InitShaders()
   combine_texture_shader->Use();
   glUniform1i(combine_texture_texture, 0);
 
+  terrain_shader = CompileProgram(terrain_vertex_shader,
+                                  terrain_fragment_shader);
+  terrain_shader->BindAttribLocation(Attribute::TRANSLATE, "translate");
+  terrain_shader->BindAttribLocation(Attribute::POSITION, "position");
+  terrain_shader->BindAttribLocation(Attribute::TEXCOORD, "texcoord");
+  LinkProgram(*terrain_shader);
+
+  if (terrain_shader->GetLinkStatus() == GL_TRUE) {
+    terrain_projection = terrain_shader->GetUniformLocation("projection");
+    terrain_texture = terrain_shader->GetUniformLocation("texture");
+    terrain_ramp = terrain_shader->GetUniformLocation("ramp");
+    terrain_step = terrain_shader->GetUniformLocation("slope_step");
+    terrain_texel = terrain_shader->GetUniformLocation("texel");
+    terrain_limit = terrain_shader->GetUniformLocation("limit");
+    terrain_sun = terrain_shader->GetUniformLocation("sun");
+    terrain_slope_z = terrain_shader->GetUniformLocation("slope_z");
+    terrain_contrast = terrain_shader->GetUniformLocation("contrast");
+    terrain_height_scale =
+      terrain_shader->GetUniformLocation("height_scale");
+    terrain_contour_scale =
+      terrain_shader->GetUniformLocation("contour_scale");
+    terrain_shading = terrain_shader->GetUniformLocation("shading");
+
+    terrain_shader->Use();
+    glUniform1i(terrain_texture, 0);
+    glUniform1i(terrain_ramp, 1);
+  } else {
+    /* not fatal: RasterRenderer falls back to shading on the CPU */
+    delete terrain_shader;
+    terrain_shader = nullptr;
+  }
+
   glVertexAttrib4f(Attribute::TRANSLATE, 0, 0, 0, 0);
 }
 
@@ -256,6 +368,9 @@ OpenGL::DeinitShaders()
 {
   delete solid_shader;
   solid_shader = nullptr;
+
+  delete terrain_shader;
+  terrain_shader = nullptr;
 }
 
 void
@@ -280,4 +395,10 @@ OpenGL::UpdateShaderProjectionMatrix()
   combine_texture_shader->Use();
   glUniformMatrix4fv(combine_texture_projection, 1, GL_FALSE,
                      glm::value_ptr(projection_matrix));
+
+  if (terrain_shader != nullptr) {
+    terrain_shader->Use();
+    glUniformMatrix4fv(terrain_projection, 1, GL_FALSE,
+                       glm::value_ptr(projection_matrix));
+  }
 }
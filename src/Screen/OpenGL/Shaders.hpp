@@ -61,6 +61,17 @@ namespace OpenGL {
   extern GLProgram *combine_texture_shader;
   extern GLint combine_texture_projection, combine_texture_texture;
 
+  /**
+   * A shader that renders terrain from the raw heights, including
+   * slope shading and contours (see #TerrainTextures).  nullptr if
+   * the shader could not be linked.
+   */
+  extern GLProgram *terrain_shader;
+  extern GLint terrain_projection, terrain_texture, terrain_ramp;
+  extern GLint terrain_step, terrain_texel, terrain_limit;
+  extern GLint terrain_sun, terrain_slope_z, terrain_contrast;
+  extern GLint terrain_height_scale, terrain_contour_scale, terrain_shading;
+
   void InitShaders();
   void DeinitShaders();
 
@@ -45,6 +45,8 @@ Copyright_License {
 #include <SDL.h>
 #endif
 
+#include <algorithm>
+
 #include <assert.h>
 
 #ifndef NDEBUG
@@ -244,3 +246,81 @@ GLTexture::Draw(PixelRect dest, PixelRect src) const
   glDisableClientState(GL_TEXTURE_COORD_ARRAY);
 #endif
 }
+
+void
+GLTexture::Draw(const PixelPoint *dest, unsigned n,
+                PixelSize dest_size, PixelRect src) const
+{
+#ifdef HAVE_OES_DRAW_TEXTURE
+  if (OpenGL::oes_draw_texture) {
+    for (unsigned i = 0; i < n; ++i)
+      DrawOES(PixelRect(dest[i], dest_size), src);
+    return;
+  }
+#endif
+
+  /* two triangles per copy, so all copies can be drawn with a single
+     GL_TRIANGLES call */
+  static constexpr unsigned CHUNK = 64;
+  static constexpr unsigned VERTICES_PER_QUAD = 6;
+
+  const PixelSize allocated = GetAllocatedSize();
+  GLfloat x0 = (GLfloat)src.left / allocated.cx;
+  GLfloat y0 = (GLfloat)src.top / allocated.cy;
+  GLfloat x1 = (GLfloat)src.right / allocated.cx;
+  GLfloat y1 = (GLfloat)src.bottom / allocated.cy;
+  if (flipped)
+    std::swap(y0, y1);
+
+  BulkPixelPoint vertices[CHUNK * VERTICES_PER_QUAD];
+  GLfloat coord[CHUNK * VERTICES_PER_QUAD * 2];
+
+  /* the texture coordinates are the same for all copies */
+  for (unsigned i = 0; i < CHUNK; ++i) {
+    GLfloat *c = coord + i * VERTICES_PER_QUAD * 2;
+    c[0] = x0; c[1] = y0;
+    c[2] = x1; c[3] = y0;
+    c[4] = x0; c[5] = y1;
+    c[6] = x1; c[7] = y0;
+    c[8] = x0; c[9] = y1;
+    c[10] = x1; c[11] = y1;
+  }
+
+  const ScopeVertexPointer vp(vertices);
+
+#ifdef USE_GLSL
+  glEnableVertexAttribArray(OpenGL::Attribute::TEXCOORD);
+  glVertexAttribPointer(OpenGL::Attribute::TEXCOORD, 2, GL_FLOAT, GL_FALSE,
+                        0, coord);
+#else
+  glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+  glTexCoordPointer(2, GL_FLOAT, 0, coord);
+#endif
+
+  while (n > 0) {
+    const unsigned chunk = std::min(n, CHUNK);
+
+    BulkPixelPoint *v = vertices;
+    for (unsigned i = 0; i < chunk; ++i) {
+      const PixelRect rc(dest[i], dest_size);
+      *v++ = rc.GetTopLeft();
+      *v++ = rc.GetTopRight();
+      *v++ = rc.GetBottomLeft();
+      *v++ = rc.GetTopRight();
+      *v++ = rc.GetBottomLeft();
+      *v++ = rc.GetBottomRight();
+    }
+
+    glDrawArrays(GL_TRIANGLES, 0, chunk * VERTICES_PER_QUAD);
+
+    dest += chunk;
+    n -= chunk;
+  }
+
+#ifdef USE_GLSL
+  glDisableVertexAttribArray(OpenGL::Attribute::TEXCOORD);
+  OpenGL::solid_shader->Use();
+#else
+  glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+#endif
+}
@@ -166,6 +166,16 @@ public:
   void Draw(PixelPoint dest) const {
     Draw(PixelRect(dest, GetSize()), GetRect());
   }
+
+  /**
+   * Draw the same portion of this texture at several positions.  The
+   * quads are submitted in chunks, with one draw call per chunk.
+   *
+   * @param dest the top left corners of the copies
+   * @param dest_size the size of each copy on the screen
+   */
+  void Draw(const PixelPoint *dest, unsigned n,
+            PixelSize dest_size, PixelRect src) const;
 };
 
 #endif
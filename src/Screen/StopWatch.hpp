@@ -153,10 +153,32 @@ public:
     markers.clear();
   }
 
+  /**
+   * Like Finish(), but pass each measurement to the given function
+   * instead of writing it to the log file.  It is invoked as
+   * f(text, clock) with the duration in microseconds.
+   */
+  template<typename F>
+  void Finish(F &&f) {
+    if (markers.empty())
+      return;
+
+    FlushScreen();
+    markers.append().Set(nullptr);
+
+    for (unsigned i = 0; markers[i + 1].text != nullptr; ++i)
+      f(markers[i].text, uint64_t(markers[i + 1].clock - markers[i].clock));
+
+    markers.clear();
+  }
+
 #else /* !STOP_WATCH */
 public:
   void Mark(const char *text) {}
   void Finish() {}
+
+  template<typename F>
+  void Finish(F &&f) {}
 #endif /* !STOP_WATCH */
 };
 
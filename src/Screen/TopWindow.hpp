@@ -379,9 +379,20 @@ protected:
    */
   virtual void OnResume();
 
+  /**
+   * @see Event::LOW_MEMORY
+   */
+  virtual void OnLowMemory();
+
 public:
   void Pause();
   void Resume();
+
+  /**
+   * Schedule a call to OnLowMemory() in the main thread.  This
+   * method may be called from any thread.
+   */
+  void LowMemory();
 #endif
 
 public:
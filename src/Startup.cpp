@@ -44,9 +44,13 @@ Copyright_License {
 #include "FLARM/Glue.hpp"
 #include "Logger/Logger.hpp"
 #include "Logger/NMEALogger.hpp"
+#include "Logger/DeviceCapture.hpp"
 #include "Logger/GlueFlightLogger.hpp"
 #include "Waypoint/WaypointDetailsReader.hpp"
 #include "Blackboard/DeviceBlackboard.hpp"
+#include "Computer/StageTimer.hpp"
+#include "Computer/StageSampler.hpp"
+#include "Computer/ThermalDatabaseGlue.hpp"
 #include "MapWindow/GlueMapWindow.hpp"
 #include "Device/device.hpp"
 #include "Device/MultipleDevices.hpp"
@@ -57,6 +61,7 @@ Copyright_License {
 #include "Audio/VarioGlue.hpp"
 #include "Audio/VolumeController.hpp"
 #include "Screen/Busy.hpp"
+#include "Event/Globals.hpp"
 #include "CommandLine.hpp"
 #include "MainWindow.hpp"
 #include "Computer/GlideComputer.hpp"
@@ -67,7 +72,12 @@ Copyright_License {
 #include "CalculationThread.hpp"
 #include "Replay/Replay.hpp"
 #include "LocalPath.hpp"
+#include "OS/Path.hpp"
+#include "Time/BrokenDateTime.hpp"
+#include "Util/StaticString.hxx"
 #include "IO/FileCache.hpp"
+#include "IO/MapFile.hpp"
+#include "IO/ZipArchive.hpp"
 #include "IO/Async/AsioThread.hpp"
 #include "IO/Async/GlobalAsioThread.hpp"
 #include "Net/HTTP/DownloadManager.hpp"
@@ -88,6 +98,7 @@ Copyright_License {
 #include "Task/DefaultTask.hpp"
 #include "Engine/Task/Ordered/OrderedTask.hpp"
 #include "Operation/VerboseOperationEnvironment.hpp"
+#include "Thread/TaskPool.hpp"
 #include "PageActions.hpp"
 #include "Weather/Features.hpp"
 #include "Weather/NOAAGlue.hpp"
@@ -98,6 +109,7 @@ Copyright_License {
 #include "Units/Units.hpp"
 #include "Formatter/UserGeoPointFormatter.hpp"
 #include "Thread/Debug.hpp"
+#include "Thread/Policy.hpp"
 
 #include "Lua/StartFile.hpp"
 #include "Lua/Background.hpp"
@@ -260,6 +272,13 @@ Startup()
   if (!LoadProfile())
     return false;
 
+  /* the asio thread is already running; it picks up its policy from
+     within its own context */
+  SetThreadPolicySettings(CommonInterface::GetSystemSettings().threads);
+  asio_thread->Get().post([](){
+      ApplyThreadPolicy(ThreadRole::PORT_IO);
+    });
+
   operation.SetText(_("Initialising"));
 
   /* create XCSoarData on the first start */
@@ -292,6 +311,28 @@ Startup()
   protected_task_manager =
     new ProtectedTaskManager(*task_manager, computer_settings.task);
 
+  /* topography and the RASP index don't depend on anything else
+     that is loaded here; parse them in the thread pool while the
+     terrain, waypoints and airspaces are being loaded below */
+  TaskGroup background_loads;
+
+  topography = new TopographyStore();
+  {
+    std::shared_ptr<ZipArchive> map_file = OpenMapFile();
+    if (map_file)
+      background_loads.Submit([map_file](){
+          LogFormat("Loading Topography File...");
+          NullOperationEnvironment env;
+          LoadTopography(*topography, *map_file, env);
+        });
+  }
+
+  LogFormat("RASP load");
+  auto rasp = std::make_shared<RaspStore>(LocalPath(_T(RASP_FILENAME)));
+  background_loads.Submit([rasp](){
+      rasp->ScanAll();
+    });
+
   // Read the terrain file
   operation.SetText(_("Loading Terrain File..."));
   LogFormat("OpenTerrain");
@@ -307,6 +348,9 @@ Startup()
   glide_computer->SetLogger(logger);
   glide_computer->Initialise();
 
+  ThermalDatabaseGlue::Load(glide_computer->GetThermalDatabase(),
+                            LocalPath(_T("thermals.txt")));
+
   replay = new Replay(logger, *protected_task_manager);
 
 #ifdef HAVE_CMDLINE_REPLAY
@@ -330,10 +374,6 @@ Startup()
                          CommonInterface::SetComputerSettings(), gp);
   task_manager->SetGlidePolar(gp);
 
-  // Read the topography file(s)
-  topography = new TopographyStore();
-  LoadConfiguredTopography(*topography, operation);
-
   // Read the waypoint files
   WaypointGlue::LoadWaypoints(way_points, terrain, operation);
 
@@ -350,14 +390,9 @@ Startup()
   device_blackboard->Merge();
   CommonInterface::ReadBlackboardBasic(device_blackboard->Basic());
 
-  // Scan for weather forecast
-  LogFormat("RASP load");
-  auto rasp = std::make_shared<RaspStore>(LocalPath(_T(RASP_FILENAME)));
-  rasp->ScanAll();
-
   // Reads the airspace files
   ReadAirspace(airspace_database, terrain, computer_settings.pressure,
-               operation);
+               file_cache, operation);
 
   {
     const AircraftState aircraft_state =
@@ -379,6 +414,11 @@ Startup()
   AudioVarioGlue::Initialise();
   AudioVarioGlue::Configure(ui_settings.sound.vario);
 
+#ifdef HAVE_PCM_PLAYER
+  /* feed the audio vario directly from the device threads */
+  device_blackboard->SetVarioHandler(AudioVarioGlue::SetValue);
+#endif
+
   // Start the device thread(s)
   operation.SetText(_("Starting devices"));
   devStartup();
@@ -392,6 +432,10 @@ Startup()
 
   operation.SetText(_("Initialising display"));
 
+  /* wait for the loaders which were submitted to the thread pool
+     above; usually, they are done already */
+  background_loads.Wait();
+
   GlueMapWindow *map_window = main_window->GetMap();
   if (map_window != nullptr) {
     map_window->SetWaypoints(&way_points);
@@ -453,6 +497,8 @@ Startup()
   merge_thread->Start();
   calculation_thread->Start();
 
+  StageSampler::Start();
+
   PageActions::Update();
 
 #ifdef HAVE_TRACKING
@@ -477,6 +523,24 @@ Startup()
   return true;
 }
 
+/**
+ * Save the #StageSampler ring buffer next to the flight logs.
+ */
+static void
+SaveStageSamples()
+try {
+  const auto now = BrokenDateTime::NowUTC();
+  StaticString<64> name;
+  name.Format(_T("%04u-%02u-%02u-%02u%02u%02u-profile.csv"),
+              now.year, now.month, now.day,
+              now.hour, now.minute, now.second);
+
+  const auto logs_path = MakeLocalPath(_T("logs"));
+  StageSampler::Save(AllocatedPath::Build(logs_path, name));
+} catch (const std::runtime_error &e) {
+  LogError(e);
+}
+
 void
 Shutdown()
 {
@@ -528,6 +592,7 @@ Shutdown()
   // Save settings to profile
   operation.SetText(_("Shutdown, saving profile..."));
   Profile::Save();
+  Profile::Flush();
 
   operation.SetText(_("Shutdown, please wait..."));
 
@@ -573,10 +638,21 @@ Shutdown()
   }
 #endif
 
+  /* all threads have finished; record where they have spent their
+     time */
+  StageTimer::Log();
+  SaveStageSamples();
+  StageSampler::Stop();
+
+  LogFormat("Coalesced %u UI events", n_coalesced_events.load());
+
   LogFormat("delete MapWindow");
   main_window->Deinitialise();
 
   // Stop sound
+#ifdef HAVE_PCM_PLAYER
+  device_blackboard->SetVarioHandler(nullptr);
+#endif
   AudioVarioGlue::Deinitialise();
 
   // Save the task for the next time
@@ -591,6 +667,13 @@ Shutdown()
     }
   }
 
+  if (glide_computer != nullptr) {
+    LogFormat("Save thermal database");
+    const ThermalDatabase &database = glide_computer->GetThermalDatabase();
+    ScopeLock protect(database.mutex);
+    ThermalDatabaseGlue::Save(database, LocalPath(_T("thermals.txt")));
+  }
+
   // Clear waypoint database
   way_points.Clear();
 
@@ -607,6 +690,7 @@ Shutdown()
   devShutdown();
 
   NMEALogger::Shutdown();
+  DeviceCapture::Shutdown();
 
   delete replay;
   replay = nullptr;
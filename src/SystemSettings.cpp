@@ -42,4 +42,6 @@ SystemSettings::SetDefaults()
     devices[0].baud_rate = 4800;
     devices[0].driver_name = _T("Generic");
   }
+
+  threads.SetDefaults();
 }
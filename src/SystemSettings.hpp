@@ -26,6 +26,7 @@ Copyright_License {
 
 #include "Device/Config.hpp"
 #include "Device/Features.hpp"
+#include "Thread/Policy.hpp"
 
 #include <type_traits>
 #include <array>
@@ -33,6 +34,12 @@ Copyright_License {
 struct SystemSettings {
   std::array<DeviceConfig, NUMDEV> devices;
 
+  /**
+   * Scheduling class, niceness and CPU affinity of the XCSoar
+   * threads.
+   */
+  ThreadPolicySettings threads;
+
   void SetDefaults();
 };
 
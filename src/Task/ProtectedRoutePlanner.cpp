@@ -62,16 +62,6 @@ ProtectedRoutePlanner::Intersection(const AGeoPoint &origin,
   return lease->Intersection(origin, destination);
 }
 
-void
-ProtectedRoutePlanner::SolveReach(const AGeoPoint &origin,
-                                  const RoutePlannerConfig &config,
-                                  const int h_ceiling,
-                                  const bool do_solve)
-{
-  ExclusiveLease lease(*this);
-  lease->SolveReach(origin, config, h_ceiling, do_solve);
-}
-
 const FlatProjection
 ProtectedRoutePlanner::GetTerrainReachProjection() const
 {
@@ -59,6 +59,15 @@ public:
     lease->ClearReach();
   }
 
+  /**
+   * Publish a reach solution which was calculated outside of the
+   * lock.  See RoutePlanner::AcceptReach().
+   */
+  void AcceptReach(ReachSolution &solution) {
+    ExclusiveLease lease(*this);
+    lease->AcceptReach(solution);
+  }
+
   gcc_pure
   bool IsTerrainReachEmpty() const {
     Lease lease(*this);
@@ -81,9 +90,6 @@ public:
   GeoPoint Intersection(const AGeoPoint &origin,
                         const AGeoPoint &destination) const;
 
-  void SolveReach(const AGeoPoint &origin, const RoutePlannerConfig &config,
-                  int h_ceiling, bool do_solve);
-
   gcc_pure
   const FlatProjection GetTerrainReachProjection() const;
 };
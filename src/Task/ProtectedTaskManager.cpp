@@ -119,8 +119,17 @@ ProtectedTaskManager::DoGoto(WaypointPtr &&wp)
 OrderedTask*
 ProtectedTaskManager::TaskClone() const
 {
-  Lease lease(*this);
-  return lease->Clone(task_behaviour);
+  OrderedTask *task;
+
+  {
+    Lease lease(*this);
+    task = lease->CloneWithoutGeometry(task_behaviour);
+  }
+
+  /* the clone is not shared yet, so its (expensive) geometry can be
+     calculated without holding the lock */
+  task->UpdateGeometry();
+  return task;
 }
 
 bool
@@ -62,26 +62,35 @@ RoutePlannerGlue::Solve(const AGeoPoint &origin,
   return planner.Solve(origin, destination, config, h_ceiling);
 }
 
-void
-RoutePlannerGlue::SolveReach(const AGeoPoint &origin,
-                              const RoutePlannerConfig &config,
-                              const int h_ceiling, const bool do_solve)
-{
-  if (terrain) {
-    RasterTerrain::Lease lease(*terrain);
-    planner.SolveReachTerrain(origin, config, h_ceiling, do_solve);
-    planner.SolveReachWorking(origin, config, h_ceiling, do_solve);
-  } else {
-    planner.SolveReachTerrain(origin, config, h_ceiling, do_solve);
-    planner.SolveReachWorking(origin, config, h_ceiling, do_solve);
-  }
-}
-
 bool
 RoutePlannerGlue::FindPositiveArrival(const AGeoPoint &dest,
                                       ReachResult &result_r) const
 {
-  return planner.FindPositiveArrival(dest, result_r);
+  const ArrivalKey key(dest);
+
+  {
+    const ScopeLock protect(arrival_mutex);
+
+    if (arrival_serial != planner.GetReachSerial() ||
+        arrival_cache.size() >= MAX_CACHED_ARRIVALS) {
+      arrival_cache.clear();
+      arrival_serial = planner.GetReachSerial();
+    }
+
+    const auto i = arrival_cache.find(key);
+    if (i != arrival_cache.end()) {
+      result_r = i->second.result;
+      return i->second.found;
+    }
+  }
+
+  const bool found = planner.FindPositiveArrival(dest, result_r);
+
+  const ScopeLock protect(arrival_mutex);
+  /* the reach cannot change while the caller holds a lease, so the
+     serial is still the same */
+  arrival_cache.emplace(key, CachedArrival{result_r, found});
+  return found;
 }
 
 GeoPoint
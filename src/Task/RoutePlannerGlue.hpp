@@ -24,6 +24,12 @@
 #define ROUTE_PLANNER_GLUE_HPP
 
 #include "Route/AirspaceRoute.hpp"
+#include "Route/ReachResult.hpp"
+#include "Thread/Mutex.hpp"
+#include "Util/Serial.hpp"
+
+#include <unordered_map>
+#include <functional>
 
 struct GlideSettings;
 class RasterTerrain;
@@ -33,6 +39,53 @@ class RoutePlannerGlue {
   const RasterTerrain *terrain;
   AirspaceRoute planner;
 
+  struct ArrivalKey {
+    double latitude, longitude, altitude;
+
+    explicit ArrivalKey(const AGeoPoint &p)
+      :latitude(p.latitude.Native()), longitude(p.longitude.Native()),
+       altitude(p.altitude) {}
+
+    bool operator==(const ArrivalKey &other) const {
+      return latitude == other.latitude && longitude == other.longitude &&
+        altitude == other.altitude;
+    }
+
+    struct Hash {
+      gcc_pure
+      size_t operator()(const ArrivalKey &k) const {
+        std::hash<double> h;
+        return (h(k.latitude) * 31 + h(k.longitude)) * 31 + h(k.altitude);
+      }
+    };
+  };
+
+  struct CachedArrival {
+    ReachResult result;
+    bool found;
+  };
+
+  /**
+   * The FindPositiveArrival() results since the last reach solution
+   * was published (see RoutePlanner::GetReachSerial()).  The abort
+   * task, the map items and the waypoint renderer query the same
+   * landables over and over, and looking up the reach fan is
+   * expensive.
+   *
+   * Protected by #arrival_mutex, because FindPositiveArrival() is
+   * called by several threads holding a shared lease.
+   */
+  mutable std::unordered_map<ArrivalKey, CachedArrival,
+                             ArrivalKey::Hash> arrival_cache;
+  mutable Serial arrival_serial;
+  mutable Mutex arrival_mutex;
+
+  /**
+   * Flush the cache when it has grown this big, e.g. after huge
+   * waypoint files have been scanned.
+   */
+  static constexpr size_t MAX_CACHED_ARRIVALS = 4096;
+
 public:
   RoutePlannerGlue():terrain(nullptr) {}
 
@@ -57,6 +110,10 @@ public:
     return planner.IsTerrainReachEmpty();
   }
 
+  const Serial &GetReachSerial() const {
+    return planner.GetReachSerial();
+  }
+
   void ClearReach() {
     planner.ClearReach();
   }
@@ -73,9 +130,19 @@ public:
     return planner.GetSolution();
   }
 
-  void SolveReach(const AGeoPoint &origin, const RoutePlannerConfig &config,
-                  int h_ceiling, bool do_solve);
+  void PrepareReach(ReachSolution &solution, const AGeoPoint &origin,
+                    const RoutePlannerConfig &config, int h_ceiling) const {
+    planner.PrepareReach(solution, origin, config, h_ceiling);
+  }
+
+  void AcceptReach(ReachSolution &solution) {
+    planner.AcceptReach(solution);
+  }
 
+  /**
+   * Look up the arrival height in the reach fan.  The result is
+   * cached until the reach changes.
+   */
   bool FindPositiveArrival(const AGeoPoint &dest, ReachResult &result_r) const;
 
   const FlatProjection &GetTerrainReachProjection() const {
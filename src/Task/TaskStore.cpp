@@ -31,8 +31,72 @@ Copyright_License {
 #include "Language/Language.hpp"
 
 #include <algorithm>
+#include <map>
 #include <memory>
 
+#include <stdint.h>
+
+/**
+ * The tasks found in one task file by a previous TaskStore::Scan().
+ */
+struct CachedTaskFile {
+  struct Task {
+    /**
+     * The name stored in the file (see TaskFile::GetName()); only
+     * meaningful if #has_name is set.
+     */
+    tstring name;
+
+    bool has_name;
+  };
+
+  uint64_t modification, size;
+
+  std::vector<Task> tasks;
+
+  bool valid = false;
+};
+
+/**
+ * Remembers the contents of all task files by path, so rescanning
+ * (each time the task list is shown or modified) parses only new and
+ * modified files.  This is only accessed by the main thread.
+ */
+static std::map<tstring, CachedTaskFile> task_file_cache;
+
+static const CachedTaskFile &
+LoadTaskFile(Path path)
+{
+  const uint64_t modification = File::GetLastModification(path);
+  const uint64_t size = File::GetSize(path);
+
+  CachedTaskFile &file = task_file_cache[path.c_str()];
+  if (file.valid && file.modification == modification && file.size == size)
+    return file;
+
+  file.modification = modification;
+  file.size = size;
+  file.tasks.clear();
+  file.valid = true;
+
+  // Create a TaskFile instance to determine how many
+  // tasks are inside of this task file
+  std::unique_ptr<TaskFile> task_file(TaskFile::Create(path));
+  if (!task_file)
+    return file;
+
+  // Count the tasks in the task file
+  const unsigned count = task_file->Count();
+  file.tasks.reserve(count);
+  for (unsigned i = 0; i < count; i++) {
+    const TCHAR *saved_name = task_file->GetName(i);
+    file.tasks.push_back({saved_name != nullptr ? saved_name : _T(""),
+                          saved_name != nullptr});
+  }
+
+  return file;
+}
+
 class TaskFileVisitor: public File::Visitor
 {
 private:
@@ -43,24 +107,19 @@ public:
     store(_store) {}
 
   void Visit(Path path, Path base_name) override {
-    // Create a TaskFile instance to determine how many
-    // tasks are inside of this task file
-    std::unique_ptr<TaskFile> task_file(TaskFile::Create(path));
-    if (!task_file)
-      return;
-
-    // Count the tasks in the task file
-    unsigned count = task_file->Count();
+    const CachedTaskFile &file = LoadTaskFile(path);
+
+    const unsigned count = file.tasks.size();
     // For each task in the task file
     for (unsigned i = 0; i < count; i++) {
       // Copy base name of the file into task name
       StaticString<256> name(base_name.c_str());
 
       // If the task file holds more than one task
-      const TCHAR *saved_name = task_file->GetName(i);
-      if (saved_name != nullptr) {
+      const CachedTaskFile::Task &task = file.tasks[i];
+      if (task.has_name) {
         name += _T(": ");
-        name += saved_name;
+        name += task.name.c_str();
       } else if (count > 1) {
         // .. append " - Task #[n]" suffix to the task name
         name.AppendFormat(_T(": %s #%d"), _("Task"), i + 1);
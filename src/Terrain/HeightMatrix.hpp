@@ -27,6 +27,10 @@ Copyright_License {
 #include "Height.hpp"
 #include "Util/AllocatedArray.hxx"
 
+#ifdef ENABLE_OPENGL
+#include <utility>
+#endif
+
 class RasterMap;
 
 #ifdef ENABLE_OPENGL
@@ -36,6 +40,10 @@ class WindowProjection;
 #endif
 
 class HeightMatrix {
+#ifdef ENABLE_OPENGL
+  friend class HeightMatrixPyramid;
+#endif
+
   AllocatedArray<TerrainHeight> data;
   unsigned width, height;
 
@@ -52,6 +60,12 @@ protected:
 
 public:
 #ifdef ENABLE_OPENGL
+  void Swap(HeightMatrix &other) {
+    std::swap(data, other.data);
+    std::swap(width, other.width);
+    std::swap(height, other.height);
+  }
+
   /**
    * Copy values from the #RasterMap to the buffer, north-up only.
    */
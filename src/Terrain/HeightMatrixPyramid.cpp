@@ -0,0 +1,296 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#include "HeightMatrixPyramid.hpp"
+#include "RasterMap.hpp"
+#include "Geo/GeoBounds.hpp"
+
+#include <algorithm>
+
+#include <assert.h>
+#include <math.h>
+
+/**
+ * Don't snap to a grid which needs more than this factor of samples
+ * in one dimension than requested.
+ */
+static constexpr unsigned MAX_OVERSAMPLING = 2;
+
+gcc_const
+static int
+FloorDiv(int a, int b)
+{
+  assert(b > 0);
+
+  return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+gcc_const
+static int
+CeilDiv(int a, int b)
+{
+  assert(b > 0);
+
+  return -FloorDiv(-a, b);
+}
+
+/**
+ * Find the nearest level for the given step size.
+ */
+gcc_const
+static int
+StepToLevel(double step)
+{
+  return (int)lround(2 * log2(step));
+}
+
+Angle
+HeightGrid::GetStep(int level)
+{
+  return Angle::Native(exp2(level * 0.5));
+}
+
+bool
+HeightGrid::Snap(const GeoBounds &bounds,
+                 unsigned _width, unsigned _height)
+{
+  if (!bounds.IsValid() || _width < 2 || _height < 2)
+    return false;
+
+  const double bounds_width = bounds.GetWidth().Native();
+  const double bounds_height = bounds.GetHeight().Native();
+  if (bounds_width <= 0 || bounds_height <= 0)
+    return false;
+
+  level_x = StepToLevel(bounds_width / (_width - 1));
+  level_y = StepToLevel(bounds_height / (_height - 1));
+
+  const double step_x = GetStep(level_x).Native();
+  const double step_y = GetStep(level_y).Native();
+
+  /* round inwards, so all samples are inside the bounds (which are
+     usually clipped to the map) */
+  west = (int)ceil(bounds.GetWest().Native() / step_x);
+  const int east = (int)floor(bounds.GetEast().Native() / step_x);
+  north = (int)floor(bounds.GetNorth().Native() / step_y);
+  const int south = (int)ceil(bounds.GetSouth().Native() / step_y);
+
+  if (east <= west || north <= south)
+    return false;
+
+  width = east - west + 1;
+  height = north - south + 1;
+
+  return width <= _width * MAX_OVERSAMPLING &&
+    height <= _height * MAX_OVERSAMPLING;
+}
+
+GeoBounds
+HeightGrid::GetBounds() const
+{
+  const Angle step_x = GetStep(level_x), step_y = GetStep(level_y);
+
+  return GeoBounds(GeoPoint(step_x * west, step_y * north),
+                   GeoPoint(step_x * int(west + width - 1),
+                            step_y * int(north - height + 1)));
+}
+
+void
+HeightMatrixPyramid::Clear()
+{
+  for (auto &i : entries)
+    i.age = 0;
+
+  current_age = 0;
+  map = nullptr;
+}
+
+/**
+ * Calculate the reduction factor between a cached grid and a new grid
+ * with the given levels.
+ *
+ * @return the factor, or 0 if the grids are not compatible
+ */
+gcc_const
+static int
+GetReduction(int cached_level, int level)
+{
+  const int delta = level - cached_level;
+  if (delta < 0 || delta % 2 != 0 || delta > 8)
+    return 0;
+
+  return 1 << (delta / 2);
+}
+
+/**
+ * Determine the range of indices in the new grid (starting at
+ * #start, #n samples) whose samples exist in a cached grid (starting
+ * at #cached_start, #cached_n samples, the given reduction factor).
+ *
+ * @return the number of overlapping samples
+ */
+static unsigned
+GetOverlap(int start, unsigned n, int cached_start, unsigned cached_n,
+           int reduction, int &begin, int &end)
+{
+  begin = std::max(start, CeilDiv(cached_start, reduction));
+  end = std::min(start + int(n),
+                 FloorDiv(cached_start + int(cached_n) - 1, reduction) + 1);
+  return end > begin ? end - begin : 0;
+}
+
+const HeightMatrixPyramid::Entry *
+HeightMatrixPyramid::FindSource(const HeightGrid &grid) const
+{
+  const Entry *best = nullptr;
+  unsigned best_overlap = 0;
+
+  for (const auto &i : entries) {
+    if (i.age == 0)
+      continue;
+
+    const int rx = GetReduction(i.grid.level_x, grid.level_x);
+    const int ry = GetReduction(i.grid.level_y, grid.level_y);
+    if (rx == 0 || ry == 0)
+      continue;
+
+    int begin, end;
+    const unsigned columns = GetOverlap(grid.west, grid.width,
+                                        i.grid.west, i.grid.width,
+                                        rx, begin, end);
+
+    /* rows are numbered from north to south; negate them for
+       GetOverlap() */
+    const unsigned rows = GetOverlap(-grid.north, grid.height,
+                                     -i.grid.north, i.grid.height,
+                                     ry, begin, end);
+
+    const unsigned overlap = columns * rows;
+    if (overlap > best_overlap) {
+      best = &i;
+      best_overlap = overlap;
+    }
+  }
+
+  return best;
+}
+
+/**
+ * Scan the columns [begin, end) of one #HeightMatrix row.
+ */
+static void
+ScanColumns(const RasterMap &map, const HeightGrid &grid, Angle latitude,
+            TerrainHeight *row, unsigned begin, unsigned end,
+            bool interpolate)
+{
+  if (begin >= end)
+    return;
+
+  if (end - begin == 1) {
+    /* RasterMap::ScanLine() needs a line with two distinct end
+       points; rescan one more (already known) sample */
+    if (begin > 0)
+      --begin;
+    else
+      ++end;
+  }
+
+  assert(end <= grid.width);
+
+  const Angle step_x = HeightGrid::GetStep(grid.level_x);
+  map.ScanLine(GeoPoint(step_x * int(grid.west + begin), latitude),
+               GeoPoint(step_x * int(grid.west + end - 1), latitude),
+               row + begin, end - begin, interpolate);
+}
+
+void
+HeightMatrixPyramid::Fill(HeightMatrix &dest, const RasterMap &_map,
+                          const HeightGrid &grid, bool interpolate)
+{
+  assert(grid.width >= 2);
+  assert(grid.height >= 2);
+
+  if (&_map != map) {
+    Clear();
+    map = &_map;
+  }
+
+  if (current_age > 0) {
+    /* move the previous result to the cache, replacing the oldest
+       entry */
+    Entry *victim = std::min_element(std::begin(entries), std::end(entries),
+                                     [](const Entry &a, const Entry &b){
+                                       return a.age < b.age;
+                                     });
+    victim->grid = current;
+    victim->matrix.Swap(dest);
+    victim->age = current_age;
+  }
+
+  current = grid;
+  current_age = ++age;
+
+  dest.SetSize(grid.width, grid.height);
+
+  const Entry *source = FindSource(grid);
+
+  int rx = 1, ry = 1;
+  int column_begin = grid.west, column_end = grid.west;
+  int row_begin = 0, row_end = 0;
+  if (source != nullptr) {
+    rx = GetReduction(source->grid.level_x, grid.level_x);
+    ry = GetReduction(source->grid.level_y, grid.level_y);
+
+    GetOverlap(grid.west, grid.width, source->grid.west, source->grid.width,
+               rx, column_begin, column_end);
+    GetOverlap(-grid.north, grid.height,
+               -source->grid.north, source->grid.height,
+               ry, row_begin, row_end);
+  }
+
+  /* convert to indices relative to the new grid */
+  const unsigned copy_begin = column_begin - grid.west;
+  const unsigned copy_end = column_end - grid.west;
+
+  const Angle step_y = HeightGrid::GetStep(grid.level_y);
+  TerrainHeight *p = dest.data.begin();
+  for (unsigned y = 0; y < grid.height; ++y, p += grid.width) {
+    const int global_y = grid.north - int(y);
+    const Angle latitude = step_y * global_y;
+
+    if (-global_y < row_begin || -global_y >= row_end ||
+        copy_begin >= copy_end) {
+      ScanColumns(*map, grid, latitude, p, 0, grid.width, interpolate);
+      continue;
+    }
+
+    const unsigned source_y = source->grid.north - global_y * ry;
+    const TerrainHeight *s = source->matrix.GetRow(source_y)
+      + (column_begin * rx - source->grid.west);
+    for (unsigned x = copy_begin; x < copy_end; ++x, s += rx)
+      p[x] = *s;
+
+    ScanColumns(*map, grid, latitude, p, 0, copy_begin, interpolate);
+    ScanColumns(*map, grid, latitude, p, copy_end, grid.width, interpolate);
+  }
+}
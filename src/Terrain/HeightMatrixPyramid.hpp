@@ -0,0 +1,133 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#ifndef XCSOAR_TERRAIN_HEIGHT_MATRIX_PYRAMID_HPP
+#define XCSOAR_TERRAIN_HEIGHT_MATRIX_PYRAMID_HPP
+
+#include "HeightMatrix.hpp"
+#include "Compiler.h"
+
+class Angle;
+class GeoBounds;
+class RasterMap;
+
+/**
+ * Describes the sample positions of a #HeightMatrix on a global grid.
+ * The distance between two samples is snapped to a power of the
+ * square root of two (the "level"), and the samples are aligned to
+ * multiples of that distance.  This makes the samples of two grids
+ * comparable: at the same level, they are shifted by an integral
+ * number of samples; two levels apart, every other sample of the
+ * finer grid coincides with a sample of the coarser one.
+ */
+struct HeightGrid {
+  /**
+   * The step sizes are 2^(level/2) radians.
+   */
+  int level_x, level_y;
+
+  /**
+   * The global index of the westernmost column and of the northernmost
+   * row.
+   */
+  int west, north;
+
+  unsigned width, height;
+
+  /**
+   * Calculate a grid which covers (at most) the given bounds with
+   * approximately the given resolution.
+   *
+   * @return false if no such grid could be calculated (e.g. because
+   * the bounds are too small)
+   */
+  bool Snap(const GeoBounds &bounds, unsigned width, unsigned height);
+
+  gcc_const
+  static Angle GetStep(int level);
+
+  gcc_pure
+  GeoBounds GetBounds() const;
+};
+
+/**
+ * A small cache of recently calculated #HeightMatrix objects.  It
+ * copies samples from a previous result instead of scanning the
+ * #RasterMap again: after panning, only the newly exposed strips have
+ * to be scanned, and zooming out by a factor of two reuses the
+ * samples of the finer grid.
+ *
+ * The cache must be cleared with Clear() whenever the contents of the
+ * #RasterMap change.
+ */
+class HeightMatrixPyramid {
+  static constexpr unsigned MAX_ENTRIES = 2;
+
+  struct Entry {
+    HeightGrid grid;
+    HeightMatrix matrix;
+
+    /**
+     * The value of #HeightMatrixPyramid::age when this entry was
+     * stored.  0 means the entry is unused.
+     */
+    unsigned age = 0;
+  };
+
+  Entry entries[MAX_ENTRIES];
+
+  /**
+   * The map the cached samples were scanned from.  This is only used
+   * for comparison.
+   */
+  const RasterMap *map = nullptr;
+
+  /**
+   * The grid of the #HeightMatrix which was filled by the previous
+   * Fill() call.  Only valid if #current_age is non-zero.
+   */
+  HeightGrid current;
+
+  unsigned current_age = 0;
+
+  unsigned age = 0;
+
+public:
+  void Clear();
+
+  /**
+   * Fill the #HeightMatrix with the samples of the given grid,
+   * reusing cached samples where possible.  The previous contents of
+   * the #HeightMatrix are moved to the cache.
+   *
+   * @param dest the #HeightMatrix that was passed to the previous
+   * Fill() call; its buffer may be exchanged with a cached one
+   */
+  void Fill(HeightMatrix &dest, const RasterMap &map,
+            const HeightGrid &grid, bool interpolate);
+
+private:
+  const Entry *FindSource(const HeightGrid &grid) const;
+};
+
+#endif
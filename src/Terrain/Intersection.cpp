@@ -47,7 +47,10 @@ RasterTileCache::FirstIntersection(const SignedRasterLocation origin,
     // origin is outside overall bounds
     return false;
 
-  const TerrainHeight h_origin2 = GetFieldDirect(origin.x, origin.y).first;
+  TileCursor cursor;
+
+  const TerrainHeight h_origin2 =
+    GetFieldDirect(origin.x, origin.y, cursor).first;
   if (h_origin2.IsInvalid()) {
     _location = location;
     _h = h_origin;
@@ -115,7 +118,8 @@ RasterTileCache::FirstIntersection(const SignedRasterLocation origin,
       if (!IsInside(location))
         break; // outside bounds
 
-      const auto field_direct = GetFieldDirect(location.x, location.y);
+      const auto field_direct = GetFieldDirect(location.x, location.y,
+                                               cursor);
       if (field_direct.first.IsInvalid())
         break;
 
@@ -225,12 +229,13 @@ RasterTileCache::FirstIntersection(const SignedRasterLocation origin,
 }
 
 inline std::pair<TerrainHeight, bool>
-RasterTileCache::GetFieldDirect(const unsigned px, const unsigned py) const
+RasterTileCache::GetFieldDirect(const unsigned px, const unsigned py,
+                                TileCursor &cursor) const
 {
   assert(px < width);
   assert(py < height);
 
-  const RasterTile &tile = tiles.Get(px / tile_width, py / tile_height);
+  const RasterTile &tile = GetTile(px, py, cursor);
   if (tile.IsEnabled())
     return std::make_pair(tile.GetHeight(px, py), true);
 
@@ -297,6 +302,8 @@ RasterTileCache::Intersection(const SignedRasterLocation origin,
   RasterLocation last_clear_location = location;
   int last_clear_h = h_origin;
 
+  TileCursor cursor;
+
   while (true) {
 
     if (!step_counter) {
@@ -304,7 +311,8 @@ RasterTileCache::Intersection(const SignedRasterLocation origin,
       if (!IsInside(location))
         break;
 
-      const auto field_direct = GetFieldDirect(location.x, location.y);
+      const auto field_direct = GetFieldDirect(location.x, location.y,
+                                               cursor);
       if (field_direct.first.IsInvalid())
         break;
 
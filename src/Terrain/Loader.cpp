@@ -28,6 +28,11 @@ Copyright_License {
 #include "WorldFile.hpp"
 #include "Operation/Operation.hpp"
 #include "OS/ConvertPathName.hpp"
+#include "Thread/Thread.hpp"
+#include "Thread/Mutex.hpp"
+
+#include <algorithm>
+#include <memory>
 
 extern "C" {
 #include "jasper/jp2/jp2_cod.h"
@@ -55,7 +60,8 @@ TerrainLoader::SkipMarkerSegment(long file_offset) const
 
   long skip_to = segment->file_offset;
   while (segment->IsTileSegment() &&
-         !raster_tile_cache.tiles.GetLinear(segment->tile).IsRequested()) {
+         (!IsAssigned(segment->tile) ||
+          !raster_tile_cache.tiles.GetLinear(segment->tile).IsRequested())) {
     ++segment;
     if (segment >= raster_tile_cache.segments.end())
       /* last segment is hidden; shouldn't happen either, because we
@@ -176,9 +182,36 @@ TerrainLoader::PutTileData(unsigned index,
     raster_tile_cache.PutOverviewTile(index, start_x, start_y,
                                       end_x, end_y, m);
 
-  if (scan_tiles) {
-    const ScopeExclusiveLock lock(mutex);
-    raster_tile_cache.PutTileData(index, m);
+  if (scan_tiles && IsAssigned(index)) {
+    {
+      const ScopeExclusiveLock lock(mutex);
+      raster_tile_cache.PutTileData(index, m);
+    }
+
+    /* no other thread writes this tile, so it can be stored without
+       holding the lock; only the store itself is shared with the
+       other workers */
+    if (store_mutex != nullptr) {
+      const ScopeLock lock(*store_mutex);
+      raster_tile_cache.StoreTile(index);
+    } else
+      raster_tile_cache.StoreTile(index);
+  }
+}
+
+static bool jasper_tables_initialised = false;
+
+/**
+ * Initialise libjasper's global lookup tables.  This must happen
+ * before the first decoder thread is started, because they are
+ * shared by all decoders.
+ */
+static void
+InitJasperTables()
+{
+  if (!jasper_tables_initialised) {
+    jpc_initluts();
+    jasper_tables_initialised = true;
   }
 }
 
@@ -224,7 +257,7 @@ LoadJPG2000(jas_stream_t *in, void *loader)
   opts.maxlyrs = JPC_MAXLYRS;
   opts.maxpkts = -1;
 
-  jpc_initluts();
+  InitJasperTables();
 
   const auto dec = jpc_dec_create(&opts, in);
   if (dec == nullptr)
@@ -304,17 +337,107 @@ LoadTerrainOverview(struct zzip_dir *dir,
   return loader.LoadOverview(dir, path, world_file);
 }
 
+/**
+ * A thread which decodes one partition of the requested tiles.
+ */
+class TerrainDecoderThread final : public Thread {
+  NullOperationEnvironment env;
+  TerrainLoader loader;
+
+  struct zzip_dir *const dir;
+  const char *const path;
+
+  bool success;
+
+public:
+  TerrainDecoderThread(SharedMutex &mutex, RasterTileCache &rtc,
+                       struct zzip_dir *_dir, const char *_path,
+                       unsigned worker, unsigned n_workers,
+                       Mutex &store_mutex)
+    :loader(mutex, rtc, false, true, env), dir(_dir), path(_path) {
+    loader.SetPartition(worker, n_workers, store_mutex);
+  }
+
+  /**
+   * Wait for the decoder to finish.  If the thread could not be
+   * started, decode synchronously.
+   */
+  bool Finish() {
+    if (IsDefined())
+      Join();
+    else
+      Run();
+
+    return success;
+  }
+
+protected:
+  void Run() override {
+    success = loader.DecodeTiles(dir, path);
+  }
+};
+
 inline bool
-TerrainLoader::UpdateTiles(struct zzip_dir *dir, const char *path,
+TerrainLoader::UpdateTiles(struct zzip_dir *const*dirs, unsigned n_dirs,
+                           const char *path,
                            int x, int y, unsigned radius)
 {
   assert(!scan_overview);
+  assert(n_dirs > 0);
+  assert(n_dirs <= MAX_TERRAIN_DECODERS);
 
   if (!raster_tile_cache.PollTiles(x, y, radius))
     /* nothing to do */
     return true;
 
-  bool success = LoadJPG2000(dir, path);
+  bool remaining;
+  {
+    const ScopeExclusiveLock lock(mutex);
+    remaining = raster_tile_cache.LoadStoredTiles();
+  }
+
+  if (!remaining) {
+    raster_tile_cache.FinishTileUpdate();
+    return true;
+  }
+
+  /* don't start more threads than there are tiles to decode */
+  unsigned n_requested = 0;
+  for (const unsigned i : raster_tile_cache.request_tiles)
+    if (raster_tile_cache.tiles.GetLinear(i).IsRequested())
+      ++n_requested;
+
+  const unsigned n = std::min(n_dirs, std::max(n_requested, 1u));
+
+  bool success;
+  if (n > 1) {
+    InitJasperTables();
+
+    Mutex shared_store_mutex;
+    worker = 0;
+    n_workers = n;
+    store_mutex = &shared_store_mutex;
+
+    std::unique_ptr<TerrainDecoderThread> threads[MAX_TERRAIN_DECODERS - 1];
+    for (unsigned i = 1; i < n; ++i) {
+      threads[i - 1].reset(new TerrainDecoderThread(mutex, raster_tile_cache,
+                                                    dirs[i], path, i, n,
+                                                    shared_store_mutex));
+      threads[i - 1]->Start();
+    }
+
+    /* this thread decodes the first partition */
+    success = LoadJPG2000(dirs[0], path);
+
+    for (unsigned i = 1; i < n; ++i)
+      if (!threads[i - 1]->Finish())
+        success = false;
+
+    n_workers = 1;
+    store_mutex = nullptr;
+  } else
+    success = LoadJPG2000(dirs[0], path);
+
   raster_tile_cache.FinishTileUpdate();
   return success;
 }
@@ -329,7 +452,7 @@ UpdateTerrainTiles(struct zzip_dir *dir, const char *path,
 
   NullOperationEnvironment env;
   TerrainLoader loader(mutex, raster_tile_cache, false, true, env);
-  return loader.UpdateTiles(dir, path, x, y, radius);
+  return loader.UpdateTiles(&dir, 1, path, x, y, radius);
 }
 
 bool
@@ -344,3 +467,22 @@ UpdateTerrainTiles(struct zzip_dir *dir, const char *path,
                             raster_location.x, raster_location.y,
                             projection.DistancePixelsCoarse(radius));
 }
+
+bool
+UpdateTerrainTiles(struct zzip_dir *const*dirs, unsigned n_dirs,
+                   const char *path,
+                   RasterTileCache &raster_tile_cache, SharedMutex &mutex,
+                   const RasterProjection &projection,
+                   const GeoPoint &location, double radius)
+{
+  if (!raster_tile_cache.IsValid())
+    return false;
+
+  const auto raster_location = projection.ProjectCoarse(location);
+
+  NullOperationEnvironment env;
+  TerrainLoader loader(mutex, raster_tile_cache, false, true, env);
+  return loader.UpdateTiles(dirs, n_dirs, path,
+                            raster_location.x, raster_location.y,
+                            projection.DistancePixelsCoarse(radius));
+}
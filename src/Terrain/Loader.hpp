@@ -26,12 +26,18 @@ Copyright_License {
 
 #include "Thread/SharedMutex.hpp"
 
+class Mutex;
 struct zzip_dir;
 struct GeoPoint;
 class RasterTileCache;
 class RasterProjection;
 class OperationEnvironment;
 
+/**
+ * The maximum number of threads decoding JPEG2000 tiles in parallel.
+ */
+static constexpr unsigned MAX_TERRAIN_DECODERS = 4;
+
 class TerrainLoader {
   SharedMutex &mutex;
 
@@ -46,6 +52,18 @@ class TerrainLoader {
    */
   mutable unsigned remaining_segments = 0;
 
+  /**
+   * When decoding in parallel, this object decodes only the requested
+   * tiles whose index modulo #n_workers equals #worker.
+   */
+  unsigned worker = 0, n_workers = 1;
+
+  /**
+   * Serialises RasterTileCache::StoreTile() calls of parallel
+   * workers.  nullptr if this is the only one.
+   */
+  Mutex *store_mutex = nullptr;
+
 public:
   TerrainLoader(SharedMutex &_mutex, RasterTileCache &_rtc,
                 bool _scan_overview, bool _scan_all,
@@ -57,9 +75,30 @@ public:
 
   bool LoadOverview(struct zzip_dir *dir,
                     const char *path, const char *world_file);
-  bool UpdateTiles(struct zzip_dir *dir, const char *path,
+  /**
+   * Decode the requested tiles.  The requested tiles are distributed
+   * over up to #n_dirs threads, each one reading from its own handle
+   * of the same ZIP archive.
+   */
+  bool UpdateTiles(struct zzip_dir *const*dirs, unsigned n_dirs,
+                   const char *path,
                    int x, int y, unsigned radius);
 
+  /**
+   * Restrict this object to one partition of the requested tiles.
+   * Used by the worker threads of UpdateTiles().
+   */
+  void SetPartition(unsigned _worker, unsigned _n_workers,
+                    Mutex &_store_mutex) {
+    worker = _worker;
+    n_workers = _n_workers;
+    store_mutex = &_store_mutex;
+  }
+
+  bool DecodeTiles(struct zzip_dir *dir, const char *path) {
+    return LoadJPG2000(dir, path);
+  }
+
   /* callback methods for libjasper (via jas_rtc.cpp) */
 
   long SkipMarkerSegment(long file_offset) const;
@@ -79,6 +118,10 @@ public:
                    const struct jas_matrix &m);
 
 private:
+  bool IsAssigned(unsigned tile) const {
+    return tile % n_workers == worker;
+  }
+
   bool LoadJPG2000(struct zzip_dir *dir, const char *path);
   void ParseBounds(const char *data);
 };
@@ -118,6 +161,17 @@ UpdateTerrainTiles(struct zzip_dir *dir,
                             x, y, radius);
 }
 
+/**
+ * Like UpdateTerrainTiles(), but decodes in parallel if more than one
+ * handle to the ZIP archive is passed.
+ */
+bool
+UpdateTerrainTiles(struct zzip_dir *const*dirs, unsigned n_dirs,
+                   const char *path,
+                   RasterTileCache &raster_tile_cache, SharedMutex &mutex,
+                   const RasterProjection &projection,
+                   const GeoPoint &location, double radius);
+
 bool
 UpdateTerrainTiles(struct zzip_dir *dir, const char *path,
                    RasterTileCache &raster_tile_cache, SharedMutex &mutex,
@@ -53,6 +53,18 @@ RasterMap::GetHeight(const GeoPoint &location) const
   return raster_tile_cache.GetHeight(pt.x, pt.y);
 }
 
+void
+RasterMap::GetHeights(ConstBuffer<GeoPoint> locations,
+                      TerrainHeight *buffer) const
+{
+  RasterTileCache::TileCursor cursor;
+
+  for (const auto &location : locations) {
+    const auto pt = projection.ProjectCoarse(location);
+    *buffer++ = raster_tile_cache.GetHeight(pt.x, pt.y, cursor);
+  }
+}
+
 TerrainHeight
 RasterMap::GetInterpolatedHeight(const GeoPoint &location) const
 {
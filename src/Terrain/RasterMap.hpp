@@ -111,6 +111,18 @@ public:
   gcc_pure
   TerrainHeight GetInterpolatedHeight(const GeoPoint &location) const;
 
+  /**
+   * Determine the non-interpolated heights at many locations.  This
+   * is faster than calling GetHeight() for each location, because
+   * the tile lookup is skipped when consecutive locations are in the
+   * same tile; therefore, nearby locations should be adjacent in the
+   * list.
+   *
+   * @param buffer a buffer with room for one height per location
+   */
+  void GetHeights(ConstBuffer<GeoPoint> locations,
+                  TerrainHeight *buffer) const;
+
   /**
    * Scan a straight line and fill the buffer with the specified
    * number of samples along the line.
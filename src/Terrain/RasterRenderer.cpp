@@ -23,6 +23,7 @@ Copyright_License {
 
 #include "Terrain/RasterRenderer.hpp"
 #include "Terrain/RasterMap.hpp"
+#include "Terrain/SlopeShading.hpp"
 #include "Math/FastMath.hpp"
 #include "Util/Clamp.hpp"
 #include "Screen/Ramp.hpp"
@@ -34,6 +35,12 @@ Copyright_License {
 #include "Asset.hpp"
 #include "Event/Idle.hpp"
 
+#ifdef USE_GLSL
+#include "Screen/OpenGL/Shaders.hpp"
+#include "Screen/OpenGL/Program.hpp"
+#include "Screen/OpenGL/Texture.hpp"
+#endif
+
 #include <assert.h>
 #include <stdint.h>
 
@@ -99,6 +106,21 @@ ContourInterval(const TerrainHeight h, const unsigned contour_height_scale)
   return ContourInterval(h.GetValue(), contour_height_scale);
 }
 
+/**
+ * Calculate the sun vector for slope shading.
+ */
+static void
+CalculateSunVector(int brightness, const Angle sunazimuth,
+                   int &sx, int &sy, int &sz)
+{
+  const Angle fudgeelevation = Angle::Degrees(10) +
+    Angle::Degrees(80.0 / 255.0) * brightness;
+
+  sx = (int)(255 * fudgeelevation.fastcosine() * -sunazimuth.fastsine());
+  sy = (int)(255 * fudgeelevation.fastcosine() * -sunazimuth.fastcosine());
+  sz = (int)(255 * fudgeelevation.fastsine());
+}
+
 RasterRenderer::RasterRenderer()
 {
   // scale quantisation_pixels so resolution is not too high on old hardware
@@ -113,6 +135,9 @@ RasterRenderer::~RasterRenderer()
   delete[] color_table;
   delete image;
   delete[] contour_column_base;
+  delete[] height_row;
+  delete[] contour_row;
+  delete[] slope_row;
 }
 
 #ifdef ENABLE_OPENGL
@@ -189,10 +214,17 @@ RasterRenderer::ScanMap(const RasterMap &map, const WindowProjection &projection
   bounds = projection.GetScreenBounds().Scale(1.5);
   bounds.IntersectWith(map.GetBounds());
 
-  height_matrix.Fill(map, bounds,
-                     projection.GetScreenWidth() / quantisation_pixels,
-                     projection.GetScreenHeight() / quantisation_pixels,
-                     true);
+  const unsigned width = projection.GetScreenWidth() / quantisation_pixels;
+  const unsigned height = projection.GetScreenHeight() / quantisation_pixels;
+
+  HeightGrid grid;
+  if (grid.Snap(bounds, width, height)) {
+    height_cache.Fill(height_matrix, map, grid, true);
+    bounds = grid.GetBounds();
+  } else {
+    height_cache.Clear();
+    height_matrix.Fill(map, bounds, width, height, true);
+  }
 
   last_quantisation_pixels = quantisation_pixels;
 #else
@@ -200,6 +232,18 @@ RasterRenderer::ScanMap(const RasterMap &map, const WindowProjection &projection
 #endif
 }
 
+unsigned
+RasterRenderer::GetHeightSlopeFactor() const
+{
+  assert(quantisation_effective > 0);
+
+  return Clamp((unsigned)pixel_size, 1u,
+               /* this upper limit avoids integer overflows in the
+                  "mag" formula; it effectively limits "dd2" so
+                  calculating its square will not overflow */
+               8192u / (quantisation_effective * quantisation_effective));
+}
+
 void
 RasterRenderer::GenerateImage(bool do_shading,
                               unsigned height_scale,
@@ -207,6 +251,34 @@ RasterRenderer::GenerateImage(bool do_shading,
                               const Angle sunazimuth,
                               bool do_contour)
 {
+  if (quantisation_effective == 0) {
+    do_shading = false;
+    do_contour = false;
+  }
+
+  const unsigned contour_height_scale = do_contour? height_scale * 2 : 16;
+
+#ifdef USE_GLSL
+  use_shader = OpenGL::terrain_shader != nullptr;
+  if (use_shader) {
+    /* no need to generate an image: the shader renders the raw
+       heights */
+    shader.shading = do_shading;
+    shader.step = std::max(quantisation_effective, 1u);
+    shader.height_scale = 1.f / (1u << height_scale);
+    shader.contour_scale = 1.f / (1u << contour_height_scale);
+    shader.contrast = contrast / 128.f;
+    shader.slope_z = do_shading
+      ? 2.f * quantisation_effective * GetHeightSlopeFactor()
+      : 1.f;
+    CalculateSunVector(brightness, sunazimuth,
+                       shader.sx, shader.sy, shader.sz);
+
+    textures.SetHeights(height_matrix);
+    return;
+  }
+#endif
+
   if (image == nullptr ||
       height_matrix.GetWidth() > image->GetWidth() ||
       height_matrix.GetHeight() > image->GetHeight()) {
@@ -215,14 +287,16 @@ RasterRenderer::GenerateImage(bool do_shading,
 
     delete[] contour_column_base;
     contour_column_base = new unsigned char[height_matrix.GetWidth()];
-  }
 
-  if (quantisation_effective == 0) {
-    do_shading = false;
-    do_contour = false;
-  }
+    delete[] height_row;
+    height_row = new uint8_t[height_matrix.GetWidth()];
 
-  const unsigned contour_height_scale = do_contour? height_scale * 2 : 16;
+    delete[] contour_row;
+    contour_row = new uint8_t[height_matrix.GetWidth()];
+
+    delete[] slope_row;
+    slope_row = new int8_t[height_matrix.GetWidth()];
+  }
 
   ContourStart(contour_height_scale);
 
@@ -235,71 +309,65 @@ RasterRenderer::GenerateImage(bool do_shading,
   image->SetDirty();
 }
 
+#ifdef USE_GLSL
+
+bool
+RasterRenderer::UpdateSunAzimuth(int brightness, const Angle sunazimuth)
+{
+  if (!use_shader)
+    return false;
+
+  CalculateSunVector(brightness, sunazimuth,
+                     shader.sx, shader.sy, shader.sz);
+  return true;
+}
+
+#endif
+
 void
 RasterRenderer::GenerateUnshadedImage(unsigned height_scale,
                                       const unsigned contour_height_scale)
 {
+  const unsigned width = height_matrix.GetWidth();
   const auto *src = height_matrix.GetData();
   const RawColor *oColorBuf = color_table + 64 * 256;
   RawColor *dest = image->GetTopRow();
 
-  for (unsigned y = height_matrix.GetHeight(); y > 0; --y) {
+  for (unsigned y = height_matrix.GetHeight(); y > 0; --y, src += width) {
     RawColor *p = dest;
     dest = image->GetNextRow(dest);
 
-    unsigned contour_row_base = ContourInterval(*src, contour_height_scale);
+    QuantiseHeightRow(height_row, src, width, height_scale);
+    QuantiseHeightRow(contour_row, src, width, contour_height_scale);
+
+    unsigned contour_row_base = contour_row[0];
     unsigned char *contour_this_column_base = contour_column_base;
 
-    for (unsigned x = height_matrix.GetWidth(); x > 0; --x) {
-      const auto e = *src++;
+    for (unsigned x = 0; x < width; ++x, ++p, ++contour_this_column_base) {
+      const auto e = src[x];
       if (gcc_likely(!e.IsSpecial())) {
-        unsigned h = std::max(0, (int)e.GetValue());
-
-        const unsigned contour_interval =
-          ContourInterval(h, contour_height_scale);
+        const unsigned contour_interval = contour_row[x];
+        const unsigned h = height_row[x];
 
-        h = std::min(254u, h >> height_scale);
         if (gcc_unlikely((contour_interval != contour_row_base)
                          || (contour_interval != *contour_this_column_base))) {
 
-          *p++ = oColorBuf[(int)h - 64 * 256];
+          *p = oColorBuf[(int)h - 64 * 256];
           *contour_this_column_base = contour_row_base = contour_interval;
         } else {
-          *p++ = oColorBuf[h];
+          *p = oColorBuf[h];
         }
       } else if (e.IsWater()) {
         // we're in the water, so look up the color for water
-        *p++ = oColorBuf[255];
+        *p = oColorBuf[255];
       } else {
         /* outside the terrain file bounds: white background */
-        *p++ = RawColor(0xff, 0xff, 0xff);
+        *p = RawColor(0xff, 0xff, 0xff);
       }
-      contour_this_column_base++;
-
     }
   }
 }
 
-/**
- * Clip the difference between two adjacent terrain height values to
- * sane bounds.  This works around integer overflows in the
- * GenerateSlopeImage() formula when the map file is broken, avoiding
- * the sqrt() call with a negative argument.
- */
-gcc_const
-static int
-ClipHeightDelta(int d)
-{
-  return Clamp(d, -512, 512);
-}
-
-gcc_const
-static int
-ClipHeightDelta(TerrainHeight a, TerrainHeight b)
-{
-  return ClipHeightDelta(a.GetValue() - b.GetValue());
-}
-
 // JMW: if zoomed right in (e.g. one unit is larger than terrain
 // grid), then increase the step size to be equal to the terrain
 // grid for purposes of calculating slope, to avoid shading problems
@@ -313,77 +381,86 @@ RasterRenderer::GenerateSlopeImage(unsigned height_scale,
 {
   assert(quantisation_effective > 0);
 
+  const unsigned width = height_matrix.GetWidth();
+
   PixelRect border;
   border.left = quantisation_effective;
   border.top = quantisation_effective;
-  border.right = height_matrix.GetWidth() - quantisation_effective;
+  border.right = width - quantisation_effective;
   border.bottom = height_matrix.GetHeight() - quantisation_effective;
 
-  const unsigned height_slope_factor =
-    Clamp((unsigned)pixel_size, 1u,
-          /* this upper limit avoids integer overflows in the "mag"
-             formula; it effectively limits "dd2" so calculating its
-             square will not overflow */
-          8192u / (quantisation_effective * quantisation_effective));
+  const unsigned height_slope_factor = GetHeightSlopeFactor();
 
   const auto *src = height_matrix.GetData();
   const RawColor *oColorBuf = color_table + 64 * 256;
 
   RawColor *dest = image->GetTopRow();
 
-  for (unsigned y = 0; y < height_matrix.GetHeight(); ++y) {
+  for (unsigned y = 0; y < height_matrix.GetHeight(); ++y, src += width) {
     const unsigned row_plus_index = y < (unsigned)border.bottom
       ? quantisation_effective
       : height_matrix.GetHeight() - 1 - y;
-    const unsigned row_plus_offset = height_matrix.GetWidth() * row_plus_index;
+    const unsigned row_plus_offset = width * row_plus_index;
 
     const unsigned row_minus_index = y >= quantisation_effective
       ? quantisation_effective : y;
-    const unsigned row_minus_offset = height_matrix.GetWidth() * row_minus_index;
+    const unsigned row_minus_offset = width * row_minus_index;
 
-    const unsigned p31 = row_plus_index + row_minus_index;
+    const SlopeShadingParameters params{
+      row_plus_index + row_minus_index, height_slope_factor,
+      sx, sy, sz, contrast,
+    };
 
     RawColor *p = dest;
     dest = image->GetNextRow(dest);
 
-    unsigned contour_row_base = ContourInterval(*src, contour_height_scale);
-    unsigned char *contour_this_column_base = contour_column_base;
+    QuantiseHeightRow(height_row, src, width, height_scale);
+    QuantiseHeightRow(contour_row, src, width, contour_height_scale);
 
-    for (unsigned x = 0; x < height_matrix.GetWidth(); ++x, ++src) {
-      const auto e = *src;
-      if (gcc_likely(!e.IsSpecial())) {
-        unsigned h = std::max(0, (int)e.GetValue());
+    /* the columns which are not at the border have constant
+       neighbour offsets; calculate their slope in one pass */
+    if (width > 2 * quantisation_effective)
+      CalculateSlopeRow(slope_row + quantisation_effective,
+                        src + quantisation_effective,
+                        width - 2 * quantisation_effective,
+                        row_minus_offset, row_plus_offset,
+                        quantisation_effective, params);
 
-        const unsigned contour_interval =
-          ContourInterval(h, contour_height_scale);
+    unsigned contour_row_base = contour_row[0];
+    unsigned char *contour_this_column_base = contour_column_base;
 
-        h = std::min(254u, h >> height_scale);
+    for (unsigned x = 0; x < width; ++x, ++p, ++contour_this_column_base) {
+      const auto *s = src + x;
+      const auto e = *s;
+      if (gcc_likely(!e.IsSpecial())) {
+        const unsigned contour_interval = contour_row[x];
+        const unsigned h = height_row[x];
 
         // no need to calculate slope if undefined height or sea level
 
         // Y direction
-        assert(src - row_minus_offset >= height_matrix.GetData());
-        assert(src + row_plus_offset >= height_matrix.GetData());
-        assert(src - row_minus_offset < height_matrix.GetDataEnd());
-        assert(src + row_plus_offset < height_matrix.GetDataEnd());
+        assert(s - row_minus_offset >= height_matrix.GetData());
+        assert(s + row_plus_offset >= height_matrix.GetData());
+        assert(s - row_minus_offset < height_matrix.GetDataEnd());
+        assert(s + row_plus_offset < height_matrix.GetDataEnd());
 
         // X direction
 
         const unsigned column_plus_index = x < (unsigned)border.right
           ? quantisation_effective
-          : height_matrix.GetWidth() - 1 - x;
+          : width - 1 - x;
         const unsigned column_minus_index = x >= (unsigned)border.left
           ? quantisation_effective : x;
 
-        assert(src - column_minus_index >= height_matrix.GetData());
-        assert(src + column_plus_index >= height_matrix.GetData());
-        assert(src - column_minus_index < height_matrix.GetDataEnd());
-        assert(src + column_plus_index < height_matrix.GetDataEnd());
+        assert(s - column_minus_index >= height_matrix.GetData());
+        assert(s + column_plus_index >= height_matrix.GetData());
+        assert(s - column_minus_index < height_matrix.GetDataEnd());
+        assert(s + column_plus_index < height_matrix.GetDataEnd());
 
-        const auto h_above = src[-(int)row_minus_offset];
-        const auto h_below = src[row_plus_offset];
-        const auto h_left = src[-(int)column_minus_index];
-        const auto h_right = src[column_plus_index];
+        const auto h_above = s[-(int)row_minus_offset];
+        const auto h_below = s[row_plus_offset];
+        const auto h_left = s[-(int)column_minus_index];
+        const auto h_right = s[column_plus_index];
 
         if (gcc_unlikely(h_above.IsSpecial() ||
                          h_below.IsSpecial() ||
@@ -391,47 +468,35 @@ RasterRenderer::GenerateSlopeImage(unsigned height_scale,
                          h_right.IsSpecial())) {
           /* some "special" terrain value surrounding us (water or
              invalid), skip slope calculation */
-          *p++ = oColorBuf[h];
-          contour_this_column_base++;
+          *p = oColorBuf[h];
           continue;
         }
 
         if (gcc_unlikely((contour_interval != contour_row_base)
                          || (contour_interval != *contour_this_column_base))) {
 
-          *contour_this_column_base++ = contour_row_base = contour_interval;
-          *p++ = oColorBuf[int(h) - 64 * 256];
+          *contour_this_column_base = contour_row_base = contour_interval;
+          *p = oColorBuf[int(h) - 64 * 256];
           continue;
         }
 
-        const int p32 = ClipHeightDelta(h_above, h_below);
-        const int p22 = ClipHeightDelta(h_right, h_left);
-
-        const unsigned p20 = column_plus_index + column_minus_index;
-
-        const int dd0 = p22 * int(p31);
-        const int dd1 = int(p20) * p32;
-        const unsigned dd2 = p20 * p31 * height_slope_factor;
-        const int num = (int(dd2) * sz + dd0 * sx + dd1 * sy);
-        const unsigned square_mag = dd0 * dd0 + dd1 * dd1 + dd2 * dd2;
-        const unsigned mag = (unsigned)sqrt(square_mag);
-        /* this is a workaround for a SIGFPE (division by zero)
-           observed by our users on some Android devices (e.g. Nexus
-           7), even though we did our best to make sure that the
-           integer arithmetics above can't overflow */
-        /* TODO: debug this problem and replace this workaround */
-        const int sval = num / int(mag|1);
-        const int sindex = (sval - sz) * contrast / 128;
-        *p++ = oColorBuf[int(h) + 256 * Clamp(sindex, -63, 63)];
+        const int sindex =
+          column_plus_index == quantisation_effective &&
+          column_minus_index == quantisation_effective
+          /* precalculated by CalculateSlopeRow() */
+          ? slope_row[x]
+          : CalculateSlopeIndex(ClipHeightDelta(h_right, h_left),
+                                ClipHeightDelta(h_above, h_below),
+                                column_plus_index + column_minus_index,
+                                params);
+        *p = oColorBuf[int(h) + 256 * sindex];
       } else if (e.IsWater()) {
         // we're in the water, so look up the color for water
-        *p++ = oColorBuf[255];
+        *p = oColorBuf[255];
       } else {
         /* outside the terrain file bounds: white background */
-        *p++ = RawColor(0xff, 0xff, 0xff);
+        *p = RawColor(0xff, 0xff, 0xff);
       }
-      contour_this_column_base++;
-
     }
   }
 }
@@ -442,12 +507,8 @@ RasterRenderer::GenerateSlopeImage(unsigned height_scale,
                                    const Angle sunazimuth,
                                    const unsigned contour_height_scale)
 {
-  const Angle fudgeelevation = Angle::Degrees(10) +
-    Angle::Degrees(80.0 / 255.0) * brightness;
-
-  const int sx = (int)(255 * fudgeelevation.fastcosine() * -sunazimuth.fastsine());
-  const int sy = (int)(255 * fudgeelevation.fastcosine() * -sunazimuth.fastcosine());
-  const int sz = (int)(255 * fudgeelevation.fastsine());
+  int sx, sy, sz;
+  CalculateSunVector(brightness, sunazimuth, sx, sy, sz);
 
   GenerateSlopeImage(height_scale, contrast,
                      sx, sy, sz, contour_height_scale);
@@ -461,28 +522,30 @@ RasterRenderer::PrepareColorTable(const ColorRamp *color_ramp, bool do_water,
     color_table = new RawColor[256 * 128];
 
   for (int i = 0; i < 256; i++) {
-    for (int mag = -64; mag < 64; mag++) {
-      RawColor color;
-
-      if (i == 255) {
-        if (do_water) {
-          // water colours
-          color = RawColor(85, 160, 255);
-        } else {
-          color = RawColor(255, 255, 255);
-
-          // ColorRampLookup(0, r, g, b,
-          // Color_ramp, NUM_COLOR_RAMP_LEVELS, interp_levels);
-        }
-      } else {
-        const RGB8Color color2 =
-          ColorRampLookup(i << height_scale, color_ramp,
-                          NUM_COLOR_RAMP_LEVELS, interp_levels);
+    if (i == 255) {
+      // water colours
+      const RGB8Color color = do_water
+        ? RGB8Color(85, 160, 255)
+        : RGB8Color(255, 255, 255);
+
+      for (int mag = -64; mag < 64; mag++)
+        color_table[i + (mag + 64) * 256] =
+          RawColor(color.Red(), color.Green(), color.Blue());
+
+#ifdef USE_GLSL
+      textures.SetRampColor(i, color);
+#endif
+    } else {
+      const RGB8Color color =
+        ColorRampLookup(i << height_scale, color_ramp,
+                        NUM_COLOR_RAMP_LEVELS, interp_levels);
 
-        color = TerrainShading(mag, color2);
-      }
+      for (int mag = -64; mag < 64; mag++)
+        color_table[i + (mag + 64) * 256] = TerrainShading(mag, color);
 
-      color_table[i + (mag + 64) * 256] = color;
+#ifdef USE_GLSL
+      textures.SetRampColor(i, color);
+#endif
     }
   }
 }
@@ -503,12 +566,21 @@ RasterRenderer::Draw(Canvas &canvas,
                      bool transparent_white) const
 {
 #ifdef ENABLE_OPENGL
-  if (bounds.IsValid() && bounds.Overlaps(projection.GetScreenBounds()))
-    DrawGeoBitmap(*image,
-                  PixelSize(height_matrix.GetWidth(),
-                            height_matrix.GetHeight()),
-                  bounds,
-                  projection);
+  if (!bounds.IsValid() || !bounds.Overlaps(projection.GetScreenBounds()))
+    return;
+
+#ifdef USE_GLSL
+  if (use_shader) {
+    DrawShader(projection);
+    return;
+  }
+#endif
+
+  DrawGeoBitmap(*image,
+                PixelSize(height_matrix.GetWidth(),
+                          height_matrix.GetHeight()),
+                bounds,
+                projection);
 #else
   image->StretchTo(height_matrix.GetWidth(), height_matrix.GetHeight(),
                    canvas, projection.GetScreenWidth(),
@@ -516,3 +588,37 @@ RasterRenderer::Draw(Canvas &canvas,
                    transparent_white);
 #endif
 }
+
+#ifdef USE_GLSL
+
+void
+RasterRenderer::DrawShader(const WindowProjection &projection) const
+{
+  const unsigned width = height_matrix.GetWidth();
+  const unsigned height = height_matrix.GetHeight();
+
+  OpenGL::terrain_shader->Use();
+
+  const GLTexture &texture = textures.Bind();
+  const PixelSize allocated = texture.GetAllocatedSize();
+  const GLfloat texel_x = 1.f / allocated.cx, texel_y = 1.f / allocated.cy;
+
+  glUniform2f(OpenGL::terrain_step,
+              shader.step * texel_x, shader.step * texel_y);
+  glUniform2f(OpenGL::terrain_texel, texel_x, texel_y);
+  /* don't sample the padding of a power-of-two texture */
+  glUniform2f(OpenGL::terrain_limit,
+              (width - 0.5f) * texel_x, (height - 0.5f) * texel_y);
+  glUniform3f(OpenGL::terrain_sun, shader.sx, shader.sy, shader.sz);
+  glUniform1f(OpenGL::terrain_slope_z, shader.slope_z);
+  glUniform1f(OpenGL::terrain_contrast, shader.contrast);
+  glUniform1f(OpenGL::terrain_height_scale, shader.height_scale);
+  glUniform1f(OpenGL::terrain_contour_scale, shader.contour_scale);
+  glUniform1f(OpenGL::terrain_shading, shader.shading ? 1.f : 0.f);
+
+  DrawGeoTexture(texture, PixelSize(width, height), bounds, projection);
+
+  OpenGL::solid_shader->Use();
+}
+
+#endif
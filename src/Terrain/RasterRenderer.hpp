@@ -25,11 +25,19 @@ Copyright_License {
 #define XCSOAR_RASTER_RENDERER_HPP
 
 #include "Terrain/HeightMatrix.hpp"
+#include "Compiler.h"
+
+#include <stdint.h>
 
 #ifdef ENABLE_OPENGL
+#include "Terrain/HeightMatrixPyramid.hpp"
 #include "Geo/GeoBounds.hpp"
 #endif
 
+#ifdef USE_GLSL
+#include "Terrain/TerrainTextures.hpp"
+#endif
+
 #define NUM_COLOR_RAMP_LEVELS 13
 
 class Angle;
@@ -72,14 +80,77 @@ class RasterRenderer {
 #endif
 
   HeightMatrix height_matrix;
+
+#ifdef ENABLE_OPENGL
+  /**
+   * Recent #HeightMatrix grids, which allow ScanMap() to rescan only
+   * the parts that were not visible before.
+   */
+  HeightMatrixPyramid height_cache;
+#endif
+
   RawBitmap *image = nullptr;
 
   unsigned char *contour_column_base = nullptr;
 
+  /**
+   * Per-row scratch buffers for the SlopeShading.hpp kernels: the
+   * quantised height, the contour interval and the illumination
+   * index of each column.
+   */
+  uint8_t *height_row = nullptr, *contour_row = nullptr;
+  int8_t *slope_row = nullptr;
+
   double pixel_size;
 
   RawColor *color_table = nullptr;
 
+#ifdef USE_GLSL
+  /**
+   * The raw heights and the colour ramp for OpenGL::terrain_shader.
+   */
+  mutable TerrainTextures textures;
+
+  /**
+   * The OpenGL::terrain_shader uniforms calculated by
+   * GenerateImage().
+   */
+  struct ShaderParameters {
+    bool shading;
+
+    /**
+     * The distance between neighbours used for slope calculations
+     * [texels].
+     */
+    unsigned step;
+
+    /**
+     * Factors converting a height to a colour ramp index and to a
+     * contour interval.
+     */
+    float height_scale, contour_scale;
+
+    /**
+     * The vertical component of the (unnormalised) surface normal
+     * vector.
+     */
+    float slope_z;
+
+    float contrast;
+
+    /**
+     * The sun vector.
+     */
+    int sx, sy, sz;
+  } shader;
+
+  /**
+   * Shall Draw() use OpenGL::terrain_shader instead of #image?  This
+   * is decided by GenerateImage().
+   */
+  bool use_shader = false;
+#endif
+
 public:
   RasterRenderer();
   ~RasterRenderer();
@@ -104,6 +175,14 @@ public:
     bounds.SetInvalid();
   }
 
+  /**
+   * Discard all cached terrain samples.  This must be called when the
+   * contents of the #RasterMap change.
+   */
+  void FlushHeightCache() {
+    height_cache.Clear();
+  }
+
   /**
    * Calculate a new #quantisation_pixels value.
    *
@@ -140,6 +219,17 @@ public:
                      const Angle sunazimuth,
                      bool do_contour);
 
+#ifdef USE_GLSL
+  /**
+   * Change the sun position without generating a new image.  This is
+   * cheap when the image is shaded by OpenGL::terrain_shader.
+   *
+   * @return false if this object does not use the shader, and
+   * GenerateImage() must be called instead
+   */
+  bool UpdateSunAzimuth(int brightness, Angle sunazimuth);
+#endif
+
   const RawBitmap &GetImage() const {
     return *image;
   }
@@ -170,6 +260,12 @@ protected:
                           const unsigned contour_height_scale);
 
 private:
+  gcc_pure
+  unsigned GetHeightSlopeFactor() const;
+
+#ifdef USE_GLSL
+  void DrawShader(const WindowProjection &projection) const;
+#endif
 
   void ContourStart(const unsigned contour_height_scale);
 };
@@ -28,8 +28,11 @@ Copyright_License {
 #include "IO/FileCache.hpp"
 #include "OS/ConvertPathName.hpp"
 #include "Operation/Operation.hpp"
+#include "Thread/Util.hpp"
 #include "Util/ConvertString.hpp"
 
+#include <algorithm>
+
 static const TCHAR *const terrain_cache_name = _T("terrain");
 
 inline bool
@@ -67,20 +70,37 @@ inline bool
 RasterTerrain::Load(Path path, FileCache *cache,
                     OperationEnvironment &operation)
 {
-  if (LoadCache(cache, path))
-    return true;
+  if (!LoadCache(cache, path)) {
+    if (!LoadTerrainOverview(archive.get(), map.GetTileCache(), operation))
+      return false;
 
-  if (!LoadTerrainOverview(archive.get(), map.GetTileCache(), operation))
-    return false;
+    map.UpdateProjection();
 
-  map.UpdateProjection();
+    if (cache != nullptr)
+      SaveCache(*cache, path);
+  }
 
-  if (cache != nullptr)
-    SaveCache(*cache, path);
+  if (cache != nullptr &&
+      tile_store.Open(*cache, path, map.GetTileCache()))
+    map.GetTileCache().SetTileStore(&tile_store);
 
   return true;
 }
 
+void
+RasterTerrain::OpenDecoderArchives(Path path)
+{
+  const unsigned n = std::min(GetProcessorCount(), MAX_TERRAIN_DECODERS);
+  for (unsigned i = 1; i < n; ++i) {
+    try {
+      decoder_archives.emplace_back(path);
+    } catch (const std::runtime_error &) {
+      /* not fatal: decode with fewer threads */
+      break;
+    }
+  }
+}
+
 RasterTerrain *
 RasterTerrain::OpenTerrain(FileCache *cache, OperationEnvironment &operation)
 try {
@@ -94,6 +114,7 @@ try {
     return nullptr;
   }
 
+  rt->OpenDecoderArchives(path);
   return rt;
 } catch (const std::runtime_error &e) {
   operation.SetErrorMessage(UTF8ToWideConverter(e.what()));
@@ -101,13 +122,30 @@ try {
 }
 
 bool
-RasterTerrain::UpdateTiles(const GeoPoint &location, double radius)
+RasterTerrain::UpdateTiles(const GeoPoint &location, double radius,
+                           ConstBuffer<GeoPoint> prefetch)
 {
   auto &tile_cache = map.GetTileCache();
   if (!tile_cache.IsValid())
     return false;
 
-  UpdateTerrainTiles(archive.get(), tile_cache, mutex,
-                     map.GetProjection(), location, radius);
+  const auto &projection = map.GetProjection();
+
+  StaticArray<RasterLocation, RasterTileCache::MAX_PREFETCH> locations;
+  for (const auto &i : prefetch)
+    if (i.IsValid() && !locations.full())
+      locations.append(projection.ProjectCoarse(i));
+
+  tile_cache.SetPrefetch({locations.begin(), locations.size()},
+                         projection.DistancePixelsCoarse(radius));
+
+  struct zzip_dir *dirs[MAX_TERRAIN_DECODERS];
+  unsigned n_dirs = 0;
+  dirs[n_dirs++] = archive.get();
+  for (auto &i : decoder_archives)
+    dirs[n_dirs++] = i.get();
+
+  UpdateTerrainTiles(dirs, n_dirs, "terrain.jp2", tile_cache, mutex,
+                     projection, location, radius);
   return map.IsDirty();
 }
@@ -25,12 +25,16 @@ Copyright_License {
 #define XCSOAR_TERRAIN_RASTER_TERRAIN_HPP
 
 #include "RasterMap.hpp"
+#include "RasterTileStore.hpp"
 #include "Geo/GeoPoint.hpp"
 #include "Thread/Guard.hpp"
 #include "OS/Path.hpp"
 #include "IO/ZipArchive.hpp"
+#include "Util/ConstBuffer.hxx"
 #include "Compiler.h"
 
+#include <vector>
+
 class FileCache;
 class OperationEnvironment;
 
@@ -47,8 +51,20 @@ public:
 private:
   ZipArchive archive;
 
+  /**
+   * Additional handles to the same ZIP archive, one for each extra
+   * thread decoding tiles in UpdateTiles().  A zzip_dir must not be
+   * shared between threads.
+   */
+  std::vector<ZipArchive> decoder_archives;
+
   RasterMap map;
 
+  /**
+   * Decoded tiles, stored in the #FileCache.
+   */
+  RasterTileStore tile_store;
+
 private:
   /**
    * Constructor.  Returns uninitialised object.
@@ -78,9 +94,12 @@ public:
   }
 
   /**
+   * @param prefetch locations which are expected to become visible
+   * soon; their tiles are loaded after the visible ones
    * @return true if the method shall be called again
    */
-  bool UpdateTiles(const GeoPoint &location, double radius);
+  bool UpdateTiles(const GeoPoint &location, double radius,
+                   ConstBuffer<GeoPoint> prefetch=nullptr);
 
 private:
   bool LoadCache(FileCache &cache, Path path);
@@ -93,6 +112,8 @@ private:
 
   bool Load(Path path, FileCache *cache,
             OperationEnvironment &operation);
+
+  void OpenDecoderArchives(Path path);
 };
 
 #endif
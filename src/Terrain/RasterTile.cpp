@@ -73,6 +73,16 @@ RasterTile::CopyFrom(const struct jas_matrix &m)
   }
 }
 
+void
+RasterTile::CopyFrom(const TerrainHeight *src)
+{
+  if (!IsDefined())
+    return;
+
+  buffer.Resize(width, height);
+  std::copy_n(src, width * height, buffer.GetData());
+}
+
 TerrainHeight
 RasterTile::GetHeight(unsigned x, unsigned y) const
 {
@@ -115,6 +115,11 @@ public:
 
   void CopyFrom(const struct jas_matrix &m);
 
+  /**
+   * Copy already decoded data (width * height values).
+   */
+  void CopyFrom(const TerrainHeight *src);
+
   /**
    * Determine the non-interpolated height at the specified pixel
    * location.
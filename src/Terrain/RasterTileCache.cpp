@@ -22,6 +22,7 @@ Copyright_License {
 */
 
 #include "RasterTileCache.hpp"
+#include "RasterTileStore.hpp"
 #include "Math/Angle.hpp"
 #include "Math/FastMath.hpp"
 
@@ -83,6 +84,43 @@ RasterTileCache::PutTileData(unsigned index,
   tile.CopyFrom(m);
 }
 
+bool
+RasterTileCache::LoadStoredTiles()
+{
+  if (tile_store == nullptr)
+    return true;
+
+  bool remaining = false;
+
+  for (const unsigned i : request_tiles) {
+    RasterTile &tile = tiles.GetLinear(i);
+    if (!tile.IsRequested())
+      continue;
+
+    const TerrainHeight *data =
+      tile_store->Find(i, tile.width * tile.height);
+    if (data != nullptr) {
+      tile.CopyFrom(data);
+      tile.ClearRequest();
+    } else
+      remaining = true;
+  }
+
+  return remaining;
+}
+
+void
+RasterTileCache::StoreTile(unsigned index)
+{
+  if (tile_store == nullptr)
+    return;
+
+  const RasterTile &tile = tiles.GetLinear(index);
+  if (tile.IsEnabled() && !tile_store->Contains(index))
+    tile_store->Append(index, tile.buffer.GetData(),
+                       tile.width * tile.height);
+}
+
 struct RTDistanceSort {
   const RasterTileCache &rtc;
 
@@ -96,6 +134,20 @@ struct RTDistanceSort {
   }
 };
 
+inline bool
+RasterTileCache::IsPrefetchTile(const RasterTile &tile,
+                                unsigned radius) const
+{
+  if (!tile.IsDefined())
+    return false;
+
+  for (const auto &i : prefetch_locations)
+    if (tile.CalcDistanceTo(i.x, i.y) <= radius)
+      return true;
+
+  return false;
+}
+
 bool
 RasterTileCache::PollTiles(int x, int y, unsigned radius)
 {
@@ -116,18 +168,28 @@ RasterTileCache::PollTiles(int x, int y, unsigned radius)
   /* query all tiles; all tiles which are either in range or already
      loaded are added to RequestTiles */
 
+  const unsigned prefetch_radius_total = prefetch_radius + 256;
+
   request_tiles.clear();
-  for (int i = tiles.GetSize() - 1; i >= 0 && !request_tiles.full(); --i)
-    if (tiles.GetLinear(i).VisibilityChanged(x, y, radius))
+  for (int i = tiles.GetSize() - 1; i >= 0 && !request_tiles.full(); --i) {
+    RasterTile &tile = tiles.GetLinear(i);
+    if (tile.VisibilityChanged(x, y, radius) ||
+        IsPrefetchTile(tile, prefetch_radius_total))
       request_tiles.append(i);
+  }
 
-  /* reduce if there are too many */
+  /* sort by distance; this also makes sure that prefetched tiles
+     (which are outside of the radius) get activated last */
 
-  if (request_tiles.size() > MAX_ACTIVE_TILES) {
-    /* sort by distance */
+  if (request_tiles.size() > MAX_ACTIVE_TILES ||
+      !prefetch_locations.empty()) {
     const RTDistanceSort sort(*this);
     std::sort(request_tiles.begin(), request_tiles.end(), sort);
+  }
 
+  /* reduce if there are too many */
+
+  if (request_tiles.size() > MAX_ACTIVE_TILES) {
     /* dispose all tiles which are out of range */
     for (unsigned i = MAX_ACTIVE_TILES; i < request_tiles.size(); ++i) {
       RasterTile &tile = tiles.GetLinear(request_tiles[i]);
@@ -174,6 +236,22 @@ RasterTileCache::GetHeight(unsigned px, unsigned py) const
                                   py << (RasterTraits::SUBPIXEL_BITS - RasterTraits::OVERVIEW_BITS));
 }
 
+TerrainHeight
+RasterTileCache::GetHeight(unsigned px, unsigned py, TileCursor &cursor) const
+{
+  if (px >= width || py >= height)
+    // outside overall bounds
+    return TerrainHeight::Invalid();
+
+  const RasterTile &tile = GetTile(px, py, cursor);
+  if (tile.IsEnabled())
+    return tile.GetHeight(px, py);
+
+  // still not found, so go to overview
+  return overview.GetInterpolated(px << (RasterTraits::SUBPIXEL_BITS - RasterTraits::OVERVIEW_BITS),
+                                  py << (RasterTraits::SUBPIXEL_BITS - RasterTraits::OVERVIEW_BITS));
+}
+
 TerrainHeight
 RasterTileCache::GetInterpolatedHeight(unsigned int lx, unsigned int ly) const
 {
@@ -29,6 +29,7 @@ Copyright_License {
 #include "RasterLocation.hpp"
 #include "Geo/GeoBounds.hpp"
 #include "Util/StaticArray.hxx"
+#include "Util/ConstBuffer.hxx"
 #include "Util/Serial.hpp"
 
 #include <assert.h>
@@ -39,8 +40,31 @@ Copyright_License {
 
 struct jas_matrix;
 struct GridLocation;
+class RasterTileStore;
 
 class RasterTileCache {
+public:
+  /**
+   * The maximum number of prefetch locations, see SetPrefetch().
+   */
+  static constexpr unsigned MAX_PREFETCH = 8;
+
+  /**
+   * Remembers the tile containing the most recently looked up pixel.
+   * Callers which look up many nearby pixels (e.g. along a line)
+   * pass the same object to each call, which saves the tile lookup
+   * until the next pixel is in a different tile.
+   */
+  struct TileCursor {
+    const RasterTile *tile = nullptr;
+
+    /**
+     * The top left pixel of the grid cell of #tile.
+     */
+    unsigned x = 0, y = 0;
+  };
+
+private:
   static constexpr unsigned MAX_RTC_TILES = 4096;
 
   /**
@@ -137,6 +161,19 @@ protected:
    */
   StaticArray<uint16_t, MAX_RTC_TILES> request_tiles;
 
+  /**
+   * An optional store of already decoded tiles, which is consulted
+   * before decoding tiles from the JPEG2000 file.
+   */
+  RasterTileStore *tile_store = nullptr;
+
+  /**
+   * Locations which are expected to become visible soon.  Tiles
+   * around them are loaded by PollTiles() after the visible ones.
+   */
+  StaticArray<RasterLocation, MAX_PREFETCH> prefetch_locations;
+  unsigned prefetch_radius = 0;
+
 public:
   RasterTileCache() {
     Reset();
@@ -151,7 +188,40 @@ public:
     bounds = _bounds;
   }
 
+  void SetTileStore(RasterTileStore *_tile_store) {
+    tile_store = _tile_store;
+  }
+
+  /**
+   * Set the locations which shall be loaded in advance by the next
+   * PollTiles() calls.  Pass an empty buffer to disable prefetching.
+   */
+  void SetPrefetch(ConstBuffer<RasterLocation> locations, unsigned radius) {
+    prefetch_locations.clear();
+    for (const auto &i : locations)
+      if (!prefetch_locations.full())
+        prefetch_locations.append(i);
+
+    prefetch_radius = radius;
+  }
+
 protected:
+  const RasterTile &GetTile(unsigned px, unsigned py,
+                            TileCursor &cursor) const {
+    assert(px < width);
+    assert(py < height);
+
+    if (cursor.tile == nullptr ||
+        px - cursor.x >= tile_width || py - cursor.y >= tile_height) {
+      const unsigned tile_x = px / tile_width, tile_y = py / tile_height;
+      cursor.tile = &tiles.Get(tile_x, tile_y);
+      cursor.x = tile_x * tile_width;
+      cursor.y = tile_y * tile_height;
+    }
+
+    return *cursor.tile;
+  }
+
   void ScanTileLine(GridLocation start, GridLocation end,
                     TerrainHeight *buffer, unsigned size,
                     bool interpolate) const;
@@ -167,6 +237,12 @@ public:
   gcc_pure
   TerrainHeight GetHeight(unsigned x, unsigned y) const;
 
+  /**
+   * Like GetHeight(), but skip the tile lookup if the pixel is in the
+   * same tile as the previous one looked up with this #TileCursor.
+   */
+  TerrainHeight GetHeight(unsigned x, unsigned y, TileCursor &cursor) const;
+
   /**
    * Determine the interpolated height at the specified sub-pixel
    * location.
@@ -214,8 +290,8 @@ private:
    * @return the terrain altitude and a flag that is true when the
    * value was loaded from a "fine" tile
    */
-  gcc_pure
-  std::pair<TerrainHeight, bool> GetFieldDirect(unsigned px, unsigned py) const;
+  std::pair<TerrainHeight, bool> GetFieldDirect(unsigned px, unsigned py,
+                                                TileCursor &cursor) const;
 
 public:
   bool SaveCache(FILE *file) const;
@@ -274,10 +350,32 @@ public:
                        unsigned end_x, unsigned end_y,
                        const struct jas_matrix &m);
 
+  /**
+   * Is the tile near one of the #prefetch_locations?
+   */
+  gcc_pure
+  bool IsPrefetchTile(const RasterTile &tile, unsigned radius) const;
+
   bool PollTiles(int x, int y, unsigned radius);
 
+  /**
+   * Load the requested tiles which are available in the
+   * #RasterTileStore.  Caller must hold the exclusive lock.
+   *
+   * @return true if there are requested tiles left which need to be
+   * decoded from the JPEG2000 file
+   */
+  bool LoadStoredTiles();
+
   void PutTileData(unsigned index, const struct jas_matrix &m);
 
+  /**
+   * Copy a freshly decoded tile to the #RasterTileStore.  Caller
+   * must not modify the tiles meanwhile, but doesn't need to hold the
+   * lock.
+   */
+  void StoreTile(unsigned index);
+
   void FinishTileUpdate();
 
 public:
@@ -295,6 +393,21 @@ public:
   unsigned int GetWidth() const { return width; }
   unsigned int GetHeight() const { return height; }
 
+  unsigned GetTileWidth() const { return tile_width; }
+  unsigned GetTileHeight() const { return tile_height; }
+
+  unsigned GetTileColumns() const { return tiles.GetWidth(); }
+  unsigned GetTileRows() const { return tiles.GetHeight(); }
+
+  /**
+   * Returns the number of pixels of the specified tile.
+   */
+  gcc_pure
+  unsigned GetTileSize(unsigned index) const {
+    const RasterTile &tile = tiles.GetLinear(index);
+    return tile.width * tile.height;
+  }
+
   unsigned GetFineWidth() const {
     return width << RasterTraits::SUBPIXEL_BITS;
   }
@@ -0,0 +1,208 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#include "RasterTileStore.hpp"
+#include "RasterTileCache.hpp"
+#include "IO/FileCache.hpp"
+#include "OS/FileMapping.hpp"
+
+#include <algorithm>
+
+#include <string.h>
+
+static const TCHAR *const tile_store_name = _T("terrain_tiles");
+
+RasterTileStore::RasterTileStore() = default;
+
+RasterTileStore::~RasterTileStore()
+{
+  Close();
+}
+
+void
+RasterTileStore::Close()
+{
+  if (file != nullptr) {
+    fclose(file);
+    file = nullptr;
+  }
+
+  mapping.reset();
+  path = nullptr;
+}
+
+bool
+RasterTileStore::Map()
+{
+  if (file != nullptr)
+    fflush(file);
+
+  mapping.reset(new FileMapping(path));
+  if (mapping->error()) {
+    mapping.reset();
+    return false;
+  }
+
+  return true;
+}
+
+bool
+RasterTileStore::Scan(size_t offset, const RasterTileCache &tile_cache)
+{
+  const size_t size = mapping->size();
+
+  while (offset < size) {
+    if (offset + sizeof(TileHeader) > size)
+      return false;
+
+    TileHeader th;
+    memcpy(&th, mapping->at(offset), sizeof(th));
+    offset += sizeof(th);
+
+    if (th.index >= offsets.size() ||
+        th.n_values != tile_cache.GetTileSize(th.index))
+      return false;
+
+    const size_t n_bytes = th.n_values * sizeof(TerrainHeight);
+    if (offset + n_bytes > size)
+      return false;
+
+    offsets[th.index] = offset;
+    offset += n_bytes;
+  }
+
+  end_offset = offset;
+  return true;
+}
+
+bool
+RasterTileStore::Create(FileCache &cache, Path original_path,
+                        const Header &header)
+{
+  file = cache.Save(tile_store_name, original_path);
+  if (file == nullptr)
+    return false;
+
+  if (fwrite(&header, sizeof(header), 1, file) != 1) {
+    cache.Cancel(tile_store_name, file);
+    file = nullptr;
+    return false;
+  }
+
+  end_offset = ftell(file);
+  std::fill(offsets.begin(), offsets.end(), 0);
+  return true;
+}
+
+bool
+RasterTileStore::Open(FileCache &cache, Path original_path,
+                      const RasterTileCache &tile_cache)
+{
+  Close();
+
+  if (!tile_cache.IsValid())
+    return false;
+
+  Header header;
+  memset(&header, 0, sizeof(header));
+
+  header.version = Header::VERSION;
+  header.width = tile_cache.GetWidth();
+  header.height = tile_cache.GetHeight();
+  header.tile_width = tile_cache.GetTileWidth();
+  header.tile_height = tile_cache.GetTileHeight();
+  header.tile_columns = tile_cache.GetTileColumns();
+  header.tile_rows = tile_cache.GetTileRows();
+
+  offsets.ResizeDiscard(header.tile_columns * header.tile_rows);
+  std::fill(offsets.begin(), offsets.end(), 0);
+
+  path = cache.MakeCachePath(tile_store_name);
+
+  FILE *old = cache.Load(tile_store_name, original_path);
+  if (old != nullptr) {
+    Header old_header;
+    const bool valid = fread(&old_header, sizeof(old_header), 1, old) == 1 &&
+      memcmp(&old_header, &header, sizeof(header)) == 0;
+    const long data_offset = ftell(old);
+    fclose(old);
+
+    if (valid && Map() && Scan(data_offset, tile_cache)) {
+      file = _tfopen(path.c_str(), _T("ab"));
+      if (file != nullptr)
+        return true;
+    }
+
+    /* the file is stale or corrupt; start over */
+    mapping.reset();
+    cache.Flush(tile_store_name);
+  }
+
+  if (!Create(cache, original_path, header)) {
+    Close();
+    return false;
+  }
+
+  return true;
+}
+
+const TerrainHeight *
+RasterTileStore::Find(unsigned index, size_t n_values)
+{
+  if (!Contains(index))
+    return nullptr;
+
+  const size_t offset = offsets[index];
+  const size_t n_bytes = n_values * sizeof(TerrainHeight);
+
+  if (mapping == nullptr || offset + n_bytes > mapping->size()) {
+    /* the tile was appended after the file was mapped */
+    if (!Map() || offset + n_bytes > mapping->size())
+      return nullptr;
+  }
+
+  return (const TerrainHeight *)mapping->at(offset);
+}
+
+void
+RasterTileStore::Append(unsigned index, const TerrainHeight *data,
+                        size_t n_values)
+{
+  if (file == nullptr || index >= offsets.size() || offsets[index] != 0)
+    return;
+
+  TileHeader th;
+  th.index = index;
+  th.n_values = n_values;
+
+  if (fwrite(&th, sizeof(th), 1, file) != 1 ||
+      fwrite(data, sizeof(*data), n_values, file) != n_values) {
+    /* disk full? stop writing, the file may be corrupt now */
+    fclose(file);
+    file = nullptr;
+    return;
+  }
+
+  offsets[index] = end_offset + sizeof(th);
+  end_offset += sizeof(th) + n_values * sizeof(*data);
+}
@@ -0,0 +1,136 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#ifndef XCSOAR_TERRAIN_RASTER_TILE_STORE_HPP
+#define XCSOAR_TERRAIN_RASTER_TILE_STORE_HPP
+
+#include "Height.hpp"
+#include "OS/Path.hpp"
+#include "Util/AllocatedArray.hxx"
+#include "Compiler.h"
+
+#include <memory>
+
+#include <stdio.h>
+#include <stdint.h>
+
+class FileCache;
+class FileMapping;
+class RasterTileCache;
+
+/**
+ * A cache file which stores already decoded terrain tiles, so they
+ * don't need to be decoded from JPEG2000 again after a restart or
+ * after they have been discarded.  Tiles are appended to the file
+ * as they get decoded, and the file is mapped into memory for
+ * reading.
+ *
+ * This object is not thread-safe; it is only used by the
+ * #TerrainThread.
+ */
+class RasterTileStore {
+  struct Header {
+    static constexpr uint32_t VERSION = 1;
+
+    uint32_t version;
+    uint32_t width, height;
+    uint16_t tile_width, tile_height;
+    uint32_t tile_columns, tile_rows;
+  };
+
+  /**
+   * Precedes the raw #TerrainHeight values of each tile.
+   */
+  struct TileHeader {
+    uint32_t index;
+    uint32_t n_values;
+  };
+
+  AllocatedPath path = nullptr;
+
+  /**
+   * The file opened for appending new tiles.
+   */
+  FILE *file = nullptr;
+
+  std::unique_ptr<FileMapping> mapping;
+
+  /**
+   * The file offset of each tile's data; 0 means the tile is not
+   * stored.
+   */
+  AllocatedArray<uint32_t> offsets;
+
+  /**
+   * The current end of the file, i.e. the offset of the next
+   * appended tile.
+   */
+  uint32_t end_offset;
+
+public:
+  RasterTileStore();
+  ~RasterTileStore();
+
+  RasterTileStore(const RasterTileStore &) = delete;
+  RasterTileStore &operator=(const RasterTileStore &) = delete;
+
+  bool IsDefined() const {
+    return file != nullptr;
+  }
+
+  /**
+   * Open (or create) the store for the given terrain file.  The
+   * #RasterTileCache must already be loaded, because its geometry is
+   * used to validate the file.
+   */
+  bool Open(FileCache &cache, Path original_path,
+            const RasterTileCache &tile_cache);
+
+  void Close();
+
+  bool Contains(unsigned index) const {
+    return index < offsets.size() && offsets[index] != 0;
+  }
+
+  /**
+   * Look up the decoded data of a tile.
+   *
+   * @param n_values the expected number of values
+   * @return a pointer into the mapped file or nullptr if the tile is
+   * not available
+   */
+  const TerrainHeight *Find(unsigned index, size_t n_values);
+
+  /**
+   * Append a decoded tile to the file.
+   */
+  void Append(unsigned index, const TerrainHeight *data, size_t n_values);
+
+private:
+  bool Map();
+  bool Scan(size_t data_offset, const RasterTileCache &tile_cache);
+  bool Create(FileCache &cache, Path original_path,
+              const Header &header);
+};
+
+#endif
@@ -0,0 +1,332 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#include "SlopeShading.hpp"
+
+#include <algorithm>
+
+#ifdef __ARM_NEON__
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+static void
+PortableQuantiseHeightRow(uint8_t *gcc_restrict dest,
+                          const TerrainHeight *gcc_restrict src,
+                          unsigned n, unsigned shift)
+{
+  for (unsigned i = 0; i < n; ++i)
+    dest[i] = std::min(254, std::max(0, int(src[i].GetValue())) >> shift);
+}
+
+static void
+PortableCalculateSlopeRow(int8_t *gcc_restrict dest,
+                          const TerrainHeight *gcc_restrict src, unsigned n,
+                          unsigned row_minus_offset,
+                          unsigned row_plus_offset,
+                          unsigned column_offset,
+                          const SlopeShadingParameters &p)
+{
+  const unsigned p20 = 2 * column_offset;
+
+  for (unsigned i = 0; i < n; ++i, ++src) {
+    const int p32 = ClipHeightDelta(src[-(int)row_minus_offset],
+                                    src[row_plus_offset]);
+    const int p22 = ClipHeightDelta(src[column_offset],
+                                    src[-(int)column_offset]);
+    dest[i] = CalculateSlopeIndex(p22, p32, p20, p);
+  }
+}
+
+#ifdef __ARM_NEON__
+
+/**
+ * Process 16 pixels per iteration.
+ */
+static void
+NEONQuantiseHeightRow(uint8_t *gcc_restrict dest,
+                      const TerrainHeight *gcc_restrict src,
+                      unsigned n, unsigned shift)
+{
+  const int16x8_t zero = vdupq_n_s16(0);
+  const uint16x8_t max = vdupq_n_u16(254);
+  /* vshlq_u16() with a negative count shifts right */
+  const int16x8_t count = vdupq_n_s16(-int(shift));
+
+  for (unsigned i = 0; i < n / 16; ++i, src += 16, dest += 16) {
+    const int16x8_t a = vld1q_s16((const int16_t *)src);
+    const int16x8_t b = vld1q_s16((const int16_t *)src + 8);
+
+    const uint16x8_t qa =
+      vminq_u16(vshlq_u16(vreinterpretq_u16_s16(vmaxq_s16(a, zero)), count),
+                max);
+    const uint16x8_t qb =
+      vminq_u16(vshlq_u16(vreinterpretq_u16_s16(vmaxq_s16(b, zero)), count),
+                max);
+
+    vst1q_u8(dest, vcombine_u8(vmovn_u16(qa), vmovn_u16(qb)));
+  }
+}
+
+struct NEONSlopeConstants {
+  float32x4_t p20, p31, dd2_sz, dd2_square, sx, sy;
+  int32x4_t sz;
+  float32x4_t contrast, min, max;
+
+  explicit NEONSlopeConstants(unsigned _p20,
+                              const SlopeShadingParameters &p)
+    :p20(vdupq_n_f32(_p20)), p31(vdupq_n_f32(p.p31)),
+     sx(vdupq_n_f32(p.sx)), sy(vdupq_n_f32(p.sy)),
+     sz(vdupq_n_s32(p.sz)),
+     contrast(vdupq_n_f32(p.contrast / 128.f)),
+     min(vdupq_n_f32(-63)), max(vdupq_n_f32(63)) {
+    const float dd2 = float(_p20 * p.p31 * p.height_slope_factor);
+    dd2_sz = vdupq_n_f32(dd2 * p.sz);
+    dd2_square = vdupq_n_f32(dd2 * dd2);
+  }
+};
+
+gcc_always_inline
+static inline int32x4_t
+NEONSlopeIndex4(int16x4_t p22, int16x4_t p32, const NEONSlopeConstants &c)
+{
+  const float32x4_t dd0 = vmulq_f32(vcvtq_f32_s32(vmovl_s16(p22)), c.p31);
+  const float32x4_t dd1 = vmulq_f32(vcvtq_f32_s32(vmovl_s16(p32)), c.p20);
+
+  const float32x4_t num = vmlaq_f32(vmlaq_f32(c.dd2_sz, dd0, c.sx),
+                                    dd1, c.sy);
+  const float32x4_t square_mag =
+    vmlaq_f32(vmlaq_f32(c.dd2_square, dd0, dd0), dd1, dd1);
+
+  /* ARMv7 NEON has no square root; refine the reciprocal square
+     root estimate with two Newton-Raphson steps */
+  float32x4_t r = vrsqrteq_f32(square_mag);
+  r = vmulq_f32(r, vrsqrtsq_f32(vmulq_f32(square_mag, r), r));
+  r = vmulq_f32(r, vrsqrtsq_f32(vmulq_f32(square_mag, r), r));
+
+  const int32x4_t sval = vcvtq_s32_f32(vmulq_f32(num, r));
+  const float32x4_t sindex =
+    vmulq_f32(vcvtq_f32_s32(vsubq_s32(sval, c.sz)), c.contrast);
+  return vcvtq_s32_f32(vmaxq_f32(vminq_f32(sindex, c.max), c.min));
+}
+
+/**
+ * Process 8 pixels per iteration.
+ */
+static void
+NEONCalculateSlopeRow(int8_t *gcc_restrict dest,
+                      const TerrainHeight *gcc_restrict src, unsigned n,
+                      unsigned row_minus_offset, unsigned row_plus_offset,
+                      unsigned column_offset,
+                      const SlopeShadingParameters &p)
+{
+  const NEONSlopeConstants c(2 * column_offset, p);
+  const int16x8_t min_delta = vdupq_n_s16(-512);
+  const int16x8_t max_delta = vdupq_n_s16(512);
+
+  const int16_t *s = (const int16_t *)src;
+  for (unsigned i = 0; i < n / 8; ++i, s += 8, dest += 8) {
+    const int16x8_t above = vld1q_s16(s - row_minus_offset);
+    const int16x8_t below = vld1q_s16(s + row_plus_offset);
+    const int16x8_t left = vld1q_s16(s - column_offset);
+    const int16x8_t right = vld1q_s16(s + column_offset);
+
+    const int16x8_t p32 =
+      vminq_s16(vmaxq_s16(vqsubq_s16(above, below), min_delta), max_delta);
+    const int16x8_t p22 =
+      vminq_s16(vmaxq_s16(vqsubq_s16(right, left), min_delta), max_delta);
+
+    const int32x4_t lo = NEONSlopeIndex4(vget_low_s16(p22),
+                                         vget_low_s16(p32), c);
+    const int32x4_t hi = NEONSlopeIndex4(vget_high_s16(p22),
+                                         vget_high_s16(p32), c);
+
+    vst1_s8(dest, vmovn_s16(vcombine_s16(vmovn_s32(lo), vmovn_s32(hi))));
+  }
+}
+
+#elif defined(__SSE2__)
+
+/**
+ * Process 16 pixels per iteration.
+ */
+static void
+SSE2QuantiseHeightRow(uint8_t *gcc_restrict dest,
+                      const TerrainHeight *gcc_restrict src,
+                      unsigned n, unsigned shift)
+{
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i max = _mm_set1_epi16(254);
+  const __m128i count = _mm_cvtsi32_si128(shift);
+
+  for (unsigned i = 0; i < n / 16; ++i, src += 16, dest += 16) {
+    __m128i a = _mm_loadu_si128((const __m128i *)src);
+    __m128i b = _mm_loadu_si128((const __m128i *)(src + 8));
+
+    a = _mm_min_epi16(_mm_srl_epi16(_mm_max_epi16(a, zero), count), max);
+    b = _mm_min_epi16(_mm_srl_epi16(_mm_max_epi16(b, zero), count), max);
+
+    _mm_storeu_si128((__m128i *)dest, _mm_packus_epi16(a, b));
+  }
+}
+
+struct SSE2SlopeConstants {
+  __m128 p20, p31, dd2_sz, dd2_square, sx, sy, sz;
+  __m128 contrast, min, max;
+
+  explicit SSE2SlopeConstants(unsigned _p20,
+                              const SlopeShadingParameters &p)
+    :p20(_mm_set1_ps(_p20)), p31(_mm_set1_ps(p.p31)),
+     sx(_mm_set1_ps(p.sx)), sy(_mm_set1_ps(p.sy)), sz(_mm_set1_ps(p.sz)),
+     contrast(_mm_set1_ps(p.contrast / 128.f)),
+     min(_mm_set1_ps(-63)), max(_mm_set1_ps(63)) {
+    const float dd2 = float(_p20 * p.p31 * p.height_slope_factor);
+    dd2_sz = _mm_set1_ps(dd2 * p.sz);
+    dd2_square = _mm_set1_ps(dd2 * dd2);
+  }
+};
+
+/**
+ * Sign-extend four 16 bit integers (in the lower 64 bit of the
+ * vector) to float.
+ */
+gcc_always_inline
+static inline __m128
+SSE2ToFloat(__m128i x)
+{
+  return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16));
+}
+
+gcc_always_inline
+static inline __m128i
+SSE2SlopeIndex4(__m128i p22, __m128i p32, const SSE2SlopeConstants &c)
+{
+  const __m128 dd0 = _mm_mul_ps(SSE2ToFloat(p22), c.p31);
+  const __m128 dd1 = _mm_mul_ps(SSE2ToFloat(p32), c.p20);
+
+  const __m128 num = _mm_add_ps(c.dd2_sz,
+                                _mm_add_ps(_mm_mul_ps(dd0, c.sx),
+                                           _mm_mul_ps(dd1, c.sy)));
+  const __m128 square_mag = _mm_add_ps(c.dd2_square,
+                                       _mm_add_ps(_mm_mul_ps(dd0, dd0),
+                                                  _mm_mul_ps(dd1, dd1)));
+
+  /* truncate like the integer division in CalculateSlopeIndex() */
+  const __m128 quotient = _mm_div_ps(num, _mm_sqrt_ps(square_mag));
+  const __m128 sval = _mm_cvtepi32_ps(_mm_cvttps_epi32(quotient));
+  const __m128 sindex = _mm_mul_ps(_mm_sub_ps(sval, c.sz), c.contrast);
+  return _mm_cvttps_epi32(_mm_max_ps(_mm_min_ps(sindex, c.max), c.min));
+}
+
+/**
+ * Process 8 pixels per iteration.
+ */
+static void
+SSE2CalculateSlopeRow(int8_t *gcc_restrict dest,
+                      const TerrainHeight *gcc_restrict src, unsigned n,
+                      unsigned row_minus_offset, unsigned row_plus_offset,
+                      unsigned column_offset,
+                      const SlopeShadingParameters &p)
+{
+  const SSE2SlopeConstants c(2 * column_offset, p);
+  const __m128i min_delta = _mm_set1_epi16(-512);
+  const __m128i max_delta = _mm_set1_epi16(512);
+
+  for (unsigned i = 0; i < n / 8; ++i, src += 8, dest += 8) {
+    const __m128i above =
+      _mm_loadu_si128((const __m128i *)(src - row_minus_offset));
+    const __m128i below =
+      _mm_loadu_si128((const __m128i *)(src + row_plus_offset));
+    const __m128i left =
+      _mm_loadu_si128((const __m128i *)(src - column_offset));
+    const __m128i right =
+      _mm_loadu_si128((const __m128i *)(src + column_offset));
+
+    const __m128i p32 =
+      _mm_min_epi16(_mm_max_epi16(_mm_subs_epi16(above, below), min_delta),
+                    max_delta);
+    const __m128i p22 =
+      _mm_min_epi16(_mm_max_epi16(_mm_subs_epi16(right, left), min_delta),
+                    max_delta);
+
+    const __m128i lo = SSE2SlopeIndex4(p22, p32, c);
+    const __m128i hi = SSE2SlopeIndex4(_mm_srli_si128(p22, 8),
+                                       _mm_srli_si128(p32, 8), c);
+
+    const __m128i packed = _mm_packs_epi32(lo, hi);
+    _mm_storel_epi64((__m128i *)dest, _mm_packs_epi16(packed, packed));
+  }
+}
+
+#endif
+
+void
+QuantiseHeightRow(uint8_t *gcc_restrict dest,
+                  const TerrainHeight *gcc_restrict src,
+                  unsigned n, unsigned shift)
+{
+  /* larger shifts would be undefined for the 16 bit vector lanes (and
+     produce 0 anyway) */
+  shift = std::min(shift, 16u);
+
+#if defined(__ARM_NEON__) || defined(__SSE2__)
+  const unsigned no = n & ~15u;
+#ifdef __ARM_NEON__
+  NEONQuantiseHeightRow(dest, src, no, shift);
+#else
+  SSE2QuantiseHeightRow(dest, src, no, shift);
+#endif
+  dest += no;
+  src += no;
+  n -= no;
+#endif
+
+  PortableQuantiseHeightRow(dest, src, n, shift);
+}
+
+void
+CalculateSlopeRow(int8_t *gcc_restrict dest,
+                  const TerrainHeight *gcc_restrict src, unsigned n,
+                  unsigned row_minus_offset, unsigned row_plus_offset,
+                  unsigned column_offset,
+                  const SlopeShadingParameters &p)
+{
+#if defined(__ARM_NEON__) || defined(__SSE2__)
+  const unsigned no = n & ~7u;
+#ifdef __ARM_NEON__
+  NEONCalculateSlopeRow(dest, src, no,
+                        row_minus_offset, row_plus_offset, column_offset, p);
+#else
+  SSE2CalculateSlopeRow(dest, src, no,
+                        row_minus_offset, row_plus_offset, column_offset, p);
+#endif
+  dest += no;
+  src += no;
+  n -= no;
+#endif
+
+  PortableCalculateSlopeRow(dest, src, n,
+                            row_minus_offset, row_plus_offset, column_offset,
+                            p);
+}
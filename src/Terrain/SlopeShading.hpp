@@ -0,0 +1,126 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#ifndef XCSOAR_TERRAIN_SLOPE_SHADING_HPP
+#define XCSOAR_TERRAIN_SLOPE_SHADING_HPP
+
+#include "Height.hpp"
+#include "Util/Clamp.hpp"
+#include "Compiler.h"
+
+#include <stdint.h>
+#include <math.h>
+
+/*
+ * Row kernels for RasterRenderer.  They are implemented with ARM NEON
+ * or SSE2 instructions if the target supports them, and with portable
+ * C++ code otherwise.
+ */
+
+struct SlopeShadingParameters {
+  /**
+   * The vertical distance between the upper and the lower sample.
+   */
+  unsigned p31;
+
+  unsigned height_slope_factor;
+
+  /**
+   * The sun vector.
+   */
+  int sx, sy, sz;
+
+  int contrast;
+};
+
+/**
+ * Clip the difference between two adjacent terrain height values to
+ * sane bounds.  This works around integer overflows in the
+ * CalculateSlopeIndex() formula when the map file is broken, avoiding
+ * the sqrt() call with a negative argument.
+ */
+gcc_const
+static inline int
+ClipHeightDelta(TerrainHeight a, TerrainHeight b)
+{
+  return Clamp(a.GetValue() - b.GetValue(), -512, 512);
+}
+
+/**
+ * Calculate the illumination index (-63..63) of one pixel.
+ *
+ * @param p22 the (clipped) height difference between the right and
+ * the left sample
+ * @param p32 the (clipped) height difference between the upper and the
+ * lower sample
+ * @param p20 the horizontal distance between the left and the right
+ * sample
+ */
+gcc_pure
+static inline int
+CalculateSlopeIndex(int p22, int p32, unsigned p20,
+                    const SlopeShadingParameters &p)
+{
+  const int dd0 = p22 * int(p.p31);
+  const int dd1 = int(p20) * p32;
+  const unsigned dd2 = p20 * p.p31 * p.height_slope_factor;
+  const int num = (int(dd2) * p.sz + dd0 * p.sx + dd1 * p.sy);
+  const unsigned square_mag = dd0 * dd0 + dd1 * dd1 + dd2 * dd2;
+  const unsigned mag = (unsigned)sqrt(square_mag);
+  /* this is a workaround for a SIGFPE (division by zero)
+     observed by our users on some Android devices (e.g. Nexus
+     7), even though we did our best to make sure that the
+     integer arithmetics above can't overflow */
+  /* TODO: debug this problem and replace this workaround */
+  const int sval = num / int(mag|1);
+  const int sindex = (sval - p.sz) * p.contrast / 128;
+  return Clamp(sindex, -63, 63);
+}
+
+/**
+ * Quantise a row of terrain heights to min(254, max(0, h) >> shift).
+ * "Special" heights result in 0.
+ */
+void
+QuantiseHeightRow(uint8_t *gcc_restrict dest,
+                  const TerrainHeight *gcc_restrict src,
+                  unsigned n, unsigned shift);
+
+/**
+ * Calculate the illumination index of #n pixels whose neighbours
+ * are at constant offsets, i.e. not at the border of the
+ * #HeightMatrix.  Pixels with a "special" neighbour produce an
+ * undefined result which must be ignored by the caller.
+ *
+ * @param row_minus_offset the offset of the upper sample
+ * @param row_plus_offset the offset of the lower sample
+ * @param column_offset the offset of the left and the right sample
+ */
+void
+CalculateSlopeRow(int8_t *gcc_restrict dest,
+                  const TerrainHeight *gcc_restrict src, unsigned n,
+                  unsigned row_minus_offset, unsigned row_plus_offset,
+                  unsigned column_offset,
+                  const SlopeShadingParameters &p);
+
+#endif
@@ -331,10 +331,20 @@ TerrainRenderer::Generate(const WindowProjection &map_projection,
   if (old_bounds.IsValid() && old_bounds.IsInside(new_bounds) &&
       !IsLargeSizeDifference(old_bounds, new_bounds) &&
       terrain_serial == terrain.GetSerial() &&
-      sunazimuth.CompareRoughly(last_sun_azimuth) &&
-      !raster_renderer.UpdateQuantisation())
-    /* no change since previous frame */
-    return true;
+      !raster_renderer.UpdateQuantisation()) {
+    if (sunazimuth.CompareRoughly(last_sun_azimuth))
+      /* no change since previous frame */
+      return true;
+
+#ifdef USE_GLSL
+    if (raster_renderer.UpdateSunAzimuth(settings.brightness, sunazimuth)) {
+      /* only the sun has moved: the shader can relight the terrain
+         without scanning the map again */
+      last_sun_azimuth = sunazimuth;
+      return true;
+    }
+#endif
+  }
 
 #else
   if (compare_projection.Compare(map_projection) &&
@@ -346,7 +356,13 @@ TerrainRenderer::Generate(const WindowProjection &map_projection,
   compare_projection = CompareProjection(map_projection);
 #endif
 
-  terrain_serial = terrain.GetSerial();
+  if (terrain_serial != terrain.GetSerial()) {
+#ifdef ENABLE_OPENGL
+    /* new tiles have been loaded */
+    raster_renderer.FlushHeightCache();
+#endif
+    terrain_serial = terrain.GetSerial();
+  }
 
   last_sun_azimuth = sunazimuth;
 
@@ -0,0 +1,116 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#include "TerrainTextures.hpp"
+#include "HeightMatrix.hpp"
+#include "Screen/OpenGL/Texture.hpp"
+
+static_assert(sizeof(RGB8Color) == 3, "Wrong RGB8Color size");
+static_assert(sizeof(TerrainHeight) == 2, "Wrong TerrainHeight size");
+
+/**
+ * Shaders need exact texel values, so interpolation must be disabled.
+ * The caller must bind the texture.
+ */
+static void
+DisableInterpolation()
+{
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+}
+
+TerrainTextures::TerrainTextures()
+{
+  AddSurfaceListener(*this);
+}
+
+TerrainTextures::~TerrainTextures()
+{
+  RemoveSurfaceListener(*this);
+
+  delete height_texture;
+  delete ramp_texture;
+}
+
+void
+TerrainTextures::SurfaceDestroyed()
+{
+  delete height_texture;
+  height_texture = nullptr;
+
+  delete ramp_texture;
+  ramp_texture = nullptr;
+
+  heights_dirty = ramp_dirty = true;
+}
+
+const GLTexture &
+TerrainTextures::Bind()
+{
+  assert(heights != nullptr);
+
+  glActiveTexture(GL_TEXTURE1);
+
+  if (ramp_texture == nullptr) {
+    ramp_texture = new GLTexture(GL_RGB, PixelSize(RAMP_SIZE, 1u),
+                                 GL_RGB, GL_UNSIGNED_BYTE, ramp);
+    DisableInterpolation();
+  } else {
+    ramp_texture->Bind();
+
+    if (ramp_dirty)
+      glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, RAMP_SIZE, 1,
+                      GL_RGB, GL_UNSIGNED_BYTE, ramp);
+  }
+
+  ramp_dirty = false;
+
+  glActiveTexture(GL_TEXTURE0);
+
+  /* the rows of 16 bit values are not necessarily 4-byte aligned */
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 2);
+
+  /* the shader assumes little-endian byte order: the low byte ends up
+     in the luminance channel, the high byte in alpha */
+  const PixelSize size(heights->GetWidth(), heights->GetHeight());
+  if (height_texture == nullptr || height_texture->GetSize() != size) {
+    delete height_texture;
+    height_texture = new GLTexture(GL_LUMINANCE_ALPHA, size,
+                                   GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE,
+                                   heights->GetData());
+    DisableInterpolation();
+  } else {
+    height_texture->Bind();
+
+    if (heights_dirty)
+      glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, size.cx, size.cy,
+                      GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE,
+                      heights->GetData());
+  }
+
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+  heights_dirty = false;
+
+  return *height_texture;
+}
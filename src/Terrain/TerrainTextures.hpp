@@ -0,0 +1,94 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#ifndef XCSOAR_TERRAIN_TEXTURES_HPP
+#define XCSOAR_TERRAIN_TEXTURES_HPP
+
+#include "Screen/OpenGL/Surface.hpp"
+#include "Screen/PortableColor.hpp"
+
+#include <assert.h>
+
+class GLTexture;
+class HeightMatrix;
+
+/**
+ * The OpenGL textures consumed by OpenGL::terrain_shader: the raw
+ * heights of a #HeightMatrix (two bytes per texel, in the luminance
+ * and alpha channels) and the colour ramp (one texel per quantised
+ * height).
+ */
+class TerrainTextures final : private GLSurfaceListener {
+  static constexpr unsigned RAMP_SIZE = 256;
+
+  GLTexture *height_texture = nullptr;
+  GLTexture *ramp_texture = nullptr;
+
+  /**
+   * The heights to be uploaded.  This object is owned by the caller.
+   */
+  const HeightMatrix *heights = nullptr;
+
+  RGB8Color ramp[RAMP_SIZE];
+
+  bool heights_dirty = true, ramp_dirty = true;
+
+public:
+  TerrainTextures();
+  ~TerrainTextures();
+
+  TerrainTextures(const TerrainTextures &) = delete;
+  TerrainTextures &operator=(const TerrainTextures &) = delete;
+
+  void SetRampColor(unsigned i, RGB8Color color) {
+    assert(i < RAMP_SIZE);
+
+    ramp[i] = color;
+    ramp_dirty = true;
+  }
+
+  /**
+   * Schedule an upload of the given #HeightMatrix.  It must remain
+   * valid (and unmodified) until the next SetHeights() call.
+   */
+  void SetHeights(const HeightMatrix &_heights) {
+    heights = &_heights;
+    heights_dirty = true;
+  }
+
+  /**
+   * Bind the colour ramp to texture unit 1 and the heights to texture
+   * unit 0, uploading new data if necessary.  SetHeights() must have
+   * been called before.
+   *
+   * @return the height texture
+   */
+  const GLTexture &Bind();
+
+private:
+  /* virtual methods from class GLSurfaceListener */
+  void SurfaceCreated() override {}
+  void SurfaceDestroyed() override;
+};
+
+#endif
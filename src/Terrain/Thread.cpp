@@ -24,7 +24,8 @@ Copyright_License {
 #include "Thread.hpp"
 #include "RasterTerrain.hpp"
 #include "Projection/WindowProjection.hpp"
-#include "Thread/Util.hpp"
+#include "Thread/Policy.hpp"
+#include "Computer/StageTimer.hpp"
 
 TerrainThread::TerrainThread(RasterTerrain &_terrain,
                              std::function<void()> &&_callback)
@@ -32,7 +33,8 @@ TerrainThread::TerrainThread(RasterTerrain &_terrain,
    callback(std::move(_callback)) {}
 
 void
-TerrainThread::Trigger(const WindowProjection &projection)
+TerrainThread::Trigger(const WindowProjection &projection,
+                       ConstBuffer<GeoPoint> prefetch)
 {
   assert(projection.IsValid());
 
@@ -46,22 +48,32 @@ TerrainThread::Trigger(const WindowProjection &projection)
 
   next_center = center;
   next_radius = radius;
+
+  next_prefetch.clear();
+  for (const auto &i : prefetch)
+    if (!next_prefetch.full())
+      next_prefetch.append(i);
+
   StandbyThread::Trigger();
 }
 
 void
 TerrainThread::Tick()
 {
-  SetIdlePriority(); // TODO: call only once
+  const ScopeStageTimer stage_timer(StageTimer::Stage::TERRAIN);
+
+  ApplyThreadPolicy(ThreadRole::BACKGROUND); // TODO: call only once
 
   bool again = true;
   while (next_center.IsValid() && again && !IsStopped()) {
     const GeoPoint center = next_center;
     const auto radius = next_radius;
+    const PrefetchList prefetch = next_prefetch;
 
     {
       const ScopeUnlock unlock(mutex);
-      again = terrain.UpdateTiles(center, radius);
+      again = terrain.UpdateTiles(center, radius,
+                                  {prefetch.begin(), prefetch.size()});
     }
 
     last_center = center;
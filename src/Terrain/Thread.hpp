@@ -25,7 +25,10 @@ Copyright_License {
 #define XCSOAR_TERRAIN_THREAD_HPP
 
 #include "Thread/StandbyThread.hpp"
+#include "RasterTileCache.hpp"
 #include "Geo/GeoPoint.hpp"
+#include "Util/StaticArray.hxx"
+#include "Util/ConstBuffer.hxx"
 
 #include <functional>
 
@@ -46,12 +49,27 @@ class TerrainThread final : private StandbyThread {
   GeoPoint next_center;
   double next_radius;
 
+public:
+  typedef StaticArray<GeoPoint, RasterTileCache::MAX_PREFETCH> PrefetchList;
+
+private:
+  /**
+   * Locations which are expected to become visible soon, e.g. along
+   * the current track or the active task leg.
+   */
+  PrefetchList next_prefetch;
+
 public:
   TerrainThread(RasterTerrain &_terrain, std::function<void()> &&_callback);
 
   using StandbyThread::LockStop;
 
-  void Trigger(const WindowProjection &projection);
+  /**
+   * @param prefetch locations whose tiles shall be loaded in advance,
+   * after the visible ones
+   */
+  void Trigger(const WindowProjection &projection,
+               ConstBuffer<GeoPoint> prefetch=nullptr);
 
 private:
   /* virtual methods from class StandbyThread*/
@@ -25,6 +25,15 @@ Copyright_License {
 
 #include <zzip/util.h>
 
+#include <algorithm>
+
+#ifdef HAVE_POSIX
+#include <sys/mman.h>
+#include <unistd.h>
+#include <string.h>
+#include <stdio.h>
+#endif
+
 static int
 jas_zzip_read(jas_stream_obj_t *obj, char *buf, int cnt)
 {
@@ -62,6 +71,123 @@ static constexpr jas_stream_ops_t zzip_stream_ops = {
   jas_zzip_close
 };
 
+#ifdef HAVE_POSIX
+
+/**
+ * A STORED ZIP member mapped into memory.  Reading from it does not
+ * need zziplib or any system call; the data comes straight from the
+ * page cache.
+ */
+struct MappedMember {
+  void *base;
+  size_t map_size;
+
+  const char *data;
+  size_t size;
+
+  size_t position = 0;
+
+  MappedMember(void *_base, size_t _map_size, size_t skip, size_t _size)
+    :base(_base), map_size(_map_size),
+     data((const char *)_base + skip), size(_size) {}
+
+  ~MappedMember() {
+    munmap(base, map_size);
+  }
+};
+
+static int
+jas_mapped_read(jas_stream_obj_t *obj, char *buf, int cnt)
+{
+  const auto m = (MappedMember *)obj;
+
+  size_t n = std::min(size_t(cnt), m->size - m->position);
+  memcpy(buf, m->data + m->position, n);
+  m->position += n;
+  return n;
+}
+
+static long
+jas_mapped_seek(jas_stream_obj_t *obj, long offset, int origin)
+{
+  const auto m = (MappedMember *)obj;
+
+  long base;
+  switch (origin) {
+  case SEEK_SET:
+    base = 0;
+    break;
+
+  case SEEK_CUR:
+    base = m->position;
+    break;
+
+  case SEEK_END:
+    base = m->size;
+    break;
+
+  default:
+    return -1;
+  }
+
+  const long position = base + offset;
+  if (position < 0 || (unsigned long)position > m->size)
+    return -1;
+
+  m->position = position;
+  return position;
+}
+
+static int
+jas_mapped_close(jas_stream_obj_t *obj)
+{
+  delete (MappedMember *)obj;
+  return 0;
+}
+
+static constexpr jas_stream_ops_t mapped_stream_ops = {
+  jas_mapped_read,
+  jas_zzip_write,
+  jas_mapped_seek,
+  jas_mapped_close
+};
+
+/**
+ * Map the member into memory if it is STORED.
+ *
+ * @return nullptr if the member is compressed or mapping has failed
+ */
+static MappedMember *
+MapStoredMember(struct zzip_file *f)
+{
+  const zzip_off_t offset = zzip_file_stored_offset(f);
+  const int fd = zzip_file_archive_fd(f);
+  if (offset < 0 || fd < 0)
+    return nullptr;
+
+  ZZIP_STAT st;
+  if (zzip_file_stat(f, &st) < 0 || st.st_size <= 0)
+    return nullptr;
+
+  /* mmap() needs a page aligned offset */
+  static const zzip_off_t page_size = sysconf(_SC_PAGESIZE);
+  const zzip_off_t map_offset = offset - offset % page_size;
+  const size_t skip = offset - map_offset;
+  const size_t map_size = skip + st.st_size;
+
+  void *base = mmap(nullptr, map_size, PROT_READ, MAP_SHARED,
+                    fd, map_offset);
+  if (base == MAP_FAILED)
+    return nullptr;
+
+  /* the JPEG2000 decoder skips around, but mostly reads forward */
+  madvise(base, map_size, MADV_WILLNEED);
+
+  return new MappedMember(base, map_size, skip, st.st_size);
+}
+
+#endif
+
 jas_stream_t *
 OpenJasperZzipStream(struct zzip_dir *dir, const char *path)
 {
@@ -76,8 +202,21 @@ OpenJasperZzipStream(struct zzip_dir *dir, const char *path)
   }
 
   stream->openmode_ = JAS_STREAM_READ|JAS_STREAM_BINARY;
-  stream->obj_ = f;
-  stream->ops_ = const_cast<jas_stream_ops_t *>(&zzip_stream_ops);
+
+#ifdef HAVE_POSIX
+  MappedMember *mapped = MapStoredMember(f);
+  if (mapped != nullptr) {
+    /* the mapping stays valid after the member has been closed */
+    zzip_file_close(f);
+    stream->obj_ = mapped;
+    stream->ops_ = const_cast<jas_stream_ops_t *>(&mapped_stream_ops);
+  } else {
+#endif
+    stream->obj_ = f;
+    stream->ops_ = const_cast<jas_stream_ops_t *>(&zzip_stream_ops);
+#ifdef HAVE_POSIX
+  }
+#endif
 
   /* By default, use full buffering for this type of stream. */
   jas_stream_initbuf(stream, JAS_STREAM_FULLBUF, 0, 0);
@@ -0,0 +1,167 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#include "Policy.hpp"
+#include "Mutex.hpp"
+#include "Util.hpp"
+
+#include <algorithm>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
+
+static Mutex policy_mutex;
+static ThreadPolicySettings policy_settings;
+static bool policy_configured = false;
+
+void
+ThreadPolicySettings::SetDefaults()
+{
+  for (auto &i : roles)
+    i.Set(ThreadPolicy::Scheduler::DEFAULT);
+
+  (*this)[ThreadRole::MERGE].Set(ThreadPolicy::Scheduler::LOW);
+  (*this)[ThreadRole::CALCULATION].Set(ThreadPolicy::Scheduler::LOW);
+  (*this)[ThreadRole::DRAW].Set(ThreadPolicy::Scheduler::LOW);
+  (*this)[ThreadRole::BACKGROUND].Set(ThreadPolicy::Scheduler::IDLE);
+
+  const unsigned n_cpus = std::min(GetProcessorCount(), 32u);
+  if (n_cpus >= 2) {
+    const uint32_t last = 1u << (n_cpus - 1);
+    (*this)[ThreadRole::AUDIO].cpus = last;
+    (*this)[ThreadRole::PORT_IO].cpus = last;
+    (*this)[ThreadRole::BACKGROUND].cpus = last - 1;
+  }
+}
+
+const char *
+ToString(ThreadRole role)
+{
+  static constexpr const char *names[unsigned(ThreadRole::COUNT)] = {
+    "Audio",
+    "PortIO",
+    "Merge",
+    "Calculation",
+    "Draw",
+    "Background",
+  };
+
+  return names[unsigned(role)];
+}
+
+void
+SetThreadPolicySettings(const ThreadPolicySettings &settings)
+{
+  const ScopeLock protect(policy_mutex);
+  policy_settings = settings;
+  policy_configured = true;
+}
+
+static ThreadPolicy
+GetThreadPolicy(ThreadRole role)
+{
+  const ScopeLock protect(policy_mutex);
+  if (!policy_configured) {
+    policy_settings.SetDefaults();
+    policy_configured = true;
+  }
+
+  return policy_settings[role];
+}
+
+static void
+ApplyScheduler(ThreadPolicy::Scheduler scheduler)
+{
+  switch (scheduler) {
+  case ThreadPolicy::Scheduler::DEFAULT:
+    break;
+
+  case ThreadPolicy::Scheduler::LOW:
+#ifdef WIN32
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+#endif
+    break;
+
+  case ThreadPolicy::Scheduler::IDLE:
+    SetThreadIdlePriority();
+    break;
+
+  case ThreadPolicy::Scheduler::REALTIME:
+#ifdef WIN32
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL);
+#else
+    SetThreadRealtime();
+#endif
+    break;
+  }
+}
+
+static void
+ApplyNice(int nice)
+{
+  if (nice == 0)
+    return;
+
+#ifdef __linux__
+  /* on Linux, the niceness is a per-thread attribute */
+  setpriority(PRIO_PROCESS, syscall(__NR_gettid), nice);
+#else
+  (void)nice;
+#endif
+}
+
+static void
+ApplyAffinity(uint32_t cpus)
+{
+  /* ignore CPUs which are not online, and don't pin the thread
+     anywhere if none is left */
+  const unsigned n_cpus = std::min(GetProcessorCount(), 32u);
+  if (n_cpus < 32)
+    cpus &= (1u << n_cpus) - 1;
+
+  if (cpus == 0)
+    return;
+
+#if defined(__linux__) && defined(CPU_SET)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (unsigned i = 0; i < 32; ++i)
+    if (cpus & (1u << i))
+      CPU_SET(i, &set);
+
+  sched_setaffinity(0, sizeof(set), &set);
+#elif defined(WIN32)
+  SetThreadAffinityMask(GetCurrentThread(), cpus);
+#endif
+}
+
+void
+ApplyThreadPolicy(ThreadRole role)
+{
+  const ThreadPolicy policy = GetThreadPolicy(role);
+
+  ApplyScheduler(policy.scheduler);
+  ApplyNice(policy.nice);
+  ApplyAffinity(policy.cpus);
+}
@@ -0,0 +1,139 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#ifndef XCSOAR_THREAD_POLICY_HPP
+#define XCSOAR_THREAD_POLICY_HPP
+
+#include <type_traits>
+#include <array>
+
+#include <stdint.h>
+
+/**
+ * The job of a thread, which determines its scheduling policy.
+ */
+enum class ThreadRole : uint8_t {
+  /** the audio callback (vario, sounds) */
+  AUDIO,
+
+  /** device I/O (serial, TCP, the asio thread) */
+  PORT_IO,
+
+  /** the #MergeThread */
+  MERGE,
+
+  /** the #CalculationThread */
+  CALCULATION,
+
+  /** the map #DrawThread */
+  DRAW,
+
+  /** background loaders (terrain, topography) */
+  BACKGROUND,
+
+  COUNT
+};
+
+/**
+ * How a thread shall be scheduled.
+ */
+struct ThreadPolicy {
+  enum class Scheduler : uint8_t {
+    /** don't change the scheduling class */
+    DEFAULT,
+
+    /** slightly below the default (Windows only) */
+    LOW,
+
+    /** only run when the CPU is idle, and with idle I/O priority */
+    IDLE,
+
+    /** real-time FIFO scheduling (Linux, needs privileges) */
+    REALTIME,
+  };
+
+  Scheduler scheduler;
+
+  /**
+   * The niceness to be applied to the thread (Linux only).  0 means
+   * don't change it.
+   */
+  int8_t nice;
+
+  /**
+   * A bit mask of the CPUs this thread may run on.  0 means no
+   * restriction.
+   */
+  uint32_t cpus;
+
+  void Set(Scheduler _scheduler, int _nice=0, uint32_t _cpus=0) {
+    scheduler = _scheduler;
+    nice = _nice;
+    cpus = _cpus;
+  }
+};
+
+struct ThreadPolicySettings {
+  std::array<ThreadPolicy, unsigned(ThreadRole::COUNT)> roles;
+
+  ThreadPolicy &operator[](ThreadRole role) {
+    return roles[unsigned(role)];
+  }
+
+  const ThreadPolicy &operator[](ThreadRole role) const {
+    return roles[unsigned(role)];
+  }
+
+  /**
+   * Load the preset for this platform, depending on the number of
+   * processors.  With more than one processor, audio and device I/O
+   * get the last one, and the background loaders are kept off it.
+   */
+  void SetDefaults();
+};
+
+static_assert(std::is_trivial<ThreadPolicySettings>::value,
+              "type is not trivial");
+
+/**
+ * Returns a short name for the role, which is used for profile keys.
+ */
+const char *
+ToString(ThreadRole role);
+
+/**
+ * Replace the global thread policy.  Threads pick it up the next
+ * time they call ApplyThreadPolicy(), which is usually only once
+ * when they start; therefore this should be called early.
+ */
+void
+SetThreadPolicySettings(const ThreadPolicySettings &settings);
+
+/**
+ * Apply the configured policy for the given role to the current
+ * thread.  Errors (e.g. missing privileges) are ignored.
+ */
+void
+ApplyThreadPolicy(ThreadRole role);
+
+#endif
@@ -0,0 +1,181 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#ifndef XCSOAR_THREAD_SNAPSHOT_BUFFER_HPP
+#define XCSOAR_THREAD_SNAPSHOT_BUFFER_HPP
+
+#include <atomic>
+#include <type_traits>
+
+#include <string.h>
+
+/**
+ * Publishes copies of a value to reader threads without a mutex.
+ * There are two slots, each guarded by a sequence counter (a
+ * "seqlock").  The writer fills the slot which is not current and then
+ * makes it current.  The reader copies the current slot and retries
+ * only if the writer has reused that slot in the meantime.
+ *
+ * Writers must be serialised by the caller, for example by calling
+ * Publish() only while holding the mutex that protects the source
+ * value.  Readers never block writers.
+ *
+ * Each snapshot is tagged with a generation number, which allows
+ * ReadModified() to skip the copy if the reader already has the
+ * current snapshot.
+ */
+template<typename T>
+class SnapshotBuffer {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "Snapshot type must be trivially copyable");
+
+  struct Slot {
+    /**
+     * Odd while the writer is modifying #value.
+     */
+    std::atomic<unsigned> sequence;
+
+    /**
+     * The generation number of #value.  It is only meaningful if
+     * #sequence did not change while reading it.
+     */
+    std::atomic<unsigned> generation;
+
+    T value;
+  };
+
+  Slot slots[2];
+
+  /**
+   * The generation number of the most recently published snapshot.
+   * Only the writer accesses this.  Zero means nothing has been
+   * published yet.
+   */
+  unsigned last_generation;
+
+  /**
+   * Index of the slot holding the most recent snapshot.
+   */
+  std::atomic<unsigned> current;
+
+  /**
+   * The number of times a reader had to start over.  This is for
+   * diagnostics only.
+   */
+  mutable std::atomic<unsigned> retries;
+
+public:
+  SnapshotBuffer():last_generation(0), current(0), retries(0) {
+    for (auto &slot : slots) {
+      slot.sequence.store(0, std::memory_order_relaxed);
+      slot.generation.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  SnapshotBuffer(const SnapshotBuffer &) = delete;
+  SnapshotBuffer &operator=(const SnapshotBuffer &) = delete;
+
+  void Publish(const T &src) {
+    const unsigned i = current.load(std::memory_order_relaxed) ^ 1;
+    Slot &slot = slots[i];
+
+    const unsigned sequence = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.generation.store(++last_generation, std::memory_order_relaxed);
+    memcpy(&slot.value, &src, sizeof(slot.value));
+
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+    current.store(i, std::memory_order_release);
+  }
+
+  void Read(T &dest) const {
+    while (true) {
+      const Slot &slot = slots[current.load(std::memory_order_acquire)];
+
+      const unsigned sequence = slot.sequence.load(std::memory_order_acquire);
+      if ((sequence & 1) == 0) {
+        memcpy(&dest, &slot.value, sizeof(dest));
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (slot.sequence.load(std::memory_order_relaxed) == sequence)
+          return;
+      }
+
+      /* the writer has lapped us: it published twice while we were
+         copying */
+      retries.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * Like Read(), but don't copy anything if #dest already holds the
+   * current snapshot.
+   *
+   * @param generation the generation number of the snapshot in
+   * #dest (initialise with 0); it is updated after a copy
+   * @return true if #dest was modified
+   */
+  bool ReadModified(T &dest, unsigned &generation) const {
+    while (true) {
+      const Slot &slot = slots[current.load(std::memory_order_acquire)];
+
+      /* the generation number cannot be torn, so if it matches, dest
+         already holds this snapshot, no matter what the writer is
+         doing right now */
+      if (slot.generation.load(std::memory_order_relaxed) == generation)
+        return false;
+
+      const unsigned sequence = slot.sequence.load(std::memory_order_acquire);
+      if ((sequence & 1) == 0) {
+        const unsigned new_generation =
+          slot.generation.load(std::memory_order_relaxed);
+        memcpy(&dest, &slot.value, sizeof(dest));
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (slot.sequence.load(std::memory_order_relaxed) == sequence) {
+          generation = new_generation;
+          return true;
+        }
+      }
+
+      retries.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * Returns the generation number of the most recent snapshot.  It
+   * changes whenever Publish() is called.
+   */
+  unsigned GetGeneration() const {
+    const Slot &slot = slots[current.load(std::memory_order_acquire)];
+    return slot.generation.load(std::memory_order_relaxed);
+  }
+
+  unsigned GetRetries() const {
+    return retries.load(std::memory_order_relaxed);
+  }
+};
+
+#endif
@@ -111,6 +111,19 @@ protected:
     Trigger();
   }
 
+  /**
+   * Is the thread alive?  This is false if it has never been
+   * triggered, or if launching it has failed.
+   *
+   * Caller must lock the mutex.
+   */
+  gcc_pure
+  bool IsAlive() const {
+    assert(mutex.IsLockedByCurrent());
+
+    return alive;
+  }
+
   /**
    * Is the thread currently working (i.e. inside Tick())?
    *
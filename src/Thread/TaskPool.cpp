@@ -0,0 +1,219 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#include "TaskPool.hpp"
+#include "Thread.hpp"
+#include "Util.hpp"
+
+#include <algorithm>
+
+#include <assert.h>
+
+class TaskPool::Worker final : public Thread {
+  TaskPool &pool;
+  const unsigned index;
+
+public:
+  /**
+   * Protects #queues.
+   */
+  Mutex mutex;
+
+  std::deque<Task> queues[N_PRIORITIES];
+
+  Worker(TaskPool &_pool, unsigned _index)
+    :Thread("TaskPool"), pool(_pool), index(_index) {}
+
+protected:
+  /* virtual methods from class Thread */
+  void Run() override {
+    pool.Run(index);
+  }
+};
+
+TaskPool::TaskPool(unsigned n_workers)
+  :pending(0), next_worker(0)
+{
+  n_workers = std::max(n_workers, 1u);
+
+  workers.reserve(n_workers);
+  for (unsigned i = 0; i < n_workers; ++i)
+    workers.emplace_back(new Worker(*this, i));
+
+  for (auto &worker : workers)
+    worker->Start();
+}
+
+TaskPool::~TaskPool()
+{
+  {
+    const ScopeLock protect(mutex);
+    quit = true;
+    cond.broadcast();
+  }
+
+  for (auto &worker : workers)
+    worker->Join();
+
+  assert(pending == 0);
+}
+
+TaskPool &
+TaskPool::GetGlobal()
+{
+  static TaskPool instance(GetProcessorCount() - 1);
+  return instance;
+}
+
+void
+TaskPool::Push(Function &&function, TaskGroup *group,
+               Priority priority, unsigned affinity)
+{
+  if (affinity == ANY_WORKER)
+    affinity = next_worker++;
+
+  Worker &worker = *workers[affinity % workers.size()];
+
+  {
+    const ScopeLock protect(mutex);
+    ++pending;
+  }
+
+  {
+    const ScopeLock protect(worker.mutex);
+    worker.queues[unsigned(priority)].push_back({std::move(function), group});
+  }
+
+  const ScopeLock protect(mutex);
+  cond.signal();
+}
+
+bool
+TaskPool::RunOne(unsigned preferred)
+{
+  if (pending <= 0)
+    return false;
+
+  const unsigned n = workers.size();
+  if (preferred == ANY_WORKER)
+    preferred = next_worker++;
+
+  Task task;
+  bool found = false;
+
+  for (unsigned p = N_PRIORITIES; !found && p-- > 0;) {
+    for (unsigned i = 0; i < n; ++i) {
+      Worker &worker = *workers[(preferred + i) % n];
+      const ScopeLock protect(worker.mutex);
+      auto &queue = worker.queues[p];
+      if (queue.empty())
+        continue;
+
+      if (i == 0) {
+        /* our own queue: the newest task, whose data is most likely
+           still in the cache */
+        task = std::move(queue.back());
+        queue.pop_back();
+      } else {
+        /* steal the oldest task from another worker */
+        task = std::move(queue.front());
+        queue.pop_front();
+      }
+
+      found = true;
+      break;
+    }
+  }
+
+  if (!found)
+    return false;
+
+  --pending;
+
+  task.function();
+
+  if (task.group != nullptr)
+    task.group->Done();
+
+  return true;
+}
+
+void
+TaskPool::Run(unsigned index)
+{
+  while (true) {
+    if (RunOne(index))
+      continue;
+
+    const ScopeLock protect(mutex);
+    while (pending <= 0 && !quit)
+      cond.wait(mutex);
+
+    if (pending <= 0 && quit)
+      break;
+  }
+}
+
+void
+TaskGroup::Submit(TaskPool::Function &&function,
+                  TaskPool::Priority priority, unsigned affinity)
+{
+  {
+    const ScopeLock protect(mutex);
+    ++remaining;
+  }
+
+  pool.Push(std::move(function), this, priority, affinity);
+}
+
+void
+TaskGroup::Done()
+{
+  const ScopeLock protect(mutex);
+  assert(remaining > 0);
+  if (--remaining == 0)
+    cond.broadcast();
+}
+
+void
+TaskGroup::Wait()
+{
+  while (true) {
+    {
+      const ScopeLock protect(mutex);
+      if (remaining == 0)
+        return;
+    }
+
+    /* help instead of sleeping; this also guarantees progress when
+       called from inside a worker thread */
+    if (pool.RunOne(TaskPool::ANY_WORKER))
+      continue;
+
+    /* the queues are empty, so the remaining tasks are running in
+       other threads right now */
+    const ScopeLock protect(mutex);
+    if (remaining > 0)
+      cond.wait(mutex);
+  }
+}
@@ -0,0 +1,206 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#ifndef XCSOAR_THREAD_TASK_POOL_HPP
+#define XCSOAR_THREAD_TASK_POOL_HPP
+
+#include "Thread/Mutex.hpp"
+#include "Cond.hxx"
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <stdint.h>
+
+class TaskGroup;
+
+/**
+ * A pool of worker threads which execute short CPU-bound tasks.
+ * Subsystems use it to split one computation into parallel chunks
+ * (e.g. contest solving, tile decoding, file parsing); loops which
+ * need a guaranteed latency keep their dedicated threads.
+ *
+ * Each worker owns one queue per #Priority.  A worker takes the
+ * newest task from its own queue, and if that is empty, it steals
+ * the oldest task from the other workers' queues.  Higher priorities
+ * are always served first, pool-wide.
+ *
+ * Tasks must not throw.  A task may submit more tasks and may wait
+ * for a #TaskGroup; the waiting thread executes queued tasks in the
+ * meantime, so nesting cannot deadlock the pool.
+ */
+class TaskPool {
+public:
+  enum class Priority : uint8_t {
+    LOW,
+    NORMAL,
+    HIGH,
+  };
+
+  static constexpr unsigned N_PRIORITIES = unsigned(Priority::HIGH) + 1;
+
+  /**
+   * Affinity hint: let the pool choose a worker.
+   */
+  static constexpr unsigned ANY_WORKER = unsigned(-1);
+
+  typedef std::function<void()> Function;
+
+private:
+  struct Task {
+    Function function;
+
+    /**
+     * The group this task belongs to, or nullptr.
+     */
+    TaskGroup *group;
+  };
+
+  class Worker;
+
+  std::vector<std::unique_ptr<Worker>> workers;
+
+  /**
+   * Protects #quit and is used with #cond to put idle workers to
+   * sleep.
+   */
+  Mutex mutex;
+  Cond cond;
+
+  /**
+   * The number of tasks which have been queued but not yet taken by
+   * a thread.  It is incremented while #mutex is locked, so a worker
+   * checking it under the lock cannot miss a wakeup.
+   */
+  std::atomic<int> pending;
+
+  /**
+   * Round-robin counter for tasks submitted with #ANY_WORKER.
+   */
+  std::atomic<unsigned> next_worker;
+
+  bool quit = false;
+
+public:
+  /**
+   * Start the given number of worker threads (at least one).
+   */
+  explicit TaskPool(unsigned n_workers);
+
+  /**
+   * Execute all queued tasks and stop the worker threads.
+   */
+  ~TaskPool();
+
+  TaskPool(const TaskPool &) = delete;
+  TaskPool &operator=(const TaskPool &) = delete;
+
+  /**
+   * Returns the process-wide instance, which is created on the first
+   * call with one worker per processor except the calling one.
+   */
+  static TaskPool &GetGlobal();
+
+  unsigned GetWorkerCount() const {
+    return workers.size();
+  }
+
+  /**
+   * Queue a task for execution in a worker thread.
+   *
+   * @param affinity a hint which worker shall run this task; tasks
+   * with the same hint tend to run on the same thread (modulo the
+   * number of workers), which helps with cache locality
+   */
+  void Submit(Function &&function, Priority priority=Priority::NORMAL,
+              unsigned affinity=ANY_WORKER) {
+    Push(std::move(function), nullptr, priority, affinity);
+  }
+
+private:
+  friend class TaskGroup;
+
+  void Push(Function &&function, TaskGroup *group,
+            Priority priority, unsigned affinity);
+
+  /**
+   * Take one task (looking at the queue of the given worker first)
+   * and execute it in the current thread.
+   *
+   * @return false if all queues were empty
+   */
+  bool RunOne(unsigned preferred);
+
+  void Run(unsigned index);
+};
+
+/**
+ * A batch of tasks submitted to a #TaskPool whose completion can be
+ * awaited.
+ */
+class TaskGroup {
+  TaskPool &pool;
+
+  Mutex mutex;
+  Cond cond;
+
+  /**
+   * The number of submitted tasks which have not yet finished.
+   * Protected by #mutex.
+   */
+  unsigned remaining = 0;
+
+public:
+  explicit TaskGroup(TaskPool &_pool=TaskPool::GetGlobal())
+    :pool(_pool) {}
+
+  /**
+   * Waits for all tasks which are still running.
+   */
+  ~TaskGroup() {
+    Wait();
+  }
+
+  TaskGroup(const TaskGroup &) = delete;
+  TaskGroup &operator=(const TaskGroup &) = delete;
+
+  void Submit(TaskPool::Function &&function,
+              TaskPool::Priority priority=TaskPool::Priority::NORMAL,
+              unsigned affinity=TaskPool::ANY_WORKER);
+
+  /**
+   * Wait until all tasks of this group have finished.  While
+   * waiting, the calling thread executes queued tasks.
+   */
+  void Wait();
+
+private:
+  friend class TaskPool;
+
+  void Done();
+};
+
+#endif
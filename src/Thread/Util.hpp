@@ -104,4 +104,25 @@ SetThreadRealtime()
 #endif
 };
 
+/**
+ * Determine the number of processors which are currently online.
+ * Returns 1 if that is unknown.
+ */
+static inline unsigned
+GetProcessorCount()
+{
+#ifdef __linux__
+  const long n = sysconf(_SC_NPROCESSORS_ONLN);
+  return n > 0 ? unsigned(n) : 1u;
+#elif defined(WIN32)
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return info.dwNumberOfProcessors > 0
+    ? unsigned(info.dwNumberOfProcessors)
+    : 1u;
+#else
+  return 1;
+#endif
+}
+
 #endif
@@ -23,6 +23,8 @@ Copyright_License {
 
 #include "Thread.hpp"
 #include "TopographyStore.hpp"
+#include "Computer/StageTimer.hpp"
+#include "Thread/Policy.hpp"
 
 TopographyThread::TopographyThread(TopographyStore &_store,
                                    std::function<void()> &&_callback)
@@ -65,8 +67,10 @@ TopographyThread::Trigger(const WindowProjection &_projection)
 void
 TopographyThread::Tick()
 {
+  const ScopeStageTimer stage_timer(StageTimer::Stage::TOPOGRAPHY);
+
   // TODO: call only once
-  SetIdlePriority();
+  ApplyThreadPolicy(ThreadRole::BACKGROUND);
 
   bool again = true;
   while (next_projection.IsValid() && again && !IsStopped()) {
@@ -29,6 +29,7 @@ Copyright_License {
 #include <zzip/lib.h>
 
 #include <algorithm>
+#include <new>
 
 TopographyFile::TopographyFile(zzip_dir *_dir, const char *filename,
                                double _threshold,
@@ -90,18 +91,50 @@ void
 TopographyFile::ClearCache()
 {
   for (auto i = shapes.begin(), end = shapes.end(); i != end; ++i) {
-    delete i->shape;
+    FreeShape(i->shape);
     i->shape = nullptr;
   }
 
   first = nullptr;
 }
 
-static XShape *
-LoadShape(shapefileObj *file, const GeoPoint &center, int i,
-          int label_field)
+XShape *
+TopographyFile::LoadShape(int i)
 {
-  return new XShape(file, center, i, label_field);
+  void *p = shape_allocator.allocate(1);
+
+  try {
+    return new(p) XShape(&file, center, i, label_field);
+  } catch (...) {
+    shape_allocator.deallocate(static_cast<XShape *>(p), 1);
+    throw;
+  }
+}
+
+void
+TopographyFile::FreeShape(const XShape *shape)
+{
+  if (shape == nullptr)
+    return;
+
+  shape->~XShape();
+  shape_allocator.deallocate(const_cast<XShape *>(shape), 1);
+}
+
+void
+TopographyFile::LoadShapeBounds()
+{
+  shape_bounds.ResizeDiscard(file.numshapes);
+
+  for (int i = 0; i < file.numshapes; ++i) {
+    rectObj r;
+    if (msSHPReadBounds(file.hSHP, i, &r) == MS_SUCCESS)
+      shape_bounds[i] = {float(r.minx), float(r.miny),
+                         float(r.maxx), float(r.maxy)};
+    else
+      /* null shape or I/O error: never visible */
+      shape_bounds[i] = {1, 1, -1, -1};
+  }
 }
 
 bool
@@ -122,30 +155,19 @@ TopographyFile::Update(const WindowProjection &map_projection)
 
   cache_bounds = screenRect.Scale(2);
 
-  rectObj deg_bounds = ConvertRect(cache_bounds);
-
-  // Test which shapes are inside the given bounds and save the
-  // status to file.status
-  switch (msShapefileWhichShapes(&file, dir, deg_bounds, 0)) {
-  case MS_FAILURE:
-    ClearCache();
-    return false;
-
-  case MS_DONE:
+  const rectObj deg_bounds = ConvertRect(cache_bounds);
+  if (msRectOverlap(&file.bounds, &deg_bounds) != MS_TRUE)
     /* screen is outside of map bounds */
     return false;
 
-  case MS_SUCCESS:
-    break;
-  }
-
-  assert(file.status != nullptr);
+  if (shape_bounds.empty())
+    LoadShapeBounds();
 
   // Iterate through the shapefile entries
   const ShapeList **current = &first;
   auto it = shapes.begin();
   for (int i = 0; i < file.numshapes; ++i, ++it) {
-    if (!msGetBit(file.status, i)) {
+    if (!shape_bounds[i].Overlaps(deg_bounds)) {
       // If the shape is outside the bounds
       // delete the shape from the cache
       if (it->shape != nullptr) {
@@ -160,7 +182,7 @@ TopographyFile::Update(const WindowProjection &map_projection)
 
         /* now it's unreachable, and we can delete the XShape without
            holding a lock */
-        delete it->shape;
+        FreeShape(it->shape);
         it->shape = nullptr;
       }
     } else {
@@ -169,7 +191,7 @@ TopographyFile::Update(const WindowProjection &map_projection)
         assert(*current != it);
 
         // shape isn't cached yet -> cache the shape
-        it->shape = LoadShape(&file, center, i, label_field);
+        it->shape = LoadShape(i);
         it->next = *current;
 
         /* insert into linked list (protected) */
@@ -198,7 +220,7 @@ TopographyFile::LoadAll()
   for (int i = 0; i < file.numshapes; ++i, ++it) {
     if (it->shape == nullptr)
       // shape isn't cached yet -> cache the shape
-      it->shape = LoadShape(&file, center, i, label_field);
+      it->shape = LoadShape(i);
     // update list pointer
     *current = it;
     current = &it->next;
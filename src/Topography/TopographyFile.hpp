@@ -28,6 +28,7 @@ Copyright_License {
 #include "shapelib/mapserver.h"
 #include "Geo/GeoBounds.hpp"
 #include "Util/AllocatedArray.hxx"
+#include "Util/SliceAllocator.hpp"
 #include "Util/Serial.hpp"
 #include "Screen/Color.hpp"
 #include "ResourceId.hpp"
@@ -53,6 +54,23 @@ class TopographyFile {
     ShapeList(const XShape *_shape):shape(_shape) {}
   };
 
+  /**
+   * The bounding box of one shape, in degrees.
+   */
+  struct ShapeBounds {
+    float min_x, min_y, max_x, max_y;
+
+    /**
+     * Does this box overlap with the given rectangle?  A box whose
+     * bounds could not be read never overlaps because it is
+     * initialised inverted.
+     */
+    constexpr bool Overlaps(const rectObj &r) const {
+      return min_x <= r.maxx && max_x >= r.minx &&
+        min_y <= r.maxy && max_y >= r.miny;
+    }
+  };
+
   /**
    * This gets incremented by Update().
    */
@@ -70,6 +88,21 @@ class TopographyFile {
   AllocatedArray<ShapeList> shapes;
   const ShapeList *first;
 
+  /**
+   * Allocates the #XShape objects.  Shapes are loaded and discarded
+   * all the time while the map moves; reusing fixed-size slots
+   * keeps that from fragmenting the heap during a long flight.
+   */
+  SliceAllocator<XShape, 256u> shape_allocator;
+
+  /**
+   * The bounds of all shapes, read from the shapefile on the first
+   * Update() call.  This replaces the bounds lookup in the ".qix" or
+   * ".shp" file that was done each time the screen moved, which
+   * means seeking in a (possibly compressed) ZIP file.
+   */
+  AllocatedArray<ShapeBounds> shape_bounds;
+
   const int label_field;
 
   const ResourceId icon, big_icon;
@@ -289,6 +322,15 @@ public:
 
 protected:
   void ClearCache();
+
+private:
+  /**
+   * Fill #shape_bounds.
+   */
+  void LoadShapeBounds();
+
+  XShape *LoadShape(int i);
+  void FreeShape(const XShape *shape);
 };
 
 #endif
@@ -82,12 +82,36 @@ TopographyFileRenderer::~TopographyFileRenderer()
 #endif
 }
 
+bool
+TopographyFileRenderer::IsVisibleShapesClean(const WindowProjection &projection) const
+{
+  return file.GetSerial() == visible_serial &&
+    visible_bounds.IsInside(projection.GetScreenBounds()) &&
+    projection.GetScreenBounds().Scale(2).IsInside(visible_bounds);
+}
+
+bool
+TopographyFileRenderer::IsVisibleShapesDirty(const WindowProjection &projection) const
+{
+  const ScopeLock protect(file.mutex);
+
+  return !file.IsEmpty() && file.IsVisible(projection.GetMapScale()) &&
+    !IsVisibleShapesClean(projection);
+}
+
+void
+TopographyFileRenderer::PrepareVisibleShapes(const WindowProjection &projection)
+{
+  const ScopeLock protect(file.mutex);
+
+  if (!file.IsEmpty() && file.IsVisible(projection.GetMapScale()))
+    UpdateVisibleShapes(projection);
+}
+
 void
 TopographyFileRenderer::UpdateVisibleShapes(const WindowProjection &projection)
 {
-  if (file.GetSerial() == visible_serial &&
-      visible_bounds.IsInside(projection.GetScreenBounds()) &&
-      projection.GetScreenBounds().Scale(2).IsInside(visible_bounds))
+  if (IsVisibleShapesClean(projection))
     /* cache is clean */
     return;
 
@@ -324,15 +348,16 @@ TopographyFileRenderer::Paint(Canvas &canvas,
           }
         }
 #else // !ENABLE_OPENGL
+        const auto convert = projection.GetScreenConverter();
         for (unsigned msize : lines) {
         shape_renderer.Begin(msize);
 
         const GeoPoint *end = points + msize - 1;
         for (; points < end; ++points)
-          shape_renderer.AddPointIfDistant(projection.GeoToScreen(*points));
+          shape_renderer.AddPointIfDistant(convert(*points));
 
         // make sure we always draw the last point
-        shape_renderer.AddPoint(projection.GeoToScreen(*points));
+        shape_renderer.AddPoint(convert(*points));
 
         shape_renderer.FinishPolyline(canvas);
       }
@@ -368,6 +393,7 @@ TopographyFileRenderer::Paint(Canvas &canvas,
       }
 #else // !ENABLE_OPENGL
       {
+        const auto convert = projection.GetScreenConverter();
         const GeoPoint *src = &points[0];
         for (const unsigned n : lines) {
           unsigned msize = n / iskip;
@@ -387,10 +413,8 @@ TopographyFileRenderer::Paint(Canvas &canvas,
 
           shape_renderer.Begin(msize);
 
-          for (unsigned i = 0; i < msize; ++i) {
-            GeoPoint g = geo_points[i];
-            shape_renderer.AddPointIfDistant(projection.GeoToScreen(g));
-          }
+          for (unsigned i = 0; i < msize; ++i)
+            shape_renderer.AddPointIfDistant(convert(geo_points[i]));
 
           shape_renderer.FinishPolygon(canvas);
 
@@ -89,6 +89,19 @@ public:
 
   ~TopographyFileRenderer();
 
+  /**
+   * Does Paint() need to rebuild the list of visible shapes?
+   */
+  gcc_pure
+  bool IsVisibleShapesDirty(const WindowProjection &projection) const;
+
+  /**
+   * Rebuild the list of visible shapes now.  This does not need the
+   * canvas, and may therefore be called in a worker thread, while
+   * another thread prepares other files.
+   */
+  void PrepareVisibleShapes(const WindowProjection &projection);
+
   /**
    * Paints the polygons, lines and points/icons in the TopographyFile
    * @param canvas The canvas to paint on
@@ -108,6 +121,12 @@ public:
                    const WindowProjection &projection, LabelBlock &label_block);
 
 private:
+  /**
+   * Caller must lock the file.
+   */
+  gcc_pure
+  bool IsVisibleShapesClean(const WindowProjection &projection) const;
+
   void UpdateVisibleShapes(const WindowProjection &projection);
 
 #ifdef ENABLE_OPENGL
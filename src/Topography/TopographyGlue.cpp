@@ -35,20 +35,27 @@ Copyright_License {
  * Load topography from the map file (ZIP), load the other files from
  * the same ZIP file.
  */
+bool
+LoadTopography(TopographyStore &store, ZipArchive &archive,
+               OperationEnvironment &operation)
+try {
+  ZipLineReaderA reader(archive.get(), "topology.tpl");
+  store.Load(operation, reader, nullptr, archive.get());
+  return true;
+} catch (const std::runtime_error &e) {
+  LogError("No topography in map file", e);
+  return false;
+}
+
 static bool
 LoadConfiguredTopographyZip(TopographyStore &store,
                             OperationEnvironment &operation)
-try {
+{
   auto archive = OpenMapFile();
   if (!archive)
     return false;
 
-  ZipLineReaderA reader(archive->get(), "topology.tpl");
-  store.Load(operation, reader, nullptr, archive->get());
-  return true;
-} catch (const std::runtime_error &e) {
-  LogError("No topography in map file", e);
-  return false;
+  return LoadTopography(store, *archive, operation);
 }
 
 bool
@@ -26,9 +26,19 @@ Copyright_License {
 
 class TopographyStore;
 class OperationEnvironment;
+class ZipArchive;
 
 bool
 LoadConfiguredTopography(TopographyStore &store,
                          OperationEnvironment &operation);
 
+/**
+ * Load topography from the given map file (see OpenMapFile()).
+ * Unlike LoadConfiguredTopography(), this does not access the
+ * profile, and may therefore be called from a worker thread.
+ */
+bool
+LoadTopography(TopographyStore &store, ZipArchive &archive,
+               OperationEnvironment &operation);
+
 #endif
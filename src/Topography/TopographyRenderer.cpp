@@ -23,6 +23,7 @@ Copyright_License {
 
 #include "Topography/TopographyRenderer.hpp"
 #include "Topography/TopographyFileRenderer.hpp"
+#include "Thread/TaskPool.hpp"
 
 TopographyRenderer::TopographyRenderer(const TopographyStore &_store,
                                        const TopographyLook &look)
@@ -38,10 +39,36 @@ TopographyRenderer::~TopographyRenderer()
     delete *it;
 }
 
+void
+TopographyRenderer::PrepareVisibleShapes(const WindowProjection &projection) const
+{
+  StaticArray<TopographyFileRenderer *, TopographyStore::MAXTOPOGRAPHY> dirty;
+  for (auto *i : files)
+    if (i->IsVisibleShapesDirty(projection))
+      dirty.push_back(i);
+
+  if (dirty.size() < 2)
+    /* not worth the overhead; Paint() will do it */
+    return;
+
+  TaskGroup group;
+  for (auto *i : dirty)
+    group.Submit([i, &projection](){
+        i->PrepareVisibleShapes(projection);
+      });
+
+  group.Wait();
+}
+
 void
 TopographyRenderer::Draw(Canvas &canvas,
                          const WindowProjection &projection) const
 {
+  /* scanning the shapes of all files after the map has moved is the
+     expensive part which doesn't need the canvas; do it in parallel,
+     and only then paint one file after the other */
+  PrepareVisibleShapes(projection);
+
   for (auto it = files.begin(), end = files.end(); it != end; ++it)
     (*it)->Paint(canvas, projection);
 }
@@ -60,6 +60,13 @@ public:
 
   void DrawLabels(Canvas &canvas, const WindowProjection &projection,
                   LabelBlock &label_block) const;
+
+private:
+  /**
+   * Rebuild the lists of visible shapes of all files which need it,
+   * in parallel.
+   */
+  void PrepareVisibleShapes(const WindowProjection &projection) const;
 };
 
 #endif
@@ -31,6 +31,7 @@ Copyright_License {
 #include "Compatibility/path.h"
 #include "Asset.hpp"
 #include "Resources.hpp"
+#include "Util/AllocationStats.hpp"
 
 #include <stdint.h>
 #include <windef.h> // for MAX_PATH
@@ -109,6 +110,8 @@ unsigned
 TopographyStore::ScanVisibility(const WindowProjection &m_projection,
                               unsigned max_update)
 {
+  const ScopeAllocationTag alloc_tag(AllocationTag::TOPOGRAPHY);
+
   // check if any needs to have cache updates because wasnt
   // visible previously when bounds moved
 
@@ -130,6 +133,8 @@ TopographyStore::ScanVisibility(const WindowProjection &m_projection,
 void
 TopographyStore::LoadAll()
 {
+  const ScopeAllocationTag alloc_tag(AllocationTag::TOPOGRAPHY);
+
   for (const auto &i : files) {
     TopographyFile &file = *i;
     file.LoadAll();
@@ -145,6 +150,8 @@ void
 TopographyStore::Load(OperationEnvironment &operation, NLineReader &reader,
                       const TCHAR *directory, struct zzip_dir *zdir)
 {
+  const ScopeAllocationTag alloc_tag(AllocationTag::TOPOGRAPHY);
+
   Reset();
 
   // Create buffer for the shape filenames
@@ -38,6 +38,7 @@ Copyright_License {
 #endif
 
 #include <algorithm>
+#include <vector>
 
 #include <tchar.h>
 
@@ -179,6 +180,78 @@ XShape::~XShape()
 
 #ifdef ENABLE_OPENGL
 
+/**
+ * Calculate the square of the distance between the point #p and the
+ * line segment #a-#b.
+ */
+gcc_pure
+static ShapeScalar
+SegmentDistanceSquared(ShapePoint p, ShapePoint a, ShapePoint b)
+{
+  const ShapeScalar ab_x = b.x - a.x, ab_y = b.y - a.y;
+  const ShapeScalar ap_x = p.x - a.x, ap_y = p.y - a.y;
+
+  const ShapeScalar length_squared = ab_x * ab_x + ab_y * ab_y;
+  ShapeScalar t = length_squared > 0
+    ? (ap_x * ab_x + ap_y * ab_y) / length_squared
+    : 0;
+  t = std::max(ShapeScalar(0), std::min(ShapeScalar(1), t));
+
+  const ShapeScalar d_x = ap_x - ab_x * t, d_y = ap_y - ab_y * t;
+  return d_x * d_x + d_y * d_y;
+}
+
+/**
+ * Simplify one line with the Douglas-Peucker algorithm.  The first
+ * and the last point are always kept.
+ *
+ * @param offset the index of the first point in the shape
+ * @param dest the destination buffer, must have room for #n indices
+ * @return the new end of #dest
+ */
+static uint16_t *
+SimplifyLine(const ShapePoint *points, unsigned n, unsigned offset,
+             ShapeScalar tolerance, uint16_t *dest)
+{
+  assert(n >= 2);
+
+  std::vector<bool> keep(n, false);
+  keep.front() = keep.back() = true;
+
+  const ShapeScalar tolerance_squared = tolerance * tolerance;
+
+  std::vector<std::pair<unsigned, unsigned>> stack;
+  stack.emplace_back(0, n - 1);
+
+  while (!stack.empty()) {
+    const unsigned first = stack.back().first, last = stack.back().second;
+    stack.pop_back();
+
+    ShapeScalar max_distance = tolerance_squared;
+    unsigned farthest = 0;
+    for (unsigned j = first + 1; j < last; ++j) {
+      const ShapeScalar distance =
+        SegmentDistanceSquared(points[j], points[first], points[last]);
+      if (distance > max_distance) {
+        max_distance = distance;
+        farthest = j;
+      }
+    }
+
+    if (farthest > 0) {
+      keep[farthest] = true;
+      stack.emplace_back(first, farthest);
+      stack.emplace_back(farthest, last);
+    }
+  }
+
+  for (unsigned j = 0; j < n; ++j)
+    if (keep[j])
+      *dest++ = offset + j;
+
+  return dest;
+}
+
 bool
 XShape::BuildIndices(unsigned thinning_level, ShapeScalar min_distance)
 {
@@ -197,28 +270,22 @@ XShape::BuildIndices(unsigned thinning_level, ShapeScalar min_distance)
       new GLushort[num_lines + num_points];
     indices[thinning_level] = idx = idx_count + num_lines;
 
+    /* the Douglas-Peucker tolerance is a quarter of the minimum
+       point distance, which keeps the deviation from the original
+       line within what the former "skip close points" thinning
+       produced, with far fewer vertices */
+    const ShapeScalar tolerance = min_distance / 4;
+
     const uint16_t *end_l = lines + num_lines;
     const ShapePoint *p = points;
     unsigned i = 0;
     for (const uint16_t *l = lines; l < end_l; l++) {
       assert(*l >= 2);
-      const ShapePoint *end_p = p + *l - 1;
-      // always add first point
-      *idx++ = i;
-      p++; i++;
-      const uint16_t *after_first_idx = idx;
-      // add points if they are not too close to the previous point
-      for (; p < end_p; p++, i++)
-        if (ManhattanDistance(points[idx[-1]], *p) >= min_distance)
-          *idx++ = i;
-      // remove points from behind if they are too close to the end point
-      while (idx > after_first_idx &&
-             ManhattanDistance(points[idx[-1]], *p) < min_distance)
-        idx--;
-      // always add last point
-      *idx++ = i;
-      p++; i++;
-      *idx_count++ = idx - after_first_idx + 1;
+      const uint16_t *first_idx = idx;
+      idx = SimplifyLine(p, *l, i, tolerance, idx);
+      *idx_count++ = idx - first_idx;
+      p += *l;
+      i += *l;
     }
     // TODO: free memory saved by thinning (use malloc/realloc or some class?)
     return true;
@@ -30,10 +30,19 @@ Copyright_License {
 #include "Net/State.hpp"
 #include "OS/ByteOrder.hpp"
 
+#include <algorithm>
+
 #include <assert.h>
 
 static constexpr double CLOUD_INTERVAL = 60;
 
+/**
+ * The minimum interval between two fixes while we're not flying.  The
+ * position on the ground rarely changes, and sending it at the
+ * configured (in-flight) rate only costs mobile data.
+ */
+static constexpr unsigned GROUND_INTERVAL = 60;
+
 SkyLinesTracking::Glue::Glue(boost::asio::io_service &io_service,
                              Handler *_handler)
   :client(io_service, _handler),
@@ -70,7 +79,8 @@ SkyLinesTracking::Glue::IsConnected() const
 }
 
 inline void
-SkyLinesTracking::Glue::SendFixes(const NMEAInfo &basic)
+SkyLinesTracking::Glue::SendFixes(const NMEAInfo &basic,
+                                  const DerivedInfo &calculated)
 {
   assert(client.IsConnected());
 
@@ -79,8 +89,12 @@ SkyLinesTracking::Glue::SendFixes(const NMEAInfo &basic)
     return;
   }
 
+  const unsigned fix_interval = calculated.flight.flying
+    ? interval
+    : std::max(interval, GROUND_INTERVAL);
+
   if (!IsConnected()) {
-    if (clock.CheckAdvance(basic.time, interval)) {
+    if (clock.CheckAdvance(basic.time, fix_interval)) {
       /* queue the packet, send it later */
       if (queue == nullptr)
         queue = new Queue();
@@ -106,7 +120,7 @@ SkyLinesTracking::Glue::SendFixes(const NMEAInfo &basic)
     }
 
     return;
-  } else if (clock.CheckAdvance(basic.time, interval))
+  } else if (clock.CheckAdvance(basic.time, fix_interval))
     client.SendFix(basic);
 }
 
@@ -169,7 +183,7 @@ SkyLinesTracking::Glue::Tick(const NMEAInfo &basic,
     return;
 
   if (client.IsConnected()) {
-    SendFixes(basic);
+    SendFixes(basic, calculated);
 
     if (traffic_enabled && traffic_clock.CheckAdvance(basic.clock, 60))
       client.SendTrafficRequest(true, true, near_traffic_enabled);
@@ -72,7 +72,7 @@ private:
   gcc_pure
   bool IsConnected() const;
 
-  void SendFixes(const NMEAInfo &basic);
+  void SendFixes(const NMEAInfo &basic, const DerivedInfo &calculated);
   void SendCloudFix(const NMEAInfo &basic, const DerivedInfo &calculated);
 };
 
@@ -26,6 +26,7 @@ Copyright_License {
 
 #include "Protocol.hpp"
 #include "Util/OverwritingRingBuffer.hpp"
+#include "OS/ByteOrder.hpp"
 
 #include <stdint.h>
 
@@ -49,9 +50,14 @@ public:
   }
 
   void Push(const FixPacket &packet) {
-    if (!IsEmpty() && (packet.time > queue.last().time &&
-                       queue.last().time + MIN_PERIOD_MS < packet.time))
-      return;
+    if (!IsEmpty()) {
+      /* the time stamps are in network byte order */
+      const uint32_t time = FromBE32(packet.time);
+      const uint32_t last_time = FromBE32(queue.last().time);
+      if (time > last_time && time < last_time + MIN_PERIOD_MS)
+        /* too close to the previous one */
+        return;
+    }
 
     queue.push(packet);
   }
@@ -172,8 +172,6 @@ Server::OnDatagramReceived(Client &&client,
 void
 Server::OnReceive(const boost::system::error_code &ec, size_t size)
 {
-  // TODO: use recvmmsg() on Linux
-
   if (ec) {
     if (ec == boost::asio::error::operation_aborted)
       return;
@@ -186,6 +184,23 @@ Server::OnReceive(const boost::system::error_code &ec, size_t size)
 
   OnDatagramReceived(std::move(client_buffer), buffer, size);
 
+  /* under load, more datagrams are usually queued already; handle a
+     batch of them right here instead of going through the
+     io_service (and its epoll_wait()) for each one */
+  for (unsigned i = 1; i < MAX_RECEIVE_BATCH; ++i) {
+    boost::system::error_code ec2;
+    if (socket.available(ec2) == 0 || ec2)
+      break;
+
+    size = socket.receive_from(boost::asio::buffer(buffer, sizeof(buffer)),
+                               client_buffer.endpoint, 0, ec2);
+    if (ec2)
+      /* let the asynchronous receive report the error */
+      break;
+
+    OnDatagramReceived(std::move(client_buffer), buffer, size);
+  }
+
   AsyncReceive();
 }
 
@@ -41,6 +41,13 @@ namespace SkyLinesTracking {
  * virtual methods.
  */
 class Server {
+  /**
+   * The maximum number of datagrams handled in one receive
+   * completion.  This limits how long other events (timers, signals)
+   * have to wait under heavy load.
+   */
+  static constexpr unsigned MAX_RECEIVE_BATCH = 64;
+
   boost::asio::ip::udp::socket socket;
 
   uint8_t buffer[4096];
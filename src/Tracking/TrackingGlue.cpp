@@ -145,6 +145,21 @@ TrackingGlue::OnTimer(const MoreData &basic, const DerivedInfo &calculated)
   Trigger();
 }
 
+void
+TrackingGlue::FlushLiveTrack24Queue(unsigned max, OperationEnvironment &env)
+{
+  while (max-- > 0 && !livetrack24_queue.empty()) {
+    const LiveTrack24Position &p = livetrack24_queue.peek();
+    if (!LiveTrack24::SendPosition(state.session_id, state.packet_id,
+                                   p.location, p.altitude, p.ground_speed,
+                                   p.track, p.timestamp, env))
+      break;
+
+    ++state.packet_id;
+    livetrack24_queue.shift();
+  }
+}
+
 void
 TrackingGlue::Tick()
 {
@@ -162,12 +177,15 @@ TrackingGlue::Tick()
   try {
     if (!flying) {
       if (last_flying && state.HasSession()) {
-        /* landing: end tracking session */
+        /* landing: submit what is left and end tracking session */
+        FlushLiveTrack24Queue(LIVETRACK24_BATCH, env);
         LiveTrack24::EndTracking(state.session_id, state.packet_id, env);
         state.ResetSession();
         last_timestamp = 0;
       }
 
+      livetrack24_queue.clear();
+
       /* don't track if not flying */
       return;
     }
@@ -178,10 +196,20 @@ TrackingGlue::Tick()
       /* time warp: create a new session */
       LiveTrack24::EndTracking(state.session_id, state.packet_id, env);
       state.ResetSession();
+      livetrack24_queue.clear();
     }
 
     last_timestamp = current_timestamp;
 
+    /* queue the current position; while the server is unreachable,
+       the backlog is thinned out to one position per
+       LIVETRACK24_QUEUE_PERIOD */
+    if (livetrack24_queue.empty() ||
+        current_timestamp >= livetrack24_queue.last().timestamp +
+        LIVETRACK24_QUEUE_PERIOD)
+      livetrack24_queue.push({location, altitude, ground_speed, track,
+                              current_timestamp});
+
     if (!state.HasSession()) {
       LiveTrack24::UserID user_id = 0;
       if (!copy.username.empty() && !copy.password.empty())
@@ -207,10 +235,7 @@ TrackingGlue::Tick()
       state.packet_id = 2;
     }
 
-    LiveTrack24::SendPosition(state.session_id, state.packet_id++,
-                              location, altitude, ground_speed, track,
-                              current_timestamp,
-                              env);
+    FlushLiveTrack24Queue(LIVETRACK24_BATCH, env);
   } catch (const std::exception &exception) {
     LogError("LiveTrack24 error", exception);
   }
@@ -37,6 +37,7 @@ Copyright_License {
 #include "Time/PeriodClock.hpp"
 #include "Geo/GeoPoint.hpp"
 #include "Time/BrokenDateTime.hpp"
+#include "Util/OverwritingRingBuffer.hpp"
 
 struct MoreData;
 struct DerivedInfo;
@@ -59,6 +60,29 @@ class TrackingGlue final
     }
   };
 
+  /**
+   * A position which has not yet been submitted to LiveTrack24.
+   */
+  struct LiveTrack24Position {
+    GeoPoint location;
+    unsigned altitude;
+    unsigned ground_speed;
+    Angle track;
+    int64_t timestamp;
+  };
+
+  /**
+   * Don't queue positions faster than this number of seconds while
+   * the server is unreachable.
+   */
+  static constexpr int64_t LIVETRACK24_QUEUE_PERIOD = 30;
+
+  /**
+   * The maximum number of queued positions submitted in one Tick(),
+   * to catch up gradually after an outage.
+   */
+  static constexpr unsigned LIVETRACK24_BATCH = 8;
+
   PeriodClock clock;
 
   TrackingSettings settings;
@@ -69,6 +93,12 @@ class TrackingGlue final
 
   LiveTrack24State state;
 
+  /**
+   * Positions which could not be submitted yet, oldest first.  Only
+   * used by the background thread.
+   */
+  OverwritingRingBuffer<LiveTrack24Position, 128> livetrack24_queue;
+
   /**
    * The Unix UTC time stamp that was last submitted to the tracking
    * server.  This attribute is used to detect time warps.
@@ -94,6 +124,13 @@ public:
 protected:
   void Tick() override;
 
+private:
+  /**
+   * Submit queued positions to LiveTrack24, stopping at the first
+   * failure.
+   */
+  void FlushLiveTrack24Queue(unsigned max, OperationEnvironment &env);
+
 private:
   /* virtual methods from SkyLinesTracking::Handler */
   virtual void OnTraffic(uint32_t pilot_id, unsigned time_of_day_ms,
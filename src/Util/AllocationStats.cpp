@@ -0,0 +1,199 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#include "AllocationStats.hpp"
+
+#include <atomic>
+#include <new>
+
+#include <stdlib.h>
+
+namespace {
+
+struct AtomicCounters {
+  std::atomic<size_t> allocations{0}, bytes{0}, peak_bytes{0};
+
+  void Add(size_t size) {
+    ++allocations;
+
+    const size_t new_bytes = bytes += size;
+    size_t peak = peak_bytes.load(std::memory_order_relaxed);
+    while (new_bytes > peak &&
+           !peak_bytes.compare_exchange_weak(peak, new_bytes,
+                                             std::memory_order_relaxed)) {}
+  }
+
+  void Remove(size_t size) {
+    bytes -= size;
+  }
+};
+
+/**
+ * This header is prepended to each allocation; it remembers which
+ * subsystem the block was accounted to, because it may be freed
+ * elsewhere.
+ */
+struct alignas(alignof(max_align_t)) Header {
+  size_t size;
+  AllocationTag tag;
+};
+
+}
+
+static AtomicCounters counters[unsigned(AllocationTag::COUNT)];
+
+static thread_local AllocationTag current_tag = AllocationTag::OTHER;
+
+ScopeAllocationTag::ScopeAllocationTag(AllocationTag tag)
+  :previous(current_tag)
+{
+  current_tag = tag;
+}
+
+ScopeAllocationTag::~ScopeAllocationTag()
+{
+  current_tag = previous;
+}
+
+const char *
+ToString(AllocationTag tag)
+{
+  static constexpr const char *names[unsigned(AllocationTag::COUNT)] = {
+    "Other",
+    "Trace",
+    "Topography",
+    "Airspace",
+    "Task",
+    "Renderer",
+  };
+
+  return names[unsigned(tag)];
+}
+
+AllocationCounters
+GetAllocationCounters(AllocationTag tag)
+{
+  const AtomicCounters &c = counters[unsigned(tag)];
+  return {c.allocations.load(), c.bytes.load(), c.peak_bytes.load()};
+}
+
+void
+PrintAllocationStats(FILE *file)
+{
+  fprintf(file, "%-12s %12s %12s %12s\n",
+          "subsystem", "allocations", "bytes", "peak bytes");
+
+  for (unsigned i = 0; i < unsigned(AllocationTag::COUNT); ++i) {
+    const AllocationTag tag = AllocationTag(i);
+    const auto c = GetAllocationCounters(tag);
+    fprintf(file, "%-12s %12zu %12zu %12zu\n",
+            ToString(tag), c.allocations, c.bytes, c.peak_bytes);
+  }
+}
+
+static void *
+Allocate(size_t size) noexcept
+{
+  Header *header = (Header *)malloc(sizeof(Header) + size);
+  if (header == nullptr)
+    return nullptr;
+
+  header->size = size;
+  header->tag = current_tag;
+  counters[unsigned(header->tag)].Add(size);
+  return header + 1;
+}
+
+static void
+Free(void *p) noexcept
+{
+  if (p == nullptr)
+    return;
+
+  Header *header = (Header *)p - 1;
+  counters[unsigned(header->tag)].Remove(header->size);
+  free(header);
+}
+
+void *
+operator new(size_t size)
+{
+  void *p = Allocate(size);
+  if (p == nullptr)
+    throw std::bad_alloc();
+  return p;
+}
+
+void *
+operator new[](size_t size)
+{
+  return operator new(size);
+}
+
+void *
+operator new(size_t size, const std::nothrow_t &) noexcept
+{
+  return Allocate(size);
+}
+
+void *
+operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+  return Allocate(size);
+}
+
+void
+operator delete(void *p) noexcept
+{
+  Free(p);
+}
+
+void
+operator delete[](void *p) noexcept
+{
+  Free(p);
+}
+
+void
+operator delete(void *p, size_t) noexcept
+{
+  Free(p);
+}
+
+void
+operator delete[](void *p, size_t) noexcept
+{
+  Free(p);
+}
+
+void
+operator delete(void *p, const std::nothrow_t &) noexcept
+{
+  Free(p);
+}
+
+void
+operator delete[](void *p, const std::nothrow_t &) noexcept
+{
+  Free(p);
+}
@@ -0,0 +1,94 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#ifndef XCSOAR_ALLOCATION_STATS_HPP
+#define XCSOAR_ALLOCATION_STATS_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * The subsystems which heap allocations are accounted to.
+ */
+enum class AllocationTag : uint8_t {
+  OTHER,
+  TRACE,
+  TOPOGRAPHY,
+  AIRSPACE,
+  TASK,
+  RENDERER,
+  COUNT
+};
+
+#ifdef ALLOC_STATS
+
+struct AllocationCounters {
+  /** the number of allocations since startup */
+  size_t allocations;
+
+  /** the number of bytes currently allocated */
+  size_t bytes;
+
+  /** the maximum value of #bytes since startup */
+  size_t peak_bytes;
+};
+
+/**
+ * Accounts all heap allocations of the current thread to the given
+ * subsystem while this object exists.  This is a no-op unless the
+ * macro ALLOC_STATS is defined (make ALLOC_STATS=y).
+ */
+class ScopeAllocationTag {
+  const AllocationTag previous;
+
+public:
+  explicit ScopeAllocationTag(AllocationTag tag);
+  ~ScopeAllocationTag();
+
+  ScopeAllocationTag(const ScopeAllocationTag &) = delete;
+  ScopeAllocationTag &operator=(const ScopeAllocationTag &) = delete;
+};
+
+const char *
+ToString(AllocationTag tag);
+
+AllocationCounters
+GetAllocationCounters(AllocationTag tag);
+
+/**
+ * Print the counters of all subsystems.
+ */
+void
+PrintAllocationStats(FILE *file);
+
+#else
+
+class ScopeAllocationTag {
+public:
+  explicit ScopeAllocationTag(AllocationTag) {}
+};
+
+#endif
+
+#endif
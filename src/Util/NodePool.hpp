@@ -0,0 +1,189 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#ifndef XCSOAR_NODE_POOL_HPP
+#define XCSOAR_NODE_POOL_HPP
+
+#include <new>
+#include <cstddef>
+#include <assert.h>
+
+/**
+ * A pool of equally sized memory blocks for the nodes of one
+ * node-based container (e.g. std::unordered_map).  Blocks freed by
+ * the container are kept in a free list and reused, so a container
+ * which is cleared and refilled over and over (like the edge map of
+ * a path solver) stops allocating heap memory after the first run.
+ * The memory is returned to the heap only when the pool is
+ * destructed.
+ *
+ * The block size is determined by the first allocation; requests of
+ * any other size (e.g. a hash table's bucket array) are passed to the
+ * heap.  This class is not thread-safe.
+ *
+ * Use #NodePoolAllocator to attach a container to a pool.  The pool
+ * must be declared before the container, so it outlives it.
+ */
+class NodePool {
+  struct Item {
+    Item *next;
+  };
+
+  struct Chunk {
+    Chunk *next;
+  };
+
+  /**
+   * The number of blocks allocated at a time.
+   */
+  static constexpr std::size_t CHUNK_SIZE = 256;
+
+  static constexpr std::size_t ALIGNMENT = alignof(std::max_align_t);
+
+  static constexpr std::size_t RoundUp(std::size_t size) {
+    return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+  }
+
+  static constexpr std::size_t CHUNK_HEADER =
+    (sizeof(Chunk) + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+  /**
+   * The requested size which is served by this pool; 0 if nothing
+   * has been allocated yet.
+   */
+  std::size_t requested_size = 0;
+
+  /**
+   * The size of one block, aligned.
+   */
+  std::size_t item_size;
+
+  Item *available = nullptr;
+
+  Chunk *chunks = nullptr;
+
+public:
+  NodePool() = default;
+  NodePool(const NodePool &) = delete;
+  NodePool &operator=(const NodePool &) = delete;
+
+  ~NodePool() {
+    while (chunks != nullptr) {
+      Chunk *chunk = chunks;
+      chunks = chunk->next;
+      ::operator delete(chunk);
+    }
+  }
+
+  void *Allocate(std::size_t size) {
+    if (requested_size == 0) {
+      requested_size = size;
+      item_size = RoundUp(size > sizeof(Item) ? size : sizeof(Item));
+    } else if (size != requested_size)
+      return ::operator new(size);
+
+    if (available == nullptr)
+      Grow();
+
+    Item *item = available;
+    available = item->next;
+    return item;
+  }
+
+  void Deallocate(void *p, std::size_t size) {
+    assert(requested_size > 0);
+
+    if (size != requested_size) {
+      ::operator delete(p);
+      return;
+    }
+
+    Item *item = static_cast<Item *>(p);
+    item->next = available;
+    available = item;
+  }
+
+private:
+  void Grow() {
+    Chunk *chunk = static_cast<Chunk *>
+      (::operator new(CHUNK_HEADER + CHUNK_SIZE * item_size));
+    chunk->next = chunks;
+    chunks = chunk;
+
+    char *p = reinterpret_cast<char *>(chunk) + CHUNK_HEADER;
+    for (std::size_t i = 0; i < CHUNK_SIZE; ++i, p += item_size) {
+      Item *item = reinterpret_cast<Item *>(p);
+      item->next = available;
+      available = item;
+    }
+  }
+};
+
+/**
+ * An STL allocator which obtains memory from a #NodePool.  All
+ * copies (including rebound ones) refer to the same pool.
+ */
+template<typename T>
+class NodePoolAllocator {
+  template<typename U> friend class NodePoolAllocator;
+
+  NodePool *pool;
+
+public:
+  typedef std::size_t size_type;
+  typedef T value_type;
+  typedef T *pointer;
+  typedef const T *const_pointer;
+  typedef T &reference;
+  typedef const T &const_reference;
+
+  template<typename O>
+  struct rebind {
+    typedef NodePoolAllocator<O> other;
+  };
+
+  explicit NodePoolAllocator(NodePool &_pool):pool(&_pool) {}
+
+  template<typename U>
+  NodePoolAllocator(const NodePoolAllocator<U> &other):pool(other.pool) {}
+
+  T *allocate(size_type n) {
+    return static_cast<T *>(pool->Allocate(n * sizeof(T)));
+  }
+
+  void deallocate(T *p, size_type n) {
+    pool->Deallocate(p, n * sizeof(T));
+  }
+
+  template<typename U>
+  bool operator==(const NodePoolAllocator<U> &other) const {
+    return pool == other.pool;
+  }
+
+  template<typename U>
+  bool operator!=(const NodePoolAllocator<U> &other) const {
+    return pool != other.pool;
+  }
+};
+
+#endif
@@ -265,6 +265,20 @@ public:
   void destroy(T *t) {
     allocator.destroy(t);
   }
+
+  /**
+   * All instances share the same global #SliceAllocator, therefore
+   * memory allocated by one can be freed by another.
+   */
+  template<typename U>
+  constexpr bool operator==(const GlobalSliceAllocator<U, size> &) const {
+    return true;
+  }
+
+  template<typename U>
+  constexpr bool operator!=(const GlobalSliceAllocator<U, size> &) const {
+    return false;
+  }
 };
 
 #ifdef __clang__
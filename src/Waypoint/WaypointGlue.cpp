@@ -34,35 +34,90 @@ Copyright_License {
 #include "OS/Path.hpp"
 #include "IO/MapFile.hpp"
 #include "IO/ZipArchive.hpp"
+#include "Thread/Thread.hpp"
+
+#include <algorithm>
+#include <forward_list>
+#include <vector>
+
+/**
+ * Parses one waypoint file into a private #Waypoints instance in a
+ * separate thread.  Finish() merges the result into the real
+ * #Waypoints instance.
+ */
+class WaypointFileThread final : protected Thread {
+  const AllocatedPath path;
+  const WaypointFileType file_type;
+  const WaypointFactory factory;
+
+  Waypoints waypoints;
+
+  bool success;
+
+public:
+  WaypointFileThread(Path _path, WaypointFileType _file_type,
+                     WaypointOrigin origin, const RasterTerrain *terrain)
+    :Thread("WaypointFile"),
+     path(_path), file_type(_file_type), factory(origin, terrain) {
+    if (!Start())
+      /* no thread available: parse synchronously */
+      Run();
+  }
 
-static bool
-LoadWaypointFile(Waypoints &waypoints, Path path,
-                 WaypointFileType file_type,
-                 WaypointOrigin origin,
-                 const RasterTerrain *terrain, OperationEnvironment &operation)
-{
-  if (!ReadWaypointFile(path, file_type, waypoints,
-                        WaypointFactory(origin, terrain),
-                        operation)) {
-    LogFormat(_T("Failed to read waypoint file: %s"), path.c_str());
-    return false;
+  WaypointFileThread(Path _path,
+                     WaypointOrigin origin, const RasterTerrain *terrain)
+    :WaypointFileThread(_path, DetermineWaypointFileType(_path),
+                        origin, terrain) {}
+
+  /**
+   * Wait for the thread to finish and move the parsed waypoints to
+   * the given #Waypoints instance.
+   *
+   * @return true if the file was read successfully
+   */
+  bool Finish(Waypoints &dest);
+
+protected:
+  /* virtual methods from class Thread */
+  void Run() override {
+    NullOperationEnvironment operation;
+    success = ReadWaypointFile(path, file_type, waypoints, factory,
+                               operation);
   }
+};
+
+/**
+ * Move all waypoints from one #Waypoints instance to another, in the
+ * order in which they were appended to the source.  This assigns the
+ * same ids as reading the file directly into the destination would
+ * have assigned.
+ */
+static void
+MergeWaypoints(Waypoints &dest, Waypoints &src)
+{
+  std::vector<WaypointPtr> v(src.begin(), src.end());
+  std::sort(v.begin(), v.end(), [](const WaypointPtr &a, const WaypointPtr &b){
+      return a->id < b->id;
+    });
 
-  return true;
+  src.Clear();
+
+  for (auto &i : v)
+    dest.Append(std::move(i));
 }
 
-static bool
-LoadWaypointFile(Waypoints &waypoints, Path path,
-                 WaypointOrigin origin,
-                 const RasterTerrain *terrain, OperationEnvironment &operation)
+bool
+WaypointFileThread::Finish(Waypoints &dest)
 {
-  if (!ReadWaypointFile(path, waypoints,
-                        WaypointFactory(origin, terrain),
-                        operation)) {
+  if (IsDefined())
+    Join();
+
+  if (!success) {
     LogFormat(_T("Failed to read waypoint file: %s"), path.c_str());
     return false;
   }
 
+  MergeWaypoints(dest, waypoints);
   return true;
 }
 
@@ -95,27 +150,36 @@ WaypointGlue::LoadWaypoints(Waypoints &way_points,
   // Delete old waypoints
   way_points.Clear();
 
-  LoadWaypointFile(way_points, LocalPath(_T("user.cup")),
-                   WaypointFileType::SEEYOU,
-                   WaypointOrigin::USER, terrain, operation);
-
-  // ### FIRST FILE ###
-  auto path = Profile::GetPath(ProfileKeys::WaypointFile);
-  if (!path.IsNull())
-    found |= LoadWaypointFile(way_points, path, WaypointOrigin::PRIMARY,
-                              terrain, operation);
-
-  // ### SECOND FILE ###
-  path = Profile::GetPath(ProfileKeys::AdditionalWaypointFile);
-  if (!path.IsNull())
-    found |= LoadWaypointFile(way_points, path, WaypointOrigin::ADDITIONAL,
-                              terrain, operation);
-
-  // ### WATCHED WAYPOINT/THIRD FILE ###
-  path = Profile::GetPath(ProfileKeys::WatchedWaypointFile);
-  if (!path.IsNull())
-    found |= LoadWaypointFile(way_points, path, WaypointOrigin::WATCHED,
-                              terrain, operation);
+  /* parse all configured files in parallel, then merge them in the
+     traditional order to get stable waypoint ids */
+  WaypointFileThread user_thread(LocalPath(_T("user.cup")),
+                                 WaypointFileType::SEEYOU,
+                                 WaypointOrigin::USER, terrain);
+
+  static constexpr struct {
+    const char *key;
+    WaypointOrigin origin;
+  } files[] = {
+    // ### FIRST FILE ###
+    { ProfileKeys::WaypointFile, WaypointOrigin::PRIMARY },
+    // ### SECOND FILE ###
+    { ProfileKeys::AdditionalWaypointFile, WaypointOrigin::ADDITIONAL },
+    // ### WATCHED WAYPOINT/THIRD FILE ###
+    { ProfileKeys::WatchedWaypointFile, WaypointOrigin::WATCHED },
+  };
+
+  std::forward_list<WaypointFileThread> threads;
+  auto last = threads.before_begin();
+  for (const auto &i : files) {
+    const auto path = Profile::GetPath(i.key);
+    if (!path.IsNull())
+      last = threads.emplace_after(last, path, i.origin, terrain);
+  }
+
+  user_thread.Finish(way_points);
+
+  for (auto &i : threads)
+    found |= i.Finish(way_points);
 
   // ### MAP/FOURTH FILE ###
 
@@ -23,6 +23,7 @@ Copyright_License {
 
 #include "WaypointList.hpp"
 #include "Waypoint/Waypoint.hpp"
+#include "Geo/Math.hpp"
 
 #include <algorithm>
 
@@ -54,6 +55,26 @@ public:
   }
 };
 
+void
+WaypointList::UpdateVectors(const GeoPoint &location)
+{
+  const unsigned n = size();
+
+  std::vector<GeoPoint> points;
+  points.reserve(n);
+  for (const auto &i : *this)
+    points.push_back(i.waypoint->location);
+
+  std::vector<double> distances(n);
+  std::vector<Angle> bearings(n);
+  DistanceBearing(location, points.data(), n,
+                  distances.data(), bearings.data());
+
+  for (unsigned i = 0; i < n; ++i)
+    (*this)[i].vec = GeoVector(distances[i], bearings[i]);
+}
+
 void WaypointList::SortByDistance(const GeoPoint &location) {
+  UpdateVectors(location);
   std::sort(begin(), end(), WaypointDistanceCompare(location));
 }
@@ -37,6 +37,8 @@ struct WaypointListItem
   WaypointPtr waypoint;
 
 private:
+  friend class WaypointList;
+
   /** From observer to waypoint */
   mutable GeoVector vec = GeoVector::Invalid();
 
@@ -52,6 +54,12 @@ public:
 class WaypointList: public std::vector<WaypointListItem>
 {
 public:
+  /**
+   * Calculate the vectors from the given location to all waypoints
+   * in one batch (see the array version of DistanceBearing()).
+   */
+  void UpdateVectors(const GeoPoint &location);
+
   void SortByDistance(const GeoPoint &location);
 };
 
@@ -26,6 +26,8 @@ Copyright_License {
 #include "WaypointFilter.hpp"
 #include "Engine/Waypoint/Waypoints.hpp"
 
+#include <algorithm>
+
 void WaypointListBuilder::Visit(const Waypoints &waypoints) {
   if (filter.distance > 0)
     waypoints.VisitWithinRange(location, filter.distance, *this);
@@ -33,6 +35,17 @@ void WaypointListBuilder::Visit(const Waypoints &waypoints) {
     waypoints.VisitNamePrefix(filter.name, *this);
 }
 
+void
+WaypointListBuilder::Refine()
+{
+  list.erase(std::remove_if(list.begin(), list.end(),
+                            [this](const WaypointListItem &item){
+                              return !filter.Matches(*item.waypoint, location,
+                                                     triangle_validator);
+                            }),
+             list.end());
+}
+
 void
 WaypointListBuilder::Visit(const WaypointPtr &waypoint)
 {
@@ -47,6 +47,14 @@ public:
 
   void Visit(const Waypoints &waypoints);
 
+  /**
+   * Remove all items from the list which do not match the filter.
+   * This is cheaper than building a new list if the filter has only
+   * become narrower since the list was built (e.g. a letter was
+   * appended to the name), and it preserves the order of the list.
+   */
+  void Refine();
+
   /* virtual methods from class WaypointVisitor */
   void Visit(const WaypointPtr &waypoint) override;
 };
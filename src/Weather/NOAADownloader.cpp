@@ -138,22 +138,48 @@ NOAADownloader::ParseDecodedDateTime(const char *buffer, BrokenDateTime &dest)
   return true;
 }
 
-bool
-NOAADownloader::DownloadMETAR(const char *code, METAR &metar,
-                              Net::Session &session, JobRunner &runner)
-{
 #ifndef NDEBUG
+static void
+AssertValidCode(const char *code)
+{
   assert(strlen(code) == 4);
   for (unsigned i = 0; i < 4; i++)
     assert((code[i] >= 'A' && code[i] <= 'Z') ||
            (code[i] >= '0' && code[i] <= '9'));
+}
 #endif
 
-  // Build file url
-  char url[256];
-  snprintf(url, sizeof(url),
+void
+NOAADownloader::MakeMETARURL(char *buffer, size_t size, const char *code)
+{
+#ifndef NDEBUG
+  AssertValidCode(code);
+#endif
+
+  snprintf(buffer, size,
            "http://tgftp.nws.noaa.gov/data/observations/metar/decoded/%s.TXT",
            code);
+}
+
+void
+NOAADownloader::MakeTAFURL(char *buffer, size_t size, const char *code)
+{
+#ifndef NDEBUG
+  AssertValidCode(code);
+#endif
+
+  snprintf(buffer, size,
+           "http://tgftp.nws.noaa.gov/data/forecasts/taf/stations/%s.TXT",
+           code);
+}
+
+bool
+NOAADownloader::DownloadMETAR(const char *code, METAR &metar,
+                              Net::Session &session, JobRunner &runner)
+{
+  // Build file url
+  char url[256];
+  MakeMETARURL(url, sizeof(url), code);
 
   // Request the file
   char buffer[4096];
@@ -163,6 +189,12 @@ NOAADownloader::DownloadMETAR(const char *code, METAR &metar,
 
   buffer[job.GetLength()] = 0;
 
+  return ParseMETAR(buffer, metar);
+}
+
+bool
+NOAADownloader::ParseMETAR(char *buffer, METAR &metar)
+{
   /*
    * Example:
    *
@@ -236,18 +268,9 @@ bool
 NOAADownloader::DownloadTAF(const char *code, TAF &taf,
                             Net::Session &session, JobRunner &runner)
 {
-#ifndef NDEBUG
-  assert(strlen(code) == 4);
-  for (unsigned i = 0; i < 4; i++)
-    assert((code[i] >= 'A' && code[i] <= 'Z') ||
-           (code[i] >= '0' && code[i] <= '9'));
-#endif
-
   // Build file url
   char url[256];
-  snprintf(url, sizeof(url),
-           "http://tgftp.nws.noaa.gov/data/forecasts/taf/stations/%s.TXT",
-           code);
+  MakeTAFURL(url, sizeof(url), code);
 
   // Request the file
   char buffer[4096];
@@ -257,6 +280,12 @@ NOAADownloader::DownloadTAF(const char *code, TAF &taf,
 
   buffer[job.GetLength()] = 0;
 
+  return ParseTAF(buffer, taf);
+}
+
+bool
+NOAADownloader::ParseTAF(const char *buffer, TAF &taf)
+{
   /*
    * Example:
    *
@@ -24,6 +24,8 @@ Copyright_License {
 #ifndef NOAA_DOWNLOADER_HPP
 #define NOAA_DOWNLOADER_HPP
 
+#include <stddef.h>
+
 struct METAR;
 struct TAF;
 class JobRunner;
@@ -34,6 +36,32 @@ namespace Net {
 
 namespace NOAADownloader
 {
+  /**
+   * Build the URL of the decoded METAR file of the given station.
+   */
+  void MakeMETARURL(char *buffer, size_t size, const char *code);
+
+  /**
+   * Build the URL of the TAF file of the given station.
+   */
+  void MakeTAFURL(char *buffer, size_t size, const char *code);
+
+  /**
+   * Parse the contents of a METAR file downloaded from the URL built
+   * by MakeMETARURL().  The buffer is modified.
+   *
+   * @return true if the METAR was parsed successfully and is recent
+   */
+  bool ParseMETAR(char *buffer, METAR &metar);
+
+  /**
+   * Parse the contents of a TAF file downloaded from the URL built by
+   * MakeTAFURL().
+   *
+   * @return true if the TAF was parsed successfully and is recent
+   */
+  bool ParseTAF(const char *buffer, TAF &taf);
+
   /**
    * Downloads a METAR from the NOAA server
    * @param code Four letter code of the airport (upper case)
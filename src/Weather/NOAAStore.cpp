@@ -90,6 +90,8 @@ NOAAStore::AddStation(const char *code)
   item.parsed_metar_available = false;
   item.taf_available = false;
 
+  item.metar_modified = item.taf_modified = 0;
+
   stations.push_back(item);
   return --end();
 }
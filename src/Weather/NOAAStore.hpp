@@ -30,6 +30,8 @@ Copyright_License {
 
 #include <list>
 
+#include <stdint.h>
+
 #ifdef _UNICODE
 #include <tchar.h>
 #endif
@@ -49,6 +51,13 @@ public:
     ParsedMETAR parsed_metar;
     TAF taf;
 
+    /**
+     * The "Last-Modified" times of the files on the server which
+     * #metar and #taf were parsed from, in seconds since the epoch;
+     * 0 if unknown.  Used to skip unchanged reports.
+     */
+    int64_t metar_modified, taf_modified;
+
     /**
      * Returns the four letter code as a TCHAR string.  This may
      * return a pointer to a static buffer, and consecutive calls
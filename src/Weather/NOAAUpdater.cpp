@@ -25,67 +25,211 @@ Copyright_License {
 #include "NOAADownloader.hpp"
 #include "METARParser.hpp"
 #include "Net/HTTP/Session.hpp"
+#include "Net/HTTP/Request.hpp"
+#include "Net/HTTP/Handler.hpp"
+#include "Job/Job.hpp"
+#include "Job/Runner.hpp"
+#include "Operation/Operation.hpp"
 #include "LogFile.hpp"
 
+#include <algorithm>
 #include <exception>
+#include <list>
+#include <vector>
+
+#include <string.h>
 
 namespace NOAAUpdater {
-  static bool Update(NOAAStore::Item &item,
-                     Net::Session &session, JobRunner &runner);
+  /**
+   * The maximum number of HTTP requests which are in flight at the
+   * same time.
+   */
+  static constexpr unsigned MAX_CONCURRENT = 8;
+
+  /**
+   * Collects one response body.  Unlike Net::DownloadToBuffer(), it
+   * never throws, because it may be invoked while another request of
+   * the same session is being waited for.
+   */
+  class BufferHandler final : public Net::ResponseHandler {
+    char buffer[4096];
+    size_t length = 0;
+
+  public:
+    char *Finish() {
+      buffer[length] = 0;
+      return buffer;
+    }
+
+    /* virtual methods from class Net::ResponseHandler */
+    void ResponseReceived(int64_t content_length) override {}
+
+    void DataReceived(const void *data, size_t size) override {
+      const size_t remaining = sizeof(buffer) - 1 - length;
+      if (size > remaining)
+        size = remaining;
+
+      memcpy(buffer + length, data, size);
+      length += size;
+    }
+  };
+
+  struct Transfer {
+    NOAAStore::Item &item;
+    const bool taf;
+
+    BufferHandler handler;
+    Net::Request request;
+
+    Transfer(Net::Session &session, NOAAStore::Item &_item, bool _taf,
+             const char *url)
+      :item(_item), taf(_taf), request(session, handler, url) {
+      const bool available = taf ? item.taf_available : item.metar_available;
+      request.SetIfModifiedSince(available
+                                 ? (taf ? item.taf_modified : item.metar_modified)
+                                 : 0);
+    }
+
+    /**
+     * Wait for the response and store the report in the
+     * #NOAAStore::Item.
+     */
+    bool Finish();
+  };
+
+  /**
+   * Downloads the METARs and TAFs of all given stations.  The
+   * requests are submitted in batches to one session, so their
+   * transfers run in parallel, and parsing runs in the job thread.
+   */
+  class UpdateJob final : public Job {
+    const std::vector<NOAAStore::Item *> items;
+    bool result = true;
+
+  public:
+    explicit UpdateJob(std::vector<NOAAStore::Item *> &&_items)
+      :items(std::move(_items)) {}
+
+    bool GetResult() const {
+      return result;
+    }
+
+    /* virtual methods from class Job */
+    void Run(OperationEnvironment &env) override;
+  };
+
+  static bool Update(std::vector<NOAAStore::Item *> &&items,
+                     JobRunner &runner);
 }
 
 bool
-NOAAUpdater::Update(NOAAStore::Item &item,
-                    Net::Session &session, JobRunner &runner)
+NOAAUpdater::Transfer::Finish()
 {
-  bool metar_downloaded = NOAADownloader::DownloadMETAR(item.code, item.metar,
-                                                        session, runner);
-  if (metar_downloaded) {
+  request.Send(10000);
+
+  if (request.IsNotModified())
+    /* keep the report we already have */
+    return true;
+
+  const int64_t modified = std::max(request.GetLastModified(), int64_t(0));
+  char *buffer = handler.Finish();
+
+  if (taf) {
+    if (!NOAADownloader::ParseTAF(buffer, item.taf))
+      return false;
+
+    item.taf_available = true;
+    item.taf_modified = modified;
+  } else {
+    if (!NOAADownloader::ParseMETAR(buffer, item.metar))
+      return false;
+
     item.metar_available = true;
+    item.metar_modified = modified;
 
     if (METARParser::Parse(item.metar, item.parsed_metar))
       item.parsed_metar_available = true;
   }
 
-  bool taf_downloaded = NOAADownloader::DownloadTAF(item.code, item.taf,
-                                                    session, runner);
-  if (taf_downloaded)
-    item.taf_available = true;
-
-  return metar_downloaded && taf_downloaded;
+  return true;
 }
 
-bool
-NOAAUpdater::Update(NOAAStore &store, JobRunner &runner)
+void
+NOAAUpdater::UpdateJob::Run(OperationEnvironment &env)
 {
-  try {
-    Net::Session session;
+  Net::Session session;
+
+  const unsigned n_transfers = items.size() * 2;
+  env.SetProgressRange(n_transfers);
+
+  unsigned next = 0;
+  while (next < n_transfers) {
+    if (env.IsCancelled()) {
+      result = false;
+      return;
+    }
+
+    /* submit a batch of requests first; each Send() call drives all
+       transfers of the session */
+    std::list<Transfer> batch;
+    for (unsigned end = std::min(next + MAX_CONCURRENT, n_transfers);
+         next < end; ++next) {
+      NOAAStore::Item &item = *items[next / 2];
+      const bool taf = next % 2 != 0;
+
+      char url[256];
+      if (taf)
+        NOAADownloader::MakeTAFURL(url, sizeof(url), item.code);
+      else
+        NOAADownloader::MakeMETARURL(url, sizeof(url), item.code);
 
-    bool result = true;
-    for (auto &i : store) {
       try {
-        result = Update(i, session, runner) && result;
+        batch.emplace_back(session, item, taf, url);
       } catch (const std::exception &exception) {
         LogError(exception);
         result = false;
       }
     }
 
-    return result;
-  } catch (const std::exception &exception) {
-    LogError(exception);
-    return false;
+    for (auto &i : batch) {
+      try {
+        if (!i.Finish())
+          result = false;
+      } catch (const std::exception &exception) {
+        LogError(exception);
+        result = false;
+      }
+    }
+
+    env.SetProgressPosition(next);
   }
 }
 
 bool
-NOAAUpdater::Update(NOAAStore::Item &item, JobRunner &runner)
+NOAAUpdater::Update(std::vector<NOAAStore::Item *> &&items,
+                    JobRunner &runner)
 {
   try {
-    Net::Session session;
-    return Update(item, session, runner);
+    UpdateJob job(std::move(items));
+    return runner.Run(job) && job.GetResult();
   } catch (const std::exception &exception) {
     LogError(exception);
     return false;
   }
 }
+
+bool
+NOAAUpdater::Update(NOAAStore &store, JobRunner &runner)
+{
+  std::vector<NOAAStore::Item *> items;
+  for (auto &i : store)
+    items.push_back(&i);
+
+  return Update(std::move(items), runner);
+}
+
+bool
+NOAAUpdater::Update(NOAAStore::Item &item, JobRunner &runner)
+{
+  return Update(std::vector<NOAAStore::Item *>{&item}, runner);
+}
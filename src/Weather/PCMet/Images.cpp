@@ -27,11 +27,20 @@ Copyright_License {
 #include "Net/HTTP/Session.hpp"
 #include "Net/HTTP/ToBuffer.hpp"
 #include "Net/HTTP/ToFile.hpp"
+#include "Job/Job.hpp"
 #include "Job/Runner.hpp"
 #include "LocalPath.hpp"
 #include "OS/FileUtil.hpp"
 #include "Util/ConvertString.hpp"
 
+#if !defined(ANDROID) && !defined(USE_GDI)
+/* with these screen libraries, an image file can be decoded without
+   touching the screen, i.e. in the job thread */
+#define DECODE_IN_JOB
+#include "Screen/Custom/ImageDecoder.hpp"
+#include "Screen/Custom/UncompressedImage.hpp"
+#endif
+
 #include <stdexcept>
 
 #include <string.h>
@@ -98,10 +107,89 @@ const PCMet::ImageType PCMet::image_types[] = {
   { nullptr, nullptr, nullptr },
 };
 
-Bitmap
-PCMet::DownloadLatestImage(const char *type, const char *area,
-                           const PCMetSettings &settings,
-                           JobRunner &runner)
+bool
+PCMet::ImageCache::Contains(Path path) const
+{
+  for (const auto &i : items)
+    if (i.first == path)
+      return true;
+
+  return false;
+}
+
+const Bitmap *
+PCMet::ImageCache::Get(Path path)
+{
+  for (auto i = items.begin(); i != items.end(); ++i) {
+    if (i->first == path) {
+      items.splice(items.begin(), items, i);
+      return &i->second;
+    }
+  }
+
+  return nullptr;
+}
+
+const Bitmap &
+PCMet::ImageCache::Put(AllocatedPath &&path, Bitmap &&bitmap)
+{
+  if (items.size() >= MAX_SIZE)
+    items.pop_back();
+
+  items.emplace_front(std::move(path), std::move(bitmap));
+  return items.front().second;
+}
+
+namespace PCMet {
+
+/**
+ * Downloads the HTML page which refers to the latest image, then
+ * the image itself, and decodes it.
+ */
+class LatestImageJob final : public Job {
+  const char *const type, *const area;
+  const PCMetSettings &settings;
+
+  const ImageCache &cache;
+
+  AllocatedPath path;
+
+#ifdef DECODE_IN_JOB
+  UncompressedImage image;
+#endif
+
+public:
+  LatestImageJob(const char *_type, const char *_area,
+                 const PCMetSettings &_settings,
+                 const ImageCache &_cache)
+    :type(_type), area(_area), settings(_settings), cache(_cache),
+     path(nullptr) {}
+
+  /**
+   * Returns the path of the image file or nullptr on error.
+   */
+  AllocatedPath &GetPath() {
+    return path;
+  }
+
+#ifdef DECODE_IN_JOB
+  /**
+   * Returns the decoded image; undefined if it was already in the
+   * #ImageCache.
+   */
+  UncompressedImage &GetImage() {
+    return image;
+  }
+#endif
+
+  /* virtual methods from class Job */
+  void Run(OperationEnvironment &env) override;
+};
+
+}
+
+void
+PCMet::LatestImageJob::Run(OperationEnvironment &env)
 {
   const WideToUTF8Converter username(settings.www_credentials.username);
   const WideToUTF8Converter password(settings.www_credentials.password);
@@ -115,51 +203,82 @@ PCMet::DownloadLatestImage(const char *type, const char *area,
 
   // download the HTML page
   char buffer[65536];
-  Net::DownloadToBufferJob job(session, url, buffer, sizeof(buffer) - 1);
-  job.SetBasicAuth(username, password);
-  if (!runner.Run(job))
-    return Bitmap();
+  size_t length = Net::DownloadToBuffer(session, url, username, password,
+                                        buffer, sizeof(buffer) - 1, env);
+  if (length == size_t(-1))
+    return;
 
-  buffer[job.GetLength()] = 0;
+  buffer[length] = 0;
 
   static constexpr char img_needle[] = "<img name=\"bild\" src=\"/";
   char *img = strstr(buffer, "<img name=\"bild\" src=\"/");
   if (img == nullptr)
-    return Bitmap();
+    return;
 
   char *src = img + sizeof(img_needle) - 2;
   char *end = strchr(src + 1, '"');
   if (end == nullptr)
-    return Bitmap();
+    return;
 
   *end = 0;
 
   const char *slash = strrchr(src, '/');
   if (slash == nullptr || slash[1] == 0)
-    return Bitmap();
+    return;
 
   const char *name = slash + 1;
 
   // TODO: verify file name
 
   const auto cache_path = MakeLocalPath(_T("pc_met"));
-  const auto path = AllocatedPath::Build(cache_path,
-                                         UTF8ToWideConverter(name));
+  auto new_path = AllocatedPath::Build(cache_path,
+                                       UTF8ToWideConverter(name));
 
-  if (!File::Exists(path)) {
+  if (!File::Exists(new_path)) {
     snprintf(url, sizeof(url), PCMET_URI "%s", src);
 
-    Net::DownloadToFileJob job2(session, url, path);
-    job2.SetBasicAuth(username, password);
-    if (!runner.Run(job2))
-      return Bitmap();
+    if (!Net::DownloadToFile(session, url, username, password,
+                             new_path, nullptr, env))
+      return;
   }
 
+#ifdef DECODE_IN_JOB
+  /* the cache is only modified by the main thread after this job has
+     finished */
+  if (!cache.Contains(new_path))
+    image = DecompressImageFile(new_path);
+#endif
+
+  path = std::move(new_path);
+}
+
+const Bitmap *
+PCMet::DownloadLatestImage(const char *type, const char *area,
+                           const PCMetSettings &settings,
+                           ImageCache &cache,
+                           JobRunner &runner)
+{
+  LatestImageJob job(type, area, settings, cache);
+  if (!runner.Run(job) || job.GetPath().IsNull())
+    return nullptr;
+
+  const Bitmap *cached = cache.Get(job.GetPath());
+  if (cached != nullptr)
+    return cached;
+
   Bitmap bitmap;
   try {
-    bitmap.LoadFile(path);
+#ifdef DECODE_IN_JOB
+    if (!job.GetImage().IsDefined() ||
+        !bitmap.Load(std::move(job.GetImage())))
+      return nullptr;
+#else
+    if (!bitmap.LoadFile(job.GetPath()))
+      return nullptr;
+#endif
   } catch (const std::runtime_error &e) {
+    return nullptr;
   }
 
-  return bitmap;
+  return &cache.Put(std::move(job.GetPath()), std::move(bitmap));
 }
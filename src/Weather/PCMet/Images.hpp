@@ -24,11 +24,17 @@ Copyright_License {
 #ifndef XCSOAR_PCMET_IMAGES_HPP
 #define XCSOAR_PCMET_IMAGES_HPP
 
+#include "OS/Path.hpp"
+#include "Screen/Bitmap.hpp"
+#include "Compiler.h"
+
+#include <list>
+#include <utility>
+
 #include <tchar.h>
 
 struct PCMetSettings;
 class JobRunner;
-class Bitmap;
 
 namespace PCMet {
   struct ImageArea {
@@ -45,9 +51,49 @@ namespace PCMet {
 
   extern const ImageType image_types[];
 
-  Bitmap DownloadLatestImage(const char *type, const char *area,
-                             const PCMetSettings &settings,
-                             JobRunner &runner);
+  /**
+   * Keeps the most recently shown images decoded in memory, so
+   * showing one of them again needs neither a download nor a
+   * decoder run.  The downloaded files (which are named after the
+   * time of the image) are cached on disk in the "pc_met" directory.
+   *
+   * Must be used only in the main thread.
+   */
+  class ImageCache {
+    static constexpr unsigned MAX_SIZE = 4;
+
+    /**
+     * Most recently used first.
+     */
+    std::list<std::pair<AllocatedPath, Bitmap>> items;
+
+  public:
+    gcc_pure
+    bool Contains(Path path) const;
+
+    /**
+     * Look up a decoded image and mark it as recently used.
+     *
+     * @return the bitmap or nullptr if it is not in the cache
+     */
+    const Bitmap *Get(Path path);
+
+    const Bitmap &Put(AllocatedPath &&path, Bitmap &&bitmap);
+  };
+
+  /**
+   * Find the latest image of the given type and area, download it
+   * unless it is already in the disk cache, and decode it.  All of
+   * this happens in the thread of the given #JobRunner (except on
+   * platforms where bitmaps must be decoded in the main thread).
+   *
+   * @return the bitmap (owned by the #ImageCache) or nullptr on
+   * error
+   */
+  const Bitmap *DownloadLatestImage(const char *type, const char *area,
+                                    const PCMetSettings &settings,
+                                    ImageCache &cache,
+                                    JobRunner &runner);
 };
 
 #endif
@@ -152,7 +152,9 @@ PCMet::DownloadOverlay(const OverlayInfo &info, BrokenDateTime now_utc,
   auto path = AllocatedPath::Build(cache_path,
                                    UTF8ToWideConverter(url.c_str() + sizeof(PCMET_FTP)));
 
-  {
+  /* the file name contains the product and the model run, i.e. a
+     file which has already been downloaded never changes */
+  if (!File::Exists(path) || File::GetSize(path) == 0) {
     const WideToUTF8Converter username(settings.ftp_credentials.username);
     const WideToUTF8Converter password(settings.ftp_credentials.password);
 
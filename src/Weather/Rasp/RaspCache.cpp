@@ -28,6 +28,10 @@ Copyright_License {
 #include "Language/Language.hpp"
 #include "OS/Path.hpp"
 #include "IO/ZipArchive.hpp"
+#include "Projection/WindowProjection.hpp"
+#include "Operation/Operation.hpp"
+
+#include <stdexcept>
 
 #include <assert.h>
 #include <windef.h> // for MAX_PATH
@@ -38,6 +42,18 @@ ToHalfHours(BrokenTime t)
   return t.hour * 2u + t.minute / 30;
 }
 
+RaspCache::RaspCache(const RaspStore &_store, unsigned _parameter)
+  :store(_store), parameter(_parameter),
+   prefetch_time(RaspStore::MAX_WEATHER_TIMES) {}
+
+RaspCache::~RaspCache()
+{
+  /* don't let a running prefetch access this object after it has
+     been destroyed */
+  prefetch_group.Wait();
+  Close();
+}
+
 const TCHAR *
 RaspCache::GetMapName() const
 {
@@ -74,6 +90,113 @@ RaspCache::IsInside(GeoPoint p) const
   return map != nullptr && map->IsInside(p);
 }
 
+RaspCache::CachedMap *
+RaspCache::FindCachedMap(unsigned time_index)
+{
+  for (auto &i : maps)
+    if (i.map && i.time == time_index)
+      return &i;
+
+  return nullptr;
+}
+
+RaspCache::CachedMap &
+RaspCache::GetFreeSlot()
+{
+  CachedMap *oldest = &maps[0];
+  for (auto &i : maps) {
+    if (!i.map)
+      return i;
+
+    if (i.last_used < oldest->last_used)
+      oldest = &i;
+  }
+
+  oldest->map.reset();
+  return *oldest;
+}
+
+bool
+RaspCache::MakeFileName(char *buffer, unsigned time_index) const
+{
+  return store.NarrowWeatherFilename(buffer,
+                                     Path(store.GetItemInfo(parameter).name),
+                                     time_index);
+}
+
+std::unique_ptr<RasterMap>
+RaspCache::LoadMap(ZipArchive &_archive, unsigned time_index,
+                   GeoPoint location, double radius,
+                   OperationEnvironment &operation) const
+{
+  char name[MAX_PATH];
+  if (!MakeFileName(name, time_index))
+    return nullptr;
+
+  std::unique_ptr<RasterMap> new_map(new RasterMap());
+  if (!LoadTerrainOverview(_archive.get(), name, nullptr,
+                           new_map->GetTileCache(),
+                           false, operation))
+    return nullptr;
+
+  new_map->UpdateProjection();
+
+  if (location.IsValid()) {
+    /* the map is private to the caller, therefore the mutex doesn't
+       need to be shared */
+    SharedMutex mutex;
+    UpdateTerrainTiles(_archive.get(), name, new_map->GetTileCache(), mutex,
+                       new_map->GetProjection(), location, radius);
+  }
+
+  return new_map;
+}
+
+void
+RaspCache::SchedulePrefetch(unsigned time_index)
+{
+  unsigned next = RaspStore::MAX_WEATHER_TIMES;
+  for (unsigned t = time_index + 1; t < RaspStore::MAX_WEATHER_TIMES; ++t) {
+    if (store.IsTimeAvailable(parameter, t)) {
+      next = t;
+      break;
+    }
+  }
+
+  if (next == RaspStore::MAX_WEATHER_TIMES || FindCachedMap(next) != nullptr)
+    return;
+
+  {
+    const ScopeLock protect(prefetch_mutex);
+    if (prefetch_time == next)
+      /* already pending or finished */
+      return;
+
+    prefetch_time = next;
+    prefetch_map.reset();
+  }
+
+  const GeoPoint location = view_location;
+  const double radius = view_radius;
+
+  prefetch_group.Submit([this, next, location, radius](){
+      std::unique_ptr<RasterMap> new_map;
+
+      try {
+        auto prefetch_archive = store.OpenArchive();
+        NullOperationEnvironment env;
+        new_map = LoadMap(*prefetch_archive, next, location, radius, env);
+      } catch (const std::runtime_error &) {
+        /* ignore; Reload() will try again in the foreground and fail
+           there */
+      }
+
+      const ScopeLock protect(prefetch_mutex);
+      if (prefetch_time == next)
+        prefetch_map = std::move(new_map);
+    }, TaskPool::Priority::LOW);
+}
+
 void
 RaspCache::Reload(BrokenTime time_local, OperationEnvironment &operation)
 {
@@ -99,32 +222,83 @@ RaspCache::Reload(BrokenTime time_local, OperationEnvironment &operation)
   if (effective_time == RaspStore::MAX_WEATHER_TIMES)
     return;
 
-  Close();
-
-  auto archive = store.OpenArchive();
-  if (!archive)
+  if (map != nullptr && map_time == effective_time)
     return;
 
-  char new_name[MAX_PATH];
-  store.NarrowWeatherFilename(new_name, Path(store.GetItemInfo(parameter).name),
-                              effective_time);
+  map = nullptr;
 
-  RasterMap *new_map = new RasterMap();
-  if (!LoadTerrainOverview(archive->get(), new_name, nullptr,
-                           new_map->GetTileCache(),
-                           true, operation)) {
-    delete new_map;
-    return;
+  CachedMap *cached = FindCachedMap(effective_time);
+  if (cached == nullptr) {
+    std::unique_ptr<RasterMap> new_map;
+
+    bool pending;
+    {
+      const ScopeLock protect(prefetch_mutex);
+      pending = prefetch_time == effective_time && !prefetch_map;
+    }
+
+    if (pending)
+      /* the background task is decoding this slot right now; the
+         rest of its work is less than starting over */
+      prefetch_group.Wait();
+
+    {
+      const ScopeLock protect(prefetch_mutex);
+      if (prefetch_time == effective_time) {
+        new_map = std::move(prefetch_map);
+        prefetch_time = RaspStore::MAX_WEATHER_TIMES;
+      }
+    }
+
+    if (!new_map) {
+      if (!archive)
+        archive = store.OpenArchive();
+
+      new_map = LoadMap(*archive, effective_time,
+                        GeoPoint::Invalid(), 0, operation);
+      if (!new_map)
+        return;
+    }
+
+    cached = &GetFreeSlot();
+    cached->map = std::move(new_map);
+    cached->time = effective_time;
   }
 
-  new_map->UpdateProjection();
+  cached->last_used = ++use_counter;
+  map = cached->map.get();
+  map_time = effective_time;
 
-  map = new_map;
+  SchedulePrefetch(effective_time);
+}
+
+bool
+RaspCache::UpdateTiles(const WindowProjection &projection)
+{
+  if (map == nullptr)
+    return false;
+
+  view_location = projection.GetGeoScreenCenter();
+  view_radius = projection.GetScreenDistanceMeters();
+
+  if (!archive)
+    archive = store.OpenArchive();
+
+  char name[MAX_PATH];
+  if (!MakeFileName(name, map_time))
+    return false;
+
+  auto &tile_cache = map->GetTileCache();
+  UpdateTerrainTiles(archive->get(), name, tile_cache, tile_mutex,
+                     map->GetProjection(), view_location, view_radius);
+  return map->IsDirty();
 }
 
 void
 RaspCache::Close()
 {
-  delete map;
   map = nullptr;
+
+  for (auto &i : maps)
+    i.map.reset();
 }
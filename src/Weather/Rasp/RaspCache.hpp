@@ -24,21 +24,54 @@ Copyright_License {
 #ifndef XCSOAR_WEATHER_RASP_CACHE_HPP
 #define XCSOAR_WEATHER_RASP_CACHE_HPP
 
+#include "Geo/GeoPoint.hpp"
+#include "Thread/Mutex.hpp"
+#include "Thread/SharedMutex.hpp"
+#include "Thread/TaskPool.hpp"
 #include "Compiler.h"
 
+#include <memory>
+
 #include <tchar.h>
 
 struct BrokenTime;
-struct GeoPoint;
 class RaspStore;
 class RasterMap;
+class ZipArchive;
+class WindowProjection;
 class OperationEnvironment;
 
 /**
  * Class to manage the raster weather map, to be loaded/selected from
  * a #RaspStore instance.
+ *
+ * Only the overview of each map is decoded by Reload(); the tiles
+ * are decoded on demand by UpdateTiles() as they become visible.
+ * The most recently used time slots are kept, and the next available
+ * time slot is decoded in the background, so stepping through the
+ * forecast does not hit the ZIP file each time.
  */
 class RaspCache {
+  /**
+   * The number of decoded time slots kept in memory.
+   */
+  static constexpr unsigned MAX_CACHED_MAPS = 4;
+
+  struct CachedMap {
+    std::unique_ptr<RasterMap> map;
+
+    /**
+     * The time index of this map; only valid if #map is set.
+     */
+    unsigned time;
+
+    /**
+     * The value of #use_counter when this map was last selected;
+     * the smallest one gets evicted.
+     */
+    unsigned last_used;
+  };
+
   const RaspStore &store;
 
   const unsigned parameter;
@@ -46,18 +79,71 @@ class RaspCache {
   unsigned time = 0;
   unsigned last_time = 0;
 
+  CachedMap maps[MAX_CACHED_MAPS];
+
+  unsigned use_counter = 0;
+
+  /**
+   * The currently selected map, or nullptr.  Points into #maps.
+   */
   RasterMap *map = nullptr;
 
+  /**
+   * The time index of #map.
+   */
+  unsigned map_time;
+
+  /**
+   * The open RASP archive, used by UpdateTiles() to decode tiles of
+   * the current map.  Opened on demand.
+   */
+  std::unique_ptr<ZipArchive> archive;
+
+  /**
+   * Passed to the terrain loader; all maps in #maps are only
+   * accessed by the thread which owns this object.
+   */
+  SharedMutex tile_mutex;
+
+  /**
+   * The screen location and radius [m] of the most recent
+   * UpdateTiles() call, used to decode the right tiles in the
+   * background.
+   */
+  GeoPoint view_location = GeoPoint::Invalid();
+  double view_radius = 0;
+
+  /**
+   * Protects #prefetch_map and #prefetch_time.
+   */
+  Mutex prefetch_mutex;
+
+  /**
+   * A map decoded by the background task, waiting to be moved into
+   * #maps by Reload().
+   */
+  std::unique_ptr<RasterMap> prefetch_map;
+
+  /**
+   * The time index of the pending or finished prefetch, or
+   * RaspStore::MAX_WEATHER_TIMES if there is none.
+   */
+  unsigned prefetch_time;
+
+  /**
+   * Runs the background prefetch.  Declared last, so its destructor
+   * waits for a running task before the other attributes are
+   * destroyed.
+   */
+  TaskGroup prefetch_group;
+
 public:
   /** 
    * Default constructor
    */
-  RaspCache(const RaspStore &_store, unsigned _parameter)
-    :store(_store), parameter(_parameter) {}
+  RaspCache(const RaspStore &_store, unsigned _parameter);
 
-  ~RaspCache() {
-    Close();
-  }
+  ~RaspCache();
 
   const RaspStore &GetStore() const {
     return store;
@@ -97,6 +183,14 @@ public:
    */
   void Reload(BrokenTime time_local, OperationEnvironment &operation);
 
+  /**
+   * Decode the tiles of the current map which are visible in the
+   * given projection.
+   *
+   * @return true if the map contains new data
+   */
+  bool UpdateTiles(const WindowProjection &projection);
+
   /**
    * Returns the current time index.
    */
@@ -109,6 +203,26 @@ public:
   void SetTime(BrokenTime t);
 
 private:
+  CachedMap *FindCachedMap(unsigned time_index);
+  CachedMap &GetFreeSlot();
+
+  bool MakeFileName(char *buffer, unsigned time_index) const;
+
+  /**
+   * Decode the overview of the given time slot (and the tiles around
+   * #view_location, if known) from a new handle to the archive.
+   */
+  std::unique_ptr<RasterMap> LoadMap(ZipArchive &_archive,
+                                     unsigned time_index,
+                                     GeoPoint location, double radius,
+                                     OperationEnvironment &operation) const;
+
+  /**
+   * Start decoding the next available time slot after the given one
+   * in the background, unless it is already cached.
+   */
+  void SchedulePrefetch(unsigned time_index);
+
   void Close();
 };
 
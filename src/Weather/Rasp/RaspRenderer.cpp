@@ -59,12 +59,20 @@ RaspRenderer::Generate(const WindowProjection &projection,
     /* not visible */
     return false;
 
+  /* decode the visible tiles which have not been loaded yet */
+  cache.UpdateTiles(projection);
+
   if (color_ramp != last_color_ramp) {
     raster_renderer.PrepareColorTable(color_ramp, do_water,
                                       height_scale, interp_levels);
     last_color_ramp = color_ramp;
   }
 
+#ifdef ENABLE_OPENGL
+  /* the RaspCache may replace the map at any time */
+  raster_renderer.FlushHeightCache();
+#endif
+
   raster_renderer.ScanMap(*map, projection);
 
   raster_renderer.GenerateImage(false, height_scale,
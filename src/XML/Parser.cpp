@@ -34,6 +34,7 @@
 #include "Util/NumberParser.hpp"
 #include "IO/FileLineReader.hpp"
 
+#include <algorithm>
 #include <stdexcept>
 
 #include <assert.h>
@@ -47,6 +48,12 @@ namespace XML {
     const TCHAR *lpEndTag;
     size_t cbEndTag;
     bool nFirst;
+
+    /**
+     * Scratch buffer for decoding strings with entities, reused for
+     * the whole document.
+     */
+    tstring buffer;
   };
 
   /** Enumeration used to decipher what type a token is. */
@@ -105,38 +112,36 @@ namespace XML {
  *
  * @param ss string
  * @param lo length of string
- * @return new allocated string converted from xml
+ * @param dest the string the result is appended to
+ * @return false if the string contains an invalid entity
  */
-static TCHAR *
-FromXMLString(const TCHAR *ss, size_t lo)
+static bool
+FromXMLString(const TCHAR *ss, size_t lo, tstring &dest)
 {
   assert(ss != nullptr);
 
   const TCHAR *end = ss + lo;
 
-  /* allocate a buffer with the size of the input string; we know for
-     sure that this is enough, because resolving entities can only
-     shrink the string, but never grows */
-  TCHAR *d = (TCHAR *)malloc((lo + 1) * sizeof(*d));
-  assert(d);
-  TCHAR *result = d;
+  /* resolving entities can only shrink the string, but never grows */
+  dest.reserve(dest.length() + lo);
+
   while (ss < end && *ss) {
     if (*ss == _T('&')) {
       ss++;
       if (StringIsEqualIgnoreCase(ss, _T("lt;" ), 3)) {
-        *(d++) = _T('<' );
+        dest.push_back(_T('<' ));
         ss += 3;
       } else if (StringIsEqualIgnoreCase(ss, _T("gt;" ), 3)) {
-        *(d++) = _T('>' );
+        dest.push_back(_T('>' ));
         ss += 3;
       } else if (StringIsEqualIgnoreCase(ss, _T("amp;" ), 4)) {
-        *(d++) = _T('&' );
+        dest.push_back(_T('&' ));
         ss += 4;
       } else if (StringIsEqualIgnoreCase(ss, _T("apos;"), 5)) {
-        *(d++) = _T('\'');
+        dest.push_back(_T('\''));
         ss += 5;
       } else if (StringIsEqualIgnoreCase(ss, _T("quot;"), 5)) {
-        *(d++) = _T('"' );
+        dest.push_back(_T('"' ));
         ss += 5;
       } else if (*ss == '#') {
         /* number entity */
@@ -145,36 +150,57 @@ FromXMLString(const TCHAR *ss, size_t lo)
 
         TCHAR *endptr;
         unsigned i = ParseUnsigned(ss, &endptr, 10);
-        if (endptr == ss || endptr >= end || *endptr != ';') {
-          free(result);
-          return nullptr;
-        }
+        if (endptr == ss || endptr >= end || *endptr != ';')
+          return false;
 
         // XXX convert to UTF-8 if !_UNICODE
         TCHAR ch = (TCHAR)i;
         if (ch == 0)
           ch = ' ';
 
-        *d++ = ch;
+        dest.push_back(ch);
         ss = endptr + 1;
       } else {
-        free(result);
-        return nullptr;
+        return false;
       }
     } else {
-      *(d++) = *ss;
-      ss++;
+      /* copy everything up to the next entity at once */
+      const TCHAR *next = ss + 1;
+      while (next < end && *next != 0 && *next != _T('&'))
+        ++next;
+
+      dest.append(ss, next);
+      ss = next;
     }
   }
-  *d = 0;
 
-  /* shrink the memory allocation just in case we allocated too
-     much */
-  d = (TCHAR *)realloc(result, (d + 1 - result) * sizeof(*d));
-  if (d != nullptr)
-    result = d;
+  return true;
+}
 
-  return result;
+/**
+ * Decode the entities in a string (see FromXMLString()).  Strings
+ * without entities (the common case) are returned as they are,
+ * others are decoded into the parser's scratch buffer, which remains
+ * valid until the next call.
+ *
+ * @param length the length of the string; updated to the length of
+ * the decoded string
+ * @return the decoded string (not null-terminated), or nullptr on
+ * error
+ */
+static const TCHAR *
+DecodeXMLString(XML::Parser &parser, const TCHAR *s, size_t &length)
+{
+  const TCHAR *end = s + length;
+  if (std::find(s, end, _T('&')) == end)
+    return s;
+
+  parser.buffer.clear();
+  if (!FromXMLString(s, length, parser.buffer))
+    return nullptr;
+
+  length = parser.buffer.length();
+  return parser.buffer.data();
 }
 
 gcc_pure
@@ -570,14 +596,13 @@ XML::ParseXMLElement(XMLNode &node, Parser *pXML)
         // If we have node text then add this to the element
         if (text != nullptr) {
           size_t length = StripRight(text, token.pStr - text);
-          TCHAR *text2 = FromXMLString(text, length);
+          const TCHAR *text2 = DecodeXMLString(*pXML, text, length);
           if (text2 == nullptr) {
             pXML->error = eXMLErrorUnexpectedToken;
             return false;
           }
 
-          node.AddText(text2);
-          free(text2);
+          node.AddText(text2, length);
           text = nullptr;
         }
 
@@ -742,15 +767,14 @@ XML::ParseXMLElement(XMLNode &node, Parser *pXML)
           assert(!attribute_name.empty());
 
           {
-            TCHAR *value = FromXMLString(token.pStr, token.length);
+            size_t length = token.length;
+            const TCHAR *value = DecodeXMLString(*pXML, token.pStr, length);
             if (value == nullptr) {
               pXML->error = eXMLErrorUnexpectedToken;
               return false;
             }
 
-            node.AddAttribute(std::move(attribute_name),
-                              value, _tcslen(value));
-            free(value);
+            node.AddAttribute(std::move(attribute_name), value, length);
           }
 
           // Indicate we are searching for a new attribute
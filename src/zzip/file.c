@@ -1170,6 +1170,39 @@ zzip_tell(ZZIP_FILE * fp)
     return (fp->usize - fp->restlen);
 }
 
+/**
+ * This function returns the offset of the data of a member within
+ * the ZIP file, if the member is STORED (not compressed).  Together
+ * with => zzip_file_archive_fd, this allows the caller to access the
+ * data directly, e.g. with mmap(2).
+ *
+ * It returns -1 if the member is compressed or if this is not a
+ * member of a ZIP file.
+ */
+zzip_off_t
+zzip_file_stored_offset(ZZIP_FILE * fp)
+{
+    if (! fp || ! fp->dir || fp->method != 0)
+        return -1;
+
+    return fp->dataoffset;
+}
+
+/**
+ * This function returns the file descriptor of the ZIP file which
+ * contains the given member, or -1 if this is not a member of a ZIP
+ * file.  The descriptor is shared by all members; don't change its
+ * file position.
+ */
+int
+zzip_file_archive_fd(ZZIP_FILE * fp)
+{
+    if (! fp || ! fp->dir)
+        return -1;
+
+    return fp->dir->fd;
+}
+
 #ifndef EOVERFLOW
 #define EOVERFLOW EFBIG
 #endif
@@ -213,6 +213,14 @@ zzip_off_t      zzip_seek(ZZIP_FILE * fp, zzip_off_t offset, int whence);
 _zzip_export
 zzip_off_t      zzip_tell(ZZIP_FILE * fp);
 
+/*
+ * direct access to STORED members (XCSoar extension)
+ */
+_zzip_export
+zzip_off_t      zzip_file_stored_offset(ZZIP_FILE * fp);
+_zzip_export
+int             zzip_file_archive_fd(ZZIP_FILE * fp);
+
 /*
  * reading info of a single file 
  * zzip/stat.c
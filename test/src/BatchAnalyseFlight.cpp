@@ -0,0 +1,218 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+/*
+ * Analyse many IGC files in parallel.  Each flight is handed to the
+ * next idle worker thread, and each result is written to stdout as
+ * one line of JSON as soon as it is ready; the order of the lines
+ * is therefore not deterministic.
+ */
+
+#include "FlightAnalysis.hpp"
+#include "DebugReplayIGC.hpp"
+#include "OS/Args.hpp"
+#include "OS/Path.hpp"
+#include "OS/FileUtil.hpp"
+#include "IO/OutputStream.hxx"
+#include "IO/BufferedOutputStream.hxx"
+#include "JSON/Writer.hpp"
+#include "Util/StringCompare.hxx"
+
+#include <vector>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <exception>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * An #OutputStream which collects all data in memory.
+ */
+class StringOutputStream final : public OutputStream {
+  std::string value;
+
+public:
+  const std::string &GetValue() const {
+    return value;
+  }
+
+  /* virtual methods from class OutputStream */
+  void Write(const void *data, size_t size) override {
+    value.append((const char *)data, size);
+  }
+};
+
+class IGCCollector final : public File::Visitor {
+  std::vector<AllocatedPath> &files;
+
+public:
+  explicit IGCCollector(std::vector<AllocatedPath> &_files)
+    :files(_files) {}
+
+  /* virtual methods from class File::Visitor */
+  void Visit(Path path, Path filename) override {
+    files.emplace_back(path);
+  }
+};
+
+static void
+CollectFiles(Path path, std::vector<AllocatedPath> &files)
+{
+  if (Directory::Exists(path)) {
+    IGCCollector collector(files);
+    Directory::VisitSpecificFiles(path, _T("*.igc"), collector, true);
+  } else
+    files.emplace_back(path);
+}
+
+static void
+WriteAnalysis(BufferedOutputStream &writer, Path path,
+              const FlightAnalysisSettings &settings)
+{
+  std::unique_ptr<DebugReplay> replay(DebugReplayIGC::Create(path));
+  AnalyseFlight(*replay, settings, writer);
+}
+
+/**
+ * Analyse one flight and return the result as one line of JSON.
+ */
+static std::string
+AnalyseFile(Path path, const FlightAnalysisSettings &settings)
+{
+  StringOutputStream sos;
+
+  {
+    BufferedOutputStream writer(sos);
+
+    {
+      JSON::ObjectWriter object(writer);
+      object.WriteElement("file", JSON::WriteString, path.ToUTF8().c_str());
+
+      try {
+        /* render into a separate buffer first, so a failure does
+           not leave a half-written "analysis" element behind */
+        StringOutputStream analysis;
+        BufferedOutputStream analysis_writer(analysis);
+        WriteAnalysis(analysis_writer, path, settings);
+        analysis_writer.Flush();
+
+        object.WriteElement("analysis", [&analysis](BufferedOutputStream &w){
+            w.Write(analysis.GetValue().data(), analysis.GetValue().size());
+          });
+      } catch (const std::exception &e) {
+        object.WriteElement("error", JSON::WriteString, e.what());
+      }
+    }
+
+    writer.Write('\n');
+    writer.Flush();
+  }
+
+  return sos.GetValue();
+}
+
+int main(int argc, char **argv)
+{
+  FlightAnalysisSettings settings;
+  unsigned n_jobs = std::thread::hardware_concurrency();
+
+  Args args(argc, argv,
+            "[options] PATH...\n"
+            "PATH may be an IGC file or a directory, which is searched\n"
+            "recursively for IGC files.\n"
+            "Options:\n"
+            "  --jobs=N                 Number of worker threads (default = number of CPUs)\n"
+            "  --full-points=512        Maximum number of full trace points (default = 512)\n"
+            "  --triangle-points=1024   Maximum number of triangle trace points (default = 1024)\n"
+            "  --sprint-points=64       Maximum number of sprint trace points (default = 64)");
+
+  const char *arg;
+  while ((arg = args.PeekNext()) != nullptr && *arg == '-') {
+    args.Skip();
+
+    const char *value;
+    unsigned *target;
+    if ((value = StringAfterPrefix(arg, "--jobs=")) != nullptr)
+      target = &n_jobs;
+    else if ((value = StringAfterPrefix(arg, "--full-points=")) != nullptr)
+      target = &settings.full_max_points;
+    else if ((value = StringAfterPrefix(arg, "--triangle-points=")) != nullptr)
+      target = &settings.triangle_max_points;
+    else if ((value = StringAfterPrefix(arg, "--sprint-points=")) != nullptr)
+      target = &settings.sprint_max_points;
+    else
+      args.UsageError();
+
+    char *endptr;
+    unsigned long n = strtoul(value, &endptr, 10);
+    if (endptr == value || *endptr != 0 || n == 0) {
+      fprintf(stderr, "Malformed option: %s\n", arg);
+      args.UsageError();
+    }
+
+    *target = n;
+  }
+
+  if (args.IsEmpty())
+    args.UsageError();
+
+  std::vector<AllocatedPath> files;
+  while (!args.IsEmpty())
+    CollectFiles(args.ExpectNextPath(), files);
+
+  if (n_jobs == 0)
+    n_jobs = 1;
+  if (n_jobs > files.size())
+    n_jobs = files.size();
+
+  /* the workers fetch the next file from this shared index; for
+     coarse jobs like these, this balances the load just as well as
+     per-thread queues with work stealing */
+  std::atomic_size_t next_file(0);
+  std::mutex output_mutex;
+
+  const auto worker = [&](){
+    size_t i;
+    while ((i = next_file.fetch_add(1)) < files.size()) {
+      const std::string line = AnalyseFile(files[i], settings);
+
+      const std::lock_guard<std::mutex> lock(output_mutex);
+      fwrite(line.data(), 1, line.size(), stdout);
+      fflush(stdout);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(n_jobs);
+  for (unsigned i = 0; i < n_jobs; ++i)
+    threads.emplace_back(worker);
+
+  for (auto &thread : threads)
+    thread.join();
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,189 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+/*
+ * Benchmark airspace queries and AirspaceWarningManager::Update() on
+ * an OpenAir file.  The query locations are pseudo-random with a
+ * fixed seed, so runs on different machines are comparable.
+ */
+
+#include "BenchmarkStats.hpp"
+#include "Airspace/AirspaceParser.hpp"
+#include "Engine/Airspace/Airspaces.hpp"
+#include "Engine/Airspace/AbstractAirspace.hpp"
+#include "Engine/Airspace/AirspaceIntersectionVisitor.hpp"
+#include "Engine/Airspace/AirspaceWarningManager.hpp"
+#include "Engine/Airspace/AirspaceWarningConfig.hpp"
+#include "Engine/Task/Stats/TaskStats.hpp"
+#include "Engine/Navigation/Aircraft.hpp"
+#include "GlideSolvers/GlidePolar.hpp"
+#include "Geo/GeoVector.hpp"
+#include "OS/Args.hpp"
+#include "IO/FileLineReader.hpp"
+#include "Operation/Operation.hpp"
+#include "Util/PrintException.hxx"
+
+#include <random>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/** the radius around the airspace center which is queried */
+static constexpr double RADIUS = 100000;
+
+static std::mt19937 generator(42);
+
+static GeoPoint
+RandomPoint(const GeoPoint &center, double max_distance)
+{
+  std::uniform_real_distribution<double> distance(0, max_distance);
+  std::uniform_real_distribution<double> bearing(0, 360);
+  return GeoVector(distance(generator),
+                   Angle::Degrees(bearing(generator))).EndPoint(center);
+}
+
+class CountingVisitor final : public AirspaceIntersectionVisitor {
+public:
+  unsigned count = 0;
+
+  void Visit(const AbstractAirspace &) override {
+    ++count;
+  }
+};
+
+static void
+BenchmarkQueries(const Airspaces &airspaces, unsigned n)
+{
+  const GeoPoint center = airspaces.GetProjection().GetCenter();
+
+  BenchmarkStats within_range("QueryWithinRange"),
+    intersecting("VisitIntersecting");
+  unsigned count = 0;
+  CountingVisitor visitor;
+
+  for (unsigned i = 0; i < n; ++i) {
+    const GeoPoint location = RandomPoint(center, RADIUS);
+    const GeoPoint end = RandomPoint(location, 20000);
+
+    within_range.Measure([&](){
+        for (const auto &i : airspaces.QueryWithinRange(location, 20000))
+          if (i.GetAirspace().GetBase().altitude < 3000)
+            ++count;
+      });
+
+    intersecting.Measure([&](){
+        airspaces.VisitIntersecting(location, end, visitor);
+      });
+  }
+
+  within_range.Print();
+  intersecting.Print();
+
+  /* prevent the compiler from optimising the queries away */
+  if (count + visitor.count == 42)
+    puts("");
+}
+
+/**
+ * Fly a pseudo-random track across the airspace area, alternating
+ * between cruise legs and circling.
+ */
+static void
+BenchmarkWarnings(const Airspaces &airspaces, unsigned n)
+{
+  AirspaceWarningConfig config;
+  config.SetDefaults();
+
+  AirspaceWarningManager warnings(config, airspaces);
+
+  const GlidePolar polar(1);
+  TaskStats task_stats;
+  task_stats.reset();
+
+  std::uniform_real_distribution<double> turn(-30, 30);
+
+  AircraftState state;
+  state.Reset();
+  state.location = RandomPoint(airspaces.GetProjection().GetCenter(), RADIUS / 2);
+  state.altitude = 1500;
+  state.altitude_agl = 1000;
+  state.ground_speed = state.true_airspeed = 30;
+  state.track = Angle::Degrees(0);
+  state.flying = true;
+  state.time = 36000;
+
+  warnings.Reset(state);
+
+  BenchmarkStats stats("AirspaceWarning::Update");
+
+  for (unsigned i = 0; i < n; ++i) {
+    const bool circling = (i / 300) % 2 == 1;
+
+    state.time += 1;
+    state.track += circling
+      ? Angle::Degrees(12)
+      : Angle::Degrees(turn(generator) / 10);
+    state.location = GeoVector(state.ground_speed, state.track)
+      .EndPoint(state.location);
+    state.altitude += circling ? 2 : -1;
+    state.vario = circling ? 2 : -1;
+
+    stats.Measure([&](){
+        warnings.Update(state, polar, task_stats, circling, 1);
+      });
+  }
+
+  stats.Print();
+}
+
+int main(int argc, char **argv)
+try {
+  Args args(argc, argv, "OPENAIR [N]");
+  const auto path = args.ExpectNextPath();
+  const unsigned n = args.IsEmpty() ? 10000 : args.ExpectNextInt();
+  args.ExpectEnd();
+
+  FileLineReader reader(path, Charset::AUTO);
+
+  Airspaces airspaces;
+  AirspaceParser parser(airspaces);
+
+  NullOperationEnvironment operation;
+  if (!parser.Parse(reader, operation)) {
+    fprintf(stderr, "Failed to parse input file\n");
+    return EXIT_FAILURE;
+  }
+
+  airspaces.Optimise();
+
+  printf("# %u airspaces\n", airspaces.GetSize());
+
+  BenchmarkStats::PrintHeader();
+  BenchmarkQueries(airspaces, n);
+  BenchmarkWarnings(airspaces, n);
+
+  return EXIT_SUCCESS;
+} catch (const std::runtime_error &e) {
+  PrintException(e);
+  return EXIT_FAILURE;
+}
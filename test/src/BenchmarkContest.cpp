@@ -0,0 +1,304 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+/*
+ * Run each contest solver over a set of flights, both incrementally
+ * (one Solve() call per new fix, like during the flight) and
+ * exhaustively (once after landing), and print the timings as one
+ * JSON object per line.
+ */
+
+#include "Engine/Trace/Trace.hpp"
+#include "Contest/Solvers/OLCSprint.hpp"
+#include "Contest/Solvers/OLCClassic.hpp"
+#include "Contest/Solvers/OLCFAI.hpp"
+#include "Contest/Solvers/DMStQuad.hpp"
+#include "Contest/Solvers/XContestFree.hpp"
+#include "Contest/Solvers/XContestTriangle.hpp"
+#include "Contest/Solvers/OLCSISAT.hpp"
+#include "Contest/Solvers/NetCoupe.hpp"
+#include "DebugReplayIGC.hpp"
+#include "OS/Args.hpp"
+#include "OS/Path.hpp"
+#include "OS/Clock.hpp"
+#include "IO/StdioOutputStream.hxx"
+#include "IO/BufferedOutputStream.hxx"
+#include "JSON/Writer.hpp"
+#include "JSON/GeoWriter.hpp"
+#include "Util/StringCompare.hxx"
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * The flights which are used when none are given on the command
+ * line: a short, two medium and a long one.
+ */
+static const char *const default_flights[] = {
+  "test/data/lxn_to_igc/18BF14K1.igc",
+  "test/data/0asljd01.igc",
+  "test/data/01lz1hq1.igc",
+  "test/data/apf-bug554.igc",
+  "test/data/9crx3101.igc",
+};
+
+/**
+ * The traces with the same sizes as in ContestComputer.
+ */
+struct Traces {
+  Trace full, triangle, sprint;
+
+  Traces()
+    :full(0, Trace::null_time, 512),
+     triangle(0, Trace::null_time, 1024),
+     sprint(0, 9000, 128) {}
+
+  void push_back(const TracePoint &point) {
+    full.push_back(point);
+    triangle.push_back(point);
+    sprint.push_back(point);
+  }
+};
+
+enum class Mode {
+  INCREMENTAL,
+  EXHAUSTIVE,
+};
+
+struct SolverInfo {
+  const char *name;
+
+  AbstractContest *(*create)(const Traces &traces);
+};
+
+static const SolverInfo solvers[] = {
+  { "olc_sprint", [](const Traces &t) -> AbstractContest * {
+      return new OLCSprint(t.sprint);
+    } },
+  { "olc_classic", [](const Traces &t) -> AbstractContest * {
+      return new OLCClassic(t.full);
+    } },
+  { "olc_fai", [](const Traces &t) -> AbstractContest * {
+      return new OLCFAI(t.triangle, false);
+    } },
+  { "dmst_quad", [](const Traces &t) -> AbstractContest * {
+      return new DMStQuad(t.full);
+    } },
+  { "xcontest_free", [](const Traces &t) -> AbstractContest * {
+      return new XContestFree(t.full, false);
+    } },
+  { "xcontest_triangle", [](const Traces &t) -> AbstractContest * {
+      return new XContestTriangle(t.triangle, false, false);
+    } },
+  { "olc_sisat", [](const Traces &t) -> AbstractContest * {
+      return new OLCSISAT(t.full);
+    } },
+  { "netcoupe", [](const Traces &t) -> AbstractContest * {
+      return new NetCoupe(t.full);
+    } },
+};
+
+struct BenchmarkResult {
+  /** the number of Solve() calls */
+  unsigned calls = 0;
+
+  /** the total duration of all Solve() calls [us] */
+  uint64_t duration = 0;
+
+  /** the longest Solve() call [us] */
+  uint64_t max_duration = 0;
+
+  double score = 0;
+
+  /** only for OLCTriangle based solvers */
+  unsigned long iterations = 0;
+  unsigned tree_size = 0;
+
+  void Solve(AbstractContest &solver, bool exhaustive) {
+    const auto start = MonotonicClockUS();
+    const SolverResult result = solver.Solve(exhaustive);
+    const uint64_t d = MonotonicClockUS() - start;
+
+    ++calls;
+    duration += d;
+    if (d > max_duration)
+      max_duration = d;
+
+    if (result == SolverResult::VALID)
+      score = solver.GetBestResult().score;
+  }
+};
+
+/**
+ * Load the fixes after the release, i.e. the part of the flight which
+ * is scored.
+ */
+static std::vector<TracePoint>
+LoadFlight(Path path)
+{
+  std::unique_ptr<DebugReplay> replay(DebugReplayIGC::Create(path));
+
+  std::vector<TracePoint> points;
+  bool released = false;
+
+  while (replay->Next()) {
+    const MoreData &basic = replay->Basic();
+    if (!basic.time_available || !basic.location_available ||
+        !basic.NavAltitudeAvailable())
+      continue;
+
+    if (!released && replay->Calculated().flight.release_time >= 0) {
+      released = true;
+
+      const double release_time = replay->Calculated().flight.release_time;
+      points.erase(points.begin(),
+                   std::find_if(points.begin(), points.end(),
+                                [release_time](const TracePoint &p){
+                                  return p.GetTime() >= release_time;
+                                }));
+    }
+
+    points.emplace_back(basic);
+  }
+
+  return points;
+}
+
+static BenchmarkResult
+Run(const SolverInfo &info, const std::vector<TracePoint> &points, Mode mode)
+{
+  /* the traces are too large for the stack */
+  const std::unique_ptr<Traces> traces(new Traces());
+  const std::unique_ptr<AbstractContest> solver(info.create(*traces));
+  solver->Reset();
+
+  BenchmarkResult result;
+
+  if (mode == Mode::INCREMENTAL) {
+    for (const auto &point : points) {
+      traces->push_back(point);
+      result.Solve(*solver, false);
+    }
+  } else {
+    for (const auto &point : points)
+      traces->push_back(point);
+
+    result.Solve(*solver, true);
+  }
+
+  const OLCTriangle *triangle = dynamic_cast<const OLCTriangle *>(solver.get());
+  if (triangle != nullptr) {
+    result.iterations = triangle->GetTotalIterations();
+    result.tree_size = triangle->GetPeakTreeSize();
+  }
+
+  return result;
+}
+
+static void
+WriteResult(BufferedOutputStream &writer, Path path, unsigned n_points,
+            const char *solver, Mode mode, const BenchmarkResult &result)
+{
+  {
+    JSON::ObjectWriter object(writer);
+    object.WriteElement("file", JSON::WriteString, path.ToUTF8().c_str());
+    object.WriteElement("points", JSON::WriteUnsigned, n_points);
+    object.WriteElement("solver", JSON::WriteString, solver);
+    object.WriteElement("mode", JSON::WriteString,
+                        mode == Mode::INCREMENTAL ? "incremental" : "exhaustive");
+    object.WriteElement("calls", JSON::WriteUnsigned, result.calls);
+    object.WriteElement("duration_us", JSON::WriteLong, (long)result.duration);
+    object.WriteElement("max_duration_us", JSON::WriteLong,
+                        (long)result.max_duration);
+    object.WriteElement("score", JSON::WriteDouble, result.score);
+
+    if (result.iterations > 0) {
+      object.WriteElement("iterations", JSON::WriteLong,
+                          (long)result.iterations);
+      object.WriteElement("tree_size", JSON::WriteUnsigned, result.tree_size);
+    }
+  }
+
+  writer.Write('\n');
+  writer.Flush();
+}
+
+static void
+Benchmark(BufferedOutputStream &writer, Path path,
+          bool incremental, bool exhaustive)
+{
+  const auto points = LoadFlight(path);
+
+  for (const auto &solver : solvers) {
+    if (incremental)
+      WriteResult(writer, path, points.size(), solver.name,
+                  Mode::INCREMENTAL,
+                  Run(solver, points, Mode::INCREMENTAL));
+
+    if (exhaustive)
+      WriteResult(writer, path, points.size(), solver.name,
+                  Mode::EXHAUSTIVE,
+                  Run(solver, points, Mode::EXHAUSTIVE));
+  }
+}
+
+int
+main(int argc, char **argv)
+{
+  Args args(argc, argv,
+            "[options] [FILE.igc...]\n"
+            "Options:\n"
+            "  --incremental   Run only the incremental benchmark\n"
+            "  --exhaustive    Run only the exhaustive benchmark");
+
+  bool incremental = true, exhaustive = true;
+
+  const char *arg;
+  while ((arg = args.PeekNext()) != nullptr && *arg == '-') {
+    args.Skip();
+
+    if (StringIsEqual(arg, "--incremental"))
+      exhaustive = false;
+    else if (StringIsEqual(arg, "--exhaustive"))
+      incremental = false;
+    else
+      args.UsageError();
+  }
+
+  StdioOutputStream os(stdout);
+  BufferedOutputStream writer(os);
+
+  if (args.IsEmpty()) {
+    for (const char *path : default_flights)
+      Benchmark(writer, Path(path), incremental, exhaustive);
+  } else {
+    while (!args.IsEmpty())
+      Benchmark(writer, args.ExpectNextPath(), incremental, exhaustive);
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,521 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+/*
+ * Renders a scripted sequence of map states off-screen and reports
+ * the frame times.  Build with STOP_WATCH=y to get per-layer times
+ * from the MapWindow's stop watch as well.
+ */
+
+#define ENABLE_CMDLINE
+#define ENABLE_RESOURCE_LOADER
+#define ENABLE_PROFILE
+#define ENABLE_MAIN_WINDOW
+#define ENABLE_LOOK
+#define USAGE "[-WxH] [FRAMES]"
+
+#include "Main.hpp"
+#include "BenchmarkStats.hpp"
+#include "MapWindow/MapWindow.hpp"
+#include "Computer/TraceComputer.hpp"
+#include "Terrain/RasterTerrain.hpp"
+#include "Profile/ComputerProfile.hpp"
+#include "Profile/MapProfile.hpp"
+#include "Profile/ProfileKeys.hpp"
+#include "Profile/Current.hpp"
+#include "Waypoint/WaypointGlue.hpp"
+#include "Topography/TopographyStore.hpp"
+#include "Topography/TopographyGlue.hpp"
+#include "Blackboard/DeviceBlackboard.hpp"
+#include "Airspace/AirspaceParser.hpp"
+#include "Engine/Waypoint/Waypoints.hpp"
+#include "Engine/Airspace/Airspaces.hpp"
+#include "Geo/GeoVector.hpp"
+#include "Screen/BufferCanvas.hpp"
+#include "IO/ConfiguredFile.hpp"
+#include "IO/LineReader.hpp"
+#include "Operation/Operation.hpp"
+#include "Thread/Debug.hpp"
+
+#ifdef ENABLE_OPENGL
+#include "Screen/OpenGL/System.hpp"
+#endif
+
+#include <algorithm>
+#include <vector>
+
+#include <math.h>
+#include <string.h>
+
+void
+DeviceBlackboard::SetStartupLocation(const GeoPoint &loc, const double alt) {}
+
+#ifndef NDEBUG
+
+bool
+InDrawThread()
+{
+  return InMainThread();
+}
+
+#endif
+
+static unsigned n_frames = 100;
+
+static void
+ParseCommandLine(Args &args)
+{
+  if (!args.IsEmpty())
+    n_frames = args.ExpectNextInt();
+}
+
+static Waypoints way_points;
+
+static Airspaces airspace_database;
+
+static TopographyStore *topography;
+static RasterTerrain *terrain;
+
+/**
+ * The map states which are rendered, one after another.
+ */
+enum class Scenario : uint8_t {
+  PAN,
+  ZOOM,
+  CIRCLING,
+  FINAL_GLIDE,
+  DENSE_AIRSPACE,
+  FULL_TRAIL,
+  COUNT
+};
+
+static constexpr const char *scenario_names[unsigned(Scenario::COUNT)] = {
+  "pan",
+  "zoom",
+  "circling",
+  "final-glide",
+  "dense-airspace",
+  "full-trail",
+};
+
+/**
+ * A simple glider which alternates between cruising and circling,
+ * one fix per second.
+ */
+class SyntheticFlight {
+  GeoPoint location;
+  Angle track = Angle::Zero();
+  double altitude = 1500;
+  unsigned time = 1297230000;
+
+public:
+  explicit SyntheticFlight(GeoPoint _location):location(_location) {}
+
+  const GeoPoint &GetLocation() const {
+    return location;
+  }
+
+  void Step(bool circling, double speed) {
+    if (circling) {
+      track = (track + Angle::Degrees(15)).AsBearing();
+      altitude += 2;
+    } else
+      altitude -= speed / 40;
+
+    location = GeoVector(speed, track).EndPoint(location);
+    ++time;
+  }
+
+  /**
+   * Fly one "normal" second: 200 seconds cruise followed by 100
+   * seconds circling.
+   */
+  void Step() {
+    const bool circling = time % 300 >= 200;
+    Step(circling, circling ? 25 : 35);
+  }
+
+  void Export(MoreData &basic, DerivedInfo &calculated, bool circling) const {
+    basic.clock = time;
+    basic.time = time;
+    basic.time_available.Update(basic.clock);
+    basic.alive.Update(basic.clock);
+    basic.location = location;
+    basic.location_available.Update(basic.clock);
+    basic.track = track;
+    basic.track_available.Update(basic.clock);
+    basic.attitude.heading = track;
+    basic.attitude.heading_available.Update(basic.clock);
+    basic.ground_speed = circling ? 25 : 35;
+    basic.ground_speed_available.Update(basic.clock);
+    basic.gps_altitude = altitude;
+    basic.gps_altitude_available.Update(basic.clock);
+    basic.nav_altitude = altitude;
+
+    calculated.flight.flying = true;
+    calculated.circling = circling;
+    calculated.terrain_valid = terrain != nullptr;
+  }
+};
+
+class BenchmarkMapWindow final : public MapWindow {
+  /**
+   * Replaces the #GlideComputer's trace, which is not available
+   * in this program.
+   */
+  TraceComputer trace_computer;
+
+public:
+  BenchmarkMapWindow(const MapLook &map_look,
+                     const TrafficLook &traffic_look)
+    :MapWindow(map_look, traffic_look) {}
+
+  void AddFix(const ComputerSettings &settings,
+              const MoreData &basic, const DerivedInfo &calculated) {
+    trace_computer.Update(settings, basic, calculated);
+  }
+
+  void SetScreenAngle(Angle angle) {
+    visible_projection.SetScreenAngle(angle);
+  }
+
+  /**
+   * Load terrain and topography for the current projection, just
+   * like the DrawThread does before each frame.
+   */
+  void Update() {
+    UpdateAll();
+  }
+
+  /**
+   * Render one frame and pass the per-layer times (only if built
+   * with STOP_WATCH) to the given function.
+   */
+  template<typename F>
+  void DrawFrame(Canvas &canvas, F &&f) {
+    Render(canvas, GetClientRect());
+    draw_sw.Finish(std::forward<F>(f));
+  }
+
+protected:
+  /* virtual methods from class MapWindow */
+  void RenderTrail(Canvas &canvas, PixelPoint aircraft_pos) override {
+    unsigned min_time;
+    switch (GetMapSettings().trail.length) {
+    case TrailSettings::Length::OFF:
+      return;
+    case TrailSettings::Length::LONG:
+      min_time = std::max(0, (int)Basic().time - 3600);
+      break;
+    case TrailSettings::Length::SHORT:
+      min_time = std::max(0, (int)Basic().time - 600);
+      break;
+    case TrailSettings::Length::FULL:
+    default:
+      min_time = 0;
+      break;
+    }
+
+    trail_renderer.Draw(canvas, trace_computer, render_projection, min_time,
+                        false, aircraft_pos, Basic(), Calculated(),
+                        GetMapSettings().trail);
+  }
+};
+
+/**
+ * An off-screen render target: a frame buffer object on OpenGL, a
+ * plain memory buffer otherwise.
+ */
+class OffscreenTarget {
+#ifdef ENABLE_OPENGL
+  Canvas screen;
+#endif
+  BufferCanvas buffer;
+
+public:
+  explicit OffscreenTarget(PixelSize size)
+#ifdef ENABLE_OPENGL
+    :screen(size)
+  {
+    buffer.Create(size);
+  }
+#else
+    :buffer(size) {}
+#endif
+
+  Canvas &Begin() {
+#ifdef ENABLE_OPENGL
+    buffer.Begin(screen);
+#endif
+    return buffer;
+  }
+
+  /**
+   * Wait until all drawing commands have been executed.
+   */
+  void Flush() {
+#ifdef ENABLE_OPENGL
+    glFinish();
+#endif
+  }
+
+  void End() {
+#ifdef ENABLE_OPENGL
+    buffer.Commit(screen);
+#endif
+  }
+};
+
+/**
+ * The frame times of one scenario, in total and per layer.
+ */
+class ScenarioStats {
+  BenchmarkStats update, total;
+  std::vector<BenchmarkStats> layers;
+
+public:
+  explicit ScenarioStats(const char *name)
+    :update("  Update"), total(name) {}
+
+  BenchmarkStats &GetUpdate() {
+    return update;
+  }
+
+  BenchmarkStats &GetTotal() {
+    return total;
+  }
+
+  /**
+   * @param duration the duration [us]
+   */
+  void AddLayer(const char *name, uint64_t duration) {
+    auto i = std::find_if(layers.begin(), layers.end(),
+                          [name](const BenchmarkStats &s){
+                            return strcmp(s.GetName(), name) == 0;
+                          });
+    if (i == layers.end()) {
+      layers.emplace_back(name);
+      i = std::prev(layers.end());
+    }
+
+    i->Add(duration * 1000);
+  }
+
+  void Print() {
+    total.Print();
+    update.Print();
+    for (auto &i : layers)
+      i.Print();
+  }
+};
+
+static void
+LoadFiles(PlacesOfInterestSettings &poi_settings,
+          TeamCodeSettings &team_code_settings)
+{
+  NullOperationEnvironment operation;
+
+  topography = new TopographyStore();
+  LoadConfiguredTopography(*topography, operation);
+
+  terrain = RasterTerrain::OpenTerrain(NULL, operation);
+
+  WaypointGlue::LoadWaypoints(way_points, terrain, operation);
+  WaypointGlue::SetHome(way_points, terrain, poi_settings, team_code_settings,
+                        NULL, false);
+
+  auto reader = OpenConfiguredTextFile(ProfileKeys::AirspaceFile,
+                                       Charset::AUTO);
+  if (reader) {
+    AirspaceParser parser(airspace_database);
+    parser.Parse(*reader, operation);
+    airspace_database.Optimise();
+  }
+}
+
+/**
+ * Apply the scenario to the aircraft, the settings and the map
+ * projection for the given frame.
+ */
+static void
+SetupFrame(Scenario scenario, unsigned frame, SyntheticFlight &flight,
+           const GeoPoint &origin,
+           MoreData &basic, DerivedInfo &calculated,
+           MapSettings &settings_map,
+           double &map_scale, GeoPoint &map_location, Angle &screen_angle)
+{
+  bool circling = false;
+  map_scale = 5000;
+  screen_angle = Angle::Zero();
+
+  switch (scenario) {
+  case Scenario::PAN:
+    flight.Step();
+    map_location = GeoVector(frame * 500., Angle::Degrees(frame * 3.6))
+      .EndPoint(origin);
+    break;
+
+  case Scenario::ZOOM:
+    flight.Step();
+    map_scale = 500 * pow(200, double(frame % 50) / 49);
+    map_location = flight.GetLocation();
+    break;
+
+  case Scenario::CIRCLING:
+    circling = true;
+    flight.Step(true, 25);
+    map_scale = 1000;
+    map_location = flight.GetLocation();
+    break;
+
+  case Scenario::FINAL_GLIDE:
+    flight.Step(false, 45);
+    map_scale = 20000;
+    map_location = flight.GetLocation();
+    break;
+
+  case Scenario::DENSE_AIRSPACE:
+    flight.Step();
+    map_scale = 50000;
+    map_location = flight.GetLocation();
+    settings_map.airspace.enable = true;
+    settings_map.airspace.altitude_mode = AirspaceDisplayMode::ALLON;
+    settings_map.airspace.fill_mode = AirspaceRendererSettings::FillMode::ALL;
+    settings_map.airspace.label_selection =
+      AirspaceRendererSettings::LabelSelection::ALL;
+    for (auto &i : settings_map.airspace.classes)
+      i.display = true;
+    break;
+
+  case Scenario::FULL_TRAIL:
+    flight.Step();
+    map_scale = 30000;
+    map_location = flight.GetLocation();
+    settings_map.trail.length = TrailSettings::Length::FULL;
+    break;
+
+  case Scenario::COUNT:
+    gcc_unreachable();
+  }
+
+  flight.Export(basic, calculated, circling);
+
+  if (scenario == Scenario::FINAL_GLIDE)
+    screen_angle = basic.track;
+}
+
+void
+Main()
+{
+  ComputerSettings settings_computer;
+  settings_computer.SetDefaults();
+  Profile::Load(Profile::map, settings_computer);
+
+  MapSettings base_settings_map;
+  base_settings_map.SetDefaults();
+  Profile::Load(Profile::map, base_settings_map);
+
+  LoadFiles(settings_computer.poi, settings_computer.team_code);
+
+  GeoPoint origin;
+  if (settings_computer.poi.home_location_available)
+    origin = settings_computer.poi.home_location;
+  else if (terrain != nullptr)
+    origin = terrain->GetTerrainCenter();
+  else
+    origin = GeoPoint(Angle::Degrees(7.7), Angle::Degrees(51.2));
+
+  WindowStyle style;
+  style.Hide();
+
+  BenchmarkMapWindow map(look->map, look->traffic);
+  map.SetWaypoints(&way_points);
+  map.SetAirspaces(&airspace_database);
+  map.SetTopography(topography);
+  map.SetTerrain(terrain);
+  map.SetLocation(origin);
+  map.Create(main_window, main_window.GetClientRect(), style);
+
+  OffscreenTarget target(map.GetSize());
+
+  MoreData basic;
+  basic.Reset();
+
+  DerivedInfo calculated;
+  calculated.Reset();
+
+  /* fly one hour to fill the trail */
+  SyntheticFlight flight(origin);
+  for (unsigned i = 0; i < 3600; ++i) {
+    flight.Step();
+    flight.Export(basic, calculated, false);
+    map.AddFix(settings_computer, basic, calculated);
+  }
+
+  BenchmarkStats::PrintHeader();
+
+  for (unsigned s = 0; s < unsigned(Scenario::COUNT); ++s) {
+    const Scenario scenario = Scenario(s);
+    ScenarioStats stats(scenario_names[s]);
+
+    for (unsigned frame = 0; frame < n_frames; ++frame) {
+      MapSettings settings_map = base_settings_map;
+      double map_scale;
+      GeoPoint map_location;
+      Angle screen_angle;
+      SetupFrame(scenario, frame, flight, origin, basic, calculated,
+                 settings_map, map_scale, map_location, screen_angle);
+      map.AddFix(settings_computer, basic, calculated);
+
+      map.ReadBlackboard(basic, calculated, settings_computer, settings_map);
+      map.SetMapScale(map_scale);
+      map.SetLocation(map_location);
+      map.SetScreenAngle(screen_angle);
+      map.UpdateScreenBounds();
+
+      stats.GetUpdate().Measure([&map](){
+          map.Update();
+        });
+
+      Canvas &canvas = target.Begin();
+      stats.GetTotal().Measure([&](){
+          map.DrawFrame(canvas, [&stats](const char *name, uint64_t duration){
+              stats.AddLayer(name, duration);
+            });
+          target.Flush();
+        });
+      target.End();
+    }
+
+    stats.Print();
+  }
+
+#ifndef STOP_WATCH
+  printf("# build with STOP_WATCH=y for per-layer times\n");
+#endif
+
+  map.Destroy();
+
+  delete terrain;
+  delete topography;
+}
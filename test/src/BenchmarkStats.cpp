@@ -0,0 +1,60 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#include "BenchmarkStats.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include <stdio.h>
+
+void
+BenchmarkStats::PrintHeader()
+{
+  printf("%-24s %10s %12s %10s %10s %10s %10s\n",
+         "# name", "ops", "ops/s", "p50 [us]", "p90 [us]", "p99 [us]", "max [us]");
+}
+
+void
+BenchmarkStats::Print()
+{
+  if (samples.empty()) {
+    printf("%-24s %10u\n", name, 0u);
+    return;
+  }
+
+  const uint64_t total = std::accumulate(samples.begin(), samples.end(),
+                                         uint64_t(0));
+
+  std::sort(samples.begin(), samples.end());
+
+  const auto percentile = [this](unsigned p){
+    return samples[(samples.size() - 1) * p / 100] / 1000.;
+  };
+
+  printf("%-24s %10u %12.0f %10.2f %10.2f %10.2f %10.2f\n",
+         name, (unsigned)samples.size(),
+         total > 0 ? samples.size() * 1e9 / total : 0.,
+         percentile(50), percentile(90), percentile(99),
+         samples.back() / 1000.);
+}
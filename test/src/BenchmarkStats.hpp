@@ -0,0 +1,83 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#ifndef XCSOAR_BENCHMARK_STATS_HPP
+#define XCSOAR_BENCHMARK_STATS_HPP
+
+#include <chrono>
+#include <vector>
+
+#include <stdint.h>
+
+/**
+ * Collects the latency of each call of a benchmarked operation and
+ * prints the throughput and latency percentiles.
+ */
+class BenchmarkStats {
+  typedef std::chrono::steady_clock Clock;
+
+  const char *const name;
+
+  /** the duration of each operation [ns] */
+  std::vector<uint64_t> samples;
+
+public:
+  explicit BenchmarkStats(const char *_name):name(_name) {}
+
+  const char *GetName() const {
+    return name;
+  }
+
+  /**
+   * Invoke the function once and record its duration.
+   */
+  template<typename F>
+  void Measure(F &&f) {
+    const auto start = Clock::now();
+    f();
+    const auto duration = Clock::now() - start;
+    Add(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+  }
+
+  /**
+   * Record a duration which was measured elsewhere.
+   *
+   * @param duration the duration [ns]
+   */
+  void Add(uint64_t duration) {
+    samples.push_back(duration);
+  }
+
+  /**
+   * Print the column names for Print().
+   */
+  static void PrintHeader();
+
+  /**
+   * Print one line: operation count, operations per second and the
+   * 50th, 90th and 99th percentile and the maximum latency [us].
+   */
+  void Print();
+};
+
+#endif
@@ -0,0 +1,199 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+/*
+ * Benchmark the terrain lookups and the terrain route/reach solvers
+ * on a real terrain file.  The query locations are pseudo-random
+ * with a fixed seed, so runs on different machines are comparable.
+ */
+
+#include "BenchmarkStats.hpp"
+#include "Terrain/RasterMap.hpp"
+#include "Terrain/Loader.hpp"
+#include "Route/TerrainRoute.hpp"
+#include "Route/Config.hpp"
+#include "GlideSolvers/GlideSettings.hpp"
+#include "GlideSolvers/GlidePolar.hpp"
+#include "Geo/SpeedVector.hpp"
+#include "Geo/GeoVector.hpp"
+#include "Thread/SharedMutex.hpp"
+#include "OS/Args.hpp"
+#include "IO/ZipArchive.hpp"
+#include "Operation/Operation.hpp"
+#include "Util/PrintException.hxx"
+
+#include <random>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+
+/** the radius around the map center which is loaded and queried */
+static constexpr double RADIUS = 50000;
+
+static std::mt19937 generator(42);
+
+static GeoPoint
+RandomPoint(const GeoPoint &center, double max_distance)
+{
+  std::uniform_real_distribution<double> distance(0, max_distance);
+  std::uniform_real_distribution<double> bearing(0, 360);
+  return GeoVector(distance(generator),
+                   Angle::Degrees(bearing(generator))).EndPoint(center);
+}
+
+static void
+BenchmarkGetHeight(const RasterMap &map, unsigned n)
+{
+  const GeoPoint center = map.GetMapCenter();
+
+  BenchmarkStats stats("GetHeight"), interpolated("GetInterpolatedHeight");
+  int sum = 0;
+
+  for (unsigned i = 0; i < n; ++i) {
+    const GeoPoint p = RandomPoint(center, RADIUS);
+
+    stats.Measure([&](){
+        sum += map.GetHeight(p).GetValueOr0();
+      });
+
+    interpolated.Measure([&](){
+        sum += map.GetInterpolatedHeight(p).GetValueOr0();
+      });
+  }
+
+  stats.Print();
+  interpolated.Print();
+
+  /* prevent the compiler from optimising the lookups away */
+  if (sum == 42)
+    puts("");
+}
+
+static void
+BenchmarkIntersection(const RasterMap &map, unsigned n)
+{
+  const GeoPoint center = map.GetMapCenter();
+
+  BenchmarkStats stats("Intersection");
+  unsigned found = 0;
+
+  for (unsigned i = 0; i < n; ++i) {
+    const GeoPoint origin = RandomPoint(center, RADIUS / 2);
+    const GeoPoint destination = RandomPoint(origin, RADIUS / 2);
+    const int h_origin = map.GetHeight(origin).GetValueOr0() + 500;
+
+    stats.Measure([&](){
+        if (map.Intersection(origin, h_origin, h_origin, destination,
+                             0).IsValid())
+          ++found;
+      });
+  }
+
+  stats.Print();
+
+  if (found == 42)
+    puts("");
+}
+
+static void
+BenchmarkRoute(const RasterMap &map, unsigned n)
+{
+  const GeoPoint center = map.GetMapCenter();
+
+  GlideSettings settings;
+  settings.SetDefaults();
+  RoutePlannerConfig config;
+  config.SetDefaults();
+  config.mode = RoutePlannerConfig::Mode::TERRAIN;
+
+  const GlidePolar polar(1);
+  const SpeedVector wind(Angle::Degrees(0), 0);
+
+  TerrainRoute route;
+  route.UpdatePolar(settings, config, polar, polar, wind);
+  route.SetTerrain(&map);
+
+  BenchmarkStats solve("RoutePlanner::Solve"),
+    reach("SolveReachTerrain");
+
+  for (unsigned i = 0; i < n; ++i) {
+    const GeoPoint origin = RandomPoint(center, RADIUS / 2);
+    const GeoPoint destination = RandomPoint(origin, RADIUS / 2);
+
+    const AGeoPoint a_origin(origin,
+                             map.GetHeight(origin).GetValueOr0() + 800);
+    const AGeoPoint a_destination(destination,
+                                  map.GetHeight(destination).GetValueOr0() + 100);
+
+    route.Reset();
+    solve.Measure([&](){
+        route.Solve(a_destination, a_origin, config);
+      });
+
+    reach.Measure([&](){
+        route.SolveReachTerrain(a_origin, config, INT_MAX);
+      });
+  }
+
+  solve.Print();
+  reach.Print();
+}
+
+int main(int argc, char **argv)
+try {
+  Args args(argc, argv, "PATH [N]");
+  const auto map_path = args.ExpectNextPath();
+  const unsigned n = args.IsEmpty() ? 1000 : args.ExpectNextInt();
+  args.ExpectEnd();
+
+  ZipArchive archive(map_path);
+
+  RasterMap map;
+
+  NullOperationEnvironment operation;
+  if (!LoadTerrainOverview(archive.get(), map.GetTileCache(),
+                           operation)) {
+    fprintf(stderr, "failed to load map\n");
+    return EXIT_FAILURE;
+  }
+
+  map.UpdateProjection();
+
+  SharedMutex mutex;
+  do {
+    UpdateTerrainTiles(archive.get(), map.GetTileCache(), mutex,
+                       map.GetProjection(),
+                       map.GetMapCenter(), RADIUS);
+  } while (map.IsDirty());
+
+  BenchmarkStats::PrintHeader();
+  BenchmarkGetHeight(map, n * 100);
+  BenchmarkIntersection(map, n * 10);
+  BenchmarkRoute(map, n / 10 + 1);
+
+  return EXIT_SUCCESS;
+} catch (const std::runtime_error &e) {
+  PrintException(e);
+  return EXIT_FAILURE;
+}
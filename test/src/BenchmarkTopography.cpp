@@ -0,0 +1,104 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+/*
+ * Benchmark the topography visibility scan on a map file while the
+ * map projection pans and zooms pseudo-randomly (fixed seed), the
+ * way the map window does while flying.
+ */
+
+#include "BenchmarkStats.hpp"
+#include "Topography/TopographyStore.hpp"
+#include "Topography/TopographyFile.hpp"
+#include "Projection/WindowProjection.hpp"
+#include "Geo/GeoVector.hpp"
+#include "OS/Args.hpp"
+#include "IO/ZipArchive.hpp"
+#include "IO/ZipLineReader.hpp"
+#include "Operation/Operation.hpp"
+#include "Util/PrintException.hxx"
+
+#include <random>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/** the radius around the map center which is panned over */
+static constexpr double RADIUS = 50000;
+
+static std::mt19937 generator(42);
+
+int main(int argc, char **argv)
+try {
+  Args args(argc, argv, "PATH [N]");
+  const auto path = args.ExpectNextPath();
+  const unsigned n = args.IsEmpty() ? 1000 : args.ExpectNextInt();
+  args.ExpectEnd();
+
+  ZipArchive archive(path);
+
+  ZipLineReaderA reader(archive.get(), "topology.tpl");
+
+  TopographyStore topography;
+  NullOperationEnvironment operation;
+  topography.Load(operation, reader, NULL, archive.get());
+
+  if (topography.size() == 0) {
+    fprintf(stderr, "No topography in map file\n");
+    return EXIT_FAILURE;
+  }
+
+  const GeoPoint center = topography[0].GetCenter();
+
+  WindowProjection projection;
+  projection.SetScreenSize({640, 480});
+  projection.SetScreenOrigin(320, 240);
+
+  std::uniform_real_distribution<double> distance(0, RADIUS);
+  std::uniform_real_distribution<double> bearing(0, 360);
+  std::uniform_real_distribution<double> zoom(2000, 50000);
+
+  BenchmarkStats stats("ScanVisibility");
+  unsigned updated = 0;
+
+  for (unsigned i = 0; i < n; ++i) {
+    projection.SetGeoLocation(GeoVector(distance(generator),
+                                        Angle::Degrees(bearing(generator)))
+                              .EndPoint(center));
+    projection.SetScaleFromRadius(zoom(generator));
+    projection.UpdateScreenBounds();
+
+    stats.Measure([&](){
+        updated += topography.ScanVisibility(projection);
+      });
+  }
+
+  BenchmarkStats::PrintHeader();
+  stats.Print();
+  printf("# %u file updates\n", updated);
+
+  return EXIT_SUCCESS;
+} catch (const std::runtime_error &e) {
+  PrintException(e);
+  return EXIT_FAILURE;
+}
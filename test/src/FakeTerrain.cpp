@@ -23,12 +23,21 @@ Copyright_License {
 
 #include "Terrain/RasterTerrain.hpp"
 
+#include <algorithm>
+
 TerrainHeight
 RasterMap::GetHeight(const GeoPoint &location) const
 {
   return TerrainHeight::Invalid();
 }
 
+void
+RasterMap::GetHeights(ConstBuffer<GeoPoint> locations,
+                      TerrainHeight *buffer) const
+{
+  std::fill_n(buffer, locations.size, TerrainHeight::Invalid());
+}
+
 GeoPoint
 RasterMap::Intersection(const GeoPoint& origin,
                         const int h_origin,
@@ -0,0 +1,53 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#ifndef XCSOAR_FLIGHT_ANALYSIS_HPP
+#define XCSOAR_FLIGHT_ANALYSIS_HPP
+
+class DebugReplay;
+class BufferedOutputStream;
+
+struct FlightAnalysisSettings {
+  /** Maximum number of full trace points */
+  unsigned full_max_points = 512;
+
+  /** Maximum number of triangle trace points */
+  unsigned triangle_max_points = 1024;
+
+  /** Maximum number of sprint trace points */
+  unsigned sprint_max_points = 64;
+};
+
+/**
+ * Replay a flight, detect takeoff/release/landing and the flight
+ * phases, solve the OLC Plus and DMSt contests and write the result
+ * as one JSON object.
+ *
+ * This function does not use global state; it may be called from
+ * several threads at the same time, each with its own #DebugReplay
+ * and #BufferedOutputStream.
+ */
+void
+AnalyseFlight(DebugReplay &replay, const FlightAnalysisSettings &settings,
+              BufferedOutputStream &writer);
+
+#endif
@@ -0,0 +1,224 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+/*
+ * Replays a file recorded with "xcsoar -capture" through a device
+ * driver, either with the original timing or accelerated, and
+ * reports how much time the driver spent parsing the data.  This
+ * makes performance problems reported with a specific device
+ * reproducible on a desktop machine.
+ */
+
+#include "Logger/DeviceCapture.hpp"
+#include "NMEA/Info.hpp"
+#include "Device/Port/NullPort.hpp"
+#include "Device/Util/LineSplitter.hpp"
+#include "Device/Driver.hpp"
+#include "Device/Register.hpp"
+#include "Device/Parser.hpp"
+#include "Device/Config.hpp"
+#include "OS/Args.hpp"
+#include "OS/ByteOrder.hpp"
+#include "OS/Clock.hpp"
+#include "OS/Sleep.h"
+#include "Util/ConvertString.hpp"
+
+#include <algorithm>
+
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * Stands in for the #DeviceDescriptor: receives the bytes from the
+ * #Port and dispatches them to the driver, just like the real
+ * descriptor does.
+ */
+class ReplayHandler final : public PortLineSplitter {
+  const DeviceRegister &driver;
+  Device *device = nullptr;
+
+  NMEAParser parser;
+
+public:
+  NMEAInfo basic;
+
+  unsigned n_lines = 0;
+
+  explicit ReplayHandler(const DeviceRegister &_driver)
+    :driver(_driver) {
+    basic.Reset();
+  }
+
+  ~ReplayHandler() {
+    delete device;
+  }
+
+  void CreateDevice(const DeviceConfig &config, Port &port) {
+    if (driver.CreateOnPort != nullptr)
+      device = driver.CreateOnPort(config, port);
+  }
+
+  /* virtual methods from class DataHandler */
+  void DataReceived(const void *data, size_t length) override {
+    basic.UpdateClock();
+
+    if (device != nullptr && driver.UsesRawData())
+      device->DataReceived(data, length, basic);
+    else
+      PortLineSplitter::DataReceived(data, length);
+  }
+
+protected:
+  /* virtual methods from class PortLineHandler */
+  void LineReceived(const char *line) override {
+    ++n_lines;
+
+    if (device == nullptr || !device->ParseNMEA(line, basic))
+      parser.ParseLine(line, basic);
+  }
+};
+
+/**
+ * A #Port which delivers the recorded data to its #DataHandler, the
+ * same way a real port's receive thread would.
+ */
+class ReplayPort final : public NullPort {
+public:
+  explicit ReplayPort(::DataHandler &_handler)
+    :NullPort(_handler) {}
+
+  void Feed(const void *data, size_t length) {
+    handler.DataReceived(data, length);
+  }
+};
+
+static bool
+ReadRecord(FILE *file, DeviceCapture::RecordHeader &header,
+           void *buffer, size_t buffer_size)
+{
+  if (fread(&header, sizeof(header), 1, file) != 1)
+    return false;
+
+  header.time = FromLE32(header.time);
+  header.length = FromLE16(header.length);
+  return header.length <= buffer_size &&
+    fread(buffer, 1, header.length, file) == header.length;
+}
+
+int main(int argc, char **argv)
+{
+  NarrowString<1024> usage;
+  usage = "FILE.xcap DEVICE DRIVER [SPEED]\n\n"
+          "DEVICE is the device index (0 = A), SPEED is the replay\n"
+          "speed factor (default 1, 0 = as fast as possible).\n\n"
+          "Where DRIVER is one of:";
+  {
+    const DeviceRegister *driver;
+    for (unsigned i = 0; (driver = GetDriverByIndex(i)) != nullptr; ++i) {
+      WideToUTF8Converter driver_name(driver->name);
+      usage.AppendFormat("\n\t%s", (const char *)driver_name);
+    }
+  }
+
+  Args args(argc, argv, usage);
+  const char *path = args.ExpectNext();
+  const unsigned device_index = args.ExpectNextInt();
+  tstring driver_name = args.ExpectNextT();
+  const double speed = args.IsEmpty() ? 1. : args.ExpectNextDouble();
+  args.ExpectEnd();
+
+  if (speed < 0)
+    args.UsageError();
+
+  const DeviceRegister *driver = FindDriverByName(driver_name.c_str());
+  if (driver == nullptr) {
+    _ftprintf(stderr, _T("No such driver: %s\n"), driver_name.c_str());
+    return EXIT_FAILURE;
+  }
+
+  FILE *file = fopen(path, "rb");
+  if (file == nullptr) {
+    fprintf(stderr, "Failed to open %s\n", path);
+    return EXIT_FAILURE;
+  }
+
+  char magic[sizeof(DeviceCapture::MAGIC) - 1];
+  if (fread(magic, sizeof(magic), 1, file) != 1 ||
+      memcmp(magic, DeviceCapture::MAGIC, sizeof(magic)) != 0) {
+    fprintf(stderr, "Not a device capture file: %s\n", path);
+    fclose(file);
+    return EXIT_FAILURE;
+  }
+
+  DeviceConfig config;
+  config.Clear();
+
+  ReplayHandler handler(*driver);
+  ReplayPort port(handler);
+  handler.CreateDevice(config, port);
+
+  unsigned n_records = 0, capture_duration = 0;
+  size_t n_bytes = 0;
+  uint64_t parse_us = 0, max_parse_us = 0;
+
+  const unsigned start_time = MonotonicClockMS();
+
+  DeviceCapture::RecordHeader header;
+  uint8_t buffer[0x10000];
+  while (ReadRecord(file, header, buffer, sizeof(buffer))) {
+    if (header.device != device_index)
+      continue;
+
+    if (speed > 0) {
+      const unsigned due = start_time + unsigned(header.time / speed);
+      const unsigned now = MonotonicClockMS();
+      if (int(due - now) > 0)
+        Sleep(due - now);
+    }
+
+    const uint64_t t0 = MonotonicClockUS();
+    port.Feed(buffer, header.length);
+    const uint64_t t = MonotonicClockUS() - t0;
+
+    parse_us += t;
+    max_parse_us = std::max(max_parse_us, t);
+    ++n_records;
+    n_bytes += header.length;
+    capture_duration = header.time;
+  }
+
+  fclose(file);
+
+  const unsigned wall_time = MonotonicClockMS() - start_time;
+
+  printf("records=%u bytes=%zu lines=%u\n",
+         n_records, n_bytes, handler.n_lines);
+  printf("capture=%u ms replay=%u ms\n", capture_duration, wall_time);
+  printf("parse total=%llu us max=%llu us avg=%.1f us\n",
+         (unsigned long long)parse_us, (unsigned long long)max_parse_us,
+         n_records > 0 ? double(parse_us) / n_records : 0.);
+  printf("location=%s\n",
+         handler.basic.location_available ? "available" : "unavailable");
+
+  return EXIT_SUCCESS;
+}
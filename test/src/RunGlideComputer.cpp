@@ -0,0 +1,157 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+/*
+ * Replays a flight through the complete GlideComputer (air data,
+ * task, route, contest, warnings, statistics) as fast as possible,
+ * without user interface, and prints how long each processing stage
+ * took.  This is meant for comparing the performance of different
+ * builds on the same flights.
+ *
+ * Each fix is followed by one ProcessIdle() call, which is what
+ * happens at the usual GPS rate in flight; this does not depend on
+ * the wall clock, so each run does the same work.
+ */
+
+#include "DebugReplay.hpp"
+#include "OS/Args.hpp"
+#include "OS/Clock.hpp"
+#include "Engine/Waypoint/Waypoints.hpp"
+#include "Engine/Airspace/Airspaces.hpp"
+#include "Engine/Task/TaskManager.hpp"
+#include "Engine/Task/Ordered/OrderedTask.hpp"
+#include "Computer/GlideComputer.hpp"
+#include "Computer/GlideComputerInterface.hpp"
+#include "Computer/Settings.hpp"
+#include "Computer/StageTimer.hpp"
+#include "Task/ProtectedTaskManager.hpp"
+#include "Task/LoadFile.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* fake symbols: */
+
+#include "Computer/ConditionMonitor/ConditionMonitors.hpp"
+#include "Input/InputQueue.hpp"
+#include "Logger/Logger.hpp"
+
+void
+ConditionMonitorsUpdate(const NMEAInfo &basic, const DerivedInfo &calculated,
+                        const ComputerSettings &settings)
+{
+}
+
+bool InputEvents::processGlideComputer(unsigned) { return false; }
+
+void Logger::LogStartEvent(const NMEAInfo &gps_info) {}
+void Logger::LogFinishEvent(const NMEAInfo &gps_info) {}
+void Logger::LogPoint(const NMEAInfo &gps_info) {}
+
+/* done with fake symbols. */
+
+static void
+PrintStages()
+{
+  printf("%-12s %8s %10s %8s %8s %8s\n",
+         "stage", "count", "total[ms]", "mean[us]", "p99[us]", "max[us]");
+
+  for (unsigned i = 0; i < unsigned(StageTimer::Stage::COUNT); ++i) {
+    const auto stage = StageTimer::Stage(i);
+    const auto s = StageTimer::GetSummary(stage);
+    if (s.count == 0)
+      continue;
+
+    /* the mean over the whole flight, unlike Summary::mean, which
+       only covers the most recent samples */
+    printf("%-12s %8lu %10.1f %8u %8u %8u\n",
+           StageTimer::GetName(stage), s.count, s.total / 1000.,
+           unsigned(s.total / s.count), s.p99, s.max);
+  }
+}
+
+int
+main(int argc, char **argv)
+{
+  Args args(argc, argv, "DRIVER FILE [TASK.tsk]");
+  DebugReplay *replay = CreateDebugReplay(args);
+  if (replay == nullptr)
+    return EXIT_FAILURE;
+
+  const char *task_path = args.IsEmpty() ? nullptr : args.GetNext();
+  args.ExpectEnd();
+
+  ComputerSettings settings;
+  settings.SetDefaults();
+  settings.polar.glide_polar_task = GlidePolar(1);
+
+  const Waypoints way_points;
+  Airspaces airspaces;
+
+  TaskManager task_manager(settings.task, way_points);
+  task_manager.SetGlidePolar(settings.polar.glide_polar_task);
+
+  GlideComputerTaskEvents task_events;
+  task_manager.SetTaskEvents(task_events);
+
+  ProtectedTaskManager protected_task_manager(task_manager, settings.task);
+
+  if (task_path != nullptr) {
+    OrderedTask *task = LoadTask(Path(task_path), settings.task);
+    if (task == nullptr) {
+      fprintf(stderr, "Failed to load task %s\n", task_path);
+      delete replay;
+      return EXIT_FAILURE;
+    }
+
+    protected_task_manager.TaskCommit(*task);
+    delete task;
+  }
+
+  GlideComputer glide_computer(settings, way_points, airspaces,
+                               protected_task_manager, task_events);
+  glide_computer.Initialise();
+
+  unsigned long n_fixes = 0;
+  const auto start = MonotonicClockUS();
+
+  while (replay->Next()) {
+    glide_computer.ReadBlackboard(replay->Basic());
+    glide_computer.ProcessGPS();
+    glide_computer.ProcessIdle();
+    ++n_fixes;
+  }
+
+  glide_computer.ProcessExhaustive();
+
+  const auto duration_us = MonotonicClockUS() - start;
+
+  delete replay;
+
+  printf("fixes: %lu\n", n_fixes);
+  printf("time: %.1f ms (%.0f fixes/s)\n", duration_us / 1000.,
+         duration_us > 0 ? n_fixes * 1e6 / duration_us : 0.);
+  PrintStages();
+
+  return EXIT_SUCCESS;
+}
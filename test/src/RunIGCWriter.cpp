@@ -23,6 +23,7 @@ Copyright_License {
 
 #include "OS/ConvertPathName.hpp"
 #include "IGC/IGCWriter.hpp"
+#include "IO/FileOutputStream.hxx"
 #include "Time/GPSClock.hpp"
 #include "DebugReplay.hpp"
 #include "OS/Args.hpp"
@@ -45,7 +46,9 @@ int main(int argc, char **argv)
 
   const TCHAR *driver_name = _T("Unknown");
 
-  IGCWriter writer(output_file);
+  FileOutputStream file(output_file,
+                        FileOutputStream::Mode::CREATE_VISIBLE);
+  IGCWriter writer(file);
   writer.WriteHeader(replay->Basic().date_time_utc, _T("Manfred Mustermann"),
                      _T("Ventus"), _T("D-1234"),
                      _T("MM"), "FOO", driver_name, true);
@@ -56,6 +59,7 @@ int main(int argc, char **argv)
       writer.LogPoint(replay->Basic());
 
   writer.Flush();
+  file.Commit();
 
   delete replay;
 
@@ -48,9 +48,9 @@ try {
 
   for (auto i = repository.begin(), end = repository.end(); i != end; ++i) {
     const auto &file = *i;
-    printf("file '%s' '%s' area='%s' type=%u\n",
+    printf("file '%s' '%s' area='%s' type=%u size=%lld md5='%s'\n",
            file.GetName(), file.GetURI(), file.GetArea(),
-           (unsigned)file.type);
+           (unsigned)file.type, (long long)file.size, file.md5.c_str());
   }
 
   return EXIT_SUCCESS;
@@ -26,13 +26,47 @@ Copyright_License {
 #include "Computer/WaveComputer.hpp"
 #include "Computer/WaveResult.hpp"
 #include "Computer/WaveSettings.hpp"
+#include "Engine/Trace/Vector.hpp"
 #include "Formatter/TimeFormatter.hpp"
 #include "Formatter/GeoPointFormatter.hpp"
 #include "Util/Macros.hpp"
 
+#include <string.h>
+
+static void
+PrintWaves(const WaveResult &result)
+{
+  for (const auto &w : result.waves) {
+    TCHAR time_buffer[32];
+    if (w.time >= 0)
+      FormatTime(time_buffer, w.time);
+    else
+      _tcscpy(time_buffer, _T("?"));
+
+    _tprintf(_T("wave: t=%s location=%f,%f a=%f,%f b=%f,%f location=%s normal=%f\n"),
+             time_buffer,
+             (double)w.location.longitude.Degrees(),
+             (double)w.location.latitude.Degrees(),
+             (double)w.a.longitude.Degrees(),
+             (double)w.a.latitude.Degrees(),
+             (double)w.b.longitude.Degrees(),
+             (double)w.b.latitude.Degrees(),
+             FormatGeoPoint(w.location, CoordinateFormat::DDMMSS).c_str(),
+             (double)w.normal.Degrees());
+  }
+}
+
 int main(int argc, char **argv)
 {
-  Args args(argc, argv, "DRIVER FILE");
+  Args args(argc, argv, "[--trace] DRIVER FILE");
+
+  /* with --trace, the whole flight is collected first and then
+     analysed in one pass by WaveComputer::ComputeTrace() */
+  const char *option = args.PeekNext();
+  const bool use_trace = option != nullptr && strcmp(option, "--trace") == 0;
+  if (use_trace)
+    args.GetNext();
+
   DebugReplay *replay = CreateDebugReplay(args);
   if (replay == NULL)
     return EXIT_FAILURE;
@@ -49,33 +83,25 @@ int main(int argc, char **argv)
   WaveResult result;
   result.Clear();
 
+  TracePointVector trace;
+
   while (replay->Next()) {
     const MoreData &basic = replay->Basic();
     const DerivedInfo &calculated = replay->Calculated();
 
-    wave.Compute(basic, calculated.flight, result, settings);
+    if (!use_trace)
+      wave.Compute(basic, calculated.flight, result, settings);
+    else if (calculated.flight.IsGliding() && basic.location_available &&
+             basic.time_available)
+      trace.push_back(TracePoint(basic));
   }
 
   delete replay;
 
-  for (const auto &w : result.waves) {
-    TCHAR time_buffer[32];
-    if (w.time >= 0)
-      FormatTime(time_buffer, w.time);
-    else
-      _tcscpy(time_buffer, _T("?"));
+  if (use_trace)
+    wave.ComputeTrace(trace, result);
 
-    _tprintf(_T("wave: t=%s location=%f,%f a=%f,%f b=%f,%f location=%s normal=%f\n"),
-             time_buffer,
-             (double)w.location.longitude.Degrees(),
-             (double)w.location.latitude.Degrees(),
-             (double)w.a.longitude.Degrees(),
-             (double)w.a.latitude.Degrees(),
-             (double)w.b.longitude.Degrees(),
-             (double)w.b.latitude.Degrees(),
-             FormatGeoPoint(w.location, CoordinateFormat::DDMMSS).c_str(),
-             (double)w.normal.Degrees());
-  }
+  PrintWaves(result);
 
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,123 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#include "Airspace/AirspaceCache.hpp"
+#include "Airspace/AirspaceParser.hpp"
+#include "Engine/Airspace/AbstractAirspace.hpp"
+#include "Engine/Airspace/Airspaces.hpp"
+#include "Util/StringAPI.hxx"
+#include "Util/PrintException.hxx"
+#include "IO/FileLineReader.hpp"
+#include "Operation/Operation.hpp"
+#include "TestUtil.hpp"
+
+#include <vector>
+
+static bool
+ParseFile(Path path, Airspaces &airspaces)
+{
+  FileLineReader reader(path, Charset::AUTO);
+
+  AirspaceParser parser(airspaces);
+  NullOperationEnvironment operation;
+
+  return parser.Parse(reader, operation);
+}
+
+static bool
+Equals(const AirspaceAltitude &a, const AirspaceAltitude &b)
+{
+  return a.altitude == b.altitude && a.flight_level == b.flight_level &&
+    a.altitude_above_terrain == b.altitude_above_terrain &&
+    a.reference == b.reference;
+}
+
+static bool
+Equals(const AbstractAirspace &a, const AbstractAirspace &b)
+{
+  if (a.GetShape() != b.GetShape() || a.GetType() != b.GetType() ||
+      !a.GetDays().equals(b.GetDays()) ||
+      !StringIsEqual(a.GetName(), b.GetName()) ||
+      a.GetRadioText() != b.GetRadioText() ||
+      !Equals(a.GetBase(), b.GetBase()) || !Equals(a.GetTop(), b.GetTop()) ||
+      a.GetPoints().size() != b.GetPoints().size())
+    return false;
+
+  for (unsigned i = 0; i < a.GetPoints().size(); ++i)
+    if (a.GetPoints()[i].GetLocation() != b.GetPoints()[i].GetLocation())
+      return false;
+
+  return true;
+}
+
+static void
+TestRoundTrip(const TCHAR *path)
+{
+  Airspaces original;
+  if (!ok1(ParseFile(Path(path), original))) {
+    skip(6, 0, "Failed to parse input file");
+    return;
+  }
+
+  FILE *file = tmpfile();
+  ok1(SaveAirspaceCache(file, original, 0));
+  const long size = ftell(file);
+
+  rewind(file);
+  Airspaces loaded;
+  ok1(LoadAirspaceCache(file, loaded));
+  ok1(loaded.GetPendingSize() == original.GetPendingSize());
+
+  bool equal = loaded.GetPendingSize() == original.GetPendingSize();
+  for (unsigned i = 0; equal && i < original.GetPendingSize(); ++i)
+    equal = Equals(original.GetPending(i), loaded.GetPending(i));
+  ok1(equal);
+
+  /* a truncated cache file must be rejected as a whole */
+  std::vector<char> buffer(size / 2);
+  rewind(file);
+  fread(buffer.data(), 1, buffer.size(), file);
+  fclose(file);
+
+  file = tmpfile();
+  fwrite(buffer.data(), 1, buffer.size(), file);
+  rewind(file);
+
+  Airspaces truncated;
+  ok1(!LoadAirspaceCache(file, truncated));
+  ok1(truncated.GetPendingSize() == 0);
+  fclose(file);
+}
+
+int main(int argc, char **argv)
+try {
+  plan_tests(14);
+
+  TestRoundTrip(_T("test/data/airspace/openair.txt"));
+  TestRoundTrip(_T("test/data/airspace/tnp.sua"));
+
+  return exit_status();
+} catch (const std::runtime_error &e) {
+  PrintException(e);
+  return EXIT_FAILURE;
+}
@@ -21,13 +21,16 @@
 */
 
 #include "Math/Angle.hpp"
+#include "Math/PolyTrig.hpp"
 #include "TestUtil.hpp"
 
+#include <algorithm>
+
 #include <stdio.h>
 
 int main(int argc, char **argv)
 {
-  plan_tests(97);
+  plan_tests(99);
 
   // Test Native() and Native()
   ok1(equals(Angle::Native(0).Native(), 0));
@@ -132,6 +135,29 @@ int main(int argc, char **argv)
   ok1(equals(Angle::Degrees(270).fastcosine(), 0));
   ok1(equals(Angle::Degrees(360).fastcosine(), 1));
 
+  // Test PolySinCos()
+  {
+    constexpr unsigned n = 4001;
+    static double x[n], sines[n], cosines[n];
+    double max_error = 0;
+    for (unsigned i = 0; i < n; ++i) {
+      x[i] = (i - 2000.) / 2;
+      double s, c;
+      PolySinCos(x[i], s, c);
+      max_error = std::max(max_error, fabs(s - sin(x[i])));
+      max_error = std::max(max_error, fabs(c - cos(x[i])));
+    }
+
+    ok1(max_error < 1e-13);
+
+    PolySinCos(x, sines, cosines, n);
+    bool batch_okay = true;
+    for (unsigned i = 0; i < n; ++i)
+      batch_okay = batch_okay && sines[i] == PolySine(x[i]) &&
+        cosines[i] == PolyCosine(x[i]);
+    ok1(batch_okay);
+  }
+
   // Test BiSector()
   ok1(equals(Angle::Degrees(270).HalfAngle(Angle::Degrees(180)), 45));
   ok1(equals(Angle::Degrees(90).HalfAngle(Angle::Zero()), 225));
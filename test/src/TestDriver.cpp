@@ -250,6 +250,23 @@ TestFLARM()
   } else {
     skip(15, 0, "traffic == NULL");
   }
+
+  /* fill the list with distant targets; a close new one replaces
+     one of them */
+  TrafficList &list = nmea_info.flarm.traffic;
+  while (!list.list.full()) {
+    traffic = list.AllocateTraffic();
+    traffic->Clear();
+    traffic->id = FlarmId::Undefined();
+    traffic->relative_north = 5000;
+    traffic->relative_east = 0;
+  }
+
+  ok1(parser.ParseLine("$PFLAA,0,200,0,10,2,DDA999,,,,,1*3e",
+                       nmea_info));
+  ok1(list.GetActiveTrafficCount() == TrafficList::MAX_COUNT);
+  ok1(list.FindTraffic(FlarmId::Parse("DDA999", NULL)) != NULL);
+  ok1(list.FindTraffic(FlarmId::Parse("DDAED5", NULL)) != NULL);
 }
 
 static void
@@ -1555,7 +1572,7 @@ TestFlightList(const struct DeviceRegister &driver)
 
 int main(int argc, char **argv)
 {
-  plan_tests(811);
+  plan_tests(815);
 
   TestGeneric();
   TestTasman();
@@ -29,7 +29,7 @@
 
 int main(int argc, char **argv)
 {
-  plan_tests(15);
+  plan_tests(18);
 
   FlarmNetDatabase db;
   int count = FlarmNetReader::LoadFile(Path(_T("test/data/flarmnet/data.fln")),
@@ -78,5 +78,17 @@ int main(int argc, char **argv)
   ok1(foundDDA85C);
   ok1(foundDDA896);
 
+  /* the result is limited to the given buffer size */
+  ok1(db.FindIdsByCallSign(_T("TH"), ids, 1) == 1);
+
+  /* a duplicate id does not replace the first record */
+  FlarmNetRecord duplicate = *db.FindRecordById(id);
+  duplicate.pilot = _T("Duplicate");
+  db.Insert(duplicate);
+  db.Finish();
+  record = db.FindRecordById(id);
+  ok1(record != NULL);
+  ok1(StringIsEqual(record->pilot, _T("Tobias Bieniek")));
+
   return exit_status();
 }
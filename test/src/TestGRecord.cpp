@@ -21,12 +21,14 @@
 */
 
 #include "Logger/GRecord.hpp"
+#include "Logger/MD5.hpp"
 #include "TestUtil.hpp"
 #include "OS/Path.hpp"
 #include "Util/PrintException.hxx"
 
 #include <tchar.h>
 #include <stdlib.h>
+#include <string.h>
 
 static void
 CheckGRecord(const TCHAR *path)
@@ -37,9 +39,60 @@ CheckGRecord(const TCHAR *path)
   ok1(true);
 }
 
+/**
+ * Verify that each lane of #MD5x4 calculates the same digest as
+ * #MD5 with the same key.
+ */
+static void
+CheckMD5x4(size_t length)
+{
+  static constexpr MD5State keys[MD5x4State::N] = {
+    { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476 },
+    { 0x12345678, 0x9abcdef0, 0x0fedcba9, 0x87654321 },
+    { 0, 0, 0, 0 },
+    { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+  };
+
+  char data[1000];
+  for (size_t i = 0; i < length; ++i)
+    data[i] = char('A' + i % 26);
+
+  MD5x4State state;
+  for (unsigned i = 0; i < MD5x4State::N; ++i)
+    state.Set(i, keys[i]);
+
+  MD5x4 md5x4;
+  md5x4.Initialise(state);
+  md5x4.Append(data, length);
+  md5x4.Finalize();
+
+  bool equal = true;
+  for (unsigned i = 0; i < MD5x4State::N; ++i) {
+    MD5 md5;
+    md5.Initialise(keys[i]);
+    for (size_t j = 0; j < length; ++j)
+      md5.Append((uint8_t)data[j]);
+    md5.Finalize();
+
+    char expected[MD5::DIGEST_LENGTH + 1], actual[MD5::DIGEST_LENGTH + 1];
+    md5.GetDigest(expected);
+    MD5::GetDigest(md5x4.GetState().Get(i), actual);
+    equal = equal && strcmp(expected, actual) == 0;
+  }
+
+  ok1(equal);
+}
+
 int main(int argc, char **argv)
 try {
-  plan_tests(4);
+  plan_tests(10);
+
+  CheckMD5x4(0);
+  CheckMD5x4(1);
+  CheckMD5x4(55);
+  CheckMD5x4(56);
+  CheckMD5x4(64);
+  CheckMD5x4(1000);
 
   CheckGRecord(_T("test/data/grecord64a.igc"));
   CheckGRecord(_T("test/data/grecord64b.igc"));
@@ -222,11 +222,28 @@ test_clip_polygon()
     make_geo_point(-5, -50),
   };
   test_clip_polygon(clip, src8, 3, result7, 4);
+
+  /* entirely outside */
+  const GeoPoint src9[4] = {
+    make_geo_point(8, 2),
+    make_geo_point(8, 4),
+    make_geo_point(12, 4),
+    make_geo_point(12, 2),
+  };
+  test_clip_polygon(clip, src9, 4, NULL, 0);
+
+  /* entirely outside, but not beyond a single bound */
+  const GeoPoint src10[3] = {
+    make_geo_point(0, 4),
+    make_geo_point(4, 8),
+    make_geo_point(0, 8),
+  };
+  test_clip_polygon(clip, src10, 3, NULL, 0);
 }
 
 int main(int argc, char **argv)
 {
-  plan_tests(24);
+  plan_tests(26);
 
   test_clip_line();
   test_clip_polygon();
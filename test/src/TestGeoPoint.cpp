@@ -29,7 +29,7 @@
 
 int main(int argc, char **argv)
 {
-  plan_tests(92);
+  plan_tests(94);
 
   // test constructor
   GeoPoint p1(Angle::Degrees(345.32), Angle::Degrees(-6.332));
@@ -209,6 +209,32 @@ int main(int argc, char **argv)
   GeoPoint p10(GeoPoint::Invalid());
   ok1(!p10.IsValid());
 
+  // test the batch versions of DistanceBearing()
+  {
+    const GeoPoint points[] = { p2, p3, p4, p5, p6, p11, p12 };
+    constexpr unsigned n = sizeof(points) / sizeof(points[0]);
+    double distances[n];
+    Angle bearings[n];
+
+    DistanceBearing(p1, points, n, distances, bearings);
+    bool batch_okay = true;
+    for (unsigned i = 0; i < n; ++i) {
+      const GeoVector expected = p1.DistanceBearing(points[i]);
+      batch_okay = batch_okay && distances[i] == expected.distance &&
+        bearings[i] == expected.bearing;
+    }
+    ok1(batch_okay);
+
+    LegDistanceBearing(points, n, distances, bearings);
+    bool legs_okay = true;
+    for (unsigned i = 0; i + 1 < n; ++i) {
+      const GeoVector expected = points[i].DistanceBearing(points[i + 1]);
+      legs_okay = legs_okay && distances[i] == expected.distance &&
+        bearings[i] == expected.bearing;
+    }
+    ok1(legs_okay);
+  }
+
 
   return exit_status();
 }
@@ -170,6 +170,16 @@ TestFix()
   ok1(equals(fix.location, -51.05195, -7.70611667));
   ok1(fix.pressure_altitude == 10490);
   ok1(fix.gps_altitude == 7);
+
+  ok1(IGCParseFix("B1122535103117S00742367WA-0012-0005",
+                  extensions, fix));
+  ok1(fix.pressure_altitude == -12);
+  ok1(fix.gps_altitude == -5);
+
+  ok1(!IGCParseFix("B1122535103117S00742367WA-0012-000",
+                   extensions, fix));
+  ok1(!IGCParseFix("B1122535103117S00742367WA00-1200005",
+                   extensions, fix));
 }
 
 static void
@@ -252,7 +262,7 @@ TestDeclarationTurnpoint()
 
 int main(int argc, char **argv)
 {
-  plan_tests(136);
+  plan_tests(141);
 
   TestHeader();
   TestDate();
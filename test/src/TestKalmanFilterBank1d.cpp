@@ -0,0 +1,76 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#include "TestMath.hpp"
+#include "Math/KalmanFilterBank1d.hpp"
+#include "Math/KalmanFilter1d.hpp"
+#include "TestUtil.hpp"
+
+#include <math.h>
+
+static constexpr unsigned N = 3;
+
+void
+TestKalmanFilterBank1d()
+{
+  KalmanFilterBank1d<N> bank(0.3);
+  KalmanFilter1d single[N];
+  for (auto &i : single) {
+    i.SetAccelerationVariance(0.3);
+    i.Reset();
+  }
+
+  bank.Reset(1, 100);
+  single[1].Reset(100);
+
+  bool equal = true;
+  double t = 0;
+  for (unsigned step = 0; step < 200; ++step) {
+    const double dt = step % 7 == 0 ? 0.05 : 0.02;
+    t += dt;
+
+    const double z[N] = { t * 2, 100 + t * t, -t };
+    const double var_z[N] = { 0.25, 1, 4 };
+
+    bank.Update(z, var_z, dt);
+    for (unsigned i = 0; i < N; ++i) {
+      single[i].Update(z[i], var_z[i], dt);
+      equal = equal &&
+        equals(bank.GetXAbs(i), single[i].GetXAbs()) &&
+        equals(bank.GetXVel(i), single[i].GetXVel()) &&
+        equals(bank.GetCovAbsAbs(i), single[i].GetCovAbsAbs()) &&
+        equals(bank.GetCovAbsVel(i), single[i].GetCovAbsVel()) &&
+        equals(bank.GetCovVelVel(i), single[i].GetCovVelVel());
+    }
+  }
+
+  ok1(equal);
+
+  ok1(equals(bank.GetXAbs(0), single[0].GetXAbs()));
+  ok1(fabs(bank.GetXVel(0) - 2) < 0.1);
+  ok1(fabs(bank.GetXVel(2) + 1) < 0.1);
+
+  bank.Reset();
+  ok1(bank.GetXAbs(1) == 0);
+  ok1(bank.GetCovVelVel(1) == 0.3);
+}
@@ -82,12 +82,96 @@ LSTest1(double w)
   return true;
 }
 
+/**
+ * Add more points than fit into the store.
+ */
+static void
+TestDecimate()
+{
+  LeastSquares ls;
+  ls.Reset();
+
+  constexpr int n = 2500;
+  for (int i = 0; i < n; ++i)
+    ls.Update(i, 2 * i);
+
+  const auto &slots = ls.GetSlots();
+  ok1(ls.GetCount() == n);
+  ok1(slots.size() > 250 && slots.size() <= slots.capacity());
+
+  /* the whole range is still covered, and the newest point is kept
+     as it is */
+  ok1(slots.front().x < 10);
+  ok1(equals(slots.back().x, n - 1));
+  ok1(equals(slots.back().y, 2 * (n - 1)));
+
+  /* the decimated points are still on the line */
+  bool on_line = true;
+  for (const auto &i : slots)
+    if (fabs(i.y - 2 * i.x) > 1e-6)
+      on_line = false;
+  ok1(on_line);
+
+  /* the least squares fit is not affected */
+  ok1(equals(ls.GetGradient(), 2));
+  ok1(equals(ls.GetAverageY(), n - 1));
+}
+
+/**
+ * Compare the bulk and merge APIs with adding all points one by one.
+ */
+static void
+TestBulkMerge()
+{
+  constexpr unsigned n = 200, half = 70;
+  double x[n], y[n];
+  for (unsigned i = 0; i < n; ++i) {
+    x[i] = i * 0.5;
+    y[i] = 3 * x[i] + 10 * sin(i * 0.3);
+  }
+
+  LeastSquares single;
+  single.Reset();
+  for (unsigned i = 0; i < n; ++i)
+    single.Update(x[i], y[i]);
+
+  LeastSquares bulk;
+  bulk.Reset();
+  bulk.Update(x, y, n);
+
+  ok1(bulk.GetCount() == n);
+  ok1(equals(bulk.GetGradient(), single.GetGradient()));
+  ok1(equals(bulk.GetAverageY(), single.GetAverageY()));
+  ok1(equals(bulk.GetVarX(), single.GetVarX()));
+
+  LeastSquares a, b;
+  a.Reset();
+  b.Reset();
+  a.Update(x, y, half);
+  b.Update(x + half, y + half, n - half);
+  a.Merge(b);
+
+  ok1(a.GetCount() == n);
+  ok1(a.GetSlots().size() == n);
+  ok1(equals(a.GetMinX(), single.GetMinX()) &&
+      equals(a.GetMaxX(), single.GetMaxX()));
+  ok1(equals(a.GetGradient(), single.GetGradient()));
+  ok1(equals(a.GetMeanX(), single.GetMeanX()) &&
+      equals(a.GetMeanY(), single.GetMeanY()));
+  ok1(equals(a.GetVarX(), single.GetVarX()) &&
+      equals(a.GetVarY(), single.GetVarY()) &&
+      equals(a.GetCovXY(), single.GetCovXY()));
+}
+
 int main(int argc, char **argv)
 {
-  plan_tests(2);
+  plan_tests(20);
 
   ok1(LSTest1(1));
   ok1(LSTest1(2));
 
+  TestDecimate();
+  TestBulkMerge();
+
   return exit_status();
 }
@@ -21,6 +21,8 @@
 */
 
 #include "IGC/IGCWriter.hpp"
+#include "IO/FileOutputStream.hxx"
+#include "Logger/LoggerWriteThread.hpp"
 #include "OS/FileUtil.hpp"
 #include "NMEA/Info.hpp"
 #include "IO/FileLineReader.hpp"
@@ -150,24 +152,47 @@ Run(IGCWriter &writer)
 static void
 Run(Path path)
 {
-  IGCWriter writer(path);
+  FileOutputStream file(path, FileOutputStream::Mode::CREATE_VISIBLE);
+  IGCWriter writer(file);
   Run(writer);
+  file.Commit();
+}
+
+static void
+RunThreaded(Path path)
+{
+  FileOutputStream file(path, FileOutputStream::Mode::CREATE_VISIBLE);
+  LoggerWriteThread write_thread(file);
+  IGCWriter writer(write_thread);
+  Run(writer);
+  write_thread.Finish();
+  file.Commit();
+}
+
+static void
+Check(Path path)
+{
+  CheckTextFile(path, expect);
+
+  GRecord grecord;
+  grecord.Initialize();
+  grecord.VerifyGRecordInFile(path);
 }
 
 int main(int argc, char **argv)
 try {
-  plan_tests(49);
+  plan_tests(98);
 
   const Path path(_T("output/test/test.igc"));
   File::Delete(path);
 
   Run(path);
+  Check(path);
 
-  CheckTextFile(path, expect);
+  File::Delete(path);
 
-  GRecord grecord;
-  grecord.Initialize();
-  grecord.VerifyGRecordInFile(path);
+  RunThreaded(path);
+  Check(path);
 
   return exit_status();
 } catch (const std::runtime_error &e) {
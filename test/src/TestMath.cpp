@@ -25,10 +25,12 @@
 
 int main(int argc, char **argv)
 {
-  plan_tests(N_TEST_LINE2D + N_TEST_QUADRILATERAL);
+  plan_tests(N_TEST_LINE2D + N_TEST_QUADRILATERAL +
+             N_TEST_KALMAN_FILTER_BANK_1D);
 
   TestLine2D();
   TestQuadrilateral();
+  TestKalmanFilterBank1d();
 
   return exit_status();
 }
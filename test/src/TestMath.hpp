@@ -3,3 +3,6 @@ void TestLine2D();
 
 static constexpr unsigned N_TEST_QUADRILATERAL = 56;
 void TestQuadrilateral();
+
+static constexpr unsigned N_TEST_KALMAN_FILTER_BANK_1D = 6;
+void TestKalmanFilterBank1d();
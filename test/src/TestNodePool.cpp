@@ -0,0 +1,109 @@
+/*
+Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+#include "Util/NodePool.hpp"
+
+extern "C" {
+#include "tap.h"
+}
+
+#include <unordered_map>
+#include <list>
+
+typedef std::unordered_map<unsigned, unsigned, std::hash<unsigned>,
+                           std::equal_to<unsigned>,
+                           NodePoolAllocator<std::pair<const unsigned,
+                                                       unsigned>>> Map;
+
+static void
+TestReuse()
+{
+  NodePool pool;
+
+  void *a = pool.Allocate(24);
+  void *b = pool.Allocate(24);
+  ok1(a != nullptr);
+  ok1(b != nullptr);
+  ok1(a != b);
+
+  /* a freed block is handed out again */
+  pool.Deallocate(a, 24);
+  ok1(pool.Allocate(24) == a);
+
+  /* other sizes are passed to the heap */
+  void *c = pool.Allocate(100);
+  ok1(c != nullptr);
+  pool.Deallocate(c, 100);
+
+  pool.Deallocate(a, 24);
+  pool.Deallocate(b, 24);
+}
+
+static void
+TestMap()
+{
+  NodePool pool;
+  Map map{Map::allocator_type(pool)};
+
+  for (unsigned run = 0; run < 3; ++run) {
+    for (unsigned i = 0; i < 1000; ++i)
+      map.insert(std::make_pair(i, i * 2));
+
+    ok1(map.size() == 1000);
+    ok1(map.find(500) != map.end() && map.find(500)->second == 1000);
+
+    map.clear();
+    ok1(map.empty());
+  }
+}
+
+static void
+TestList()
+{
+  NodePool pool;
+  std::list<int, NodePoolAllocator<int>> a{NodePoolAllocator<int>(pool)};
+  std::list<int, NodePoolAllocator<int>> b{NodePoolAllocator<int>(pool)};
+
+  a.push_back(3);
+  a.push_back(1);
+  b.push_back(2);
+
+  /* splicing is allowed between lists sharing one pool */
+  a.splice(a.end(), b);
+  a.sort();
+
+  ok1(a.size() == 3);
+  ok1(b.empty());
+  ok1(a.front() == 1 && a.back() == 3);
+}
+
+int main(int argc, char **argv)
+{
+  plan_tests(5 + 3 * 3 + 3);
+
+  TestReuse();
+  TestMap();
+  TestList();
+
+  return exit_status();
+}
@@ -407,6 +407,51 @@ TestLowTPFinal()
   CheckTotal(aircraft, stats, tp1, tp2, tp3);
 }
 
+static void
+TestGlideSolutions()
+{
+  const double width(1);
+  OrderedTask task(task_behaviour);
+  const StartPoint tp1(new LineSectorZone(wp1->location, width),
+                       WaypointPtr(wp1), task_behaviour,
+                       ordered_task_settings.start_constraints);
+  task.Append(tp1);
+  const ASTPoint tp2(new LineSectorZone(wp3->location, width),
+                     MakeWaypointPtr(*wp3, 1500), task_behaviour);
+  task.Append(tp2);
+  const FinishPoint tp3(new LineSectorZone(wp4->location, width),
+                        MakeWaypointPtr(*wp4, 100), task_behaviour,
+                        ordered_task_settings.finish_constraints, false);
+  task.Append(tp3);
+  task.SetActiveTaskPoint(1);
+  task.UpdateGeometry();
+
+  AircraftState aircraft;
+  aircraft.Reset();
+  aircraft.location = wp1->location;
+  aircraft.altitude = 2000;
+
+  GlidePolar polars[4] = {
+    GlidePolar(0), GlidePolar(1), GlidePolar(2), GlidePolar(4),
+  };
+  polars[3].SetBugs(0.8);
+
+  GlideResult results[4];
+  task.CalcGlideSolutions(aircraft, polars, 4, results);
+
+  /* each result must be the same as the one calculated by a regular
+     update with that polar */
+  for (unsigned i = 0; i < 4; ++i) {
+    task.Update(aircraft, aircraft, polars[i]);
+    const GlideResult &expected = task.GetStats().total.solution_remaining;
+    ok1(results[i].IsOk());
+    ok1(equals(results[i].vector.distance, expected.vector.distance));
+    ok1(equals(results[i].altitude_difference,
+               expected.altitude_difference));
+    ok1(equals(results[i].time_elapsed, expected.time_elapsed));
+  }
+}
+
 static void
 TestAll()
 {
@@ -421,7 +466,7 @@ TestAll()
 
 int main(int argc, char **argv)
 {
-  plan_tests(728);
+  plan_tests(744);
 
   task_behaviour.SetDefaults();
 
@@ -436,5 +481,7 @@ int main(int argc, char **argv)
   glide_polar.SetMC(4);
   TestAll();
 
+  TestGlideSolutions();
+
   return exit_status();
 }
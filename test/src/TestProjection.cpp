@@ -46,12 +46,40 @@ test_simple()
                                     Angle::Zero()), 0, 0);
 }
 
+/**
+ * The array version of GeoToScreen() must return exactly the same
+ * results as the single-point version.
+ */
+static void
+test_batch()
+{
+  Projection prj;
+  prj.SetGeoLocation(GeoPoint(Angle::Degrees(7.7), Angle::Degrees(51.05)));
+  prj.SetScreenOrigin(320, 240);
+  prj.SetScale(640. / (100 * 2));
+  prj.SetScreenAngle(Angle::Degrees(37));
+
+  GeoPoint points[16];
+  for (unsigned i = 0; i < 16; ++i)
+    points[i] = GeoPoint(Angle::Degrees(7.7 + 0.37 * (i % 4) - 0.5),
+                         Angle::Degrees(51.05 + 0.29 * (i / 4) - 0.4));
+
+  PixelPoint screen[16];
+  prj.GeoToScreen(points, screen, 16);
+
+  bool equal = true;
+  for (unsigned i = 0; i < 16; ++i)
+    equal &= screen[i] == prj.GeoToScreen(points[i]);
+  ok1(equal);
+}
+
 int
 main(int argc, char **argv)
 {
-  plan_tests(4);
+  plan_tests(5);
 
   test_simple();
+  test_batch();
 
   return exit_status();
 }
@@ -158,13 +158,53 @@ test_azimuth()
   }
 }
 
+static void
+test_cache()
+{
+  GeoPoint location(Angle::Degrees(7.7061111111111114),
+                    Angle::Degrees(51.051944444444445));
+  BrokenDateTime dt;
+  dt.year = 2010;
+  dt.month = 9;
+  dt.day = 24;
+  dt.hour = 8;
+  dt.minute = 21;
+  dt.second = 12;
+
+  const RoughTimeDelta time_zone = RoughTimeDelta::FromHours(2);
+
+  SunEphemeris::Cache cache;
+  const SunEphemeris::Result first = cache.Get(location, dt, time_zone);
+  SunEphemeris::Result sun =
+    SunEphemeris::CalcSunTimes(location, dt, time_zone);
+  ok1(equals(first.time_of_sunset, sun.time_of_sunset));
+  ok1(equals(first.azimuth, sun.azimuth.Degrees()));
+
+  /* a few minutes later, slightly moved: the times are reused, but
+     the azimuth is exact */
+  dt.minute = 50;
+  const GeoPoint moved(Angle::Degrees(7.71), Angle::Degrees(51.06));
+  const SunEphemeris::Result &cached = cache.Get(moved, dt, time_zone);
+  sun = SunEphemeris::CalcSunTimes(moved, dt, time_zone);
+  ok1(equals(cached.time_of_sunset, first.time_of_sunset));
+  ok1(equals(cached.azimuth, sun.azimuth.Degrees()));
+
+  /* the next hour invalidates the cached times */
+  dt.hour = 9;
+  const SunEphemeris::Result &next = cache.Get(moved, dt, time_zone);
+  sun = SunEphemeris::CalcSunTimes(moved, dt, time_zone);
+  ok1(equals(next.time_of_sunset, sun.time_of_sunset));
+  ok1(equals(next.azimuth, sun.azimuth.Degrees()));
+}
+
 int main(int argc, char **argv)
 {
-  plan_tests(55);
+  plan_tests(61);
 
   test_times();
   test_times_southern();
   test_azimuth();
+  test_cache();
 
   return exit_status();
 }
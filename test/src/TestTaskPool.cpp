@@ -0,0 +1,152 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#include "Thread/TaskPool.hpp"
+#include "TestUtil.hpp"
+
+#include <atomic>
+#include <vector>
+
+static void
+TestSum(TaskPool &pool)
+{
+  std::atomic<unsigned> sum(0);
+
+  {
+    TaskGroup group(pool);
+    for (unsigned i = 1; i <= 1000; ++i)
+      group.Submit([&sum, i](){ sum += i; });
+    group.Wait();
+  }
+
+  ok1(sum == 500500);
+}
+
+/**
+ * Tasks which wait for nested groups must not deadlock, not even
+ * with a single worker.
+ */
+static void
+TestNested(TaskPool &pool)
+{
+  std::atomic<unsigned> count(0);
+
+  TaskGroup outer(pool);
+  for (unsigned i = 0; i < 8; ++i) {
+    outer.Submit([&pool, &count](){
+        TaskGroup inner(pool);
+        for (unsigned j = 0; j < 8; ++j)
+          inner.Submit([&count](){ ++count; });
+        inner.Wait();
+      });
+  }
+  outer.Wait();
+
+  ok1(count == 64);
+}
+
+static void
+TestPriority()
+{
+  TaskPool pool(1);
+
+  /* occupy the only worker until all other tasks are queued */
+  Mutex mutex;
+  Cond cond;
+  bool started = false, released = false;
+
+  TaskGroup group(pool);
+  group.Submit([&](){
+      const ScopeLock protect(mutex);
+      started = true;
+      cond.broadcast();
+      while (!released)
+        cond.wait(mutex);
+    });
+
+  {
+    const ScopeLock protect(mutex);
+    while (!started)
+      cond.wait(mutex);
+  }
+
+  std::vector<TaskPool::Priority> order;
+  for (auto priority : {TaskPool::Priority::LOW,
+                        TaskPool::Priority::NORMAL,
+                        TaskPool::Priority::HIGH})
+    group.Submit([&, priority](){
+        const ScopeLock protect(mutex);
+        order.push_back(priority);
+        cond.broadcast();
+      }, priority);
+
+  {
+    /* don't call TaskGroup::Wait() before all tasks have finished,
+       or this thread would help and run them concurrently */
+    const ScopeLock protect(mutex);
+    released = true;
+    cond.broadcast();
+    while (order.size() < 3)
+      cond.wait(mutex);
+  }
+
+  group.Wait();
+
+  ok1(order.size() == 3);
+  ok1(order[0] == TaskPool::Priority::HIGH);
+  ok1(order[1] == TaskPool::Priority::NORMAL);
+  ok1(order[2] == TaskPool::Priority::LOW);
+}
+
+static void
+TestAffinity(TaskPool &pool)
+{
+  std::atomic<unsigned> count(0);
+
+  {
+    TaskGroup group(pool);
+    for (unsigned i = 0; i < 100; ++i)
+      group.Submit([&count](){ ++count; },
+                   TaskPool::Priority::NORMAL, i % 3);
+  }
+
+  ok1(count == 100);
+}
+
+int main(int argc, char **argv)
+{
+  plan_tests(11);
+
+  TaskPool single(1), multi(4);
+  ok1(single.GetWorkerCount() == 1);
+  ok1(multi.GetWorkerCount() == 4);
+
+  TestSum(single);
+  TestSum(multi);
+  TestNested(single);
+  TestNested(multi);
+  TestPriority();
+  TestAffinity(multi);
+
+  return exit_status();
+}
@@ -151,11 +151,49 @@ static void thermal_collection_test(const double telapsed,
   ok1(fabs(col.GetSlice(col.size()/2).w_n-we) < w_tol);
 }
 
+static void thermal_decay_test(const double telapsed,
+                               const double dt,
+                               const double w0,
+                               const double w1,
+                               const double decay)
+{
+  ThermalEncounterCollection col;
+  ThermalEncounterBand band;
+
+  const double h0 = 123;
+  const double n_tol = 0.001;
+  const double w_tol = 0.1*(w0+w1)/2;
+  double t=0;
+  double h= h0;
+
+  col.Reset();
+
+  band.Reset();
+  simulate_climb(band, t, h, telapsed, dt, w0, w0);
+  col.Merge(band, decay);
+  // nothing to decay yet
+  ok1(fabs(col.GetSlice(0).n-1)< n_tol);
+
+  // same climb, later, with different strength
+  band.Reset();
+  t += 100; h = h0;
+  simulate_climb(band, t, h, telapsed*w0/w1, dt, w1, w1);
+  col.Merge(band, decay);
+  report(col,"decay");
+
+  // expect the first climb to have less weight
+  ok1(fabs(col.GetSlice(0).n-(1+decay))< n_tol);
+
+  const double we = (w0*decay+w1)/(1+decay);
+  ok1(fabs(col.GetSlice(0).w_n-we) < w_tol);
+}
 
 int main(int argc, char** argv) {
   const int num_encounter_tests = 8;
   const int num_collection_tests = 2;
-  plan_tests(7*num_encounter_tests + 9*num_collection_tests);
+  const int num_decay_tests = 2;
+  plan_tests(7*num_encounter_tests + 9*num_collection_tests +
+             3*num_decay_tests);
 
   // test different thermal strengths
   thermal_encounter_test(100,1,1,1);
@@ -181,5 +219,9 @@ int main(int argc, char** argv) {
   // test collection, different strength
   thermal_collection_test(100,1,1,0.5);
 
+  // test collection with decay of older climbs
+  thermal_decay_test(100,1,1,1,0.5);
+  thermal_decay_test(100,1,1,2,0.8);
+
   return exit_status();
 }
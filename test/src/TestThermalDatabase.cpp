@@ -0,0 +1,76 @@
+/* Copyright_License {
+
+  XCSoar Glide Computer - http://www.xcsoar.org/
+  Copyright (C) 2000-2016 The XCSoar Project
+  A detailed list of copyright holders can be found in the file "AUTHORS".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+}
+*/
+
+
+#include "Computer/ThermalDatabase.hpp"
+#include "TestUtil.hpp"
+
+static ThermalRecord
+MakeRecord(const GeoPoint &location, double lift_rate)
+{
+  ThermalRecord record;
+  record.location = location;
+  record.ground_height = 200;
+  record.base = 800;
+  record.top = 1800;
+  record.lift_rate = lift_rate;
+  record.time_of_day = 12 * 3600;
+  return record;
+}
+
+int main(int argc, char **argv)
+{
+  plan_tests(8);
+
+  const GeoPoint center(Angle::Degrees(7.7), Angle::Degrees(51.4));
+
+  ThermalDatabase database;
+  ok1(database.IsEmpty());
+  ok1(database.FindNearest(center, 10000) == nullptr);
+
+  /* a grid of thermals, 1 km apart */
+  for (int x = -10; x <= 10; ++x)
+    for (int y = -10; y <= 10; ++y)
+      database.Add(MakeRecord(center.Parametric(GeoPoint(Angle::Degrees(x * 0.0144),
+                                                         Angle::Degrees(y * 0.009)),
+                                                1),
+                              x + 10 + (y + 10) * 0.01));
+
+  ok1(database.size() == 21 * 21);
+
+  const ThermalRecord *nearest = database.FindNearest(center, 5000);
+  ok1(nearest != nullptr);
+  ok1(nearest != nullptr && nearest->location.Distance(center) < 10);
+  ok1(nearest != nullptr && equals(nearest->lift_rate, 10.1));
+
+  unsigned n = 0;
+  database.VisitWithinRange(center, 1500, [&n](const ThermalRecord &){
+      ++n;
+    });
+  /* the center and its 8 neighbours */
+  ok1(n == 9);
+
+  database.Clear();
+  ok1(database.IsEmpty());
+
+  return exit_status();
+}
@@ -53,7 +53,7 @@ ZeroFinderTest::f(const double x)
 
 int main(int argc, char **argv)
 {
-  plan_tests(18);
+  plan_tests(24);
 
   ZeroFinderTest zf(-100, 100, 0);
   ok1(equals(zf.find_zero(-150), -1));
@@ -84,5 +84,14 @@ int main(int argc, char **argv)
   ok1(equals(zf4.find_min(1), M_PI));
   ok1(equals(zf4.find_min(140), M_PI));
 
+  ok1(equals(zf2.find_zero_near(2.4, 0.5), 2.5));
+  ok1(equals(zf2.find_zero_near(50, 1), 2.5));
+  ok1(equals(zf2.find_zero_near(-150, 1), 2.5));
+
+  ok1(equals(zf3.find_zero_near(1.5, 0.2), 1.584963));
+  ok1(equals(zf3.find_zero_near(9, 0.5), 1.584963));
+
+  ok1(equals(zf4.find_zero_near(M_PI_2, 0.01), M_PI_2));
+
   return exit_status();
 }